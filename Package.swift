@@ -398,6 +398,7 @@ let package = Package(
         "internal/platform/implementation/apple/Tests",
         "internal/platform/implementation/apple/Mediums/Ble/Sockets/Tests",
         "internal/platform/implementation/windows",
+        "internal/perf",
         "third_party",
         "CONTRIBUTING.md",
         "LICENSE",
@@ -439,6 +440,8 @@ let package = Package(
         "connections/implementation/offline_frames_test.cc",
         "connections/implementation/offline_service_controller_test.cc",
         "connections/implementation/encryption_runner_test.cc",
+        "connections/implementation/encryption_benchmark.cc",
+        "connections/implementation/shared_key_hub_test.cc",
         "connections/implementation/p2p_cluster_pcp_handler_test.cc",
         "connections/implementation/p2p_point_to_point_pcp_handler_test.cc",
         "connections/implementation/base_pcp_handler_test.cc",
@@ -446,6 +449,15 @@ let package = Package(
         "connections/implementation/internal_payload_factory_test.cc",
         "connections/implementation/client_proxy_test.cc",
         "connections/implementation/payload_manager_test.cc",
+        "connections/implementation/low_latency_stream_reader_test.cc",
+        "connections/implementation/low_latency_stream_benchmark.cc",
+        "connections/implementation/datagram_benchmark.cc",
+        "connections/implementation/endpoint_channel_manager_benchmark.cc",
+        "connections/implementation/payload_receive_benchmark.cc",
+        "connections/implementation/payload_header_benchmark.cc",
+        "connections/implementation/cancellation_benchmark.cc",
+        "connections/implementation/rate_limiter_test.cc",
+        "connections/implementation/lock_contention_simulation_test.cc",
         "connections/implementation/offline_frames_validator_test.cc",
         "connections/implementation/service_controller_router_test.cc",
         "connections/implementation/bluetooth_bwu_test.cc",
@@ -482,8 +494,11 @@ let package = Package(
         "connections/implementation/endpoint_manager_test.cc",
         "connections/implementation/bluetooth_device_name_test.cc",
         "connections/implementation/wifi_lan_service_info_test.cc",
+        "connections/implementation/wifi_lan_service_info_cache_test.cc",
         "connections/implementation/pcp_manager_test.cc",
         "connections/implementation/ble_advertisement_test.cc",
+        "connections/implementation/advertisement_codecs_benchmark.cc",
+        "connections/implementation/wifi_lan_discovery_benchmark.cc",
         "connections/implementation/base_endpoint_channel_test.cc",
         "connections/implementation/reconnect_manager_test.cc",
         "connections/v3/connections_device_test.cc",
@@ -553,8 +568,11 @@ let package = Package(
         "internal/platform/error_code_recorder_test.cc",
         "internal/platform/future_test.cc",
         "internal/platform/cancellation_flag_test.cc",
+        "internal/platform/lock_profiler_test.cc",
         "internal/platform/bluetooth_adapter_test.cc",
         "internal/platform/byte_utils_test.cc",
+        "internal/platform/byte_span_reader_test.cc",
+        "internal/platform/byte_span_writer_test.cc",
         "internal/platform/direct_executor_test.cc",
         "internal/platform/borrowable_test.cc",
         "internal/platform/implementation/windows/http_loader_test.cc",
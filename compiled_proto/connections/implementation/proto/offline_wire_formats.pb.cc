@@ -64,6 +64,8 @@ constexpr ConnectionRequestFrame::ConnectionRequestFrame(
   , endpoint_info_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
   , device_info_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
   , medium_metadata_(nullptr)
+  , location_hint_(nullptr)
+  , shared_key_offer_(nullptr)
   , nonce_(0)
   , keep_alive_interval_millis_(0)
   , keep_alive_timeout_millis_(0)
@@ -80,16 +82,49 @@ struct ConnectionRequestFrameDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT ConnectionRequestFrameDefaultTypeInternal _ConnectionRequestFrame_default_instance_;
+constexpr SharedKeyOffer::SharedKeyOffer(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : session_tag_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
+  , nonce_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string){}
+struct SharedKeyOfferDefaultTypeInternal {
+  constexpr SharedKeyOfferDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~SharedKeyOfferDefaultTypeInternal() {}
+  union {
+    SharedKeyOffer _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT SharedKeyOfferDefaultTypeInternal _SharedKeyOffer_default_instance_;
+constexpr SharedKeyFrame::SharedKeyFrame(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : nonce_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
+  , confirmation_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
+  , type_(0)
+{}
+struct SharedKeyFrameDefaultTypeInternal {
+  constexpr SharedKeyFrameDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~SharedKeyFrameDefaultTypeInternal() {}
+  union {
+    SharedKeyFrame _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT SharedKeyFrameDefaultTypeInternal _SharedKeyFrame_default_instance_;
 constexpr ConnectionResponseFrame::ConnectionResponseFrame(
   ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
   : handshake_data_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
   , os_info_(nullptr)
+  , location_hint_(nullptr)
   , status_(0)
   , response_(0)
 
   , multiplex_socket_bitmask_(0)
   , nearby_connections_version_(0)
-  , safe_to_disconnect_version_(0){}
+  , safe_to_disconnect_version_(0)
+  , keep_alive_timeout_millis_(0)
+  , supports_shared_key_(false)
+  , supports_payload_header_elision_(false)
+  , supports_datagram_(false){}
 struct ConnectionResponseFrameDefaultTypeInternal {
   constexpr ConnectionResponseFrameDefaultTypeInternal()
     : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
@@ -107,7 +142,8 @@ constexpr PayloadTransferFrame_PayloadHeader::PayloadTransferFrame_PayloadHeader
   , total_size_(int64_t{0})
   , type_(0)
 
-  , is_sensitive_(false){}
+  , is_sensitive_(false)
+  , sequence_number_(int64_t{0}){}
 struct PayloadTransferFrame_PayloadHeaderDefaultTypeInternal {
   constexpr PayloadTransferFrame_PayloadHeaderDefaultTypeInternal()
     : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
@@ -307,7 +343,8 @@ struct BandwidthUpgradeNegotiationFrame_ClientIntroductionAckDefaultTypeInternal
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT BandwidthUpgradeNegotiationFrame_ClientIntroductionAckDefaultTypeInternal _BandwidthUpgradeNegotiationFrame_ClientIntroductionAck_default_instance_;
 constexpr BandwidthUpgradeNegotiationFrame::BandwidthUpgradeNegotiationFrame(
   ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : upgrade_path_info_(nullptr)
+  : alternative_upgrade_path_infos_()
+  , upgrade_path_info_(nullptr)
   , client_introduction_(nullptr)
   , client_introduction_ack_(nullptr)
   , safe_to_close_prior_channel_(nullptr)
@@ -941,6 +978,74 @@ constexpr ConnectionRequestFrame_ConnectionMode ConnectionRequestFrame::Connecti
 constexpr ConnectionRequestFrame_ConnectionMode ConnectionRequestFrame::ConnectionMode_MAX;
 constexpr int ConnectionRequestFrame::ConnectionMode_ARRAYSIZE;
 #endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+bool SharedKeyFrame_FrameType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> SharedKeyFrame_FrameType_strings[4] = {};
+
+static const char SharedKeyFrame_FrameType_names[] =
+  "CLIENT_FINISH"
+  "DECLINE"
+  "SERVER_INIT"
+  "UNKNOWN_FRAME_TYPE";
+
+static const ::PROTOBUF_NAMESPACE_ID::internal::EnumEntry SharedKeyFrame_FrameType_entries[] = {
+  { {SharedKeyFrame_FrameType_names + 0, 13}, 2 },
+  { {SharedKeyFrame_FrameType_names + 13, 7}, 3 },
+  { {SharedKeyFrame_FrameType_names + 20, 11}, 1 },
+  { {SharedKeyFrame_FrameType_names + 31, 18}, 0 },
+};
+
+static const int SharedKeyFrame_FrameType_entries_by_number[] = {
+  3, // 0 -> UNKNOWN_FRAME_TYPE
+  2, // 1 -> SERVER_INIT
+  0, // 2 -> CLIENT_FINISH
+  1, // 3 -> DECLINE
+};
+
+const std::string& SharedKeyFrame_FrameType_Name(
+    SharedKeyFrame_FrameType value) {
+  static const bool dummy =
+      ::PROTOBUF_NAMESPACE_ID::internal::InitializeEnumStrings(
+          SharedKeyFrame_FrameType_entries,
+          SharedKeyFrame_FrameType_entries_by_number,
+          4, SharedKeyFrame_FrameType_strings);
+  (void) dummy;
+  int idx = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumName(
+      SharedKeyFrame_FrameType_entries,
+      SharedKeyFrame_FrameType_entries_by_number,
+      4, value);
+  return idx == -1 ? ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString() :
+                     SharedKeyFrame_FrameType_strings[idx].get();
+}
+bool SharedKeyFrame_FrameType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SharedKeyFrame_FrameType* value) {
+  int int_value;
+  bool success = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumValue(
+      SharedKeyFrame_FrameType_entries, 4, name, &int_value);
+  if (success) {
+    *value = static_cast<SharedKeyFrame_FrameType>(int_value);
+  }
+  return success;
+}
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr SharedKeyFrame_FrameType SharedKeyFrame::UNKNOWN_FRAME_TYPE;
+constexpr SharedKeyFrame_FrameType SharedKeyFrame::SERVER_INIT;
+constexpr SharedKeyFrame_FrameType SharedKeyFrame::CLIENT_FINISH;
+constexpr SharedKeyFrame_FrameType SharedKeyFrame::DECLINE;
+constexpr SharedKeyFrame_FrameType SharedKeyFrame::FrameType_MIN;
+constexpr SharedKeyFrame_FrameType SharedKeyFrame::FrameType_MAX;
+constexpr int SharedKeyFrame::FrameType_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 bool ConnectionResponseFrame_ResponseStatus_IsValid(int value) {
   switch (value) {
     case 0:
@@ -1010,32 +1115,36 @@ bool PayloadTransferFrame_PayloadHeader_PayloadType_IsValid(int value) {
     case 1:
     case 2:
     case 3:
+    case 4:
       return true;
     default:
       return false;
   }
 }
 
-static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> PayloadTransferFrame_PayloadHeader_PayloadType_strings[4] = {};
+static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> PayloadTransferFrame_PayloadHeader_PayloadType_strings[5] = {};
 
 static const char PayloadTransferFrame_PayloadHeader_PayloadType_names[] =
   "BYTES"
+  "DATAGRAM"
   "FILE"
   "STREAM"
   "UNKNOWN_PAYLOAD_TYPE";
 
 static const ::PROTOBUF_NAMESPACE_ID::internal::EnumEntry PayloadTransferFrame_PayloadHeader_PayloadType_entries[] = {
   { {PayloadTransferFrame_PayloadHeader_PayloadType_names + 0, 5}, 1 },
-  { {PayloadTransferFrame_PayloadHeader_PayloadType_names + 5, 4}, 2 },
-  { {PayloadTransferFrame_PayloadHeader_PayloadType_names + 9, 6}, 3 },
-  { {PayloadTransferFrame_PayloadHeader_PayloadType_names + 15, 20}, 0 },
+  { {PayloadTransferFrame_PayloadHeader_PayloadType_names + 5, 8}, 4 },
+  { {PayloadTransferFrame_PayloadHeader_PayloadType_names + 13, 4}, 2 },
+  { {PayloadTransferFrame_PayloadHeader_PayloadType_names + 17, 6}, 3 },
+  { {PayloadTransferFrame_PayloadHeader_PayloadType_names + 23, 20}, 0 },
 };
 
 static const int PayloadTransferFrame_PayloadHeader_PayloadType_entries_by_number[] = {
-  3, // 0 -> UNKNOWN_PAYLOAD_TYPE
+  4, // 0 -> UNKNOWN_PAYLOAD_TYPE
   0, // 1 -> BYTES
-  1, // 2 -> FILE
-  2, // 3 -> STREAM
+  2, // 2 -> FILE
+  3, // 3 -> STREAM
+  1, // 4 -> DATAGRAM
 };
 
 const std::string& PayloadTransferFrame_PayloadHeader_PayloadType_Name(
@@ -1044,12 +1153,12 @@ const std::string& PayloadTransferFrame_PayloadHeader_PayloadType_Name(
       ::PROTOBUF_NAMESPACE_ID::internal::InitializeEnumStrings(
           PayloadTransferFrame_PayloadHeader_PayloadType_entries,
           PayloadTransferFrame_PayloadHeader_PayloadType_entries_by_number,
-          4, PayloadTransferFrame_PayloadHeader_PayloadType_strings);
+          5, PayloadTransferFrame_PayloadHeader_PayloadType_strings);
   (void) dummy;
   int idx = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumName(
       PayloadTransferFrame_PayloadHeader_PayloadType_entries,
       PayloadTransferFrame_PayloadHeader_PayloadType_entries_by_number,
-      4, value);
+      5, value);
   return idx == -1 ? ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString() :
                      PayloadTransferFrame_PayloadHeader_PayloadType_strings[idx].get();
 }
@@ -1057,7 +1166,7 @@ bool PayloadTransferFrame_PayloadHeader_PayloadType_Parse(
     ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, PayloadTransferFrame_PayloadHeader_PayloadType* value) {
   int int_value;
   bool success = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumValue(
-      PayloadTransferFrame_PayloadHeader_PayloadType_entries, 4, name, &int_value);
+      PayloadTransferFrame_PayloadHeader_PayloadType_entries, 5, name, &int_value);
   if (success) {
     *value = static_cast<PayloadTransferFrame_PayloadHeader_PayloadType>(int_value);
   }
@@ -1068,6 +1177,7 @@ constexpr PayloadTransferFrame_PayloadHeader_PayloadType PayloadTransferFrame_Pa
 constexpr PayloadTransferFrame_PayloadHeader_PayloadType PayloadTransferFrame_PayloadHeader::BYTES;
 constexpr PayloadTransferFrame_PayloadHeader_PayloadType PayloadTransferFrame_PayloadHeader::FILE;
 constexpr PayloadTransferFrame_PayloadHeader_PayloadType PayloadTransferFrame_PayloadHeader::STREAM;
+constexpr PayloadTransferFrame_PayloadHeader_PayloadType PayloadTransferFrame_PayloadHeader::DATAGRAM;
 constexpr PayloadTransferFrame_PayloadHeader_PayloadType PayloadTransferFrame_PayloadHeader::PayloadType_MIN;
 constexpr PayloadTransferFrame_PayloadHeader_PayloadType PayloadTransferFrame_PayloadHeader::PayloadType_MAX;
 constexpr int PayloadTransferFrame_PayloadHeader::PayloadType_ARRAYSIZE;
@@ -2977,7 +3087,7 @@ class ConnectionRequestFrame::_Internal {
     (*has_bits)[0] |= 4u;
   }
   static void set_has_nonce(HasBits* has_bits) {
-    (*has_bits)[0] |= 64u;
+    (*has_bits)[0] |= 256u;
   }
   static void set_has_endpoint_info(HasBits* has_bits) {
     (*has_bits)[0] |= 8u;
@@ -2987,13 +3097,13 @@ class ConnectionRequestFrame::_Internal {
     (*has_bits)[0] |= 32u;
   }
   static void set_has_keep_alive_interval_millis(HasBits* has_bits) {
-    (*has_bits)[0] |= 128u;
+    (*has_bits)[0] |= 512u;
   }
   static void set_has_keep_alive_timeout_millis(HasBits* has_bits) {
-    (*has_bits)[0] |= 256u;
+    (*has_bits)[0] |= 1024u;
   }
   static void set_has_device_type(HasBits* has_bits) {
-    (*has_bits)[0] |= 512u;
+    (*has_bits)[0] |= 2048u;
   }
   static void set_has_device_info(HasBits* has_bits) {
     (*has_bits)[0] |= 16u;
@@ -3001,7 +3111,15 @@ class ConnectionRequestFrame::_Internal {
   static const ::location::nearby::connections::ConnectionsDevice& connections_device(const ConnectionRequestFrame* msg);
   static const ::location::nearby::connections::PresenceDevice& presence_device(const ConnectionRequestFrame* msg);
   static void set_has_connection_mode(HasBits* has_bits) {
-    (*has_bits)[0] |= 1024u;
+    (*has_bits)[0] |= 4096u;
+  }
+  static const ::location::nearby::connections::LocationHint& location_hint(const ConnectionRequestFrame* msg);
+  static void set_has_location_hint(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::location::nearby::connections::SharedKeyOffer& shared_key_offer(const ConnectionRequestFrame* msg);
+  static void set_has_shared_key_offer(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
   }
 };
 
@@ -3017,6 +3135,14 @@ const ::location::nearby::connections::PresenceDevice&
 ConnectionRequestFrame::_Internal::presence_device(const ConnectionRequestFrame* msg) {
   return *msg->Device_.presence_device_;
 }
+const ::location::nearby::connections::LocationHint&
+ConnectionRequestFrame::_Internal::location_hint(const ConnectionRequestFrame* msg) {
+  return *msg->location_hint_;
+}
+const ::location::nearby::connections::SharedKeyOffer&
+ConnectionRequestFrame::_Internal::shared_key_offer(const ConnectionRequestFrame* msg) {
+  return *msg->shared_key_offer_;
+}
 void ConnectionRequestFrame::set_allocated_connections_device(::location::nearby::connections::ConnectionsDevice* connections_device) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_Device();
@@ -3107,6 +3233,16 @@ ConnectionRequestFrame::ConnectionRequestFrame(const ConnectionRequestFrame& fro
   } else {
     medium_metadata_ = nullptr;
   }
+  if (from._internal_has_location_hint()) {
+    location_hint_ = new ::location::nearby::connections::LocationHint(*from.location_hint_);
+  } else {
+    location_hint_ = nullptr;
+  }
+  if (from._internal_has_shared_key_offer()) {
+    shared_key_offer_ = new ::location::nearby::connections::SharedKeyOffer(*from.shared_key_offer_);
+  } else {
+    shared_key_offer_ = nullptr;
+  }
   ::memcpy(&nonce_, &from.nonce_,
     static_cast<size_t>(reinterpret_cast<char*>(&connection_mode_) -
     reinterpret_cast<char*>(&nonce_)) + sizeof(connection_mode_));
@@ -3170,6 +3306,8 @@ inline void ConnectionRequestFrame::SharedDtor() {
   endpoint_info_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   device_info_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   if (this != internal_default_instance()) delete medium_metadata_;
+  if (this != internal_default_instance()) delete location_hint_;
+  if (this != internal_default_instance()) delete shared_key_offer_;
   if (has_Device()) {
     clear_Device();
   }
@@ -3216,7 +3354,7 @@ void ConnectionRequestFrame::Clear() {
 
   mediums_.Clear();
   cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x0000003fu) {
+  if (cached_has_bits & 0x000000ffu) {
     if (cached_has_bits & 0x00000001u) {
       endpoint_id_.ClearNonDefaultToEmpty();
     }
@@ -3236,16 +3374,19 @@ void ConnectionRequestFrame::Clear() {
       GOOGLE_DCHECK(medium_metadata_ != nullptr);
       medium_metadata_->Clear();
     }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(location_hint_ != nullptr);
+      location_hint_->Clear();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      GOOGLE_DCHECK(shared_key_offer_ != nullptr);
+      shared_key_offer_->Clear();
+    }
   }
-  if (cached_has_bits & 0x000000c0u) {
+  if (cached_has_bits & 0x00001f00u) {
     ::memset(&nonce_, 0, static_cast<size_t>(
-        reinterpret_cast<char*>(&keep_alive_interval_millis_) -
-        reinterpret_cast<char*>(&nonce_)) + sizeof(keep_alive_interval_millis_));
-  }
-  if (cached_has_bits & 0x00000700u) {
-    ::memset(&keep_alive_timeout_millis_, 0, static_cast<size_t>(
         reinterpret_cast<char*>(&connection_mode_) -
-        reinterpret_cast<char*>(&keep_alive_timeout_millis_)) + sizeof(connection_mode_));
+        reinterpret_cast<char*>(&nonce_)) + sizeof(connection_mode_));
   }
   clear_Device();
   _has_bits_.Clear();
@@ -3398,6 +3539,22 @@ const char* ConnectionRequestFrame::_InternalParse(const char* ptr, ::PROTOBUF_N
         } else
           goto handle_unusual;
         continue;
+      // optional .location.nearby.connections.LocationHint location_hint = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 122)) {
+          ptr = ctx->ParseMessage(_internal_mutable_location_hint(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .location.nearby.connections.SharedKeyOffer shared_key_offer = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 130)) {
+          ptr = ctx->ParseMessage(_internal_mutable_shared_key_offer(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -3448,7 +3605,7 @@ uint8_t* ConnectionRequestFrame::_InternalSerialize(
   }
 
   // optional int32 nonce = 4;
-  if (cached_has_bits & 0x00000040u) {
+  if (cached_has_bits & 0x00000100u) {
     target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(4, this->_internal_nonce(), target);
   }
@@ -3475,19 +3632,19 @@ uint8_t* ConnectionRequestFrame::_InternalSerialize(
   }
 
   // optional int32 keep_alive_interval_millis = 8;
-  if (cached_has_bits & 0x00000080u) {
+  if (cached_has_bits & 0x00000200u) {
     target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(8, this->_internal_keep_alive_interval_millis(), target);
   }
 
   // optional int32 keep_alive_timeout_millis = 9;
-  if (cached_has_bits & 0x00000100u) {
+  if (cached_has_bits & 0x00000400u) {
     target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(9, this->_internal_keep_alive_timeout_millis(), target);
   }
 
   // optional int32 device_type = 10 [default = 0, deprecated = true];
-  if (cached_has_bits & 0x00000200u) {
+  if (cached_has_bits & 0x00000800u) {
     target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(10, this->_internal_device_type(), target);
   }
@@ -3516,12 +3673,28 @@ uint8_t* ConnectionRequestFrame::_InternalSerialize(
     default: ;
   }
   // optional .location.nearby.connections.ConnectionRequestFrame.ConnectionMode connection_mode = 14;
-  if (cached_has_bits & 0x00000400u) {
+  if (cached_has_bits & 0x00001000u) {
     target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
       14, this->_internal_connection_mode(), target);
   }
 
+  // optional .location.nearby.connections.LocationHint location_hint = 15;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        15, _Internal::location_hint(this), target, stream);
+  }
+
+  // optional .location.nearby.connections.SharedKeyOffer shared_key_offer = 16;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        16, _Internal::shared_key_offer(this), target, stream);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
         static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
@@ -3592,30 +3765,44 @@ size_t ConnectionRequestFrame::ByteSizeLong() const {
           *medium_metadata_);
     }
 
-    // optional int32 nonce = 4;
+    // optional .location.nearby.connections.LocationHint location_hint = 15;
     if (cached_has_bits & 0x00000040u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *location_hint_);
+    }
+
+    // optional .location.nearby.connections.SharedKeyOffer shared_key_offer = 16;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *shared_key_offer_);
+    }
+
+  }
+  if (cached_has_bits & 0x00001f00u) {
+    // optional int32 nonce = 4;
+    if (cached_has_bits & 0x00000100u) {
       total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32SizePlusOne(this->_internal_nonce());
     }
 
     // optional int32 keep_alive_interval_millis = 8;
-    if (cached_has_bits & 0x00000080u) {
+    if (cached_has_bits & 0x00000200u) {
       total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32SizePlusOne(this->_internal_keep_alive_interval_millis());
     }
 
-  }
-  if (cached_has_bits & 0x00000700u) {
     // optional int32 keep_alive_timeout_millis = 9;
-    if (cached_has_bits & 0x00000100u) {
+    if (cached_has_bits & 0x00000400u) {
       total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32SizePlusOne(this->_internal_keep_alive_timeout_millis());
     }
 
     // optional int32 device_type = 10 [default = 0, deprecated = true];
-    if (cached_has_bits & 0x00000200u) {
+    if (cached_has_bits & 0x00000800u) {
       total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32SizePlusOne(this->_internal_device_type());
     }
 
     // optional .location.nearby.connections.ConnectionRequestFrame.ConnectionMode connection_mode = 14;
-    if (cached_has_bits & 0x00000400u) {
+    if (cached_has_bits & 0x00001000u) {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_connection_mode());
     }
@@ -3682,21 +3869,26 @@ void ConnectionRequestFrame::MergeFrom(const ConnectionRequestFrame& from) {
       _internal_mutable_medium_metadata()->::location::nearby::connections::MediumMetadata::MergeFrom(from._internal_medium_metadata());
     }
     if (cached_has_bits & 0x00000040u) {
-      nonce_ = from.nonce_;
+      _internal_mutable_location_hint()->::location::nearby::connections::LocationHint::MergeFrom(from._internal_location_hint());
     }
     if (cached_has_bits & 0x00000080u) {
-      keep_alive_interval_millis_ = from.keep_alive_interval_millis_;
+      _internal_mutable_shared_key_offer()->::location::nearby::connections::SharedKeyOffer::MergeFrom(from._internal_shared_key_offer());
     }
-    _has_bits_[0] |= cached_has_bits;
   }
-  if (cached_has_bits & 0x00000700u) {
+  if (cached_has_bits & 0x00001f00u) {
     if (cached_has_bits & 0x00000100u) {
-      keep_alive_timeout_millis_ = from.keep_alive_timeout_millis_;
+      nonce_ = from.nonce_;
     }
     if (cached_has_bits & 0x00000200u) {
-      device_type_ = from.device_type_;
+      keep_alive_interval_millis_ = from.keep_alive_interval_millis_;
     }
     if (cached_has_bits & 0x00000400u) {
+      keep_alive_timeout_millis_ = from.keep_alive_timeout_millis_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      device_type_ = from.device_type_;
+    }
+    if (cached_has_bits & 0x00001000u) {
       connection_mode_ = from.connection_mode_;
     }
     _has_bits_[0] |= cached_has_bits;
@@ -3710,68 +3902,635 @@ void ConnectionRequestFrame::MergeFrom(const ConnectionRequestFrame& from) {
       _internal_mutable_presence_device()->::location::nearby::connections::PresenceDevice::MergeFrom(from._internal_presence_device());
       break;
     }
-    case DEVICE_NOT_SET: {
-      break;
+    case DEVICE_NOT_SET: {
+      break;
+    }
+  }
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void ConnectionRequestFrame::CopyFrom(const ConnectionRequestFrame& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:location.nearby.connections.ConnectionRequestFrame)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ConnectionRequestFrame::IsInitialized() const {
+  return true;
+}
+
+void ConnectionRequestFrame::InternalSwap(ConnectionRequestFrame* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  mediums_.InternalSwap(&other->mediums_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      &endpoint_id_, lhs_arena,
+      &other->endpoint_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      &endpoint_name_, lhs_arena,
+      &other->endpoint_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      &handshake_data_, lhs_arena,
+      &other->handshake_data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      &endpoint_info_, lhs_arena,
+      &other->endpoint_info_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      &device_info_, lhs_arena,
+      &other->device_info_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ConnectionRequestFrame, connection_mode_)
+      + sizeof(ConnectionRequestFrame::connection_mode_)
+      - PROTOBUF_FIELD_OFFSET(ConnectionRequestFrame, medium_metadata_)>(
+          reinterpret_cast<char*>(&medium_metadata_),
+          reinterpret_cast<char*>(&other->medium_metadata_));
+  swap(Device_, other->Device_);
+  swap(_oneof_case_[0], other->_oneof_case_[0]);
+}
+
+std::string ConnectionRequestFrame::GetTypeName() const {
+  return "location.nearby.connections.ConnectionRequestFrame";
+}
+
+
+// ===================================================================
+
+class SharedKeyOffer::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SharedKeyOffer>()._has_bits_);
+  static void set_has_session_tag(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_nonce(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+SharedKeyOffer::SharedKeyOffer(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor();
+  if (!is_message_owned) {
+    RegisterArenaDtor(arena);
+  }
+  // @@protoc_insertion_point(arena_constructor:location.nearby.connections.SharedKeyOffer)
+}
+SharedKeyOffer::SharedKeyOffer(const SharedKeyOffer& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  session_tag_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    session_tag_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_session_tag()) {
+    session_tag_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_session_tag(), 
+      GetArenaForAllocation());
+  }
+  nonce_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    nonce_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_nonce()) {
+    nonce_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_nonce(), 
+      GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:location.nearby.connections.SharedKeyOffer)
+}
+
+inline void SharedKeyOffer::SharedCtor() {
+session_tag_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  session_tag_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+nonce_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  nonce_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SharedKeyOffer::~SharedKeyOffer() {
+  // @@protoc_insertion_point(destructor:location.nearby.connections.SharedKeyOffer)
+  if (GetArenaForAllocation() != nullptr) return;
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+inline void SharedKeyOffer::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  session_tag_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  nonce_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void SharedKeyOffer::ArenaDtor(void* object) {
+  SharedKeyOffer* _this = reinterpret_cast< SharedKeyOffer* >(object);
+  (void)_this;
+}
+void SharedKeyOffer::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void SharedKeyOffer::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void SharedKeyOffer::Clear() {
+// @@protoc_insertion_point(message_clear_start:location.nearby.connections.SharedKeyOffer)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      session_tag_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      nonce_.ClearNonDefaultToEmpty();
+    }
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* SharedKeyOffer::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bytes session_tag = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_session_tag();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes nonce = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_nonce();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SharedKeyOffer::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:location.nearby.connections.SharedKeyOffer)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional bytes session_tag = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_session_tag(), target);
+  }
+
+  // optional bytes nonce = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_nonce(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:location.nearby.connections.SharedKeyOffer)
+  return target;
+}
+
+size_t SharedKeyOffer::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:location.nearby.connections.SharedKeyOffer)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional bytes session_tag = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_session_tag());
+    }
+
+    // optional bytes nonce = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_nonce());
+    }
+
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void SharedKeyOffer::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const SharedKeyOffer*>(
+      &from));
+}
+
+void SharedKeyOffer::MergeFrom(const SharedKeyOffer& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:location.nearby.connections.SharedKeyOffer)
+  GOOGLE_DCHECK_NE(&from, this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _internal_set_session_tag(from._internal_session_tag());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _internal_set_nonce(from._internal_nonce());
+    }
+  }
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void SharedKeyOffer::CopyFrom(const SharedKeyOffer& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:location.nearby.connections.SharedKeyOffer)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SharedKeyOffer::IsInitialized() const {
+  return true;
+}
+
+void SharedKeyOffer::InternalSwap(SharedKeyOffer* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      &session_tag_, lhs_arena,
+      &other->session_tag_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      &nonce_, lhs_arena,
+      &other->nonce_, rhs_arena
+  );
+}
+
+std::string SharedKeyOffer::GetTypeName() const {
+  return "location.nearby.connections.SharedKeyOffer";
+}
+
+
+// ===================================================================
+
+class SharedKeyFrame::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SharedKeyFrame>()._has_bits_);
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_nonce(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_confirmation(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+SharedKeyFrame::SharedKeyFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor();
+  if (!is_message_owned) {
+    RegisterArenaDtor(arena);
+  }
+  // @@protoc_insertion_point(arena_constructor:location.nearby.connections.SharedKeyFrame)
+}
+SharedKeyFrame::SharedKeyFrame(const SharedKeyFrame& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  nonce_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    nonce_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_nonce()) {
+    nonce_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_nonce(), 
+      GetArenaForAllocation());
+  }
+  confirmation_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    confirmation_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_confirmation()) {
+    confirmation_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_confirmation(), 
+      GetArenaForAllocation());
+  }
+  type_ = from.type_;
+  // @@protoc_insertion_point(copy_constructor:location.nearby.connections.SharedKeyFrame)
+}
+
+inline void SharedKeyFrame::SharedCtor() {
+nonce_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  nonce_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+confirmation_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  confirmation_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+type_ = 0;
+}
+
+SharedKeyFrame::~SharedKeyFrame() {
+  // @@protoc_insertion_point(destructor:location.nearby.connections.SharedKeyFrame)
+  if (GetArenaForAllocation() != nullptr) return;
+  SharedDtor();
+  _internal_metadata_.Delete<std::string>();
+}
+
+inline void SharedKeyFrame::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  nonce_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  confirmation_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void SharedKeyFrame::ArenaDtor(void* object) {
+  SharedKeyFrame* _this = reinterpret_cast< SharedKeyFrame* >(object);
+  (void)_this;
+}
+void SharedKeyFrame::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void SharedKeyFrame::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void SharedKeyFrame::Clear() {
+// @@protoc_insertion_point(message_clear_start:location.nearby.connections.SharedKeyFrame)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      nonce_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      confirmation_.ClearNonDefaultToEmpty();
+    }
+  }
+  type_ = 0;
+  _has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* SharedKeyFrame::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .location.nearby.connections.SharedKeyFrame.FrameType type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::location::nearby::connections::SharedKeyFrame_FrameType_IsValid(val))) {
+            _internal_set_type(static_cast<::location::nearby::connections::SharedKeyFrame_FrameType>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes nonce = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_nonce();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes confirmation = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_confirmation();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SharedKeyFrame::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:location.nearby.connections.SharedKeyFrame)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional .location.nearby.connections.SharedKeyFrame.FrameType type = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
+  }
+
+  // optional bytes nonce = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_nonce(), target);
+  }
+
+  // optional bytes confirmation = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_confirmation(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:location.nearby.connections.SharedKeyFrame)
+  return target;
+}
+
+size_t SharedKeyFrame::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:location.nearby.connections.SharedKeyFrame)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional bytes nonce = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_nonce());
+    }
+
+    // optional bytes confirmation = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_confirmation());
+    }
+
+    // optional .location.nearby.connections.SharedKeyFrame.FrameType type = 1;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_type());
+    }
+
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void SharedKeyFrame::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const SharedKeyFrame*>(
+      &from));
+}
+
+void SharedKeyFrame::MergeFrom(const SharedKeyFrame& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:location.nearby.connections.SharedKeyFrame)
+  GOOGLE_DCHECK_NE(&from, this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _internal_set_nonce(from._internal_nonce());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _internal_set_confirmation(from._internal_confirmation());
     }
+    if (cached_has_bits & 0x00000004u) {
+      type_ = from.type_;
+    }
+    _has_bits_[0] |= cached_has_bits;
   }
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
-void ConnectionRequestFrame::CopyFrom(const ConnectionRequestFrame& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:location.nearby.connections.ConnectionRequestFrame)
+void SharedKeyFrame::CopyFrom(const SharedKeyFrame& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:location.nearby.connections.SharedKeyFrame)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ConnectionRequestFrame::IsInitialized() const {
+bool SharedKeyFrame::IsInitialized() const {
   return true;
 }
 
-void ConnectionRequestFrame::InternalSwap(ConnectionRequestFrame* other) {
+void SharedKeyFrame::InternalSwap(SharedKeyFrame* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_has_bits_[0], other->_has_bits_[0]);
-  mediums_.InternalSwap(&other->mediums_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      &endpoint_id_, lhs_arena,
-      &other->endpoint_id_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      &endpoint_name_, lhs_arena,
-      &other->endpoint_name_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      &handshake_data_, lhs_arena,
-      &other->handshake_data_, rhs_arena
-  );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
       &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      &endpoint_info_, lhs_arena,
-      &other->endpoint_info_, rhs_arena
+      &nonce_, lhs_arena,
+      &other->nonce_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
       &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      &device_info_, lhs_arena,
-      &other->device_info_, rhs_arena
+      &confirmation_, lhs_arena,
+      &other->confirmation_, rhs_arena
   );
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ConnectionRequestFrame, connection_mode_)
-      + sizeof(ConnectionRequestFrame::connection_mode_)
-      - PROTOBUF_FIELD_OFFSET(ConnectionRequestFrame, medium_metadata_)>(
-          reinterpret_cast<char*>(&medium_metadata_),
-          reinterpret_cast<char*>(&other->medium_metadata_));
-  swap(Device_, other->Device_);
-  swap(_oneof_case_[0], other->_oneof_case_[0]);
+  swap(type_, other->type_);
 }
 
-std::string ConnectionRequestFrame::GetTypeName() const {
-  return "location.nearby.connections.ConnectionRequestFrame";
+std::string SharedKeyFrame::GetTypeName() const {
+  return "location.nearby.connections.SharedKeyFrame";
 }
 
 
@@ -3781,26 +4540,42 @@ class ConnectionResponseFrame::_Internal {
  public:
   using HasBits = decltype(std::declval<ConnectionResponseFrame>()._has_bits_);
   static void set_has_status(HasBits* has_bits) {
-    (*has_bits)[0] |= 4u;
+    (*has_bits)[0] |= 8u;
   }
   static void set_has_handshake_data(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
   static void set_has_response(HasBits* has_bits) {
-    (*has_bits)[0] |= 8u;
+    (*has_bits)[0] |= 16u;
   }
   static const ::location::nearby::connections::OsInfo& os_info(const ConnectionResponseFrame* msg);
   static void set_has_os_info(HasBits* has_bits) {
     (*has_bits)[0] |= 2u;
   }
   static void set_has_multiplex_socket_bitmask(HasBits* has_bits) {
-    (*has_bits)[0] |= 16u;
+    (*has_bits)[0] |= 32u;
   }
   static void set_has_nearby_connections_version(HasBits* has_bits) {
-    (*has_bits)[0] |= 32u;
+    (*has_bits)[0] |= 64u;
   }
   static void set_has_safe_to_disconnect_version(HasBits* has_bits) {
-    (*has_bits)[0] |= 64u;
+    (*has_bits)[0] |= 128u;
+  }
+  static const ::location::nearby::connections::LocationHint& location_hint(const ConnectionResponseFrame* msg);
+  static void set_has_location_hint(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_keep_alive_timeout_millis(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_supports_shared_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_supports_payload_header_elision(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_supports_datagram(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
   }
 };
 
@@ -3808,6 +4583,10 @@ const ::location::nearby::connections::OsInfo&
 ConnectionResponseFrame::_Internal::os_info(const ConnectionResponseFrame* msg) {
   return *msg->os_info_;
 }
+const ::location::nearby::connections::LocationHint&
+ConnectionResponseFrame::_Internal::location_hint(const ConnectionResponseFrame* msg) {
+  return *msg->location_hint_;
+}
 ConnectionResponseFrame::ConnectionResponseFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
@@ -3834,9 +4613,14 @@ ConnectionResponseFrame::ConnectionResponseFrame(const ConnectionResponseFrame&
   } else {
     os_info_ = nullptr;
   }
+  if (from._internal_has_location_hint()) {
+    location_hint_ = new ::location::nearby::connections::LocationHint(*from.location_hint_);
+  } else {
+    location_hint_ = nullptr;
+  }
   ::memcpy(&status_, &from.status_,
-    static_cast<size_t>(reinterpret_cast<char*>(&safe_to_disconnect_version_) -
-    reinterpret_cast<char*>(&status_)) + sizeof(safe_to_disconnect_version_));
+    static_cast<size_t>(reinterpret_cast<char*>(&supports_datagram_) -
+    reinterpret_cast<char*>(&status_)) + sizeof(supports_datagram_));
   // @@protoc_insertion_point(copy_constructor:location.nearby.connections.ConnectionResponseFrame)
 }
 
@@ -3847,8 +4631,8 @@ handshake_data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStr
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
     reinterpret_cast<char*>(&os_info_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&safe_to_disconnect_version_) -
-    reinterpret_cast<char*>(&os_info_)) + sizeof(safe_to_disconnect_version_));
+    0, static_cast<size_t>(reinterpret_cast<char*>(&supports_datagram_) -
+    reinterpret_cast<char*>(&os_info_)) + sizeof(supports_datagram_));
 }
 
 ConnectionResponseFrame::~ConnectionResponseFrame() {
@@ -3862,6 +4646,7 @@ inline void ConnectionResponseFrame::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   handshake_data_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   if (this != internal_default_instance()) delete os_info_;
+  if (this != internal_default_instance()) delete location_hint_;
 }
 
 void ConnectionResponseFrame::ArenaDtor(void* object) {
@@ -3881,7 +4666,7 @@ void ConnectionResponseFrame::Clear() {
   (void) cached_has_bits;
 
   cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
+  if (cached_has_bits & 0x00000007u) {
     if (cached_has_bits & 0x00000001u) {
       handshake_data_.ClearNonDefaultToEmpty();
     }
@@ -3889,12 +4674,21 @@ void ConnectionResponseFrame::Clear() {
       GOOGLE_DCHECK(os_info_ != nullptr);
       os_info_->Clear();
     }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(location_hint_ != nullptr);
+      location_hint_->Clear();
+    }
   }
-  if (cached_has_bits & 0x0000007cu) {
+  if (cached_has_bits & 0x000000f8u) {
     ::memset(&status_, 0, static_cast<size_t>(
         reinterpret_cast<char*>(&safe_to_disconnect_version_) -
         reinterpret_cast<char*>(&status_)) + sizeof(safe_to_disconnect_version_));
   }
+  if (cached_has_bits & 0x00000f00u) {
+    ::memset(&keep_alive_timeout_millis_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&supports_datagram_) -
+        reinterpret_cast<char*>(&keep_alive_timeout_millis_)) + sizeof(supports_datagram_));
+  }
   _has_bits_.Clear();
   _internal_metadata_.Clear<std::string>();
 }
@@ -3972,6 +4766,50 @@ const char* ConnectionResponseFrame::_InternalParse(const char* ptr, ::PROTOBUF_
         } else
           goto handle_unusual;
         continue;
+      // optional .location.nearby.connections.LocationHint location_hint = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_location_hint(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 keep_alive_timeout_millis = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_keep_alive_timeout_millis(&has_bits);
+          keep_alive_timeout_millis_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool supports_shared_key = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_supports_shared_key(&has_bits);
+          supports_shared_key_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool supports_payload_header_elision = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_supports_payload_header_elision(&has_bits);
+          supports_payload_header_elision_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool supports_datagram = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _Internal::set_has_supports_datagram(&has_bits);
+          supports_datagram_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -4004,7 +4842,7 @@ uint8_t* ConnectionResponseFrame::_InternalSerialize(
 
   cached_has_bits = _has_bits_[0];
   // optional int32 status = 1 [deprecated = true];
-  if (cached_has_bits & 0x00000004u) {
+  if (cached_has_bits & 0x00000008u) {
     target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_status(), target);
   }
@@ -4016,7 +4854,7 @@ uint8_t* ConnectionResponseFrame::_InternalSerialize(
   }
 
   // optional .location.nearby.connections.ConnectionResponseFrame.ResponseStatus response = 3;
-  if (cached_has_bits & 0x00000008u) {
+  if (cached_has_bits & 0x00000010u) {
     target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
       3, this->_internal_response(), target);
@@ -4031,23 +4869,55 @@ uint8_t* ConnectionResponseFrame::_InternalSerialize(
   }
 
   // optional int32 multiplex_socket_bitmask = 5;
-  if (cached_has_bits & 0x00000010u) {
+  if (cached_has_bits & 0x00000020u) {
     target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(5, this->_internal_multiplex_socket_bitmask(), target);
   }
 
   // optional int32 nearby_connections_version = 6 [deprecated = true];
-  if (cached_has_bits & 0x00000020u) {
+  if (cached_has_bits & 0x00000040u) {
     target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(6, this->_internal_nearby_connections_version(), target);
   }
 
   // optional int32 safe_to_disconnect_version = 7;
-  if (cached_has_bits & 0x00000040u) {
+  if (cached_has_bits & 0x00000080u) {
     target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(7, this->_internal_safe_to_disconnect_version(), target);
   }
 
+  // optional .location.nearby.connections.LocationHint location_hint = 8;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        8, _Internal::location_hint(this), target, stream);
+  }
+
+  // optional int32 keep_alive_timeout_millis = 9;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(9, this->_internal_keep_alive_timeout_millis(), target);
+  }
+
+  // optional bool supports_shared_key = 10;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(10, this->_internal_supports_shared_key(), target);
+  }
+
+  // optional bool supports_payload_header_elision = 11;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(11, this->_internal_supports_payload_header_elision(), target);
+  }
+
+  // optional bool supports_datagram = 12;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(12, this->_internal_supports_datagram(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
         static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
@@ -4065,7 +4935,7 @@ size_t ConnectionResponseFrame::ByteSizeLong() const {
   (void) cached_has_bits;
 
   cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x0000007fu) {
+  if (cached_has_bits & 0x000000ffu) {
     // optional bytes handshake_data = 2;
     if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
@@ -4080,32 +4950,61 @@ size_t ConnectionResponseFrame::ByteSizeLong() const {
           *os_info_);
     }
 
-    // optional int32 status = 1 [deprecated = true];
+    // optional .location.nearby.connections.LocationHint location_hint = 8;
     if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *location_hint_);
+    }
+
+    // optional int32 status = 1 [deprecated = true];
+    if (cached_has_bits & 0x00000008u) {
       total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32SizePlusOne(this->_internal_status());
     }
 
     // optional .location.nearby.connections.ConnectionResponseFrame.ResponseStatus response = 3;
-    if (cached_has_bits & 0x00000008u) {
+    if (cached_has_bits & 0x00000010u) {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_response());
     }
 
     // optional int32 multiplex_socket_bitmask = 5;
-    if (cached_has_bits & 0x00000010u) {
+    if (cached_has_bits & 0x00000020u) {
       total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32SizePlusOne(this->_internal_multiplex_socket_bitmask());
     }
 
     // optional int32 nearby_connections_version = 6 [deprecated = true];
-    if (cached_has_bits & 0x00000020u) {
+    if (cached_has_bits & 0x00000040u) {
       total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32SizePlusOne(this->_internal_nearby_connections_version());
     }
 
     // optional int32 safe_to_disconnect_version = 7;
-    if (cached_has_bits & 0x00000040u) {
+    if (cached_has_bits & 0x00000080u) {
       total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32SizePlusOne(this->_internal_safe_to_disconnect_version());
     }
 
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    // optional int32 keep_alive_timeout_millis = 9;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32SizePlusOne(this->_internal_keep_alive_timeout_millis());
+    }
+
+    // optional bool supports_shared_key = 10;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool supports_payload_header_elision = 11;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool supports_datagram = 12;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 1 + 1;
+    }
+
   }
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
@@ -4128,7 +5027,7 @@ void ConnectionResponseFrame::MergeFrom(const ConnectionResponseFrame& from) {
   (void) cached_has_bits;
 
   cached_has_bits = from._has_bits_[0];
-  if (cached_has_bits & 0x0000007fu) {
+  if (cached_has_bits & 0x000000ffu) {
     if (cached_has_bits & 0x00000001u) {
       _internal_set_handshake_data(from._internal_handshake_data());
     }
@@ -4136,22 +5035,40 @@ void ConnectionResponseFrame::MergeFrom(const ConnectionResponseFrame& from) {
       _internal_mutable_os_info()->::location::nearby::connections::OsInfo::MergeFrom(from._internal_os_info());
     }
     if (cached_has_bits & 0x00000004u) {
-      status_ = from.status_;
+      _internal_mutable_location_hint()->::location::nearby::connections::LocationHint::MergeFrom(from._internal_location_hint());
     }
     if (cached_has_bits & 0x00000008u) {
-      response_ = from.response_;
+      status_ = from.status_;
     }
     if (cached_has_bits & 0x00000010u) {
-      multiplex_socket_bitmask_ = from.multiplex_socket_bitmask_;
+      response_ = from.response_;
     }
     if (cached_has_bits & 0x00000020u) {
-      nearby_connections_version_ = from.nearby_connections_version_;
+      multiplex_socket_bitmask_ = from.multiplex_socket_bitmask_;
     }
     if (cached_has_bits & 0x00000040u) {
+      nearby_connections_version_ = from.nearby_connections_version_;
+    }
+    if (cached_has_bits & 0x00000080u) {
       safe_to_disconnect_version_ = from.safe_to_disconnect_version_;
     }
     _has_bits_[0] |= cached_has_bits;
   }
+  if (cached_has_bits & 0x00000f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      keep_alive_timeout_millis_ = from.keep_alive_timeout_millis_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      supports_shared_key_ = from.supports_shared_key_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      supports_payload_header_elision_ = from.supports_payload_header_elision_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      supports_datagram_ = from.supports_datagram_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
@@ -4178,8 +5095,8 @@ void ConnectionResponseFrame::InternalSwap(ConnectionResponseFrame* other) {
       &other->handshake_data_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ConnectionResponseFrame, safe_to_disconnect_version_)
-      + sizeof(ConnectionResponseFrame::safe_to_disconnect_version_)
+      PROTOBUF_FIELD_OFFSET(ConnectionResponseFrame, supports_datagram_)
+      + sizeof(ConnectionResponseFrame::supports_datagram_)
       - PROTOBUF_FIELD_OFFSET(ConnectionResponseFrame, os_info_)>(
           reinterpret_cast<char*>(&os_info_),
           reinterpret_cast<char*>(&other->os_info_));
@@ -4213,6 +5130,9 @@ class PayloadTransferFrame_PayloadHeader::_Internal {
   static void set_has_parent_folder(HasBits* has_bits) {
     (*has_bits)[0] |= 2u;
   }
+  static void set_has_sequence_number(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
 };
 
 PayloadTransferFrame_PayloadHeader::PayloadTransferFrame_PayloadHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
@@ -4245,8 +5165,8 @@ PayloadTransferFrame_PayloadHeader::PayloadTransferFrame_PayloadHeader(const Pay
       GetArenaForAllocation());
   }
   ::memcpy(&id_, &from.id_,
-    static_cast<size_t>(reinterpret_cast<char*>(&is_sensitive_) -
-    reinterpret_cast<char*>(&id_)) + sizeof(is_sensitive_));
+    static_cast<size_t>(reinterpret_cast<char*>(&sequence_number_) -
+    reinterpret_cast<char*>(&id_)) + sizeof(sequence_number_));
   // @@protoc_insertion_point(copy_constructor:location.nearby.connections.PayloadTransferFrame.PayloadHeader)
 }
 
@@ -4261,8 +5181,8 @@ parent_folder_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStri
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
     reinterpret_cast<char*>(&id_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&is_sensitive_) -
-    reinterpret_cast<char*>(&id_)) + sizeof(is_sensitive_));
+    0, static_cast<size_t>(reinterpret_cast<char*>(&sequence_number_) -
+    reinterpret_cast<char*>(&id_)) + sizeof(sequence_number_));
 }
 
 PayloadTransferFrame_PayloadHeader::~PayloadTransferFrame_PayloadHeader() {
@@ -4303,10 +5223,10 @@ void PayloadTransferFrame_PayloadHeader::Clear() {
       parent_folder_.ClearNonDefaultToEmpty();
     }
   }
-  if (cached_has_bits & 0x0000003cu) {
+  if (cached_has_bits & 0x0000007cu) {
     ::memset(&id_, 0, static_cast<size_t>(
-        reinterpret_cast<char*>(&is_sensitive_) -
-        reinterpret_cast<char*>(&id_)) + sizeof(is_sensitive_));
+        reinterpret_cast<char*>(&sequence_number_) -
+        reinterpret_cast<char*>(&id_)) + sizeof(sequence_number_));
   }
   _has_bits_.Clear();
   _internal_metadata_.Clear<std::string>();
@@ -4377,6 +5297,15 @@ const char* PayloadTransferFrame_PayloadHeader::_InternalParse(const char* ptr,
         } else
           goto handle_unusual;
         continue;
+      // optional int64 sequence_number = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_sequence_number(&has_bits);
+          sequence_number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -4445,6 +5374,12 @@ uint8_t* PayloadTransferFrame_PayloadHeader::_InternalSerialize(
         6, this->_internal_parent_folder(), target);
   }
 
+  // optional int64 sequence_number = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(7, this->_internal_sequence_number(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
         static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
@@ -4462,7 +5397,7 @@ size_t PayloadTransferFrame_PayloadHeader::ByteSizeLong() const {
   (void) cached_has_bits;
 
   cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x0000003fu) {
+  if (cached_has_bits & 0x0000007fu) {
     // optional string file_name = 5;
     if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
@@ -4498,6 +5433,11 @@ size_t PayloadTransferFrame_PayloadHeader::ByteSizeLong() const {
       total_size += 1 + 1;
     }
 
+    // optional int64 sequence_number = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64SizePlusOne(this->_internal_sequence_number());
+    }
+
   }
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
@@ -4520,7 +5460,7 @@ void PayloadTransferFrame_PayloadHeader::MergeFrom(const PayloadTransferFrame_Pa
   (void) cached_has_bits;
 
   cached_has_bits = from._has_bits_[0];
-  if (cached_has_bits & 0x0000003fu) {
+  if (cached_has_bits & 0x0000007fu) {
     if (cached_has_bits & 0x00000001u) {
       _internal_set_file_name(from._internal_file_name());
     }
@@ -4539,6 +5479,9 @@ void PayloadTransferFrame_PayloadHeader::MergeFrom(const PayloadTransferFrame_Pa
     if (cached_has_bits & 0x00000020u) {
       is_sensitive_ = from.is_sensitive_;
     }
+    if (cached_has_bits & 0x00000040u) {
+      sequence_number_ = from.sequence_number_;
+    }
     _has_bits_[0] |= cached_has_bits;
   }
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
@@ -4572,8 +5515,8 @@ void PayloadTransferFrame_PayloadHeader::InternalSwap(PayloadTransferFrame_Paylo
       &other->parent_folder_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(PayloadTransferFrame_PayloadHeader, is_sensitive_)
-      + sizeof(PayloadTransferFrame_PayloadHeader::is_sensitive_)
+      PROTOBUF_FIELD_OFFSET(PayloadTransferFrame_PayloadHeader, sequence_number_)
+      + sizeof(PayloadTransferFrame_PayloadHeader::sequence_number_)
       - PROTOBUF_FIELD_OFFSET(PayloadTransferFrame_PayloadHeader, id_)>(
           reinterpret_cast<char*>(&id_),
           reinterpret_cast<char*>(&other->id_));
@@ -8518,7 +9461,8 @@ BandwidthUpgradeNegotiationFrame::_Internal::safe_to_close_prior_channel(const B
 }
 BandwidthUpgradeNegotiationFrame::BandwidthUpgradeNegotiationFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned),
+  alternative_upgrade_path_infos_(arena) {
   SharedCtor();
   if (!is_message_owned) {
     RegisterArenaDtor(arena);
@@ -8527,7 +9471,8 @@ BandwidthUpgradeNegotiationFrame::BandwidthUpgradeNegotiationFrame(::PROTOBUF_NA
 }
 BandwidthUpgradeNegotiationFrame::BandwidthUpgradeNegotiationFrame(const BandwidthUpgradeNegotiationFrame& from)
   : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
-      _has_bits_(from._has_bits_) {
+      _has_bits_(from._has_bits_),
+      alternative_upgrade_path_infos_(from.alternative_upgrade_path_infos_) {
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
   if (from._internal_has_upgrade_path_info()) {
     upgrade_path_info_ = new ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo(*from.upgrade_path_info_);
@@ -8591,6 +9536,7 @@ void BandwidthUpgradeNegotiationFrame::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  alternative_upgrade_path_infos_.Clear();
   cached_has_bits = _has_bits_[0];
   if (cached_has_bits & 0x0000000fu) {
     if (cached_has_bits & 0x00000001u) {
@@ -8667,6 +9613,19 @@ const char* BandwidthUpgradeNegotiationFrame::_InternalParse(const char* ptr, ::
         } else
           goto handle_unusual;
         continue;
+      // repeated .location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo alternative_upgrade_path_infos = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_alternative_upgrade_path_infos(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -8737,6 +9696,14 @@ uint8_t* BandwidthUpgradeNegotiationFrame::_InternalSerialize(
         5, _Internal::safe_to_close_prior_channel(this), target, stream);
   }
 
+  // repeated .location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo alternative_upgrade_path_infos = 6;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_alternative_upgrade_path_infos_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, this->_internal_alternative_upgrade_path_infos(i), target, stream);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
         static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
@@ -8753,6 +9720,13 @@ size_t BandwidthUpgradeNegotiationFrame::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // repeated .location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo alternative_upgrade_path_infos = 6;
+  total_size += 1UL * this->_internal_alternative_upgrade_path_infos_size();
+  for (const auto& msg : this->alternative_upgrade_path_infos_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
   cached_has_bits = _has_bits_[0];
   if (cached_has_bits & 0x0000001fu) {
     // optional .location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo upgrade_path_info = 2;
@@ -8810,6 +9784,7 @@ void BandwidthUpgradeNegotiationFrame::MergeFrom(const BandwidthUpgradeNegotiati
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  alternative_upgrade_path_infos_.MergeFrom(from.alternative_upgrade_path_infos_);
   cached_has_bits = from._has_bits_[0];
   if (cached_has_bits & 0x0000001fu) {
     if (cached_has_bits & 0x00000001u) {
@@ -8847,6 +9822,7 @@ void BandwidthUpgradeNegotiationFrame::InternalSwap(BandwidthUpgradeNegotiationF
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_has_bits_[0], other->_has_bits_[0]);
+  alternative_upgrade_path_infos_.InternalSwap(&other->alternative_upgrade_path_infos_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
       PROTOBUF_FIELD_OFFSET(BandwidthUpgradeNegotiationFrame, event_type_)
       + sizeof(BandwidthUpgradeNegotiationFrame::event_type_)
@@ -13790,6 +14766,12 @@ template<> PROTOBUF_NOINLINE ::location::nearby::connections::V1Frame* Arena::Cr
 template<> PROTOBUF_NOINLINE ::location::nearby::connections::ConnectionRequestFrame* Arena::CreateMaybeMessage< ::location::nearby::connections::ConnectionRequestFrame >(Arena* arena) {
   return Arena::CreateMessageInternal< ::location::nearby::connections::ConnectionRequestFrame >(arena);
 }
+template<> PROTOBUF_NOINLINE ::location::nearby::connections::SharedKeyOffer* Arena::CreateMaybeMessage< ::location::nearby::connections::SharedKeyOffer >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::location::nearby::connections::SharedKeyOffer >(arena);
+}
+template<> PROTOBUF_NOINLINE ::location::nearby::connections::SharedKeyFrame* Arena::CreateMaybeMessage< ::location::nearby::connections::SharedKeyFrame >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::location::nearby::connections::SharedKeyFrame >(arena);
+}
 template<> PROTOBUF_NOINLINE ::location::nearby::connections::ConnectionResponseFrame* Arena::CreateMaybeMessage< ::location::nearby::connections::ConnectionResponseFrame >(Arena* arena) {
   return Arena::CreateMessageInternal< ::location::nearby::connections::ConnectionResponseFrame >(arena);
 }
@@ -153,6 +153,12 @@ extern PayloadTransferFrame_PayloadHeaderDefaultTypeInternal _PayloadTransferFra
 class PresenceDevice;
 struct PresenceDeviceDefaultTypeInternal;
 extern PresenceDeviceDefaultTypeInternal _PresenceDevice_default_instance_;
+class SharedKeyFrame;
+struct SharedKeyFrameDefaultTypeInternal;
+extern SharedKeyFrameDefaultTypeInternal _SharedKeyFrame_default_instance_;
+class SharedKeyOffer;
+struct SharedKeyOfferDefaultTypeInternal;
+extern SharedKeyOfferDefaultTypeInternal _SharedKeyOffer_default_instance_;
 class V1Frame;
 struct V1FrameDefaultTypeInternal;
 extern V1FrameDefaultTypeInternal _V1Frame_default_instance_;
@@ -205,6 +211,8 @@ template<> ::location::nearby::connections::PayloadTransferFrame_ControlMessage*
 template<> ::location::nearby::connections::PayloadTransferFrame_PayloadChunk* Arena::CreateMaybeMessage<::location::nearby::connections::PayloadTransferFrame_PayloadChunk>(Arena*);
 template<> ::location::nearby::connections::PayloadTransferFrame_PayloadHeader* Arena::CreateMaybeMessage<::location::nearby::connections::PayloadTransferFrame_PayloadHeader>(Arena*);
 template<> ::location::nearby::connections::PresenceDevice* Arena::CreateMaybeMessage<::location::nearby::connections::PresenceDevice>(Arena*);
+template<> ::location::nearby::connections::SharedKeyFrame* Arena::CreateMaybeMessage<::location::nearby::connections::SharedKeyFrame>(Arena*);
+template<> ::location::nearby::connections::SharedKeyOffer* Arena::CreateMaybeMessage<::location::nearby::connections::SharedKeyOffer>(Arena*);
 template<> ::location::nearby::connections::V1Frame* Arena::CreateMaybeMessage<::location::nearby::connections::V1Frame>(Arena*);
 template<> ::location::nearby::connections::WifiAwareUsableChannels* Arena::CreateMaybeMessage<::location::nearby::connections::WifiAwareUsableChannels>(Arena*);
 template<> ::location::nearby::connections::WifiDirectCliUsableChannels* Arena::CreateMaybeMessage<::location::nearby::connections::WifiDirectCliUsableChannels>(Arena*);
@@ -313,6 +321,27 @@ inline const std::string& ConnectionRequestFrame_ConnectionMode_Name(T enum_t_va
 }
 bool ConnectionRequestFrame_ConnectionMode_Parse(
     ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ConnectionRequestFrame_ConnectionMode* value);
+enum SharedKeyFrame_FrameType : int {
+  SharedKeyFrame_FrameType_UNKNOWN_FRAME_TYPE = 0,
+  SharedKeyFrame_FrameType_SERVER_INIT = 1,
+  SharedKeyFrame_FrameType_CLIENT_FINISH = 2,
+  SharedKeyFrame_FrameType_DECLINE = 3
+};
+bool SharedKeyFrame_FrameType_IsValid(int value);
+constexpr SharedKeyFrame_FrameType SharedKeyFrame_FrameType_FrameType_MIN = SharedKeyFrame_FrameType_UNKNOWN_FRAME_TYPE;
+constexpr SharedKeyFrame_FrameType SharedKeyFrame_FrameType_FrameType_MAX = SharedKeyFrame_FrameType_DECLINE;
+constexpr int SharedKeyFrame_FrameType_FrameType_ARRAYSIZE = SharedKeyFrame_FrameType_FrameType_MAX + 1;
+
+const std::string& SharedKeyFrame_FrameType_Name(SharedKeyFrame_FrameType value);
+template<typename T>
+inline const std::string& SharedKeyFrame_FrameType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, SharedKeyFrame_FrameType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function SharedKeyFrame_FrameType_Name.");
+  return SharedKeyFrame_FrameType_Name(static_cast<SharedKeyFrame_FrameType>(enum_t_value));
+}
+bool SharedKeyFrame_FrameType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SharedKeyFrame_FrameType* value);
 enum ConnectionResponseFrame_ResponseStatus : int {
   ConnectionResponseFrame_ResponseStatus_UNKNOWN_RESPONSE_STATUS = 0,
   ConnectionResponseFrame_ResponseStatus_ACCEPT = 1,
@@ -337,11 +366,12 @@ enum PayloadTransferFrame_PayloadHeader_PayloadType : int {
   PayloadTransferFrame_PayloadHeader_PayloadType_UNKNOWN_PAYLOAD_TYPE = 0,
   PayloadTransferFrame_PayloadHeader_PayloadType_BYTES = 1,
   PayloadTransferFrame_PayloadHeader_PayloadType_FILE = 2,
-  PayloadTransferFrame_PayloadHeader_PayloadType_STREAM = 3
+  PayloadTransferFrame_PayloadHeader_PayloadType_STREAM = 3,
+  PayloadTransferFrame_PayloadHeader_PayloadType_DATAGRAM = 4
 };
 bool PayloadTransferFrame_PayloadHeader_PayloadType_IsValid(int value);
 constexpr PayloadTransferFrame_PayloadHeader_PayloadType PayloadTransferFrame_PayloadHeader_PayloadType_PayloadType_MIN = PayloadTransferFrame_PayloadHeader_PayloadType_UNKNOWN_PAYLOAD_TYPE;
-constexpr PayloadTransferFrame_PayloadHeader_PayloadType PayloadTransferFrame_PayloadHeader_PayloadType_PayloadType_MAX = PayloadTransferFrame_PayloadHeader_PayloadType_STREAM;
+constexpr PayloadTransferFrame_PayloadHeader_PayloadType PayloadTransferFrame_PayloadHeader_PayloadType_PayloadType_MAX = PayloadTransferFrame_PayloadHeader_PayloadType_DATAGRAM;
 constexpr int PayloadTransferFrame_PayloadHeader_PayloadType_PayloadType_ARRAYSIZE = PayloadTransferFrame_PayloadHeader_PayloadType_PayloadType_MAX + 1;
 
 const std::string& PayloadTransferFrame_PayloadHeader_PayloadType_Name(PayloadTransferFrame_PayloadHeader_PayloadType value);
@@ -1443,6 +1473,8 @@ class ConnectionRequestFrame final :
     kEndpointInfoFieldNumber = 6,
     kDeviceInfoFieldNumber = 11,
     kMediumMetadataFieldNumber = 7,
+    kLocationHintFieldNumber = 15,
+    kSharedKeyOfferFieldNumber = 16,
     kNonceFieldNumber = 4,
     kKeepAliveIntervalMillisFieldNumber = 8,
     kKeepAliveTimeoutMillisFieldNumber = 9,
@@ -1576,6 +1608,42 @@ class ConnectionRequestFrame final :
       ::location::nearby::connections::MediumMetadata* medium_metadata);
   ::location::nearby::connections::MediumMetadata* unsafe_arena_release_medium_metadata();
 
+  // optional .location.nearby.connections.LocationHint location_hint = 15;
+  bool has_location_hint() const;
+  private:
+  bool _internal_has_location_hint() const;
+  public:
+  void clear_location_hint();
+  const ::location::nearby::connections::LocationHint& location_hint() const;
+  PROTOBUF_NODISCARD ::location::nearby::connections::LocationHint* release_location_hint();
+  ::location::nearby::connections::LocationHint* mutable_location_hint();
+  void set_allocated_location_hint(::location::nearby::connections::LocationHint* location_hint);
+  private:
+  const ::location::nearby::connections::LocationHint& _internal_location_hint() const;
+  ::location::nearby::connections::LocationHint* _internal_mutable_location_hint();
+  public:
+  void unsafe_arena_set_allocated_location_hint(
+      ::location::nearby::connections::LocationHint* location_hint);
+  ::location::nearby::connections::LocationHint* unsafe_arena_release_location_hint();
+
+  // optional .location.nearby.connections.SharedKeyOffer shared_key_offer = 16;
+  bool has_shared_key_offer() const;
+  private:
+  bool _internal_has_shared_key_offer() const;
+  public:
+  void clear_shared_key_offer();
+  const ::location::nearby::connections::SharedKeyOffer& shared_key_offer() const;
+  PROTOBUF_NODISCARD ::location::nearby::connections::SharedKeyOffer* release_shared_key_offer();
+  ::location::nearby::connections::SharedKeyOffer* mutable_shared_key_offer();
+  void set_allocated_shared_key_offer(::location::nearby::connections::SharedKeyOffer* shared_key_offer);
+  private:
+  const ::location::nearby::connections::SharedKeyOffer& _internal_shared_key_offer() const;
+  ::location::nearby::connections::SharedKeyOffer* _internal_mutable_shared_key_offer();
+  public:
+  void unsafe_arena_set_allocated_shared_key_offer(
+      ::location::nearby::connections::SharedKeyOffer* shared_key_offer);
+  ::location::nearby::connections::SharedKeyOffer* unsafe_arena_release_shared_key_offer();
+
   // optional int32 nonce = 4;
   bool has_nonce() const;
   private:
@@ -1700,6 +1768,8 @@ class ConnectionRequestFrame final :
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr endpoint_info_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr device_info_;
   ::location::nearby::connections::MediumMetadata* medium_metadata_;
+  ::location::nearby::connections::LocationHint* location_hint_;
+  ::location::nearby::connections::SharedKeyOffer* shared_key_offer_;
   int32_t nonce_;
   int32_t keep_alive_interval_millis_;
   int32_t keep_alive_timeout_millis_;
@@ -1717,24 +1787,24 @@ class ConnectionRequestFrame final :
 };
 // -------------------------------------------------------------------
 
-class ConnectionResponseFrame final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.ConnectionResponseFrame) */ {
+class SharedKeyOffer final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.SharedKeyOffer) */ {
  public:
-  inline ConnectionResponseFrame() : ConnectionResponseFrame(nullptr) {}
-  ~ConnectionResponseFrame() override;
-  explicit constexpr ConnectionResponseFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline SharedKeyOffer() : SharedKeyOffer(nullptr) {}
+  ~SharedKeyOffer() override;
+  explicit constexpr SharedKeyOffer(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ConnectionResponseFrame(const ConnectionResponseFrame& from);
-  ConnectionResponseFrame(ConnectionResponseFrame&& from) noexcept
-    : ConnectionResponseFrame() {
+  SharedKeyOffer(const SharedKeyOffer& from);
+  SharedKeyOffer(SharedKeyOffer&& from) noexcept
+    : SharedKeyOffer() {
     *this = ::std::move(from);
   }
 
-  inline ConnectionResponseFrame& operator=(const ConnectionResponseFrame& from) {
+  inline SharedKeyOffer& operator=(const SharedKeyOffer& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ConnectionResponseFrame& operator=(ConnectionResponseFrame&& from) noexcept {
+  inline SharedKeyOffer& operator=(SharedKeyOffer&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1755,20 +1825,20 @@ class ConnectionResponseFrame final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const ConnectionResponseFrame& default_instance() {
+  static const SharedKeyOffer& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ConnectionResponseFrame* internal_default_instance() {
-    return reinterpret_cast<const ConnectionResponseFrame*>(
-               &_ConnectionResponseFrame_default_instance_);
+  static inline const SharedKeyOffer* internal_default_instance() {
+    return reinterpret_cast<const SharedKeyOffer*>(
+               &_SharedKeyOffer_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     3;
 
-  friend void swap(ConnectionResponseFrame& a, ConnectionResponseFrame& b) {
+  friend void swap(SharedKeyOffer& a, SharedKeyOffer& b) {
     a.Swap(&b);
   }
-  inline void Swap(ConnectionResponseFrame* other) {
+  inline void Swap(SharedKeyOffer* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1781,7 +1851,7 @@ class ConnectionResponseFrame final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ConnectionResponseFrame* other) {
+  void UnsafeArenaSwap(SharedKeyOffer* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1789,12 +1859,12 @@ class ConnectionResponseFrame final :
 
   // implements Message ----------------------------------------------
 
-  ConnectionResponseFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ConnectionResponseFrame>(arena);
+  SharedKeyOffer* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SharedKeyOffer>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const ConnectionResponseFrame& from);
-  void MergeFrom(const ConnectionResponseFrame& from);
+  void CopyFrom(const SharedKeyOffer& from);
+  void MergeFrom(const SharedKeyOffer& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -1808,15 +1878,15 @@ class ConnectionResponseFrame final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(ConnectionResponseFrame* other);
+  void InternalSwap(SharedKeyOffer* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.ConnectionResponseFrame";
+    return "location.nearby.connections.SharedKeyOffer";
   }
   protected:
-  explicit ConnectionResponseFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit SharedKeyOffer(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -1827,147 +1897,49 @@ class ConnectionResponseFrame final :
 
   // nested types ----------------------------------------------------
 
-  typedef ConnectionResponseFrame_ResponseStatus ResponseStatus;
-  static constexpr ResponseStatus UNKNOWN_RESPONSE_STATUS =
-    ConnectionResponseFrame_ResponseStatus_UNKNOWN_RESPONSE_STATUS;
-  static constexpr ResponseStatus ACCEPT =
-    ConnectionResponseFrame_ResponseStatus_ACCEPT;
-  static constexpr ResponseStatus REJECT =
-    ConnectionResponseFrame_ResponseStatus_REJECT;
-  static inline bool ResponseStatus_IsValid(int value) {
-    return ConnectionResponseFrame_ResponseStatus_IsValid(value);
-  }
-  static constexpr ResponseStatus ResponseStatus_MIN =
-    ConnectionResponseFrame_ResponseStatus_ResponseStatus_MIN;
-  static constexpr ResponseStatus ResponseStatus_MAX =
-    ConnectionResponseFrame_ResponseStatus_ResponseStatus_MAX;
-  static constexpr int ResponseStatus_ARRAYSIZE =
-    ConnectionResponseFrame_ResponseStatus_ResponseStatus_ARRAYSIZE;
-  template<typename T>
-  static inline const std::string& ResponseStatus_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, ResponseStatus>::value ||
-      ::std::is_integral<T>::value,
-      "Incorrect type passed to function ResponseStatus_Name.");
-    return ConnectionResponseFrame_ResponseStatus_Name(enum_t_value);
-  }
-  static inline bool ResponseStatus_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
-      ResponseStatus* value) {
-    return ConnectionResponseFrame_ResponseStatus_Parse(name, value);
-  }
-
   // accessors -------------------------------------------------------
 
   enum : int {
-    kHandshakeDataFieldNumber = 2,
-    kOsInfoFieldNumber = 4,
-    kStatusFieldNumber = 1,
-    kResponseFieldNumber = 3,
-    kMultiplexSocketBitmaskFieldNumber = 5,
-    kNearbyConnectionsVersionFieldNumber = 6,
-    kSafeToDisconnectVersionFieldNumber = 7,
+    kSessionTagFieldNumber = 1,
+    kNonceFieldNumber = 2,
   };
-  // optional bytes handshake_data = 2;
-  bool has_handshake_data() const;
+  // optional bytes session_tag = 1;
+  bool has_session_tag() const;
   private:
-  bool _internal_has_handshake_data() const;
+  bool _internal_has_session_tag() const;
   public:
-  void clear_handshake_data();
-  const std::string& handshake_data() const;
+  void clear_session_tag();
+  const std::string& session_tag() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_handshake_data(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_handshake_data();
-  PROTOBUF_NODISCARD std::string* release_handshake_data();
-  void set_allocated_handshake_data(std::string* handshake_data);
-  private:
-  const std::string& _internal_handshake_data() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_handshake_data(const std::string& value);
-  std::string* _internal_mutable_handshake_data();
-  public:
-
-  // optional .location.nearby.connections.OsInfo os_info = 4;
-  bool has_os_info() const;
-  private:
-  bool _internal_has_os_info() const;
-  public:
-  void clear_os_info();
-  const ::location::nearby::connections::OsInfo& os_info() const;
-  PROTOBUF_NODISCARD ::location::nearby::connections::OsInfo* release_os_info();
-  ::location::nearby::connections::OsInfo* mutable_os_info();
-  void set_allocated_os_info(::location::nearby::connections::OsInfo* os_info);
-  private:
-  const ::location::nearby::connections::OsInfo& _internal_os_info() const;
-  ::location::nearby::connections::OsInfo* _internal_mutable_os_info();
-  public:
-  void unsafe_arena_set_allocated_os_info(
-      ::location::nearby::connections::OsInfo* os_info);
-  ::location::nearby::connections::OsInfo* unsafe_arena_release_os_info();
-
-  // optional int32 status = 1 [deprecated = true];
-  PROTOBUF_DEPRECATED bool has_status() const;
-  private:
-  bool _internal_has_status() const;
-  public:
-  PROTOBUF_DEPRECATED void clear_status();
-  PROTOBUF_DEPRECATED int32_t status() const;
-  PROTOBUF_DEPRECATED void set_status(int32_t value);
+  void set_session_tag(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_session_tag();
+  PROTOBUF_NODISCARD std::string* release_session_tag();
+  void set_allocated_session_tag(std::string* session_tag);
   private:
-  int32_t _internal_status() const;
-  void _internal_set_status(int32_t value);
-  public:
-
-  // optional .location.nearby.connections.ConnectionResponseFrame.ResponseStatus response = 3;
-  bool has_response() const;
-  private:
-  bool _internal_has_response() const;
-  public:
-  void clear_response();
-  ::location::nearby::connections::ConnectionResponseFrame_ResponseStatus response() const;
-  void set_response(::location::nearby::connections::ConnectionResponseFrame_ResponseStatus value);
-  private:
-  ::location::nearby::connections::ConnectionResponseFrame_ResponseStatus _internal_response() const;
-  void _internal_set_response(::location::nearby::connections::ConnectionResponseFrame_ResponseStatus value);
-  public:
-
-  // optional int32 multiplex_socket_bitmask = 5;
-  bool has_multiplex_socket_bitmask() const;
-  private:
-  bool _internal_has_multiplex_socket_bitmask() const;
-  public:
-  void clear_multiplex_socket_bitmask();
-  int32_t multiplex_socket_bitmask() const;
-  void set_multiplex_socket_bitmask(int32_t value);
-  private:
-  int32_t _internal_multiplex_socket_bitmask() const;
-  void _internal_set_multiplex_socket_bitmask(int32_t value);
-  public:
-
-  // optional int32 nearby_connections_version = 6 [deprecated = true];
-  PROTOBUF_DEPRECATED bool has_nearby_connections_version() const;
-  private:
-  bool _internal_has_nearby_connections_version() const;
-  public:
-  PROTOBUF_DEPRECATED void clear_nearby_connections_version();
-  PROTOBUF_DEPRECATED int32_t nearby_connections_version() const;
-  PROTOBUF_DEPRECATED void set_nearby_connections_version(int32_t value);
-  private:
-  int32_t _internal_nearby_connections_version() const;
-  void _internal_set_nearby_connections_version(int32_t value);
+  const std::string& _internal_session_tag() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session_tag(const std::string& value);
+  std::string* _internal_mutable_session_tag();
   public:
 
-  // optional int32 safe_to_disconnect_version = 7;
-  bool has_safe_to_disconnect_version() const;
+  // optional bytes nonce = 2;
+  bool has_nonce() const;
   private:
-  bool _internal_has_safe_to_disconnect_version() const;
+  bool _internal_has_nonce() const;
   public:
-  void clear_safe_to_disconnect_version();
-  int32_t safe_to_disconnect_version() const;
-  void set_safe_to_disconnect_version(int32_t value);
+  void clear_nonce();
+  const std::string& nonce() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_nonce(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_nonce();
+  PROTOBUF_NODISCARD std::string* release_nonce();
+  void set_allocated_nonce(std::string* nonce);
   private:
-  int32_t _internal_safe_to_disconnect_version() const;
-  void _internal_set_safe_to_disconnect_version(int32_t value);
+  const std::string& _internal_nonce() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_nonce(const std::string& value);
+  std::string* _internal_mutable_nonce();
   public:
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.ConnectionResponseFrame)
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.SharedKeyOffer)
  private:
   class _Internal;
 
@@ -1976,35 +1948,30 @@ class ConnectionResponseFrame final :
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr handshake_data_;
-  ::location::nearby::connections::OsInfo* os_info_;
-  int32_t status_;
-  int response_;
-  int32_t multiplex_socket_bitmask_;
-  int32_t nearby_connections_version_;
-  int32_t safe_to_disconnect_version_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_tag_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr nonce_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PayloadTransferFrame_PayloadHeader final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.PayloadTransferFrame.PayloadHeader) */ {
+class SharedKeyFrame final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.SharedKeyFrame) */ {
  public:
-  inline PayloadTransferFrame_PayloadHeader() : PayloadTransferFrame_PayloadHeader(nullptr) {}
-  ~PayloadTransferFrame_PayloadHeader() override;
-  explicit constexpr PayloadTransferFrame_PayloadHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline SharedKeyFrame() : SharedKeyFrame(nullptr) {}
+  ~SharedKeyFrame() override;
+  explicit constexpr SharedKeyFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  PayloadTransferFrame_PayloadHeader(const PayloadTransferFrame_PayloadHeader& from);
-  PayloadTransferFrame_PayloadHeader(PayloadTransferFrame_PayloadHeader&& from) noexcept
-    : PayloadTransferFrame_PayloadHeader() {
+  SharedKeyFrame(const SharedKeyFrame& from);
+  SharedKeyFrame(SharedKeyFrame&& from) noexcept
+    : SharedKeyFrame() {
     *this = ::std::move(from);
   }
 
-  inline PayloadTransferFrame_PayloadHeader& operator=(const PayloadTransferFrame_PayloadHeader& from) {
+  inline SharedKeyFrame& operator=(const SharedKeyFrame& from) {
     CopyFrom(from);
     return *this;
   }
-  inline PayloadTransferFrame_PayloadHeader& operator=(PayloadTransferFrame_PayloadHeader&& from) noexcept {
+  inline SharedKeyFrame& operator=(SharedKeyFrame&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2025,20 +1992,20 @@ class PayloadTransferFrame_PayloadHeader final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const PayloadTransferFrame_PayloadHeader& default_instance() {
+  static const SharedKeyFrame& default_instance() {
     return *internal_default_instance();
   }
-  static inline const PayloadTransferFrame_PayloadHeader* internal_default_instance() {
-    return reinterpret_cast<const PayloadTransferFrame_PayloadHeader*>(
-               &_PayloadTransferFrame_PayloadHeader_default_instance_);
+  static inline const SharedKeyFrame* internal_default_instance() {
+    return reinterpret_cast<const SharedKeyFrame*>(
+               &_SharedKeyFrame_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     4;
 
-  friend void swap(PayloadTransferFrame_PayloadHeader& a, PayloadTransferFrame_PayloadHeader& b) {
+  friend void swap(SharedKeyFrame& a, SharedKeyFrame& b) {
     a.Swap(&b);
   }
-  inline void Swap(PayloadTransferFrame_PayloadHeader* other) {
+  inline void Swap(SharedKeyFrame* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2051,7 +2018,7 @@ class PayloadTransferFrame_PayloadHeader final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(PayloadTransferFrame_PayloadHeader* other) {
+  void UnsafeArenaSwap(SharedKeyFrame* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2059,12 +2026,12 @@ class PayloadTransferFrame_PayloadHeader final :
 
   // implements Message ----------------------------------------------
 
-  PayloadTransferFrame_PayloadHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<PayloadTransferFrame_PayloadHeader>(arena);
+  SharedKeyFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SharedKeyFrame>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const PayloadTransferFrame_PayloadHeader& from);
-  void MergeFrom(const PayloadTransferFrame_PayloadHeader& from);
+  void CopyFrom(const SharedKeyFrame& from);
+  void MergeFrom(const SharedKeyFrame& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -2078,15 +2045,15 @@ class PayloadTransferFrame_PayloadHeader final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(PayloadTransferFrame_PayloadHeader* other);
+  void InternalSwap(SharedKeyFrame* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.PayloadTransferFrame.PayloadHeader";
+    return "location.nearby.connections.SharedKeyFrame";
   }
   protected:
-  explicit PayloadTransferFrame_PayloadHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit SharedKeyFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -2097,135 +2064,93 @@ class PayloadTransferFrame_PayloadHeader final :
 
   // nested types ----------------------------------------------------
 
-  typedef PayloadTransferFrame_PayloadHeader_PayloadType PayloadType;
-  static constexpr PayloadType UNKNOWN_PAYLOAD_TYPE =
-    PayloadTransferFrame_PayloadHeader_PayloadType_UNKNOWN_PAYLOAD_TYPE;
-  static constexpr PayloadType BYTES =
-    PayloadTransferFrame_PayloadHeader_PayloadType_BYTES;
-  static constexpr PayloadType FILE =
-    PayloadTransferFrame_PayloadHeader_PayloadType_FILE;
-  static constexpr PayloadType STREAM =
-    PayloadTransferFrame_PayloadHeader_PayloadType_STREAM;
-  static inline bool PayloadType_IsValid(int value) {
-    return PayloadTransferFrame_PayloadHeader_PayloadType_IsValid(value);
+  typedef SharedKeyFrame_FrameType FrameType;
+  static constexpr FrameType UNKNOWN_FRAME_TYPE =
+    SharedKeyFrame_FrameType_UNKNOWN_FRAME_TYPE;
+  static constexpr FrameType SERVER_INIT =
+    SharedKeyFrame_FrameType_SERVER_INIT;
+  static constexpr FrameType CLIENT_FINISH =
+    SharedKeyFrame_FrameType_CLIENT_FINISH;
+  static constexpr FrameType DECLINE =
+    SharedKeyFrame_FrameType_DECLINE;
+  static inline bool FrameType_IsValid(int value) {
+    return SharedKeyFrame_FrameType_IsValid(value);
   }
-  static constexpr PayloadType PayloadType_MIN =
-    PayloadTransferFrame_PayloadHeader_PayloadType_PayloadType_MIN;
-  static constexpr PayloadType PayloadType_MAX =
-    PayloadTransferFrame_PayloadHeader_PayloadType_PayloadType_MAX;
-  static constexpr int PayloadType_ARRAYSIZE =
-    PayloadTransferFrame_PayloadHeader_PayloadType_PayloadType_ARRAYSIZE;
+  static constexpr FrameType FrameType_MIN =
+    SharedKeyFrame_FrameType_FrameType_MIN;
+  static constexpr FrameType FrameType_MAX =
+    SharedKeyFrame_FrameType_FrameType_MAX;
+  static constexpr int FrameType_ARRAYSIZE =
+    SharedKeyFrame_FrameType_FrameType_ARRAYSIZE;
   template<typename T>
-  static inline const std::string& PayloadType_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, PayloadType>::value ||
+  static inline const std::string& FrameType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, FrameType>::value ||
       ::std::is_integral<T>::value,
-      "Incorrect type passed to function PayloadType_Name.");
-    return PayloadTransferFrame_PayloadHeader_PayloadType_Name(enum_t_value);
+      "Incorrect type passed to function FrameType_Name.");
+    return SharedKeyFrame_FrameType_Name(enum_t_value);
   }
-  static inline bool PayloadType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
-      PayloadType* value) {
-    return PayloadTransferFrame_PayloadHeader_PayloadType_Parse(name, value);
+  static inline bool FrameType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      FrameType* value) {
+    return SharedKeyFrame_FrameType_Parse(name, value);
   }
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kFileNameFieldNumber = 5,
-    kParentFolderFieldNumber = 6,
-    kIdFieldNumber = 1,
-    kTotalSizeFieldNumber = 3,
-    kTypeFieldNumber = 2,
-    kIsSensitiveFieldNumber = 4,
+    kNonceFieldNumber = 2,
+    kConfirmationFieldNumber = 3,
+    kTypeFieldNumber = 1,
   };
-  // optional string file_name = 5;
-  bool has_file_name() const;
+  // optional bytes nonce = 2;
+  bool has_nonce() const;
   private:
-  bool _internal_has_file_name() const;
+  bool _internal_has_nonce() const;
   public:
-  void clear_file_name();
-  const std::string& file_name() const;
+  void clear_nonce();
+  const std::string& nonce() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_file_name(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_file_name();
-  PROTOBUF_NODISCARD std::string* release_file_name();
-  void set_allocated_file_name(std::string* file_name);
+  void set_nonce(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_nonce();
+  PROTOBUF_NODISCARD std::string* release_nonce();
+  void set_allocated_nonce(std::string* nonce);
   private:
-  const std::string& _internal_file_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_file_name(const std::string& value);
-  std::string* _internal_mutable_file_name();
+  const std::string& _internal_nonce() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_nonce(const std::string& value);
+  std::string* _internal_mutable_nonce();
   public:
 
-  // optional string parent_folder = 6;
-  bool has_parent_folder() const;
+  // optional bytes confirmation = 3;
+  bool has_confirmation() const;
   private:
-  bool _internal_has_parent_folder() const;
+  bool _internal_has_confirmation() const;
   public:
-  void clear_parent_folder();
-  const std::string& parent_folder() const;
+  void clear_confirmation();
+  const std::string& confirmation() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_parent_folder(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_parent_folder();
-  PROTOBUF_NODISCARD std::string* release_parent_folder();
-  void set_allocated_parent_folder(std::string* parent_folder);
-  private:
-  const std::string& _internal_parent_folder() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_parent_folder(const std::string& value);
-  std::string* _internal_mutable_parent_folder();
-  public:
-
-  // optional int64 id = 1;
-  bool has_id() const;
-  private:
-  bool _internal_has_id() const;
-  public:
-  void clear_id();
-  int64_t id() const;
-  void set_id(int64_t value);
-  private:
-  int64_t _internal_id() const;
-  void _internal_set_id(int64_t value);
-  public:
-
-  // optional int64 total_size = 3;
-  bool has_total_size() const;
-  private:
-  bool _internal_has_total_size() const;
-  public:
-  void clear_total_size();
-  int64_t total_size() const;
-  void set_total_size(int64_t value);
+  void set_confirmation(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_confirmation();
+  PROTOBUF_NODISCARD std::string* release_confirmation();
+  void set_allocated_confirmation(std::string* confirmation);
   private:
-  int64_t _internal_total_size() const;
-  void _internal_set_total_size(int64_t value);
+  const std::string& _internal_confirmation() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_confirmation(const std::string& value);
+  std::string* _internal_mutable_confirmation();
   public:
 
-  // optional .location.nearby.connections.PayloadTransferFrame.PayloadHeader.PayloadType type = 2;
+  // optional .location.nearby.connections.SharedKeyFrame.FrameType type = 1;
   bool has_type() const;
   private:
   bool _internal_has_type() const;
   public:
   void clear_type();
-  ::location::nearby::connections::PayloadTransferFrame_PayloadHeader_PayloadType type() const;
-  void set_type(::location::nearby::connections::PayloadTransferFrame_PayloadHeader_PayloadType value);
-  private:
-  ::location::nearby::connections::PayloadTransferFrame_PayloadHeader_PayloadType _internal_type() const;
-  void _internal_set_type(::location::nearby::connections::PayloadTransferFrame_PayloadHeader_PayloadType value);
-  public:
-
-  // optional bool is_sensitive = 4;
-  bool has_is_sensitive() const;
-  private:
-  bool _internal_has_is_sensitive() const;
-  public:
-  void clear_is_sensitive();
-  bool is_sensitive() const;
-  void set_is_sensitive(bool value);
+  ::location::nearby::connections::SharedKeyFrame_FrameType type() const;
+  void set_type(::location::nearby::connections::SharedKeyFrame_FrameType value);
   private:
-  bool _internal_is_sensitive() const;
-  void _internal_set_is_sensitive(bool value);
+  ::location::nearby::connections::SharedKeyFrame_FrameType _internal_type() const;
+  void _internal_set_type(::location::nearby::connections::SharedKeyFrame_FrameType value);
   public:
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.PayloadTransferFrame.PayloadHeader)
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.SharedKeyFrame)
  private:
   class _Internal;
 
@@ -2234,34 +2159,31 @@ class PayloadTransferFrame_PayloadHeader final :
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr parent_folder_;
-  int64_t id_;
-  int64_t total_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr nonce_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr confirmation_;
   int type_;
-  bool is_sensitive_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PayloadTransferFrame_PayloadChunk final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.PayloadTransferFrame.PayloadChunk) */ {
+class ConnectionResponseFrame final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.ConnectionResponseFrame) */ {
  public:
-  inline PayloadTransferFrame_PayloadChunk() : PayloadTransferFrame_PayloadChunk(nullptr) {}
-  ~PayloadTransferFrame_PayloadChunk() override;
-  explicit constexpr PayloadTransferFrame_PayloadChunk(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ConnectionResponseFrame() : ConnectionResponseFrame(nullptr) {}
+  ~ConnectionResponseFrame() override;
+  explicit constexpr ConnectionResponseFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  PayloadTransferFrame_PayloadChunk(const PayloadTransferFrame_PayloadChunk& from);
-  PayloadTransferFrame_PayloadChunk(PayloadTransferFrame_PayloadChunk&& from) noexcept
-    : PayloadTransferFrame_PayloadChunk() {
+  ConnectionResponseFrame(const ConnectionResponseFrame& from);
+  ConnectionResponseFrame(ConnectionResponseFrame&& from) noexcept
+    : ConnectionResponseFrame() {
     *this = ::std::move(from);
   }
 
-  inline PayloadTransferFrame_PayloadChunk& operator=(const PayloadTransferFrame_PayloadChunk& from) {
+  inline ConnectionResponseFrame& operator=(const ConnectionResponseFrame& from) {
     CopyFrom(from);
     return *this;
   }
-  inline PayloadTransferFrame_PayloadChunk& operator=(PayloadTransferFrame_PayloadChunk&& from) noexcept {
+  inline ConnectionResponseFrame& operator=(ConnectionResponseFrame&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2282,20 +2204,20 @@ class PayloadTransferFrame_PayloadChunk final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const PayloadTransferFrame_PayloadChunk& default_instance() {
+  static const ConnectionResponseFrame& default_instance() {
     return *internal_default_instance();
   }
-  static inline const PayloadTransferFrame_PayloadChunk* internal_default_instance() {
-    return reinterpret_cast<const PayloadTransferFrame_PayloadChunk*>(
-               &_PayloadTransferFrame_PayloadChunk_default_instance_);
+  static inline const ConnectionResponseFrame* internal_default_instance() {
+    return reinterpret_cast<const ConnectionResponseFrame*>(
+               &_ConnectionResponseFrame_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     5;
 
-  friend void swap(PayloadTransferFrame_PayloadChunk& a, PayloadTransferFrame_PayloadChunk& b) {
+  friend void swap(ConnectionResponseFrame& a, ConnectionResponseFrame& b) {
     a.Swap(&b);
   }
-  inline void Swap(PayloadTransferFrame_PayloadChunk* other) {
+  inline void Swap(ConnectionResponseFrame* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2308,7 +2230,7 @@ class PayloadTransferFrame_PayloadChunk final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(PayloadTransferFrame_PayloadChunk* other) {
+  void UnsafeArenaSwap(ConnectionResponseFrame* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2316,12 +2238,12 @@ class PayloadTransferFrame_PayloadChunk final :
 
   // implements Message ----------------------------------------------
 
-  PayloadTransferFrame_PayloadChunk* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<PayloadTransferFrame_PayloadChunk>(arena);
+  ConnectionResponseFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ConnectionResponseFrame>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const PayloadTransferFrame_PayloadChunk& from);
-  void MergeFrom(const PayloadTransferFrame_PayloadChunk& from);
+  void CopyFrom(const ConnectionResponseFrame& from);
+  void MergeFrom(const ConnectionResponseFrame& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -2335,15 +2257,15 @@ class PayloadTransferFrame_PayloadChunk final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(PayloadTransferFrame_PayloadChunk* other);
+  void InternalSwap(ConnectionResponseFrame* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.PayloadTransferFrame.PayloadChunk";
+    return "location.nearby.connections.ConnectionResponseFrame";
   }
   protected:
-  explicit PayloadTransferFrame_PayloadChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ConnectionResponseFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -2354,96 +2276,222 @@ class PayloadTransferFrame_PayloadChunk final :
 
   // nested types ----------------------------------------------------
 
-  typedef PayloadTransferFrame_PayloadChunk_Flags Flags;
-  static constexpr Flags LAST_CHUNK =
-    PayloadTransferFrame_PayloadChunk_Flags_LAST_CHUNK;
-  static inline bool Flags_IsValid(int value) {
-    return PayloadTransferFrame_PayloadChunk_Flags_IsValid(value);
+  typedef ConnectionResponseFrame_ResponseStatus ResponseStatus;
+  static constexpr ResponseStatus UNKNOWN_RESPONSE_STATUS =
+    ConnectionResponseFrame_ResponseStatus_UNKNOWN_RESPONSE_STATUS;
+  static constexpr ResponseStatus ACCEPT =
+    ConnectionResponseFrame_ResponseStatus_ACCEPT;
+  static constexpr ResponseStatus REJECT =
+    ConnectionResponseFrame_ResponseStatus_REJECT;
+  static inline bool ResponseStatus_IsValid(int value) {
+    return ConnectionResponseFrame_ResponseStatus_IsValid(value);
   }
-  static constexpr Flags Flags_MIN =
-    PayloadTransferFrame_PayloadChunk_Flags_Flags_MIN;
-  static constexpr Flags Flags_MAX =
-    PayloadTransferFrame_PayloadChunk_Flags_Flags_MAX;
-  static constexpr int Flags_ARRAYSIZE =
-    PayloadTransferFrame_PayloadChunk_Flags_Flags_ARRAYSIZE;
+  static constexpr ResponseStatus ResponseStatus_MIN =
+    ConnectionResponseFrame_ResponseStatus_ResponseStatus_MIN;
+  static constexpr ResponseStatus ResponseStatus_MAX =
+    ConnectionResponseFrame_ResponseStatus_ResponseStatus_MAX;
+  static constexpr int ResponseStatus_ARRAYSIZE =
+    ConnectionResponseFrame_ResponseStatus_ResponseStatus_ARRAYSIZE;
   template<typename T>
-  static inline const std::string& Flags_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, Flags>::value ||
+  static inline const std::string& ResponseStatus_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, ResponseStatus>::value ||
       ::std::is_integral<T>::value,
-      "Incorrect type passed to function Flags_Name.");
-    return PayloadTransferFrame_PayloadChunk_Flags_Name(enum_t_value);
+      "Incorrect type passed to function ResponseStatus_Name.");
+    return ConnectionResponseFrame_ResponseStatus_Name(enum_t_value);
   }
-  static inline bool Flags_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
-      Flags* value) {
-    return PayloadTransferFrame_PayloadChunk_Flags_Parse(name, value);
+  static inline bool ResponseStatus_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      ResponseStatus* value) {
+    return ConnectionResponseFrame_ResponseStatus_Parse(name, value);
   }
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kBodyFieldNumber = 3,
-    kOffsetFieldNumber = 2,
-    kFlagsFieldNumber = 1,
-    kIndexFieldNumber = 4,
+    kHandshakeDataFieldNumber = 2,
+    kOsInfoFieldNumber = 4,
+    kLocationHintFieldNumber = 8,
+    kStatusFieldNumber = 1,
+    kResponseFieldNumber = 3,
+    kMultiplexSocketBitmaskFieldNumber = 5,
+    kNearbyConnectionsVersionFieldNumber = 6,
+    kSafeToDisconnectVersionFieldNumber = 7,
+    kKeepAliveTimeoutMillisFieldNumber = 9,
+    kSupportsSharedKeyFieldNumber = 10,
+    kSupportsPayloadHeaderElisionFieldNumber = 11,
+    kSupportsDatagramFieldNumber = 12,
   };
-  // optional bytes body = 3;
-  bool has_body() const;
+  // optional bytes handshake_data = 2;
+  bool has_handshake_data() const;
   private:
-  bool _internal_has_body() const;
+  bool _internal_has_handshake_data() const;
   public:
-  void clear_body();
-  const std::string& body() const;
+  void clear_handshake_data();
+  const std::string& handshake_data() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_body(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_body();
-  PROTOBUF_NODISCARD std::string* release_body();
-  void set_allocated_body(std::string* body);
+  void set_handshake_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_handshake_data();
+  PROTOBUF_NODISCARD std::string* release_handshake_data();
+  void set_allocated_handshake_data(std::string* handshake_data);
   private:
-  const std::string& _internal_body() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_body(const std::string& value);
-  std::string* _internal_mutable_body();
+  const std::string& _internal_handshake_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_handshake_data(const std::string& value);
+  std::string* _internal_mutable_handshake_data();
   public:
 
-  // optional int64 offset = 2;
-  bool has_offset() const;
+  // optional .location.nearby.connections.OsInfo os_info = 4;
+  bool has_os_info() const;
   private:
-  bool _internal_has_offset() const;
+  bool _internal_has_os_info() const;
   public:
-  void clear_offset();
-  int64_t offset() const;
-  void set_offset(int64_t value);
+  void clear_os_info();
+  const ::location::nearby::connections::OsInfo& os_info() const;
+  PROTOBUF_NODISCARD ::location::nearby::connections::OsInfo* release_os_info();
+  ::location::nearby::connections::OsInfo* mutable_os_info();
+  void set_allocated_os_info(::location::nearby::connections::OsInfo* os_info);
   private:
-  int64_t _internal_offset() const;
-  void _internal_set_offset(int64_t value);
+  const ::location::nearby::connections::OsInfo& _internal_os_info() const;
+  ::location::nearby::connections::OsInfo* _internal_mutable_os_info();
   public:
+  void unsafe_arena_set_allocated_os_info(
+      ::location::nearby::connections::OsInfo* os_info);
+  ::location::nearby::connections::OsInfo* unsafe_arena_release_os_info();
 
-  // optional int32 flags = 1;
-  bool has_flags() const;
+  // optional .location.nearby.connections.LocationHint location_hint = 8;
+  bool has_location_hint() const;
   private:
-  bool _internal_has_flags() const;
+  bool _internal_has_location_hint() const;
   public:
-  void clear_flags();
-  int32_t flags() const;
-  void set_flags(int32_t value);
+  void clear_location_hint();
+  const ::location::nearby::connections::LocationHint& location_hint() const;
+  PROTOBUF_NODISCARD ::location::nearby::connections::LocationHint* release_location_hint();
+  ::location::nearby::connections::LocationHint* mutable_location_hint();
+  void set_allocated_location_hint(::location::nearby::connections::LocationHint* location_hint);
   private:
-  int32_t _internal_flags() const;
-  void _internal_set_flags(int32_t value);
+  const ::location::nearby::connections::LocationHint& _internal_location_hint() const;
+  ::location::nearby::connections::LocationHint* _internal_mutable_location_hint();
   public:
+  void unsafe_arena_set_allocated_location_hint(
+      ::location::nearby::connections::LocationHint* location_hint);
+  ::location::nearby::connections::LocationHint* unsafe_arena_release_location_hint();
 
-  // optional int32 index = 4;
-  bool has_index() const;
+  // optional int32 status = 1 [deprecated = true];
+  PROTOBUF_DEPRECATED bool has_status() const;
   private:
-  bool _internal_has_index() const;
+  bool _internal_has_status() const;
   public:
-  void clear_index();
-  int32_t index() const;
-  void set_index(int32_t value);
+  PROTOBUF_DEPRECATED void clear_status();
+  PROTOBUF_DEPRECATED int32_t status() const;
+  PROTOBUF_DEPRECATED void set_status(int32_t value);
   private:
-  int32_t _internal_index() const;
-  void _internal_set_index(int32_t value);
+  int32_t _internal_status() const;
+  void _internal_set_status(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.PayloadTransferFrame.PayloadChunk)
+  // optional .location.nearby.connections.ConnectionResponseFrame.ResponseStatus response = 3;
+  bool has_response() const;
+  private:
+  bool _internal_has_response() const;
+  public:
+  void clear_response();
+  ::location::nearby::connections::ConnectionResponseFrame_ResponseStatus response() const;
+  void set_response(::location::nearby::connections::ConnectionResponseFrame_ResponseStatus value);
+  private:
+  ::location::nearby::connections::ConnectionResponseFrame_ResponseStatus _internal_response() const;
+  void _internal_set_response(::location::nearby::connections::ConnectionResponseFrame_ResponseStatus value);
+  public:
+
+  // optional int32 multiplex_socket_bitmask = 5;
+  bool has_multiplex_socket_bitmask() const;
+  private:
+  bool _internal_has_multiplex_socket_bitmask() const;
+  public:
+  void clear_multiplex_socket_bitmask();
+  int32_t multiplex_socket_bitmask() const;
+  void set_multiplex_socket_bitmask(int32_t value);
+  private:
+  int32_t _internal_multiplex_socket_bitmask() const;
+  void _internal_set_multiplex_socket_bitmask(int32_t value);
+  public:
+
+  // optional int32 nearby_connections_version = 6 [deprecated = true];
+  PROTOBUF_DEPRECATED bool has_nearby_connections_version() const;
+  private:
+  bool _internal_has_nearby_connections_version() const;
+  public:
+  PROTOBUF_DEPRECATED void clear_nearby_connections_version();
+  PROTOBUF_DEPRECATED int32_t nearby_connections_version() const;
+  PROTOBUF_DEPRECATED void set_nearby_connections_version(int32_t value);
+  private:
+  int32_t _internal_nearby_connections_version() const;
+  void _internal_set_nearby_connections_version(int32_t value);
+  public:
+
+  // optional int32 safe_to_disconnect_version = 7;
+  bool has_safe_to_disconnect_version() const;
+  private:
+  bool _internal_has_safe_to_disconnect_version() const;
+  public:
+  void clear_safe_to_disconnect_version();
+  int32_t safe_to_disconnect_version() const;
+  void set_safe_to_disconnect_version(int32_t value);
+  private:
+  int32_t _internal_safe_to_disconnect_version() const;
+  void _internal_set_safe_to_disconnect_version(int32_t value);
+  public:
+
+  // optional int32 keep_alive_timeout_millis = 9;
+  bool has_keep_alive_timeout_millis() const;
+  private:
+  bool _internal_has_keep_alive_timeout_millis() const;
+  public:
+  void clear_keep_alive_timeout_millis();
+  int32_t keep_alive_timeout_millis() const;
+  void set_keep_alive_timeout_millis(int32_t value);
+  private:
+  int32_t _internal_keep_alive_timeout_millis() const;
+  void _internal_set_keep_alive_timeout_millis(int32_t value);
+  public:
+
+  // optional bool supports_shared_key = 10;
+  bool has_supports_shared_key() const;
+  private:
+  bool _internal_has_supports_shared_key() const;
+  public:
+  void clear_supports_shared_key();
+  bool supports_shared_key() const;
+  void set_supports_shared_key(bool value);
+  private:
+  bool _internal_supports_shared_key() const;
+  void _internal_set_supports_shared_key(bool value);
+  public:
+
+  // optional bool supports_payload_header_elision = 11;
+  bool has_supports_payload_header_elision() const;
+  private:
+  bool _internal_has_supports_payload_header_elision() const;
+  public:
+  void clear_supports_payload_header_elision();
+  bool supports_payload_header_elision() const;
+  void set_supports_payload_header_elision(bool value);
+  private:
+  bool _internal_supports_payload_header_elision() const;
+  void _internal_set_supports_payload_header_elision(bool value);
+  public:
+
+  // optional bool supports_datagram = 12;
+  bool has_supports_datagram() const;
+  private:
+  bool _internal_has_supports_datagram() const;
+  public:
+  void clear_supports_datagram();
+  bool supports_datagram() const;
+  void set_supports_datagram(bool value);
+  private:
+  bool _internal_supports_datagram() const;
+  void _internal_set_supports_datagram(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.ConnectionResponseFrame)
  private:
   class _Internal;
 
@@ -2452,32 +2500,40 @@ class PayloadTransferFrame_PayloadChunk final :
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
-  int64_t offset_;
-  int32_t flags_;
-  int32_t index_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr handshake_data_;
+  ::location::nearby::connections::OsInfo* os_info_;
+  ::location::nearby::connections::LocationHint* location_hint_;
+  int32_t status_;
+  int response_;
+  int32_t multiplex_socket_bitmask_;
+  int32_t nearby_connections_version_;
+  int32_t safe_to_disconnect_version_;
+  int32_t keep_alive_timeout_millis_;
+  bool supports_shared_key_;
+  bool supports_payload_header_elision_;
+  bool supports_datagram_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PayloadTransferFrame_ControlMessage final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.PayloadTransferFrame.ControlMessage) */ {
+class PayloadTransferFrame_PayloadHeader final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.PayloadTransferFrame.PayloadHeader) */ {
  public:
-  inline PayloadTransferFrame_ControlMessage() : PayloadTransferFrame_ControlMessage(nullptr) {}
-  ~PayloadTransferFrame_ControlMessage() override;
-  explicit constexpr PayloadTransferFrame_ControlMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline PayloadTransferFrame_PayloadHeader() : PayloadTransferFrame_PayloadHeader(nullptr) {}
+  ~PayloadTransferFrame_PayloadHeader() override;
+  explicit constexpr PayloadTransferFrame_PayloadHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  PayloadTransferFrame_ControlMessage(const PayloadTransferFrame_ControlMessage& from);
-  PayloadTransferFrame_ControlMessage(PayloadTransferFrame_ControlMessage&& from) noexcept
-    : PayloadTransferFrame_ControlMessage() {
+  PayloadTransferFrame_PayloadHeader(const PayloadTransferFrame_PayloadHeader& from);
+  PayloadTransferFrame_PayloadHeader(PayloadTransferFrame_PayloadHeader&& from) noexcept
+    : PayloadTransferFrame_PayloadHeader() {
     *this = ::std::move(from);
   }
 
-  inline PayloadTransferFrame_ControlMessage& operator=(const PayloadTransferFrame_ControlMessage& from) {
+  inline PayloadTransferFrame_PayloadHeader& operator=(const PayloadTransferFrame_PayloadHeader& from) {
     CopyFrom(from);
     return *this;
   }
-  inline PayloadTransferFrame_ControlMessage& operator=(PayloadTransferFrame_ControlMessage&& from) noexcept {
+  inline PayloadTransferFrame_PayloadHeader& operator=(PayloadTransferFrame_PayloadHeader&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2498,20 +2554,20 @@ class PayloadTransferFrame_ControlMessage final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const PayloadTransferFrame_ControlMessage& default_instance() {
+  static const PayloadTransferFrame_PayloadHeader& default_instance() {
     return *internal_default_instance();
   }
-  static inline const PayloadTransferFrame_ControlMessage* internal_default_instance() {
-    return reinterpret_cast<const PayloadTransferFrame_ControlMessage*>(
-               &_PayloadTransferFrame_ControlMessage_default_instance_);
+  static inline const PayloadTransferFrame_PayloadHeader* internal_default_instance() {
+    return reinterpret_cast<const PayloadTransferFrame_PayloadHeader*>(
+               &_PayloadTransferFrame_PayloadHeader_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     6;
 
-  friend void swap(PayloadTransferFrame_ControlMessage& a, PayloadTransferFrame_ControlMessage& b) {
+  friend void swap(PayloadTransferFrame_PayloadHeader& a, PayloadTransferFrame_PayloadHeader& b) {
     a.Swap(&b);
   }
-  inline void Swap(PayloadTransferFrame_ControlMessage* other) {
+  inline void Swap(PayloadTransferFrame_PayloadHeader* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2524,7 +2580,7 @@ class PayloadTransferFrame_ControlMessage final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(PayloadTransferFrame_ControlMessage* other) {
+  void UnsafeArenaSwap(PayloadTransferFrame_PayloadHeader* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2532,12 +2588,12 @@ class PayloadTransferFrame_ControlMessage final :
 
   // implements Message ----------------------------------------------
 
-  PayloadTransferFrame_ControlMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<PayloadTransferFrame_ControlMessage>(arena);
+  PayloadTransferFrame_PayloadHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PayloadTransferFrame_PayloadHeader>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const PayloadTransferFrame_ControlMessage& from);
-  void MergeFrom(const PayloadTransferFrame_ControlMessage& from);
+  void CopyFrom(const PayloadTransferFrame_PayloadHeader& from);
+  void MergeFrom(const PayloadTransferFrame_PayloadHeader& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -2551,15 +2607,15 @@ class PayloadTransferFrame_ControlMessage final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(PayloadTransferFrame_ControlMessage* other);
+  void InternalSwap(PayloadTransferFrame_PayloadHeader* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.PayloadTransferFrame.ControlMessage";
+    return "location.nearby.connections.PayloadTransferFrame.PayloadHeader";
   }
   protected:
-  explicit PayloadTransferFrame_ControlMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit PayloadTransferFrame_PayloadHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -2570,101 +2626,188 @@ class PayloadTransferFrame_ControlMessage final :
 
   // nested types ----------------------------------------------------
 
-  typedef PayloadTransferFrame_ControlMessage_EventType EventType;
-  static constexpr EventType UNKNOWN_EVENT_TYPE =
-    PayloadTransferFrame_ControlMessage_EventType_UNKNOWN_EVENT_TYPE;
-  static constexpr EventType PAYLOAD_ERROR =
-    PayloadTransferFrame_ControlMessage_EventType_PAYLOAD_ERROR;
-  static constexpr EventType PAYLOAD_CANCELED =
-    PayloadTransferFrame_ControlMessage_EventType_PAYLOAD_CANCELED;
-  PROTOBUF_DEPRECATED_ENUM static constexpr EventType PAYLOAD_RECEIVED_ACK =
-    PayloadTransferFrame_ControlMessage_EventType_PAYLOAD_RECEIVED_ACK;
-  static inline bool EventType_IsValid(int value) {
-    return PayloadTransferFrame_ControlMessage_EventType_IsValid(value);
+  typedef PayloadTransferFrame_PayloadHeader_PayloadType PayloadType;
+  static constexpr PayloadType UNKNOWN_PAYLOAD_TYPE =
+    PayloadTransferFrame_PayloadHeader_PayloadType_UNKNOWN_PAYLOAD_TYPE;
+  static constexpr PayloadType BYTES =
+    PayloadTransferFrame_PayloadHeader_PayloadType_BYTES;
+  static constexpr PayloadType FILE =
+    PayloadTransferFrame_PayloadHeader_PayloadType_FILE;
+  static constexpr PayloadType STREAM =
+    PayloadTransferFrame_PayloadHeader_PayloadType_STREAM;
+  static constexpr PayloadType DATAGRAM =
+    PayloadTransferFrame_PayloadHeader_PayloadType_DATAGRAM;
+  static inline bool PayloadType_IsValid(int value) {
+    return PayloadTransferFrame_PayloadHeader_PayloadType_IsValid(value);
   }
-  static constexpr EventType EventType_MIN =
-    PayloadTransferFrame_ControlMessage_EventType_EventType_MIN;
-  static constexpr EventType EventType_MAX =
-    PayloadTransferFrame_ControlMessage_EventType_EventType_MAX;
-  static constexpr int EventType_ARRAYSIZE =
-    PayloadTransferFrame_ControlMessage_EventType_EventType_ARRAYSIZE;
+  static constexpr PayloadType PayloadType_MIN =
+    PayloadTransferFrame_PayloadHeader_PayloadType_PayloadType_MIN;
+  static constexpr PayloadType PayloadType_MAX =
+    PayloadTransferFrame_PayloadHeader_PayloadType_PayloadType_MAX;
+  static constexpr int PayloadType_ARRAYSIZE =
+    PayloadTransferFrame_PayloadHeader_PayloadType_PayloadType_ARRAYSIZE;
   template<typename T>
-  static inline const std::string& EventType_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, EventType>::value ||
+  static inline const std::string& PayloadType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, PayloadType>::value ||
       ::std::is_integral<T>::value,
-      "Incorrect type passed to function EventType_Name.");
-    return PayloadTransferFrame_ControlMessage_EventType_Name(enum_t_value);
+      "Incorrect type passed to function PayloadType_Name.");
+    return PayloadTransferFrame_PayloadHeader_PayloadType_Name(enum_t_value);
   }
-  static inline bool EventType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
-      EventType* value) {
-    return PayloadTransferFrame_ControlMessage_EventType_Parse(name, value);
+  static inline bool PayloadType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      PayloadType* value) {
+    return PayloadTransferFrame_PayloadHeader_PayloadType_Parse(name, value);
   }
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kOffsetFieldNumber = 2,
-    kEventFieldNumber = 1,
+    kFileNameFieldNumber = 5,
+    kParentFolderFieldNumber = 6,
+    kIdFieldNumber = 1,
+    kTotalSizeFieldNumber = 3,
+    kTypeFieldNumber = 2,
+    kIsSensitiveFieldNumber = 4,
+    kSequenceNumberFieldNumber = 7,
   };
-  // optional int64 offset = 2;
-  bool has_offset() const;
+  // optional string file_name = 5;
+  bool has_file_name() const;
   private:
-  bool _internal_has_offset() const;
+  bool _internal_has_file_name() const;
   public:
-  void clear_offset();
-  int64_t offset() const;
-  void set_offset(int64_t value);
+  void clear_file_name();
+  const std::string& file_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_file_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_file_name();
+  PROTOBUF_NODISCARD std::string* release_file_name();
+  void set_allocated_file_name(std::string* file_name);
   private:
-  int64_t _internal_offset() const;
-  void _internal_set_offset(int64_t value);
+  const std::string& _internal_file_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_file_name(const std::string& value);
+  std::string* _internal_mutable_file_name();
   public:
 
-  // optional .location.nearby.connections.PayloadTransferFrame.ControlMessage.EventType event = 1;
-  bool has_event() const;
+  // optional string parent_folder = 6;
+  bool has_parent_folder() const;
   private:
-  bool _internal_has_event() const;
+  bool _internal_has_parent_folder() const;
   public:
-  void clear_event();
-  ::location::nearby::connections::PayloadTransferFrame_ControlMessage_EventType event() const;
-  void set_event(::location::nearby::connections::PayloadTransferFrame_ControlMessage_EventType value);
+  void clear_parent_folder();
+  const std::string& parent_folder() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_parent_folder(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_parent_folder();
+  PROTOBUF_NODISCARD std::string* release_parent_folder();
+  void set_allocated_parent_folder(std::string* parent_folder);
   private:
-  ::location::nearby::connections::PayloadTransferFrame_ControlMessage_EventType _internal_event() const;
-  void _internal_set_event(::location::nearby::connections::PayloadTransferFrame_ControlMessage_EventType value);
+  const std::string& _internal_parent_folder() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_parent_folder(const std::string& value);
+  std::string* _internal_mutable_parent_folder();
   public:
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.PayloadTransferFrame.ControlMessage)
- private:
-  class _Internal;
+  // optional int64 id = 1;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  int64_t id() const;
+  void set_id(int64_t value);
+  private:
+  int64_t _internal_id() const;
+  void _internal_set_id(int64_t value);
+  public:
+
+  // optional int64 total_size = 3;
+  bool has_total_size() const;
+  private:
+  bool _internal_has_total_size() const;
+  public:
+  void clear_total_size();
+  int64_t total_size() const;
+  void set_total_size(int64_t value);
+  private:
+  int64_t _internal_total_size() const;
+  void _internal_set_total_size(int64_t value);
+  public:
+
+  // optional .location.nearby.connections.PayloadTransferFrame.PayloadHeader.PayloadType type = 2;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::location::nearby::connections::PayloadTransferFrame_PayloadHeader_PayloadType type() const;
+  void set_type(::location::nearby::connections::PayloadTransferFrame_PayloadHeader_PayloadType value);
+  private:
+  ::location::nearby::connections::PayloadTransferFrame_PayloadHeader_PayloadType _internal_type() const;
+  void _internal_set_type(::location::nearby::connections::PayloadTransferFrame_PayloadHeader_PayloadType value);
+  public:
+
+  // optional bool is_sensitive = 4;
+  bool has_is_sensitive() const;
+  private:
+  bool _internal_has_is_sensitive() const;
+  public:
+  void clear_is_sensitive();
+  bool is_sensitive() const;
+  void set_is_sensitive(bool value);
+  private:
+  bool _internal_is_sensitive() const;
+  void _internal_set_is_sensitive(bool value);
+  public:
+
+  // optional int64 sequence_number = 7;
+  bool has_sequence_number() const;
+  private:
+  bool _internal_has_sequence_number() const;
+  public:
+  void clear_sequence_number();
+  int64_t sequence_number() const;
+  void set_sequence_number(int64_t value);
+  private:
+  int64_t _internal_sequence_number() const;
+  void _internal_set_sequence_number(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.PayloadTransferFrame.PayloadHeader)
+ private:
+  class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  int64_t offset_;
-  int event_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr file_name_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr parent_folder_;
+  int64_t id_;
+  int64_t total_size_;
+  int type_;
+  bool is_sensitive_;
+  int64_t sequence_number_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PayloadTransferFrame final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.PayloadTransferFrame) */ {
+class PayloadTransferFrame_PayloadChunk final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.PayloadTransferFrame.PayloadChunk) */ {
  public:
-  inline PayloadTransferFrame() : PayloadTransferFrame(nullptr) {}
-  ~PayloadTransferFrame() override;
-  explicit constexpr PayloadTransferFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline PayloadTransferFrame_PayloadChunk() : PayloadTransferFrame_PayloadChunk(nullptr) {}
+  ~PayloadTransferFrame_PayloadChunk() override;
+  explicit constexpr PayloadTransferFrame_PayloadChunk(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  PayloadTransferFrame(const PayloadTransferFrame& from);
-  PayloadTransferFrame(PayloadTransferFrame&& from) noexcept
-    : PayloadTransferFrame() {
+  PayloadTransferFrame_PayloadChunk(const PayloadTransferFrame_PayloadChunk& from);
+  PayloadTransferFrame_PayloadChunk(PayloadTransferFrame_PayloadChunk&& from) noexcept
+    : PayloadTransferFrame_PayloadChunk() {
     *this = ::std::move(from);
   }
 
-  inline PayloadTransferFrame& operator=(const PayloadTransferFrame& from) {
+  inline PayloadTransferFrame_PayloadChunk& operator=(const PayloadTransferFrame_PayloadChunk& from) {
     CopyFrom(from);
     return *this;
   }
-  inline PayloadTransferFrame& operator=(PayloadTransferFrame&& from) noexcept {
+  inline PayloadTransferFrame_PayloadChunk& operator=(PayloadTransferFrame_PayloadChunk&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2685,20 +2828,20 @@ class PayloadTransferFrame final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const PayloadTransferFrame& default_instance() {
+  static const PayloadTransferFrame_PayloadChunk& default_instance() {
     return *internal_default_instance();
   }
-  static inline const PayloadTransferFrame* internal_default_instance() {
-    return reinterpret_cast<const PayloadTransferFrame*>(
-               &_PayloadTransferFrame_default_instance_);
+  static inline const PayloadTransferFrame_PayloadChunk* internal_default_instance() {
+    return reinterpret_cast<const PayloadTransferFrame_PayloadChunk*>(
+               &_PayloadTransferFrame_PayloadChunk_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     7;
 
-  friend void swap(PayloadTransferFrame& a, PayloadTransferFrame& b) {
+  friend void swap(PayloadTransferFrame_PayloadChunk& a, PayloadTransferFrame_PayloadChunk& b) {
     a.Swap(&b);
   }
-  inline void Swap(PayloadTransferFrame* other) {
+  inline void Swap(PayloadTransferFrame_PayloadChunk* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2711,7 +2854,7 @@ class PayloadTransferFrame final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(PayloadTransferFrame* other) {
+  void UnsafeArenaSwap(PayloadTransferFrame_PayloadChunk* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2719,12 +2862,12 @@ class PayloadTransferFrame final :
 
   // implements Message ----------------------------------------------
 
-  PayloadTransferFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<PayloadTransferFrame>(arena);
+  PayloadTransferFrame_PayloadChunk* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PayloadTransferFrame_PayloadChunk>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const PayloadTransferFrame& from);
-  void MergeFrom(const PayloadTransferFrame& from);
+  void CopyFrom(const PayloadTransferFrame_PayloadChunk& from);
+  void MergeFrom(const PayloadTransferFrame_PayloadChunk& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -2738,15 +2881,15 @@ class PayloadTransferFrame final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(PayloadTransferFrame* other);
+  void InternalSwap(PayloadTransferFrame_PayloadChunk* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.PayloadTransferFrame";
+    return "location.nearby.connections.PayloadTransferFrame.PayloadChunk";
   }
   protected:
-  explicit PayloadTransferFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit PayloadTransferFrame_PayloadChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -2757,116 +2900,96 @@ class PayloadTransferFrame final :
 
   // nested types ----------------------------------------------------
 
-  typedef PayloadTransferFrame_PayloadHeader PayloadHeader;
-  typedef PayloadTransferFrame_PayloadChunk PayloadChunk;
-  typedef PayloadTransferFrame_ControlMessage ControlMessage;
-
-  typedef PayloadTransferFrame_PacketType PacketType;
-  static constexpr PacketType UNKNOWN_PACKET_TYPE =
-    PayloadTransferFrame_PacketType_UNKNOWN_PACKET_TYPE;
-  static constexpr PacketType DATA =
-    PayloadTransferFrame_PacketType_DATA;
-  static constexpr PacketType CONTROL =
-    PayloadTransferFrame_PacketType_CONTROL;
-  static constexpr PacketType PAYLOAD_ACK =
-    PayloadTransferFrame_PacketType_PAYLOAD_ACK;
-  static inline bool PacketType_IsValid(int value) {
-    return PayloadTransferFrame_PacketType_IsValid(value);
+  typedef PayloadTransferFrame_PayloadChunk_Flags Flags;
+  static constexpr Flags LAST_CHUNK =
+    PayloadTransferFrame_PayloadChunk_Flags_LAST_CHUNK;
+  static inline bool Flags_IsValid(int value) {
+    return PayloadTransferFrame_PayloadChunk_Flags_IsValid(value);
   }
-  static constexpr PacketType PacketType_MIN =
-    PayloadTransferFrame_PacketType_PacketType_MIN;
-  static constexpr PacketType PacketType_MAX =
-    PayloadTransferFrame_PacketType_PacketType_MAX;
-  static constexpr int PacketType_ARRAYSIZE =
-    PayloadTransferFrame_PacketType_PacketType_ARRAYSIZE;
+  static constexpr Flags Flags_MIN =
+    PayloadTransferFrame_PayloadChunk_Flags_Flags_MIN;
+  static constexpr Flags Flags_MAX =
+    PayloadTransferFrame_PayloadChunk_Flags_Flags_MAX;
+  static constexpr int Flags_ARRAYSIZE =
+    PayloadTransferFrame_PayloadChunk_Flags_Flags_ARRAYSIZE;
   template<typename T>
-  static inline const std::string& PacketType_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, PacketType>::value ||
+  static inline const std::string& Flags_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Flags>::value ||
       ::std::is_integral<T>::value,
-      "Incorrect type passed to function PacketType_Name.");
-    return PayloadTransferFrame_PacketType_Name(enum_t_value);
+      "Incorrect type passed to function Flags_Name.");
+    return PayloadTransferFrame_PayloadChunk_Flags_Name(enum_t_value);
   }
-  static inline bool PacketType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
-      PacketType* value) {
-    return PayloadTransferFrame_PacketType_Parse(name, value);
+  static inline bool Flags_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Flags* value) {
+    return PayloadTransferFrame_PayloadChunk_Flags_Parse(name, value);
   }
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kPayloadHeaderFieldNumber = 2,
-    kPayloadChunkFieldNumber = 3,
-    kControlMessageFieldNumber = 4,
-    kPacketTypeFieldNumber = 1,
+    kBodyFieldNumber = 3,
+    kOffsetFieldNumber = 2,
+    kFlagsFieldNumber = 1,
+    kIndexFieldNumber = 4,
   };
-  // optional .location.nearby.connections.PayloadTransferFrame.PayloadHeader payload_header = 2;
-  bool has_payload_header() const;
+  // optional bytes body = 3;
+  bool has_body() const;
   private:
-  bool _internal_has_payload_header() const;
+  bool _internal_has_body() const;
   public:
-  void clear_payload_header();
-  const ::location::nearby::connections::PayloadTransferFrame_PayloadHeader& payload_header() const;
-  PROTOBUF_NODISCARD ::location::nearby::connections::PayloadTransferFrame_PayloadHeader* release_payload_header();
-  ::location::nearby::connections::PayloadTransferFrame_PayloadHeader* mutable_payload_header();
-  void set_allocated_payload_header(::location::nearby::connections::PayloadTransferFrame_PayloadHeader* payload_header);
+  void clear_body();
+  const std::string& body() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_body(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_body();
+  PROTOBUF_NODISCARD std::string* release_body();
+  void set_allocated_body(std::string* body);
   private:
-  const ::location::nearby::connections::PayloadTransferFrame_PayloadHeader& _internal_payload_header() const;
-  ::location::nearby::connections::PayloadTransferFrame_PayloadHeader* _internal_mutable_payload_header();
+  const std::string& _internal_body() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_body(const std::string& value);
+  std::string* _internal_mutable_body();
   public:
-  void unsafe_arena_set_allocated_payload_header(
-      ::location::nearby::connections::PayloadTransferFrame_PayloadHeader* payload_header);
-  ::location::nearby::connections::PayloadTransferFrame_PayloadHeader* unsafe_arena_release_payload_header();
 
-  // optional .location.nearby.connections.PayloadTransferFrame.PayloadChunk payload_chunk = 3;
-  bool has_payload_chunk() const;
+  // optional int64 offset = 2;
+  bool has_offset() const;
   private:
-  bool _internal_has_payload_chunk() const;
+  bool _internal_has_offset() const;
   public:
-  void clear_payload_chunk();
-  const ::location::nearby::connections::PayloadTransferFrame_PayloadChunk& payload_chunk() const;
-  PROTOBUF_NODISCARD ::location::nearby::connections::PayloadTransferFrame_PayloadChunk* release_payload_chunk();
-  ::location::nearby::connections::PayloadTransferFrame_PayloadChunk* mutable_payload_chunk();
-  void set_allocated_payload_chunk(::location::nearby::connections::PayloadTransferFrame_PayloadChunk* payload_chunk);
+  void clear_offset();
+  int64_t offset() const;
+  void set_offset(int64_t value);
   private:
-  const ::location::nearby::connections::PayloadTransferFrame_PayloadChunk& _internal_payload_chunk() const;
-  ::location::nearby::connections::PayloadTransferFrame_PayloadChunk* _internal_mutable_payload_chunk();
+  int64_t _internal_offset() const;
+  void _internal_set_offset(int64_t value);
   public:
-  void unsafe_arena_set_allocated_payload_chunk(
-      ::location::nearby::connections::PayloadTransferFrame_PayloadChunk* payload_chunk);
-  ::location::nearby::connections::PayloadTransferFrame_PayloadChunk* unsafe_arena_release_payload_chunk();
 
-  // optional .location.nearby.connections.PayloadTransferFrame.ControlMessage control_message = 4;
-  bool has_control_message() const;
+  // optional int32 flags = 1;
+  bool has_flags() const;
   private:
-  bool _internal_has_control_message() const;
+  bool _internal_has_flags() const;
   public:
-  void clear_control_message();
-  const ::location::nearby::connections::PayloadTransferFrame_ControlMessage& control_message() const;
-  PROTOBUF_NODISCARD ::location::nearby::connections::PayloadTransferFrame_ControlMessage* release_control_message();
-  ::location::nearby::connections::PayloadTransferFrame_ControlMessage* mutable_control_message();
-  void set_allocated_control_message(::location::nearby::connections::PayloadTransferFrame_ControlMessage* control_message);
+  void clear_flags();
+  int32_t flags() const;
+  void set_flags(int32_t value);
   private:
-  const ::location::nearby::connections::PayloadTransferFrame_ControlMessage& _internal_control_message() const;
-  ::location::nearby::connections::PayloadTransferFrame_ControlMessage* _internal_mutable_control_message();
+  int32_t _internal_flags() const;
+  void _internal_set_flags(int32_t value);
   public:
-  void unsafe_arena_set_allocated_control_message(
-      ::location::nearby::connections::PayloadTransferFrame_ControlMessage* control_message);
-  ::location::nearby::connections::PayloadTransferFrame_ControlMessage* unsafe_arena_release_control_message();
 
-  // optional .location.nearby.connections.PayloadTransferFrame.PacketType packet_type = 1;
-  bool has_packet_type() const;
+  // optional int32 index = 4;
+  bool has_index() const;
   private:
-  bool _internal_has_packet_type() const;
+  bool _internal_has_index() const;
   public:
-  void clear_packet_type();
-  ::location::nearby::connections::PayloadTransferFrame_PacketType packet_type() const;
-  void set_packet_type(::location::nearby::connections::PayloadTransferFrame_PacketType value);
+  void clear_index();
+  int32_t index() const;
+  void set_index(int32_t value);
   private:
-  ::location::nearby::connections::PayloadTransferFrame_PacketType _internal_packet_type() const;
-  void _internal_set_packet_type(::location::nearby::connections::PayloadTransferFrame_PacketType value);
+  int32_t _internal_index() const;
+  void _internal_set_index(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.PayloadTransferFrame)
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.PayloadTransferFrame.PayloadChunk)
  private:
   class _Internal;
 
@@ -2875,32 +2998,32 @@ class PayloadTransferFrame final :
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::location::nearby::connections::PayloadTransferFrame_PayloadHeader* payload_header_;
-  ::location::nearby::connections::PayloadTransferFrame_PayloadChunk* payload_chunk_;
-  ::location::nearby::connections::PayloadTransferFrame_ControlMessage* control_message_;
-  int packet_type_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
+  int64_t offset_;
+  int32_t flags_;
+  int32_t index_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiHotspotCredentials) */ {
+class PayloadTransferFrame_ControlMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.PayloadTransferFrame.ControlMessage) */ {
  public:
-  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials() : BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials(nullptr) {}
-  ~BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials() override;
-  explicit constexpr BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline PayloadTransferFrame_ControlMessage() : PayloadTransferFrame_ControlMessage(nullptr) {}
+  ~PayloadTransferFrame_ControlMessage() override;
+  explicit constexpr PayloadTransferFrame_ControlMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials& from);
-  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials&& from) noexcept
-    : BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials() {
+  PayloadTransferFrame_ControlMessage(const PayloadTransferFrame_ControlMessage& from);
+  PayloadTransferFrame_ControlMessage(PayloadTransferFrame_ControlMessage&& from) noexcept
+    : PayloadTransferFrame_ControlMessage() {
     *this = ::std::move(from);
   }
 
-  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials& operator=(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials& from) {
+  inline PayloadTransferFrame_ControlMessage& operator=(const PayloadTransferFrame_ControlMessage& from) {
     CopyFrom(from);
     return *this;
   }
-  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials& operator=(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials&& from) noexcept {
+  inline PayloadTransferFrame_ControlMessage& operator=(PayloadTransferFrame_ControlMessage&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2921,20 +3044,20 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials fi
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials& default_instance() {
+  static const PayloadTransferFrame_ControlMessage& default_instance() {
     return *internal_default_instance();
   }
-  static inline const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials* internal_default_instance() {
-    return reinterpret_cast<const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials*>(
-               &_BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials_default_instance_);
+  static inline const PayloadTransferFrame_ControlMessage* internal_default_instance() {
+    return reinterpret_cast<const PayloadTransferFrame_ControlMessage*>(
+               &_PayloadTransferFrame_ControlMessage_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     8;
 
-  friend void swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials& a, BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials& b) {
+  friend void swap(PayloadTransferFrame_ControlMessage& a, PayloadTransferFrame_ControlMessage& b) {
     a.Swap(&b);
   }
-  inline void Swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials* other) {
+  inline void Swap(PayloadTransferFrame_ControlMessage* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2947,7 +3070,7 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials fi
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials* other) {
+  void UnsafeArenaSwap(PayloadTransferFrame_ControlMessage* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2955,12 +3078,12 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials fi
 
   // implements Message ----------------------------------------------
 
-  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials>(arena);
+  PayloadTransferFrame_ControlMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PayloadTransferFrame_ControlMessage>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials& from);
-  void MergeFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials& from);
+  void CopyFrom(const PayloadTransferFrame_ControlMessage& from);
+  void MergeFrom(const PayloadTransferFrame_ControlMessage& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -2974,15 +3097,15 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials fi
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials* other);
+  void InternalSwap(PayloadTransferFrame_ControlMessage* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiHotspotCredentials";
+    return "location.nearby.connections.PayloadTransferFrame.ControlMessage";
   }
   protected:
-  explicit BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit PayloadTransferFrame_ControlMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -2993,96 +3116,69 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials fi
 
   // nested types ----------------------------------------------------
 
+  typedef PayloadTransferFrame_ControlMessage_EventType EventType;
+  static constexpr EventType UNKNOWN_EVENT_TYPE =
+    PayloadTransferFrame_ControlMessage_EventType_UNKNOWN_EVENT_TYPE;
+  static constexpr EventType PAYLOAD_ERROR =
+    PayloadTransferFrame_ControlMessage_EventType_PAYLOAD_ERROR;
+  static constexpr EventType PAYLOAD_CANCELED =
+    PayloadTransferFrame_ControlMessage_EventType_PAYLOAD_CANCELED;
+  PROTOBUF_DEPRECATED_ENUM static constexpr EventType PAYLOAD_RECEIVED_ACK =
+    PayloadTransferFrame_ControlMessage_EventType_PAYLOAD_RECEIVED_ACK;
+  static inline bool EventType_IsValid(int value) {
+    return PayloadTransferFrame_ControlMessage_EventType_IsValid(value);
+  }
+  static constexpr EventType EventType_MIN =
+    PayloadTransferFrame_ControlMessage_EventType_EventType_MIN;
+  static constexpr EventType EventType_MAX =
+    PayloadTransferFrame_ControlMessage_EventType_EventType_MAX;
+  static constexpr int EventType_ARRAYSIZE =
+    PayloadTransferFrame_ControlMessage_EventType_EventType_ARRAYSIZE;
+  template<typename T>
+  static inline const std::string& EventType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, EventType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function EventType_Name.");
+    return PayloadTransferFrame_ControlMessage_EventType_Name(enum_t_value);
+  }
+  static inline bool EventType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      EventType* value) {
+    return PayloadTransferFrame_ControlMessage_EventType_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
   enum : int {
-    kSsidFieldNumber = 1,
-    kPasswordFieldNumber = 2,
-    kGatewayFieldNumber = 4,
-    kPortFieldNumber = 3,
-    kFrequencyFieldNumber = 5,
+    kOffsetFieldNumber = 2,
+    kEventFieldNumber = 1,
   };
-  // optional string ssid = 1;
-  bool has_ssid() const;
-  private:
-  bool _internal_has_ssid() const;
-  public:
-  void clear_ssid();
-  const std::string& ssid() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_ssid(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_ssid();
-  PROTOBUF_NODISCARD std::string* release_ssid();
-  void set_allocated_ssid(std::string* ssid);
-  private:
-  const std::string& _internal_ssid() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ssid(const std::string& value);
-  std::string* _internal_mutable_ssid();
-  public:
-
-  // optional string password = 2;
-  bool has_password() const;
-  private:
-  bool _internal_has_password() const;
-  public:
-  void clear_password();
-  const std::string& password() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_password(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_password();
-  PROTOBUF_NODISCARD std::string* release_password();
-  void set_allocated_password(std::string* password);
-  private:
-  const std::string& _internal_password() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_password(const std::string& value);
-  std::string* _internal_mutable_password();
-  public:
-
-  // optional string gateway = 4 [default = "0.0.0.0"];
-  bool has_gateway() const;
-  private:
-  bool _internal_has_gateway() const;
-  public:
-  void clear_gateway();
-  const std::string& gateway() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_gateway(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_gateway();
-  PROTOBUF_NODISCARD std::string* release_gateway();
-  void set_allocated_gateway(std::string* gateway);
-  private:
-  const std::string& _internal_gateway() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_gateway(const std::string& value);
-  std::string* _internal_mutable_gateway();
-  public:
-
-  // optional int32 port = 3;
-  bool has_port() const;
+  // optional int64 offset = 2;
+  bool has_offset() const;
   private:
-  bool _internal_has_port() const;
+  bool _internal_has_offset() const;
   public:
-  void clear_port();
-  int32_t port() const;
-  void set_port(int32_t value);
+  void clear_offset();
+  int64_t offset() const;
+  void set_offset(int64_t value);
   private:
-  int32_t _internal_port() const;
-  void _internal_set_port(int32_t value);
+  int64_t _internal_offset() const;
+  void _internal_set_offset(int64_t value);
   public:
 
-  // optional int32 frequency = 5 [default = -1];
-  bool has_frequency() const;
+  // optional .location.nearby.connections.PayloadTransferFrame.ControlMessage.EventType event = 1;
+  bool has_event() const;
   private:
-  bool _internal_has_frequency() const;
+  bool _internal_has_event() const;
   public:
-  void clear_frequency();
-  int32_t frequency() const;
-  void set_frequency(int32_t value);
+  void clear_event();
+  ::location::nearby::connections::PayloadTransferFrame_ControlMessage_EventType event() const;
+  void set_event(::location::nearby::connections::PayloadTransferFrame_ControlMessage_EventType value);
   private:
-  int32_t _internal_frequency() const;
-  void _internal_set_frequency(int32_t value);
+  ::location::nearby::connections::PayloadTransferFrame_ControlMessage_EventType _internal_event() const;
+  void _internal_set_event(::location::nearby::connections::PayloadTransferFrame_ControlMessage_EventType value);
   public:
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiHotspotCredentials)
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.PayloadTransferFrame.ControlMessage)
  private:
   class _Internal;
 
@@ -3091,34 +3187,30 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials fi
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ssid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr password_;
-  static const ::PROTOBUF_NAMESPACE_ID::internal::LazyString _i_give_permission_to_break_this_code_default_gateway_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr gateway_;
-  int32_t port_;
-  int32_t frequency_;
+  int64_t offset_;
+  int event_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiLanSocket) */ {
+class PayloadTransferFrame final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.PayloadTransferFrame) */ {
  public:
-  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket() : BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket(nullptr) {}
-  ~BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket() override;
-  explicit constexpr BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline PayloadTransferFrame() : PayloadTransferFrame(nullptr) {}
+  ~PayloadTransferFrame() override;
+  explicit constexpr PayloadTransferFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket& from);
-  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket&& from) noexcept
-    : BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket() {
+  PayloadTransferFrame(const PayloadTransferFrame& from);
+  PayloadTransferFrame(PayloadTransferFrame&& from) noexcept
+    : PayloadTransferFrame() {
     *this = ::std::move(from);
   }
 
-  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket& operator=(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket& from) {
+  inline PayloadTransferFrame& operator=(const PayloadTransferFrame& from) {
     CopyFrom(from);
     return *this;
   }
-  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket& operator=(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket&& from) noexcept {
+  inline PayloadTransferFrame& operator=(PayloadTransferFrame&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -3139,20 +3231,20 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket& default_instance() {
+  static const PayloadTransferFrame& default_instance() {
     return *internal_default_instance();
   }
-  static inline const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket* internal_default_instance() {
-    return reinterpret_cast<const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket*>(
-               &_BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket_default_instance_);
+  static inline const PayloadTransferFrame* internal_default_instance() {
+    return reinterpret_cast<const PayloadTransferFrame*>(
+               &_PayloadTransferFrame_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     9;
 
-  friend void swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket& a, BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket& b) {
+  friend void swap(PayloadTransferFrame& a, PayloadTransferFrame& b) {
     a.Swap(&b);
   }
-  inline void Swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket* other) {
+  inline void Swap(PayloadTransferFrame* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -3165,7 +3257,7 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket* other) {
+  void UnsafeArenaSwap(PayloadTransferFrame* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -3173,12 +3265,12 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket final :
 
   // implements Message ----------------------------------------------
 
-  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket>(arena);
+  PayloadTransferFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PayloadTransferFrame>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket& from);
-  void MergeFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket& from);
+  void CopyFrom(const PayloadTransferFrame& from);
+  void MergeFrom(const PayloadTransferFrame& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -3192,15 +3284,15 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket* other);
+  void InternalSwap(PayloadTransferFrame* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiLanSocket";
+    return "location.nearby.connections.PayloadTransferFrame";
   }
   protected:
-  explicit BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit PayloadTransferFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -3211,44 +3303,116 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket final :
 
   // nested types ----------------------------------------------------
 
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kIpAddressFieldNumber = 1,
-    kWifiPortFieldNumber = 2,
-  };
-  // optional bytes ip_address = 1;
-  bool has_ip_address() const;
-  private:
-  bool _internal_has_ip_address() const;
-  public:
-  void clear_ip_address();
-  const std::string& ip_address() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_ip_address(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_ip_address();
-  PROTOBUF_NODISCARD std::string* release_ip_address();
-  void set_allocated_ip_address(std::string* ip_address);
-  private:
-  const std::string& _internal_ip_address() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip_address(const std::string& value);
-  std::string* _internal_mutable_ip_address();
-  public:
+  typedef PayloadTransferFrame_PayloadHeader PayloadHeader;
+  typedef PayloadTransferFrame_PayloadChunk PayloadChunk;
+  typedef PayloadTransferFrame_ControlMessage ControlMessage;
 
-  // optional int32 wifi_port = 2;
-  bool has_wifi_port() const;
-  private:
-  bool _internal_has_wifi_port() const;
-  public:
-  void clear_wifi_port();
-  int32_t wifi_port() const;
-  void set_wifi_port(int32_t value);
+  typedef PayloadTransferFrame_PacketType PacketType;
+  static constexpr PacketType UNKNOWN_PACKET_TYPE =
+    PayloadTransferFrame_PacketType_UNKNOWN_PACKET_TYPE;
+  static constexpr PacketType DATA =
+    PayloadTransferFrame_PacketType_DATA;
+  static constexpr PacketType CONTROL =
+    PayloadTransferFrame_PacketType_CONTROL;
+  static constexpr PacketType PAYLOAD_ACK =
+    PayloadTransferFrame_PacketType_PAYLOAD_ACK;
+  static inline bool PacketType_IsValid(int value) {
+    return PayloadTransferFrame_PacketType_IsValid(value);
+  }
+  static constexpr PacketType PacketType_MIN =
+    PayloadTransferFrame_PacketType_PacketType_MIN;
+  static constexpr PacketType PacketType_MAX =
+    PayloadTransferFrame_PacketType_PacketType_MAX;
+  static constexpr int PacketType_ARRAYSIZE =
+    PayloadTransferFrame_PacketType_PacketType_ARRAYSIZE;
+  template<typename T>
+  static inline const std::string& PacketType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, PacketType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function PacketType_Name.");
+    return PayloadTransferFrame_PacketType_Name(enum_t_value);
+  }
+  static inline bool PacketType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      PacketType* value) {
+    return PayloadTransferFrame_PacketType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPayloadHeaderFieldNumber = 2,
+    kPayloadChunkFieldNumber = 3,
+    kControlMessageFieldNumber = 4,
+    kPacketTypeFieldNumber = 1,
+  };
+  // optional .location.nearby.connections.PayloadTransferFrame.PayloadHeader payload_header = 2;
+  bool has_payload_header() const;
   private:
-  int32_t _internal_wifi_port() const;
-  void _internal_set_wifi_port(int32_t value);
+  bool _internal_has_payload_header() const;
+  public:
+  void clear_payload_header();
+  const ::location::nearby::connections::PayloadTransferFrame_PayloadHeader& payload_header() const;
+  PROTOBUF_NODISCARD ::location::nearby::connections::PayloadTransferFrame_PayloadHeader* release_payload_header();
+  ::location::nearby::connections::PayloadTransferFrame_PayloadHeader* mutable_payload_header();
+  void set_allocated_payload_header(::location::nearby::connections::PayloadTransferFrame_PayloadHeader* payload_header);
+  private:
+  const ::location::nearby::connections::PayloadTransferFrame_PayloadHeader& _internal_payload_header() const;
+  ::location::nearby::connections::PayloadTransferFrame_PayloadHeader* _internal_mutable_payload_header();
   public:
+  void unsafe_arena_set_allocated_payload_header(
+      ::location::nearby::connections::PayloadTransferFrame_PayloadHeader* payload_header);
+  ::location::nearby::connections::PayloadTransferFrame_PayloadHeader* unsafe_arena_release_payload_header();
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiLanSocket)
+  // optional .location.nearby.connections.PayloadTransferFrame.PayloadChunk payload_chunk = 3;
+  bool has_payload_chunk() const;
+  private:
+  bool _internal_has_payload_chunk() const;
+  public:
+  void clear_payload_chunk();
+  const ::location::nearby::connections::PayloadTransferFrame_PayloadChunk& payload_chunk() const;
+  PROTOBUF_NODISCARD ::location::nearby::connections::PayloadTransferFrame_PayloadChunk* release_payload_chunk();
+  ::location::nearby::connections::PayloadTransferFrame_PayloadChunk* mutable_payload_chunk();
+  void set_allocated_payload_chunk(::location::nearby::connections::PayloadTransferFrame_PayloadChunk* payload_chunk);
+  private:
+  const ::location::nearby::connections::PayloadTransferFrame_PayloadChunk& _internal_payload_chunk() const;
+  ::location::nearby::connections::PayloadTransferFrame_PayloadChunk* _internal_mutable_payload_chunk();
+  public:
+  void unsafe_arena_set_allocated_payload_chunk(
+      ::location::nearby::connections::PayloadTransferFrame_PayloadChunk* payload_chunk);
+  ::location::nearby::connections::PayloadTransferFrame_PayloadChunk* unsafe_arena_release_payload_chunk();
+
+  // optional .location.nearby.connections.PayloadTransferFrame.ControlMessage control_message = 4;
+  bool has_control_message() const;
+  private:
+  bool _internal_has_control_message() const;
+  public:
+  void clear_control_message();
+  const ::location::nearby::connections::PayloadTransferFrame_ControlMessage& control_message() const;
+  PROTOBUF_NODISCARD ::location::nearby::connections::PayloadTransferFrame_ControlMessage* release_control_message();
+  ::location::nearby::connections::PayloadTransferFrame_ControlMessage* mutable_control_message();
+  void set_allocated_control_message(::location::nearby::connections::PayloadTransferFrame_ControlMessage* control_message);
+  private:
+  const ::location::nearby::connections::PayloadTransferFrame_ControlMessage& _internal_control_message() const;
+  ::location::nearby::connections::PayloadTransferFrame_ControlMessage* _internal_mutable_control_message();
+  public:
+  void unsafe_arena_set_allocated_control_message(
+      ::location::nearby::connections::PayloadTransferFrame_ControlMessage* control_message);
+  ::location::nearby::connections::PayloadTransferFrame_ControlMessage* unsafe_arena_release_control_message();
+
+  // optional .location.nearby.connections.PayloadTransferFrame.PacketType packet_type = 1;
+  bool has_packet_type() const;
+  private:
+  bool _internal_has_packet_type() const;
+  public:
+  void clear_packet_type();
+  ::location::nearby::connections::PayloadTransferFrame_PacketType packet_type() const;
+  void set_packet_type(::location::nearby::connections::PayloadTransferFrame_PacketType value);
+  private:
+  ::location::nearby::connections::PayloadTransferFrame_PacketType _internal_packet_type() const;
+  void _internal_set_packet_type(::location::nearby::connections::PayloadTransferFrame_PacketType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.PayloadTransferFrame)
  private:
   class _Internal;
 
@@ -3257,30 +3421,32 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket final :
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_address_;
-  int32_t wifi_port_;
+  ::location::nearby::connections::PayloadTransferFrame_PayloadHeader* payload_header_;
+  ::location::nearby::connections::PayloadTransferFrame_PayloadChunk* payload_chunk_;
+  ::location::nearby::connections::PayloadTransferFrame_ControlMessage* control_message_;
+  int packet_type_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.BluetoothCredentials) */ {
+class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiHotspotCredentials) */ {
  public:
-  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials() : BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials(nullptr) {}
-  ~BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials() override;
-  explicit constexpr BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials() : BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials(nullptr) {}
+  ~BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials() override;
+  explicit constexpr BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials& from);
-  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials&& from) noexcept
-    : BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials() {
+  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials& from);
+  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials&& from) noexcept
+    : BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials() {
     *this = ::std::move(from);
   }
 
-  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials& operator=(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials& from) {
+  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials& operator=(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials& from) {
     CopyFrom(from);
     return *this;
   }
-  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials& operator=(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials&& from) noexcept {
+  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials& operator=(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -3301,20 +3467,20 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials fina
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials& default_instance() {
+  static const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials& default_instance() {
     return *internal_default_instance();
   }
-  static inline const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials* internal_default_instance() {
-    return reinterpret_cast<const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials*>(
-               &_BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials_default_instance_);
+  static inline const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials* internal_default_instance() {
+    return reinterpret_cast<const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials*>(
+               &_BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     10;
 
-  friend void swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials& a, BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials& b) {
+  friend void swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials& a, BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials& b) {
     a.Swap(&b);
   }
-  inline void Swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials* other) {
+  inline void Swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -3327,7 +3493,7 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials fina
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials* other) {
+  void UnsafeArenaSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -3335,12 +3501,12 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials fina
 
   // implements Message ----------------------------------------------
 
-  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials>(arena);
+  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials& from);
-  void MergeFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials& from);
+  void CopyFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials& from);
+  void MergeFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -3354,15 +3520,15 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials fina
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials* other);
+  void InternalSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.BluetoothCredentials";
+    return "location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiHotspotCredentials";
   }
   protected:
-  explicit BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -3376,78 +3542,129 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials fina
   // accessors -------------------------------------------------------
 
   enum : int {
-    kServiceNameFieldNumber = 1,
-    kMacAddressFieldNumber = 2,
+    kSsidFieldNumber = 1,
+    kPasswordFieldNumber = 2,
+    kGatewayFieldNumber = 4,
+    kPortFieldNumber = 3,
+    kFrequencyFieldNumber = 5,
   };
-  // optional string service_name = 1;
-  bool has_service_name() const;
+  // optional string ssid = 1;
+  bool has_ssid() const;
   private:
-  bool _internal_has_service_name() const;
+  bool _internal_has_ssid() const;
   public:
-  void clear_service_name();
-  const std::string& service_name() const;
+  void clear_ssid();
+  const std::string& ssid() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_service_name(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_service_name();
-  PROTOBUF_NODISCARD std::string* release_service_name();
-  void set_allocated_service_name(std::string* service_name);
+  void set_ssid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ssid();
+  PROTOBUF_NODISCARD std::string* release_ssid();
+  void set_allocated_ssid(std::string* ssid);
   private:
-  const std::string& _internal_service_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_service_name(const std::string& value);
-  std::string* _internal_mutable_service_name();
+  const std::string& _internal_ssid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ssid(const std::string& value);
+  std::string* _internal_mutable_ssid();
   public:
 
-  // optional string mac_address = 2;
-  bool has_mac_address() const;
+  // optional string password = 2;
+  bool has_password() const;
   private:
-  bool _internal_has_mac_address() const;
+  bool _internal_has_password() const;
   public:
-  void clear_mac_address();
-  const std::string& mac_address() const;
+  void clear_password();
+  const std::string& password() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_mac_address(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_mac_address();
-  PROTOBUF_NODISCARD std::string* release_mac_address();
-  void set_allocated_mac_address(std::string* mac_address);
+  void set_password(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_password();
+  PROTOBUF_NODISCARD std::string* release_password();
+  void set_allocated_password(std::string* password);
   private:
-  const std::string& _internal_mac_address() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_mac_address(const std::string& value);
-  std::string* _internal_mutable_mac_address();
+  const std::string& _internal_password() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_password(const std::string& value);
+  std::string* _internal_mutable_password();
   public:
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.BluetoothCredentials)
- private:
-  class _Internal;
-
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr mac_address_;
-  friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
-};
-// -------------------------------------------------------------------
-
-class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiAwareCredentials) */ {
- public:
-  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials() : BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials(nullptr) {}
-  ~BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials() override;
-  explicit constexpr BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  // optional string gateway = 4 [default = "0.0.0.0"];
+  bool has_gateway() const;
+  private:
+  bool _internal_has_gateway() const;
+  public:
+  void clear_gateway();
+  const std::string& gateway() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_gateway(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_gateway();
+  PROTOBUF_NODISCARD std::string* release_gateway();
+  void set_allocated_gateway(std::string* gateway);
+  private:
+  const std::string& _internal_gateway() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_gateway(const std::string& value);
+  std::string* _internal_mutable_gateway();
+  public:
 
-  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials& from);
-  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials&& from) noexcept
-    : BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials() {
+  // optional int32 port = 3;
+  bool has_port() const;
+  private:
+  bool _internal_has_port() const;
+  public:
+  void clear_port();
+  int32_t port() const;
+  void set_port(int32_t value);
+  private:
+  int32_t _internal_port() const;
+  void _internal_set_port(int32_t value);
+  public:
+
+  // optional int32 frequency = 5 [default = -1];
+  bool has_frequency() const;
+  private:
+  bool _internal_has_frequency() const;
+  public:
+  void clear_frequency();
+  int32_t frequency() const;
+  void set_frequency(int32_t value);
+  private:
+  int32_t _internal_frequency() const;
+  void _internal_set_frequency(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiHotspotCredentials)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ssid_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr password_;
+  static const ::PROTOBUF_NAMESPACE_ID::internal::LazyString _i_give_permission_to_break_this_code_default_gateway_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr gateway_;
+  int32_t port_;
+  int32_t frequency_;
+  friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiLanSocket) */ {
+ public:
+  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket() : BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket(nullptr) {}
+  ~BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket() override;
+  explicit constexpr BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket& from);
+  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket&& from) noexcept
+    : BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket() {
     *this = ::std::move(from);
   }
 
-  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials& operator=(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials& from) {
+  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket& operator=(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket& from) {
     CopyFrom(from);
     return *this;
   }
-  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials& operator=(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials&& from) noexcept {
+  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket& operator=(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -3468,20 +3685,20 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials fina
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials& default_instance() {
+  static const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket& default_instance() {
     return *internal_default_instance();
   }
-  static inline const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials* internal_default_instance() {
-    return reinterpret_cast<const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials*>(
-               &_BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials_default_instance_);
+  static inline const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket* internal_default_instance() {
+    return reinterpret_cast<const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket*>(
+               &_BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     11;
 
-  friend void swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials& a, BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials& b) {
+  friend void swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket& a, BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket& b) {
     a.Swap(&b);
   }
-  inline void Swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials* other) {
+  inline void Swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -3494,7 +3711,7 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials fina
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials* other) {
+  void UnsafeArenaSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -3502,12 +3719,12 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials fina
 
   // implements Message ----------------------------------------------
 
-  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials>(arena);
+  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials& from);
-  void MergeFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials& from);
+  void CopyFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket& from);
+  void MergeFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -3521,15 +3738,15 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials fina
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials* other);
+  void InternalSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiAwareCredentials";
+    return "location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiLanSocket";
   }
   protected:
-  explicit BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -3543,65 +3760,41 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials fina
   // accessors -------------------------------------------------------
 
   enum : int {
-    kServiceIdFieldNumber = 1,
-    kServiceInfoFieldNumber = 2,
-    kPasswordFieldNumber = 3,
+    kIpAddressFieldNumber = 1,
+    kWifiPortFieldNumber = 2,
   };
-  // optional string service_id = 1;
-  bool has_service_id() const;
-  private:
-  bool _internal_has_service_id() const;
-  public:
-  void clear_service_id();
-  const std::string& service_id() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_service_id(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_service_id();
-  PROTOBUF_NODISCARD std::string* release_service_id();
-  void set_allocated_service_id(std::string* service_id);
-  private:
-  const std::string& _internal_service_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_service_id(const std::string& value);
-  std::string* _internal_mutable_service_id();
-  public:
-
-  // optional bytes service_info = 2;
-  bool has_service_info() const;
+  // optional bytes ip_address = 1;
+  bool has_ip_address() const;
   private:
-  bool _internal_has_service_info() const;
+  bool _internal_has_ip_address() const;
   public:
-  void clear_service_info();
-  const std::string& service_info() const;
+  void clear_ip_address();
+  const std::string& ip_address() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_service_info(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_service_info();
-  PROTOBUF_NODISCARD std::string* release_service_info();
-  void set_allocated_service_info(std::string* service_info);
+  void set_ip_address(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ip_address();
+  PROTOBUF_NODISCARD std::string* release_ip_address();
+  void set_allocated_ip_address(std::string* ip_address);
   private:
-  const std::string& _internal_service_info() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_service_info(const std::string& value);
-  std::string* _internal_mutable_service_info();
+  const std::string& _internal_ip_address() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip_address(const std::string& value);
+  std::string* _internal_mutable_ip_address();
   public:
 
-  // optional string password = 3;
-  bool has_password() const;
+  // optional int32 wifi_port = 2;
+  bool has_wifi_port() const;
   private:
-  bool _internal_has_password() const;
+  bool _internal_has_wifi_port() const;
   public:
-  void clear_password();
-  const std::string& password() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_password(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_password();
-  PROTOBUF_NODISCARD std::string* release_password();
-  void set_allocated_password(std::string* password);
+  void clear_wifi_port();
+  int32_t wifi_port() const;
+  void set_wifi_port(int32_t value);
   private:
-  const std::string& _internal_password() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_password(const std::string& value);
-  std::string* _internal_mutable_password();
+  int32_t _internal_wifi_port() const;
+  void _internal_set_wifi_port(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiAwareCredentials)
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiLanSocket)
  private:
   class _Internal;
 
@@ -3610,31 +3803,30 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials fina
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_id_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_info_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr password_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_address_;
+  int32_t wifi_port_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiDirectCredentials) */ {
+class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.BluetoothCredentials) */ {
  public:
-  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials() : BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials(nullptr) {}
-  ~BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials() override;
-  explicit constexpr BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials() : BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials(nullptr) {}
+  ~BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials() override;
+  explicit constexpr BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials& from);
-  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials&& from) noexcept
-    : BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials() {
+  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials& from);
+  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials&& from) noexcept
+    : BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials() {
     *this = ::std::move(from);
   }
 
-  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials& operator=(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials& from) {
+  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials& operator=(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials& from) {
     CopyFrom(from);
     return *this;
   }
-  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials& operator=(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials&& from) noexcept {
+  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials& operator=(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -3655,20 +3847,20 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials fin
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials& default_instance() {
+  static const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials& default_instance() {
     return *internal_default_instance();
   }
-  static inline const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials* internal_default_instance() {
-    return reinterpret_cast<const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials*>(
-               &_BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials_default_instance_);
+  static inline const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials* internal_default_instance() {
+    return reinterpret_cast<const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials*>(
+               &_BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     12;
 
-  friend void swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials& a, BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials& b) {
+  friend void swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials& a, BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials& b) {
     a.Swap(&b);
   }
-  inline void Swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials* other) {
+  inline void Swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -3681,7 +3873,7 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials fin
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials* other) {
+  void UnsafeArenaSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -3689,12 +3881,12 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials fin
 
   // implements Message ----------------------------------------------
 
-  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials>(arena);
+  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials& from);
-  void MergeFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials& from);
+  void CopyFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials& from);
+  void MergeFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -3708,15 +3900,15 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials fin
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials* other);
+  void InternalSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiDirectCredentials";
+    return "location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.BluetoothCredentials";
   }
   protected:
-  explicit BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -3730,112 +3922,46 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials fin
   // accessors -------------------------------------------------------
 
   enum : int {
-    kSsidFieldNumber = 1,
-    kPasswordFieldNumber = 2,
-    kGatewayFieldNumber = 5,
-    kIpV6AddressFieldNumber = 6,
-    kPortFieldNumber = 3,
-    kFrequencyFieldNumber = 4,
+    kServiceNameFieldNumber = 1,
+    kMacAddressFieldNumber = 2,
   };
-  // optional string ssid = 1;
-  bool has_ssid() const;
+  // optional string service_name = 1;
+  bool has_service_name() const;
   private:
-  bool _internal_has_ssid() const;
+  bool _internal_has_service_name() const;
   public:
-  void clear_ssid();
-  const std::string& ssid() const;
+  void clear_service_name();
+  const std::string& service_name() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_ssid(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_ssid();
-  PROTOBUF_NODISCARD std::string* release_ssid();
-  void set_allocated_ssid(std::string* ssid);
+  void set_service_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_service_name();
+  PROTOBUF_NODISCARD std::string* release_service_name();
+  void set_allocated_service_name(std::string* service_name);
   private:
-  const std::string& _internal_ssid() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ssid(const std::string& value);
-  std::string* _internal_mutable_ssid();
+  const std::string& _internal_service_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_service_name(const std::string& value);
+  std::string* _internal_mutable_service_name();
   public:
 
-  // optional string password = 2;
-  bool has_password() const;
+  // optional string mac_address = 2;
+  bool has_mac_address() const;
   private:
-  bool _internal_has_password() const;
+  bool _internal_has_mac_address() const;
   public:
-  void clear_password();
-  const std::string& password() const;
+  void clear_mac_address();
+  const std::string& mac_address() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_password(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_password();
-  PROTOBUF_NODISCARD std::string* release_password();
-  void set_allocated_password(std::string* password);
-  private:
-  const std::string& _internal_password() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_password(const std::string& value);
-  std::string* _internal_mutable_password();
-  public:
-
-  // optional string gateway = 5 [default = "0.0.0.0"];
-  bool has_gateway() const;
-  private:
-  bool _internal_has_gateway() const;
-  public:
-  void clear_gateway();
-  const std::string& gateway() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_gateway(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_gateway();
-  PROTOBUF_NODISCARD std::string* release_gateway();
-  void set_allocated_gateway(std::string* gateway);
-  private:
-  const std::string& _internal_gateway() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_gateway(const std::string& value);
-  std::string* _internal_mutable_gateway();
-  public:
-
-  // optional bytes ip_v6_address = 6;
-  bool has_ip_v6_address() const;
-  private:
-  bool _internal_has_ip_v6_address() const;
-  public:
-  void clear_ip_v6_address();
-  const std::string& ip_v6_address() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_ip_v6_address(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_ip_v6_address();
-  PROTOBUF_NODISCARD std::string* release_ip_v6_address();
-  void set_allocated_ip_v6_address(std::string* ip_v6_address);
-  private:
-  const std::string& _internal_ip_v6_address() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip_v6_address(const std::string& value);
-  std::string* _internal_mutable_ip_v6_address();
-  public:
-
-  // optional int32 port = 3;
-  bool has_port() const;
-  private:
-  bool _internal_has_port() const;
-  public:
-  void clear_port();
-  int32_t port() const;
-  void set_port(int32_t value);
-  private:
-  int32_t _internal_port() const;
-  void _internal_set_port(int32_t value);
-  public:
-
-  // optional int32 frequency = 4;
-  bool has_frequency() const;
-  private:
-  bool _internal_has_frequency() const;
-  public:
-  void clear_frequency();
-  int32_t frequency() const;
-  void set_frequency(int32_t value);
+  void set_mac_address(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_mac_address();
+  PROTOBUF_NODISCARD std::string* release_mac_address();
+  void set_allocated_mac_address(std::string* mac_address);
   private:
-  int32_t _internal_frequency() const;
-  void _internal_set_frequency(int32_t value);
+  const std::string& _internal_mac_address() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_mac_address(const std::string& value);
+  std::string* _internal_mutable_mac_address();
   public:
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiDirectCredentials)
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.BluetoothCredentials)
  private:
   class _Internal;
 
@@ -3844,35 +3970,30 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials fin
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ssid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr password_;
-  static const ::PROTOBUF_NAMESPACE_ID::internal::LazyString _i_give_permission_to_break_this_code_default_gateway_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr gateway_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_v6_address_;
-  int32_t port_;
-  int32_t frequency_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_name_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr mac_address_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WebRtcCredentials) */ {
+class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiAwareCredentials) */ {
  public:
-  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials() : BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials(nullptr) {}
-  ~BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials() override;
-  explicit constexpr BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials() : BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials(nullptr) {}
+  ~BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials() override;
+  explicit constexpr BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials& from);
-  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials&& from) noexcept
-    : BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials() {
+  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials& from);
+  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials&& from) noexcept
+    : BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials() {
     *this = ::std::move(from);
   }
 
-  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials& operator=(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials& from) {
+  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials& operator=(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials& from) {
     CopyFrom(from);
     return *this;
   }
-  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials& operator=(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials&& from) noexcept {
+  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials& operator=(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -3893,20 +4014,20 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials& default_instance() {
+  static const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials& default_instance() {
     return *internal_default_instance();
   }
-  static inline const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials* internal_default_instance() {
-    return reinterpret_cast<const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials*>(
-               &_BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials_default_instance_);
+  static inline const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials* internal_default_instance() {
+    return reinterpret_cast<const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials*>(
+               &_BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     13;
 
-  friend void swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials& a, BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials& b) {
+  friend void swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials& a, BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials& b) {
     a.Swap(&b);
   }
-  inline void Swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials* other) {
+  inline void Swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -3919,7 +4040,7 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials* other) {
+  void UnsafeArenaSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -3927,12 +4048,12 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials final :
 
   // implements Message ----------------------------------------------
 
-  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials>(arena);
+  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials& from);
-  void MergeFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials& from);
+  void CopyFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials& from);
+  void MergeFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -3946,15 +4067,15 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials* other);
+  void InternalSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WebRtcCredentials";
+    return "location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiAwareCredentials";
   }
   protected:
-  explicit BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -3968,46 +4089,65 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kPeerIdFieldNumber = 1,
-    kLocationHintFieldNumber = 2,
+    kServiceIdFieldNumber = 1,
+    kServiceInfoFieldNumber = 2,
+    kPasswordFieldNumber = 3,
   };
-  // optional string peer_id = 1;
-  bool has_peer_id() const;
+  // optional string service_id = 1;
+  bool has_service_id() const;
   private:
-  bool _internal_has_peer_id() const;
+  bool _internal_has_service_id() const;
   public:
-  void clear_peer_id();
-  const std::string& peer_id() const;
+  void clear_service_id();
+  const std::string& service_id() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_peer_id(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_peer_id();
-  PROTOBUF_NODISCARD std::string* release_peer_id();
-  void set_allocated_peer_id(std::string* peer_id);
+  void set_service_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_service_id();
+  PROTOBUF_NODISCARD std::string* release_service_id();
+  void set_allocated_service_id(std::string* service_id);
   private:
-  const std::string& _internal_peer_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_peer_id(const std::string& value);
-  std::string* _internal_mutable_peer_id();
+  const std::string& _internal_service_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_service_id(const std::string& value);
+  std::string* _internal_mutable_service_id();
   public:
 
-  // optional .location.nearby.connections.LocationHint location_hint = 2;
-  bool has_location_hint() const;
+  // optional bytes service_info = 2;
+  bool has_service_info() const;
   private:
-  bool _internal_has_location_hint() const;
+  bool _internal_has_service_info() const;
   public:
-  void clear_location_hint();
-  const ::location::nearby::connections::LocationHint& location_hint() const;
-  PROTOBUF_NODISCARD ::location::nearby::connections::LocationHint* release_location_hint();
-  ::location::nearby::connections::LocationHint* mutable_location_hint();
-  void set_allocated_location_hint(::location::nearby::connections::LocationHint* location_hint);
+  void clear_service_info();
+  const std::string& service_info() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_service_info(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_service_info();
+  PROTOBUF_NODISCARD std::string* release_service_info();
+  void set_allocated_service_info(std::string* service_info);
   private:
-  const ::location::nearby::connections::LocationHint& _internal_location_hint() const;
-  ::location::nearby::connections::LocationHint* _internal_mutable_location_hint();
+  const std::string& _internal_service_info() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_service_info(const std::string& value);
+  std::string* _internal_mutable_service_info();
   public:
-  void unsafe_arena_set_allocated_location_hint(
-      ::location::nearby::connections::LocationHint* location_hint);
-  ::location::nearby::connections::LocationHint* unsafe_arena_release_location_hint();
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WebRtcCredentials)
+  // optional string password = 3;
+  bool has_password() const;
+  private:
+  bool _internal_has_password() const;
+  public:
+  void clear_password();
+  const std::string& password() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_password(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_password();
+  PROTOBUF_NODISCARD std::string* release_password();
+  void set_allocated_password(std::string* password);
+  private:
+  const std::string& _internal_password() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_password(const std::string& value);
+  std::string* _internal_mutable_password();
+  public:
+
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiAwareCredentials)
  private:
   class _Internal;
 
@@ -4016,30 +4156,31 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials final :
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr peer_id_;
-  ::location::nearby::connections::LocationHint* location_hint_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_id_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_info_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr password_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BandwidthUpgradeNegotiationFrame_UpgradePathInfo final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo) */ {
+class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiDirectCredentials) */ {
  public:
-  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo() : BandwidthUpgradeNegotiationFrame_UpgradePathInfo(nullptr) {}
-  ~BandwidthUpgradeNegotiationFrame_UpgradePathInfo() override;
-  explicit constexpr BandwidthUpgradeNegotiationFrame_UpgradePathInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials() : BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials(nullptr) {}
+  ~BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials() override;
+  explicit constexpr BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  BandwidthUpgradeNegotiationFrame_UpgradePathInfo(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo& from);
-  BandwidthUpgradeNegotiationFrame_UpgradePathInfo(BandwidthUpgradeNegotiationFrame_UpgradePathInfo&& from) noexcept
-    : BandwidthUpgradeNegotiationFrame_UpgradePathInfo() {
+  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials& from);
+  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials&& from) noexcept
+    : BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials() {
     *this = ::std::move(from);
   }
 
-  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo& operator=(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo& from) {
+  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials& operator=(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials& from) {
     CopyFrom(from);
     return *this;
   }
-  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo& operator=(BandwidthUpgradeNegotiationFrame_UpgradePathInfo&& from) noexcept {
+  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials& operator=(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -4060,20 +4201,20 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const BandwidthUpgradeNegotiationFrame_UpgradePathInfo& default_instance() {
+  static const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials& default_instance() {
     return *internal_default_instance();
   }
-  static inline const BandwidthUpgradeNegotiationFrame_UpgradePathInfo* internal_default_instance() {
-    return reinterpret_cast<const BandwidthUpgradeNegotiationFrame_UpgradePathInfo*>(
-               &_BandwidthUpgradeNegotiationFrame_UpgradePathInfo_default_instance_);
+  static inline const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials* internal_default_instance() {
+    return reinterpret_cast<const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials*>(
+               &_BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     14;
 
-  friend void swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo& a, BandwidthUpgradeNegotiationFrame_UpgradePathInfo& b) {
+  friend void swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials& a, BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials& b) {
     a.Swap(&b);
   }
-  inline void Swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo* other) {
+  inline void Swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -4086,7 +4227,7 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo* other) {
+  void UnsafeArenaSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -4094,12 +4235,12 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo final :
 
   // implements Message ----------------------------------------------
 
-  BandwidthUpgradeNegotiationFrame_UpgradePathInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<BandwidthUpgradeNegotiationFrame_UpgradePathInfo>(arena);
+  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo& from);
-  void MergeFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo& from);
+  void CopyFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials& from);
+  void MergeFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -4113,15 +4254,15 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo* other);
+  void InternalSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo";
+    return "location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiDirectCredentials";
   }
   protected:
-  explicit BandwidthUpgradeNegotiationFrame_UpgradePathInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -4132,259 +4273,152 @@ class BandwidthUpgradeNegotiationFrame_UpgradePathInfo final :
 
   // nested types ----------------------------------------------------
 
-  typedef BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials WifiHotspotCredentials;
-  typedef BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket WifiLanSocket;
-  typedef BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials BluetoothCredentials;
-  typedef BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials WifiAwareCredentials;
-  typedef BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials WifiDirectCredentials;
-  typedef BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials WebRtcCredentials;
-
-  typedef BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium Medium;
-  static constexpr Medium UNKNOWN_MEDIUM =
-    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_UNKNOWN_MEDIUM;
-  PROTOBUF_DEPRECATED_ENUM static constexpr Medium MDNS =
-    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_MDNS;
-  static constexpr Medium BLUETOOTH =
-    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_BLUETOOTH;
-  static constexpr Medium WIFI_HOTSPOT =
-    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_WIFI_HOTSPOT;
-  static constexpr Medium BLE =
-    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_BLE;
-  static constexpr Medium WIFI_LAN =
-    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_WIFI_LAN;
-  static constexpr Medium WIFI_AWARE =
-    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_WIFI_AWARE;
-  static constexpr Medium NFC =
-    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_NFC;
-  static constexpr Medium WIFI_DIRECT =
-    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_WIFI_DIRECT;
-  static constexpr Medium WEB_RTC =
-    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_WEB_RTC;
-  static constexpr Medium USB =
-    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_USB;
-  static constexpr Medium WEB_RTC_NON_CELLULAR =
-    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_WEB_RTC_NON_CELLULAR;
-  static inline bool Medium_IsValid(int value) {
-    return BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_IsValid(value);
-  }
-  static constexpr Medium Medium_MIN =
-    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_Medium_MIN;
-  static constexpr Medium Medium_MAX =
-    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_Medium_MAX;
-  static constexpr int Medium_ARRAYSIZE =
-    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_Medium_ARRAYSIZE;
-  template<typename T>
-  static inline const std::string& Medium_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, Medium>::value ||
-      ::std::is_integral<T>::value,
-      "Incorrect type passed to function Medium_Name.");
-    return BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_Name(enum_t_value);
-  }
-  static inline bool Medium_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
-      Medium* value) {
-    return BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_Parse(name, value);
-  }
-
   // accessors -------------------------------------------------------
 
   enum : int {
-    kWifiHotspotCredentialsFieldNumber = 2,
-    kWifiLanSocketFieldNumber = 3,
-    kBluetoothCredentialsFieldNumber = 4,
-    kWifiAwareCredentialsFieldNumber = 5,
-    kWifiDirectCredentialsFieldNumber = 6,
-    kWebRtcCredentialsFieldNumber = 8,
-    kMediumFieldNumber = 1,
-    kSupportsDisablingEncryptionFieldNumber = 7,
-    kSupportsClientIntroductionAckFieldNumber = 9,
+    kSsidFieldNumber = 1,
+    kPasswordFieldNumber = 2,
+    kGatewayFieldNumber = 5,
+    kIpV6AddressFieldNumber = 6,
+    kPortFieldNumber = 3,
+    kFrequencyFieldNumber = 4,
   };
-  // optional .location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiHotspotCredentials wifi_hotspot_credentials = 2;
-  bool has_wifi_hotspot_credentials() const;
-  private:
-  bool _internal_has_wifi_hotspot_credentials() const;
-  public:
-  void clear_wifi_hotspot_credentials();
-  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials& wifi_hotspot_credentials() const;
-  PROTOBUF_NODISCARD ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials* release_wifi_hotspot_credentials();
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials* mutable_wifi_hotspot_credentials();
-  void set_allocated_wifi_hotspot_credentials(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials* wifi_hotspot_credentials);
-  private:
-  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials& _internal_wifi_hotspot_credentials() const;
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials* _internal_mutable_wifi_hotspot_credentials();
-  public:
-  void unsafe_arena_set_allocated_wifi_hotspot_credentials(
-      ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials* wifi_hotspot_credentials);
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials* unsafe_arena_release_wifi_hotspot_credentials();
-
-  // optional .location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiLanSocket wifi_lan_socket = 3;
-  bool has_wifi_lan_socket() const;
+  // optional string ssid = 1;
+  bool has_ssid() const;
   private:
-  bool _internal_has_wifi_lan_socket() const;
+  bool _internal_has_ssid() const;
   public:
-  void clear_wifi_lan_socket();
-  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket& wifi_lan_socket() const;
-  PROTOBUF_NODISCARD ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket* release_wifi_lan_socket();
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket* mutable_wifi_lan_socket();
-  void set_allocated_wifi_lan_socket(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket* wifi_lan_socket);
+  void clear_ssid();
+  const std::string& ssid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ssid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ssid();
+  PROTOBUF_NODISCARD std::string* release_ssid();
+  void set_allocated_ssid(std::string* ssid);
   private:
-  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket& _internal_wifi_lan_socket() const;
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket* _internal_mutable_wifi_lan_socket();
+  const std::string& _internal_ssid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ssid(const std::string& value);
+  std::string* _internal_mutable_ssid();
   public:
-  void unsafe_arena_set_allocated_wifi_lan_socket(
-      ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket* wifi_lan_socket);
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket* unsafe_arena_release_wifi_lan_socket();
 
-  // optional .location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.BluetoothCredentials bluetooth_credentials = 4;
-  bool has_bluetooth_credentials() const;
+  // optional string password = 2;
+  bool has_password() const;
   private:
-  bool _internal_has_bluetooth_credentials() const;
+  bool _internal_has_password() const;
   public:
-  void clear_bluetooth_credentials();
-  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials& bluetooth_credentials() const;
-  PROTOBUF_NODISCARD ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials* release_bluetooth_credentials();
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials* mutable_bluetooth_credentials();
-  void set_allocated_bluetooth_credentials(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials* bluetooth_credentials);
+  void clear_password();
+  const std::string& password() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_password(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_password();
+  PROTOBUF_NODISCARD std::string* release_password();
+  void set_allocated_password(std::string* password);
   private:
-  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials& _internal_bluetooth_credentials() const;
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials* _internal_mutable_bluetooth_credentials();
+  const std::string& _internal_password() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_password(const std::string& value);
+  std::string* _internal_mutable_password();
   public:
-  void unsafe_arena_set_allocated_bluetooth_credentials(
-      ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials* bluetooth_credentials);
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials* unsafe_arena_release_bluetooth_credentials();
 
-  // optional .location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiAwareCredentials wifi_aware_credentials = 5;
-  bool has_wifi_aware_credentials() const;
+  // optional string gateway = 5 [default = "0.0.0.0"];
+  bool has_gateway() const;
   private:
-  bool _internal_has_wifi_aware_credentials() const;
+  bool _internal_has_gateway() const;
   public:
-  void clear_wifi_aware_credentials();
-  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials& wifi_aware_credentials() const;
-  PROTOBUF_NODISCARD ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials* release_wifi_aware_credentials();
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials* mutable_wifi_aware_credentials();
-  void set_allocated_wifi_aware_credentials(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials* wifi_aware_credentials);
+  void clear_gateway();
+  const std::string& gateway() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_gateway(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_gateway();
+  PROTOBUF_NODISCARD std::string* release_gateway();
+  void set_allocated_gateway(std::string* gateway);
   private:
-  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials& _internal_wifi_aware_credentials() const;
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials* _internal_mutable_wifi_aware_credentials();
+  const std::string& _internal_gateway() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_gateway(const std::string& value);
+  std::string* _internal_mutable_gateway();
   public:
-  void unsafe_arena_set_allocated_wifi_aware_credentials(
-      ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials* wifi_aware_credentials);
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials* unsafe_arena_release_wifi_aware_credentials();
 
-  // optional .location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiDirectCredentials wifi_direct_credentials = 6;
-  bool has_wifi_direct_credentials() const;
+  // optional bytes ip_v6_address = 6;
+  bool has_ip_v6_address() const;
   private:
-  bool _internal_has_wifi_direct_credentials() const;
+  bool _internal_has_ip_v6_address() const;
   public:
-  void clear_wifi_direct_credentials();
-  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials& wifi_direct_credentials() const;
-  PROTOBUF_NODISCARD ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials* release_wifi_direct_credentials();
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials* mutable_wifi_direct_credentials();
-  void set_allocated_wifi_direct_credentials(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials* wifi_direct_credentials);
+  void clear_ip_v6_address();
+  const std::string& ip_v6_address() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ip_v6_address(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ip_v6_address();
+  PROTOBUF_NODISCARD std::string* release_ip_v6_address();
+  void set_allocated_ip_v6_address(std::string* ip_v6_address);
   private:
-  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials& _internal_wifi_direct_credentials() const;
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials* _internal_mutable_wifi_direct_credentials();
+  const std::string& _internal_ip_v6_address() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip_v6_address(const std::string& value);
+  std::string* _internal_mutable_ip_v6_address();
   public:
-  void unsafe_arena_set_allocated_wifi_direct_credentials(
-      ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials* wifi_direct_credentials);
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials* unsafe_arena_release_wifi_direct_credentials();
 
-  // optional .location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WebRtcCredentials web_rtc_credentials = 8;
-  bool has_web_rtc_credentials() const;
+  // optional int32 port = 3;
+  bool has_port() const;
   private:
-  bool _internal_has_web_rtc_credentials() const;
+  bool _internal_has_port() const;
   public:
-  void clear_web_rtc_credentials();
-  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials& web_rtc_credentials() const;
-  PROTOBUF_NODISCARD ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials* release_web_rtc_credentials();
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials* mutable_web_rtc_credentials();
-  void set_allocated_web_rtc_credentials(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials* web_rtc_credentials);
+  void clear_port();
+  int32_t port() const;
+  void set_port(int32_t value);
   private:
-  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials& _internal_web_rtc_credentials() const;
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials* _internal_mutable_web_rtc_credentials();
+  int32_t _internal_port() const;
+  void _internal_set_port(int32_t value);
   public:
-  void unsafe_arena_set_allocated_web_rtc_credentials(
-      ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials* web_rtc_credentials);
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials* unsafe_arena_release_web_rtc_credentials();
 
-  // optional .location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.Medium medium = 1;
-  bool has_medium() const;
+  // optional int32 frequency = 4;
+  bool has_frequency() const;
   private:
-  bool _internal_has_medium() const;
+  bool _internal_has_frequency() const;
   public:
-  void clear_medium();
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium medium() const;
-  void set_medium(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium value);
+  void clear_frequency();
+  int32_t frequency() const;
+  void set_frequency(int32_t value);
   private:
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium _internal_medium() const;
-  void _internal_set_medium(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium value);
+  int32_t _internal_frequency() const;
+  void _internal_set_frequency(int32_t value);
   public:
 
-  // optional bool supports_disabling_encryption = 7;
-  bool has_supports_disabling_encryption() const;
-  private:
-  bool _internal_has_supports_disabling_encryption() const;
-  public:
-  void clear_supports_disabling_encryption();
-  bool supports_disabling_encryption() const;
-  void set_supports_disabling_encryption(bool value);
-  private:
-  bool _internal_supports_disabling_encryption() const;
-  void _internal_set_supports_disabling_encryption(bool value);
-  public:
-
-  // optional bool supports_client_introduction_ack = 9;
-  bool has_supports_client_introduction_ack() const;
-  private:
-  bool _internal_has_supports_client_introduction_ack() const;
-  public:
-  void clear_supports_client_introduction_ack();
-  bool supports_client_introduction_ack() const;
-  void set_supports_client_introduction_ack(bool value);
-  private:
-  bool _internal_supports_client_introduction_ack() const;
-  void _internal_set_supports_client_introduction_ack(bool value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo)
- private:
-  class _Internal;
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiDirectCredentials)
+ private:
+  class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials* wifi_hotspot_credentials_;
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket* wifi_lan_socket_;
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials* bluetooth_credentials_;
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials* wifi_aware_credentials_;
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials* wifi_direct_credentials_;
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials* web_rtc_credentials_;
-  int medium_;
-  bool supports_disabling_encryption_;
-  bool supports_client_introduction_ack_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ssid_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr password_;
+  static const ::PROTOBUF_NAMESPACE_ID::internal::LazyString _i_give_permission_to_break_this_code_default_gateway_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr gateway_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_v6_address_;
+  int32_t port_;
+  int32_t frequency_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.BandwidthUpgradeNegotiationFrame.SafeToClosePriorChannel) */ {
+class BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WebRtcCredentials) */ {
  public:
-  inline BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel() : BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel(nullptr) {}
-  ~BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel() override;
-  explicit constexpr BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials() : BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials(nullptr) {}
+  ~BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials() override;
+  explicit constexpr BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel(const BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel& from);
-  BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel(BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel&& from) noexcept
-    : BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel() {
+  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials& from);
+  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials&& from) noexcept
+    : BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials() {
     *this = ::std::move(from);
   }
 
-  inline BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel& operator=(const BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel& from) {
+  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials& operator=(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials& from) {
     CopyFrom(from);
     return *this;
   }
-  inline BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel& operator=(BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel&& from) noexcept {
+  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials& operator=(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -4405,20 +4439,20 @@ class BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel& default_instance() {
+  static const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials& default_instance() {
     return *internal_default_instance();
   }
-  static inline const BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel* internal_default_instance() {
-    return reinterpret_cast<const BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel*>(
-               &_BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel_default_instance_);
+  static inline const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials* internal_default_instance() {
+    return reinterpret_cast<const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials*>(
+               &_BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     15;
 
-  friend void swap(BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel& a, BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel& b) {
+  friend void swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials& a, BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials& b) {
     a.Swap(&b);
   }
-  inline void Swap(BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel* other) {
+  inline void Swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -4431,7 +4465,7 @@ class BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel* other) {
+  void UnsafeArenaSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -4439,12 +4473,12 @@ class BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel final :
 
   // implements Message ----------------------------------------------
 
-  BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel>(arena);
+  BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel& from);
-  void MergeFrom(const BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel& from);
+  void CopyFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials& from);
+  void MergeFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -4458,15 +4492,15 @@ class BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel* other);
+  void InternalSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.BandwidthUpgradeNegotiationFrame.SafeToClosePriorChannel";
+    return "location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WebRtcCredentials";
   }
   protected:
-  explicit BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -4480,22 +4514,46 @@ class BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kStaFrequencyFieldNumber = 1,
+    kPeerIdFieldNumber = 1,
+    kLocationHintFieldNumber = 2,
   };
-  // optional int32 sta_frequency = 1;
-  bool has_sta_frequency() const;
+  // optional string peer_id = 1;
+  bool has_peer_id() const;
   private:
-  bool _internal_has_sta_frequency() const;
+  bool _internal_has_peer_id() const;
   public:
-  void clear_sta_frequency();
-  int32_t sta_frequency() const;
-  void set_sta_frequency(int32_t value);
+  void clear_peer_id();
+  const std::string& peer_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_peer_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_peer_id();
+  PROTOBUF_NODISCARD std::string* release_peer_id();
+  void set_allocated_peer_id(std::string* peer_id);
   private:
-  int32_t _internal_sta_frequency() const;
-  void _internal_set_sta_frequency(int32_t value);
+  const std::string& _internal_peer_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_peer_id(const std::string& value);
+  std::string* _internal_mutable_peer_id();
   public:
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.BandwidthUpgradeNegotiationFrame.SafeToClosePriorChannel)
+  // optional .location.nearby.connections.LocationHint location_hint = 2;
+  bool has_location_hint() const;
+  private:
+  bool _internal_has_location_hint() const;
+  public:
+  void clear_location_hint();
+  const ::location::nearby::connections::LocationHint& location_hint() const;
+  PROTOBUF_NODISCARD ::location::nearby::connections::LocationHint* release_location_hint();
+  ::location::nearby::connections::LocationHint* mutable_location_hint();
+  void set_allocated_location_hint(::location::nearby::connections::LocationHint* location_hint);
+  private:
+  const ::location::nearby::connections::LocationHint& _internal_location_hint() const;
+  ::location::nearby::connections::LocationHint* _internal_mutable_location_hint();
+  public:
+  void unsafe_arena_set_allocated_location_hint(
+      ::location::nearby::connections::LocationHint* location_hint);
+  ::location::nearby::connections::LocationHint* unsafe_arena_release_location_hint();
+
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WebRtcCredentials)
  private:
   class _Internal;
 
@@ -4504,29 +4562,30 @@ class BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel final :
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  int32_t sta_frequency_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr peer_id_;
+  ::location::nearby::connections::LocationHint* location_hint_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BandwidthUpgradeNegotiationFrame_ClientIntroduction final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.BandwidthUpgradeNegotiationFrame.ClientIntroduction) */ {
+class BandwidthUpgradeNegotiationFrame_UpgradePathInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo) */ {
  public:
-  inline BandwidthUpgradeNegotiationFrame_ClientIntroduction() : BandwidthUpgradeNegotiationFrame_ClientIntroduction(nullptr) {}
-  ~BandwidthUpgradeNegotiationFrame_ClientIntroduction() override;
-  explicit constexpr BandwidthUpgradeNegotiationFrame_ClientIntroduction(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo() : BandwidthUpgradeNegotiationFrame_UpgradePathInfo(nullptr) {}
+  ~BandwidthUpgradeNegotiationFrame_UpgradePathInfo() override;
+  explicit constexpr BandwidthUpgradeNegotiationFrame_UpgradePathInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  BandwidthUpgradeNegotiationFrame_ClientIntroduction(const BandwidthUpgradeNegotiationFrame_ClientIntroduction& from);
-  BandwidthUpgradeNegotiationFrame_ClientIntroduction(BandwidthUpgradeNegotiationFrame_ClientIntroduction&& from) noexcept
-    : BandwidthUpgradeNegotiationFrame_ClientIntroduction() {
+  BandwidthUpgradeNegotiationFrame_UpgradePathInfo(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo& from);
+  BandwidthUpgradeNegotiationFrame_UpgradePathInfo(BandwidthUpgradeNegotiationFrame_UpgradePathInfo&& from) noexcept
+    : BandwidthUpgradeNegotiationFrame_UpgradePathInfo() {
     *this = ::std::move(from);
   }
 
-  inline BandwidthUpgradeNegotiationFrame_ClientIntroduction& operator=(const BandwidthUpgradeNegotiationFrame_ClientIntroduction& from) {
+  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo& operator=(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo& from) {
     CopyFrom(from);
     return *this;
   }
-  inline BandwidthUpgradeNegotiationFrame_ClientIntroduction& operator=(BandwidthUpgradeNegotiationFrame_ClientIntroduction&& from) noexcept {
+  inline BandwidthUpgradeNegotiationFrame_UpgradePathInfo& operator=(BandwidthUpgradeNegotiationFrame_UpgradePathInfo&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -4547,20 +4606,20 @@ class BandwidthUpgradeNegotiationFrame_ClientIntroduction final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const BandwidthUpgradeNegotiationFrame_ClientIntroduction& default_instance() {
+  static const BandwidthUpgradeNegotiationFrame_UpgradePathInfo& default_instance() {
     return *internal_default_instance();
   }
-  static inline const BandwidthUpgradeNegotiationFrame_ClientIntroduction* internal_default_instance() {
-    return reinterpret_cast<const BandwidthUpgradeNegotiationFrame_ClientIntroduction*>(
-               &_BandwidthUpgradeNegotiationFrame_ClientIntroduction_default_instance_);
+  static inline const BandwidthUpgradeNegotiationFrame_UpgradePathInfo* internal_default_instance() {
+    return reinterpret_cast<const BandwidthUpgradeNegotiationFrame_UpgradePathInfo*>(
+               &_BandwidthUpgradeNegotiationFrame_UpgradePathInfo_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     16;
 
-  friend void swap(BandwidthUpgradeNegotiationFrame_ClientIntroduction& a, BandwidthUpgradeNegotiationFrame_ClientIntroduction& b) {
+  friend void swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo& a, BandwidthUpgradeNegotiationFrame_UpgradePathInfo& b) {
     a.Swap(&b);
   }
-  inline void Swap(BandwidthUpgradeNegotiationFrame_ClientIntroduction* other) {
+  inline void Swap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -4573,7 +4632,7 @@ class BandwidthUpgradeNegotiationFrame_ClientIntroduction final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(BandwidthUpgradeNegotiationFrame_ClientIntroduction* other) {
+  void UnsafeArenaSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -4581,12 +4640,12 @@ class BandwidthUpgradeNegotiationFrame_ClientIntroduction final :
 
   // implements Message ----------------------------------------------
 
-  BandwidthUpgradeNegotiationFrame_ClientIntroduction* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<BandwidthUpgradeNegotiationFrame_ClientIntroduction>(arena);
+  BandwidthUpgradeNegotiationFrame_UpgradePathInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BandwidthUpgradeNegotiationFrame_UpgradePathInfo>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const BandwidthUpgradeNegotiationFrame_ClientIntroduction& from);
-  void MergeFrom(const BandwidthUpgradeNegotiationFrame_ClientIntroduction& from);
+  void CopyFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo& from);
+  void MergeFrom(const BandwidthUpgradeNegotiationFrame_UpgradePathInfo& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -4600,15 +4659,15 @@ class BandwidthUpgradeNegotiationFrame_ClientIntroduction final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(BandwidthUpgradeNegotiationFrame_ClientIntroduction* other);
+  void InternalSwap(BandwidthUpgradeNegotiationFrame_UpgradePathInfo* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.BandwidthUpgradeNegotiationFrame.ClientIntroduction";
+    return "location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo";
   }
   protected:
-  explicit BandwidthUpgradeNegotiationFrame_ClientIntroduction(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BandwidthUpgradeNegotiationFrame_UpgradePathInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -4619,31 +4678,194 @@ class BandwidthUpgradeNegotiationFrame_ClientIntroduction final :
 
   // nested types ----------------------------------------------------
 
+  typedef BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials WifiHotspotCredentials;
+  typedef BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket WifiLanSocket;
+  typedef BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials BluetoothCredentials;
+  typedef BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials WifiAwareCredentials;
+  typedef BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials WifiDirectCredentials;
+  typedef BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials WebRtcCredentials;
+
+  typedef BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium Medium;
+  static constexpr Medium UNKNOWN_MEDIUM =
+    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_UNKNOWN_MEDIUM;
+  PROTOBUF_DEPRECATED_ENUM static constexpr Medium MDNS =
+    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_MDNS;
+  static constexpr Medium BLUETOOTH =
+    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_BLUETOOTH;
+  static constexpr Medium WIFI_HOTSPOT =
+    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_WIFI_HOTSPOT;
+  static constexpr Medium BLE =
+    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_BLE;
+  static constexpr Medium WIFI_LAN =
+    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_WIFI_LAN;
+  static constexpr Medium WIFI_AWARE =
+    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_WIFI_AWARE;
+  static constexpr Medium NFC =
+    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_NFC;
+  static constexpr Medium WIFI_DIRECT =
+    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_WIFI_DIRECT;
+  static constexpr Medium WEB_RTC =
+    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_WEB_RTC;
+  static constexpr Medium USB =
+    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_USB;
+  static constexpr Medium WEB_RTC_NON_CELLULAR =
+    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_WEB_RTC_NON_CELLULAR;
+  static inline bool Medium_IsValid(int value) {
+    return BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_IsValid(value);
+  }
+  static constexpr Medium Medium_MIN =
+    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_Medium_MIN;
+  static constexpr Medium Medium_MAX =
+    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_Medium_MAX;
+  static constexpr int Medium_ARRAYSIZE =
+    BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_Medium_ARRAYSIZE;
+  template<typename T>
+  static inline const std::string& Medium_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Medium>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Medium_Name.");
+    return BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_Name(enum_t_value);
+  }
+  static inline bool Medium_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Medium* value) {
+    return BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
   enum : int {
-    kEndpointIdFieldNumber = 1,
-    kSupportsDisablingEncryptionFieldNumber = 2,
+    kWifiHotspotCredentialsFieldNumber = 2,
+    kWifiLanSocketFieldNumber = 3,
+    kBluetoothCredentialsFieldNumber = 4,
+    kWifiAwareCredentialsFieldNumber = 5,
+    kWifiDirectCredentialsFieldNumber = 6,
+    kWebRtcCredentialsFieldNumber = 8,
+    kMediumFieldNumber = 1,
+    kSupportsDisablingEncryptionFieldNumber = 7,
+    kSupportsClientIntroductionAckFieldNumber = 9,
   };
-  // optional string endpoint_id = 1;
-  bool has_endpoint_id() const;
+  // optional .location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiHotspotCredentials wifi_hotspot_credentials = 2;
+  bool has_wifi_hotspot_credentials() const;
   private:
-  bool _internal_has_endpoint_id() const;
+  bool _internal_has_wifi_hotspot_credentials() const;
   public:
-  void clear_endpoint_id();
-  const std::string& endpoint_id() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_endpoint_id(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_endpoint_id();
-  PROTOBUF_NODISCARD std::string* release_endpoint_id();
-  void set_allocated_endpoint_id(std::string* endpoint_id);
+  void clear_wifi_hotspot_credentials();
+  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials& wifi_hotspot_credentials() const;
+  PROTOBUF_NODISCARD ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials* release_wifi_hotspot_credentials();
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials* mutable_wifi_hotspot_credentials();
+  void set_allocated_wifi_hotspot_credentials(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials* wifi_hotspot_credentials);
   private:
-  const std::string& _internal_endpoint_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_endpoint_id(const std::string& value);
-  std::string* _internal_mutable_endpoint_id();
+  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials& _internal_wifi_hotspot_credentials() const;
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials* _internal_mutable_wifi_hotspot_credentials();
   public:
-
-  // optional bool supports_disabling_encryption = 2;
+  void unsafe_arena_set_allocated_wifi_hotspot_credentials(
+      ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials* wifi_hotspot_credentials);
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials* unsafe_arena_release_wifi_hotspot_credentials();
+
+  // optional .location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiLanSocket wifi_lan_socket = 3;
+  bool has_wifi_lan_socket() const;
+  private:
+  bool _internal_has_wifi_lan_socket() const;
+  public:
+  void clear_wifi_lan_socket();
+  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket& wifi_lan_socket() const;
+  PROTOBUF_NODISCARD ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket* release_wifi_lan_socket();
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket* mutable_wifi_lan_socket();
+  void set_allocated_wifi_lan_socket(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket* wifi_lan_socket);
+  private:
+  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket& _internal_wifi_lan_socket() const;
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket* _internal_mutable_wifi_lan_socket();
+  public:
+  void unsafe_arena_set_allocated_wifi_lan_socket(
+      ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket* wifi_lan_socket);
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket* unsafe_arena_release_wifi_lan_socket();
+
+  // optional .location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.BluetoothCredentials bluetooth_credentials = 4;
+  bool has_bluetooth_credentials() const;
+  private:
+  bool _internal_has_bluetooth_credentials() const;
+  public:
+  void clear_bluetooth_credentials();
+  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials& bluetooth_credentials() const;
+  PROTOBUF_NODISCARD ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials* release_bluetooth_credentials();
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials* mutable_bluetooth_credentials();
+  void set_allocated_bluetooth_credentials(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials* bluetooth_credentials);
+  private:
+  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials& _internal_bluetooth_credentials() const;
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials* _internal_mutable_bluetooth_credentials();
+  public:
+  void unsafe_arena_set_allocated_bluetooth_credentials(
+      ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials* bluetooth_credentials);
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials* unsafe_arena_release_bluetooth_credentials();
+
+  // optional .location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiAwareCredentials wifi_aware_credentials = 5;
+  bool has_wifi_aware_credentials() const;
+  private:
+  bool _internal_has_wifi_aware_credentials() const;
+  public:
+  void clear_wifi_aware_credentials();
+  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials& wifi_aware_credentials() const;
+  PROTOBUF_NODISCARD ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials* release_wifi_aware_credentials();
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials* mutable_wifi_aware_credentials();
+  void set_allocated_wifi_aware_credentials(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials* wifi_aware_credentials);
+  private:
+  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials& _internal_wifi_aware_credentials() const;
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials* _internal_mutable_wifi_aware_credentials();
+  public:
+  void unsafe_arena_set_allocated_wifi_aware_credentials(
+      ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials* wifi_aware_credentials);
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials* unsafe_arena_release_wifi_aware_credentials();
+
+  // optional .location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WifiDirectCredentials wifi_direct_credentials = 6;
+  bool has_wifi_direct_credentials() const;
+  private:
+  bool _internal_has_wifi_direct_credentials() const;
+  public:
+  void clear_wifi_direct_credentials();
+  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials& wifi_direct_credentials() const;
+  PROTOBUF_NODISCARD ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials* release_wifi_direct_credentials();
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials* mutable_wifi_direct_credentials();
+  void set_allocated_wifi_direct_credentials(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials* wifi_direct_credentials);
+  private:
+  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials& _internal_wifi_direct_credentials() const;
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials* _internal_mutable_wifi_direct_credentials();
+  public:
+  void unsafe_arena_set_allocated_wifi_direct_credentials(
+      ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials* wifi_direct_credentials);
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials* unsafe_arena_release_wifi_direct_credentials();
+
+  // optional .location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.WebRtcCredentials web_rtc_credentials = 8;
+  bool has_web_rtc_credentials() const;
+  private:
+  bool _internal_has_web_rtc_credentials() const;
+  public:
+  void clear_web_rtc_credentials();
+  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials& web_rtc_credentials() const;
+  PROTOBUF_NODISCARD ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials* release_web_rtc_credentials();
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials* mutable_web_rtc_credentials();
+  void set_allocated_web_rtc_credentials(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials* web_rtc_credentials);
+  private:
+  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials& _internal_web_rtc_credentials() const;
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials* _internal_mutable_web_rtc_credentials();
+  public:
+  void unsafe_arena_set_allocated_web_rtc_credentials(
+      ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials* web_rtc_credentials);
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials* unsafe_arena_release_web_rtc_credentials();
+
+  // optional .location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo.Medium medium = 1;
+  bool has_medium() const;
+  private:
+  bool _internal_has_medium() const;
+  public:
+  void clear_medium();
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium medium() const;
+  void set_medium(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium value);
+  private:
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium _internal_medium() const;
+  void _internal_set_medium(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_Medium value);
+  public:
+
+  // optional bool supports_disabling_encryption = 7;
   bool has_supports_disabling_encryption() const;
   private:
   bool _internal_has_supports_disabling_encryption() const;
@@ -4656,7 +4878,20 @@ class BandwidthUpgradeNegotiationFrame_ClientIntroduction final :
   void _internal_set_supports_disabling_encryption(bool value);
   public:
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.BandwidthUpgradeNegotiationFrame.ClientIntroduction)
+  // optional bool supports_client_introduction_ack = 9;
+  bool has_supports_client_introduction_ack() const;
+  private:
+  bool _internal_has_supports_client_introduction_ack() const;
+  public:
+  void clear_supports_client_introduction_ack();
+  bool supports_client_introduction_ack() const;
+  void set_supports_client_introduction_ack(bool value);
+  private:
+  bool _internal_supports_client_introduction_ack() const;
+  void _internal_set_supports_client_introduction_ack(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo)
  private:
   class _Internal;
 
@@ -4665,30 +4900,37 @@ class BandwidthUpgradeNegotiationFrame_ClientIntroduction final :
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr endpoint_id_;
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiHotspotCredentials* wifi_hotspot_credentials_;
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiLanSocket* wifi_lan_socket_;
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_BluetoothCredentials* bluetooth_credentials_;
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiAwareCredentials* wifi_aware_credentials_;
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WifiDirectCredentials* wifi_direct_credentials_;
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo_WebRtcCredentials* web_rtc_credentials_;
+  int medium_;
   bool supports_disabling_encryption_;
+  bool supports_client_introduction_ack_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BandwidthUpgradeNegotiationFrame_ClientIntroductionAck final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.BandwidthUpgradeNegotiationFrame.ClientIntroductionAck) */ {
+class BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.BandwidthUpgradeNegotiationFrame.SafeToClosePriorChannel) */ {
  public:
-  inline BandwidthUpgradeNegotiationFrame_ClientIntroductionAck() : BandwidthUpgradeNegotiationFrame_ClientIntroductionAck(nullptr) {}
-  ~BandwidthUpgradeNegotiationFrame_ClientIntroductionAck() override;
-  explicit constexpr BandwidthUpgradeNegotiationFrame_ClientIntroductionAck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel() : BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel(nullptr) {}
+  ~BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel() override;
+  explicit constexpr BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  BandwidthUpgradeNegotiationFrame_ClientIntroductionAck(const BandwidthUpgradeNegotiationFrame_ClientIntroductionAck& from);
-  BandwidthUpgradeNegotiationFrame_ClientIntroductionAck(BandwidthUpgradeNegotiationFrame_ClientIntroductionAck&& from) noexcept
-    : BandwidthUpgradeNegotiationFrame_ClientIntroductionAck() {
+  BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel(const BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel& from);
+  BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel(BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel&& from) noexcept
+    : BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel() {
     *this = ::std::move(from);
   }
 
-  inline BandwidthUpgradeNegotiationFrame_ClientIntroductionAck& operator=(const BandwidthUpgradeNegotiationFrame_ClientIntroductionAck& from) {
+  inline BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel& operator=(const BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel& from) {
     CopyFrom(from);
     return *this;
   }
-  inline BandwidthUpgradeNegotiationFrame_ClientIntroductionAck& operator=(BandwidthUpgradeNegotiationFrame_ClientIntroductionAck&& from) noexcept {
+  inline BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel& operator=(BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -4709,20 +4951,20 @@ class BandwidthUpgradeNegotiationFrame_ClientIntroductionAck final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const BandwidthUpgradeNegotiationFrame_ClientIntroductionAck& default_instance() {
+  static const BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel& default_instance() {
     return *internal_default_instance();
   }
-  static inline const BandwidthUpgradeNegotiationFrame_ClientIntroductionAck* internal_default_instance() {
-    return reinterpret_cast<const BandwidthUpgradeNegotiationFrame_ClientIntroductionAck*>(
-               &_BandwidthUpgradeNegotiationFrame_ClientIntroductionAck_default_instance_);
+  static inline const BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel* internal_default_instance() {
+    return reinterpret_cast<const BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel*>(
+               &_BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     17;
 
-  friend void swap(BandwidthUpgradeNegotiationFrame_ClientIntroductionAck& a, BandwidthUpgradeNegotiationFrame_ClientIntroductionAck& b) {
+  friend void swap(BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel& a, BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel& b) {
     a.Swap(&b);
   }
-  inline void Swap(BandwidthUpgradeNegotiationFrame_ClientIntroductionAck* other) {
+  inline void Swap(BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -4735,7 +4977,7 @@ class BandwidthUpgradeNegotiationFrame_ClientIntroductionAck final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(BandwidthUpgradeNegotiationFrame_ClientIntroductionAck* other) {
+  void UnsafeArenaSwap(BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -4743,12 +4985,12 @@ class BandwidthUpgradeNegotiationFrame_ClientIntroductionAck final :
 
   // implements Message ----------------------------------------------
 
-  BandwidthUpgradeNegotiationFrame_ClientIntroductionAck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<BandwidthUpgradeNegotiationFrame_ClientIntroductionAck>(arena);
+  BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const BandwidthUpgradeNegotiationFrame_ClientIntroductionAck& from);
-  void MergeFrom(const BandwidthUpgradeNegotiationFrame_ClientIntroductionAck& from);
+  void CopyFrom(const BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel& from);
+  void MergeFrom(const BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -4762,15 +5004,15 @@ class BandwidthUpgradeNegotiationFrame_ClientIntroductionAck final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(BandwidthUpgradeNegotiationFrame_ClientIntroductionAck* other);
+  void InternalSwap(BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.BandwidthUpgradeNegotiationFrame.ClientIntroductionAck";
+    return "location.nearby.connections.BandwidthUpgradeNegotiationFrame.SafeToClosePriorChannel";
   }
   protected:
-  explicit BandwidthUpgradeNegotiationFrame_ClientIntroductionAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -4783,36 +5025,54 @@ class BandwidthUpgradeNegotiationFrame_ClientIntroductionAck final :
 
   // accessors -------------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.BandwidthUpgradeNegotiationFrame.ClientIntroductionAck)
+  enum : int {
+    kStaFrequencyFieldNumber = 1,
+  };
+  // optional int32 sta_frequency = 1;
+  bool has_sta_frequency() const;
+  private:
+  bool _internal_has_sta_frequency() const;
+  public:
+  void clear_sta_frequency();
+  int32_t sta_frequency() const;
+  void set_sta_frequency(int32_t value);
+  private:
+  int32_t _internal_sta_frequency() const;
+  void _internal_set_sta_frequency(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.BandwidthUpgradeNegotiationFrame.SafeToClosePriorChannel)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  int32_t sta_frequency_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BandwidthUpgradeNegotiationFrame final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.BandwidthUpgradeNegotiationFrame) */ {
+class BandwidthUpgradeNegotiationFrame_ClientIntroduction final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.BandwidthUpgradeNegotiationFrame.ClientIntroduction) */ {
  public:
-  inline BandwidthUpgradeNegotiationFrame() : BandwidthUpgradeNegotiationFrame(nullptr) {}
-  ~BandwidthUpgradeNegotiationFrame() override;
-  explicit constexpr BandwidthUpgradeNegotiationFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline BandwidthUpgradeNegotiationFrame_ClientIntroduction() : BandwidthUpgradeNegotiationFrame_ClientIntroduction(nullptr) {}
+  ~BandwidthUpgradeNegotiationFrame_ClientIntroduction() override;
+  explicit constexpr BandwidthUpgradeNegotiationFrame_ClientIntroduction(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  BandwidthUpgradeNegotiationFrame(const BandwidthUpgradeNegotiationFrame& from);
-  BandwidthUpgradeNegotiationFrame(BandwidthUpgradeNegotiationFrame&& from) noexcept
-    : BandwidthUpgradeNegotiationFrame() {
+  BandwidthUpgradeNegotiationFrame_ClientIntroduction(const BandwidthUpgradeNegotiationFrame_ClientIntroduction& from);
+  BandwidthUpgradeNegotiationFrame_ClientIntroduction(BandwidthUpgradeNegotiationFrame_ClientIntroduction&& from) noexcept
+    : BandwidthUpgradeNegotiationFrame_ClientIntroduction() {
     *this = ::std::move(from);
   }
 
-  inline BandwidthUpgradeNegotiationFrame& operator=(const BandwidthUpgradeNegotiationFrame& from) {
+  inline BandwidthUpgradeNegotiationFrame_ClientIntroduction& operator=(const BandwidthUpgradeNegotiationFrame_ClientIntroduction& from) {
     CopyFrom(from);
     return *this;
   }
-  inline BandwidthUpgradeNegotiationFrame& operator=(BandwidthUpgradeNegotiationFrame&& from) noexcept {
+  inline BandwidthUpgradeNegotiationFrame_ClientIntroduction& operator=(BandwidthUpgradeNegotiationFrame_ClientIntroduction&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -4833,20 +5093,20 @@ class BandwidthUpgradeNegotiationFrame final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const BandwidthUpgradeNegotiationFrame& default_instance() {
+  static const BandwidthUpgradeNegotiationFrame_ClientIntroduction& default_instance() {
     return *internal_default_instance();
   }
-  static inline const BandwidthUpgradeNegotiationFrame* internal_default_instance() {
-    return reinterpret_cast<const BandwidthUpgradeNegotiationFrame*>(
-               &_BandwidthUpgradeNegotiationFrame_default_instance_);
+  static inline const BandwidthUpgradeNegotiationFrame_ClientIntroduction* internal_default_instance() {
+    return reinterpret_cast<const BandwidthUpgradeNegotiationFrame_ClientIntroduction*>(
+               &_BandwidthUpgradeNegotiationFrame_ClientIntroduction_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     18;
 
-  friend void swap(BandwidthUpgradeNegotiationFrame& a, BandwidthUpgradeNegotiationFrame& b) {
+  friend void swap(BandwidthUpgradeNegotiationFrame_ClientIntroduction& a, BandwidthUpgradeNegotiationFrame_ClientIntroduction& b) {
     a.Swap(&b);
   }
-  inline void Swap(BandwidthUpgradeNegotiationFrame* other) {
+  inline void Swap(BandwidthUpgradeNegotiationFrame_ClientIntroduction* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -4859,7 +5119,7 @@ class BandwidthUpgradeNegotiationFrame final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(BandwidthUpgradeNegotiationFrame* other) {
+  void UnsafeArenaSwap(BandwidthUpgradeNegotiationFrame_ClientIntroduction* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -4867,12 +5127,12 @@ class BandwidthUpgradeNegotiationFrame final :
 
   // implements Message ----------------------------------------------
 
-  BandwidthUpgradeNegotiationFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<BandwidthUpgradeNegotiationFrame>(arena);
+  BandwidthUpgradeNegotiationFrame_ClientIntroduction* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BandwidthUpgradeNegotiationFrame_ClientIntroduction>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const BandwidthUpgradeNegotiationFrame& from);
-  void MergeFrom(const BandwidthUpgradeNegotiationFrame& from);
+  void CopyFrom(const BandwidthUpgradeNegotiationFrame_ClientIntroduction& from);
+  void MergeFrom(const BandwidthUpgradeNegotiationFrame_ClientIntroduction& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -4886,15 +5146,15 @@ class BandwidthUpgradeNegotiationFrame final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(BandwidthUpgradeNegotiationFrame* other);
+  void InternalSwap(BandwidthUpgradeNegotiationFrame_ClientIntroduction* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.BandwidthUpgradeNegotiationFrame";
+    return "location.nearby.connections.BandwidthUpgradeNegotiationFrame.ClientIntroduction";
   }
   protected:
-  explicit BandwidthUpgradeNegotiationFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BandwidthUpgradeNegotiationFrame_ClientIntroduction(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -4905,142 +5165,44 @@ class BandwidthUpgradeNegotiationFrame final :
 
   // nested types ----------------------------------------------------
 
-  typedef BandwidthUpgradeNegotiationFrame_UpgradePathInfo UpgradePathInfo;
-  typedef BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel SafeToClosePriorChannel;
-  typedef BandwidthUpgradeNegotiationFrame_ClientIntroduction ClientIntroduction;
-  typedef BandwidthUpgradeNegotiationFrame_ClientIntroductionAck ClientIntroductionAck;
-
-  typedef BandwidthUpgradeNegotiationFrame_EventType EventType;
-  static constexpr EventType UNKNOWN_EVENT_TYPE =
-    BandwidthUpgradeNegotiationFrame_EventType_UNKNOWN_EVENT_TYPE;
-  static constexpr EventType UPGRADE_PATH_AVAILABLE =
-    BandwidthUpgradeNegotiationFrame_EventType_UPGRADE_PATH_AVAILABLE;
-  static constexpr EventType LAST_WRITE_TO_PRIOR_CHANNEL =
-    BandwidthUpgradeNegotiationFrame_EventType_LAST_WRITE_TO_PRIOR_CHANNEL;
-  static constexpr EventType SAFE_TO_CLOSE_PRIOR_CHANNEL =
-    BandwidthUpgradeNegotiationFrame_EventType_SAFE_TO_CLOSE_PRIOR_CHANNEL;
-  static constexpr EventType CLIENT_INTRODUCTION =
-    BandwidthUpgradeNegotiationFrame_EventType_CLIENT_INTRODUCTION;
-  static constexpr EventType UPGRADE_FAILURE =
-    BandwidthUpgradeNegotiationFrame_EventType_UPGRADE_FAILURE;
-  static constexpr EventType CLIENT_INTRODUCTION_ACK =
-    BandwidthUpgradeNegotiationFrame_EventType_CLIENT_INTRODUCTION_ACK;
-  static inline bool EventType_IsValid(int value) {
-    return BandwidthUpgradeNegotiationFrame_EventType_IsValid(value);
-  }
-  static constexpr EventType EventType_MIN =
-    BandwidthUpgradeNegotiationFrame_EventType_EventType_MIN;
-  static constexpr EventType EventType_MAX =
-    BandwidthUpgradeNegotiationFrame_EventType_EventType_MAX;
-  static constexpr int EventType_ARRAYSIZE =
-    BandwidthUpgradeNegotiationFrame_EventType_EventType_ARRAYSIZE;
-  template<typename T>
-  static inline const std::string& EventType_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, EventType>::value ||
-      ::std::is_integral<T>::value,
-      "Incorrect type passed to function EventType_Name.");
-    return BandwidthUpgradeNegotiationFrame_EventType_Name(enum_t_value);
-  }
-  static inline bool EventType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
-      EventType* value) {
-    return BandwidthUpgradeNegotiationFrame_EventType_Parse(name, value);
-  }
-
-  // accessors -------------------------------------------------------
+  // accessors -------------------------------------------------------
 
   enum : int {
-    kUpgradePathInfoFieldNumber = 2,
-    kClientIntroductionFieldNumber = 3,
-    kClientIntroductionAckFieldNumber = 4,
-    kSafeToClosePriorChannelFieldNumber = 5,
-    kEventTypeFieldNumber = 1,
+    kEndpointIdFieldNumber = 1,
+    kSupportsDisablingEncryptionFieldNumber = 2,
   };
-  // optional .location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo upgrade_path_info = 2;
-  bool has_upgrade_path_info() const;
-  private:
-  bool _internal_has_upgrade_path_info() const;
-  public:
-  void clear_upgrade_path_info();
-  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo& upgrade_path_info() const;
-  PROTOBUF_NODISCARD ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo* release_upgrade_path_info();
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo* mutable_upgrade_path_info();
-  void set_allocated_upgrade_path_info(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo* upgrade_path_info);
-  private:
-  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo& _internal_upgrade_path_info() const;
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo* _internal_mutable_upgrade_path_info();
-  public:
-  void unsafe_arena_set_allocated_upgrade_path_info(
-      ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo* upgrade_path_info);
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo* unsafe_arena_release_upgrade_path_info();
-
-  // optional .location.nearby.connections.BandwidthUpgradeNegotiationFrame.ClientIntroduction client_introduction = 3;
-  bool has_client_introduction() const;
-  private:
-  bool _internal_has_client_introduction() const;
-  public:
-  void clear_client_introduction();
-  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroduction& client_introduction() const;
-  PROTOBUF_NODISCARD ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroduction* release_client_introduction();
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroduction* mutable_client_introduction();
-  void set_allocated_client_introduction(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroduction* client_introduction);
-  private:
-  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroduction& _internal_client_introduction() const;
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroduction* _internal_mutable_client_introduction();
-  public:
-  void unsafe_arena_set_allocated_client_introduction(
-      ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroduction* client_introduction);
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroduction* unsafe_arena_release_client_introduction();
-
-  // optional .location.nearby.connections.BandwidthUpgradeNegotiationFrame.ClientIntroductionAck client_introduction_ack = 4;
-  bool has_client_introduction_ack() const;
-  private:
-  bool _internal_has_client_introduction_ack() const;
-  public:
-  void clear_client_introduction_ack();
-  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroductionAck& client_introduction_ack() const;
-  PROTOBUF_NODISCARD ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroductionAck* release_client_introduction_ack();
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroductionAck* mutable_client_introduction_ack();
-  void set_allocated_client_introduction_ack(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroductionAck* client_introduction_ack);
-  private:
-  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroductionAck& _internal_client_introduction_ack() const;
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroductionAck* _internal_mutable_client_introduction_ack();
-  public:
-  void unsafe_arena_set_allocated_client_introduction_ack(
-      ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroductionAck* client_introduction_ack);
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroductionAck* unsafe_arena_release_client_introduction_ack();
-
-  // optional .location.nearby.connections.BandwidthUpgradeNegotiationFrame.SafeToClosePriorChannel safe_to_close_prior_channel = 5;
-  bool has_safe_to_close_prior_channel() const;
+  // optional string endpoint_id = 1;
+  bool has_endpoint_id() const;
   private:
-  bool _internal_has_safe_to_close_prior_channel() const;
+  bool _internal_has_endpoint_id() const;
   public:
-  void clear_safe_to_close_prior_channel();
-  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel& safe_to_close_prior_channel() const;
-  PROTOBUF_NODISCARD ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel* release_safe_to_close_prior_channel();
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel* mutable_safe_to_close_prior_channel();
-  void set_allocated_safe_to_close_prior_channel(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel* safe_to_close_prior_channel);
+  void clear_endpoint_id();
+  const std::string& endpoint_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_endpoint_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_endpoint_id();
+  PROTOBUF_NODISCARD std::string* release_endpoint_id();
+  void set_allocated_endpoint_id(std::string* endpoint_id);
   private:
-  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel& _internal_safe_to_close_prior_channel() const;
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel* _internal_mutable_safe_to_close_prior_channel();
+  const std::string& _internal_endpoint_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_endpoint_id(const std::string& value);
+  std::string* _internal_mutable_endpoint_id();
   public:
-  void unsafe_arena_set_allocated_safe_to_close_prior_channel(
-      ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel* safe_to_close_prior_channel);
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel* unsafe_arena_release_safe_to_close_prior_channel();
 
-  // optional .location.nearby.connections.BandwidthUpgradeNegotiationFrame.EventType event_type = 1;
-  bool has_event_type() const;
+  // optional bool supports_disabling_encryption = 2;
+  bool has_supports_disabling_encryption() const;
   private:
-  bool _internal_has_event_type() const;
+  bool _internal_has_supports_disabling_encryption() const;
   public:
-  void clear_event_type();
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_EventType event_type() const;
-  void set_event_type(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_EventType value);
+  void clear_supports_disabling_encryption();
+  bool supports_disabling_encryption() const;
+  void set_supports_disabling_encryption(bool value);
   private:
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_EventType _internal_event_type() const;
-  void _internal_set_event_type(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_EventType value);
+  bool _internal_supports_disabling_encryption() const;
+  void _internal_set_supports_disabling_encryption(bool value);
   public:
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.BandwidthUpgradeNegotiationFrame)
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.BandwidthUpgradeNegotiationFrame.ClientIntroduction)
  private:
   class _Internal;
 
@@ -5049,33 +5211,30 @@ class BandwidthUpgradeNegotiationFrame final :
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo* upgrade_path_info_;
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroduction* client_introduction_;
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroductionAck* client_introduction_ack_;
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel* safe_to_close_prior_channel_;
-  int event_type_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr endpoint_id_;
+  bool supports_disabling_encryption_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BandwidthUpgradeRetryFrame final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.BandwidthUpgradeRetryFrame) */ {
+class BandwidthUpgradeNegotiationFrame_ClientIntroductionAck final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.BandwidthUpgradeNegotiationFrame.ClientIntroductionAck) */ {
  public:
-  inline BandwidthUpgradeRetryFrame() : BandwidthUpgradeRetryFrame(nullptr) {}
-  ~BandwidthUpgradeRetryFrame() override;
-  explicit constexpr BandwidthUpgradeRetryFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline BandwidthUpgradeNegotiationFrame_ClientIntroductionAck() : BandwidthUpgradeNegotiationFrame_ClientIntroductionAck(nullptr) {}
+  ~BandwidthUpgradeNegotiationFrame_ClientIntroductionAck() override;
+  explicit constexpr BandwidthUpgradeNegotiationFrame_ClientIntroductionAck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  BandwidthUpgradeRetryFrame(const BandwidthUpgradeRetryFrame& from);
-  BandwidthUpgradeRetryFrame(BandwidthUpgradeRetryFrame&& from) noexcept
-    : BandwidthUpgradeRetryFrame() {
+  BandwidthUpgradeNegotiationFrame_ClientIntroductionAck(const BandwidthUpgradeNegotiationFrame_ClientIntroductionAck& from);
+  BandwidthUpgradeNegotiationFrame_ClientIntroductionAck(BandwidthUpgradeNegotiationFrame_ClientIntroductionAck&& from) noexcept
+    : BandwidthUpgradeNegotiationFrame_ClientIntroductionAck() {
     *this = ::std::move(from);
   }
 
-  inline BandwidthUpgradeRetryFrame& operator=(const BandwidthUpgradeRetryFrame& from) {
+  inline BandwidthUpgradeNegotiationFrame_ClientIntroductionAck& operator=(const BandwidthUpgradeNegotiationFrame_ClientIntroductionAck& from) {
     CopyFrom(from);
     return *this;
   }
-  inline BandwidthUpgradeRetryFrame& operator=(BandwidthUpgradeRetryFrame&& from) noexcept {
+  inline BandwidthUpgradeNegotiationFrame_ClientIntroductionAck& operator=(BandwidthUpgradeNegotiationFrame_ClientIntroductionAck&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -5096,20 +5255,20 @@ class BandwidthUpgradeRetryFrame final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const BandwidthUpgradeRetryFrame& default_instance() {
+  static const BandwidthUpgradeNegotiationFrame_ClientIntroductionAck& default_instance() {
     return *internal_default_instance();
   }
-  static inline const BandwidthUpgradeRetryFrame* internal_default_instance() {
-    return reinterpret_cast<const BandwidthUpgradeRetryFrame*>(
-               &_BandwidthUpgradeRetryFrame_default_instance_);
+  static inline const BandwidthUpgradeNegotiationFrame_ClientIntroductionAck* internal_default_instance() {
+    return reinterpret_cast<const BandwidthUpgradeNegotiationFrame_ClientIntroductionAck*>(
+               &_BandwidthUpgradeNegotiationFrame_ClientIntroductionAck_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     19;
 
-  friend void swap(BandwidthUpgradeRetryFrame& a, BandwidthUpgradeRetryFrame& b) {
+  friend void swap(BandwidthUpgradeNegotiationFrame_ClientIntroductionAck& a, BandwidthUpgradeNegotiationFrame_ClientIntroductionAck& b) {
     a.Swap(&b);
   }
-  inline void Swap(BandwidthUpgradeRetryFrame* other) {
+  inline void Swap(BandwidthUpgradeNegotiationFrame_ClientIntroductionAck* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -5122,7 +5281,7 @@ class BandwidthUpgradeRetryFrame final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(BandwidthUpgradeRetryFrame* other) {
+  void UnsafeArenaSwap(BandwidthUpgradeNegotiationFrame_ClientIntroductionAck* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -5130,12 +5289,12 @@ class BandwidthUpgradeRetryFrame final :
 
   // implements Message ----------------------------------------------
 
-  BandwidthUpgradeRetryFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<BandwidthUpgradeRetryFrame>(arena);
+  BandwidthUpgradeNegotiationFrame_ClientIntroductionAck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BandwidthUpgradeNegotiationFrame_ClientIntroductionAck>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const BandwidthUpgradeRetryFrame& from);
-  void MergeFrom(const BandwidthUpgradeRetryFrame& from);
+  void CopyFrom(const BandwidthUpgradeNegotiationFrame_ClientIntroductionAck& from);
+  void MergeFrom(const BandwidthUpgradeNegotiationFrame_ClientIntroductionAck& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -5149,15 +5308,15 @@ class BandwidthUpgradeRetryFrame final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(BandwidthUpgradeRetryFrame* other);
+  void InternalSwap(BandwidthUpgradeNegotiationFrame_ClientIntroductionAck* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.BandwidthUpgradeRetryFrame";
+    return "location.nearby.connections.BandwidthUpgradeNegotiationFrame.ClientIntroductionAck";
   }
   protected:
-  explicit BandwidthUpgradeRetryFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BandwidthUpgradeNegotiationFrame_ClientIntroductionAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -5168,121 +5327,38 @@ class BandwidthUpgradeRetryFrame final :
 
   // nested types ----------------------------------------------------
 
-  typedef BandwidthUpgradeRetryFrame_Medium Medium;
-  static constexpr Medium UNKNOWN_MEDIUM =
-    BandwidthUpgradeRetryFrame_Medium_UNKNOWN_MEDIUM;
-  static constexpr Medium BLUETOOTH =
-    BandwidthUpgradeRetryFrame_Medium_BLUETOOTH;
-  static constexpr Medium WIFI_HOTSPOT =
-    BandwidthUpgradeRetryFrame_Medium_WIFI_HOTSPOT;
-  static constexpr Medium BLE =
-    BandwidthUpgradeRetryFrame_Medium_BLE;
-  static constexpr Medium WIFI_LAN =
-    BandwidthUpgradeRetryFrame_Medium_WIFI_LAN;
-  static constexpr Medium WIFI_AWARE =
-    BandwidthUpgradeRetryFrame_Medium_WIFI_AWARE;
-  static constexpr Medium NFC =
-    BandwidthUpgradeRetryFrame_Medium_NFC;
-  static constexpr Medium WIFI_DIRECT =
-    BandwidthUpgradeRetryFrame_Medium_WIFI_DIRECT;
-  static constexpr Medium WEB_RTC =
-    BandwidthUpgradeRetryFrame_Medium_WEB_RTC;
-  static constexpr Medium BLE_L2CAP =
-    BandwidthUpgradeRetryFrame_Medium_BLE_L2CAP;
-  static constexpr Medium USB =
-    BandwidthUpgradeRetryFrame_Medium_USB;
-  static constexpr Medium WEB_RTC_NON_CELLULAR =
-    BandwidthUpgradeRetryFrame_Medium_WEB_RTC_NON_CELLULAR;
-  static inline bool Medium_IsValid(int value) {
-    return BandwidthUpgradeRetryFrame_Medium_IsValid(value);
-  }
-  static constexpr Medium Medium_MIN =
-    BandwidthUpgradeRetryFrame_Medium_Medium_MIN;
-  static constexpr Medium Medium_MAX =
-    BandwidthUpgradeRetryFrame_Medium_Medium_MAX;
-  static constexpr int Medium_ARRAYSIZE =
-    BandwidthUpgradeRetryFrame_Medium_Medium_ARRAYSIZE;
-  template<typename T>
-  static inline const std::string& Medium_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, Medium>::value ||
-      ::std::is_integral<T>::value,
-      "Incorrect type passed to function Medium_Name.");
-    return BandwidthUpgradeRetryFrame_Medium_Name(enum_t_value);
-  }
-  static inline bool Medium_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
-      Medium* value) {
-    return BandwidthUpgradeRetryFrame_Medium_Parse(name, value);
-  }
-
   // accessors -------------------------------------------------------
 
-  enum : int {
-    kSupportedMediumFieldNumber = 1,
-    kIsRequestFieldNumber = 2,
-  };
-  // repeated .location.nearby.connections.BandwidthUpgradeRetryFrame.Medium supported_medium = 1;
-  int supported_medium_size() const;
-  private:
-  int _internal_supported_medium_size() const;
-  public:
-  void clear_supported_medium();
-  private:
-  ::location::nearby::connections::BandwidthUpgradeRetryFrame_Medium _internal_supported_medium(int index) const;
-  void _internal_add_supported_medium(::location::nearby::connections::BandwidthUpgradeRetryFrame_Medium value);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* _internal_mutable_supported_medium();
-  public:
-  ::location::nearby::connections::BandwidthUpgradeRetryFrame_Medium supported_medium(int index) const;
-  void set_supported_medium(int index, ::location::nearby::connections::BandwidthUpgradeRetryFrame_Medium value);
-  void add_supported_medium(::location::nearby::connections::BandwidthUpgradeRetryFrame_Medium value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>& supported_medium() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* mutable_supported_medium();
-
-  // optional bool is_request = 2;
-  bool has_is_request() const;
-  private:
-  bool _internal_has_is_request() const;
-  public:
-  void clear_is_request();
-  bool is_request() const;
-  void set_is_request(bool value);
-  private:
-  bool _internal_is_request() const;
-  void _internal_set_is_request(bool value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.BandwidthUpgradeRetryFrame)
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.BandwidthUpgradeNegotiationFrame.ClientIntroductionAck)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int> supported_medium_;
-  bool is_request_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class KeepAliveFrame final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.KeepAliveFrame) */ {
+class BandwidthUpgradeNegotiationFrame final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.BandwidthUpgradeNegotiationFrame) */ {
  public:
-  inline KeepAliveFrame() : KeepAliveFrame(nullptr) {}
-  ~KeepAliveFrame() override;
-  explicit constexpr KeepAliveFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline BandwidthUpgradeNegotiationFrame() : BandwidthUpgradeNegotiationFrame(nullptr) {}
+  ~BandwidthUpgradeNegotiationFrame() override;
+  explicit constexpr BandwidthUpgradeNegotiationFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  KeepAliveFrame(const KeepAliveFrame& from);
-  KeepAliveFrame(KeepAliveFrame&& from) noexcept
-    : KeepAliveFrame() {
+  BandwidthUpgradeNegotiationFrame(const BandwidthUpgradeNegotiationFrame& from);
+  BandwidthUpgradeNegotiationFrame(BandwidthUpgradeNegotiationFrame&& from) noexcept
+    : BandwidthUpgradeNegotiationFrame() {
     *this = ::std::move(from);
   }
 
-  inline KeepAliveFrame& operator=(const KeepAliveFrame& from) {
+  inline BandwidthUpgradeNegotiationFrame& operator=(const BandwidthUpgradeNegotiationFrame& from) {
     CopyFrom(from);
     return *this;
   }
-  inline KeepAliveFrame& operator=(KeepAliveFrame&& from) noexcept {
+  inline BandwidthUpgradeNegotiationFrame& operator=(BandwidthUpgradeNegotiationFrame&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -5303,20 +5379,20 @@ class KeepAliveFrame final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const KeepAliveFrame& default_instance() {
+  static const BandwidthUpgradeNegotiationFrame& default_instance() {
     return *internal_default_instance();
   }
-  static inline const KeepAliveFrame* internal_default_instance() {
-    return reinterpret_cast<const KeepAliveFrame*>(
-               &_KeepAliveFrame_default_instance_);
+  static inline const BandwidthUpgradeNegotiationFrame* internal_default_instance() {
+    return reinterpret_cast<const BandwidthUpgradeNegotiationFrame*>(
+               &_BandwidthUpgradeNegotiationFrame_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     20;
 
-  friend void swap(KeepAliveFrame& a, KeepAliveFrame& b) {
+  friend void swap(BandwidthUpgradeNegotiationFrame& a, BandwidthUpgradeNegotiationFrame& b) {
     a.Swap(&b);
   }
-  inline void Swap(KeepAliveFrame* other) {
+  inline void Swap(BandwidthUpgradeNegotiationFrame* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -5329,7 +5405,7 @@ class KeepAliveFrame final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(KeepAliveFrame* other) {
+  void UnsafeArenaSwap(BandwidthUpgradeNegotiationFrame* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -5337,12 +5413,12 @@ class KeepAliveFrame final :
 
   // implements Message ----------------------------------------------
 
-  KeepAliveFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<KeepAliveFrame>(arena);
+  BandwidthUpgradeNegotiationFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BandwidthUpgradeNegotiationFrame>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const KeepAliveFrame& from);
-  void MergeFrom(const KeepAliveFrame& from);
+  void CopyFrom(const BandwidthUpgradeNegotiationFrame& from);
+  void MergeFrom(const BandwidthUpgradeNegotiationFrame& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -5356,15 +5432,15 @@ class KeepAliveFrame final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(KeepAliveFrame* other);
+  void InternalSwap(BandwidthUpgradeNegotiationFrame* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.KeepAliveFrame";
+    return "location.nearby.connections.BandwidthUpgradeNegotiationFrame";
   }
   protected:
-  explicit KeepAliveFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BandwidthUpgradeNegotiationFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -5375,39 +5451,161 @@ class KeepAliveFrame final :
 
   // nested types ----------------------------------------------------
 
+  typedef BandwidthUpgradeNegotiationFrame_UpgradePathInfo UpgradePathInfo;
+  typedef BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel SafeToClosePriorChannel;
+  typedef BandwidthUpgradeNegotiationFrame_ClientIntroduction ClientIntroduction;
+  typedef BandwidthUpgradeNegotiationFrame_ClientIntroductionAck ClientIntroductionAck;
+
+  typedef BandwidthUpgradeNegotiationFrame_EventType EventType;
+  static constexpr EventType UNKNOWN_EVENT_TYPE =
+    BandwidthUpgradeNegotiationFrame_EventType_UNKNOWN_EVENT_TYPE;
+  static constexpr EventType UPGRADE_PATH_AVAILABLE =
+    BandwidthUpgradeNegotiationFrame_EventType_UPGRADE_PATH_AVAILABLE;
+  static constexpr EventType LAST_WRITE_TO_PRIOR_CHANNEL =
+    BandwidthUpgradeNegotiationFrame_EventType_LAST_WRITE_TO_PRIOR_CHANNEL;
+  static constexpr EventType SAFE_TO_CLOSE_PRIOR_CHANNEL =
+    BandwidthUpgradeNegotiationFrame_EventType_SAFE_TO_CLOSE_PRIOR_CHANNEL;
+  static constexpr EventType CLIENT_INTRODUCTION =
+    BandwidthUpgradeNegotiationFrame_EventType_CLIENT_INTRODUCTION;
+  static constexpr EventType UPGRADE_FAILURE =
+    BandwidthUpgradeNegotiationFrame_EventType_UPGRADE_FAILURE;
+  static constexpr EventType CLIENT_INTRODUCTION_ACK =
+    BandwidthUpgradeNegotiationFrame_EventType_CLIENT_INTRODUCTION_ACK;
+  static inline bool EventType_IsValid(int value) {
+    return BandwidthUpgradeNegotiationFrame_EventType_IsValid(value);
+  }
+  static constexpr EventType EventType_MIN =
+    BandwidthUpgradeNegotiationFrame_EventType_EventType_MIN;
+  static constexpr EventType EventType_MAX =
+    BandwidthUpgradeNegotiationFrame_EventType_EventType_MAX;
+  static constexpr int EventType_ARRAYSIZE =
+    BandwidthUpgradeNegotiationFrame_EventType_EventType_ARRAYSIZE;
+  template<typename T>
+  static inline const std::string& EventType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, EventType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function EventType_Name.");
+    return BandwidthUpgradeNegotiationFrame_EventType_Name(enum_t_value);
+  }
+  static inline bool EventType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      EventType* value) {
+    return BandwidthUpgradeNegotiationFrame_EventType_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
   enum : int {
-    kAckFieldNumber = 1,
-    kSeqNumFieldNumber = 2,
+    kAlternativeUpgradePathInfosFieldNumber = 6,
+    kUpgradePathInfoFieldNumber = 2,
+    kClientIntroductionFieldNumber = 3,
+    kClientIntroductionAckFieldNumber = 4,
+    kSafeToClosePriorChannelFieldNumber = 5,
+    kEventTypeFieldNumber = 1,
   };
-  // optional bool ack = 1;
-  bool has_ack() const;
+  // repeated .location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo alternative_upgrade_path_infos = 6;
+  int alternative_upgrade_path_infos_size() const;
   private:
-  bool _internal_has_ack() const;
+  int _internal_alternative_upgrade_path_infos_size() const;
   public:
-  void clear_ack();
-  bool ack() const;
-  void set_ack(bool value);
+  void clear_alternative_upgrade_path_infos();
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo* mutable_alternative_upgrade_path_infos(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo >*
+      mutable_alternative_upgrade_path_infos();
   private:
-  bool _internal_ack() const;
-  void _internal_set_ack(bool value);
+  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo& _internal_alternative_upgrade_path_infos(int index) const;
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo* _internal_add_alternative_upgrade_path_infos();
   public:
+  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo& alternative_upgrade_path_infos(int index) const;
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo* add_alternative_upgrade_path_infos();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo >&
+      alternative_upgrade_path_infos() const;
 
-  // optional uint32 seq_num = 2;
-  bool has_seq_num() const;
+  // optional .location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo upgrade_path_info = 2;
+  bool has_upgrade_path_info() const;
   private:
-  bool _internal_has_seq_num() const;
+  bool _internal_has_upgrade_path_info() const;
   public:
-  void clear_seq_num();
-  uint32_t seq_num() const;
-  void set_seq_num(uint32_t value);
+  void clear_upgrade_path_info();
+  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo& upgrade_path_info() const;
+  PROTOBUF_NODISCARD ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo* release_upgrade_path_info();
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo* mutable_upgrade_path_info();
+  void set_allocated_upgrade_path_info(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo* upgrade_path_info);
   private:
-  uint32_t _internal_seq_num() const;
-  void _internal_set_seq_num(uint32_t value);
+  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo& _internal_upgrade_path_info() const;
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo* _internal_mutable_upgrade_path_info();
   public:
+  void unsafe_arena_set_allocated_upgrade_path_info(
+      ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo* upgrade_path_info);
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo* unsafe_arena_release_upgrade_path_info();
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.KeepAliveFrame)
+  // optional .location.nearby.connections.BandwidthUpgradeNegotiationFrame.ClientIntroduction client_introduction = 3;
+  bool has_client_introduction() const;
+  private:
+  bool _internal_has_client_introduction() const;
+  public:
+  void clear_client_introduction();
+  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroduction& client_introduction() const;
+  PROTOBUF_NODISCARD ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroduction* release_client_introduction();
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroduction* mutable_client_introduction();
+  void set_allocated_client_introduction(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroduction* client_introduction);
+  private:
+  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroduction& _internal_client_introduction() const;
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroduction* _internal_mutable_client_introduction();
+  public:
+  void unsafe_arena_set_allocated_client_introduction(
+      ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroduction* client_introduction);
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroduction* unsafe_arena_release_client_introduction();
+
+  // optional .location.nearby.connections.BandwidthUpgradeNegotiationFrame.ClientIntroductionAck client_introduction_ack = 4;
+  bool has_client_introduction_ack() const;
+  private:
+  bool _internal_has_client_introduction_ack() const;
+  public:
+  void clear_client_introduction_ack();
+  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroductionAck& client_introduction_ack() const;
+  PROTOBUF_NODISCARD ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroductionAck* release_client_introduction_ack();
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroductionAck* mutable_client_introduction_ack();
+  void set_allocated_client_introduction_ack(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroductionAck* client_introduction_ack);
+  private:
+  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroductionAck& _internal_client_introduction_ack() const;
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroductionAck* _internal_mutable_client_introduction_ack();
+  public:
+  void unsafe_arena_set_allocated_client_introduction_ack(
+      ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroductionAck* client_introduction_ack);
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroductionAck* unsafe_arena_release_client_introduction_ack();
+
+  // optional .location.nearby.connections.BandwidthUpgradeNegotiationFrame.SafeToClosePriorChannel safe_to_close_prior_channel = 5;
+  bool has_safe_to_close_prior_channel() const;
+  private:
+  bool _internal_has_safe_to_close_prior_channel() const;
+  public:
+  void clear_safe_to_close_prior_channel();
+  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel& safe_to_close_prior_channel() const;
+  PROTOBUF_NODISCARD ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel* release_safe_to_close_prior_channel();
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel* mutable_safe_to_close_prior_channel();
+  void set_allocated_safe_to_close_prior_channel(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel* safe_to_close_prior_channel);
+  private:
+  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel& _internal_safe_to_close_prior_channel() const;
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel* _internal_mutable_safe_to_close_prior_channel();
+  public:
+  void unsafe_arena_set_allocated_safe_to_close_prior_channel(
+      ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel* safe_to_close_prior_channel);
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel* unsafe_arena_release_safe_to_close_prior_channel();
+
+  // optional .location.nearby.connections.BandwidthUpgradeNegotiationFrame.EventType event_type = 1;
+  bool has_event_type() const;
+  private:
+  bool _internal_has_event_type() const;
+  public:
+  void clear_event_type();
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_EventType event_type() const;
+  void set_event_type(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_EventType value);
+  private:
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_EventType _internal_event_type() const;
+  void _internal_set_event_type(::location::nearby::connections::BandwidthUpgradeNegotiationFrame_EventType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.BandwidthUpgradeNegotiationFrame)
  private:
   class _Internal;
 
@@ -5416,30 +5614,34 @@ class KeepAliveFrame final :
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  bool ack_;
-  uint32_t seq_num_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo > alternative_upgrade_path_infos_;
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo* upgrade_path_info_;
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroduction* client_introduction_;
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_ClientIntroductionAck* client_introduction_ack_;
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_SafeToClosePriorChannel* safe_to_close_prior_channel_;
+  int event_type_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DisconnectionFrame final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.DisconnectionFrame) */ {
+class BandwidthUpgradeRetryFrame final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.BandwidthUpgradeRetryFrame) */ {
  public:
-  inline DisconnectionFrame() : DisconnectionFrame(nullptr) {}
-  ~DisconnectionFrame() override;
-  explicit constexpr DisconnectionFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline BandwidthUpgradeRetryFrame() : BandwidthUpgradeRetryFrame(nullptr) {}
+  ~BandwidthUpgradeRetryFrame() override;
+  explicit constexpr BandwidthUpgradeRetryFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  DisconnectionFrame(const DisconnectionFrame& from);
-  DisconnectionFrame(DisconnectionFrame&& from) noexcept
-    : DisconnectionFrame() {
+  BandwidthUpgradeRetryFrame(const BandwidthUpgradeRetryFrame& from);
+  BandwidthUpgradeRetryFrame(BandwidthUpgradeRetryFrame&& from) noexcept
+    : BandwidthUpgradeRetryFrame() {
     *this = ::std::move(from);
   }
 
-  inline DisconnectionFrame& operator=(const DisconnectionFrame& from) {
+  inline BandwidthUpgradeRetryFrame& operator=(const BandwidthUpgradeRetryFrame& from) {
     CopyFrom(from);
     return *this;
   }
-  inline DisconnectionFrame& operator=(DisconnectionFrame&& from) noexcept {
+  inline BandwidthUpgradeRetryFrame& operator=(BandwidthUpgradeRetryFrame&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -5460,20 +5662,20 @@ class DisconnectionFrame final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const DisconnectionFrame& default_instance() {
+  static const BandwidthUpgradeRetryFrame& default_instance() {
     return *internal_default_instance();
   }
-  static inline const DisconnectionFrame* internal_default_instance() {
-    return reinterpret_cast<const DisconnectionFrame*>(
-               &_DisconnectionFrame_default_instance_);
+  static inline const BandwidthUpgradeRetryFrame* internal_default_instance() {
+    return reinterpret_cast<const BandwidthUpgradeRetryFrame*>(
+               &_BandwidthUpgradeRetryFrame_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     21;
 
-  friend void swap(DisconnectionFrame& a, DisconnectionFrame& b) {
+  friend void swap(BandwidthUpgradeRetryFrame& a, BandwidthUpgradeRetryFrame& b) {
     a.Swap(&b);
   }
-  inline void Swap(DisconnectionFrame* other) {
+  inline void Swap(BandwidthUpgradeRetryFrame* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -5486,7 +5688,7 @@ class DisconnectionFrame final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(DisconnectionFrame* other) {
+  void UnsafeArenaSwap(BandwidthUpgradeRetryFrame* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -5494,12 +5696,12 @@ class DisconnectionFrame final :
 
   // implements Message ----------------------------------------------
 
-  DisconnectionFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<DisconnectionFrame>(arena);
+  BandwidthUpgradeRetryFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BandwidthUpgradeRetryFrame>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const DisconnectionFrame& from);
-  void MergeFrom(const DisconnectionFrame& from);
+  void CopyFrom(const BandwidthUpgradeRetryFrame& from);
+  void MergeFrom(const BandwidthUpgradeRetryFrame& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -5513,15 +5715,15 @@ class DisconnectionFrame final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(DisconnectionFrame* other);
+  void InternalSwap(BandwidthUpgradeRetryFrame* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.DisconnectionFrame";
+    return "location.nearby.connections.BandwidthUpgradeRetryFrame";
   }
   protected:
-  explicit DisconnectionFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BandwidthUpgradeRetryFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -5532,39 +5734,89 @@ class DisconnectionFrame final :
 
   // nested types ----------------------------------------------------
 
+  typedef BandwidthUpgradeRetryFrame_Medium Medium;
+  static constexpr Medium UNKNOWN_MEDIUM =
+    BandwidthUpgradeRetryFrame_Medium_UNKNOWN_MEDIUM;
+  static constexpr Medium BLUETOOTH =
+    BandwidthUpgradeRetryFrame_Medium_BLUETOOTH;
+  static constexpr Medium WIFI_HOTSPOT =
+    BandwidthUpgradeRetryFrame_Medium_WIFI_HOTSPOT;
+  static constexpr Medium BLE =
+    BandwidthUpgradeRetryFrame_Medium_BLE;
+  static constexpr Medium WIFI_LAN =
+    BandwidthUpgradeRetryFrame_Medium_WIFI_LAN;
+  static constexpr Medium WIFI_AWARE =
+    BandwidthUpgradeRetryFrame_Medium_WIFI_AWARE;
+  static constexpr Medium NFC =
+    BandwidthUpgradeRetryFrame_Medium_NFC;
+  static constexpr Medium WIFI_DIRECT =
+    BandwidthUpgradeRetryFrame_Medium_WIFI_DIRECT;
+  static constexpr Medium WEB_RTC =
+    BandwidthUpgradeRetryFrame_Medium_WEB_RTC;
+  static constexpr Medium BLE_L2CAP =
+    BandwidthUpgradeRetryFrame_Medium_BLE_L2CAP;
+  static constexpr Medium USB =
+    BandwidthUpgradeRetryFrame_Medium_USB;
+  static constexpr Medium WEB_RTC_NON_CELLULAR =
+    BandwidthUpgradeRetryFrame_Medium_WEB_RTC_NON_CELLULAR;
+  static inline bool Medium_IsValid(int value) {
+    return BandwidthUpgradeRetryFrame_Medium_IsValid(value);
+  }
+  static constexpr Medium Medium_MIN =
+    BandwidthUpgradeRetryFrame_Medium_Medium_MIN;
+  static constexpr Medium Medium_MAX =
+    BandwidthUpgradeRetryFrame_Medium_Medium_MAX;
+  static constexpr int Medium_ARRAYSIZE =
+    BandwidthUpgradeRetryFrame_Medium_Medium_ARRAYSIZE;
+  template<typename T>
+  static inline const std::string& Medium_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Medium>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Medium_Name.");
+    return BandwidthUpgradeRetryFrame_Medium_Name(enum_t_value);
+  }
+  static inline bool Medium_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Medium* value) {
+    return BandwidthUpgradeRetryFrame_Medium_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
   enum : int {
-    kRequestSafeToDisconnectFieldNumber = 1,
-    kAckSafeToDisconnectFieldNumber = 2,
+    kSupportedMediumFieldNumber = 1,
+    kIsRequestFieldNumber = 2,
   };
-  // optional bool request_safe_to_disconnect = 1;
-  bool has_request_safe_to_disconnect() const;
+  // repeated .location.nearby.connections.BandwidthUpgradeRetryFrame.Medium supported_medium = 1;
+  int supported_medium_size() const;
   private:
-  bool _internal_has_request_safe_to_disconnect() const;
+  int _internal_supported_medium_size() const;
   public:
-  void clear_request_safe_to_disconnect();
-  bool request_safe_to_disconnect() const;
-  void set_request_safe_to_disconnect(bool value);
+  void clear_supported_medium();
   private:
-  bool _internal_request_safe_to_disconnect() const;
-  void _internal_set_request_safe_to_disconnect(bool value);
+  ::location::nearby::connections::BandwidthUpgradeRetryFrame_Medium _internal_supported_medium(int index) const;
+  void _internal_add_supported_medium(::location::nearby::connections::BandwidthUpgradeRetryFrame_Medium value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* _internal_mutable_supported_medium();
   public:
+  ::location::nearby::connections::BandwidthUpgradeRetryFrame_Medium supported_medium(int index) const;
+  void set_supported_medium(int index, ::location::nearby::connections::BandwidthUpgradeRetryFrame_Medium value);
+  void add_supported_medium(::location::nearby::connections::BandwidthUpgradeRetryFrame_Medium value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>& supported_medium() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* mutable_supported_medium();
 
-  // optional bool ack_safe_to_disconnect = 2;
-  bool has_ack_safe_to_disconnect() const;
+  // optional bool is_request = 2;
+  bool has_is_request() const;
   private:
-  bool _internal_has_ack_safe_to_disconnect() const;
+  bool _internal_has_is_request() const;
   public:
-  void clear_ack_safe_to_disconnect();
-  bool ack_safe_to_disconnect() const;
-  void set_ack_safe_to_disconnect(bool value);
+  void clear_is_request();
+  bool is_request() const;
+  void set_is_request(bool value);
   private:
-  bool _internal_ack_safe_to_disconnect() const;
-  void _internal_set_ack_safe_to_disconnect(bool value);
+  bool _internal_is_request() const;
+  void _internal_set_is_request(bool value);
   public:
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.DisconnectionFrame)
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.BandwidthUpgradeRetryFrame)
  private:
   class _Internal;
 
@@ -5573,30 +5825,30 @@ class DisconnectionFrame final :
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  bool request_safe_to_disconnect_;
-  bool ack_safe_to_disconnect_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int> supported_medium_;
+  bool is_request_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PairedKeyEncryptionFrame final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.PairedKeyEncryptionFrame) */ {
+class KeepAliveFrame final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.KeepAliveFrame) */ {
  public:
-  inline PairedKeyEncryptionFrame() : PairedKeyEncryptionFrame(nullptr) {}
-  ~PairedKeyEncryptionFrame() override;
-  explicit constexpr PairedKeyEncryptionFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline KeepAliveFrame() : KeepAliveFrame(nullptr) {}
+  ~KeepAliveFrame() override;
+  explicit constexpr KeepAliveFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  PairedKeyEncryptionFrame(const PairedKeyEncryptionFrame& from);
-  PairedKeyEncryptionFrame(PairedKeyEncryptionFrame&& from) noexcept
-    : PairedKeyEncryptionFrame() {
+  KeepAliveFrame(const KeepAliveFrame& from);
+  KeepAliveFrame(KeepAliveFrame&& from) noexcept
+    : KeepAliveFrame() {
     *this = ::std::move(from);
   }
 
-  inline PairedKeyEncryptionFrame& operator=(const PairedKeyEncryptionFrame& from) {
+  inline KeepAliveFrame& operator=(const KeepAliveFrame& from) {
     CopyFrom(from);
     return *this;
   }
-  inline PairedKeyEncryptionFrame& operator=(PairedKeyEncryptionFrame&& from) noexcept {
+  inline KeepAliveFrame& operator=(KeepAliveFrame&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -5617,20 +5869,20 @@ class PairedKeyEncryptionFrame final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const PairedKeyEncryptionFrame& default_instance() {
+  static const KeepAliveFrame& default_instance() {
     return *internal_default_instance();
   }
-  static inline const PairedKeyEncryptionFrame* internal_default_instance() {
-    return reinterpret_cast<const PairedKeyEncryptionFrame*>(
-               &_PairedKeyEncryptionFrame_default_instance_);
+  static inline const KeepAliveFrame* internal_default_instance() {
+    return reinterpret_cast<const KeepAliveFrame*>(
+               &_KeepAliveFrame_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     22;
 
-  friend void swap(PairedKeyEncryptionFrame& a, PairedKeyEncryptionFrame& b) {
+  friend void swap(KeepAliveFrame& a, KeepAliveFrame& b) {
     a.Swap(&b);
   }
-  inline void Swap(PairedKeyEncryptionFrame* other) {
+  inline void Swap(KeepAliveFrame* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -5643,7 +5895,7 @@ class PairedKeyEncryptionFrame final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(PairedKeyEncryptionFrame* other) {
+  void UnsafeArenaSwap(KeepAliveFrame* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -5651,12 +5903,12 @@ class PairedKeyEncryptionFrame final :
 
   // implements Message ----------------------------------------------
 
-  PairedKeyEncryptionFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<PairedKeyEncryptionFrame>(arena);
+  KeepAliveFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<KeepAliveFrame>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const PairedKeyEncryptionFrame& from);
-  void MergeFrom(const PairedKeyEncryptionFrame& from);
+  void CopyFrom(const KeepAliveFrame& from);
+  void MergeFrom(const KeepAliveFrame& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -5670,15 +5922,15 @@ class PairedKeyEncryptionFrame final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(PairedKeyEncryptionFrame* other);
+  void InternalSwap(KeepAliveFrame* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.PairedKeyEncryptionFrame";
+    return "location.nearby.connections.KeepAliveFrame";
   }
   protected:
-  explicit PairedKeyEncryptionFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit KeepAliveFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -5692,27 +5944,36 @@ class PairedKeyEncryptionFrame final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kSignedDataFieldNumber = 1,
+    kAckFieldNumber = 1,
+    kSeqNumFieldNumber = 2,
   };
-  // optional bytes signed_data = 1;
-  bool has_signed_data() const;
+  // optional bool ack = 1;
+  bool has_ack() const;
   private:
-  bool _internal_has_signed_data() const;
+  bool _internal_has_ack() const;
   public:
-  void clear_signed_data();
-  const std::string& signed_data() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_signed_data(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_signed_data();
-  PROTOBUF_NODISCARD std::string* release_signed_data();
-  void set_allocated_signed_data(std::string* signed_data);
+  void clear_ack();
+  bool ack() const;
+  void set_ack(bool value);
   private:
-  const std::string& _internal_signed_data() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_signed_data(const std::string& value);
-  std::string* _internal_mutable_signed_data();
+  bool _internal_ack() const;
+  void _internal_set_ack(bool value);
   public:
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.PairedKeyEncryptionFrame)
+  // optional uint32 seq_num = 2;
+  bool has_seq_num() const;
+  private:
+  bool _internal_has_seq_num() const;
+  public:
+  void clear_seq_num();
+  uint32_t seq_num() const;
+  void set_seq_num(uint32_t value);
+  private:
+  uint32_t _internal_seq_num() const;
+  void _internal_set_seq_num(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.KeepAliveFrame)
  private:
   class _Internal;
 
@@ -5721,29 +5982,30 @@ class PairedKeyEncryptionFrame final :
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr signed_data_;
+  bool ack_;
+  uint32_t seq_num_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class AuthenticationMessageFrame final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.AuthenticationMessageFrame) */ {
+class DisconnectionFrame final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.DisconnectionFrame) */ {
  public:
-  inline AuthenticationMessageFrame() : AuthenticationMessageFrame(nullptr) {}
-  ~AuthenticationMessageFrame() override;
-  explicit constexpr AuthenticationMessageFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline DisconnectionFrame() : DisconnectionFrame(nullptr) {}
+  ~DisconnectionFrame() override;
+  explicit constexpr DisconnectionFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  AuthenticationMessageFrame(const AuthenticationMessageFrame& from);
-  AuthenticationMessageFrame(AuthenticationMessageFrame&& from) noexcept
-    : AuthenticationMessageFrame() {
+  DisconnectionFrame(const DisconnectionFrame& from);
+  DisconnectionFrame(DisconnectionFrame&& from) noexcept
+    : DisconnectionFrame() {
     *this = ::std::move(from);
   }
 
-  inline AuthenticationMessageFrame& operator=(const AuthenticationMessageFrame& from) {
+  inline DisconnectionFrame& operator=(const DisconnectionFrame& from) {
     CopyFrom(from);
     return *this;
   }
-  inline AuthenticationMessageFrame& operator=(AuthenticationMessageFrame&& from) noexcept {
+  inline DisconnectionFrame& operator=(DisconnectionFrame&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -5764,20 +6026,20 @@ class AuthenticationMessageFrame final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const AuthenticationMessageFrame& default_instance() {
+  static const DisconnectionFrame& default_instance() {
     return *internal_default_instance();
   }
-  static inline const AuthenticationMessageFrame* internal_default_instance() {
-    return reinterpret_cast<const AuthenticationMessageFrame*>(
-               &_AuthenticationMessageFrame_default_instance_);
+  static inline const DisconnectionFrame* internal_default_instance() {
+    return reinterpret_cast<const DisconnectionFrame*>(
+               &_DisconnectionFrame_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     23;
 
-  friend void swap(AuthenticationMessageFrame& a, AuthenticationMessageFrame& b) {
+  friend void swap(DisconnectionFrame& a, DisconnectionFrame& b) {
     a.Swap(&b);
   }
-  inline void Swap(AuthenticationMessageFrame* other) {
+  inline void Swap(DisconnectionFrame* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -5790,7 +6052,7 @@ class AuthenticationMessageFrame final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(AuthenticationMessageFrame* other) {
+  void UnsafeArenaSwap(DisconnectionFrame* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -5798,12 +6060,12 @@ class AuthenticationMessageFrame final :
 
   // implements Message ----------------------------------------------
 
-  AuthenticationMessageFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<AuthenticationMessageFrame>(arena);
+  DisconnectionFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DisconnectionFrame>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const AuthenticationMessageFrame& from);
-  void MergeFrom(const AuthenticationMessageFrame& from);
+  void CopyFrom(const DisconnectionFrame& from);
+  void MergeFrom(const DisconnectionFrame& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -5817,15 +6079,15 @@ class AuthenticationMessageFrame final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(AuthenticationMessageFrame* other);
+  void InternalSwap(DisconnectionFrame* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.AuthenticationMessageFrame";
+    return "location.nearby.connections.DisconnectionFrame";
   }
   protected:
-  explicit AuthenticationMessageFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit DisconnectionFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -5839,27 +6101,36 @@ class AuthenticationMessageFrame final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kAuthMessageFieldNumber = 1,
+    kRequestSafeToDisconnectFieldNumber = 1,
+    kAckSafeToDisconnectFieldNumber = 2,
   };
-  // optional bytes auth_message = 1;
-  bool has_auth_message() const;
+  // optional bool request_safe_to_disconnect = 1;
+  bool has_request_safe_to_disconnect() const;
   private:
-  bool _internal_has_auth_message() const;
+  bool _internal_has_request_safe_to_disconnect() const;
   public:
-  void clear_auth_message();
-  const std::string& auth_message() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_auth_message(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_auth_message();
-  PROTOBUF_NODISCARD std::string* release_auth_message();
-  void set_allocated_auth_message(std::string* auth_message);
+  void clear_request_safe_to_disconnect();
+  bool request_safe_to_disconnect() const;
+  void set_request_safe_to_disconnect(bool value);
   private:
-  const std::string& _internal_auth_message() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_auth_message(const std::string& value);
-  std::string* _internal_mutable_auth_message();
+  bool _internal_request_safe_to_disconnect() const;
+  void _internal_set_request_safe_to_disconnect(bool value);
   public:
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.AuthenticationMessageFrame)
+  // optional bool ack_safe_to_disconnect = 2;
+  bool has_ack_safe_to_disconnect() const;
+  private:
+  bool _internal_has_ack_safe_to_disconnect() const;
+  public:
+  void clear_ack_safe_to_disconnect();
+  bool ack_safe_to_disconnect() const;
+  void set_ack_safe_to_disconnect(bool value);
+  private:
+  bool _internal_ack_safe_to_disconnect() const;
+  void _internal_set_ack_safe_to_disconnect(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.DisconnectionFrame)
  private:
   class _Internal;
 
@@ -5868,29 +6139,30 @@ class AuthenticationMessageFrame final :
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr auth_message_;
+  bool request_safe_to_disconnect_;
+  bool ack_safe_to_disconnect_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class AuthenticationResultFrame final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.AuthenticationResultFrame) */ {
+class PairedKeyEncryptionFrame final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.PairedKeyEncryptionFrame) */ {
  public:
-  inline AuthenticationResultFrame() : AuthenticationResultFrame(nullptr) {}
-  ~AuthenticationResultFrame() override;
-  explicit constexpr AuthenticationResultFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline PairedKeyEncryptionFrame() : PairedKeyEncryptionFrame(nullptr) {}
+  ~PairedKeyEncryptionFrame() override;
+  explicit constexpr PairedKeyEncryptionFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  AuthenticationResultFrame(const AuthenticationResultFrame& from);
-  AuthenticationResultFrame(AuthenticationResultFrame&& from) noexcept
-    : AuthenticationResultFrame() {
+  PairedKeyEncryptionFrame(const PairedKeyEncryptionFrame& from);
+  PairedKeyEncryptionFrame(PairedKeyEncryptionFrame&& from) noexcept
+    : PairedKeyEncryptionFrame() {
     *this = ::std::move(from);
   }
 
-  inline AuthenticationResultFrame& operator=(const AuthenticationResultFrame& from) {
+  inline PairedKeyEncryptionFrame& operator=(const PairedKeyEncryptionFrame& from) {
     CopyFrom(from);
     return *this;
   }
-  inline AuthenticationResultFrame& operator=(AuthenticationResultFrame&& from) noexcept {
+  inline PairedKeyEncryptionFrame& operator=(PairedKeyEncryptionFrame&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -5911,20 +6183,20 @@ class AuthenticationResultFrame final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const AuthenticationResultFrame& default_instance() {
+  static const PairedKeyEncryptionFrame& default_instance() {
     return *internal_default_instance();
   }
-  static inline const AuthenticationResultFrame* internal_default_instance() {
-    return reinterpret_cast<const AuthenticationResultFrame*>(
-               &_AuthenticationResultFrame_default_instance_);
+  static inline const PairedKeyEncryptionFrame* internal_default_instance() {
+    return reinterpret_cast<const PairedKeyEncryptionFrame*>(
+               &_PairedKeyEncryptionFrame_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     24;
 
-  friend void swap(AuthenticationResultFrame& a, AuthenticationResultFrame& b) {
+  friend void swap(PairedKeyEncryptionFrame& a, PairedKeyEncryptionFrame& b) {
     a.Swap(&b);
   }
-  inline void Swap(AuthenticationResultFrame* other) {
+  inline void Swap(PairedKeyEncryptionFrame* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -5937,7 +6209,7 @@ class AuthenticationResultFrame final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(AuthenticationResultFrame* other) {
+  void UnsafeArenaSwap(PairedKeyEncryptionFrame* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -5945,12 +6217,12 @@ class AuthenticationResultFrame final :
 
   // implements Message ----------------------------------------------
 
-  AuthenticationResultFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<AuthenticationResultFrame>(arena);
+  PairedKeyEncryptionFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PairedKeyEncryptionFrame>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const AuthenticationResultFrame& from);
-  void MergeFrom(const AuthenticationResultFrame& from);
+  void CopyFrom(const PairedKeyEncryptionFrame& from);
+  void MergeFrom(const PairedKeyEncryptionFrame& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -5964,15 +6236,15 @@ class AuthenticationResultFrame final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(AuthenticationResultFrame* other);
+  void InternalSwap(PairedKeyEncryptionFrame* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.AuthenticationResultFrame";
+    return "location.nearby.connections.PairedKeyEncryptionFrame";
   }
   protected:
-  explicit AuthenticationResultFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit PairedKeyEncryptionFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -5986,22 +6258,27 @@ class AuthenticationResultFrame final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kResultFieldNumber = 1,
+    kSignedDataFieldNumber = 1,
   };
-  // optional int32 result = 1;
-  bool has_result() const;
+  // optional bytes signed_data = 1;
+  bool has_signed_data() const;
   private:
-  bool _internal_has_result() const;
+  bool _internal_has_signed_data() const;
   public:
-  void clear_result();
-  int32_t result() const;
-  void set_result(int32_t value);
+  void clear_signed_data();
+  const std::string& signed_data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_signed_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_signed_data();
+  PROTOBUF_NODISCARD std::string* release_signed_data();
+  void set_allocated_signed_data(std::string* signed_data);
   private:
-  int32_t _internal_result() const;
-  void _internal_set_result(int32_t value);
+  const std::string& _internal_signed_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_signed_data(const std::string& value);
+  std::string* _internal_mutable_signed_data();
   public:
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.AuthenticationResultFrame)
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.PairedKeyEncryptionFrame)
  private:
   class _Internal;
 
@@ -6010,29 +6287,29 @@ class AuthenticationResultFrame final :
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  int32_t result_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr signed_data_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class AutoResumeFrame final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.AutoResumeFrame) */ {
+class AuthenticationMessageFrame final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.AuthenticationMessageFrame) */ {
  public:
-  inline AutoResumeFrame() : AutoResumeFrame(nullptr) {}
-  ~AutoResumeFrame() override;
-  explicit constexpr AutoResumeFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline AuthenticationMessageFrame() : AuthenticationMessageFrame(nullptr) {}
+  ~AuthenticationMessageFrame() override;
+  explicit constexpr AuthenticationMessageFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  AutoResumeFrame(const AutoResumeFrame& from);
-  AutoResumeFrame(AutoResumeFrame&& from) noexcept
-    : AutoResumeFrame() {
+  AuthenticationMessageFrame(const AuthenticationMessageFrame& from);
+  AuthenticationMessageFrame(AuthenticationMessageFrame&& from) noexcept
+    : AuthenticationMessageFrame() {
     *this = ::std::move(from);
   }
 
-  inline AutoResumeFrame& operator=(const AutoResumeFrame& from) {
+  inline AuthenticationMessageFrame& operator=(const AuthenticationMessageFrame& from) {
     CopyFrom(from);
     return *this;
   }
-  inline AutoResumeFrame& operator=(AutoResumeFrame&& from) noexcept {
+  inline AuthenticationMessageFrame& operator=(AuthenticationMessageFrame&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -6053,20 +6330,20 @@ class AutoResumeFrame final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const AutoResumeFrame& default_instance() {
+  static const AuthenticationMessageFrame& default_instance() {
     return *internal_default_instance();
   }
-  static inline const AutoResumeFrame* internal_default_instance() {
-    return reinterpret_cast<const AutoResumeFrame*>(
-               &_AutoResumeFrame_default_instance_);
+  static inline const AuthenticationMessageFrame* internal_default_instance() {
+    return reinterpret_cast<const AuthenticationMessageFrame*>(
+               &_AuthenticationMessageFrame_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     25;
 
-  friend void swap(AutoResumeFrame& a, AutoResumeFrame& b) {
+  friend void swap(AuthenticationMessageFrame& a, AuthenticationMessageFrame& b) {
     a.Swap(&b);
   }
-  inline void Swap(AutoResumeFrame* other) {
+  inline void Swap(AuthenticationMessageFrame* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -6079,7 +6356,7 @@ class AutoResumeFrame final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(AutoResumeFrame* other) {
+  void UnsafeArenaSwap(AuthenticationMessageFrame* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -6087,12 +6364,12 @@ class AutoResumeFrame final :
 
   // implements Message ----------------------------------------------
 
-  AutoResumeFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<AutoResumeFrame>(arena);
+  AuthenticationMessageFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AuthenticationMessageFrame>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const AutoResumeFrame& from);
-  void MergeFrom(const AutoResumeFrame& from);
+  void CopyFrom(const AuthenticationMessageFrame& from);
+  void MergeFrom(const AuthenticationMessageFrame& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -6106,15 +6383,15 @@ class AutoResumeFrame final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(AutoResumeFrame* other);
+  void InternalSwap(AuthenticationMessageFrame* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.AutoResumeFrame";
+    return "location.nearby.connections.AuthenticationMessageFrame";
   }
   protected:
-  explicit AutoResumeFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit AuthenticationMessageFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -6125,81 +6402,30 @@ class AutoResumeFrame final :
 
   // nested types ----------------------------------------------------
 
-  typedef AutoResumeFrame_EventType EventType;
-  static constexpr EventType UNKNOWN_AUTO_RESUME_EVENT_TYPE =
-    AutoResumeFrame_EventType_UNKNOWN_AUTO_RESUME_EVENT_TYPE;
-  static constexpr EventType PAYLOAD_RESUME_TRANSFER_START =
-    AutoResumeFrame_EventType_PAYLOAD_RESUME_TRANSFER_START;
-  static constexpr EventType PAYLOAD_RESUME_TRANSFER_ACK =
-    AutoResumeFrame_EventType_PAYLOAD_RESUME_TRANSFER_ACK;
-  static inline bool EventType_IsValid(int value) {
-    return AutoResumeFrame_EventType_IsValid(value);
-  }
-  static constexpr EventType EventType_MIN =
-    AutoResumeFrame_EventType_EventType_MIN;
-  static constexpr EventType EventType_MAX =
-    AutoResumeFrame_EventType_EventType_MAX;
-  static constexpr int EventType_ARRAYSIZE =
-    AutoResumeFrame_EventType_EventType_ARRAYSIZE;
-  template<typename T>
-  static inline const std::string& EventType_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, EventType>::value ||
-      ::std::is_integral<T>::value,
-      "Incorrect type passed to function EventType_Name.");
-    return AutoResumeFrame_EventType_Name(enum_t_value);
-  }
-  static inline bool EventType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
-      EventType* value) {
-    return AutoResumeFrame_EventType_Parse(name, value);
-  }
-
   // accessors -------------------------------------------------------
 
   enum : int {
-    kPendingPayloadIdFieldNumber = 2,
-    kEventTypeFieldNumber = 1,
-    kNextPayloadChunkIndexFieldNumber = 3,
+    kAuthMessageFieldNumber = 1,
   };
-  // optional int64 pending_payload_id = 2;
-  bool has_pending_payload_id() const;
-  private:
-  bool _internal_has_pending_payload_id() const;
-  public:
-  void clear_pending_payload_id();
-  int64_t pending_payload_id() const;
-  void set_pending_payload_id(int64_t value);
-  private:
-  int64_t _internal_pending_payload_id() const;
-  void _internal_set_pending_payload_id(int64_t value);
-  public:
-
-  // optional .location.nearby.connections.AutoResumeFrame.EventType event_type = 1;
-  bool has_event_type() const;
-  private:
-  bool _internal_has_event_type() const;
-  public:
-  void clear_event_type();
-  ::location::nearby::connections::AutoResumeFrame_EventType event_type() const;
-  void set_event_type(::location::nearby::connections::AutoResumeFrame_EventType value);
-  private:
-  ::location::nearby::connections::AutoResumeFrame_EventType _internal_event_type() const;
-  void _internal_set_event_type(::location::nearby::connections::AutoResumeFrame_EventType value);
-  public:
-
-  // optional int32 next_payload_chunk_index = 3;
-  bool has_next_payload_chunk_index() const;
+  // optional bytes auth_message = 1;
+  bool has_auth_message() const;
   private:
-  bool _internal_has_next_payload_chunk_index() const;
+  bool _internal_has_auth_message() const;
   public:
-  void clear_next_payload_chunk_index();
-  int32_t next_payload_chunk_index() const;
-  void set_next_payload_chunk_index(int32_t value);
+  void clear_auth_message();
+  const std::string& auth_message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_auth_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_auth_message();
+  PROTOBUF_NODISCARD std::string* release_auth_message();
+  void set_allocated_auth_message(std::string* auth_message);
   private:
-  int32_t _internal_next_payload_chunk_index() const;
-  void _internal_set_next_payload_chunk_index(int32_t value);
+  const std::string& _internal_auth_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_auth_message(const std::string& value);
+  std::string* _internal_mutable_auth_message();
   public:
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.AutoResumeFrame)
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.AuthenticationMessageFrame)
  private:
   class _Internal;
 
@@ -6208,31 +6434,29 @@ class AutoResumeFrame final :
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  int64_t pending_payload_id_;
-  int event_type_;
-  int32_t next_payload_chunk_index_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr auth_message_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class AutoReconnectFrame final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.AutoReconnectFrame) */ {
+class AuthenticationResultFrame final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.AuthenticationResultFrame) */ {
  public:
-  inline AutoReconnectFrame() : AutoReconnectFrame(nullptr) {}
-  ~AutoReconnectFrame() override;
-  explicit constexpr AutoReconnectFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline AuthenticationResultFrame() : AuthenticationResultFrame(nullptr) {}
+  ~AuthenticationResultFrame() override;
+  explicit constexpr AuthenticationResultFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  AutoReconnectFrame(const AutoReconnectFrame& from);
-  AutoReconnectFrame(AutoReconnectFrame&& from) noexcept
-    : AutoReconnectFrame() {
-    *this = ::std::move(from);
+  AuthenticationResultFrame(const AuthenticationResultFrame& from);
+  AuthenticationResultFrame(AuthenticationResultFrame&& from) noexcept
+    : AuthenticationResultFrame() {
+    *this = ::std::move(from);
   }
 
-  inline AutoReconnectFrame& operator=(const AutoReconnectFrame& from) {
+  inline AuthenticationResultFrame& operator=(const AuthenticationResultFrame& from) {
     CopyFrom(from);
     return *this;
   }
-  inline AutoReconnectFrame& operator=(AutoReconnectFrame&& from) noexcept {
+  inline AuthenticationResultFrame& operator=(AuthenticationResultFrame&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -6253,20 +6477,20 @@ class AutoReconnectFrame final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const AutoReconnectFrame& default_instance() {
+  static const AuthenticationResultFrame& default_instance() {
     return *internal_default_instance();
   }
-  static inline const AutoReconnectFrame* internal_default_instance() {
-    return reinterpret_cast<const AutoReconnectFrame*>(
-               &_AutoReconnectFrame_default_instance_);
+  static inline const AuthenticationResultFrame* internal_default_instance() {
+    return reinterpret_cast<const AuthenticationResultFrame*>(
+               &_AuthenticationResultFrame_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     26;
 
-  friend void swap(AutoReconnectFrame& a, AutoReconnectFrame& b) {
+  friend void swap(AuthenticationResultFrame& a, AuthenticationResultFrame& b) {
     a.Swap(&b);
   }
-  inline void Swap(AutoReconnectFrame* other) {
+  inline void Swap(AuthenticationResultFrame* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -6279,7 +6503,7 @@ class AutoReconnectFrame final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(AutoReconnectFrame* other) {
+  void UnsafeArenaSwap(AuthenticationResultFrame* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -6287,12 +6511,12 @@ class AutoReconnectFrame final :
 
   // implements Message ----------------------------------------------
 
-  AutoReconnectFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<AutoReconnectFrame>(arena);
+  AuthenticationResultFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AuthenticationResultFrame>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const AutoReconnectFrame& from);
-  void MergeFrom(const AutoReconnectFrame& from);
+  void CopyFrom(const AuthenticationResultFrame& from);
+  void MergeFrom(const AuthenticationResultFrame& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -6306,15 +6530,15 @@ class AutoReconnectFrame final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(AutoReconnectFrame* other);
+  void InternalSwap(AuthenticationResultFrame* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.AutoReconnectFrame";
+    return "location.nearby.connections.AuthenticationResultFrame";
   }
   protected:
-  explicit AutoReconnectFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit AuthenticationResultFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -6325,72 +6549,25 @@ class AutoReconnectFrame final :
 
   // nested types ----------------------------------------------------
 
-  typedef AutoReconnectFrame_EventType EventType;
-  static constexpr EventType UNKNOWN_EVENT_TYPE =
-    AutoReconnectFrame_EventType_UNKNOWN_EVENT_TYPE;
-  static constexpr EventType CLIENT_INTRODUCTION =
-    AutoReconnectFrame_EventType_CLIENT_INTRODUCTION;
-  static constexpr EventType CLIENT_INTRODUCTION_ACK =
-    AutoReconnectFrame_EventType_CLIENT_INTRODUCTION_ACK;
-  static inline bool EventType_IsValid(int value) {
-    return AutoReconnectFrame_EventType_IsValid(value);
-  }
-  static constexpr EventType EventType_MIN =
-    AutoReconnectFrame_EventType_EventType_MIN;
-  static constexpr EventType EventType_MAX =
-    AutoReconnectFrame_EventType_EventType_MAX;
-  static constexpr int EventType_ARRAYSIZE =
-    AutoReconnectFrame_EventType_EventType_ARRAYSIZE;
-  template<typename T>
-  static inline const std::string& EventType_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, EventType>::value ||
-      ::std::is_integral<T>::value,
-      "Incorrect type passed to function EventType_Name.");
-    return AutoReconnectFrame_EventType_Name(enum_t_value);
-  }
-  static inline bool EventType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
-      EventType* value) {
-    return AutoReconnectFrame_EventType_Parse(name, value);
-  }
-
   // accessors -------------------------------------------------------
 
   enum : int {
-    kEndpointIdFieldNumber = 1,
-    kEventTypeFieldNumber = 2,
+    kResultFieldNumber = 1,
   };
-  // optional string endpoint_id = 1;
-  bool has_endpoint_id() const;
-  private:
-  bool _internal_has_endpoint_id() const;
-  public:
-  void clear_endpoint_id();
-  const std::string& endpoint_id() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_endpoint_id(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_endpoint_id();
-  PROTOBUF_NODISCARD std::string* release_endpoint_id();
-  void set_allocated_endpoint_id(std::string* endpoint_id);
-  private:
-  const std::string& _internal_endpoint_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_endpoint_id(const std::string& value);
-  std::string* _internal_mutable_endpoint_id();
-  public:
-
-  // optional .location.nearby.connections.AutoReconnectFrame.EventType event_type = 2;
-  bool has_event_type() const;
+  // optional int32 result = 1;
+  bool has_result() const;
   private:
-  bool _internal_has_event_type() const;
+  bool _internal_has_result() const;
   public:
-  void clear_event_type();
-  ::location::nearby::connections::AutoReconnectFrame_EventType event_type() const;
-  void set_event_type(::location::nearby::connections::AutoReconnectFrame_EventType value);
+  void clear_result();
+  int32_t result() const;
+  void set_result(int32_t value);
   private:
-  ::location::nearby::connections::AutoReconnectFrame_EventType _internal_event_type() const;
-  void _internal_set_event_type(::location::nearby::connections::AutoReconnectFrame_EventType value);
+  int32_t _internal_result() const;
+  void _internal_set_result(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.AutoReconnectFrame)
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.AuthenticationResultFrame)
  private:
   class _Internal;
 
@@ -6399,30 +6576,29 @@ class AutoReconnectFrame final :
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr endpoint_id_;
-  int event_type_;
+  int32_t result_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class MediumMetadata final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.MediumMetadata) */ {
+class AutoResumeFrame final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.AutoResumeFrame) */ {
  public:
-  inline MediumMetadata() : MediumMetadata(nullptr) {}
-  ~MediumMetadata() override;
-  explicit constexpr MediumMetadata(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline AutoResumeFrame() : AutoResumeFrame(nullptr) {}
+  ~AutoResumeFrame() override;
+  explicit constexpr AutoResumeFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  MediumMetadata(const MediumMetadata& from);
-  MediumMetadata(MediumMetadata&& from) noexcept
-    : MediumMetadata() {
+  AutoResumeFrame(const AutoResumeFrame& from);
+  AutoResumeFrame(AutoResumeFrame&& from) noexcept
+    : AutoResumeFrame() {
     *this = ::std::move(from);
   }
 
-  inline MediumMetadata& operator=(const MediumMetadata& from) {
+  inline AutoResumeFrame& operator=(const AutoResumeFrame& from) {
     CopyFrom(from);
     return *this;
   }
-  inline MediumMetadata& operator=(MediumMetadata&& from) noexcept {
+  inline AutoResumeFrame& operator=(AutoResumeFrame&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -6443,20 +6619,20 @@ class MediumMetadata final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const MediumMetadata& default_instance() {
+  static const AutoResumeFrame& default_instance() {
     return *internal_default_instance();
   }
-  static inline const MediumMetadata* internal_default_instance() {
-    return reinterpret_cast<const MediumMetadata*>(
-               &_MediumMetadata_default_instance_);
+  static inline const AutoResumeFrame* internal_default_instance() {
+    return reinterpret_cast<const AutoResumeFrame*>(
+               &_AutoResumeFrame_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     27;
 
-  friend void swap(MediumMetadata& a, MediumMetadata& b) {
+  friend void swap(AutoResumeFrame& a, AutoResumeFrame& b) {
     a.Swap(&b);
   }
-  inline void Swap(MediumMetadata* other) {
+  inline void Swap(AutoResumeFrame* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -6469,7 +6645,7 @@ class MediumMetadata final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(MediumMetadata* other) {
+  void UnsafeArenaSwap(AutoResumeFrame* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -6477,12 +6653,12 @@ class MediumMetadata final :
 
   // implements Message ----------------------------------------------
 
-  MediumMetadata* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<MediumMetadata>(arena);
+  AutoResumeFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AutoResumeFrame>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const MediumMetadata& from);
-  void MergeFrom(const MediumMetadata& from);
+  void CopyFrom(const AutoResumeFrame& from);
+  void MergeFrom(const AutoResumeFrame& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -6496,15 +6672,15 @@ class MediumMetadata final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(MediumMetadata* other);
+  void InternalSwap(AutoResumeFrame* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.MediumMetadata";
+    return "location.nearby.connections.AutoResumeFrame";
   }
   protected:
-  explicit MediumMetadata(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit AutoResumeFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -6515,200 +6691,81 @@ class MediumMetadata final :
 
   // nested types ----------------------------------------------------
 
+  typedef AutoResumeFrame_EventType EventType;
+  static constexpr EventType UNKNOWN_AUTO_RESUME_EVENT_TYPE =
+    AutoResumeFrame_EventType_UNKNOWN_AUTO_RESUME_EVENT_TYPE;
+  static constexpr EventType PAYLOAD_RESUME_TRANSFER_START =
+    AutoResumeFrame_EventType_PAYLOAD_RESUME_TRANSFER_START;
+  static constexpr EventType PAYLOAD_RESUME_TRANSFER_ACK =
+    AutoResumeFrame_EventType_PAYLOAD_RESUME_TRANSFER_ACK;
+  static inline bool EventType_IsValid(int value) {
+    return AutoResumeFrame_EventType_IsValid(value);
+  }
+  static constexpr EventType EventType_MIN =
+    AutoResumeFrame_EventType_EventType_MIN;
+  static constexpr EventType EventType_MAX =
+    AutoResumeFrame_EventType_EventType_MAX;
+  static constexpr int EventType_ARRAYSIZE =
+    AutoResumeFrame_EventType_EventType_ARRAYSIZE;
+  template<typename T>
+  static inline const std::string& EventType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, EventType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function EventType_Name.");
+    return AutoResumeFrame_EventType_Name(enum_t_value);
+  }
+  static inline bool EventType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      EventType* value) {
+    return AutoResumeFrame_EventType_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
   enum : int {
-    kBssidFieldNumber = 2,
-    kIpAddressFieldNumber = 3,
-    kAvailableChannelsFieldNumber = 7,
-    kWifiDirectCliUsableChannelsFieldNumber = 8,
-    kWifiLanUsableChannelsFieldNumber = 9,
-    kWifiAwareUsableChannelsFieldNumber = 10,
-    kWifiHotspotStaUsableChannelsFieldNumber = 11,
-    kSupports5GhzFieldNumber = 1,
-    kSupports6GhzFieldNumber = 4,
-    kMobileRadioFieldNumber = 5,
-    kApFrequencyFieldNumber = 6,
+    kPendingPayloadIdFieldNumber = 2,
+    kEventTypeFieldNumber = 1,
+    kNextPayloadChunkIndexFieldNumber = 3,
   };
-  // optional string bssid = 2;
-  bool has_bssid() const;
+  // optional int64 pending_payload_id = 2;
+  bool has_pending_payload_id() const;
   private:
-  bool _internal_has_bssid() const;
+  bool _internal_has_pending_payload_id() const;
   public:
-  void clear_bssid();
-  const std::string& bssid() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_bssid(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_bssid();
-  PROTOBUF_NODISCARD std::string* release_bssid();
-  void set_allocated_bssid(std::string* bssid);
+  void clear_pending_payload_id();
+  int64_t pending_payload_id() const;
+  void set_pending_payload_id(int64_t value);
   private:
-  const std::string& _internal_bssid() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_bssid(const std::string& value);
-  std::string* _internal_mutable_bssid();
+  int64_t _internal_pending_payload_id() const;
+  void _internal_set_pending_payload_id(int64_t value);
   public:
 
-  // optional bytes ip_address = 3;
-  bool has_ip_address() const;
+  // optional .location.nearby.connections.AutoResumeFrame.EventType event_type = 1;
+  bool has_event_type() const;
   private:
-  bool _internal_has_ip_address() const;
+  bool _internal_has_event_type() const;
   public:
-  void clear_ip_address();
-  const std::string& ip_address() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_ip_address(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_ip_address();
-  PROTOBUF_NODISCARD std::string* release_ip_address();
-  void set_allocated_ip_address(std::string* ip_address);
+  void clear_event_type();
+  ::location::nearby::connections::AutoResumeFrame_EventType event_type() const;
+  void set_event_type(::location::nearby::connections::AutoResumeFrame_EventType value);
   private:
-  const std::string& _internal_ip_address() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip_address(const std::string& value);
-  std::string* _internal_mutable_ip_address();
+  ::location::nearby::connections::AutoResumeFrame_EventType _internal_event_type() const;
+  void _internal_set_event_type(::location::nearby::connections::AutoResumeFrame_EventType value);
   public:
 
-  // optional .location.nearby.connections.AvailableChannels available_channels = 7;
-  bool has_available_channels() const;
+  // optional int32 next_payload_chunk_index = 3;
+  bool has_next_payload_chunk_index() const;
   private:
-  bool _internal_has_available_channels() const;
+  bool _internal_has_next_payload_chunk_index() const;
   public:
-  void clear_available_channels();
-  const ::location::nearby::connections::AvailableChannels& available_channels() const;
-  PROTOBUF_NODISCARD ::location::nearby::connections::AvailableChannels* release_available_channels();
-  ::location::nearby::connections::AvailableChannels* mutable_available_channels();
-  void set_allocated_available_channels(::location::nearby::connections::AvailableChannels* available_channels);
+  void clear_next_payload_chunk_index();
+  int32_t next_payload_chunk_index() const;
+  void set_next_payload_chunk_index(int32_t value);
   private:
-  const ::location::nearby::connections::AvailableChannels& _internal_available_channels() const;
-  ::location::nearby::connections::AvailableChannels* _internal_mutable_available_channels();
-  public:
-  void unsafe_arena_set_allocated_available_channels(
-      ::location::nearby::connections::AvailableChannels* available_channels);
-  ::location::nearby::connections::AvailableChannels* unsafe_arena_release_available_channels();
-
-  // optional .location.nearby.connections.WifiDirectCliUsableChannels wifi_direct_cli_usable_channels = 8;
-  bool has_wifi_direct_cli_usable_channels() const;
-  private:
-  bool _internal_has_wifi_direct_cli_usable_channels() const;
-  public:
-  void clear_wifi_direct_cli_usable_channels();
-  const ::location::nearby::connections::WifiDirectCliUsableChannels& wifi_direct_cli_usable_channels() const;
-  PROTOBUF_NODISCARD ::location::nearby::connections::WifiDirectCliUsableChannels* release_wifi_direct_cli_usable_channels();
-  ::location::nearby::connections::WifiDirectCliUsableChannels* mutable_wifi_direct_cli_usable_channels();
-  void set_allocated_wifi_direct_cli_usable_channels(::location::nearby::connections::WifiDirectCliUsableChannels* wifi_direct_cli_usable_channels);
-  private:
-  const ::location::nearby::connections::WifiDirectCliUsableChannels& _internal_wifi_direct_cli_usable_channels() const;
-  ::location::nearby::connections::WifiDirectCliUsableChannels* _internal_mutable_wifi_direct_cli_usable_channels();
-  public:
-  void unsafe_arena_set_allocated_wifi_direct_cli_usable_channels(
-      ::location::nearby::connections::WifiDirectCliUsableChannels* wifi_direct_cli_usable_channels);
-  ::location::nearby::connections::WifiDirectCliUsableChannels* unsafe_arena_release_wifi_direct_cli_usable_channels();
-
-  // optional .location.nearby.connections.WifiLanUsableChannels wifi_lan_usable_channels = 9;
-  bool has_wifi_lan_usable_channels() const;
-  private:
-  bool _internal_has_wifi_lan_usable_channels() const;
-  public:
-  void clear_wifi_lan_usable_channels();
-  const ::location::nearby::connections::WifiLanUsableChannels& wifi_lan_usable_channels() const;
-  PROTOBUF_NODISCARD ::location::nearby::connections::WifiLanUsableChannels* release_wifi_lan_usable_channels();
-  ::location::nearby::connections::WifiLanUsableChannels* mutable_wifi_lan_usable_channels();
-  void set_allocated_wifi_lan_usable_channels(::location::nearby::connections::WifiLanUsableChannels* wifi_lan_usable_channels);
-  private:
-  const ::location::nearby::connections::WifiLanUsableChannels& _internal_wifi_lan_usable_channels() const;
-  ::location::nearby::connections::WifiLanUsableChannels* _internal_mutable_wifi_lan_usable_channels();
-  public:
-  void unsafe_arena_set_allocated_wifi_lan_usable_channels(
-      ::location::nearby::connections::WifiLanUsableChannels* wifi_lan_usable_channels);
-  ::location::nearby::connections::WifiLanUsableChannels* unsafe_arena_release_wifi_lan_usable_channels();
-
-  // optional .location.nearby.connections.WifiAwareUsableChannels wifi_aware_usable_channels = 10;
-  bool has_wifi_aware_usable_channels() const;
-  private:
-  bool _internal_has_wifi_aware_usable_channels() const;
-  public:
-  void clear_wifi_aware_usable_channels();
-  const ::location::nearby::connections::WifiAwareUsableChannels& wifi_aware_usable_channels() const;
-  PROTOBUF_NODISCARD ::location::nearby::connections::WifiAwareUsableChannels* release_wifi_aware_usable_channels();
-  ::location::nearby::connections::WifiAwareUsableChannels* mutable_wifi_aware_usable_channels();
-  void set_allocated_wifi_aware_usable_channels(::location::nearby::connections::WifiAwareUsableChannels* wifi_aware_usable_channels);
-  private:
-  const ::location::nearby::connections::WifiAwareUsableChannels& _internal_wifi_aware_usable_channels() const;
-  ::location::nearby::connections::WifiAwareUsableChannels* _internal_mutable_wifi_aware_usable_channels();
-  public:
-  void unsafe_arena_set_allocated_wifi_aware_usable_channels(
-      ::location::nearby::connections::WifiAwareUsableChannels* wifi_aware_usable_channels);
-  ::location::nearby::connections::WifiAwareUsableChannels* unsafe_arena_release_wifi_aware_usable_channels();
-
-  // optional .location.nearby.connections.WifiHotspotStaUsableChannels wifi_hotspot_sta_usable_channels = 11;
-  bool has_wifi_hotspot_sta_usable_channels() const;
-  private:
-  bool _internal_has_wifi_hotspot_sta_usable_channels() const;
-  public:
-  void clear_wifi_hotspot_sta_usable_channels();
-  const ::location::nearby::connections::WifiHotspotStaUsableChannels& wifi_hotspot_sta_usable_channels() const;
-  PROTOBUF_NODISCARD ::location::nearby::connections::WifiHotspotStaUsableChannels* release_wifi_hotspot_sta_usable_channels();
-  ::location::nearby::connections::WifiHotspotStaUsableChannels* mutable_wifi_hotspot_sta_usable_channels();
-  void set_allocated_wifi_hotspot_sta_usable_channels(::location::nearby::connections::WifiHotspotStaUsableChannels* wifi_hotspot_sta_usable_channels);
-  private:
-  const ::location::nearby::connections::WifiHotspotStaUsableChannels& _internal_wifi_hotspot_sta_usable_channels() const;
-  ::location::nearby::connections::WifiHotspotStaUsableChannels* _internal_mutable_wifi_hotspot_sta_usable_channels();
-  public:
-  void unsafe_arena_set_allocated_wifi_hotspot_sta_usable_channels(
-      ::location::nearby::connections::WifiHotspotStaUsableChannels* wifi_hotspot_sta_usable_channels);
-  ::location::nearby::connections::WifiHotspotStaUsableChannels* unsafe_arena_release_wifi_hotspot_sta_usable_channels();
-
-  // optional bool supports_5_ghz = 1;
-  bool has_supports_5_ghz() const;
-  private:
-  bool _internal_has_supports_5_ghz() const;
-  public:
-  void clear_supports_5_ghz();
-  bool supports_5_ghz() const;
-  void set_supports_5_ghz(bool value);
-  private:
-  bool _internal_supports_5_ghz() const;
-  void _internal_set_supports_5_ghz(bool value);
-  public:
-
-  // optional bool supports_6_ghz = 4;
-  bool has_supports_6_ghz() const;
-  private:
-  bool _internal_has_supports_6_ghz() const;
-  public:
-  void clear_supports_6_ghz();
-  bool supports_6_ghz() const;
-  void set_supports_6_ghz(bool value);
-  private:
-  bool _internal_supports_6_ghz() const;
-  void _internal_set_supports_6_ghz(bool value);
-  public:
-
-  // optional bool mobile_radio = 5;
-  bool has_mobile_radio() const;
-  private:
-  bool _internal_has_mobile_radio() const;
-  public:
-  void clear_mobile_radio();
-  bool mobile_radio() const;
-  void set_mobile_radio(bool value);
-  private:
-  bool _internal_mobile_radio() const;
-  void _internal_set_mobile_radio(bool value);
-  public:
-
-  // optional int32 ap_frequency = 6 [default = -1];
-  bool has_ap_frequency() const;
-  private:
-  bool _internal_has_ap_frequency() const;
-  public:
-  void clear_ap_frequency();
-  int32_t ap_frequency() const;
-  void set_ap_frequency(int32_t value);
-  private:
-  int32_t _internal_ap_frequency() const;
-  void _internal_set_ap_frequency(int32_t value);
+  int32_t _internal_next_payload_chunk_index() const;
+  void _internal_set_next_payload_chunk_index(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.MediumMetadata)
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.AutoResumeFrame)
  private:
   class _Internal;
 
@@ -6717,39 +6774,31 @@ class MediumMetadata final :
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr bssid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_address_;
-  ::location::nearby::connections::AvailableChannels* available_channels_;
-  ::location::nearby::connections::WifiDirectCliUsableChannels* wifi_direct_cli_usable_channels_;
-  ::location::nearby::connections::WifiLanUsableChannels* wifi_lan_usable_channels_;
-  ::location::nearby::connections::WifiAwareUsableChannels* wifi_aware_usable_channels_;
-  ::location::nearby::connections::WifiHotspotStaUsableChannels* wifi_hotspot_sta_usable_channels_;
-  bool supports_5_ghz_;
-  bool supports_6_ghz_;
-  bool mobile_radio_;
-  int32_t ap_frequency_;
+  int64_t pending_payload_id_;
+  int event_type_;
+  int32_t next_payload_chunk_index_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class AvailableChannels final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.AvailableChannels) */ {
+class AutoReconnectFrame final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.AutoReconnectFrame) */ {
  public:
-  inline AvailableChannels() : AvailableChannels(nullptr) {}
-  ~AvailableChannels() override;
-  explicit constexpr AvailableChannels(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline AutoReconnectFrame() : AutoReconnectFrame(nullptr) {}
+  ~AutoReconnectFrame() override;
+  explicit constexpr AutoReconnectFrame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  AvailableChannels(const AvailableChannels& from);
-  AvailableChannels(AvailableChannels&& from) noexcept
-    : AvailableChannels() {
+  AutoReconnectFrame(const AutoReconnectFrame& from);
+  AutoReconnectFrame(AutoReconnectFrame&& from) noexcept
+    : AutoReconnectFrame() {
     *this = ::std::move(from);
   }
 
-  inline AvailableChannels& operator=(const AvailableChannels& from) {
+  inline AutoReconnectFrame& operator=(const AutoReconnectFrame& from) {
     CopyFrom(from);
     return *this;
   }
-  inline AvailableChannels& operator=(AvailableChannels&& from) noexcept {
+  inline AutoReconnectFrame& operator=(AutoReconnectFrame&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -6770,20 +6819,20 @@ class AvailableChannels final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const AvailableChannels& default_instance() {
+  static const AutoReconnectFrame& default_instance() {
     return *internal_default_instance();
   }
-  static inline const AvailableChannels* internal_default_instance() {
-    return reinterpret_cast<const AvailableChannels*>(
-               &_AvailableChannels_default_instance_);
+  static inline const AutoReconnectFrame* internal_default_instance() {
+    return reinterpret_cast<const AutoReconnectFrame*>(
+               &_AutoReconnectFrame_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     28;
 
-  friend void swap(AvailableChannels& a, AvailableChannels& b) {
+  friend void swap(AutoReconnectFrame& a, AutoReconnectFrame& b) {
     a.Swap(&b);
   }
-  inline void Swap(AvailableChannels* other) {
+  inline void Swap(AutoReconnectFrame* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -6796,7 +6845,7 @@ class AvailableChannels final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(AvailableChannels* other) {
+  void UnsafeArenaSwap(AutoReconnectFrame* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -6804,12 +6853,12 @@ class AvailableChannels final :
 
   // implements Message ----------------------------------------------
 
-  AvailableChannels* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<AvailableChannels>(arena);
+  AutoReconnectFrame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AutoReconnectFrame>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const AvailableChannels& from);
-  void MergeFrom(const AvailableChannels& from);
+  void CopyFrom(const AutoReconnectFrame& from);
+  void MergeFrom(const AutoReconnectFrame& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -6823,15 +6872,15 @@ class AvailableChannels final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(AvailableChannels* other);
+  void InternalSwap(AutoReconnectFrame* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.AvailableChannels";
+    return "location.nearby.connections.AutoReconnectFrame";
   }
   protected:
-  explicit AvailableChannels(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit AutoReconnectFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -6842,216 +6891,104 @@ class AvailableChannels final :
 
   // nested types ----------------------------------------------------
 
+  typedef AutoReconnectFrame_EventType EventType;
+  static constexpr EventType UNKNOWN_EVENT_TYPE =
+    AutoReconnectFrame_EventType_UNKNOWN_EVENT_TYPE;
+  static constexpr EventType CLIENT_INTRODUCTION =
+    AutoReconnectFrame_EventType_CLIENT_INTRODUCTION;
+  static constexpr EventType CLIENT_INTRODUCTION_ACK =
+    AutoReconnectFrame_EventType_CLIENT_INTRODUCTION_ACK;
+  static inline bool EventType_IsValid(int value) {
+    return AutoReconnectFrame_EventType_IsValid(value);
+  }
+  static constexpr EventType EventType_MIN =
+    AutoReconnectFrame_EventType_EventType_MIN;
+  static constexpr EventType EventType_MAX =
+    AutoReconnectFrame_EventType_EventType_MAX;
+  static constexpr int EventType_ARRAYSIZE =
+    AutoReconnectFrame_EventType_EventType_ARRAYSIZE;
+  template<typename T>
+  static inline const std::string& EventType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, EventType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function EventType_Name.");
+    return AutoReconnectFrame_EventType_Name(enum_t_value);
+  }
+  static inline bool EventType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      EventType* value) {
+    return AutoReconnectFrame_EventType_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
   enum : int {
-    kChannelsFieldNumber = 1,
+    kEndpointIdFieldNumber = 1,
+    kEventTypeFieldNumber = 2,
   };
-  // repeated int32 channels = 1 [packed = true];
-  int channels_size() const;
+  // optional string endpoint_id = 1;
+  bool has_endpoint_id() const;
   private:
-  int _internal_channels_size() const;
+  bool _internal_has_endpoint_id() const;
   public:
-  void clear_channels();
+  void clear_endpoint_id();
+  const std::string& endpoint_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_endpoint_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_endpoint_id();
+  PROTOBUF_NODISCARD std::string* release_endpoint_id();
+  void set_allocated_endpoint_id(std::string* endpoint_id);
   private:
-  int32_t _internal_channels(int index) const;
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-      _internal_channels() const;
-  void _internal_add_channels(int32_t value);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-      _internal_mutable_channels();
+  const std::string& _internal_endpoint_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_endpoint_id(const std::string& value);
+  std::string* _internal_mutable_endpoint_id();
   public:
-  int32_t channels(int index) const;
-  void set_channels(int index, int32_t value);
-  void add_channels(int32_t value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-      channels() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-      mutable_channels();
-
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.AvailableChannels)
- private:
-  class _Internal;
 
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > channels_;
-  mutable std::atomic<int> _channels_cached_byte_size_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
-};
-// -------------------------------------------------------------------
-
-class WifiDirectCliUsableChannels final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.WifiDirectCliUsableChannels) */ {
- public:
-  inline WifiDirectCliUsableChannels() : WifiDirectCliUsableChannels(nullptr) {}
-  ~WifiDirectCliUsableChannels() override;
-  explicit constexpr WifiDirectCliUsableChannels(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
-
-  WifiDirectCliUsableChannels(const WifiDirectCliUsableChannels& from);
-  WifiDirectCliUsableChannels(WifiDirectCliUsableChannels&& from) noexcept
-    : WifiDirectCliUsableChannels() {
-    *this = ::std::move(from);
-  }
-
-  inline WifiDirectCliUsableChannels& operator=(const WifiDirectCliUsableChannels& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline WifiDirectCliUsableChannels& operator=(WifiDirectCliUsableChannels&& from) noexcept {
-    if (this == &from) return *this;
-    if (GetOwningArena() == from.GetOwningArena()
-  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
-        && GetOwningArena() != nullptr
-  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
-    ) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  inline const std::string& unknown_fields() const {
-    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
-  }
-  inline std::string* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields<std::string>();
-  }
-
-  static const WifiDirectCliUsableChannels& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const WifiDirectCliUsableChannels* internal_default_instance() {
-    return reinterpret_cast<const WifiDirectCliUsableChannels*>(
-               &_WifiDirectCliUsableChannels_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    29;
-
-  friend void swap(WifiDirectCliUsableChannels& a, WifiDirectCliUsableChannels& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(WifiDirectCliUsableChannels* other) {
-    if (other == this) return;
-  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() != nullptr &&
-        GetOwningArena() == other->GetOwningArena()) {
-   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() == other->GetOwningArena()) {
-  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
-      InternalSwap(other);
-    } else {
-      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(WifiDirectCliUsableChannels* other) {
-    if (other == this) return;
-    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  WifiDirectCliUsableChannels* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<WifiDirectCliUsableChannels>(arena);
-  }
-  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const WifiDirectCliUsableChannels& from);
-  void MergeFrom(const WifiDirectCliUsableChannels& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  uint8_t* _InternalSerialize(
-      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(WifiDirectCliUsableChannels* other);
-
-  private:
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.WifiDirectCliUsableChannels";
-  }
-  protected:
-  explicit WifiDirectCliUsableChannels(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                       bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  public:
-
-  std::string GetTypeName() const final;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kChannelsFieldNumber = 1,
-  };
-  // repeated int32 channels = 1 [packed = true];
-  int channels_size() const;
+  // optional .location.nearby.connections.AutoReconnectFrame.EventType event_type = 2;
+  bool has_event_type() const;
   private:
-  int _internal_channels_size() const;
+  bool _internal_has_event_type() const;
   public:
-  void clear_channels();
+  void clear_event_type();
+  ::location::nearby::connections::AutoReconnectFrame_EventType event_type() const;
+  void set_event_type(::location::nearby::connections::AutoReconnectFrame_EventType value);
   private:
-  int32_t _internal_channels(int index) const;
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-      _internal_channels() const;
-  void _internal_add_channels(int32_t value);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-      _internal_mutable_channels();
+  ::location::nearby::connections::AutoReconnectFrame_EventType _internal_event_type() const;
+  void _internal_set_event_type(::location::nearby::connections::AutoReconnectFrame_EventType value);
   public:
-  int32_t channels(int index) const;
-  void set_channels(int index, int32_t value);
-  void add_channels(int32_t value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-      channels() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-      mutable_channels();
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.WifiDirectCliUsableChannels)
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.AutoReconnectFrame)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > channels_;
-  mutable std::atomic<int> _channels_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr endpoint_id_;
+  int event_type_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class WifiLanUsableChannels final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.WifiLanUsableChannels) */ {
+class MediumMetadata final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.MediumMetadata) */ {
  public:
-  inline WifiLanUsableChannels() : WifiLanUsableChannels(nullptr) {}
-  ~WifiLanUsableChannels() override;
-  explicit constexpr WifiLanUsableChannels(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline MediumMetadata() : MediumMetadata(nullptr) {}
+  ~MediumMetadata() override;
+  explicit constexpr MediumMetadata(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  WifiLanUsableChannels(const WifiLanUsableChannels& from);
-  WifiLanUsableChannels(WifiLanUsableChannels&& from) noexcept
-    : WifiLanUsableChannels() {
+  MediumMetadata(const MediumMetadata& from);
+  MediumMetadata(MediumMetadata&& from) noexcept
+    : MediumMetadata() {
     *this = ::std::move(from);
   }
 
-  inline WifiLanUsableChannels& operator=(const WifiLanUsableChannels& from) {
+  inline MediumMetadata& operator=(const MediumMetadata& from) {
     CopyFrom(from);
     return *this;
   }
-  inline WifiLanUsableChannels& operator=(WifiLanUsableChannels&& from) noexcept {
+  inline MediumMetadata& operator=(MediumMetadata&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -7072,20 +7009,20 @@ class WifiLanUsableChannels final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const WifiLanUsableChannels& default_instance() {
+  static const MediumMetadata& default_instance() {
     return *internal_default_instance();
   }
-  static inline const WifiLanUsableChannels* internal_default_instance() {
-    return reinterpret_cast<const WifiLanUsableChannels*>(
-               &_WifiLanUsableChannels_default_instance_);
+  static inline const MediumMetadata* internal_default_instance() {
+    return reinterpret_cast<const MediumMetadata*>(
+               &_MediumMetadata_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    30;
+    29;
 
-  friend void swap(WifiLanUsableChannels& a, WifiLanUsableChannels& b) {
+  friend void swap(MediumMetadata& a, MediumMetadata& b) {
     a.Swap(&b);
   }
-  inline void Swap(WifiLanUsableChannels* other) {
+  inline void Swap(MediumMetadata* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -7098,7 +7035,7 @@ class WifiLanUsableChannels final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(WifiLanUsableChannels* other) {
+  void UnsafeArenaSwap(MediumMetadata* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -7106,12 +7043,12 @@ class WifiLanUsableChannels final :
 
   // implements Message ----------------------------------------------
 
-  WifiLanUsableChannels* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<WifiLanUsableChannels>(arena);
+  MediumMetadata* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MediumMetadata>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const WifiLanUsableChannels& from);
-  void MergeFrom(const WifiLanUsableChannels& from);
+  void CopyFrom(const MediumMetadata& from);
+  void MergeFrom(const MediumMetadata& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -7125,15 +7062,15 @@ class WifiLanUsableChannels final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(WifiLanUsableChannels* other);
+  void InternalSwap(MediumMetadata* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.WifiLanUsableChannels";
+    return "location.nearby.connections.MediumMetadata";
   }
   protected:
-  explicit WifiLanUsableChannels(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit MediumMetadata(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -7147,62 +7084,238 @@ class WifiLanUsableChannels final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kChannelsFieldNumber = 1,
+    kBssidFieldNumber = 2,
+    kIpAddressFieldNumber = 3,
+    kAvailableChannelsFieldNumber = 7,
+    kWifiDirectCliUsableChannelsFieldNumber = 8,
+    kWifiLanUsableChannelsFieldNumber = 9,
+    kWifiAwareUsableChannelsFieldNumber = 10,
+    kWifiHotspotStaUsableChannelsFieldNumber = 11,
+    kSupports5GhzFieldNumber = 1,
+    kSupports6GhzFieldNumber = 4,
+    kMobileRadioFieldNumber = 5,
+    kApFrequencyFieldNumber = 6,
   };
-  // repeated int32 channels = 1 [packed = true];
-  int channels_size() const;
+  // optional string bssid = 2;
+  bool has_bssid() const;
   private:
-  int _internal_channels_size() const;
+  bool _internal_has_bssid() const;
   public:
-  void clear_channels();
+  void clear_bssid();
+  const std::string& bssid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_bssid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_bssid();
+  PROTOBUF_NODISCARD std::string* release_bssid();
+  void set_allocated_bssid(std::string* bssid);
   private:
-  int32_t _internal_channels(int index) const;
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-      _internal_channels() const;
-  void _internal_add_channels(int32_t value);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-      _internal_mutable_channels();
+  const std::string& _internal_bssid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_bssid(const std::string& value);
+  std::string* _internal_mutable_bssid();
   public:
-  int32_t channels(int index) const;
-  void set_channels(int index, int32_t value);
-  void add_channels(int32_t value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-      channels() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-      mutable_channels();
-
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.WifiLanUsableChannels)
- private:
-  class _Internal;
 
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > channels_;
-  mutable std::atomic<int> _channels_cached_byte_size_;
+  // optional bytes ip_address = 3;
+  bool has_ip_address() const;
+  private:
+  bool _internal_has_ip_address() const;
+  public:
+  void clear_ip_address();
+  const std::string& ip_address() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ip_address(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ip_address();
+  PROTOBUF_NODISCARD std::string* release_ip_address();
+  void set_allocated_ip_address(std::string* ip_address);
+  private:
+  const std::string& _internal_ip_address() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip_address(const std::string& value);
+  std::string* _internal_mutable_ip_address();
+  public:
+
+  // optional .location.nearby.connections.AvailableChannels available_channels = 7;
+  bool has_available_channels() const;
+  private:
+  bool _internal_has_available_channels() const;
+  public:
+  void clear_available_channels();
+  const ::location::nearby::connections::AvailableChannels& available_channels() const;
+  PROTOBUF_NODISCARD ::location::nearby::connections::AvailableChannels* release_available_channels();
+  ::location::nearby::connections::AvailableChannels* mutable_available_channels();
+  void set_allocated_available_channels(::location::nearby::connections::AvailableChannels* available_channels);
+  private:
+  const ::location::nearby::connections::AvailableChannels& _internal_available_channels() const;
+  ::location::nearby::connections::AvailableChannels* _internal_mutable_available_channels();
+  public:
+  void unsafe_arena_set_allocated_available_channels(
+      ::location::nearby::connections::AvailableChannels* available_channels);
+  ::location::nearby::connections::AvailableChannels* unsafe_arena_release_available_channels();
+
+  // optional .location.nearby.connections.WifiDirectCliUsableChannels wifi_direct_cli_usable_channels = 8;
+  bool has_wifi_direct_cli_usable_channels() const;
+  private:
+  bool _internal_has_wifi_direct_cli_usable_channels() const;
+  public:
+  void clear_wifi_direct_cli_usable_channels();
+  const ::location::nearby::connections::WifiDirectCliUsableChannels& wifi_direct_cli_usable_channels() const;
+  PROTOBUF_NODISCARD ::location::nearby::connections::WifiDirectCliUsableChannels* release_wifi_direct_cli_usable_channels();
+  ::location::nearby::connections::WifiDirectCliUsableChannels* mutable_wifi_direct_cli_usable_channels();
+  void set_allocated_wifi_direct_cli_usable_channels(::location::nearby::connections::WifiDirectCliUsableChannels* wifi_direct_cli_usable_channels);
+  private:
+  const ::location::nearby::connections::WifiDirectCliUsableChannels& _internal_wifi_direct_cli_usable_channels() const;
+  ::location::nearby::connections::WifiDirectCliUsableChannels* _internal_mutable_wifi_direct_cli_usable_channels();
+  public:
+  void unsafe_arena_set_allocated_wifi_direct_cli_usable_channels(
+      ::location::nearby::connections::WifiDirectCliUsableChannels* wifi_direct_cli_usable_channels);
+  ::location::nearby::connections::WifiDirectCliUsableChannels* unsafe_arena_release_wifi_direct_cli_usable_channels();
+
+  // optional .location.nearby.connections.WifiLanUsableChannels wifi_lan_usable_channels = 9;
+  bool has_wifi_lan_usable_channels() const;
+  private:
+  bool _internal_has_wifi_lan_usable_channels() const;
+  public:
+  void clear_wifi_lan_usable_channels();
+  const ::location::nearby::connections::WifiLanUsableChannels& wifi_lan_usable_channels() const;
+  PROTOBUF_NODISCARD ::location::nearby::connections::WifiLanUsableChannels* release_wifi_lan_usable_channels();
+  ::location::nearby::connections::WifiLanUsableChannels* mutable_wifi_lan_usable_channels();
+  void set_allocated_wifi_lan_usable_channels(::location::nearby::connections::WifiLanUsableChannels* wifi_lan_usable_channels);
+  private:
+  const ::location::nearby::connections::WifiLanUsableChannels& _internal_wifi_lan_usable_channels() const;
+  ::location::nearby::connections::WifiLanUsableChannels* _internal_mutable_wifi_lan_usable_channels();
+  public:
+  void unsafe_arena_set_allocated_wifi_lan_usable_channels(
+      ::location::nearby::connections::WifiLanUsableChannels* wifi_lan_usable_channels);
+  ::location::nearby::connections::WifiLanUsableChannels* unsafe_arena_release_wifi_lan_usable_channels();
+
+  // optional .location.nearby.connections.WifiAwareUsableChannels wifi_aware_usable_channels = 10;
+  bool has_wifi_aware_usable_channels() const;
+  private:
+  bool _internal_has_wifi_aware_usable_channels() const;
+  public:
+  void clear_wifi_aware_usable_channels();
+  const ::location::nearby::connections::WifiAwareUsableChannels& wifi_aware_usable_channels() const;
+  PROTOBUF_NODISCARD ::location::nearby::connections::WifiAwareUsableChannels* release_wifi_aware_usable_channels();
+  ::location::nearby::connections::WifiAwareUsableChannels* mutable_wifi_aware_usable_channels();
+  void set_allocated_wifi_aware_usable_channels(::location::nearby::connections::WifiAwareUsableChannels* wifi_aware_usable_channels);
+  private:
+  const ::location::nearby::connections::WifiAwareUsableChannels& _internal_wifi_aware_usable_channels() const;
+  ::location::nearby::connections::WifiAwareUsableChannels* _internal_mutable_wifi_aware_usable_channels();
+  public:
+  void unsafe_arena_set_allocated_wifi_aware_usable_channels(
+      ::location::nearby::connections::WifiAwareUsableChannels* wifi_aware_usable_channels);
+  ::location::nearby::connections::WifiAwareUsableChannels* unsafe_arena_release_wifi_aware_usable_channels();
+
+  // optional .location.nearby.connections.WifiHotspotStaUsableChannels wifi_hotspot_sta_usable_channels = 11;
+  bool has_wifi_hotspot_sta_usable_channels() const;
+  private:
+  bool _internal_has_wifi_hotspot_sta_usable_channels() const;
+  public:
+  void clear_wifi_hotspot_sta_usable_channels();
+  const ::location::nearby::connections::WifiHotspotStaUsableChannels& wifi_hotspot_sta_usable_channels() const;
+  PROTOBUF_NODISCARD ::location::nearby::connections::WifiHotspotStaUsableChannels* release_wifi_hotspot_sta_usable_channels();
+  ::location::nearby::connections::WifiHotspotStaUsableChannels* mutable_wifi_hotspot_sta_usable_channels();
+  void set_allocated_wifi_hotspot_sta_usable_channels(::location::nearby::connections::WifiHotspotStaUsableChannels* wifi_hotspot_sta_usable_channels);
+  private:
+  const ::location::nearby::connections::WifiHotspotStaUsableChannels& _internal_wifi_hotspot_sta_usable_channels() const;
+  ::location::nearby::connections::WifiHotspotStaUsableChannels* _internal_mutable_wifi_hotspot_sta_usable_channels();
+  public:
+  void unsafe_arena_set_allocated_wifi_hotspot_sta_usable_channels(
+      ::location::nearby::connections::WifiHotspotStaUsableChannels* wifi_hotspot_sta_usable_channels);
+  ::location::nearby::connections::WifiHotspotStaUsableChannels* unsafe_arena_release_wifi_hotspot_sta_usable_channels();
+
+  // optional bool supports_5_ghz = 1;
+  bool has_supports_5_ghz() const;
+  private:
+  bool _internal_has_supports_5_ghz() const;
+  public:
+  void clear_supports_5_ghz();
+  bool supports_5_ghz() const;
+  void set_supports_5_ghz(bool value);
+  private:
+  bool _internal_supports_5_ghz() const;
+  void _internal_set_supports_5_ghz(bool value);
+  public:
+
+  // optional bool supports_6_ghz = 4;
+  bool has_supports_6_ghz() const;
+  private:
+  bool _internal_has_supports_6_ghz() const;
+  public:
+  void clear_supports_6_ghz();
+  bool supports_6_ghz() const;
+  void set_supports_6_ghz(bool value);
+  private:
+  bool _internal_supports_6_ghz() const;
+  void _internal_set_supports_6_ghz(bool value);
+  public:
+
+  // optional bool mobile_radio = 5;
+  bool has_mobile_radio() const;
+  private:
+  bool _internal_has_mobile_radio() const;
+  public:
+  void clear_mobile_radio();
+  bool mobile_radio() const;
+  void set_mobile_radio(bool value);
+  private:
+  bool _internal_mobile_radio() const;
+  void _internal_set_mobile_radio(bool value);
+  public:
+
+  // optional int32 ap_frequency = 6 [default = -1];
+  bool has_ap_frequency() const;
+  private:
+  bool _internal_has_ap_frequency() const;
+  public:
+  void clear_ap_frequency();
+  int32_t ap_frequency() const;
+  void set_ap_frequency(int32_t value);
+  private:
+  int32_t _internal_ap_frequency() const;
+  void _internal_set_ap_frequency(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.MediumMetadata)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr bssid_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_address_;
+  ::location::nearby::connections::AvailableChannels* available_channels_;
+  ::location::nearby::connections::WifiDirectCliUsableChannels* wifi_direct_cli_usable_channels_;
+  ::location::nearby::connections::WifiLanUsableChannels* wifi_lan_usable_channels_;
+  ::location::nearby::connections::WifiAwareUsableChannels* wifi_aware_usable_channels_;
+  ::location::nearby::connections::WifiHotspotStaUsableChannels* wifi_hotspot_sta_usable_channels_;
+  bool supports_5_ghz_;
+  bool supports_6_ghz_;
+  bool mobile_radio_;
+  int32_t ap_frequency_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class WifiAwareUsableChannels final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.WifiAwareUsableChannels) */ {
+class AvailableChannels final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.AvailableChannels) */ {
  public:
-  inline WifiAwareUsableChannels() : WifiAwareUsableChannels(nullptr) {}
-  ~WifiAwareUsableChannels() override;
-  explicit constexpr WifiAwareUsableChannels(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline AvailableChannels() : AvailableChannels(nullptr) {}
+  ~AvailableChannels() override;
+  explicit constexpr AvailableChannels(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  WifiAwareUsableChannels(const WifiAwareUsableChannels& from);
-  WifiAwareUsableChannels(WifiAwareUsableChannels&& from) noexcept
-    : WifiAwareUsableChannels() {
+  AvailableChannels(const AvailableChannels& from);
+  AvailableChannels(AvailableChannels&& from) noexcept
+    : AvailableChannels() {
     *this = ::std::move(from);
   }
 
-  inline WifiAwareUsableChannels& operator=(const WifiAwareUsableChannels& from) {
+  inline AvailableChannels& operator=(const AvailableChannels& from) {
     CopyFrom(from);
     return *this;
   }
-  inline WifiAwareUsableChannels& operator=(WifiAwareUsableChannels&& from) noexcept {
+  inline AvailableChannels& operator=(AvailableChannels&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -7223,20 +7336,20 @@ class WifiAwareUsableChannels final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const WifiAwareUsableChannels& default_instance() {
+  static const AvailableChannels& default_instance() {
     return *internal_default_instance();
   }
-  static inline const WifiAwareUsableChannels* internal_default_instance() {
-    return reinterpret_cast<const WifiAwareUsableChannels*>(
-               &_WifiAwareUsableChannels_default_instance_);
+  static inline const AvailableChannels* internal_default_instance() {
+    return reinterpret_cast<const AvailableChannels*>(
+               &_AvailableChannels_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    31;
+    30;
 
-  friend void swap(WifiAwareUsableChannels& a, WifiAwareUsableChannels& b) {
+  friend void swap(AvailableChannels& a, AvailableChannels& b) {
     a.Swap(&b);
   }
-  inline void Swap(WifiAwareUsableChannels* other) {
+  inline void Swap(AvailableChannels* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -7249,7 +7362,7 @@ class WifiAwareUsableChannels final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(WifiAwareUsableChannels* other) {
+  void UnsafeArenaSwap(AvailableChannels* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -7257,12 +7370,12 @@ class WifiAwareUsableChannels final :
 
   // implements Message ----------------------------------------------
 
-  WifiAwareUsableChannels* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<WifiAwareUsableChannels>(arena);
+  AvailableChannels* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AvailableChannels>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const WifiAwareUsableChannels& from);
-  void MergeFrom(const WifiAwareUsableChannels& from);
+  void CopyFrom(const AvailableChannels& from);
+  void MergeFrom(const AvailableChannels& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -7276,15 +7389,15 @@ class WifiAwareUsableChannels final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(WifiAwareUsableChannels* other);
+  void InternalSwap(AvailableChannels* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.WifiAwareUsableChannels";
+    return "location.nearby.connections.AvailableChannels";
   }
   protected:
-  explicit WifiAwareUsableChannels(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit AvailableChannels(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -7322,7 +7435,7 @@ class WifiAwareUsableChannels final :
   ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
       mutable_channels();
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.WifiAwareUsableChannels)
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.AvailableChannels)
  private:
   class _Internal;
 
@@ -7336,24 +7449,24 @@ class WifiAwareUsableChannels final :
 };
 // -------------------------------------------------------------------
 
-class WifiHotspotStaUsableChannels final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.WifiHotspotStaUsableChannels) */ {
+class WifiDirectCliUsableChannels final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.WifiDirectCliUsableChannels) */ {
  public:
-  inline WifiHotspotStaUsableChannels() : WifiHotspotStaUsableChannels(nullptr) {}
-  ~WifiHotspotStaUsableChannels() override;
-  explicit constexpr WifiHotspotStaUsableChannels(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline WifiDirectCliUsableChannels() : WifiDirectCliUsableChannels(nullptr) {}
+  ~WifiDirectCliUsableChannels() override;
+  explicit constexpr WifiDirectCliUsableChannels(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  WifiHotspotStaUsableChannels(const WifiHotspotStaUsableChannels& from);
-  WifiHotspotStaUsableChannels(WifiHotspotStaUsableChannels&& from) noexcept
-    : WifiHotspotStaUsableChannels() {
+  WifiDirectCliUsableChannels(const WifiDirectCliUsableChannels& from);
+  WifiDirectCliUsableChannels(WifiDirectCliUsableChannels&& from) noexcept
+    : WifiDirectCliUsableChannels() {
     *this = ::std::move(from);
   }
 
-  inline WifiHotspotStaUsableChannels& operator=(const WifiHotspotStaUsableChannels& from) {
+  inline WifiDirectCliUsableChannels& operator=(const WifiDirectCliUsableChannels& from) {
     CopyFrom(from);
     return *this;
   }
-  inline WifiHotspotStaUsableChannels& operator=(WifiHotspotStaUsableChannels&& from) noexcept {
+  inline WifiDirectCliUsableChannels& operator=(WifiDirectCliUsableChannels&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -7374,20 +7487,20 @@ class WifiHotspotStaUsableChannels final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const WifiHotspotStaUsableChannels& default_instance() {
+  static const WifiDirectCliUsableChannels& default_instance() {
     return *internal_default_instance();
   }
-  static inline const WifiHotspotStaUsableChannels* internal_default_instance() {
-    return reinterpret_cast<const WifiHotspotStaUsableChannels*>(
-               &_WifiHotspotStaUsableChannels_default_instance_);
+  static inline const WifiDirectCliUsableChannels* internal_default_instance() {
+    return reinterpret_cast<const WifiDirectCliUsableChannels*>(
+               &_WifiDirectCliUsableChannels_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    32;
+    31;
 
-  friend void swap(WifiHotspotStaUsableChannels& a, WifiHotspotStaUsableChannels& b) {
+  friend void swap(WifiDirectCliUsableChannels& a, WifiDirectCliUsableChannels& b) {
     a.Swap(&b);
   }
-  inline void Swap(WifiHotspotStaUsableChannels* other) {
+  inline void Swap(WifiDirectCliUsableChannels* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -7400,7 +7513,7 @@ class WifiHotspotStaUsableChannels final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(WifiHotspotStaUsableChannels* other) {
+  void UnsafeArenaSwap(WifiDirectCliUsableChannels* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -7408,12 +7521,12 @@ class WifiHotspotStaUsableChannels final :
 
   // implements Message ----------------------------------------------
 
-  WifiHotspotStaUsableChannels* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<WifiHotspotStaUsableChannels>(arena);
+  WifiDirectCliUsableChannels* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WifiDirectCliUsableChannels>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const WifiHotspotStaUsableChannels& from);
-  void MergeFrom(const WifiHotspotStaUsableChannels& from);
+  void CopyFrom(const WifiDirectCliUsableChannels& from);
+  void MergeFrom(const WifiDirectCliUsableChannels& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -7427,15 +7540,15 @@ class WifiHotspotStaUsableChannels final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(WifiHotspotStaUsableChannels* other);
+  void InternalSwap(WifiDirectCliUsableChannels* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.WifiHotspotStaUsableChannels";
+    return "location.nearby.connections.WifiDirectCliUsableChannels";
   }
   protected:
-  explicit WifiHotspotStaUsableChannels(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit WifiDirectCliUsableChannels(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -7473,7 +7586,7 @@ class WifiHotspotStaUsableChannels final :
   ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
       mutable_channels();
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.WifiHotspotStaUsableChannels)
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.WifiDirectCliUsableChannels)
  private:
   class _Internal;
 
@@ -7487,24 +7600,24 @@ class WifiHotspotStaUsableChannels final :
 };
 // -------------------------------------------------------------------
 
-class LocationHint final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.LocationHint) */ {
+class WifiLanUsableChannels final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.WifiLanUsableChannels) */ {
  public:
-  inline LocationHint() : LocationHint(nullptr) {}
-  ~LocationHint() override;
-  explicit constexpr LocationHint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline WifiLanUsableChannels() : WifiLanUsableChannels(nullptr) {}
+  ~WifiLanUsableChannels() override;
+  explicit constexpr WifiLanUsableChannels(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  LocationHint(const LocationHint& from);
-  LocationHint(LocationHint&& from) noexcept
-    : LocationHint() {
+  WifiLanUsableChannels(const WifiLanUsableChannels& from);
+  WifiLanUsableChannels(WifiLanUsableChannels&& from) noexcept
+    : WifiLanUsableChannels() {
     *this = ::std::move(from);
   }
 
-  inline LocationHint& operator=(const LocationHint& from) {
+  inline WifiLanUsableChannels& operator=(const WifiLanUsableChannels& from) {
     CopyFrom(from);
     return *this;
   }
-  inline LocationHint& operator=(LocationHint&& from) noexcept {
+  inline WifiLanUsableChannels& operator=(WifiLanUsableChannels&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -7525,20 +7638,20 @@ class LocationHint final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const LocationHint& default_instance() {
+  static const WifiLanUsableChannels& default_instance() {
     return *internal_default_instance();
   }
-  static inline const LocationHint* internal_default_instance() {
-    return reinterpret_cast<const LocationHint*>(
-               &_LocationHint_default_instance_);
+  static inline const WifiLanUsableChannels* internal_default_instance() {
+    return reinterpret_cast<const WifiLanUsableChannels*>(
+               &_WifiLanUsableChannels_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    33;
+    32;
 
-  friend void swap(LocationHint& a, LocationHint& b) {
+  friend void swap(WifiLanUsableChannels& a, WifiLanUsableChannels& b) {
     a.Swap(&b);
   }
-  inline void Swap(LocationHint* other) {
+  inline void Swap(WifiLanUsableChannels* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -7551,7 +7664,7 @@ class LocationHint final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(LocationHint* other) {
+  void UnsafeArenaSwap(WifiLanUsableChannels* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -7559,12 +7672,12 @@ class LocationHint final :
 
   // implements Message ----------------------------------------------
 
-  LocationHint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<LocationHint>(arena);
+  WifiLanUsableChannels* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WifiLanUsableChannels>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const LocationHint& from);
-  void MergeFrom(const LocationHint& from);
+  void CopyFrom(const WifiLanUsableChannels& from);
+  void MergeFrom(const WifiLanUsableChannels& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -7578,15 +7691,15 @@ class LocationHint final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(LocationHint* other);
+  void InternalSwap(WifiLanUsableChannels* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.LocationHint";
+    return "location.nearby.connections.WifiLanUsableChannels";
   }
   protected:
-  explicit LocationHint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit WifiLanUsableChannels(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -7600,73 +7713,62 @@ class LocationHint final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kLocationFieldNumber = 1,
-    kFormatFieldNumber = 2,
+    kChannelsFieldNumber = 1,
   };
-  // optional string location = 1;
-  bool has_location() const;
-  private:
-  bool _internal_has_location() const;
-  public:
-  void clear_location();
-  const std::string& location() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_location(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_location();
-  PROTOBUF_NODISCARD std::string* release_location();
-  void set_allocated_location(std::string* location);
-  private:
-  const std::string& _internal_location() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_location(const std::string& value);
-  std::string* _internal_mutable_location();
-  public:
-
-  // optional .location.nearby.connections.LocationStandard.Format format = 2;
-  bool has_format() const;
+  // repeated int32 channels = 1 [packed = true];
+  int channels_size() const;
   private:
-  bool _internal_has_format() const;
+  int _internal_channels_size() const;
   public:
-  void clear_format();
-  ::location::nearby::connections::LocationStandard_Format format() const;
-  void set_format(::location::nearby::connections::LocationStandard_Format value);
+  void clear_channels();
   private:
-  ::location::nearby::connections::LocationStandard_Format _internal_format() const;
-  void _internal_set_format(::location::nearby::connections::LocationStandard_Format value);
+  int32_t _internal_channels(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_channels() const;
+  void _internal_add_channels(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_channels();
   public:
+  int32_t channels(int index) const;
+  void set_channels(int index, int32_t value);
+  void add_channels(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      channels() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_channels();
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.LocationHint)
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.WifiLanUsableChannels)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > channels_;
+  mutable std::atomic<int> _channels_cached_byte_size_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr location_;
-  int format_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class LocationStandard final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.LocationStandard) */ {
+class WifiAwareUsableChannels final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.WifiAwareUsableChannels) */ {
  public:
-  inline LocationStandard() : LocationStandard(nullptr) {}
-  ~LocationStandard() override;
-  explicit constexpr LocationStandard(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline WifiAwareUsableChannels() : WifiAwareUsableChannels(nullptr) {}
+  ~WifiAwareUsableChannels() override;
+  explicit constexpr WifiAwareUsableChannels(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  LocationStandard(const LocationStandard& from);
-  LocationStandard(LocationStandard&& from) noexcept
-    : LocationStandard() {
+  WifiAwareUsableChannels(const WifiAwareUsableChannels& from);
+  WifiAwareUsableChannels(WifiAwareUsableChannels&& from) noexcept
+    : WifiAwareUsableChannels() {
     *this = ::std::move(from);
   }
 
-  inline LocationStandard& operator=(const LocationStandard& from) {
+  inline WifiAwareUsableChannels& operator=(const WifiAwareUsableChannels& from) {
     CopyFrom(from);
     return *this;
   }
-  inline LocationStandard& operator=(LocationStandard&& from) noexcept {
+  inline WifiAwareUsableChannels& operator=(WifiAwareUsableChannels&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -7687,20 +7789,20 @@ class LocationStandard final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const LocationStandard& default_instance() {
+  static const WifiAwareUsableChannels& default_instance() {
     return *internal_default_instance();
   }
-  static inline const LocationStandard* internal_default_instance() {
-    return reinterpret_cast<const LocationStandard*>(
-               &_LocationStandard_default_instance_);
+  static inline const WifiAwareUsableChannels* internal_default_instance() {
+    return reinterpret_cast<const WifiAwareUsableChannels*>(
+               &_WifiAwareUsableChannels_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    34;
+    33;
 
-  friend void swap(LocationStandard& a, LocationStandard& b) {
+  friend void swap(WifiAwareUsableChannels& a, WifiAwareUsableChannels& b) {
     a.Swap(&b);
   }
-  inline void Swap(LocationStandard* other) {
+  inline void Swap(WifiAwareUsableChannels* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -7713,7 +7815,7 @@ class LocationStandard final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(LocationStandard* other) {
+  void UnsafeArenaSwap(WifiAwareUsableChannels* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -7721,12 +7823,12 @@ class LocationStandard final :
 
   // implements Message ----------------------------------------------
 
-  LocationStandard* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<LocationStandard>(arena);
+  WifiAwareUsableChannels* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WifiAwareUsableChannels>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const LocationStandard& from);
-  void MergeFrom(const LocationStandard& from);
+  void CopyFrom(const WifiAwareUsableChannels& from);
+  void MergeFrom(const WifiAwareUsableChannels& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -7740,15 +7842,15 @@ class LocationStandard final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(LocationStandard* other);
+  void InternalSwap(WifiAwareUsableChannels* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.LocationStandard";
+    return "location.nearby.connections.WifiAwareUsableChannels";
   }
   protected:
-  explicit LocationStandard(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit WifiAwareUsableChannels(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -7759,66 +7861,65 @@ class LocationStandard final :
 
   // nested types ----------------------------------------------------
 
-  typedef LocationStandard_Format Format;
-  static constexpr Format UNKNOWN =
-    LocationStandard_Format_UNKNOWN;
-  static constexpr Format E164_CALLING =
-    LocationStandard_Format_E164_CALLING;
-  static constexpr Format ISO_3166_1_ALPHA_2 =
-    LocationStandard_Format_ISO_3166_1_ALPHA_2;
-  static inline bool Format_IsValid(int value) {
-    return LocationStandard_Format_IsValid(value);
-  }
-  static constexpr Format Format_MIN =
-    LocationStandard_Format_Format_MIN;
-  static constexpr Format Format_MAX =
-    LocationStandard_Format_Format_MAX;
-  static constexpr int Format_ARRAYSIZE =
-    LocationStandard_Format_Format_ARRAYSIZE;
-  template<typename T>
-  static inline const std::string& Format_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, Format>::value ||
-      ::std::is_integral<T>::value,
-      "Incorrect type passed to function Format_Name.");
-    return LocationStandard_Format_Name(enum_t_value);
-  }
-  static inline bool Format_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
-      Format* value) {
-    return LocationStandard_Format_Parse(name, value);
-  }
-
   // accessors -------------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.LocationStandard)
+  enum : int {
+    kChannelsFieldNumber = 1,
+  };
+  // repeated int32 channels = 1 [packed = true];
+  int channels_size() const;
+  private:
+  int _internal_channels_size() const;
+  public:
+  void clear_channels();
+  private:
+  int32_t _internal_channels(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_channels() const;
+  void _internal_add_channels(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_channels();
+  public:
+  int32_t channels(int index) const;
+  void set_channels(int index, int32_t value);
+  void add_channels(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      channels() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_channels();
+
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.WifiAwareUsableChannels)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > channels_;
+  mutable std::atomic<int> _channels_cached_byte_size_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class OsInfo final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.OsInfo) */ {
+class WifiHotspotStaUsableChannels final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.WifiHotspotStaUsableChannels) */ {
  public:
-  inline OsInfo() : OsInfo(nullptr) {}
-  ~OsInfo() override;
-  explicit constexpr OsInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline WifiHotspotStaUsableChannels() : WifiHotspotStaUsableChannels(nullptr) {}
+  ~WifiHotspotStaUsableChannels() override;
+  explicit constexpr WifiHotspotStaUsableChannels(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  OsInfo(const OsInfo& from);
-  OsInfo(OsInfo&& from) noexcept
-    : OsInfo() {
+  WifiHotspotStaUsableChannels(const WifiHotspotStaUsableChannels& from);
+  WifiHotspotStaUsableChannels(WifiHotspotStaUsableChannels&& from) noexcept
+    : WifiHotspotStaUsableChannels() {
     *this = ::std::move(from);
   }
 
-  inline OsInfo& operator=(const OsInfo& from) {
+  inline WifiHotspotStaUsableChannels& operator=(const WifiHotspotStaUsableChannels& from) {
     CopyFrom(from);
     return *this;
   }
-  inline OsInfo& operator=(OsInfo&& from) noexcept {
+  inline WifiHotspotStaUsableChannels& operator=(WifiHotspotStaUsableChannels&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -7839,20 +7940,20 @@ class OsInfo final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const OsInfo& default_instance() {
+  static const WifiHotspotStaUsableChannels& default_instance() {
     return *internal_default_instance();
   }
-  static inline const OsInfo* internal_default_instance() {
-    return reinterpret_cast<const OsInfo*>(
-               &_OsInfo_default_instance_);
+  static inline const WifiHotspotStaUsableChannels* internal_default_instance() {
+    return reinterpret_cast<const WifiHotspotStaUsableChannels*>(
+               &_WifiHotspotStaUsableChannels_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    35;
+    34;
 
-  friend void swap(OsInfo& a, OsInfo& b) {
+  friend void swap(WifiHotspotStaUsableChannels& a, WifiHotspotStaUsableChannels& b) {
     a.Swap(&b);
   }
-  inline void Swap(OsInfo* other) {
+  inline void Swap(WifiHotspotStaUsableChannels* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -7865,7 +7966,7 @@ class OsInfo final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(OsInfo* other) {
+  void UnsafeArenaSwap(WifiHotspotStaUsableChannels* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -7873,12 +7974,12 @@ class OsInfo final :
 
   // implements Message ----------------------------------------------
 
-  OsInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<OsInfo>(arena);
+  WifiHotspotStaUsableChannels* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WifiHotspotStaUsableChannels>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const OsInfo& from);
-  void MergeFrom(const OsInfo& from);
+  void CopyFrom(const WifiHotspotStaUsableChannels& from);
+  void MergeFrom(const WifiHotspotStaUsableChannels& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -7892,15 +7993,15 @@ class OsInfo final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(OsInfo* other);
+  void InternalSwap(WifiHotspotStaUsableChannels* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.OsInfo";
+    return "location.nearby.connections.WifiHotspotStaUsableChannels";
   }
   protected:
-  explicit OsInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit WifiHotspotStaUsableChannels(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -7911,90 +8012,65 @@ class OsInfo final :
 
   // nested types ----------------------------------------------------
 
-  typedef OsInfo_OsType OsType;
-  static constexpr OsType UNKNOWN_OS_TYPE =
-    OsInfo_OsType_UNKNOWN_OS_TYPE;
-  static constexpr OsType ANDROID =
-    OsInfo_OsType_ANDROID;
-  static constexpr OsType CHROME_OS =
-    OsInfo_OsType_CHROME_OS;
-  static constexpr OsType WINDOWS =
-    OsInfo_OsType_WINDOWS;
-  static constexpr OsType APPLE =
-    OsInfo_OsType_APPLE;
-  static constexpr OsType LINUX =
-    OsInfo_OsType_LINUX;
-  static inline bool OsType_IsValid(int value) {
-    return OsInfo_OsType_IsValid(value);
-  }
-  static constexpr OsType OsType_MIN =
-    OsInfo_OsType_OsType_MIN;
-  static constexpr OsType OsType_MAX =
-    OsInfo_OsType_OsType_MAX;
-  static constexpr int OsType_ARRAYSIZE =
-    OsInfo_OsType_OsType_ARRAYSIZE;
-  template<typename T>
-  static inline const std::string& OsType_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, OsType>::value ||
-      ::std::is_integral<T>::value,
-      "Incorrect type passed to function OsType_Name.");
-    return OsInfo_OsType_Name(enum_t_value);
-  }
-  static inline bool OsType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
-      OsType* value) {
-    return OsInfo_OsType_Parse(name, value);
-  }
-
   // accessors -------------------------------------------------------
 
   enum : int {
-    kTypeFieldNumber = 1,
+    kChannelsFieldNumber = 1,
   };
-  // optional .location.nearby.connections.OsInfo.OsType type = 1;
-  bool has_type() const;
+  // repeated int32 channels = 1 [packed = true];
+  int channels_size() const;
   private:
-  bool _internal_has_type() const;
+  int _internal_channels_size() const;
   public:
-  void clear_type();
-  ::location::nearby::connections::OsInfo_OsType type() const;
-  void set_type(::location::nearby::connections::OsInfo_OsType value);
+  void clear_channels();
   private:
-  ::location::nearby::connections::OsInfo_OsType _internal_type() const;
-  void _internal_set_type(::location::nearby::connections::OsInfo_OsType value);
+  int32_t _internal_channels(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_channels() const;
+  void _internal_add_channels(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_channels();
   public:
+  int32_t channels(int index) const;
+  void set_channels(int index, int32_t value);
+  void add_channels(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      channels() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_channels();
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.OsInfo)
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.WifiHotspotStaUsableChannels)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > channels_;
+  mutable std::atomic<int> _channels_cached_byte_size_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  int type_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ConnectionsDevice final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.ConnectionsDevice) */ {
+class LocationHint final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.LocationHint) */ {
  public:
-  inline ConnectionsDevice() : ConnectionsDevice(nullptr) {}
-  ~ConnectionsDevice() override;
-  explicit constexpr ConnectionsDevice(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline LocationHint() : LocationHint(nullptr) {}
+  ~LocationHint() override;
+  explicit constexpr LocationHint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ConnectionsDevice(const ConnectionsDevice& from);
-  ConnectionsDevice(ConnectionsDevice&& from) noexcept
-    : ConnectionsDevice() {
+  LocationHint(const LocationHint& from);
+  LocationHint(LocationHint&& from) noexcept
+    : LocationHint() {
     *this = ::std::move(from);
   }
 
-  inline ConnectionsDevice& operator=(const ConnectionsDevice& from) {
+  inline LocationHint& operator=(const LocationHint& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ConnectionsDevice& operator=(ConnectionsDevice&& from) noexcept {
+  inline LocationHint& operator=(LocationHint&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -8015,20 +8091,20 @@ class ConnectionsDevice final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const ConnectionsDevice& default_instance() {
+  static const LocationHint& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ConnectionsDevice* internal_default_instance() {
-    return reinterpret_cast<const ConnectionsDevice*>(
-               &_ConnectionsDevice_default_instance_);
+  static inline const LocationHint* internal_default_instance() {
+    return reinterpret_cast<const LocationHint*>(
+               &_LocationHint_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    36;
+    35;
 
-  friend void swap(ConnectionsDevice& a, ConnectionsDevice& b) {
+  friend void swap(LocationHint& a, LocationHint& b) {
     a.Swap(&b);
   }
-  inline void Swap(ConnectionsDevice* other) {
+  inline void Swap(LocationHint* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -8041,7 +8117,7 @@ class ConnectionsDevice final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ConnectionsDevice* other) {
+  void UnsafeArenaSwap(LocationHint* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -8049,12 +8125,12 @@ class ConnectionsDevice final :
 
   // implements Message ----------------------------------------------
 
-  ConnectionsDevice* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ConnectionsDevice>(arena);
+  LocationHint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LocationHint>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const ConnectionsDevice& from);
-  void MergeFrom(const ConnectionsDevice& from);
+  void CopyFrom(const LocationHint& from);
+  void MergeFrom(const LocationHint& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -8068,15 +8144,15 @@ class ConnectionsDevice final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(ConnectionsDevice* other);
+  void InternalSwap(LocationHint* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.ConnectionsDevice";
+    return "location.nearby.connections.LocationHint";
   }
   protected:
-  explicit ConnectionsDevice(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit LocationHint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -8090,79 +8166,41 @@ class ConnectionsDevice final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kEndpointIdFieldNumber = 1,
-    kConnectivityInfoListFieldNumber = 3,
-    kEndpointInfoFieldNumber = 4,
-    kEndpointTypeFieldNumber = 2,
+    kLocationFieldNumber = 1,
+    kFormatFieldNumber = 2,
   };
-  // optional string endpoint_id = 1;
-  bool has_endpoint_id() const;
-  private:
-  bool _internal_has_endpoint_id() const;
-  public:
-  void clear_endpoint_id();
-  const std::string& endpoint_id() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_endpoint_id(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_endpoint_id();
-  PROTOBUF_NODISCARD std::string* release_endpoint_id();
-  void set_allocated_endpoint_id(std::string* endpoint_id);
-  private:
-  const std::string& _internal_endpoint_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_endpoint_id(const std::string& value);
-  std::string* _internal_mutable_endpoint_id();
-  public:
-
-  // optional bytes connectivity_info_list = 3;
-  bool has_connectivity_info_list() const;
-  private:
-  bool _internal_has_connectivity_info_list() const;
-  public:
-  void clear_connectivity_info_list();
-  const std::string& connectivity_info_list() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_connectivity_info_list(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_connectivity_info_list();
-  PROTOBUF_NODISCARD std::string* release_connectivity_info_list();
-  void set_allocated_connectivity_info_list(std::string* connectivity_info_list);
-  private:
-  const std::string& _internal_connectivity_info_list() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_connectivity_info_list(const std::string& value);
-  std::string* _internal_mutable_connectivity_info_list();
-  public:
-
-  // optional bytes endpoint_info = 4;
-  bool has_endpoint_info() const;
+  // optional string location = 1;
+  bool has_location() const;
   private:
-  bool _internal_has_endpoint_info() const;
+  bool _internal_has_location() const;
   public:
-  void clear_endpoint_info();
-  const std::string& endpoint_info() const;
+  void clear_location();
+  const std::string& location() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_endpoint_info(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_endpoint_info();
-  PROTOBUF_NODISCARD std::string* release_endpoint_info();
-  void set_allocated_endpoint_info(std::string* endpoint_info);
+  void set_location(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_location();
+  PROTOBUF_NODISCARD std::string* release_location();
+  void set_allocated_location(std::string* location);
   private:
-  const std::string& _internal_endpoint_info() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_endpoint_info(const std::string& value);
-  std::string* _internal_mutable_endpoint_info();
+  const std::string& _internal_location() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_location(const std::string& value);
+  std::string* _internal_mutable_location();
   public:
 
-  // optional .location.nearby.connections.EndpointType endpoint_type = 2;
-  bool has_endpoint_type() const;
+  // optional .location.nearby.connections.LocationStandard.Format format = 2;
+  bool has_format() const;
   private:
-  bool _internal_has_endpoint_type() const;
+  bool _internal_has_format() const;
   public:
-  void clear_endpoint_type();
-  ::location::nearby::connections::EndpointType endpoint_type() const;
-  void set_endpoint_type(::location::nearby::connections::EndpointType value);
+  void clear_format();
+  ::location::nearby::connections::LocationStandard_Format format() const;
+  void set_format(::location::nearby::connections::LocationStandard_Format value);
   private:
-  ::location::nearby::connections::EndpointType _internal_endpoint_type() const;
-  void _internal_set_endpoint_type(::location::nearby::connections::EndpointType value);
+  ::location::nearby::connections::LocationStandard_Format _internal_format() const;
+  void _internal_set_format(::location::nearby::connections::LocationStandard_Format value);
   public:
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.ConnectionsDevice)
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.LocationHint)
  private:
   class _Internal;
 
@@ -8171,32 +8209,30 @@ class ConnectionsDevice final :
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr endpoint_id_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr connectivity_info_list_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr endpoint_info_;
-  int endpoint_type_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr location_;
+  int format_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PresenceDevice final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.PresenceDevice) */ {
+class LocationStandard final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.LocationStandard) */ {
  public:
-  inline PresenceDevice() : PresenceDevice(nullptr) {}
-  ~PresenceDevice() override;
-  explicit constexpr PresenceDevice(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline LocationStandard() : LocationStandard(nullptr) {}
+  ~LocationStandard() override;
+  explicit constexpr LocationStandard(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  PresenceDevice(const PresenceDevice& from);
-  PresenceDevice(PresenceDevice&& from) noexcept
-    : PresenceDevice() {
+  LocationStandard(const LocationStandard& from);
+  LocationStandard(LocationStandard&& from) noexcept
+    : LocationStandard() {
     *this = ::std::move(from);
   }
 
-  inline PresenceDevice& operator=(const PresenceDevice& from) {
+  inline LocationStandard& operator=(const LocationStandard& from) {
     CopyFrom(from);
     return *this;
   }
-  inline PresenceDevice& operator=(PresenceDevice&& from) noexcept {
+  inline LocationStandard& operator=(LocationStandard&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -8217,20 +8253,20 @@ class PresenceDevice final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const PresenceDevice& default_instance() {
+  static const LocationStandard& default_instance() {
     return *internal_default_instance();
   }
-  static inline const PresenceDevice* internal_default_instance() {
-    return reinterpret_cast<const PresenceDevice*>(
-               &_PresenceDevice_default_instance_);
+  static inline const LocationStandard* internal_default_instance() {
+    return reinterpret_cast<const LocationStandard*>(
+               &_LocationStandard_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    37;
+    36;
 
-  friend void swap(PresenceDevice& a, PresenceDevice& b) {
+  friend void swap(LocationStandard& a, LocationStandard& b) {
     a.Swap(&b);
   }
-  inline void Swap(PresenceDevice* other) {
+  inline void Swap(LocationStandard* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -8243,7 +8279,7 @@ class PresenceDevice final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(PresenceDevice* other) {
+  void UnsafeArenaSwap(LocationStandard* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -8251,12 +8287,12 @@ class PresenceDevice final :
 
   // implements Message ----------------------------------------------
 
-  PresenceDevice* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<PresenceDevice>(arena);
+  LocationStandard* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LocationStandard>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const PresenceDevice& from);
-  void MergeFrom(const PresenceDevice& from);
+  void CopyFrom(const LocationStandard& from);
+  void MergeFrom(const LocationStandard& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -8270,15 +8306,15 @@ class PresenceDevice final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(PresenceDevice* other);
+  void InternalSwap(LocationStandard* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "location.nearby.connections.PresenceDevice";
+    return "location.nearby.connections.LocationStandard";
   }
   protected:
-  explicit PresenceDevice(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit LocationStandard(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -8289,229 +8325,211 @@ class PresenceDevice final :
 
   // nested types ----------------------------------------------------
 
-  typedef PresenceDevice_DeviceType DeviceType;
-  static constexpr DeviceType UNKNOWN =
-    PresenceDevice_DeviceType_UNKNOWN;
-  static constexpr DeviceType PHONE =
-    PresenceDevice_DeviceType_PHONE;
-  static constexpr DeviceType TABLET =
-    PresenceDevice_DeviceType_TABLET;
-  static constexpr DeviceType DISPLAY =
-    PresenceDevice_DeviceType_DISPLAY;
-  static constexpr DeviceType LAPTOP =
-    PresenceDevice_DeviceType_LAPTOP;
-  static constexpr DeviceType TV =
-    PresenceDevice_DeviceType_TV;
-  static constexpr DeviceType WATCH =
-    PresenceDevice_DeviceType_WATCH;
-  static inline bool DeviceType_IsValid(int value) {
-    return PresenceDevice_DeviceType_IsValid(value);
+  typedef LocationStandard_Format Format;
+  static constexpr Format UNKNOWN =
+    LocationStandard_Format_UNKNOWN;
+  static constexpr Format E164_CALLING =
+    LocationStandard_Format_E164_CALLING;
+  static constexpr Format ISO_3166_1_ALPHA_2 =
+    LocationStandard_Format_ISO_3166_1_ALPHA_2;
+  static inline bool Format_IsValid(int value) {
+    return LocationStandard_Format_IsValid(value);
   }
-  static constexpr DeviceType DeviceType_MIN =
-    PresenceDevice_DeviceType_DeviceType_MIN;
-  static constexpr DeviceType DeviceType_MAX =
-    PresenceDevice_DeviceType_DeviceType_MAX;
-  static constexpr int DeviceType_ARRAYSIZE =
-    PresenceDevice_DeviceType_DeviceType_ARRAYSIZE;
+  static constexpr Format Format_MIN =
+    LocationStandard_Format_Format_MIN;
+  static constexpr Format Format_MAX =
+    LocationStandard_Format_Format_MAX;
+  static constexpr int Format_ARRAYSIZE =
+    LocationStandard_Format_Format_ARRAYSIZE;
   template<typename T>
-  static inline const std::string& DeviceType_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, DeviceType>::value ||
+  static inline const std::string& Format_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Format>::value ||
       ::std::is_integral<T>::value,
-      "Incorrect type passed to function DeviceType_Name.");
-    return PresenceDevice_DeviceType_Name(enum_t_value);
+      "Incorrect type passed to function Format_Name.");
+    return LocationStandard_Format_Name(enum_t_value);
   }
-  static inline bool DeviceType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
-      DeviceType* value) {
-    return PresenceDevice_DeviceType_Parse(name, value);
+  static inline bool Format_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Format* value) {
+    return LocationStandard_Format_Parse(name, value);
   }
 
   // accessors -------------------------------------------------------
 
-  enum : int {
-    kDiscoveryMediumFieldNumber = 8,
-    kActionsFieldNumber = 9,
-    kIdentityTypeFieldNumber = 10,
-    kEndpointIdFieldNumber = 1,
-    kConnectivityInfoListFieldNumber = 3,
-    kDeviceNameFieldNumber = 5,
-    kDeviceImageUrlFieldNumber = 7,
-    kDeviceIdFieldNumber = 4,
-    kEndpointTypeFieldNumber = 2,
-    kDeviceTypeFieldNumber = 6,
-  };
-  // repeated .location.nearby.connections.ConnectionRequestFrame.Medium discovery_medium = 8 [packed = true];
-  int discovery_medium_size() const;
-  private:
-  int _internal_discovery_medium_size() const;
-  public:
-  void clear_discovery_medium();
-  private:
-  ::location::nearby::connections::ConnectionRequestFrame_Medium _internal_discovery_medium(int index) const;
-  void _internal_add_discovery_medium(::location::nearby::connections::ConnectionRequestFrame_Medium value);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* _internal_mutable_discovery_medium();
-  public:
-  ::location::nearby::connections::ConnectionRequestFrame_Medium discovery_medium(int index) const;
-  void set_discovery_medium(int index, ::location::nearby::connections::ConnectionRequestFrame_Medium value);
-  void add_discovery_medium(::location::nearby::connections::ConnectionRequestFrame_Medium value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>& discovery_medium() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* mutable_discovery_medium();
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.LocationStandard)
+ private:
+  class _Internal;
 
-  // repeated int32 actions = 9 [packed = true];
-  int actions_size() const;
-  private:
-  int _internal_actions_size() const;
-  public:
-  void clear_actions();
-  private:
-  int32_t _internal_actions(int index) const;
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-      _internal_actions() const;
-  void _internal_add_actions(int32_t value);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-      _internal_mutable_actions();
-  public:
-  int32_t actions(int index) const;
-  void set_actions(int index, int32_t value);
-  void add_actions(int32_t value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
-      actions() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
-      mutable_actions();
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
+};
+// -------------------------------------------------------------------
 
-  // repeated int64 identity_type = 10 [packed = true];
-  int identity_type_size() const;
-  private:
-  int _internal_identity_type_size() const;
-  public:
-  void clear_identity_type();
-  private:
-  int64_t _internal_identity_type(int index) const;
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
-      _internal_identity_type() const;
-  void _internal_add_identity_type(int64_t value);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
-      _internal_mutable_identity_type();
-  public:
-  int64_t identity_type(int index) const;
-  void set_identity_type(int index, int64_t value);
-  void add_identity_type(int64_t value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
-      identity_type() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
-      mutable_identity_type();
+class OsInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.OsInfo) */ {
+ public:
+  inline OsInfo() : OsInfo(nullptr) {}
+  ~OsInfo() override;
+  explicit constexpr OsInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  // optional string endpoint_id = 1;
-  bool has_endpoint_id() const;
-  private:
-  bool _internal_has_endpoint_id() const;
-  public:
-  void clear_endpoint_id();
-  const std::string& endpoint_id() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_endpoint_id(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_endpoint_id();
-  PROTOBUF_NODISCARD std::string* release_endpoint_id();
-  void set_allocated_endpoint_id(std::string* endpoint_id);
-  private:
-  const std::string& _internal_endpoint_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_endpoint_id(const std::string& value);
-  std::string* _internal_mutable_endpoint_id();
-  public:
+  OsInfo(const OsInfo& from);
+  OsInfo(OsInfo&& from) noexcept
+    : OsInfo() {
+    *this = ::std::move(from);
+  }
 
-  // optional bytes connectivity_info_list = 3;
-  bool has_connectivity_info_list() const;
-  private:
-  bool _internal_has_connectivity_info_list() const;
-  public:
-  void clear_connectivity_info_list();
-  const std::string& connectivity_info_list() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_connectivity_info_list(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_connectivity_info_list();
-  PROTOBUF_NODISCARD std::string* release_connectivity_info_list();
-  void set_allocated_connectivity_info_list(std::string* connectivity_info_list);
-  private:
-  const std::string& _internal_connectivity_info_list() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_connectivity_info_list(const std::string& value);
-  std::string* _internal_mutable_connectivity_info_list();
-  public:
+  inline OsInfo& operator=(const OsInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OsInfo& operator=(OsInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  // optional string device_name = 5;
-  bool has_device_name() const;
-  private:
-  bool _internal_has_device_name() const;
-  public:
-  void clear_device_name();
-  const std::string& device_name() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_device_name(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_device_name();
-  PROTOBUF_NODISCARD std::string* release_device_name();
-  void set_allocated_device_name(std::string* device_name);
-  private:
-  const std::string& _internal_device_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_device_name(const std::string& value);
-  std::string* _internal_mutable_device_name();
-  public:
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
 
-  // optional string device_image_url = 7;
-  bool has_device_image_url() const;
-  private:
-  bool _internal_has_device_image_url() const;
-  public:
-  void clear_device_image_url();
-  const std::string& device_image_url() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_device_image_url(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_device_image_url();
-  PROTOBUF_NODISCARD std::string* release_device_image_url();
-  void set_allocated_device_image_url(std::string* device_image_url);
-  private:
-  const std::string& _internal_device_image_url() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_device_image_url(const std::string& value);
-  std::string* _internal_mutable_device_image_url();
-  public:
+  static const OsInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OsInfo* internal_default_instance() {
+    return reinterpret_cast<const OsInfo*>(
+               &_OsInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    37;
+
+  friend void swap(OsInfo& a, OsInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OsInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OsInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OsInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OsInfo>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const OsInfo& from);
+  void MergeFrom(const OsInfo& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
 
-  // optional int64 device_id = 4;
-  bool has_device_id() const;
-  private:
-  bool _internal_has_device_id() const;
-  public:
-  void clear_device_id();
-  int64_t device_id() const;
-  void set_device_id(int64_t value);
   private:
-  int64_t _internal_device_id() const;
-  void _internal_set_device_id(int64_t value);
-  public:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(OsInfo* other);
 
-  // optional .location.nearby.connections.EndpointType endpoint_type = 2;
-  bool has_endpoint_type() const;
   private:
-  bool _internal_has_endpoint_type() const;
-  public:
-  void clear_endpoint_type();
-  ::location::nearby::connections::EndpointType endpoint_type() const;
-  void set_endpoint_type(::location::nearby::connections::EndpointType value);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "location.nearby.connections.OsInfo";
+  }
+  protected:
+  explicit OsInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   private:
-  ::location::nearby::connections::EndpointType _internal_endpoint_type() const;
-  void _internal_set_endpoint_type(::location::nearby::connections::EndpointType value);
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
-  // optional .location.nearby.connections.PresenceDevice.DeviceType device_type = 6;
-  bool has_device_type() const;
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef OsInfo_OsType OsType;
+  static constexpr OsType UNKNOWN_OS_TYPE =
+    OsInfo_OsType_UNKNOWN_OS_TYPE;
+  static constexpr OsType ANDROID =
+    OsInfo_OsType_ANDROID;
+  static constexpr OsType CHROME_OS =
+    OsInfo_OsType_CHROME_OS;
+  static constexpr OsType WINDOWS =
+    OsInfo_OsType_WINDOWS;
+  static constexpr OsType APPLE =
+    OsInfo_OsType_APPLE;
+  static constexpr OsType LINUX =
+    OsInfo_OsType_LINUX;
+  static inline bool OsType_IsValid(int value) {
+    return OsInfo_OsType_IsValid(value);
+  }
+  static constexpr OsType OsType_MIN =
+    OsInfo_OsType_OsType_MIN;
+  static constexpr OsType OsType_MAX =
+    OsInfo_OsType_OsType_MAX;
+  static constexpr int OsType_ARRAYSIZE =
+    OsInfo_OsType_OsType_ARRAYSIZE;
+  template<typename T>
+  static inline const std::string& OsType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, OsType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function OsType_Name.");
+    return OsInfo_OsType_Name(enum_t_value);
+  }
+  static inline bool OsType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      OsType* value) {
+    return OsInfo_OsType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTypeFieldNumber = 1,
+  };
+  // optional .location.nearby.connections.OsInfo.OsType type = 1;
+  bool has_type() const;
   private:
-  bool _internal_has_device_type() const;
+  bool _internal_has_type() const;
   public:
-  void clear_device_type();
-  ::location::nearby::connections::PresenceDevice_DeviceType device_type() const;
-  void set_device_type(::location::nearby::connections::PresenceDevice_DeviceType value);
+  void clear_type();
+  ::location::nearby::connections::OsInfo_OsType type() const;
+  void set_type(::location::nearby::connections::OsInfo_OsType value);
   private:
-  ::location::nearby::connections::PresenceDevice_DeviceType _internal_device_type() const;
-  void _internal_set_device_type(::location::nearby::connections::PresenceDevice_DeviceType value);
+  ::location::nearby::connections::OsInfo_OsType _internal_type() const;
+  void _internal_set_type(::location::nearby::connections::OsInfo_OsType value);
   public:
 
-  // @@protoc_insertion_point(class_scope:location.nearby.connections.PresenceDevice)
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.OsInfo)
  private:
   class _Internal;
 
@@ -8520,100 +8538,1131 @@ class PresenceDevice final :
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int> discovery_medium_;
-  mutable std::atomic<int> _discovery_medium_cached_byte_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > actions_;
-  mutable std::atomic<int> _actions_cached_byte_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > identity_type_;
-  mutable std::atomic<int> _identity_type_cached_byte_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr endpoint_id_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr connectivity_info_list_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr device_name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr device_image_url_;
-  int64_t device_id_;
-  int endpoint_type_;
-  int device_type_;
+  int type_;
   friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class ConnectionsDevice final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.ConnectionsDevice) */ {
+ public:
+  inline ConnectionsDevice() : ConnectionsDevice(nullptr) {}
+  ~ConnectionsDevice() override;
+  explicit constexpr ConnectionsDevice(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  ConnectionsDevice(const ConnectionsDevice& from);
+  ConnectionsDevice(ConnectionsDevice&& from) noexcept
+    : ConnectionsDevice() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// OfflineFrame
+  inline ConnectionsDevice& operator=(const ConnectionsDevice& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ConnectionsDevice& operator=(ConnectionsDevice&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// optional .location.nearby.connections.OfflineFrame.Version version = 1;
-inline bool OfflineFrame::_internal_has_version() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
-  return value;
-}
-inline bool OfflineFrame::has_version() const {
-  return _internal_has_version();
-}
-inline void OfflineFrame::clear_version() {
-  version_ = 0;
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline ::location::nearby::connections::OfflineFrame_Version OfflineFrame::_internal_version() const {
-  return static_cast< ::location::nearby::connections::OfflineFrame_Version >(version_);
-}
-inline ::location::nearby::connections::OfflineFrame_Version OfflineFrame::version() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.OfflineFrame.version)
-  return _internal_version();
-}
-inline void OfflineFrame::_internal_set_version(::location::nearby::connections::OfflineFrame_Version value) {
-  assert(::location::nearby::connections::OfflineFrame_Version_IsValid(value));
-  _has_bits_[0] |= 0x00000002u;
-  version_ = value;
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const ConnectionsDevice& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ConnectionsDevice* internal_default_instance() {
+    return reinterpret_cast<const ConnectionsDevice*>(
+               &_ConnectionsDevice_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    38;
+
+  friend void swap(ConnectionsDevice& a, ConnectionsDevice& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ConnectionsDevice* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ConnectionsDevice* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ConnectionsDevice* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ConnectionsDevice>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const ConnectionsDevice& from);
+  void MergeFrom(const ConnectionsDevice& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(ConnectionsDevice* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "location.nearby.connections.ConnectionsDevice";
+  }
+  protected:
+  explicit ConnectionsDevice(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEndpointIdFieldNumber = 1,
+    kConnectivityInfoListFieldNumber = 3,
+    kEndpointInfoFieldNumber = 4,
+    kEndpointTypeFieldNumber = 2,
+  };
+  // optional string endpoint_id = 1;
+  bool has_endpoint_id() const;
+  private:
+  bool _internal_has_endpoint_id() const;
+  public:
+  void clear_endpoint_id();
+  const std::string& endpoint_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_endpoint_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_endpoint_id();
+  PROTOBUF_NODISCARD std::string* release_endpoint_id();
+  void set_allocated_endpoint_id(std::string* endpoint_id);
+  private:
+  const std::string& _internal_endpoint_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_endpoint_id(const std::string& value);
+  std::string* _internal_mutable_endpoint_id();
+  public:
+
+  // optional bytes connectivity_info_list = 3;
+  bool has_connectivity_info_list() const;
+  private:
+  bool _internal_has_connectivity_info_list() const;
+  public:
+  void clear_connectivity_info_list();
+  const std::string& connectivity_info_list() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_connectivity_info_list(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_connectivity_info_list();
+  PROTOBUF_NODISCARD std::string* release_connectivity_info_list();
+  void set_allocated_connectivity_info_list(std::string* connectivity_info_list);
+  private:
+  const std::string& _internal_connectivity_info_list() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_connectivity_info_list(const std::string& value);
+  std::string* _internal_mutable_connectivity_info_list();
+  public:
+
+  // optional bytes endpoint_info = 4;
+  bool has_endpoint_info() const;
+  private:
+  bool _internal_has_endpoint_info() const;
+  public:
+  void clear_endpoint_info();
+  const std::string& endpoint_info() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_endpoint_info(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_endpoint_info();
+  PROTOBUF_NODISCARD std::string* release_endpoint_info();
+  void set_allocated_endpoint_info(std::string* endpoint_info);
+  private:
+  const std::string& _internal_endpoint_info() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_endpoint_info(const std::string& value);
+  std::string* _internal_mutable_endpoint_info();
+  public:
+
+  // optional .location.nearby.connections.EndpointType endpoint_type = 2;
+  bool has_endpoint_type() const;
+  private:
+  bool _internal_has_endpoint_type() const;
+  public:
+  void clear_endpoint_type();
+  ::location::nearby::connections::EndpointType endpoint_type() const;
+  void set_endpoint_type(::location::nearby::connections::EndpointType value);
+  private:
+  ::location::nearby::connections::EndpointType _internal_endpoint_type() const;
+  void _internal_set_endpoint_type(::location::nearby::connections::EndpointType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.ConnectionsDevice)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr endpoint_id_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr connectivity_info_list_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr endpoint_info_;
+  int endpoint_type_;
+  friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PresenceDevice final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:location.nearby.connections.PresenceDevice) */ {
+ public:
+  inline PresenceDevice() : PresenceDevice(nullptr) {}
+  ~PresenceDevice() override;
+  explicit constexpr PresenceDevice(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PresenceDevice(const PresenceDevice& from);
+  PresenceDevice(PresenceDevice&& from) noexcept
+    : PresenceDevice() {
+    *this = ::std::move(from);
+  }
+
+  inline PresenceDevice& operator=(const PresenceDevice& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PresenceDevice& operator=(PresenceDevice&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const PresenceDevice& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PresenceDevice* internal_default_instance() {
+    return reinterpret_cast<const PresenceDevice*>(
+               &_PresenceDevice_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    39;
+
+  friend void swap(PresenceDevice& a, PresenceDevice& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PresenceDevice* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PresenceDevice* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PresenceDevice* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PresenceDevice>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const PresenceDevice& from);
+  void MergeFrom(const PresenceDevice& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(PresenceDevice* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "location.nearby.connections.PresenceDevice";
+  }
+  protected:
+  explicit PresenceDevice(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef PresenceDevice_DeviceType DeviceType;
+  static constexpr DeviceType UNKNOWN =
+    PresenceDevice_DeviceType_UNKNOWN;
+  static constexpr DeviceType PHONE =
+    PresenceDevice_DeviceType_PHONE;
+  static constexpr DeviceType TABLET =
+    PresenceDevice_DeviceType_TABLET;
+  static constexpr DeviceType DISPLAY =
+    PresenceDevice_DeviceType_DISPLAY;
+  static constexpr DeviceType LAPTOP =
+    PresenceDevice_DeviceType_LAPTOP;
+  static constexpr DeviceType TV =
+    PresenceDevice_DeviceType_TV;
+  static constexpr DeviceType WATCH =
+    PresenceDevice_DeviceType_WATCH;
+  static inline bool DeviceType_IsValid(int value) {
+    return PresenceDevice_DeviceType_IsValid(value);
+  }
+  static constexpr DeviceType DeviceType_MIN =
+    PresenceDevice_DeviceType_DeviceType_MIN;
+  static constexpr DeviceType DeviceType_MAX =
+    PresenceDevice_DeviceType_DeviceType_MAX;
+  static constexpr int DeviceType_ARRAYSIZE =
+    PresenceDevice_DeviceType_DeviceType_ARRAYSIZE;
+  template<typename T>
+  static inline const std::string& DeviceType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, DeviceType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function DeviceType_Name.");
+    return PresenceDevice_DeviceType_Name(enum_t_value);
+  }
+  static inline bool DeviceType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      DeviceType* value) {
+    return PresenceDevice_DeviceType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDiscoveryMediumFieldNumber = 8,
+    kActionsFieldNumber = 9,
+    kIdentityTypeFieldNumber = 10,
+    kEndpointIdFieldNumber = 1,
+    kConnectivityInfoListFieldNumber = 3,
+    kDeviceNameFieldNumber = 5,
+    kDeviceImageUrlFieldNumber = 7,
+    kDeviceIdFieldNumber = 4,
+    kEndpointTypeFieldNumber = 2,
+    kDeviceTypeFieldNumber = 6,
+  };
+  // repeated .location.nearby.connections.ConnectionRequestFrame.Medium discovery_medium = 8 [packed = true];
+  int discovery_medium_size() const;
+  private:
+  int _internal_discovery_medium_size() const;
+  public:
+  void clear_discovery_medium();
+  private:
+  ::location::nearby::connections::ConnectionRequestFrame_Medium _internal_discovery_medium(int index) const;
+  void _internal_add_discovery_medium(::location::nearby::connections::ConnectionRequestFrame_Medium value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* _internal_mutable_discovery_medium();
+  public:
+  ::location::nearby::connections::ConnectionRequestFrame_Medium discovery_medium(int index) const;
+  void set_discovery_medium(int index, ::location::nearby::connections::ConnectionRequestFrame_Medium value);
+  void add_discovery_medium(::location::nearby::connections::ConnectionRequestFrame_Medium value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>& discovery_medium() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* mutable_discovery_medium();
+
+  // repeated int32 actions = 9 [packed = true];
+  int actions_size() const;
+  private:
+  int _internal_actions_size() const;
+  public:
+  void clear_actions();
+  private:
+  int32_t _internal_actions(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_actions() const;
+  void _internal_add_actions(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_actions();
+  public:
+  int32_t actions(int index) const;
+  void set_actions(int index, int32_t value);
+  void add_actions(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      actions() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_actions();
+
+  // repeated int64 identity_type = 10 [packed = true];
+  int identity_type_size() const;
+  private:
+  int _internal_identity_type_size() const;
+  public:
+  void clear_identity_type();
+  private:
+  int64_t _internal_identity_type(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      _internal_identity_type() const;
+  void _internal_add_identity_type(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      _internal_mutable_identity_type();
+  public:
+  int64_t identity_type(int index) const;
+  void set_identity_type(int index, int64_t value);
+  void add_identity_type(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      identity_type() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      mutable_identity_type();
+
+  // optional string endpoint_id = 1;
+  bool has_endpoint_id() const;
+  private:
+  bool _internal_has_endpoint_id() const;
+  public:
+  void clear_endpoint_id();
+  const std::string& endpoint_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_endpoint_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_endpoint_id();
+  PROTOBUF_NODISCARD std::string* release_endpoint_id();
+  void set_allocated_endpoint_id(std::string* endpoint_id);
+  private:
+  const std::string& _internal_endpoint_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_endpoint_id(const std::string& value);
+  std::string* _internal_mutable_endpoint_id();
+  public:
+
+  // optional bytes connectivity_info_list = 3;
+  bool has_connectivity_info_list() const;
+  private:
+  bool _internal_has_connectivity_info_list() const;
+  public:
+  void clear_connectivity_info_list();
+  const std::string& connectivity_info_list() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_connectivity_info_list(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_connectivity_info_list();
+  PROTOBUF_NODISCARD std::string* release_connectivity_info_list();
+  void set_allocated_connectivity_info_list(std::string* connectivity_info_list);
+  private:
+  const std::string& _internal_connectivity_info_list() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_connectivity_info_list(const std::string& value);
+  std::string* _internal_mutable_connectivity_info_list();
+  public:
+
+  // optional string device_name = 5;
+  bool has_device_name() const;
+  private:
+  bool _internal_has_device_name() const;
+  public:
+  void clear_device_name();
+  const std::string& device_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_device_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_device_name();
+  PROTOBUF_NODISCARD std::string* release_device_name();
+  void set_allocated_device_name(std::string* device_name);
+  private:
+  const std::string& _internal_device_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_device_name(const std::string& value);
+  std::string* _internal_mutable_device_name();
+  public:
+
+  // optional string device_image_url = 7;
+  bool has_device_image_url() const;
+  private:
+  bool _internal_has_device_image_url() const;
+  public:
+  void clear_device_image_url();
+  const std::string& device_image_url() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_device_image_url(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_device_image_url();
+  PROTOBUF_NODISCARD std::string* release_device_image_url();
+  void set_allocated_device_image_url(std::string* device_image_url);
+  private:
+  const std::string& _internal_device_image_url() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_device_image_url(const std::string& value);
+  std::string* _internal_mutable_device_image_url();
+  public:
+
+  // optional int64 device_id = 4;
+  bool has_device_id() const;
+  private:
+  bool _internal_has_device_id() const;
+  public:
+  void clear_device_id();
+  int64_t device_id() const;
+  void set_device_id(int64_t value);
+  private:
+  int64_t _internal_device_id() const;
+  void _internal_set_device_id(int64_t value);
+  public:
+
+  // optional .location.nearby.connections.EndpointType endpoint_type = 2;
+  bool has_endpoint_type() const;
+  private:
+  bool _internal_has_endpoint_type() const;
+  public:
+  void clear_endpoint_type();
+  ::location::nearby::connections::EndpointType endpoint_type() const;
+  void set_endpoint_type(::location::nearby::connections::EndpointType value);
+  private:
+  ::location::nearby::connections::EndpointType _internal_endpoint_type() const;
+  void _internal_set_endpoint_type(::location::nearby::connections::EndpointType value);
+  public:
+
+  // optional .location.nearby.connections.PresenceDevice.DeviceType device_type = 6;
+  bool has_device_type() const;
+  private:
+  bool _internal_has_device_type() const;
+  public:
+  void clear_device_type();
+  ::location::nearby::connections::PresenceDevice_DeviceType device_type() const;
+  void set_device_type(::location::nearby::connections::PresenceDevice_DeviceType value);
+  private:
+  ::location::nearby::connections::PresenceDevice_DeviceType _internal_device_type() const;
+  void _internal_set_device_type(::location::nearby::connections::PresenceDevice_DeviceType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:location.nearby.connections.PresenceDevice)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int> discovery_medium_;
+  mutable std::atomic<int> _discovery_medium_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > actions_;
+  mutable std::atomic<int> _actions_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > identity_type_;
+  mutable std::atomic<int> _identity_type_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr endpoint_id_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr connectivity_info_list_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr device_name_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr device_image_url_;
+  int64_t device_id_;
+  int endpoint_type_;
+  int device_type_;
+  friend struct ::TableStruct_connections_2fimplementation_2fproto_2foffline_5fwire_5fformats_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// OfflineFrame
+
+// optional .location.nearby.connections.OfflineFrame.Version version = 1;
+inline bool OfflineFrame::_internal_has_version() const {
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool OfflineFrame::has_version() const {
+  return _internal_has_version();
+}
+inline void OfflineFrame::clear_version() {
+  version_ = 0;
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline ::location::nearby::connections::OfflineFrame_Version OfflineFrame::_internal_version() const {
+  return static_cast< ::location::nearby::connections::OfflineFrame_Version >(version_);
+}
+inline ::location::nearby::connections::OfflineFrame_Version OfflineFrame::version() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.OfflineFrame.version)
+  return _internal_version();
+}
+inline void OfflineFrame::_internal_set_version(::location::nearby::connections::OfflineFrame_Version value) {
+  assert(::location::nearby::connections::OfflineFrame_Version_IsValid(value));
+  _has_bits_[0] |= 0x00000002u;
+  version_ = value;
+}
+inline void OfflineFrame::set_version(::location::nearby::connections::OfflineFrame_Version value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:location.nearby.connections.OfflineFrame.version)
+}
+
+// optional .location.nearby.connections.V1Frame v1 = 2;
+inline bool OfflineFrame::_internal_has_v1() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || v1_ != nullptr);
+  return value;
+}
+inline bool OfflineFrame::has_v1() const {
+  return _internal_has_v1();
+}
+inline void OfflineFrame::clear_v1() {
+  if (v1_ != nullptr) v1_->Clear();
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const ::location::nearby::connections::V1Frame& OfflineFrame::_internal_v1() const {
+  const ::location::nearby::connections::V1Frame* p = v1_;
+  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::V1Frame&>(
+      ::location::nearby::connections::_V1Frame_default_instance_);
+}
+inline const ::location::nearby::connections::V1Frame& OfflineFrame::v1() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.OfflineFrame.v1)
+  return _internal_v1();
+}
+inline void OfflineFrame::unsafe_arena_set_allocated_v1(
+    ::location::nearby::connections::V1Frame* v1) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(v1_);
+  }
+  v1_ = v1;
+  if (v1) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.OfflineFrame.v1)
+}
+inline ::location::nearby::connections::V1Frame* OfflineFrame::release_v1() {
+  _has_bits_[0] &= ~0x00000001u;
+  ::location::nearby::connections::V1Frame* temp = v1_;
+  v1_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::location::nearby::connections::V1Frame* OfflineFrame::unsafe_arena_release_v1() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.OfflineFrame.v1)
+  _has_bits_[0] &= ~0x00000001u;
+  ::location::nearby::connections::V1Frame* temp = v1_;
+  v1_ = nullptr;
+  return temp;
+}
+inline ::location::nearby::connections::V1Frame* OfflineFrame::_internal_mutable_v1() {
+  _has_bits_[0] |= 0x00000001u;
+  if (v1_ == nullptr) {
+    auto* p = CreateMaybeMessage<::location::nearby::connections::V1Frame>(GetArenaForAllocation());
+    v1_ = p;
+  }
+  return v1_;
+}
+inline ::location::nearby::connections::V1Frame* OfflineFrame::mutable_v1() {
+  ::location::nearby::connections::V1Frame* _msg = _internal_mutable_v1();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.OfflineFrame.v1)
+  return _msg;
+}
+inline void OfflineFrame::set_allocated_v1(::location::nearby::connections::V1Frame* v1) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete v1_;
+  }
+  if (v1) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::V1Frame>::GetOwningArena(v1);
+    if (message_arena != submessage_arena) {
+      v1 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, v1, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  v1_ = v1;
+  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.OfflineFrame.v1)
+}
+
+// -------------------------------------------------------------------
+
+// V1Frame
+
+// optional .location.nearby.connections.V1Frame.FrameType type = 1;
+inline bool V1Frame::_internal_has_type() const {
+  bool value = (_has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool V1Frame::has_type() const {
+  return _internal_has_type();
+}
+inline void V1Frame::clear_type() {
+  type_ = 0;
+  _has_bits_[0] &= ~0x00001000u;
+}
+inline ::location::nearby::connections::V1Frame_FrameType V1Frame::_internal_type() const {
+  return static_cast< ::location::nearby::connections::V1Frame_FrameType >(type_);
+}
+inline ::location::nearby::connections::V1Frame_FrameType V1Frame::type() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.V1Frame.type)
+  return _internal_type();
+}
+inline void V1Frame::_internal_set_type(::location::nearby::connections::V1Frame_FrameType value) {
+  assert(::location::nearby::connections::V1Frame_FrameType_IsValid(value));
+  _has_bits_[0] |= 0x00001000u;
+  type_ = value;
+}
+inline void V1Frame::set_type(::location::nearby::connections::V1Frame_FrameType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:location.nearby.connections.V1Frame.type)
+}
+
+// optional .location.nearby.connections.ConnectionRequestFrame connection_request = 2;
+inline bool V1Frame::_internal_has_connection_request() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || connection_request_ != nullptr);
+  return value;
+}
+inline bool V1Frame::has_connection_request() const {
+  return _internal_has_connection_request();
+}
+inline void V1Frame::clear_connection_request() {
+  if (connection_request_ != nullptr) connection_request_->Clear();
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const ::location::nearby::connections::ConnectionRequestFrame& V1Frame::_internal_connection_request() const {
+  const ::location::nearby::connections::ConnectionRequestFrame* p = connection_request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::ConnectionRequestFrame&>(
+      ::location::nearby::connections::_ConnectionRequestFrame_default_instance_);
+}
+inline const ::location::nearby::connections::ConnectionRequestFrame& V1Frame::connection_request() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.V1Frame.connection_request)
+  return _internal_connection_request();
+}
+inline void V1Frame::unsafe_arena_set_allocated_connection_request(
+    ::location::nearby::connections::ConnectionRequestFrame* connection_request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(connection_request_);
+  }
+  connection_request_ = connection_request;
+  if (connection_request) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.V1Frame.connection_request)
+}
+inline ::location::nearby::connections::ConnectionRequestFrame* V1Frame::release_connection_request() {
+  _has_bits_[0] &= ~0x00000001u;
+  ::location::nearby::connections::ConnectionRequestFrame* temp = connection_request_;
+  connection_request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::location::nearby::connections::ConnectionRequestFrame* V1Frame::unsafe_arena_release_connection_request() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.V1Frame.connection_request)
+  _has_bits_[0] &= ~0x00000001u;
+  ::location::nearby::connections::ConnectionRequestFrame* temp = connection_request_;
+  connection_request_ = nullptr;
+  return temp;
+}
+inline ::location::nearby::connections::ConnectionRequestFrame* V1Frame::_internal_mutable_connection_request() {
+  _has_bits_[0] |= 0x00000001u;
+  if (connection_request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::location::nearby::connections::ConnectionRequestFrame>(GetArenaForAllocation());
+    connection_request_ = p;
+  }
+  return connection_request_;
+}
+inline ::location::nearby::connections::ConnectionRequestFrame* V1Frame::mutable_connection_request() {
+  ::location::nearby::connections::ConnectionRequestFrame* _msg = _internal_mutable_connection_request();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.V1Frame.connection_request)
+  return _msg;
+}
+inline void V1Frame::set_allocated_connection_request(::location::nearby::connections::ConnectionRequestFrame* connection_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete connection_request_;
+  }
+  if (connection_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::ConnectionRequestFrame>::GetOwningArena(connection_request);
+    if (message_arena != submessage_arena) {
+      connection_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, connection_request, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  connection_request_ = connection_request;
+  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.V1Frame.connection_request)
+}
+
+// optional .location.nearby.connections.ConnectionResponseFrame connection_response = 3;
+inline bool V1Frame::_internal_has_connection_response() const {
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || connection_response_ != nullptr);
+  return value;
+}
+inline bool V1Frame::has_connection_response() const {
+  return _internal_has_connection_response();
+}
+inline void V1Frame::clear_connection_response() {
+  if (connection_response_ != nullptr) connection_response_->Clear();
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline const ::location::nearby::connections::ConnectionResponseFrame& V1Frame::_internal_connection_response() const {
+  const ::location::nearby::connections::ConnectionResponseFrame* p = connection_response_;
+  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::ConnectionResponseFrame&>(
+      ::location::nearby::connections::_ConnectionResponseFrame_default_instance_);
+}
+inline const ::location::nearby::connections::ConnectionResponseFrame& V1Frame::connection_response() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.V1Frame.connection_response)
+  return _internal_connection_response();
+}
+inline void V1Frame::unsafe_arena_set_allocated_connection_response(
+    ::location::nearby::connections::ConnectionResponseFrame* connection_response) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(connection_response_);
+  }
+  connection_response_ = connection_response;
+  if (connection_response) {
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.V1Frame.connection_response)
+}
+inline ::location::nearby::connections::ConnectionResponseFrame* V1Frame::release_connection_response() {
+  _has_bits_[0] &= ~0x00000002u;
+  ::location::nearby::connections::ConnectionResponseFrame* temp = connection_response_;
+  connection_response_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::location::nearby::connections::ConnectionResponseFrame* V1Frame::unsafe_arena_release_connection_response() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.V1Frame.connection_response)
+  _has_bits_[0] &= ~0x00000002u;
+  ::location::nearby::connections::ConnectionResponseFrame* temp = connection_response_;
+  connection_response_ = nullptr;
+  return temp;
+}
+inline ::location::nearby::connections::ConnectionResponseFrame* V1Frame::_internal_mutable_connection_response() {
+  _has_bits_[0] |= 0x00000002u;
+  if (connection_response_ == nullptr) {
+    auto* p = CreateMaybeMessage<::location::nearby::connections::ConnectionResponseFrame>(GetArenaForAllocation());
+    connection_response_ = p;
+  }
+  return connection_response_;
+}
+inline ::location::nearby::connections::ConnectionResponseFrame* V1Frame::mutable_connection_response() {
+  ::location::nearby::connections::ConnectionResponseFrame* _msg = _internal_mutable_connection_response();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.V1Frame.connection_response)
+  return _msg;
+}
+inline void V1Frame::set_allocated_connection_response(::location::nearby::connections::ConnectionResponseFrame* connection_response) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete connection_response_;
+  }
+  if (connection_response) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::ConnectionResponseFrame>::GetOwningArena(connection_response);
+    if (message_arena != submessage_arena) {
+      connection_response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, connection_response, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
+  }
+  connection_response_ = connection_response;
+  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.V1Frame.connection_response)
+}
+
+// optional .location.nearby.connections.PayloadTransferFrame payload_transfer = 4;
+inline bool V1Frame::_internal_has_payload_transfer() const {
+  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || payload_transfer_ != nullptr);
+  return value;
+}
+inline bool V1Frame::has_payload_transfer() const {
+  return _internal_has_payload_transfer();
+}
+inline void V1Frame::clear_payload_transfer() {
+  if (payload_transfer_ != nullptr) payload_transfer_->Clear();
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline const ::location::nearby::connections::PayloadTransferFrame& V1Frame::_internal_payload_transfer() const {
+  const ::location::nearby::connections::PayloadTransferFrame* p = payload_transfer_;
+  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::PayloadTransferFrame&>(
+      ::location::nearby::connections::_PayloadTransferFrame_default_instance_);
+}
+inline const ::location::nearby::connections::PayloadTransferFrame& V1Frame::payload_transfer() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.V1Frame.payload_transfer)
+  return _internal_payload_transfer();
+}
+inline void V1Frame::unsafe_arena_set_allocated_payload_transfer(
+    ::location::nearby::connections::PayloadTransferFrame* payload_transfer) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(payload_transfer_);
+  }
+  payload_transfer_ = payload_transfer;
+  if (payload_transfer) {
+    _has_bits_[0] |= 0x00000004u;
+  } else {
+    _has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.V1Frame.payload_transfer)
+}
+inline ::location::nearby::connections::PayloadTransferFrame* V1Frame::release_payload_transfer() {
+  _has_bits_[0] &= ~0x00000004u;
+  ::location::nearby::connections::PayloadTransferFrame* temp = payload_transfer_;
+  payload_transfer_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::location::nearby::connections::PayloadTransferFrame* V1Frame::unsafe_arena_release_payload_transfer() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.V1Frame.payload_transfer)
+  _has_bits_[0] &= ~0x00000004u;
+  ::location::nearby::connections::PayloadTransferFrame* temp = payload_transfer_;
+  payload_transfer_ = nullptr;
+  return temp;
+}
+inline ::location::nearby::connections::PayloadTransferFrame* V1Frame::_internal_mutable_payload_transfer() {
+  _has_bits_[0] |= 0x00000004u;
+  if (payload_transfer_ == nullptr) {
+    auto* p = CreateMaybeMessage<::location::nearby::connections::PayloadTransferFrame>(GetArenaForAllocation());
+    payload_transfer_ = p;
+  }
+  return payload_transfer_;
+}
+inline ::location::nearby::connections::PayloadTransferFrame* V1Frame::mutable_payload_transfer() {
+  ::location::nearby::connections::PayloadTransferFrame* _msg = _internal_mutable_payload_transfer();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.V1Frame.payload_transfer)
+  return _msg;
+}
+inline void V1Frame::set_allocated_payload_transfer(::location::nearby::connections::PayloadTransferFrame* payload_transfer) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete payload_transfer_;
+  }
+  if (payload_transfer) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::PayloadTransferFrame>::GetOwningArena(payload_transfer);
+    if (message_arena != submessage_arena) {
+      payload_transfer = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, payload_transfer, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000004u;
+  } else {
+    _has_bits_[0] &= ~0x00000004u;
+  }
+  payload_transfer_ = payload_transfer;
+  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.V1Frame.payload_transfer)
+}
+
+// optional .location.nearby.connections.BandwidthUpgradeNegotiationFrame bandwidth_upgrade_negotiation = 5;
+inline bool V1Frame::_internal_has_bandwidth_upgrade_negotiation() const {
+  bool value = (_has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || bandwidth_upgrade_negotiation_ != nullptr);
+  return value;
+}
+inline bool V1Frame::has_bandwidth_upgrade_negotiation() const {
+  return _internal_has_bandwidth_upgrade_negotiation();
+}
+inline void V1Frame::clear_bandwidth_upgrade_negotiation() {
+  if (bandwidth_upgrade_negotiation_ != nullptr) bandwidth_upgrade_negotiation_->Clear();
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame& V1Frame::_internal_bandwidth_upgrade_negotiation() const {
+  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame* p = bandwidth_upgrade_negotiation_;
+  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame&>(
+      ::location::nearby::connections::_BandwidthUpgradeNegotiationFrame_default_instance_);
+}
+inline const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame& V1Frame::bandwidth_upgrade_negotiation() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.V1Frame.bandwidth_upgrade_negotiation)
+  return _internal_bandwidth_upgrade_negotiation();
+}
+inline void V1Frame::unsafe_arena_set_allocated_bandwidth_upgrade_negotiation(
+    ::location::nearby::connections::BandwidthUpgradeNegotiationFrame* bandwidth_upgrade_negotiation) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(bandwidth_upgrade_negotiation_);
+  }
+  bandwidth_upgrade_negotiation_ = bandwidth_upgrade_negotiation;
+  if (bandwidth_upgrade_negotiation) {
+    _has_bits_[0] |= 0x00000008u;
+  } else {
+    _has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.V1Frame.bandwidth_upgrade_negotiation)
+}
+inline ::location::nearby::connections::BandwidthUpgradeNegotiationFrame* V1Frame::release_bandwidth_upgrade_negotiation() {
+  _has_bits_[0] &= ~0x00000008u;
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame* temp = bandwidth_upgrade_negotiation_;
+  bandwidth_upgrade_negotiation_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::location::nearby::connections::BandwidthUpgradeNegotiationFrame* V1Frame::unsafe_arena_release_bandwidth_upgrade_negotiation() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.V1Frame.bandwidth_upgrade_negotiation)
+  _has_bits_[0] &= ~0x00000008u;
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame* temp = bandwidth_upgrade_negotiation_;
+  bandwidth_upgrade_negotiation_ = nullptr;
+  return temp;
+}
+inline ::location::nearby::connections::BandwidthUpgradeNegotiationFrame* V1Frame::_internal_mutable_bandwidth_upgrade_negotiation() {
+  _has_bits_[0] |= 0x00000008u;
+  if (bandwidth_upgrade_negotiation_ == nullptr) {
+    auto* p = CreateMaybeMessage<::location::nearby::connections::BandwidthUpgradeNegotiationFrame>(GetArenaForAllocation());
+    bandwidth_upgrade_negotiation_ = p;
+  }
+  return bandwidth_upgrade_negotiation_;
+}
+inline ::location::nearby::connections::BandwidthUpgradeNegotiationFrame* V1Frame::mutable_bandwidth_upgrade_negotiation() {
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame* _msg = _internal_mutable_bandwidth_upgrade_negotiation();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.V1Frame.bandwidth_upgrade_negotiation)
+  return _msg;
 }
-inline void OfflineFrame::set_version(::location::nearby::connections::OfflineFrame_Version value) {
-  _internal_set_version(value);
-  // @@protoc_insertion_point(field_set:location.nearby.connections.OfflineFrame.version)
+inline void V1Frame::set_allocated_bandwidth_upgrade_negotiation(::location::nearby::connections::BandwidthUpgradeNegotiationFrame* bandwidth_upgrade_negotiation) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete bandwidth_upgrade_negotiation_;
+  }
+  if (bandwidth_upgrade_negotiation) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::BandwidthUpgradeNegotiationFrame>::GetOwningArena(bandwidth_upgrade_negotiation);
+    if (message_arena != submessage_arena) {
+      bandwidth_upgrade_negotiation = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, bandwidth_upgrade_negotiation, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000008u;
+  } else {
+    _has_bits_[0] &= ~0x00000008u;
+  }
+  bandwidth_upgrade_negotiation_ = bandwidth_upgrade_negotiation;
+  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.V1Frame.bandwidth_upgrade_negotiation)
 }
 
-// optional .location.nearby.connections.V1Frame v1 = 2;
-inline bool OfflineFrame::_internal_has_v1() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
-  PROTOBUF_ASSUME(!value || v1_ != nullptr);
+// optional .location.nearby.connections.KeepAliveFrame keep_alive = 6;
+inline bool V1Frame::_internal_has_keep_alive() const {
+  bool value = (_has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || keep_alive_ != nullptr);
   return value;
 }
-inline bool OfflineFrame::has_v1() const {
-  return _internal_has_v1();
+inline bool V1Frame::has_keep_alive() const {
+  return _internal_has_keep_alive();
 }
-inline void OfflineFrame::clear_v1() {
-  if (v1_ != nullptr) v1_->Clear();
-  _has_bits_[0] &= ~0x00000001u;
+inline void V1Frame::clear_keep_alive() {
+  if (keep_alive_ != nullptr) keep_alive_->Clear();
+  _has_bits_[0] &= ~0x00000010u;
 }
-inline const ::location::nearby::connections::V1Frame& OfflineFrame::_internal_v1() const {
-  const ::location::nearby::connections::V1Frame* p = v1_;
-  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::V1Frame&>(
-      ::location::nearby::connections::_V1Frame_default_instance_);
+inline const ::location::nearby::connections::KeepAliveFrame& V1Frame::_internal_keep_alive() const {
+  const ::location::nearby::connections::KeepAliveFrame* p = keep_alive_;
+  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::KeepAliveFrame&>(
+      ::location::nearby::connections::_KeepAliveFrame_default_instance_);
 }
-inline const ::location::nearby::connections::V1Frame& OfflineFrame::v1() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.OfflineFrame.v1)
-  return _internal_v1();
+inline const ::location::nearby::connections::KeepAliveFrame& V1Frame::keep_alive() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.V1Frame.keep_alive)
+  return _internal_keep_alive();
 }
-inline void OfflineFrame::unsafe_arena_set_allocated_v1(
-    ::location::nearby::connections::V1Frame* v1) {
+inline void V1Frame::unsafe_arena_set_allocated_keep_alive(
+    ::location::nearby::connections::KeepAliveFrame* keep_alive) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(v1_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(keep_alive_);
   }
-  v1_ = v1;
-  if (v1) {
-    _has_bits_[0] |= 0x00000001u;
+  keep_alive_ = keep_alive;
+  if (keep_alive) {
+    _has_bits_[0] |= 0x00000010u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _has_bits_[0] &= ~0x00000010u;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.OfflineFrame.v1)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.V1Frame.keep_alive)
 }
-inline ::location::nearby::connections::V1Frame* OfflineFrame::release_v1() {
-  _has_bits_[0] &= ~0x00000001u;
-  ::location::nearby::connections::V1Frame* temp = v1_;
-  v1_ = nullptr;
+inline ::location::nearby::connections::KeepAliveFrame* V1Frame::release_keep_alive() {
+  _has_bits_[0] &= ~0x00000010u;
+  ::location::nearby::connections::KeepAliveFrame* temp = keep_alive_;
+  keep_alive_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -8625,118 +9674,175 @@ inline ::location::nearby::connections::V1Frame* OfflineFrame::release_v1() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::location::nearby::connections::V1Frame* OfflineFrame::unsafe_arena_release_v1() {
-  // @@protoc_insertion_point(field_release:location.nearby.connections.OfflineFrame.v1)
-  _has_bits_[0] &= ~0x00000001u;
-  ::location::nearby::connections::V1Frame* temp = v1_;
-  v1_ = nullptr;
+inline ::location::nearby::connections::KeepAliveFrame* V1Frame::unsafe_arena_release_keep_alive() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.V1Frame.keep_alive)
+  _has_bits_[0] &= ~0x00000010u;
+  ::location::nearby::connections::KeepAliveFrame* temp = keep_alive_;
+  keep_alive_ = nullptr;
   return temp;
 }
-inline ::location::nearby::connections::V1Frame* OfflineFrame::_internal_mutable_v1() {
-  _has_bits_[0] |= 0x00000001u;
-  if (v1_ == nullptr) {
-    auto* p = CreateMaybeMessage<::location::nearby::connections::V1Frame>(GetArenaForAllocation());
-    v1_ = p;
+inline ::location::nearby::connections::KeepAliveFrame* V1Frame::_internal_mutable_keep_alive() {
+  _has_bits_[0] |= 0x00000010u;
+  if (keep_alive_ == nullptr) {
+    auto* p = CreateMaybeMessage<::location::nearby::connections::KeepAliveFrame>(GetArenaForAllocation());
+    keep_alive_ = p;
   }
-  return v1_;
+  return keep_alive_;
 }
-inline ::location::nearby::connections::V1Frame* OfflineFrame::mutable_v1() {
-  ::location::nearby::connections::V1Frame* _msg = _internal_mutable_v1();
-  // @@protoc_insertion_point(field_mutable:location.nearby.connections.OfflineFrame.v1)
+inline ::location::nearby::connections::KeepAliveFrame* V1Frame::mutable_keep_alive() {
+  ::location::nearby::connections::KeepAliveFrame* _msg = _internal_mutable_keep_alive();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.V1Frame.keep_alive)
   return _msg;
 }
-inline void OfflineFrame::set_allocated_v1(::location::nearby::connections::V1Frame* v1) {
+inline void V1Frame::set_allocated_keep_alive(::location::nearby::connections::KeepAliveFrame* keep_alive) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete v1_;
+    delete keep_alive_;
   }
-  if (v1) {
+  if (keep_alive) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::V1Frame>::GetOwningArena(v1);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::KeepAliveFrame>::GetOwningArena(keep_alive);
     if (message_arena != submessage_arena) {
-      v1 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, v1, submessage_arena);
+      keep_alive = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, keep_alive, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000001u;
+    _has_bits_[0] |= 0x00000010u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _has_bits_[0] &= ~0x00000010u;
   }
-  v1_ = v1;
-  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.OfflineFrame.v1)
+  keep_alive_ = keep_alive;
+  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.V1Frame.keep_alive)
 }
 
-// -------------------------------------------------------------------
-
-// V1Frame
-
-// optional .location.nearby.connections.V1Frame.FrameType type = 1;
-inline bool V1Frame::_internal_has_type() const {
-  bool value = (_has_bits_[0] & 0x00001000u) != 0;
+// optional .location.nearby.connections.DisconnectionFrame disconnection = 7;
+inline bool V1Frame::_internal_has_disconnection() const {
+  bool value = (_has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || disconnection_ != nullptr);
   return value;
 }
-inline bool V1Frame::has_type() const {
-  return _internal_has_type();
+inline bool V1Frame::has_disconnection() const {
+  return _internal_has_disconnection();
 }
-inline void V1Frame::clear_type() {
-  type_ = 0;
-  _has_bits_[0] &= ~0x00001000u;
+inline void V1Frame::clear_disconnection() {
+  if (disconnection_ != nullptr) disconnection_->Clear();
+  _has_bits_[0] &= ~0x00000020u;
 }
-inline ::location::nearby::connections::V1Frame_FrameType V1Frame::_internal_type() const {
-  return static_cast< ::location::nearby::connections::V1Frame_FrameType >(type_);
+inline const ::location::nearby::connections::DisconnectionFrame& V1Frame::_internal_disconnection() const {
+  const ::location::nearby::connections::DisconnectionFrame* p = disconnection_;
+  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::DisconnectionFrame&>(
+      ::location::nearby::connections::_DisconnectionFrame_default_instance_);
 }
-inline ::location::nearby::connections::V1Frame_FrameType V1Frame::type() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.V1Frame.type)
-  return _internal_type();
+inline const ::location::nearby::connections::DisconnectionFrame& V1Frame::disconnection() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.V1Frame.disconnection)
+  return _internal_disconnection();
 }
-inline void V1Frame::_internal_set_type(::location::nearby::connections::V1Frame_FrameType value) {
-  assert(::location::nearby::connections::V1Frame_FrameType_IsValid(value));
-  _has_bits_[0] |= 0x00001000u;
-  type_ = value;
+inline void V1Frame::unsafe_arena_set_allocated_disconnection(
+    ::location::nearby::connections::DisconnectionFrame* disconnection) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(disconnection_);
+  }
+  disconnection_ = disconnection;
+  if (disconnection) {
+    _has_bits_[0] |= 0x00000020u;
+  } else {
+    _has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.V1Frame.disconnection)
 }
-inline void V1Frame::set_type(::location::nearby::connections::V1Frame_FrameType value) {
-  _internal_set_type(value);
-  // @@protoc_insertion_point(field_set:location.nearby.connections.V1Frame.type)
+inline ::location::nearby::connections::DisconnectionFrame* V1Frame::release_disconnection() {
+  _has_bits_[0] &= ~0x00000020u;
+  ::location::nearby::connections::DisconnectionFrame* temp = disconnection_;
+  disconnection_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::location::nearby::connections::DisconnectionFrame* V1Frame::unsafe_arena_release_disconnection() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.V1Frame.disconnection)
+  _has_bits_[0] &= ~0x00000020u;
+  ::location::nearby::connections::DisconnectionFrame* temp = disconnection_;
+  disconnection_ = nullptr;
+  return temp;
+}
+inline ::location::nearby::connections::DisconnectionFrame* V1Frame::_internal_mutable_disconnection() {
+  _has_bits_[0] |= 0x00000020u;
+  if (disconnection_ == nullptr) {
+    auto* p = CreateMaybeMessage<::location::nearby::connections::DisconnectionFrame>(GetArenaForAllocation());
+    disconnection_ = p;
+  }
+  return disconnection_;
+}
+inline ::location::nearby::connections::DisconnectionFrame* V1Frame::mutable_disconnection() {
+  ::location::nearby::connections::DisconnectionFrame* _msg = _internal_mutable_disconnection();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.V1Frame.disconnection)
+  return _msg;
+}
+inline void V1Frame::set_allocated_disconnection(::location::nearby::connections::DisconnectionFrame* disconnection) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete disconnection_;
+  }
+  if (disconnection) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::DisconnectionFrame>::GetOwningArena(disconnection);
+    if (message_arena != submessage_arena) {
+      disconnection = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, disconnection, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000020u;
+  } else {
+    _has_bits_[0] &= ~0x00000020u;
+  }
+  disconnection_ = disconnection;
+  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.V1Frame.disconnection)
 }
 
-// optional .location.nearby.connections.ConnectionRequestFrame connection_request = 2;
-inline bool V1Frame::_internal_has_connection_request() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
-  PROTOBUF_ASSUME(!value || connection_request_ != nullptr);
+// optional .location.nearby.connections.PairedKeyEncryptionFrame paired_key_encryption = 8;
+inline bool V1Frame::_internal_has_paired_key_encryption() const {
+  bool value = (_has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || paired_key_encryption_ != nullptr);
   return value;
 }
-inline bool V1Frame::has_connection_request() const {
-  return _internal_has_connection_request();
+inline bool V1Frame::has_paired_key_encryption() const {
+  return _internal_has_paired_key_encryption();
 }
-inline void V1Frame::clear_connection_request() {
-  if (connection_request_ != nullptr) connection_request_->Clear();
-  _has_bits_[0] &= ~0x00000001u;
+inline void V1Frame::clear_paired_key_encryption() {
+  if (paired_key_encryption_ != nullptr) paired_key_encryption_->Clear();
+  _has_bits_[0] &= ~0x00000040u;
 }
-inline const ::location::nearby::connections::ConnectionRequestFrame& V1Frame::_internal_connection_request() const {
-  const ::location::nearby::connections::ConnectionRequestFrame* p = connection_request_;
-  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::ConnectionRequestFrame&>(
-      ::location::nearby::connections::_ConnectionRequestFrame_default_instance_);
+inline const ::location::nearby::connections::PairedKeyEncryptionFrame& V1Frame::_internal_paired_key_encryption() const {
+  const ::location::nearby::connections::PairedKeyEncryptionFrame* p = paired_key_encryption_;
+  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::PairedKeyEncryptionFrame&>(
+      ::location::nearby::connections::_PairedKeyEncryptionFrame_default_instance_);
 }
-inline const ::location::nearby::connections::ConnectionRequestFrame& V1Frame::connection_request() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.V1Frame.connection_request)
-  return _internal_connection_request();
+inline const ::location::nearby::connections::PairedKeyEncryptionFrame& V1Frame::paired_key_encryption() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.V1Frame.paired_key_encryption)
+  return _internal_paired_key_encryption();
 }
-inline void V1Frame::unsafe_arena_set_allocated_connection_request(
-    ::location::nearby::connections::ConnectionRequestFrame* connection_request) {
+inline void V1Frame::unsafe_arena_set_allocated_paired_key_encryption(
+    ::location::nearby::connections::PairedKeyEncryptionFrame* paired_key_encryption) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(connection_request_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(paired_key_encryption_);
   }
-  connection_request_ = connection_request;
-  if (connection_request) {
-    _has_bits_[0] |= 0x00000001u;
+  paired_key_encryption_ = paired_key_encryption;
+  if (paired_key_encryption) {
+    _has_bits_[0] |= 0x00000040u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _has_bits_[0] &= ~0x00000040u;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.V1Frame.connection_request)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.V1Frame.paired_key_encryption)
 }
-inline ::location::nearby::connections::ConnectionRequestFrame* V1Frame::release_connection_request() {
-  _has_bits_[0] &= ~0x00000001u;
-  ::location::nearby::connections::ConnectionRequestFrame* temp = connection_request_;
-  connection_request_ = nullptr;
+inline ::location::nearby::connections::PairedKeyEncryptionFrame* V1Frame::release_paired_key_encryption() {
+  _has_bits_[0] &= ~0x00000040u;
+  ::location::nearby::connections::PairedKeyEncryptionFrame* temp = paired_key_encryption_;
+  paired_key_encryption_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -8748,85 +9854,85 @@ inline ::location::nearby::connections::ConnectionRequestFrame* V1Frame::release
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::location::nearby::connections::ConnectionRequestFrame* V1Frame::unsafe_arena_release_connection_request() {
-  // @@protoc_insertion_point(field_release:location.nearby.connections.V1Frame.connection_request)
-  _has_bits_[0] &= ~0x00000001u;
-  ::location::nearby::connections::ConnectionRequestFrame* temp = connection_request_;
-  connection_request_ = nullptr;
+inline ::location::nearby::connections::PairedKeyEncryptionFrame* V1Frame::unsafe_arena_release_paired_key_encryption() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.V1Frame.paired_key_encryption)
+  _has_bits_[0] &= ~0x00000040u;
+  ::location::nearby::connections::PairedKeyEncryptionFrame* temp = paired_key_encryption_;
+  paired_key_encryption_ = nullptr;
   return temp;
 }
-inline ::location::nearby::connections::ConnectionRequestFrame* V1Frame::_internal_mutable_connection_request() {
-  _has_bits_[0] |= 0x00000001u;
-  if (connection_request_ == nullptr) {
-    auto* p = CreateMaybeMessage<::location::nearby::connections::ConnectionRequestFrame>(GetArenaForAllocation());
-    connection_request_ = p;
+inline ::location::nearby::connections::PairedKeyEncryptionFrame* V1Frame::_internal_mutable_paired_key_encryption() {
+  _has_bits_[0] |= 0x00000040u;
+  if (paired_key_encryption_ == nullptr) {
+    auto* p = CreateMaybeMessage<::location::nearby::connections::PairedKeyEncryptionFrame>(GetArenaForAllocation());
+    paired_key_encryption_ = p;
   }
-  return connection_request_;
+  return paired_key_encryption_;
 }
-inline ::location::nearby::connections::ConnectionRequestFrame* V1Frame::mutable_connection_request() {
-  ::location::nearby::connections::ConnectionRequestFrame* _msg = _internal_mutable_connection_request();
-  // @@protoc_insertion_point(field_mutable:location.nearby.connections.V1Frame.connection_request)
+inline ::location::nearby::connections::PairedKeyEncryptionFrame* V1Frame::mutable_paired_key_encryption() {
+  ::location::nearby::connections::PairedKeyEncryptionFrame* _msg = _internal_mutable_paired_key_encryption();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.V1Frame.paired_key_encryption)
   return _msg;
 }
-inline void V1Frame::set_allocated_connection_request(::location::nearby::connections::ConnectionRequestFrame* connection_request) {
+inline void V1Frame::set_allocated_paired_key_encryption(::location::nearby::connections::PairedKeyEncryptionFrame* paired_key_encryption) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete connection_request_;
+    delete paired_key_encryption_;
   }
-  if (connection_request) {
+  if (paired_key_encryption) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::ConnectionRequestFrame>::GetOwningArena(connection_request);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::PairedKeyEncryptionFrame>::GetOwningArena(paired_key_encryption);
     if (message_arena != submessage_arena) {
-      connection_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, connection_request, submessage_arena);
+      paired_key_encryption = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, paired_key_encryption, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000001u;
+    _has_bits_[0] |= 0x00000040u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _has_bits_[0] &= ~0x00000040u;
   }
-  connection_request_ = connection_request;
-  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.V1Frame.connection_request)
+  paired_key_encryption_ = paired_key_encryption;
+  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.V1Frame.paired_key_encryption)
 }
 
-// optional .location.nearby.connections.ConnectionResponseFrame connection_response = 3;
-inline bool V1Frame::_internal_has_connection_response() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
-  PROTOBUF_ASSUME(!value || connection_response_ != nullptr);
+// optional .location.nearby.connections.AuthenticationMessageFrame authentication_message = 9;
+inline bool V1Frame::_internal_has_authentication_message() const {
+  bool value = (_has_bits_[0] & 0x00000080u) != 0;
+  PROTOBUF_ASSUME(!value || authentication_message_ != nullptr);
   return value;
 }
-inline bool V1Frame::has_connection_response() const {
-  return _internal_has_connection_response();
+inline bool V1Frame::has_authentication_message() const {
+  return _internal_has_authentication_message();
 }
-inline void V1Frame::clear_connection_response() {
-  if (connection_response_ != nullptr) connection_response_->Clear();
-  _has_bits_[0] &= ~0x00000002u;
+inline void V1Frame::clear_authentication_message() {
+  if (authentication_message_ != nullptr) authentication_message_->Clear();
+  _has_bits_[0] &= ~0x00000080u;
 }
-inline const ::location::nearby::connections::ConnectionResponseFrame& V1Frame::_internal_connection_response() const {
-  const ::location::nearby::connections::ConnectionResponseFrame* p = connection_response_;
-  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::ConnectionResponseFrame&>(
-      ::location::nearby::connections::_ConnectionResponseFrame_default_instance_);
+inline const ::location::nearby::connections::AuthenticationMessageFrame& V1Frame::_internal_authentication_message() const {
+  const ::location::nearby::connections::AuthenticationMessageFrame* p = authentication_message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::AuthenticationMessageFrame&>(
+      ::location::nearby::connections::_AuthenticationMessageFrame_default_instance_);
 }
-inline const ::location::nearby::connections::ConnectionResponseFrame& V1Frame::connection_response() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.V1Frame.connection_response)
-  return _internal_connection_response();
+inline const ::location::nearby::connections::AuthenticationMessageFrame& V1Frame::authentication_message() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.V1Frame.authentication_message)
+  return _internal_authentication_message();
 }
-inline void V1Frame::unsafe_arena_set_allocated_connection_response(
-    ::location::nearby::connections::ConnectionResponseFrame* connection_response) {
+inline void V1Frame::unsafe_arena_set_allocated_authentication_message(
+    ::location::nearby::connections::AuthenticationMessageFrame* authentication_message) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(connection_response_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(authentication_message_);
   }
-  connection_response_ = connection_response;
-  if (connection_response) {
-    _has_bits_[0] |= 0x00000002u;
+  authentication_message_ = authentication_message;
+  if (authentication_message) {
+    _has_bits_[0] |= 0x00000080u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _has_bits_[0] &= ~0x00000080u;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.V1Frame.connection_response)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.V1Frame.authentication_message)
 }
-inline ::location::nearby::connections::ConnectionResponseFrame* V1Frame::release_connection_response() {
-  _has_bits_[0] &= ~0x00000002u;
-  ::location::nearby::connections::ConnectionResponseFrame* temp = connection_response_;
-  connection_response_ = nullptr;
+inline ::location::nearby::connections::AuthenticationMessageFrame* V1Frame::release_authentication_message() {
+  _has_bits_[0] &= ~0x00000080u;
+  ::location::nearby::connections::AuthenticationMessageFrame* temp = authentication_message_;
+  authentication_message_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -8838,85 +9944,85 @@ inline ::location::nearby::connections::ConnectionResponseFrame* V1Frame::releas
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::location::nearby::connections::ConnectionResponseFrame* V1Frame::unsafe_arena_release_connection_response() {
-  // @@protoc_insertion_point(field_release:location.nearby.connections.V1Frame.connection_response)
-  _has_bits_[0] &= ~0x00000002u;
-  ::location::nearby::connections::ConnectionResponseFrame* temp = connection_response_;
-  connection_response_ = nullptr;
+inline ::location::nearby::connections::AuthenticationMessageFrame* V1Frame::unsafe_arena_release_authentication_message() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.V1Frame.authentication_message)
+  _has_bits_[0] &= ~0x00000080u;
+  ::location::nearby::connections::AuthenticationMessageFrame* temp = authentication_message_;
+  authentication_message_ = nullptr;
   return temp;
 }
-inline ::location::nearby::connections::ConnectionResponseFrame* V1Frame::_internal_mutable_connection_response() {
-  _has_bits_[0] |= 0x00000002u;
-  if (connection_response_ == nullptr) {
-    auto* p = CreateMaybeMessage<::location::nearby::connections::ConnectionResponseFrame>(GetArenaForAllocation());
-    connection_response_ = p;
+inline ::location::nearby::connections::AuthenticationMessageFrame* V1Frame::_internal_mutable_authentication_message() {
+  _has_bits_[0] |= 0x00000080u;
+  if (authentication_message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::location::nearby::connections::AuthenticationMessageFrame>(GetArenaForAllocation());
+    authentication_message_ = p;
   }
-  return connection_response_;
+  return authentication_message_;
 }
-inline ::location::nearby::connections::ConnectionResponseFrame* V1Frame::mutable_connection_response() {
-  ::location::nearby::connections::ConnectionResponseFrame* _msg = _internal_mutable_connection_response();
-  // @@protoc_insertion_point(field_mutable:location.nearby.connections.V1Frame.connection_response)
+inline ::location::nearby::connections::AuthenticationMessageFrame* V1Frame::mutable_authentication_message() {
+  ::location::nearby::connections::AuthenticationMessageFrame* _msg = _internal_mutable_authentication_message();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.V1Frame.authentication_message)
   return _msg;
 }
-inline void V1Frame::set_allocated_connection_response(::location::nearby::connections::ConnectionResponseFrame* connection_response) {
+inline void V1Frame::set_allocated_authentication_message(::location::nearby::connections::AuthenticationMessageFrame* authentication_message) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete connection_response_;
+    delete authentication_message_;
   }
-  if (connection_response) {
+  if (authentication_message) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::ConnectionResponseFrame>::GetOwningArena(connection_response);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::AuthenticationMessageFrame>::GetOwningArena(authentication_message);
     if (message_arena != submessage_arena) {
-      connection_response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, connection_response, submessage_arena);
+      authentication_message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, authentication_message, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000002u;
+    _has_bits_[0] |= 0x00000080u;
   } else {
-    _has_bits_[0] &= ~0x00000002u;
+    _has_bits_[0] &= ~0x00000080u;
   }
-  connection_response_ = connection_response;
-  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.V1Frame.connection_response)
+  authentication_message_ = authentication_message;
+  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.V1Frame.authentication_message)
 }
 
-// optional .location.nearby.connections.PayloadTransferFrame payload_transfer = 4;
-inline bool V1Frame::_internal_has_payload_transfer() const {
-  bool value = (_has_bits_[0] & 0x00000004u) != 0;
-  PROTOBUF_ASSUME(!value || payload_transfer_ != nullptr);
+// optional .location.nearby.connections.AuthenticationResultFrame authentication_result = 10;
+inline bool V1Frame::_internal_has_authentication_result() const {
+  bool value = (_has_bits_[0] & 0x00000100u) != 0;
+  PROTOBUF_ASSUME(!value || authentication_result_ != nullptr);
   return value;
 }
-inline bool V1Frame::has_payload_transfer() const {
-  return _internal_has_payload_transfer();
+inline bool V1Frame::has_authentication_result() const {
+  return _internal_has_authentication_result();
 }
-inline void V1Frame::clear_payload_transfer() {
-  if (payload_transfer_ != nullptr) payload_transfer_->Clear();
-  _has_bits_[0] &= ~0x00000004u;
+inline void V1Frame::clear_authentication_result() {
+  if (authentication_result_ != nullptr) authentication_result_->Clear();
+  _has_bits_[0] &= ~0x00000100u;
 }
-inline const ::location::nearby::connections::PayloadTransferFrame& V1Frame::_internal_payload_transfer() const {
-  const ::location::nearby::connections::PayloadTransferFrame* p = payload_transfer_;
-  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::PayloadTransferFrame&>(
-      ::location::nearby::connections::_PayloadTransferFrame_default_instance_);
+inline const ::location::nearby::connections::AuthenticationResultFrame& V1Frame::_internal_authentication_result() const {
+  const ::location::nearby::connections::AuthenticationResultFrame* p = authentication_result_;
+  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::AuthenticationResultFrame&>(
+      ::location::nearby::connections::_AuthenticationResultFrame_default_instance_);
 }
-inline const ::location::nearby::connections::PayloadTransferFrame& V1Frame::payload_transfer() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.V1Frame.payload_transfer)
-  return _internal_payload_transfer();
+inline const ::location::nearby::connections::AuthenticationResultFrame& V1Frame::authentication_result() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.V1Frame.authentication_result)
+  return _internal_authentication_result();
 }
-inline void V1Frame::unsafe_arena_set_allocated_payload_transfer(
-    ::location::nearby::connections::PayloadTransferFrame* payload_transfer) {
+inline void V1Frame::unsafe_arena_set_allocated_authentication_result(
+    ::location::nearby::connections::AuthenticationResultFrame* authentication_result) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(payload_transfer_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(authentication_result_);
   }
-  payload_transfer_ = payload_transfer;
-  if (payload_transfer) {
-    _has_bits_[0] |= 0x00000004u;
+  authentication_result_ = authentication_result;
+  if (authentication_result) {
+    _has_bits_[0] |= 0x00000100u;
   } else {
-    _has_bits_[0] &= ~0x00000004u;
+    _has_bits_[0] &= ~0x00000100u;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.V1Frame.payload_transfer)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.V1Frame.authentication_result)
 }
-inline ::location::nearby::connections::PayloadTransferFrame* V1Frame::release_payload_transfer() {
-  _has_bits_[0] &= ~0x00000004u;
-  ::location::nearby::connections::PayloadTransferFrame* temp = payload_transfer_;
-  payload_transfer_ = nullptr;
+inline ::location::nearby::connections::AuthenticationResultFrame* V1Frame::release_authentication_result() {
+  _has_bits_[0] &= ~0x00000100u;
+  ::location::nearby::connections::AuthenticationResultFrame* temp = authentication_result_;
+  authentication_result_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -8928,85 +10034,85 @@ inline ::location::nearby::connections::PayloadTransferFrame* V1Frame::release_p
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::location::nearby::connections::PayloadTransferFrame* V1Frame::unsafe_arena_release_payload_transfer() {
-  // @@protoc_insertion_point(field_release:location.nearby.connections.V1Frame.payload_transfer)
-  _has_bits_[0] &= ~0x00000004u;
-  ::location::nearby::connections::PayloadTransferFrame* temp = payload_transfer_;
-  payload_transfer_ = nullptr;
+inline ::location::nearby::connections::AuthenticationResultFrame* V1Frame::unsafe_arena_release_authentication_result() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.V1Frame.authentication_result)
+  _has_bits_[0] &= ~0x00000100u;
+  ::location::nearby::connections::AuthenticationResultFrame* temp = authentication_result_;
+  authentication_result_ = nullptr;
   return temp;
 }
-inline ::location::nearby::connections::PayloadTransferFrame* V1Frame::_internal_mutable_payload_transfer() {
-  _has_bits_[0] |= 0x00000004u;
-  if (payload_transfer_ == nullptr) {
-    auto* p = CreateMaybeMessage<::location::nearby::connections::PayloadTransferFrame>(GetArenaForAllocation());
-    payload_transfer_ = p;
+inline ::location::nearby::connections::AuthenticationResultFrame* V1Frame::_internal_mutable_authentication_result() {
+  _has_bits_[0] |= 0x00000100u;
+  if (authentication_result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::location::nearby::connections::AuthenticationResultFrame>(GetArenaForAllocation());
+    authentication_result_ = p;
   }
-  return payload_transfer_;
+  return authentication_result_;
 }
-inline ::location::nearby::connections::PayloadTransferFrame* V1Frame::mutable_payload_transfer() {
-  ::location::nearby::connections::PayloadTransferFrame* _msg = _internal_mutable_payload_transfer();
-  // @@protoc_insertion_point(field_mutable:location.nearby.connections.V1Frame.payload_transfer)
+inline ::location::nearby::connections::AuthenticationResultFrame* V1Frame::mutable_authentication_result() {
+  ::location::nearby::connections::AuthenticationResultFrame* _msg = _internal_mutable_authentication_result();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.V1Frame.authentication_result)
   return _msg;
 }
-inline void V1Frame::set_allocated_payload_transfer(::location::nearby::connections::PayloadTransferFrame* payload_transfer) {
+inline void V1Frame::set_allocated_authentication_result(::location::nearby::connections::AuthenticationResultFrame* authentication_result) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete payload_transfer_;
+    delete authentication_result_;
   }
-  if (payload_transfer) {
+  if (authentication_result) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::PayloadTransferFrame>::GetOwningArena(payload_transfer);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::AuthenticationResultFrame>::GetOwningArena(authentication_result);
     if (message_arena != submessage_arena) {
-      payload_transfer = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, payload_transfer, submessage_arena);
+      authentication_result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, authentication_result, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000004u;
+    _has_bits_[0] |= 0x00000100u;
   } else {
-    _has_bits_[0] &= ~0x00000004u;
+    _has_bits_[0] &= ~0x00000100u;
   }
-  payload_transfer_ = payload_transfer;
-  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.V1Frame.payload_transfer)
+  authentication_result_ = authentication_result;
+  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.V1Frame.authentication_result)
 }
 
-// optional .location.nearby.connections.BandwidthUpgradeNegotiationFrame bandwidth_upgrade_negotiation = 5;
-inline bool V1Frame::_internal_has_bandwidth_upgrade_negotiation() const {
-  bool value = (_has_bits_[0] & 0x00000008u) != 0;
-  PROTOBUF_ASSUME(!value || bandwidth_upgrade_negotiation_ != nullptr);
+// optional .location.nearby.connections.AutoResumeFrame auto_resume = 11;
+inline bool V1Frame::_internal_has_auto_resume() const {
+  bool value = (_has_bits_[0] & 0x00000200u) != 0;
+  PROTOBUF_ASSUME(!value || auto_resume_ != nullptr);
   return value;
 }
-inline bool V1Frame::has_bandwidth_upgrade_negotiation() const {
-  return _internal_has_bandwidth_upgrade_negotiation();
+inline bool V1Frame::has_auto_resume() const {
+  return _internal_has_auto_resume();
 }
-inline void V1Frame::clear_bandwidth_upgrade_negotiation() {
-  if (bandwidth_upgrade_negotiation_ != nullptr) bandwidth_upgrade_negotiation_->Clear();
-  _has_bits_[0] &= ~0x00000008u;
+inline void V1Frame::clear_auto_resume() {
+  if (auto_resume_ != nullptr) auto_resume_->Clear();
+  _has_bits_[0] &= ~0x00000200u;
 }
-inline const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame& V1Frame::_internal_bandwidth_upgrade_negotiation() const {
-  const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame* p = bandwidth_upgrade_negotiation_;
-  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame&>(
-      ::location::nearby::connections::_BandwidthUpgradeNegotiationFrame_default_instance_);
+inline const ::location::nearby::connections::AutoResumeFrame& V1Frame::_internal_auto_resume() const {
+  const ::location::nearby::connections::AutoResumeFrame* p = auto_resume_;
+  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::AutoResumeFrame&>(
+      ::location::nearby::connections::_AutoResumeFrame_default_instance_);
 }
-inline const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame& V1Frame::bandwidth_upgrade_negotiation() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.V1Frame.bandwidth_upgrade_negotiation)
-  return _internal_bandwidth_upgrade_negotiation();
+inline const ::location::nearby::connections::AutoResumeFrame& V1Frame::auto_resume() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.V1Frame.auto_resume)
+  return _internal_auto_resume();
 }
-inline void V1Frame::unsafe_arena_set_allocated_bandwidth_upgrade_negotiation(
-    ::location::nearby::connections::BandwidthUpgradeNegotiationFrame* bandwidth_upgrade_negotiation) {
+inline void V1Frame::unsafe_arena_set_allocated_auto_resume(
+    ::location::nearby::connections::AutoResumeFrame* auto_resume) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(bandwidth_upgrade_negotiation_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(auto_resume_);
   }
-  bandwidth_upgrade_negotiation_ = bandwidth_upgrade_negotiation;
-  if (bandwidth_upgrade_negotiation) {
-    _has_bits_[0] |= 0x00000008u;
+  auto_resume_ = auto_resume;
+  if (auto_resume) {
+    _has_bits_[0] |= 0x00000200u;
   } else {
-    _has_bits_[0] &= ~0x00000008u;
+    _has_bits_[0] &= ~0x00000200u;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.V1Frame.bandwidth_upgrade_negotiation)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.V1Frame.auto_resume)
 }
-inline ::location::nearby::connections::BandwidthUpgradeNegotiationFrame* V1Frame::release_bandwidth_upgrade_negotiation() {
-  _has_bits_[0] &= ~0x00000008u;
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame* temp = bandwidth_upgrade_negotiation_;
-  bandwidth_upgrade_negotiation_ = nullptr;
+inline ::location::nearby::connections::AutoResumeFrame* V1Frame::release_auto_resume() {
+  _has_bits_[0] &= ~0x00000200u;
+  ::location::nearby::connections::AutoResumeFrame* temp = auto_resume_;
+  auto_resume_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -9018,85 +10124,85 @@ inline ::location::nearby::connections::BandwidthUpgradeNegotiationFrame* V1Fram
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::location::nearby::connections::BandwidthUpgradeNegotiationFrame* V1Frame::unsafe_arena_release_bandwidth_upgrade_negotiation() {
-  // @@protoc_insertion_point(field_release:location.nearby.connections.V1Frame.bandwidth_upgrade_negotiation)
-  _has_bits_[0] &= ~0x00000008u;
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame* temp = bandwidth_upgrade_negotiation_;
-  bandwidth_upgrade_negotiation_ = nullptr;
+inline ::location::nearby::connections::AutoResumeFrame* V1Frame::unsafe_arena_release_auto_resume() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.V1Frame.auto_resume)
+  _has_bits_[0] &= ~0x00000200u;
+  ::location::nearby::connections::AutoResumeFrame* temp = auto_resume_;
+  auto_resume_ = nullptr;
   return temp;
 }
-inline ::location::nearby::connections::BandwidthUpgradeNegotiationFrame* V1Frame::_internal_mutable_bandwidth_upgrade_negotiation() {
-  _has_bits_[0] |= 0x00000008u;
-  if (bandwidth_upgrade_negotiation_ == nullptr) {
-    auto* p = CreateMaybeMessage<::location::nearby::connections::BandwidthUpgradeNegotiationFrame>(GetArenaForAllocation());
-    bandwidth_upgrade_negotiation_ = p;
+inline ::location::nearby::connections::AutoResumeFrame* V1Frame::_internal_mutable_auto_resume() {
+  _has_bits_[0] |= 0x00000200u;
+  if (auto_resume_ == nullptr) {
+    auto* p = CreateMaybeMessage<::location::nearby::connections::AutoResumeFrame>(GetArenaForAllocation());
+    auto_resume_ = p;
   }
-  return bandwidth_upgrade_negotiation_;
+  return auto_resume_;
 }
-inline ::location::nearby::connections::BandwidthUpgradeNegotiationFrame* V1Frame::mutable_bandwidth_upgrade_negotiation() {
-  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame* _msg = _internal_mutable_bandwidth_upgrade_negotiation();
-  // @@protoc_insertion_point(field_mutable:location.nearby.connections.V1Frame.bandwidth_upgrade_negotiation)
+inline ::location::nearby::connections::AutoResumeFrame* V1Frame::mutable_auto_resume() {
+  ::location::nearby::connections::AutoResumeFrame* _msg = _internal_mutable_auto_resume();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.V1Frame.auto_resume)
   return _msg;
 }
-inline void V1Frame::set_allocated_bandwidth_upgrade_negotiation(::location::nearby::connections::BandwidthUpgradeNegotiationFrame* bandwidth_upgrade_negotiation) {
+inline void V1Frame::set_allocated_auto_resume(::location::nearby::connections::AutoResumeFrame* auto_resume) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete bandwidth_upgrade_negotiation_;
+    delete auto_resume_;
   }
-  if (bandwidth_upgrade_negotiation) {
+  if (auto_resume) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::BandwidthUpgradeNegotiationFrame>::GetOwningArena(bandwidth_upgrade_negotiation);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::AutoResumeFrame>::GetOwningArena(auto_resume);
     if (message_arena != submessage_arena) {
-      bandwidth_upgrade_negotiation = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, bandwidth_upgrade_negotiation, submessage_arena);
+      auto_resume = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, auto_resume, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000008u;
+    _has_bits_[0] |= 0x00000200u;
   } else {
-    _has_bits_[0] &= ~0x00000008u;
+    _has_bits_[0] &= ~0x00000200u;
   }
-  bandwidth_upgrade_negotiation_ = bandwidth_upgrade_negotiation;
-  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.V1Frame.bandwidth_upgrade_negotiation)
+  auto_resume_ = auto_resume;
+  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.V1Frame.auto_resume)
 }
 
-// optional .location.nearby.connections.KeepAliveFrame keep_alive = 6;
-inline bool V1Frame::_internal_has_keep_alive() const {
-  bool value = (_has_bits_[0] & 0x00000010u) != 0;
-  PROTOBUF_ASSUME(!value || keep_alive_ != nullptr);
+// optional .location.nearby.connections.AutoReconnectFrame auto_reconnect = 12;
+inline bool V1Frame::_internal_has_auto_reconnect() const {
+  bool value = (_has_bits_[0] & 0x00000400u) != 0;
+  PROTOBUF_ASSUME(!value || auto_reconnect_ != nullptr);
   return value;
 }
-inline bool V1Frame::has_keep_alive() const {
-  return _internal_has_keep_alive();
+inline bool V1Frame::has_auto_reconnect() const {
+  return _internal_has_auto_reconnect();
 }
-inline void V1Frame::clear_keep_alive() {
-  if (keep_alive_ != nullptr) keep_alive_->Clear();
-  _has_bits_[0] &= ~0x00000010u;
+inline void V1Frame::clear_auto_reconnect() {
+  if (auto_reconnect_ != nullptr) auto_reconnect_->Clear();
+  _has_bits_[0] &= ~0x00000400u;
 }
-inline const ::location::nearby::connections::KeepAliveFrame& V1Frame::_internal_keep_alive() const {
-  const ::location::nearby::connections::KeepAliveFrame* p = keep_alive_;
-  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::KeepAliveFrame&>(
-      ::location::nearby::connections::_KeepAliveFrame_default_instance_);
+inline const ::location::nearby::connections::AutoReconnectFrame& V1Frame::_internal_auto_reconnect() const {
+  const ::location::nearby::connections::AutoReconnectFrame* p = auto_reconnect_;
+  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::AutoReconnectFrame&>(
+      ::location::nearby::connections::_AutoReconnectFrame_default_instance_);
 }
-inline const ::location::nearby::connections::KeepAliveFrame& V1Frame::keep_alive() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.V1Frame.keep_alive)
-  return _internal_keep_alive();
+inline const ::location::nearby::connections::AutoReconnectFrame& V1Frame::auto_reconnect() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.V1Frame.auto_reconnect)
+  return _internal_auto_reconnect();
 }
-inline void V1Frame::unsafe_arena_set_allocated_keep_alive(
-    ::location::nearby::connections::KeepAliveFrame* keep_alive) {
+inline void V1Frame::unsafe_arena_set_allocated_auto_reconnect(
+    ::location::nearby::connections::AutoReconnectFrame* auto_reconnect) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(keep_alive_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(auto_reconnect_);
   }
-  keep_alive_ = keep_alive;
-  if (keep_alive) {
-    _has_bits_[0] |= 0x00000010u;
+  auto_reconnect_ = auto_reconnect;
+  if (auto_reconnect) {
+    _has_bits_[0] |= 0x00000400u;
   } else {
-    _has_bits_[0] &= ~0x00000010u;
+    _has_bits_[0] &= ~0x00000400u;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.V1Frame.keep_alive)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.V1Frame.auto_reconnect)
 }
-inline ::location::nearby::connections::KeepAliveFrame* V1Frame::release_keep_alive() {
-  _has_bits_[0] &= ~0x00000010u;
-  ::location::nearby::connections::KeepAliveFrame* temp = keep_alive_;
-  keep_alive_ = nullptr;
+inline ::location::nearby::connections::AutoReconnectFrame* V1Frame::release_auto_reconnect() {
+  _has_bits_[0] &= ~0x00000400u;
+  ::location::nearby::connections::AutoReconnectFrame* temp = auto_reconnect_;
+  auto_reconnect_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -9108,85 +10214,85 @@ inline ::location::nearby::connections::KeepAliveFrame* V1Frame::release_keep_al
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::location::nearby::connections::KeepAliveFrame* V1Frame::unsafe_arena_release_keep_alive() {
-  // @@protoc_insertion_point(field_release:location.nearby.connections.V1Frame.keep_alive)
-  _has_bits_[0] &= ~0x00000010u;
-  ::location::nearby::connections::KeepAliveFrame* temp = keep_alive_;
-  keep_alive_ = nullptr;
+inline ::location::nearby::connections::AutoReconnectFrame* V1Frame::unsafe_arena_release_auto_reconnect() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.V1Frame.auto_reconnect)
+  _has_bits_[0] &= ~0x00000400u;
+  ::location::nearby::connections::AutoReconnectFrame* temp = auto_reconnect_;
+  auto_reconnect_ = nullptr;
   return temp;
 }
-inline ::location::nearby::connections::KeepAliveFrame* V1Frame::_internal_mutable_keep_alive() {
-  _has_bits_[0] |= 0x00000010u;
-  if (keep_alive_ == nullptr) {
-    auto* p = CreateMaybeMessage<::location::nearby::connections::KeepAliveFrame>(GetArenaForAllocation());
-    keep_alive_ = p;
+inline ::location::nearby::connections::AutoReconnectFrame* V1Frame::_internal_mutable_auto_reconnect() {
+  _has_bits_[0] |= 0x00000400u;
+  if (auto_reconnect_ == nullptr) {
+    auto* p = CreateMaybeMessage<::location::nearby::connections::AutoReconnectFrame>(GetArenaForAllocation());
+    auto_reconnect_ = p;
   }
-  return keep_alive_;
+  return auto_reconnect_;
 }
-inline ::location::nearby::connections::KeepAliveFrame* V1Frame::mutable_keep_alive() {
-  ::location::nearby::connections::KeepAliveFrame* _msg = _internal_mutable_keep_alive();
-  // @@protoc_insertion_point(field_mutable:location.nearby.connections.V1Frame.keep_alive)
+inline ::location::nearby::connections::AutoReconnectFrame* V1Frame::mutable_auto_reconnect() {
+  ::location::nearby::connections::AutoReconnectFrame* _msg = _internal_mutable_auto_reconnect();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.V1Frame.auto_reconnect)
   return _msg;
 }
-inline void V1Frame::set_allocated_keep_alive(::location::nearby::connections::KeepAliveFrame* keep_alive) {
+inline void V1Frame::set_allocated_auto_reconnect(::location::nearby::connections::AutoReconnectFrame* auto_reconnect) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete keep_alive_;
+    delete auto_reconnect_;
   }
-  if (keep_alive) {
+  if (auto_reconnect) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::KeepAliveFrame>::GetOwningArena(keep_alive);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::AutoReconnectFrame>::GetOwningArena(auto_reconnect);
     if (message_arena != submessage_arena) {
-      keep_alive = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, keep_alive, submessage_arena);
+      auto_reconnect = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, auto_reconnect, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000010u;
+    _has_bits_[0] |= 0x00000400u;
   } else {
-    _has_bits_[0] &= ~0x00000010u;
+    _has_bits_[0] &= ~0x00000400u;
   }
-  keep_alive_ = keep_alive;
-  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.V1Frame.keep_alive)
+  auto_reconnect_ = auto_reconnect;
+  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.V1Frame.auto_reconnect)
 }
 
-// optional .location.nearby.connections.DisconnectionFrame disconnection = 7;
-inline bool V1Frame::_internal_has_disconnection() const {
-  bool value = (_has_bits_[0] & 0x00000020u) != 0;
-  PROTOBUF_ASSUME(!value || disconnection_ != nullptr);
+// optional .location.nearby.connections.BandwidthUpgradeRetryFrame bandwidth_upgrade_retry = 13;
+inline bool V1Frame::_internal_has_bandwidth_upgrade_retry() const {
+  bool value = (_has_bits_[0] & 0x00000800u) != 0;
+  PROTOBUF_ASSUME(!value || bandwidth_upgrade_retry_ != nullptr);
   return value;
 }
-inline bool V1Frame::has_disconnection() const {
-  return _internal_has_disconnection();
-}
-inline void V1Frame::clear_disconnection() {
-  if (disconnection_ != nullptr) disconnection_->Clear();
-  _has_bits_[0] &= ~0x00000020u;
+inline bool V1Frame::has_bandwidth_upgrade_retry() const {
+  return _internal_has_bandwidth_upgrade_retry();
 }
-inline const ::location::nearby::connections::DisconnectionFrame& V1Frame::_internal_disconnection() const {
-  const ::location::nearby::connections::DisconnectionFrame* p = disconnection_;
-  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::DisconnectionFrame&>(
-      ::location::nearby::connections::_DisconnectionFrame_default_instance_);
+inline void V1Frame::clear_bandwidth_upgrade_retry() {
+  if (bandwidth_upgrade_retry_ != nullptr) bandwidth_upgrade_retry_->Clear();
+  _has_bits_[0] &= ~0x00000800u;
 }
-inline const ::location::nearby::connections::DisconnectionFrame& V1Frame::disconnection() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.V1Frame.disconnection)
-  return _internal_disconnection();
+inline const ::location::nearby::connections::BandwidthUpgradeRetryFrame& V1Frame::_internal_bandwidth_upgrade_retry() const {
+  const ::location::nearby::connections::BandwidthUpgradeRetryFrame* p = bandwidth_upgrade_retry_;
+  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::BandwidthUpgradeRetryFrame&>(
+      ::location::nearby::connections::_BandwidthUpgradeRetryFrame_default_instance_);
 }
-inline void V1Frame::unsafe_arena_set_allocated_disconnection(
-    ::location::nearby::connections::DisconnectionFrame* disconnection) {
+inline const ::location::nearby::connections::BandwidthUpgradeRetryFrame& V1Frame::bandwidth_upgrade_retry() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.V1Frame.bandwidth_upgrade_retry)
+  return _internal_bandwidth_upgrade_retry();
+}
+inline void V1Frame::unsafe_arena_set_allocated_bandwidth_upgrade_retry(
+    ::location::nearby::connections::BandwidthUpgradeRetryFrame* bandwidth_upgrade_retry) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(disconnection_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(bandwidth_upgrade_retry_);
   }
-  disconnection_ = disconnection;
-  if (disconnection) {
-    _has_bits_[0] |= 0x00000020u;
+  bandwidth_upgrade_retry_ = bandwidth_upgrade_retry;
+  if (bandwidth_upgrade_retry) {
+    _has_bits_[0] |= 0x00000800u;
   } else {
-    _has_bits_[0] &= ~0x00000020u;
+    _has_bits_[0] &= ~0x00000800u;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.V1Frame.disconnection)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.V1Frame.bandwidth_upgrade_retry)
 }
-inline ::location::nearby::connections::DisconnectionFrame* V1Frame::release_disconnection() {
-  _has_bits_[0] &= ~0x00000020u;
-  ::location::nearby::connections::DisconnectionFrame* temp = disconnection_;
-  disconnection_ = nullptr;
+inline ::location::nearby::connections::BandwidthUpgradeRetryFrame* V1Frame::release_bandwidth_upgrade_retry() {
+  _has_bits_[0] &= ~0x00000800u;
+  ::location::nearby::connections::BandwidthUpgradeRetryFrame* temp = bandwidth_upgrade_retry_;
+  bandwidth_upgrade_retry_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -9198,535 +10304,438 @@ inline ::location::nearby::connections::DisconnectionFrame* V1Frame::release_dis
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::location::nearby::connections::DisconnectionFrame* V1Frame::unsafe_arena_release_disconnection() {
-  // @@protoc_insertion_point(field_release:location.nearby.connections.V1Frame.disconnection)
-  _has_bits_[0] &= ~0x00000020u;
-  ::location::nearby::connections::DisconnectionFrame* temp = disconnection_;
-  disconnection_ = nullptr;
+inline ::location::nearby::connections::BandwidthUpgradeRetryFrame* V1Frame::unsafe_arena_release_bandwidth_upgrade_retry() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.V1Frame.bandwidth_upgrade_retry)
+  _has_bits_[0] &= ~0x00000800u;
+  ::location::nearby::connections::BandwidthUpgradeRetryFrame* temp = bandwidth_upgrade_retry_;
+  bandwidth_upgrade_retry_ = nullptr;
   return temp;
 }
-inline ::location::nearby::connections::DisconnectionFrame* V1Frame::_internal_mutable_disconnection() {
-  _has_bits_[0] |= 0x00000020u;
-  if (disconnection_ == nullptr) {
-    auto* p = CreateMaybeMessage<::location::nearby::connections::DisconnectionFrame>(GetArenaForAllocation());
-    disconnection_ = p;
+inline ::location::nearby::connections::BandwidthUpgradeRetryFrame* V1Frame::_internal_mutable_bandwidth_upgrade_retry() {
+  _has_bits_[0] |= 0x00000800u;
+  if (bandwidth_upgrade_retry_ == nullptr) {
+    auto* p = CreateMaybeMessage<::location::nearby::connections::BandwidthUpgradeRetryFrame>(GetArenaForAllocation());
+    bandwidth_upgrade_retry_ = p;
   }
-  return disconnection_;
+  return bandwidth_upgrade_retry_;
 }
-inline ::location::nearby::connections::DisconnectionFrame* V1Frame::mutable_disconnection() {
-  ::location::nearby::connections::DisconnectionFrame* _msg = _internal_mutable_disconnection();
-  // @@protoc_insertion_point(field_mutable:location.nearby.connections.V1Frame.disconnection)
+inline ::location::nearby::connections::BandwidthUpgradeRetryFrame* V1Frame::mutable_bandwidth_upgrade_retry() {
+  ::location::nearby::connections::BandwidthUpgradeRetryFrame* _msg = _internal_mutable_bandwidth_upgrade_retry();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.V1Frame.bandwidth_upgrade_retry)
   return _msg;
 }
-inline void V1Frame::set_allocated_disconnection(::location::nearby::connections::DisconnectionFrame* disconnection) {
+inline void V1Frame::set_allocated_bandwidth_upgrade_retry(::location::nearby::connections::BandwidthUpgradeRetryFrame* bandwidth_upgrade_retry) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete disconnection_;
+    delete bandwidth_upgrade_retry_;
   }
-  if (disconnection) {
+  if (bandwidth_upgrade_retry) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::DisconnectionFrame>::GetOwningArena(disconnection);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::BandwidthUpgradeRetryFrame>::GetOwningArena(bandwidth_upgrade_retry);
     if (message_arena != submessage_arena) {
-      disconnection = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, disconnection, submessage_arena);
+      bandwidth_upgrade_retry = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, bandwidth_upgrade_retry, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000020u;
+    _has_bits_[0] |= 0x00000800u;
   } else {
-    _has_bits_[0] &= ~0x00000020u;
+    _has_bits_[0] &= ~0x00000800u;
   }
-  disconnection_ = disconnection;
-  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.V1Frame.disconnection)
+  bandwidth_upgrade_retry_ = bandwidth_upgrade_retry;
+  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.V1Frame.bandwidth_upgrade_retry)
 }
 
-// optional .location.nearby.connections.PairedKeyEncryptionFrame paired_key_encryption = 8;
-inline bool V1Frame::_internal_has_paired_key_encryption() const {
-  bool value = (_has_bits_[0] & 0x00000040u) != 0;
-  PROTOBUF_ASSUME(!value || paired_key_encryption_ != nullptr);
+// -------------------------------------------------------------------
+
+// ConnectionRequestFrame
+
+// optional string endpoint_id = 1;
+inline bool ConnectionRequestFrame::_internal_has_endpoint_id() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool V1Frame::has_paired_key_encryption() const {
-  return _internal_has_paired_key_encryption();
+inline bool ConnectionRequestFrame::has_endpoint_id() const {
+  return _internal_has_endpoint_id();
 }
-inline void V1Frame::clear_paired_key_encryption() {
-  if (paired_key_encryption_ != nullptr) paired_key_encryption_->Clear();
-  _has_bits_[0] &= ~0x00000040u;
+inline void ConnectionRequestFrame::clear_endpoint_id() {
+  endpoint_id_.ClearToEmpty();
+  _has_bits_[0] &= ~0x00000001u;
 }
-inline const ::location::nearby::connections::PairedKeyEncryptionFrame& V1Frame::_internal_paired_key_encryption() const {
-  const ::location::nearby::connections::PairedKeyEncryptionFrame* p = paired_key_encryption_;
-  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::PairedKeyEncryptionFrame&>(
-      ::location::nearby::connections::_PairedKeyEncryptionFrame_default_instance_);
+inline const std::string& ConnectionRequestFrame::endpoint_id() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.endpoint_id)
+  return _internal_endpoint_id();
 }
-inline const ::location::nearby::connections::PairedKeyEncryptionFrame& V1Frame::paired_key_encryption() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.V1Frame.paired_key_encryption)
-  return _internal_paired_key_encryption();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ConnectionRequestFrame::set_endpoint_id(ArgT0&& arg0, ArgT... args) {
+ _has_bits_[0] |= 0x00000001u;
+ endpoint_id_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:location.nearby.connections.ConnectionRequestFrame.endpoint_id)
 }
-inline void V1Frame::unsafe_arena_set_allocated_paired_key_encryption(
-    ::location::nearby::connections::PairedKeyEncryptionFrame* paired_key_encryption) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(paired_key_encryption_);
+inline std::string* ConnectionRequestFrame::mutable_endpoint_id() {
+  std::string* _s = _internal_mutable_endpoint_id();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.ConnectionRequestFrame.endpoint_id)
+  return _s;
+}
+inline const std::string& ConnectionRequestFrame::_internal_endpoint_id() const {
+  return endpoint_id_.Get();
+}
+inline void ConnectionRequestFrame::_internal_set_endpoint_id(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  endpoint_id_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+}
+inline std::string* ConnectionRequestFrame::_internal_mutable_endpoint_id() {
+  _has_bits_[0] |= 0x00000001u;
+  return endpoint_id_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+}
+inline std::string* ConnectionRequestFrame::release_endpoint_id() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.ConnectionRequestFrame.endpoint_id)
+  if (!_internal_has_endpoint_id()) {
+    return nullptr;
   }
-  paired_key_encryption_ = paired_key_encryption;
-  if (paired_key_encryption) {
-    _has_bits_[0] |= 0x00000040u;
-  } else {
-    _has_bits_[0] &= ~0x00000040u;
+  _has_bits_[0] &= ~0x00000001u;
+  auto* p = endpoint_id_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (endpoint_id_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
+    endpoint_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.V1Frame.paired_key_encryption)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline ::location::nearby::connections::PairedKeyEncryptionFrame* V1Frame::release_paired_key_encryption() {
-  _has_bits_[0] &= ~0x00000040u;
-  ::location::nearby::connections::PairedKeyEncryptionFrame* temp = paired_key_encryption_;
-  paired_key_encryption_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+inline void ConnectionRequestFrame::set_allocated_endpoint_id(std::string* endpoint_id) {
+  if (endpoint_id != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
   }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+  endpoint_id_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), endpoint_id,
+      GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (endpoint_id_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
+    endpoint_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.ConnectionRequestFrame.endpoint_id)
 }
-inline ::location::nearby::connections::PairedKeyEncryptionFrame* V1Frame::unsafe_arena_release_paired_key_encryption() {
-  // @@protoc_insertion_point(field_release:location.nearby.connections.V1Frame.paired_key_encryption)
-  _has_bits_[0] &= ~0x00000040u;
-  ::location::nearby::connections::PairedKeyEncryptionFrame* temp = paired_key_encryption_;
-  paired_key_encryption_ = nullptr;
-  return temp;
+
+// optional string endpoint_name = 2;
+inline bool ConnectionRequestFrame::_internal_has_endpoint_name() const {
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline ::location::nearby::connections::PairedKeyEncryptionFrame* V1Frame::_internal_mutable_paired_key_encryption() {
-  _has_bits_[0] |= 0x00000040u;
-  if (paired_key_encryption_ == nullptr) {
-    auto* p = CreateMaybeMessage<::location::nearby::connections::PairedKeyEncryptionFrame>(GetArenaForAllocation());
-    paired_key_encryption_ = p;
-  }
-  return paired_key_encryption_;
+inline bool ConnectionRequestFrame::has_endpoint_name() const {
+  return _internal_has_endpoint_name();
 }
-inline ::location::nearby::connections::PairedKeyEncryptionFrame* V1Frame::mutable_paired_key_encryption() {
-  ::location::nearby::connections::PairedKeyEncryptionFrame* _msg = _internal_mutable_paired_key_encryption();
-  // @@protoc_insertion_point(field_mutable:location.nearby.connections.V1Frame.paired_key_encryption)
-  return _msg;
+inline void ConnectionRequestFrame::clear_endpoint_name() {
+  endpoint_name_.ClearToEmpty();
+  _has_bits_[0] &= ~0x00000002u;
 }
-inline void V1Frame::set_allocated_paired_key_encryption(::location::nearby::connections::PairedKeyEncryptionFrame* paired_key_encryption) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete paired_key_encryption_;
+inline const std::string& ConnectionRequestFrame::endpoint_name() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.endpoint_name)
+  return _internal_endpoint_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ConnectionRequestFrame::set_endpoint_name(ArgT0&& arg0, ArgT... args) {
+ _has_bits_[0] |= 0x00000002u;
+ endpoint_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:location.nearby.connections.ConnectionRequestFrame.endpoint_name)
+}
+inline std::string* ConnectionRequestFrame::mutable_endpoint_name() {
+  std::string* _s = _internal_mutable_endpoint_name();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.ConnectionRequestFrame.endpoint_name)
+  return _s;
+}
+inline const std::string& ConnectionRequestFrame::_internal_endpoint_name() const {
+  return endpoint_name_.Get();
+}
+inline void ConnectionRequestFrame::_internal_set_endpoint_name(const std::string& value) {
+  _has_bits_[0] |= 0x00000002u;
+  endpoint_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+}
+inline std::string* ConnectionRequestFrame::_internal_mutable_endpoint_name() {
+  _has_bits_[0] |= 0x00000002u;
+  return endpoint_name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+}
+inline std::string* ConnectionRequestFrame::release_endpoint_name() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.ConnectionRequestFrame.endpoint_name)
+  if (!_internal_has_endpoint_name()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000002u;
+  auto* p = endpoint_name_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (endpoint_name_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
+    endpoint_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
   }
-  if (paired_key_encryption) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::PairedKeyEncryptionFrame>::GetOwningArena(paired_key_encryption);
-    if (message_arena != submessage_arena) {
-      paired_key_encryption = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, paired_key_encryption, submessage_arena);
-    }
-    _has_bits_[0] |= 0x00000040u;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ConnectionRequestFrame::set_allocated_endpoint_name(std::string* endpoint_name) {
+  if (endpoint_name != nullptr) {
+    _has_bits_[0] |= 0x00000002u;
   } else {
-    _has_bits_[0] &= ~0x00000040u;
+    _has_bits_[0] &= ~0x00000002u;
   }
-  paired_key_encryption_ = paired_key_encryption;
-  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.V1Frame.paired_key_encryption)
+  endpoint_name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), endpoint_name,
+      GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (endpoint_name_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
+    endpoint_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.ConnectionRequestFrame.endpoint_name)
 }
 
-// optional .location.nearby.connections.AuthenticationMessageFrame authentication_message = 9;
-inline bool V1Frame::_internal_has_authentication_message() const {
-  bool value = (_has_bits_[0] & 0x00000080u) != 0;
-  PROTOBUF_ASSUME(!value || authentication_message_ != nullptr);
+// optional bytes handshake_data = 3;
+inline bool ConnectionRequestFrame::_internal_has_handshake_data() const {
+  bool value = (_has_bits_[0] & 0x00000004u) != 0;
   return value;
 }
-inline bool V1Frame::has_authentication_message() const {
-  return _internal_has_authentication_message();
-}
-inline void V1Frame::clear_authentication_message() {
-  if (authentication_message_ != nullptr) authentication_message_->Clear();
-  _has_bits_[0] &= ~0x00000080u;
+inline bool ConnectionRequestFrame::has_handshake_data() const {
+  return _internal_has_handshake_data();
 }
-inline const ::location::nearby::connections::AuthenticationMessageFrame& V1Frame::_internal_authentication_message() const {
-  const ::location::nearby::connections::AuthenticationMessageFrame* p = authentication_message_;
-  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::AuthenticationMessageFrame&>(
-      ::location::nearby::connections::_AuthenticationMessageFrame_default_instance_);
+inline void ConnectionRequestFrame::clear_handshake_data() {
+  handshake_data_.ClearToEmpty();
+  _has_bits_[0] &= ~0x00000004u;
 }
-inline const ::location::nearby::connections::AuthenticationMessageFrame& V1Frame::authentication_message() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.V1Frame.authentication_message)
-  return _internal_authentication_message();
+inline const std::string& ConnectionRequestFrame::handshake_data() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.handshake_data)
+  return _internal_handshake_data();
 }
-inline void V1Frame::unsafe_arena_set_allocated_authentication_message(
-    ::location::nearby::connections::AuthenticationMessageFrame* authentication_message) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(authentication_message_);
-  }
-  authentication_message_ = authentication_message;
-  if (authentication_message) {
-    _has_bits_[0] |= 0x00000080u;
-  } else {
-    _has_bits_[0] &= ~0x00000080u;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.V1Frame.authentication_message)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ConnectionRequestFrame::set_handshake_data(ArgT0&& arg0, ArgT... args) {
+ _has_bits_[0] |= 0x00000004u;
+ handshake_data_.SetBytes(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:location.nearby.connections.ConnectionRequestFrame.handshake_data)
 }
-inline ::location::nearby::connections::AuthenticationMessageFrame* V1Frame::release_authentication_message() {
-  _has_bits_[0] &= ~0x00000080u;
-  ::location::nearby::connections::AuthenticationMessageFrame* temp = authentication_message_;
-  authentication_message_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline std::string* ConnectionRequestFrame::mutable_handshake_data() {
+  std::string* _s = _internal_mutable_handshake_data();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.ConnectionRequestFrame.handshake_data)
+  return _s;
 }
-inline ::location::nearby::connections::AuthenticationMessageFrame* V1Frame::unsafe_arena_release_authentication_message() {
-  // @@protoc_insertion_point(field_release:location.nearby.connections.V1Frame.authentication_message)
-  _has_bits_[0] &= ~0x00000080u;
-  ::location::nearby::connections::AuthenticationMessageFrame* temp = authentication_message_;
-  authentication_message_ = nullptr;
-  return temp;
+inline const std::string& ConnectionRequestFrame::_internal_handshake_data() const {
+  return handshake_data_.Get();
 }
-inline ::location::nearby::connections::AuthenticationMessageFrame* V1Frame::_internal_mutable_authentication_message() {
-  _has_bits_[0] |= 0x00000080u;
-  if (authentication_message_ == nullptr) {
-    auto* p = CreateMaybeMessage<::location::nearby::connections::AuthenticationMessageFrame>(GetArenaForAllocation());
-    authentication_message_ = p;
-  }
-  return authentication_message_;
+inline void ConnectionRequestFrame::_internal_set_handshake_data(const std::string& value) {
+  _has_bits_[0] |= 0x00000004u;
+  handshake_data_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
 }
-inline ::location::nearby::connections::AuthenticationMessageFrame* V1Frame::mutable_authentication_message() {
-  ::location::nearby::connections::AuthenticationMessageFrame* _msg = _internal_mutable_authentication_message();
-  // @@protoc_insertion_point(field_mutable:location.nearby.connections.V1Frame.authentication_message)
-  return _msg;
+inline std::string* ConnectionRequestFrame::_internal_mutable_handshake_data() {
+  _has_bits_[0] |= 0x00000004u;
+  return handshake_data_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
 }
-inline void V1Frame::set_allocated_authentication_message(::location::nearby::connections::AuthenticationMessageFrame* authentication_message) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete authentication_message_;
+inline std::string* ConnectionRequestFrame::release_handshake_data() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.ConnectionRequestFrame.handshake_data)
+  if (!_internal_has_handshake_data()) {
+    return nullptr;
   }
-  if (authentication_message) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::AuthenticationMessageFrame>::GetOwningArena(authentication_message);
-    if (message_arena != submessage_arena) {
-      authentication_message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, authentication_message, submessage_arena);
-    }
-    _has_bits_[0] |= 0x00000080u;
+  _has_bits_[0] &= ~0x00000004u;
+  auto* p = handshake_data_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (handshake_data_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
+    handshake_data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ConnectionRequestFrame::set_allocated_handshake_data(std::string* handshake_data) {
+  if (handshake_data != nullptr) {
+    _has_bits_[0] |= 0x00000004u;
   } else {
-    _has_bits_[0] &= ~0x00000080u;
+    _has_bits_[0] &= ~0x00000004u;
   }
-  authentication_message_ = authentication_message;
-  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.V1Frame.authentication_message)
+  handshake_data_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), handshake_data,
+      GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (handshake_data_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
+    handshake_data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.ConnectionRequestFrame.handshake_data)
 }
 
-// optional .location.nearby.connections.AuthenticationResultFrame authentication_result = 10;
-inline bool V1Frame::_internal_has_authentication_result() const {
+// optional int32 nonce = 4;
+inline bool ConnectionRequestFrame::_internal_has_nonce() const {
   bool value = (_has_bits_[0] & 0x00000100u) != 0;
-  PROTOBUF_ASSUME(!value || authentication_result_ != nullptr);
   return value;
 }
-inline bool V1Frame::has_authentication_result() const {
-  return _internal_has_authentication_result();
+inline bool ConnectionRequestFrame::has_nonce() const {
+  return _internal_has_nonce();
 }
-inline void V1Frame::clear_authentication_result() {
-  if (authentication_result_ != nullptr) authentication_result_->Clear();
+inline void ConnectionRequestFrame::clear_nonce() {
+  nonce_ = 0;
   _has_bits_[0] &= ~0x00000100u;
 }
-inline const ::location::nearby::connections::AuthenticationResultFrame& V1Frame::_internal_authentication_result() const {
-  const ::location::nearby::connections::AuthenticationResultFrame* p = authentication_result_;
-  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::AuthenticationResultFrame&>(
-      ::location::nearby::connections::_AuthenticationResultFrame_default_instance_);
-}
-inline const ::location::nearby::connections::AuthenticationResultFrame& V1Frame::authentication_result() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.V1Frame.authentication_result)
-  return _internal_authentication_result();
-}
-inline void V1Frame::unsafe_arena_set_allocated_authentication_result(
-    ::location::nearby::connections::AuthenticationResultFrame* authentication_result) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(authentication_result_);
-  }
-  authentication_result_ = authentication_result;
-  if (authentication_result) {
-    _has_bits_[0] |= 0x00000100u;
-  } else {
-    _has_bits_[0] &= ~0x00000100u;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.V1Frame.authentication_result)
-}
-inline ::location::nearby::connections::AuthenticationResultFrame* V1Frame::release_authentication_result() {
-  _has_bits_[0] &= ~0x00000100u;
-  ::location::nearby::connections::AuthenticationResultFrame* temp = authentication_result_;
-  authentication_result_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline int32_t ConnectionRequestFrame::_internal_nonce() const {
+  return nonce_;
 }
-inline ::location::nearby::connections::AuthenticationResultFrame* V1Frame::unsafe_arena_release_authentication_result() {
-  // @@protoc_insertion_point(field_release:location.nearby.connections.V1Frame.authentication_result)
-  _has_bits_[0] &= ~0x00000100u;
-  ::location::nearby::connections::AuthenticationResultFrame* temp = authentication_result_;
-  authentication_result_ = nullptr;
-  return temp;
+inline int32_t ConnectionRequestFrame::nonce() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.nonce)
+  return _internal_nonce();
 }
-inline ::location::nearby::connections::AuthenticationResultFrame* V1Frame::_internal_mutable_authentication_result() {
+inline void ConnectionRequestFrame::_internal_set_nonce(int32_t value) {
   _has_bits_[0] |= 0x00000100u;
-  if (authentication_result_ == nullptr) {
-    auto* p = CreateMaybeMessage<::location::nearby::connections::AuthenticationResultFrame>(GetArenaForAllocation());
-    authentication_result_ = p;
-  }
-  return authentication_result_;
-}
-inline ::location::nearby::connections::AuthenticationResultFrame* V1Frame::mutable_authentication_result() {
-  ::location::nearby::connections::AuthenticationResultFrame* _msg = _internal_mutable_authentication_result();
-  // @@protoc_insertion_point(field_mutable:location.nearby.connections.V1Frame.authentication_result)
-  return _msg;
-}
-inline void V1Frame::set_allocated_authentication_result(::location::nearby::connections::AuthenticationResultFrame* authentication_result) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete authentication_result_;
-  }
-  if (authentication_result) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::AuthenticationResultFrame>::GetOwningArena(authentication_result);
-    if (message_arena != submessage_arena) {
-      authentication_result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, authentication_result, submessage_arena);
-    }
-    _has_bits_[0] |= 0x00000100u;
-  } else {
-    _has_bits_[0] &= ~0x00000100u;
-  }
-  authentication_result_ = authentication_result;
-  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.V1Frame.authentication_result)
+  nonce_ = value;
 }
-
-// optional .location.nearby.connections.AutoResumeFrame auto_resume = 11;
-inline bool V1Frame::_internal_has_auto_resume() const {
-  bool value = (_has_bits_[0] & 0x00000200u) != 0;
-  PROTOBUF_ASSUME(!value || auto_resume_ != nullptr);
-  return value;
+inline void ConnectionRequestFrame::set_nonce(int32_t value) {
+  _internal_set_nonce(value);
+  // @@protoc_insertion_point(field_set:location.nearby.connections.ConnectionRequestFrame.nonce)
 }
-inline bool V1Frame::has_auto_resume() const {
-  return _internal_has_auto_resume();
+
+// repeated .location.nearby.connections.ConnectionRequestFrame.Medium mediums = 5;
+inline int ConnectionRequestFrame::_internal_mediums_size() const {
+  return mediums_.size();
 }
-inline void V1Frame::clear_auto_resume() {
-  if (auto_resume_ != nullptr) auto_resume_->Clear();
-  _has_bits_[0] &= ~0x00000200u;
+inline int ConnectionRequestFrame::mediums_size() const {
+  return _internal_mediums_size();
 }
-inline const ::location::nearby::connections::AutoResumeFrame& V1Frame::_internal_auto_resume() const {
-  const ::location::nearby::connections::AutoResumeFrame* p = auto_resume_;
-  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::AutoResumeFrame&>(
-      ::location::nearby::connections::_AutoResumeFrame_default_instance_);
+inline void ConnectionRequestFrame::clear_mediums() {
+  mediums_.Clear();
 }
-inline const ::location::nearby::connections::AutoResumeFrame& V1Frame::auto_resume() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.V1Frame.auto_resume)
-  return _internal_auto_resume();
+inline ::location::nearby::connections::ConnectionRequestFrame_Medium ConnectionRequestFrame::_internal_mediums(int index) const {
+  return static_cast< ::location::nearby::connections::ConnectionRequestFrame_Medium >(mediums_.Get(index));
 }
-inline void V1Frame::unsafe_arena_set_allocated_auto_resume(
-    ::location::nearby::connections::AutoResumeFrame* auto_resume) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(auto_resume_);
-  }
-  auto_resume_ = auto_resume;
-  if (auto_resume) {
-    _has_bits_[0] |= 0x00000200u;
-  } else {
-    _has_bits_[0] &= ~0x00000200u;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.V1Frame.auto_resume)
+inline ::location::nearby::connections::ConnectionRequestFrame_Medium ConnectionRequestFrame::mediums(int index) const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.mediums)
+  return _internal_mediums(index);
 }
-inline ::location::nearby::connections::AutoResumeFrame* V1Frame::release_auto_resume() {
-  _has_bits_[0] &= ~0x00000200u;
-  ::location::nearby::connections::AutoResumeFrame* temp = auto_resume_;
-  auto_resume_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline void ConnectionRequestFrame::set_mediums(int index, ::location::nearby::connections::ConnectionRequestFrame_Medium value) {
+  assert(::location::nearby::connections::ConnectionRequestFrame_Medium_IsValid(value));
+  mediums_.Set(index, value);
+  // @@protoc_insertion_point(field_set:location.nearby.connections.ConnectionRequestFrame.mediums)
 }
-inline ::location::nearby::connections::AutoResumeFrame* V1Frame::unsafe_arena_release_auto_resume() {
-  // @@protoc_insertion_point(field_release:location.nearby.connections.V1Frame.auto_resume)
-  _has_bits_[0] &= ~0x00000200u;
-  ::location::nearby::connections::AutoResumeFrame* temp = auto_resume_;
-  auto_resume_ = nullptr;
-  return temp;
+inline void ConnectionRequestFrame::_internal_add_mediums(::location::nearby::connections::ConnectionRequestFrame_Medium value) {
+  assert(::location::nearby::connections::ConnectionRequestFrame_Medium_IsValid(value));
+  mediums_.Add(value);
 }
-inline ::location::nearby::connections::AutoResumeFrame* V1Frame::_internal_mutable_auto_resume() {
-  _has_bits_[0] |= 0x00000200u;
-  if (auto_resume_ == nullptr) {
-    auto* p = CreateMaybeMessage<::location::nearby::connections::AutoResumeFrame>(GetArenaForAllocation());
-    auto_resume_ = p;
-  }
-  return auto_resume_;
+inline void ConnectionRequestFrame::add_mediums(::location::nearby::connections::ConnectionRequestFrame_Medium value) {
+  _internal_add_mediums(value);
+  // @@protoc_insertion_point(field_add:location.nearby.connections.ConnectionRequestFrame.mediums)
 }
-inline ::location::nearby::connections::AutoResumeFrame* V1Frame::mutable_auto_resume() {
-  ::location::nearby::connections::AutoResumeFrame* _msg = _internal_mutable_auto_resume();
-  // @@protoc_insertion_point(field_mutable:location.nearby.connections.V1Frame.auto_resume)
-  return _msg;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>&
+ConnectionRequestFrame::mediums() const {
+  // @@protoc_insertion_point(field_list:location.nearby.connections.ConnectionRequestFrame.mediums)
+  return mediums_;
 }
-inline void V1Frame::set_allocated_auto_resume(::location::nearby::connections::AutoResumeFrame* auto_resume) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete auto_resume_;
-  }
-  if (auto_resume) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::AutoResumeFrame>::GetOwningArena(auto_resume);
-    if (message_arena != submessage_arena) {
-      auto_resume = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, auto_resume, submessage_arena);
-    }
-    _has_bits_[0] |= 0x00000200u;
-  } else {
-    _has_bits_[0] &= ~0x00000200u;
-  }
-  auto_resume_ = auto_resume;
-  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.V1Frame.auto_resume)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+ConnectionRequestFrame::_internal_mutable_mediums() {
+  return &mediums_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+ConnectionRequestFrame::mutable_mediums() {
+  // @@protoc_insertion_point(field_mutable_list:location.nearby.connections.ConnectionRequestFrame.mediums)
+  return _internal_mutable_mediums();
 }
 
-// optional .location.nearby.connections.AutoReconnectFrame auto_reconnect = 12;
-inline bool V1Frame::_internal_has_auto_reconnect() const {
-  bool value = (_has_bits_[0] & 0x00000400u) != 0;
-  PROTOBUF_ASSUME(!value || auto_reconnect_ != nullptr);
+// optional bytes endpoint_info = 6;
+inline bool ConnectionRequestFrame::_internal_has_endpoint_info() const {
+  bool value = (_has_bits_[0] & 0x00000008u) != 0;
   return value;
 }
-inline bool V1Frame::has_auto_reconnect() const {
-  return _internal_has_auto_reconnect();
-}
-inline void V1Frame::clear_auto_reconnect() {
-  if (auto_reconnect_ != nullptr) auto_reconnect_->Clear();
-  _has_bits_[0] &= ~0x00000400u;
+inline bool ConnectionRequestFrame::has_endpoint_info() const {
+  return _internal_has_endpoint_info();
 }
-inline const ::location::nearby::connections::AutoReconnectFrame& V1Frame::_internal_auto_reconnect() const {
-  const ::location::nearby::connections::AutoReconnectFrame* p = auto_reconnect_;
-  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::AutoReconnectFrame&>(
-      ::location::nearby::connections::_AutoReconnectFrame_default_instance_);
+inline void ConnectionRequestFrame::clear_endpoint_info() {
+  endpoint_info_.ClearToEmpty();
+  _has_bits_[0] &= ~0x00000008u;
 }
-inline const ::location::nearby::connections::AutoReconnectFrame& V1Frame::auto_reconnect() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.V1Frame.auto_reconnect)
-  return _internal_auto_reconnect();
+inline const std::string& ConnectionRequestFrame::endpoint_info() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.endpoint_info)
+  return _internal_endpoint_info();
 }
-inline void V1Frame::unsafe_arena_set_allocated_auto_reconnect(
-    ::location::nearby::connections::AutoReconnectFrame* auto_reconnect) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(auto_reconnect_);
-  }
-  auto_reconnect_ = auto_reconnect;
-  if (auto_reconnect) {
-    _has_bits_[0] |= 0x00000400u;
-  } else {
-    _has_bits_[0] &= ~0x00000400u;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.V1Frame.auto_reconnect)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ConnectionRequestFrame::set_endpoint_info(ArgT0&& arg0, ArgT... args) {
+ _has_bits_[0] |= 0x00000008u;
+ endpoint_info_.SetBytes(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:location.nearby.connections.ConnectionRequestFrame.endpoint_info)
 }
-inline ::location::nearby::connections::AutoReconnectFrame* V1Frame::release_auto_reconnect() {
-  _has_bits_[0] &= ~0x00000400u;
-  ::location::nearby::connections::AutoReconnectFrame* temp = auto_reconnect_;
-  auto_reconnect_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline std::string* ConnectionRequestFrame::mutable_endpoint_info() {
+  std::string* _s = _internal_mutable_endpoint_info();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.ConnectionRequestFrame.endpoint_info)
+  return _s;
 }
-inline ::location::nearby::connections::AutoReconnectFrame* V1Frame::unsafe_arena_release_auto_reconnect() {
-  // @@protoc_insertion_point(field_release:location.nearby.connections.V1Frame.auto_reconnect)
-  _has_bits_[0] &= ~0x00000400u;
-  ::location::nearby::connections::AutoReconnectFrame* temp = auto_reconnect_;
-  auto_reconnect_ = nullptr;
-  return temp;
+inline const std::string& ConnectionRequestFrame::_internal_endpoint_info() const {
+  return endpoint_info_.Get();
 }
-inline ::location::nearby::connections::AutoReconnectFrame* V1Frame::_internal_mutable_auto_reconnect() {
-  _has_bits_[0] |= 0x00000400u;
-  if (auto_reconnect_ == nullptr) {
-    auto* p = CreateMaybeMessage<::location::nearby::connections::AutoReconnectFrame>(GetArenaForAllocation());
-    auto_reconnect_ = p;
-  }
-  return auto_reconnect_;
+inline void ConnectionRequestFrame::_internal_set_endpoint_info(const std::string& value) {
+  _has_bits_[0] |= 0x00000008u;
+  endpoint_info_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
 }
-inline ::location::nearby::connections::AutoReconnectFrame* V1Frame::mutable_auto_reconnect() {
-  ::location::nearby::connections::AutoReconnectFrame* _msg = _internal_mutable_auto_reconnect();
-  // @@protoc_insertion_point(field_mutable:location.nearby.connections.V1Frame.auto_reconnect)
-  return _msg;
+inline std::string* ConnectionRequestFrame::_internal_mutable_endpoint_info() {
+  _has_bits_[0] |= 0x00000008u;
+  return endpoint_info_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
 }
-inline void V1Frame::set_allocated_auto_reconnect(::location::nearby::connections::AutoReconnectFrame* auto_reconnect) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete auto_reconnect_;
+inline std::string* ConnectionRequestFrame::release_endpoint_info() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.ConnectionRequestFrame.endpoint_info)
+  if (!_internal_has_endpoint_info()) {
+    return nullptr;
   }
-  if (auto_reconnect) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::AutoReconnectFrame>::GetOwningArena(auto_reconnect);
-    if (message_arena != submessage_arena) {
-      auto_reconnect = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, auto_reconnect, submessage_arena);
-    }
-    _has_bits_[0] |= 0x00000400u;
+  _has_bits_[0] &= ~0x00000008u;
+  auto* p = endpoint_info_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (endpoint_info_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
+    endpoint_info_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ConnectionRequestFrame::set_allocated_endpoint_info(std::string* endpoint_info) {
+  if (endpoint_info != nullptr) {
+    _has_bits_[0] |= 0x00000008u;
   } else {
-    _has_bits_[0] &= ~0x00000400u;
+    _has_bits_[0] &= ~0x00000008u;
   }
-  auto_reconnect_ = auto_reconnect;
-  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.V1Frame.auto_reconnect)
+  endpoint_info_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), endpoint_info,
+      GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (endpoint_info_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
+    endpoint_info_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.ConnectionRequestFrame.endpoint_info)
 }
 
-// optional .location.nearby.connections.BandwidthUpgradeRetryFrame bandwidth_upgrade_retry = 13;
-inline bool V1Frame::_internal_has_bandwidth_upgrade_retry() const {
-  bool value = (_has_bits_[0] & 0x00000800u) != 0;
-  PROTOBUF_ASSUME(!value || bandwidth_upgrade_retry_ != nullptr);
+// optional .location.nearby.connections.MediumMetadata medium_metadata = 7;
+inline bool ConnectionRequestFrame::_internal_has_medium_metadata() const {
+  bool value = (_has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || medium_metadata_ != nullptr);
   return value;
 }
-inline bool V1Frame::has_bandwidth_upgrade_retry() const {
-  return _internal_has_bandwidth_upgrade_retry();
+inline bool ConnectionRequestFrame::has_medium_metadata() const {
+  return _internal_has_medium_metadata();
 }
-inline void V1Frame::clear_bandwidth_upgrade_retry() {
-  if (bandwidth_upgrade_retry_ != nullptr) bandwidth_upgrade_retry_->Clear();
-  _has_bits_[0] &= ~0x00000800u;
+inline void ConnectionRequestFrame::clear_medium_metadata() {
+  if (medium_metadata_ != nullptr) medium_metadata_->Clear();
+  _has_bits_[0] &= ~0x00000020u;
 }
-inline const ::location::nearby::connections::BandwidthUpgradeRetryFrame& V1Frame::_internal_bandwidth_upgrade_retry() const {
-  const ::location::nearby::connections::BandwidthUpgradeRetryFrame* p = bandwidth_upgrade_retry_;
-  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::BandwidthUpgradeRetryFrame&>(
-      ::location::nearby::connections::_BandwidthUpgradeRetryFrame_default_instance_);
+inline const ::location::nearby::connections::MediumMetadata& ConnectionRequestFrame::_internal_medium_metadata() const {
+  const ::location::nearby::connections::MediumMetadata* p = medium_metadata_;
+  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::MediumMetadata&>(
+      ::location::nearby::connections::_MediumMetadata_default_instance_);
 }
-inline const ::location::nearby::connections::BandwidthUpgradeRetryFrame& V1Frame::bandwidth_upgrade_retry() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.V1Frame.bandwidth_upgrade_retry)
-  return _internal_bandwidth_upgrade_retry();
+inline const ::location::nearby::connections::MediumMetadata& ConnectionRequestFrame::medium_metadata() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.medium_metadata)
+  return _internal_medium_metadata();
 }
-inline void V1Frame::unsafe_arena_set_allocated_bandwidth_upgrade_retry(
-    ::location::nearby::connections::BandwidthUpgradeRetryFrame* bandwidth_upgrade_retry) {
+inline void ConnectionRequestFrame::unsafe_arena_set_allocated_medium_metadata(
+    ::location::nearby::connections::MediumMetadata* medium_metadata) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(bandwidth_upgrade_retry_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(medium_metadata_);
   }
-  bandwidth_upgrade_retry_ = bandwidth_upgrade_retry;
-  if (bandwidth_upgrade_retry) {
-    _has_bits_[0] |= 0x00000800u;
+  medium_metadata_ = medium_metadata;
+  if (medium_metadata) {
+    _has_bits_[0] |= 0x00000020u;
   } else {
-    _has_bits_[0] &= ~0x00000800u;
+    _has_bits_[0] &= ~0x00000020u;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.V1Frame.bandwidth_upgrade_retry)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.ConnectionRequestFrame.medium_metadata)
 }
-inline ::location::nearby::connections::BandwidthUpgradeRetryFrame* V1Frame::release_bandwidth_upgrade_retry() {
-  _has_bits_[0] &= ~0x00000800u;
-  ::location::nearby::connections::BandwidthUpgradeRetryFrame* temp = bandwidth_upgrade_retry_;
-  bandwidth_upgrade_retry_ = nullptr;
+inline ::location::nearby::connections::MediumMetadata* ConnectionRequestFrame::release_medium_metadata() {
+  _has_bits_[0] &= ~0x00000020u;
+  ::location::nearby::connections::MediumMetadata* temp = medium_metadata_;
+  medium_metadata_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -9738,438 +10747,415 @@ inline ::location::nearby::connections::BandwidthUpgradeRetryFrame* V1Frame::rel
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::location::nearby::connections::BandwidthUpgradeRetryFrame* V1Frame::unsafe_arena_release_bandwidth_upgrade_retry() {
-  // @@protoc_insertion_point(field_release:location.nearby.connections.V1Frame.bandwidth_upgrade_retry)
-  _has_bits_[0] &= ~0x00000800u;
-  ::location::nearby::connections::BandwidthUpgradeRetryFrame* temp = bandwidth_upgrade_retry_;
-  bandwidth_upgrade_retry_ = nullptr;
+inline ::location::nearby::connections::MediumMetadata* ConnectionRequestFrame::unsafe_arena_release_medium_metadata() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.ConnectionRequestFrame.medium_metadata)
+  _has_bits_[0] &= ~0x00000020u;
+  ::location::nearby::connections::MediumMetadata* temp = medium_metadata_;
+  medium_metadata_ = nullptr;
   return temp;
 }
-inline ::location::nearby::connections::BandwidthUpgradeRetryFrame* V1Frame::_internal_mutable_bandwidth_upgrade_retry() {
-  _has_bits_[0] |= 0x00000800u;
-  if (bandwidth_upgrade_retry_ == nullptr) {
-    auto* p = CreateMaybeMessage<::location::nearby::connections::BandwidthUpgradeRetryFrame>(GetArenaForAllocation());
-    bandwidth_upgrade_retry_ = p;
+inline ::location::nearby::connections::MediumMetadata* ConnectionRequestFrame::_internal_mutable_medium_metadata() {
+  _has_bits_[0] |= 0x00000020u;
+  if (medium_metadata_ == nullptr) {
+    auto* p = CreateMaybeMessage<::location::nearby::connections::MediumMetadata>(GetArenaForAllocation());
+    medium_metadata_ = p;
   }
-  return bandwidth_upgrade_retry_;
+  return medium_metadata_;
 }
-inline ::location::nearby::connections::BandwidthUpgradeRetryFrame* V1Frame::mutable_bandwidth_upgrade_retry() {
-  ::location::nearby::connections::BandwidthUpgradeRetryFrame* _msg = _internal_mutable_bandwidth_upgrade_retry();
-  // @@protoc_insertion_point(field_mutable:location.nearby.connections.V1Frame.bandwidth_upgrade_retry)
+inline ::location::nearby::connections::MediumMetadata* ConnectionRequestFrame::mutable_medium_metadata() {
+  ::location::nearby::connections::MediumMetadata* _msg = _internal_mutable_medium_metadata();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.ConnectionRequestFrame.medium_metadata)
   return _msg;
 }
-inline void V1Frame::set_allocated_bandwidth_upgrade_retry(::location::nearby::connections::BandwidthUpgradeRetryFrame* bandwidth_upgrade_retry) {
+inline void ConnectionRequestFrame::set_allocated_medium_metadata(::location::nearby::connections::MediumMetadata* medium_metadata) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete bandwidth_upgrade_retry_;
+    delete medium_metadata_;
   }
-  if (bandwidth_upgrade_retry) {
+  if (medium_metadata) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::BandwidthUpgradeRetryFrame>::GetOwningArena(bandwidth_upgrade_retry);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::MediumMetadata>::GetOwningArena(medium_metadata);
     if (message_arena != submessage_arena) {
-      bandwidth_upgrade_retry = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, bandwidth_upgrade_retry, submessage_arena);
+      medium_metadata = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, medium_metadata, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000800u;
+    _has_bits_[0] |= 0x00000020u;
   } else {
-    _has_bits_[0] &= ~0x00000800u;
+    _has_bits_[0] &= ~0x00000020u;
   }
-  bandwidth_upgrade_retry_ = bandwidth_upgrade_retry;
-  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.V1Frame.bandwidth_upgrade_retry)
+  medium_metadata_ = medium_metadata;
+  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.ConnectionRequestFrame.medium_metadata)
 }
 
-// -------------------------------------------------------------------
-
-// ConnectionRequestFrame
-
-// optional string endpoint_id = 1;
-inline bool ConnectionRequestFrame::_internal_has_endpoint_id() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+// optional int32 keep_alive_interval_millis = 8;
+inline bool ConnectionRequestFrame::_internal_has_keep_alive_interval_millis() const {
+  bool value = (_has_bits_[0] & 0x00000200u) != 0;
   return value;
 }
-inline bool ConnectionRequestFrame::has_endpoint_id() const {
-  return _internal_has_endpoint_id();
-}
-inline void ConnectionRequestFrame::clear_endpoint_id() {
-  endpoint_id_.ClearToEmpty();
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline const std::string& ConnectionRequestFrame::endpoint_id() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.endpoint_id)
-  return _internal_endpoint_id();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void ConnectionRequestFrame::set_endpoint_id(ArgT0&& arg0, ArgT... args) {
- _has_bits_[0] |= 0x00000001u;
- endpoint_id_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:location.nearby.connections.ConnectionRequestFrame.endpoint_id)
-}
-inline std::string* ConnectionRequestFrame::mutable_endpoint_id() {
-  std::string* _s = _internal_mutable_endpoint_id();
-  // @@protoc_insertion_point(field_mutable:location.nearby.connections.ConnectionRequestFrame.endpoint_id)
-  return _s;
+inline bool ConnectionRequestFrame::has_keep_alive_interval_millis() const {
+  return _internal_has_keep_alive_interval_millis();
 }
-inline const std::string& ConnectionRequestFrame::_internal_endpoint_id() const {
-  return endpoint_id_.Get();
+inline void ConnectionRequestFrame::clear_keep_alive_interval_millis() {
+  keep_alive_interval_millis_ = 0;
+  _has_bits_[0] &= ~0x00000200u;
 }
-inline void ConnectionRequestFrame::_internal_set_endpoint_id(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  endpoint_id_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+inline int32_t ConnectionRequestFrame::_internal_keep_alive_interval_millis() const {
+  return keep_alive_interval_millis_;
 }
-inline std::string* ConnectionRequestFrame::_internal_mutable_endpoint_id() {
-  _has_bits_[0] |= 0x00000001u;
-  return endpoint_id_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+inline int32_t ConnectionRequestFrame::keep_alive_interval_millis() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.keep_alive_interval_millis)
+  return _internal_keep_alive_interval_millis();
 }
-inline std::string* ConnectionRequestFrame::release_endpoint_id() {
-  // @@protoc_insertion_point(field_release:location.nearby.connections.ConnectionRequestFrame.endpoint_id)
-  if (!_internal_has_endpoint_id()) {
-    return nullptr;
-  }
-  _has_bits_[0] &= ~0x00000001u;
-  auto* p = endpoint_id_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (endpoint_id_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    endpoint_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  return p;
+inline void ConnectionRequestFrame::_internal_set_keep_alive_interval_millis(int32_t value) {
+  _has_bits_[0] |= 0x00000200u;
+  keep_alive_interval_millis_ = value;
 }
-inline void ConnectionRequestFrame::set_allocated_endpoint_id(std::string* endpoint_id) {
-  if (endpoint_id != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
-  } else {
-    _has_bits_[0] &= ~0x00000001u;
-  }
-  endpoint_id_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), endpoint_id,
-      GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (endpoint_id_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    endpoint_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.ConnectionRequestFrame.endpoint_id)
+inline void ConnectionRequestFrame::set_keep_alive_interval_millis(int32_t value) {
+  _internal_set_keep_alive_interval_millis(value);
+  // @@protoc_insertion_point(field_set:location.nearby.connections.ConnectionRequestFrame.keep_alive_interval_millis)
 }
 
-// optional string endpoint_name = 2;
-inline bool ConnectionRequestFrame::_internal_has_endpoint_name() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+// optional int32 keep_alive_timeout_millis = 9;
+inline bool ConnectionRequestFrame::_internal_has_keep_alive_timeout_millis() const {
+  bool value = (_has_bits_[0] & 0x00000400u) != 0;
   return value;
 }
-inline bool ConnectionRequestFrame::has_endpoint_name() const {
-  return _internal_has_endpoint_name();
-}
-inline void ConnectionRequestFrame::clear_endpoint_name() {
-  endpoint_name_.ClearToEmpty();
-  _has_bits_[0] &= ~0x00000002u;
+inline bool ConnectionRequestFrame::has_keep_alive_timeout_millis() const {
+  return _internal_has_keep_alive_timeout_millis();
 }
-inline const std::string& ConnectionRequestFrame::endpoint_name() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.endpoint_name)
-  return _internal_endpoint_name();
+inline void ConnectionRequestFrame::clear_keep_alive_timeout_millis() {
+  keep_alive_timeout_millis_ = 0;
+  _has_bits_[0] &= ~0x00000400u;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void ConnectionRequestFrame::set_endpoint_name(ArgT0&& arg0, ArgT... args) {
- _has_bits_[0] |= 0x00000002u;
- endpoint_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:location.nearby.connections.ConnectionRequestFrame.endpoint_name)
+inline int32_t ConnectionRequestFrame::_internal_keep_alive_timeout_millis() const {
+  return keep_alive_timeout_millis_;
 }
-inline std::string* ConnectionRequestFrame::mutable_endpoint_name() {
-  std::string* _s = _internal_mutable_endpoint_name();
-  // @@protoc_insertion_point(field_mutable:location.nearby.connections.ConnectionRequestFrame.endpoint_name)
-  return _s;
+inline int32_t ConnectionRequestFrame::keep_alive_timeout_millis() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.keep_alive_timeout_millis)
+  return _internal_keep_alive_timeout_millis();
 }
-inline const std::string& ConnectionRequestFrame::_internal_endpoint_name() const {
-  return endpoint_name_.Get();
+inline void ConnectionRequestFrame::_internal_set_keep_alive_timeout_millis(int32_t value) {
+  _has_bits_[0] |= 0x00000400u;
+  keep_alive_timeout_millis_ = value;
 }
-inline void ConnectionRequestFrame::_internal_set_endpoint_name(const std::string& value) {
-  _has_bits_[0] |= 0x00000002u;
-  endpoint_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+inline void ConnectionRequestFrame::set_keep_alive_timeout_millis(int32_t value) {
+  _internal_set_keep_alive_timeout_millis(value);
+  // @@protoc_insertion_point(field_set:location.nearby.connections.ConnectionRequestFrame.keep_alive_timeout_millis)
 }
-inline std::string* ConnectionRequestFrame::_internal_mutable_endpoint_name() {
-  _has_bits_[0] |= 0x00000002u;
-  return endpoint_name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+
+// optional int32 device_type = 10 [default = 0, deprecated = true];
+inline bool ConnectionRequestFrame::_internal_has_device_type() const {
+  bool value = (_has_bits_[0] & 0x00000800u) != 0;
+  return value;
 }
-inline std::string* ConnectionRequestFrame::release_endpoint_name() {
-  // @@protoc_insertion_point(field_release:location.nearby.connections.ConnectionRequestFrame.endpoint_name)
-  if (!_internal_has_endpoint_name()) {
-    return nullptr;
-  }
-  _has_bits_[0] &= ~0x00000002u;
-  auto* p = endpoint_name_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (endpoint_name_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    endpoint_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  return p;
+inline bool ConnectionRequestFrame::has_device_type() const {
+  return _internal_has_device_type();
 }
-inline void ConnectionRequestFrame::set_allocated_endpoint_name(std::string* endpoint_name) {
-  if (endpoint_name != nullptr) {
-    _has_bits_[0] |= 0x00000002u;
-  } else {
-    _has_bits_[0] &= ~0x00000002u;
-  }
-  endpoint_name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), endpoint_name,
-      GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (endpoint_name_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    endpoint_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.ConnectionRequestFrame.endpoint_name)
+inline void ConnectionRequestFrame::clear_device_type() {
+  device_type_ = 0;
+  _has_bits_[0] &= ~0x00000800u;
+}
+inline int32_t ConnectionRequestFrame::_internal_device_type() const {
+  return device_type_;
+}
+inline int32_t ConnectionRequestFrame::device_type() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.device_type)
+  return _internal_device_type();
+}
+inline void ConnectionRequestFrame::_internal_set_device_type(int32_t value) {
+  _has_bits_[0] |= 0x00000800u;
+  device_type_ = value;
+}
+inline void ConnectionRequestFrame::set_device_type(int32_t value) {
+  _internal_set_device_type(value);
+  // @@protoc_insertion_point(field_set:location.nearby.connections.ConnectionRequestFrame.device_type)
 }
 
-// optional bytes handshake_data = 3;
-inline bool ConnectionRequestFrame::_internal_has_handshake_data() const {
-  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+// optional bytes device_info = 11 [deprecated = true];
+inline bool ConnectionRequestFrame::_internal_has_device_info() const {
+  bool value = (_has_bits_[0] & 0x00000010u) != 0;
   return value;
 }
-inline bool ConnectionRequestFrame::has_handshake_data() const {
-  return _internal_has_handshake_data();
+inline bool ConnectionRequestFrame::has_device_info() const {
+  return _internal_has_device_info();
 }
-inline void ConnectionRequestFrame::clear_handshake_data() {
-  handshake_data_.ClearToEmpty();
-  _has_bits_[0] &= ~0x00000004u;
+inline void ConnectionRequestFrame::clear_device_info() {
+  device_info_.ClearToEmpty();
+  _has_bits_[0] &= ~0x00000010u;
 }
-inline const std::string& ConnectionRequestFrame::handshake_data() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.handshake_data)
-  return _internal_handshake_data();
+inline const std::string& ConnectionRequestFrame::device_info() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.device_info)
+  return _internal_device_info();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void ConnectionRequestFrame::set_handshake_data(ArgT0&& arg0, ArgT... args) {
- _has_bits_[0] |= 0x00000004u;
- handshake_data_.SetBytes(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:location.nearby.connections.ConnectionRequestFrame.handshake_data)
+void ConnectionRequestFrame::set_device_info(ArgT0&& arg0, ArgT... args) {
+ _has_bits_[0] |= 0x00000010u;
+ device_info_.SetBytes(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:location.nearby.connections.ConnectionRequestFrame.device_info)
 }
-inline std::string* ConnectionRequestFrame::mutable_handshake_data() {
-  std::string* _s = _internal_mutable_handshake_data();
-  // @@protoc_insertion_point(field_mutable:location.nearby.connections.ConnectionRequestFrame.handshake_data)
+inline std::string* ConnectionRequestFrame::mutable_device_info() {
+  std::string* _s = _internal_mutable_device_info();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.ConnectionRequestFrame.device_info)
   return _s;
 }
-inline const std::string& ConnectionRequestFrame::_internal_handshake_data() const {
-  return handshake_data_.Get();
+inline const std::string& ConnectionRequestFrame::_internal_device_info() const {
+  return device_info_.Get();
 }
-inline void ConnectionRequestFrame::_internal_set_handshake_data(const std::string& value) {
-  _has_bits_[0] |= 0x00000004u;
-  handshake_data_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+inline void ConnectionRequestFrame::_internal_set_device_info(const std::string& value) {
+  _has_bits_[0] |= 0x00000010u;
+  device_info_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
 }
-inline std::string* ConnectionRequestFrame::_internal_mutable_handshake_data() {
-  _has_bits_[0] |= 0x00000004u;
-  return handshake_data_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+inline std::string* ConnectionRequestFrame::_internal_mutable_device_info() {
+  _has_bits_[0] |= 0x00000010u;
+  return device_info_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
 }
-inline std::string* ConnectionRequestFrame::release_handshake_data() {
-  // @@protoc_insertion_point(field_release:location.nearby.connections.ConnectionRequestFrame.handshake_data)
-  if (!_internal_has_handshake_data()) {
+inline std::string* ConnectionRequestFrame::release_device_info() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.ConnectionRequestFrame.device_info)
+  if (!_internal_has_device_info()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000004u;
-  auto* p = handshake_data_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  _has_bits_[0] &= ~0x00000010u;
+  auto* p = device_info_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (handshake_data_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    handshake_data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (device_info_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
+    device_info_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void ConnectionRequestFrame::set_allocated_handshake_data(std::string* handshake_data) {
-  if (handshake_data != nullptr) {
-    _has_bits_[0] |= 0x00000004u;
+inline void ConnectionRequestFrame::set_allocated_device_info(std::string* device_info) {
+  if (device_info != nullptr) {
+    _has_bits_[0] |= 0x00000010u;
   } else {
-    _has_bits_[0] &= ~0x00000004u;
+    _has_bits_[0] &= ~0x00000010u;
   }
-  handshake_data_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), handshake_data,
+  device_info_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), device_info,
       GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (handshake_data_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    handshake_data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (device_info_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
+    device_info_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.ConnectionRequestFrame.handshake_data)
+  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.ConnectionRequestFrame.device_info)
 }
 
-// optional int32 nonce = 4;
-inline bool ConnectionRequestFrame::_internal_has_nonce() const {
-  bool value = (_has_bits_[0] & 0x00000040u) != 0;
-  return value;
+// .location.nearby.connections.ConnectionsDevice connections_device = 12;
+inline bool ConnectionRequestFrame::_internal_has_connections_device() const {
+  return Device_case() == kConnectionsDevice;
 }
-inline bool ConnectionRequestFrame::has_nonce() const {
-  return _internal_has_nonce();
+inline bool ConnectionRequestFrame::has_connections_device() const {
+  return _internal_has_connections_device();
 }
-inline void ConnectionRequestFrame::clear_nonce() {
-  nonce_ = 0;
-  _has_bits_[0] &= ~0x00000040u;
+inline void ConnectionRequestFrame::set_has_connections_device() {
+  _oneof_case_[0] = kConnectionsDevice;
 }
-inline int32_t ConnectionRequestFrame::_internal_nonce() const {
-  return nonce_;
+inline void ConnectionRequestFrame::clear_connections_device() {
+  if (_internal_has_connections_device()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete Device_.connections_device_;
+    }
+    clear_has_Device();
+  }
 }
-inline int32_t ConnectionRequestFrame::nonce() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.nonce)
-  return _internal_nonce();
+inline ::location::nearby::connections::ConnectionsDevice* ConnectionRequestFrame::release_connections_device() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.ConnectionRequestFrame.connections_device)
+  if (_internal_has_connections_device()) {
+    clear_has_Device();
+    ::location::nearby::connections::ConnectionsDevice* temp = Device_.connections_device_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    Device_.connections_device_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline void ConnectionRequestFrame::_internal_set_nonce(int32_t value) {
-  _has_bits_[0] |= 0x00000040u;
-  nonce_ = value;
+inline const ::location::nearby::connections::ConnectionsDevice& ConnectionRequestFrame::_internal_connections_device() const {
+  return _internal_has_connections_device()
+      ? *Device_.connections_device_
+      : reinterpret_cast< ::location::nearby::connections::ConnectionsDevice&>(::location::nearby::connections::_ConnectionsDevice_default_instance_);
 }
-inline void ConnectionRequestFrame::set_nonce(int32_t value) {
-  _internal_set_nonce(value);
-  // @@protoc_insertion_point(field_set:location.nearby.connections.ConnectionRequestFrame.nonce)
+inline const ::location::nearby::connections::ConnectionsDevice& ConnectionRequestFrame::connections_device() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.connections_device)
+  return _internal_connections_device();
+}
+inline ::location::nearby::connections::ConnectionsDevice* ConnectionRequestFrame::unsafe_arena_release_connections_device() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:location.nearby.connections.ConnectionRequestFrame.connections_device)
+  if (_internal_has_connections_device()) {
+    clear_has_Device();
+    ::location::nearby::connections::ConnectionsDevice* temp = Device_.connections_device_;
+    Device_.connections_device_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ConnectionRequestFrame::unsafe_arena_set_allocated_connections_device(::location::nearby::connections::ConnectionsDevice* connections_device) {
+  clear_Device();
+  if (connections_device) {
+    set_has_connections_device();
+    Device_.connections_device_ = connections_device;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.ConnectionRequestFrame.connections_device)
+}
+inline ::location::nearby::connections::ConnectionsDevice* ConnectionRequestFrame::_internal_mutable_connections_device() {
+  if (!_internal_has_connections_device()) {
+    clear_Device();
+    set_has_connections_device();
+    Device_.connections_device_ = CreateMaybeMessage< ::location::nearby::connections::ConnectionsDevice >(GetArenaForAllocation());
+  }
+  return Device_.connections_device_;
+}
+inline ::location::nearby::connections::ConnectionsDevice* ConnectionRequestFrame::mutable_connections_device() {
+  ::location::nearby::connections::ConnectionsDevice* _msg = _internal_mutable_connections_device();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.ConnectionRequestFrame.connections_device)
+  return _msg;
 }
 
-// repeated .location.nearby.connections.ConnectionRequestFrame.Medium mediums = 5;
-inline int ConnectionRequestFrame::_internal_mediums_size() const {
-  return mediums_.size();
+// .location.nearby.connections.PresenceDevice presence_device = 13;
+inline bool ConnectionRequestFrame::_internal_has_presence_device() const {
+  return Device_case() == kPresenceDevice;
 }
-inline int ConnectionRequestFrame::mediums_size() const {
-  return _internal_mediums_size();
+inline bool ConnectionRequestFrame::has_presence_device() const {
+  return _internal_has_presence_device();
 }
-inline void ConnectionRequestFrame::clear_mediums() {
-  mediums_.Clear();
+inline void ConnectionRequestFrame::set_has_presence_device() {
+  _oneof_case_[0] = kPresenceDevice;
 }
-inline ::location::nearby::connections::ConnectionRequestFrame_Medium ConnectionRequestFrame::_internal_mediums(int index) const {
-  return static_cast< ::location::nearby::connections::ConnectionRequestFrame_Medium >(mediums_.Get(index));
+inline void ConnectionRequestFrame::clear_presence_device() {
+  if (_internal_has_presence_device()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete Device_.presence_device_;
+    }
+    clear_has_Device();
+  }
 }
-inline ::location::nearby::connections::ConnectionRequestFrame_Medium ConnectionRequestFrame::mediums(int index) const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.mediums)
-  return _internal_mediums(index);
+inline ::location::nearby::connections::PresenceDevice* ConnectionRequestFrame::release_presence_device() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.ConnectionRequestFrame.presence_device)
+  if (_internal_has_presence_device()) {
+    clear_has_Device();
+    ::location::nearby::connections::PresenceDevice* temp = Device_.presence_device_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    Device_.presence_device_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline void ConnectionRequestFrame::set_mediums(int index, ::location::nearby::connections::ConnectionRequestFrame_Medium value) {
-  assert(::location::nearby::connections::ConnectionRequestFrame_Medium_IsValid(value));
-  mediums_.Set(index, value);
-  // @@protoc_insertion_point(field_set:location.nearby.connections.ConnectionRequestFrame.mediums)
+inline const ::location::nearby::connections::PresenceDevice& ConnectionRequestFrame::_internal_presence_device() const {
+  return _internal_has_presence_device()
+      ? *Device_.presence_device_
+      : reinterpret_cast< ::location::nearby::connections::PresenceDevice&>(::location::nearby::connections::_PresenceDevice_default_instance_);
 }
-inline void ConnectionRequestFrame::_internal_add_mediums(::location::nearby::connections::ConnectionRequestFrame_Medium value) {
-  assert(::location::nearby::connections::ConnectionRequestFrame_Medium_IsValid(value));
-  mediums_.Add(value);
+inline const ::location::nearby::connections::PresenceDevice& ConnectionRequestFrame::presence_device() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.presence_device)
+  return _internal_presence_device();
 }
-inline void ConnectionRequestFrame::add_mediums(::location::nearby::connections::ConnectionRequestFrame_Medium value) {
-  _internal_add_mediums(value);
-  // @@protoc_insertion_point(field_add:location.nearby.connections.ConnectionRequestFrame.mediums)
+inline ::location::nearby::connections::PresenceDevice* ConnectionRequestFrame::unsafe_arena_release_presence_device() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:location.nearby.connections.ConnectionRequestFrame.presence_device)
+  if (_internal_has_presence_device()) {
+    clear_has_Device();
+    ::location::nearby::connections::PresenceDevice* temp = Device_.presence_device_;
+    Device_.presence_device_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>&
-ConnectionRequestFrame::mediums() const {
-  // @@protoc_insertion_point(field_list:location.nearby.connections.ConnectionRequestFrame.mediums)
-  return mediums_;
+inline void ConnectionRequestFrame::unsafe_arena_set_allocated_presence_device(::location::nearby::connections::PresenceDevice* presence_device) {
+  clear_Device();
+  if (presence_device) {
+    set_has_presence_device();
+    Device_.presence_device_ = presence_device;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.ConnectionRequestFrame.presence_device)
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
-ConnectionRequestFrame::_internal_mutable_mediums() {
-  return &mediums_;
+inline ::location::nearby::connections::PresenceDevice* ConnectionRequestFrame::_internal_mutable_presence_device() {
+  if (!_internal_has_presence_device()) {
+    clear_Device();
+    set_has_presence_device();
+    Device_.presence_device_ = CreateMaybeMessage< ::location::nearby::connections::PresenceDevice >(GetArenaForAllocation());
+  }
+  return Device_.presence_device_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
-ConnectionRequestFrame::mutable_mediums() {
-  // @@protoc_insertion_point(field_mutable_list:location.nearby.connections.ConnectionRequestFrame.mediums)
-  return _internal_mutable_mediums();
+inline ::location::nearby::connections::PresenceDevice* ConnectionRequestFrame::mutable_presence_device() {
+  ::location::nearby::connections::PresenceDevice* _msg = _internal_mutable_presence_device();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.ConnectionRequestFrame.presence_device)
+  return _msg;
 }
 
-// optional bytes endpoint_info = 6;
-inline bool ConnectionRequestFrame::_internal_has_endpoint_info() const {
-  bool value = (_has_bits_[0] & 0x00000008u) != 0;
+// optional .location.nearby.connections.ConnectionRequestFrame.ConnectionMode connection_mode = 14;
+inline bool ConnectionRequestFrame::_internal_has_connection_mode() const {
+  bool value = (_has_bits_[0] & 0x00001000u) != 0;
   return value;
 }
-inline bool ConnectionRequestFrame::has_endpoint_info() const {
-  return _internal_has_endpoint_info();
-}
-inline void ConnectionRequestFrame::clear_endpoint_info() {
-  endpoint_info_.ClearToEmpty();
-  _has_bits_[0] &= ~0x00000008u;
-}
-inline const std::string& ConnectionRequestFrame::endpoint_info() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.endpoint_info)
-  return _internal_endpoint_info();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void ConnectionRequestFrame::set_endpoint_info(ArgT0&& arg0, ArgT... args) {
- _has_bits_[0] |= 0x00000008u;
- endpoint_info_.SetBytes(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:location.nearby.connections.ConnectionRequestFrame.endpoint_info)
-}
-inline std::string* ConnectionRequestFrame::mutable_endpoint_info() {
-  std::string* _s = _internal_mutable_endpoint_info();
-  // @@protoc_insertion_point(field_mutable:location.nearby.connections.ConnectionRequestFrame.endpoint_info)
-  return _s;
+inline bool ConnectionRequestFrame::has_connection_mode() const {
+  return _internal_has_connection_mode();
 }
-inline const std::string& ConnectionRequestFrame::_internal_endpoint_info() const {
-  return endpoint_info_.Get();
+inline void ConnectionRequestFrame::clear_connection_mode() {
+  connection_mode_ = 0;
+  _has_bits_[0] &= ~0x00001000u;
 }
-inline void ConnectionRequestFrame::_internal_set_endpoint_info(const std::string& value) {
-  _has_bits_[0] |= 0x00000008u;
-  endpoint_info_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+inline ::location::nearby::connections::ConnectionRequestFrame_ConnectionMode ConnectionRequestFrame::_internal_connection_mode() const {
+  return static_cast< ::location::nearby::connections::ConnectionRequestFrame_ConnectionMode >(connection_mode_);
 }
-inline std::string* ConnectionRequestFrame::_internal_mutable_endpoint_info() {
-  _has_bits_[0] |= 0x00000008u;
-  return endpoint_info_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+inline ::location::nearby::connections::ConnectionRequestFrame_ConnectionMode ConnectionRequestFrame::connection_mode() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.connection_mode)
+  return _internal_connection_mode();
 }
-inline std::string* ConnectionRequestFrame::release_endpoint_info() {
-  // @@protoc_insertion_point(field_release:location.nearby.connections.ConnectionRequestFrame.endpoint_info)
-  if (!_internal_has_endpoint_info()) {
-    return nullptr;
-  }
-  _has_bits_[0] &= ~0x00000008u;
-  auto* p = endpoint_info_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (endpoint_info_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    endpoint_info_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  return p;
+inline void ConnectionRequestFrame::_internal_set_connection_mode(::location::nearby::connections::ConnectionRequestFrame_ConnectionMode value) {
+  assert(::location::nearby::connections::ConnectionRequestFrame_ConnectionMode_IsValid(value));
+  _has_bits_[0] |= 0x00001000u;
+  connection_mode_ = value;
 }
-inline void ConnectionRequestFrame::set_allocated_endpoint_info(std::string* endpoint_info) {
-  if (endpoint_info != nullptr) {
-    _has_bits_[0] |= 0x00000008u;
-  } else {
-    _has_bits_[0] &= ~0x00000008u;
-  }
-  endpoint_info_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), endpoint_info,
-      GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (endpoint_info_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    endpoint_info_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.ConnectionRequestFrame.endpoint_info)
+inline void ConnectionRequestFrame::set_connection_mode(::location::nearby::connections::ConnectionRequestFrame_ConnectionMode value) {
+  _internal_set_connection_mode(value);
+  // @@protoc_insertion_point(field_set:location.nearby.connections.ConnectionRequestFrame.connection_mode)
 }
 
-// optional .location.nearby.connections.MediumMetadata medium_metadata = 7;
-inline bool ConnectionRequestFrame::_internal_has_medium_metadata() const {
-  bool value = (_has_bits_[0] & 0x00000020u) != 0;
-  PROTOBUF_ASSUME(!value || medium_metadata_ != nullptr);
+// optional .location.nearby.connections.LocationHint location_hint = 15;
+inline bool ConnectionRequestFrame::_internal_has_location_hint() const {
+  bool value = (_has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || location_hint_ != nullptr);
   return value;
 }
-inline bool ConnectionRequestFrame::has_medium_metadata() const {
-  return _internal_has_medium_metadata();
+inline bool ConnectionRequestFrame::has_location_hint() const {
+  return _internal_has_location_hint();
 }
-inline void ConnectionRequestFrame::clear_medium_metadata() {
-  if (medium_metadata_ != nullptr) medium_metadata_->Clear();
-  _has_bits_[0] &= ~0x00000020u;
+inline void ConnectionRequestFrame::clear_location_hint() {
+  if (location_hint_ != nullptr) location_hint_->Clear();
+  _has_bits_[0] &= ~0x00000040u;
 }
-inline const ::location::nearby::connections::MediumMetadata& ConnectionRequestFrame::_internal_medium_metadata() const {
-  const ::location::nearby::connections::MediumMetadata* p = medium_metadata_;
-  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::MediumMetadata&>(
-      ::location::nearby::connections::_MediumMetadata_default_instance_);
+inline const ::location::nearby::connections::LocationHint& ConnectionRequestFrame::_internal_location_hint() const {
+  const ::location::nearby::connections::LocationHint* p = location_hint_;
+  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::LocationHint&>(
+      ::location::nearby::connections::_LocationHint_default_instance_);
 }
-inline const ::location::nearby::connections::MediumMetadata& ConnectionRequestFrame::medium_metadata() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.medium_metadata)
-  return _internal_medium_metadata();
+inline const ::location::nearby::connections::LocationHint& ConnectionRequestFrame::location_hint() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.location_hint)
+  return _internal_location_hint();
 }
-inline void ConnectionRequestFrame::unsafe_arena_set_allocated_medium_metadata(
-    ::location::nearby::connections::MediumMetadata* medium_metadata) {
+inline void ConnectionRequestFrame::unsafe_arena_set_allocated_location_hint(
+    ::location::nearby::connections::LocationHint* location_hint) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(medium_metadata_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(location_hint_);
   }
-  medium_metadata_ = medium_metadata;
-  if (medium_metadata) {
-    _has_bits_[0] |= 0x00000020u;
+  location_hint_ = location_hint;
+  if (location_hint) {
+    _has_bits_[0] |= 0x00000040u;
   } else {
-    _has_bits_[0] &= ~0x00000020u;
+    _has_bits_[0] &= ~0x00000040u;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.ConnectionRequestFrame.medium_metadata)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.ConnectionRequestFrame.location_hint)
 }
-inline ::location::nearby::connections::MediumMetadata* ConnectionRequestFrame::release_medium_metadata() {
-  _has_bits_[0] &= ~0x00000020u;
-  ::location::nearby::connections::MediumMetadata* temp = medium_metadata_;
-  medium_metadata_ = nullptr;
+inline ::location::nearby::connections::LocationHint* ConnectionRequestFrame::release_location_hint() {
+  _has_bits_[0] &= ~0x00000040u;
+  ::location::nearby::connections::LocationHint* temp = location_hint_;
+  location_hint_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -10181,392 +11167,465 @@ inline ::location::nearby::connections::MediumMetadata* ConnectionRequestFrame::
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::location::nearby::connections::MediumMetadata* ConnectionRequestFrame::unsafe_arena_release_medium_metadata() {
-  // @@protoc_insertion_point(field_release:location.nearby.connections.ConnectionRequestFrame.medium_metadata)
-  _has_bits_[0] &= ~0x00000020u;
-  ::location::nearby::connections::MediumMetadata* temp = medium_metadata_;
-  medium_metadata_ = nullptr;
+inline ::location::nearby::connections::LocationHint* ConnectionRequestFrame::unsafe_arena_release_location_hint() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.ConnectionRequestFrame.location_hint)
+  _has_bits_[0] &= ~0x00000040u;
+  ::location::nearby::connections::LocationHint* temp = location_hint_;
+  location_hint_ = nullptr;
   return temp;
 }
-inline ::location::nearby::connections::MediumMetadata* ConnectionRequestFrame::_internal_mutable_medium_metadata() {
-  _has_bits_[0] |= 0x00000020u;
-  if (medium_metadata_ == nullptr) {
-    auto* p = CreateMaybeMessage<::location::nearby::connections::MediumMetadata>(GetArenaForAllocation());
-    medium_metadata_ = p;
+inline ::location::nearby::connections::LocationHint* ConnectionRequestFrame::_internal_mutable_location_hint() {
+  _has_bits_[0] |= 0x00000040u;
+  if (location_hint_ == nullptr) {
+    auto* p = CreateMaybeMessage<::location::nearby::connections::LocationHint>(GetArenaForAllocation());
+    location_hint_ = p;
   }
-  return medium_metadata_;
+  return location_hint_;
 }
-inline ::location::nearby::connections::MediumMetadata* ConnectionRequestFrame::mutable_medium_metadata() {
-  ::location::nearby::connections::MediumMetadata* _msg = _internal_mutable_medium_metadata();
-  // @@protoc_insertion_point(field_mutable:location.nearby.connections.ConnectionRequestFrame.medium_metadata)
+inline ::location::nearby::connections::LocationHint* ConnectionRequestFrame::mutable_location_hint() {
+  ::location::nearby::connections::LocationHint* _msg = _internal_mutable_location_hint();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.ConnectionRequestFrame.location_hint)
   return _msg;
 }
-inline void ConnectionRequestFrame::set_allocated_medium_metadata(::location::nearby::connections::MediumMetadata* medium_metadata) {
+inline void ConnectionRequestFrame::set_allocated_location_hint(::location::nearby::connections::LocationHint* location_hint) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete medium_metadata_;
+    delete location_hint_;
   }
-  if (medium_metadata) {
+  if (location_hint) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::MediumMetadata>::GetOwningArena(medium_metadata);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::LocationHint>::GetOwningArena(location_hint);
     if (message_arena != submessage_arena) {
-      medium_metadata = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, medium_metadata, submessage_arena);
+      location_hint = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, location_hint, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000020u;
+    _has_bits_[0] |= 0x00000040u;
   } else {
-    _has_bits_[0] &= ~0x00000020u;
+    _has_bits_[0] &= ~0x00000040u;
   }
-  medium_metadata_ = medium_metadata;
-  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.ConnectionRequestFrame.medium_metadata)
+  location_hint_ = location_hint;
+  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.ConnectionRequestFrame.location_hint)
 }
 
-// optional int32 keep_alive_interval_millis = 8;
-inline bool ConnectionRequestFrame::_internal_has_keep_alive_interval_millis() const {
+// optional .location.nearby.connections.SharedKeyOffer shared_key_offer = 16;
+inline bool ConnectionRequestFrame::_internal_has_shared_key_offer() const {
   bool value = (_has_bits_[0] & 0x00000080u) != 0;
+  PROTOBUF_ASSUME(!value || shared_key_offer_ != nullptr);
   return value;
 }
-inline bool ConnectionRequestFrame::has_keep_alive_interval_millis() const {
-  return _internal_has_keep_alive_interval_millis();
+inline bool ConnectionRequestFrame::has_shared_key_offer() const {
+  return _internal_has_shared_key_offer();
 }
-inline void ConnectionRequestFrame::clear_keep_alive_interval_millis() {
-  keep_alive_interval_millis_ = 0;
+inline void ConnectionRequestFrame::clear_shared_key_offer() {
+  if (shared_key_offer_ != nullptr) shared_key_offer_->Clear();
   _has_bits_[0] &= ~0x00000080u;
 }
-inline int32_t ConnectionRequestFrame::_internal_keep_alive_interval_millis() const {
-  return keep_alive_interval_millis_;
-}
-inline int32_t ConnectionRequestFrame::keep_alive_interval_millis() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.keep_alive_interval_millis)
-  return _internal_keep_alive_interval_millis();
-}
-inline void ConnectionRequestFrame::_internal_set_keep_alive_interval_millis(int32_t value) {
-  _has_bits_[0] |= 0x00000080u;
-  keep_alive_interval_millis_ = value;
-}
-inline void ConnectionRequestFrame::set_keep_alive_interval_millis(int32_t value) {
-  _internal_set_keep_alive_interval_millis(value);
-  // @@protoc_insertion_point(field_set:location.nearby.connections.ConnectionRequestFrame.keep_alive_interval_millis)
-}
-
-// optional int32 keep_alive_timeout_millis = 9;
-inline bool ConnectionRequestFrame::_internal_has_keep_alive_timeout_millis() const {
-  bool value = (_has_bits_[0] & 0x00000100u) != 0;
-  return value;
-}
-inline bool ConnectionRequestFrame::has_keep_alive_timeout_millis() const {
-  return _internal_has_keep_alive_timeout_millis();
-}
-inline void ConnectionRequestFrame::clear_keep_alive_timeout_millis() {
-  keep_alive_timeout_millis_ = 0;
-  _has_bits_[0] &= ~0x00000100u;
-}
-inline int32_t ConnectionRequestFrame::_internal_keep_alive_timeout_millis() const {
-  return keep_alive_timeout_millis_;
+inline const ::location::nearby::connections::SharedKeyOffer& ConnectionRequestFrame::_internal_shared_key_offer() const {
+  const ::location::nearby::connections::SharedKeyOffer* p = shared_key_offer_;
+  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::SharedKeyOffer&>(
+      ::location::nearby::connections::_SharedKeyOffer_default_instance_);
 }
-inline int32_t ConnectionRequestFrame::keep_alive_timeout_millis() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.keep_alive_timeout_millis)
-  return _internal_keep_alive_timeout_millis();
+inline const ::location::nearby::connections::SharedKeyOffer& ConnectionRequestFrame::shared_key_offer() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.shared_key_offer)
+  return _internal_shared_key_offer();
 }
-inline void ConnectionRequestFrame::_internal_set_keep_alive_timeout_millis(int32_t value) {
-  _has_bits_[0] |= 0x00000100u;
-  keep_alive_timeout_millis_ = value;
+inline void ConnectionRequestFrame::unsafe_arena_set_allocated_shared_key_offer(
+    ::location::nearby::connections::SharedKeyOffer* shared_key_offer) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(shared_key_offer_);
+  }
+  shared_key_offer_ = shared_key_offer;
+  if (shared_key_offer) {
+    _has_bits_[0] |= 0x00000080u;
+  } else {
+    _has_bits_[0] &= ~0x00000080u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.ConnectionRequestFrame.shared_key_offer)
 }
-inline void ConnectionRequestFrame::set_keep_alive_timeout_millis(int32_t value) {
-  _internal_set_keep_alive_timeout_millis(value);
-  // @@protoc_insertion_point(field_set:location.nearby.connections.ConnectionRequestFrame.keep_alive_timeout_millis)
+inline ::location::nearby::connections::SharedKeyOffer* ConnectionRequestFrame::release_shared_key_offer() {
+  _has_bits_[0] &= ~0x00000080u;
+  ::location::nearby::connections::SharedKeyOffer* temp = shared_key_offer_;
+  shared_key_offer_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-
-// optional int32 device_type = 10 [default = 0, deprecated = true];
-inline bool ConnectionRequestFrame::_internal_has_device_type() const {
-  bool value = (_has_bits_[0] & 0x00000200u) != 0;
-  return value;
+inline ::location::nearby::connections::SharedKeyOffer* ConnectionRequestFrame::unsafe_arena_release_shared_key_offer() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.ConnectionRequestFrame.shared_key_offer)
+  _has_bits_[0] &= ~0x00000080u;
+  ::location::nearby::connections::SharedKeyOffer* temp = shared_key_offer_;
+  shared_key_offer_ = nullptr;
+  return temp;
 }
-inline bool ConnectionRequestFrame::has_device_type() const {
-  return _internal_has_device_type();
+inline ::location::nearby::connections::SharedKeyOffer* ConnectionRequestFrame::_internal_mutable_shared_key_offer() {
+  _has_bits_[0] |= 0x00000080u;
+  if (shared_key_offer_ == nullptr) {
+    auto* p = CreateMaybeMessage<::location::nearby::connections::SharedKeyOffer>(GetArenaForAllocation());
+    shared_key_offer_ = p;
+  }
+  return shared_key_offer_;
 }
-inline void ConnectionRequestFrame::clear_device_type() {
-  device_type_ = 0;
-  _has_bits_[0] &= ~0x00000200u;
+inline ::location::nearby::connections::SharedKeyOffer* ConnectionRequestFrame::mutable_shared_key_offer() {
+  ::location::nearby::connections::SharedKeyOffer* _msg = _internal_mutable_shared_key_offer();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.ConnectionRequestFrame.shared_key_offer)
+  return _msg;
 }
-inline int32_t ConnectionRequestFrame::_internal_device_type() const {
-  return device_type_;
+inline void ConnectionRequestFrame::set_allocated_shared_key_offer(::location::nearby::connections::SharedKeyOffer* shared_key_offer) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete shared_key_offer_;
+  }
+  if (shared_key_offer) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::SharedKeyOffer>::GetOwningArena(shared_key_offer);
+    if (message_arena != submessage_arena) {
+      shared_key_offer = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, shared_key_offer, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000080u;
+  } else {
+    _has_bits_[0] &= ~0x00000080u;
+  }
+  shared_key_offer_ = shared_key_offer;
+  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.ConnectionRequestFrame.shared_key_offer)
 }
-inline int32_t ConnectionRequestFrame::device_type() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.device_type)
-  return _internal_device_type();
+
+inline bool ConnectionRequestFrame::has_Device() const {
+  return Device_case() != DEVICE_NOT_SET;
 }
-inline void ConnectionRequestFrame::_internal_set_device_type(int32_t value) {
-  _has_bits_[0] |= 0x00000200u;
-  device_type_ = value;
+inline void ConnectionRequestFrame::clear_has_Device() {
+  _oneof_case_[0] = DEVICE_NOT_SET;
 }
-inline void ConnectionRequestFrame::set_device_type(int32_t value) {
-  _internal_set_device_type(value);
-  // @@protoc_insertion_point(field_set:location.nearby.connections.ConnectionRequestFrame.device_type)
+inline ConnectionRequestFrame::DeviceCase ConnectionRequestFrame::Device_case() const {
+  return ConnectionRequestFrame::DeviceCase(_oneof_case_[0]);
 }
+// -------------------------------------------------------------------
 
-// optional bytes device_info = 11 [deprecated = true];
-inline bool ConnectionRequestFrame::_internal_has_device_info() const {
-  bool value = (_has_bits_[0] & 0x00000010u) != 0;
+// SharedKeyOffer
+
+// optional bytes session_tag = 1;
+inline bool SharedKeyOffer::_internal_has_session_tag() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool ConnectionRequestFrame::has_device_info() const {
-  return _internal_has_device_info();
+inline bool SharedKeyOffer::has_session_tag() const {
+  return _internal_has_session_tag();
 }
-inline void ConnectionRequestFrame::clear_device_info() {
-  device_info_.ClearToEmpty();
-  _has_bits_[0] &= ~0x00000010u;
+inline void SharedKeyOffer::clear_session_tag() {
+  session_tag_.ClearToEmpty();
+  _has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& ConnectionRequestFrame::device_info() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.device_info)
-  return _internal_device_info();
+inline const std::string& SharedKeyOffer::session_tag() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.SharedKeyOffer.session_tag)
+  return _internal_session_tag();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void ConnectionRequestFrame::set_device_info(ArgT0&& arg0, ArgT... args) {
- _has_bits_[0] |= 0x00000010u;
- device_info_.SetBytes(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:location.nearby.connections.ConnectionRequestFrame.device_info)
+void SharedKeyOffer::set_session_tag(ArgT0&& arg0, ArgT... args) {
+ _has_bits_[0] |= 0x00000001u;
+ session_tag_.SetBytes(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:location.nearby.connections.SharedKeyOffer.session_tag)
 }
-inline std::string* ConnectionRequestFrame::mutable_device_info() {
-  std::string* _s = _internal_mutable_device_info();
-  // @@protoc_insertion_point(field_mutable:location.nearby.connections.ConnectionRequestFrame.device_info)
+inline std::string* SharedKeyOffer::mutable_session_tag() {
+  std::string* _s = _internal_mutable_session_tag();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.SharedKeyOffer.session_tag)
   return _s;
 }
-inline const std::string& ConnectionRequestFrame::_internal_device_info() const {
-  return device_info_.Get();
+inline const std::string& SharedKeyOffer::_internal_session_tag() const {
+  return session_tag_.Get();
 }
-inline void ConnectionRequestFrame::_internal_set_device_info(const std::string& value) {
-  _has_bits_[0] |= 0x00000010u;
-  device_info_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+inline void SharedKeyOffer::_internal_set_session_tag(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  session_tag_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
 }
-inline std::string* ConnectionRequestFrame::_internal_mutable_device_info() {
-  _has_bits_[0] |= 0x00000010u;
-  return device_info_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+inline std::string* SharedKeyOffer::_internal_mutable_session_tag() {
+  _has_bits_[0] |= 0x00000001u;
+  return session_tag_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
 }
-inline std::string* ConnectionRequestFrame::release_device_info() {
-  // @@protoc_insertion_point(field_release:location.nearby.connections.ConnectionRequestFrame.device_info)
-  if (!_internal_has_device_info()) {
+inline std::string* SharedKeyOffer::release_session_tag() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.SharedKeyOffer.session_tag)
+  if (!_internal_has_session_tag()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000010u;
-  auto* p = device_info_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  _has_bits_[0] &= ~0x00000001u;
+  auto* p = session_tag_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (device_info_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    device_info_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (session_tag_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
+    session_tag_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void ConnectionRequestFrame::set_allocated_device_info(std::string* device_info) {
-  if (device_info != nullptr) {
-    _has_bits_[0] |= 0x00000010u;
+inline void SharedKeyOffer::set_allocated_session_tag(std::string* session_tag) {
+  if (session_tag != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000010u;
+    _has_bits_[0] &= ~0x00000001u;
   }
-  device_info_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), device_info,
+  session_tag_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), session_tag,
       GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (device_info_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    device_info_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (session_tag_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
+    session_tag_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.ConnectionRequestFrame.device_info)
+  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.SharedKeyOffer.session_tag)
 }
 
-// .location.nearby.connections.ConnectionsDevice connections_device = 12;
-inline bool ConnectionRequestFrame::_internal_has_connections_device() const {
-  return Device_case() == kConnectionsDevice;
+// optional bytes nonce = 2;
+inline bool SharedKeyOffer::_internal_has_nonce() const {
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline bool ConnectionRequestFrame::has_connections_device() const {
-  return _internal_has_connections_device();
+inline bool SharedKeyOffer::has_nonce() const {
+  return _internal_has_nonce();
 }
-inline void ConnectionRequestFrame::set_has_connections_device() {
-  _oneof_case_[0] = kConnectionsDevice;
+inline void SharedKeyOffer::clear_nonce() {
+  nonce_.ClearToEmpty();
+  _has_bits_[0] &= ~0x00000002u;
 }
-inline void ConnectionRequestFrame::clear_connections_device() {
-  if (_internal_has_connections_device()) {
-    if (GetArenaForAllocation() == nullptr) {
-      delete Device_.connections_device_;
-    }
-    clear_has_Device();
-  }
+inline const std::string& SharedKeyOffer::nonce() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.SharedKeyOffer.nonce)
+  return _internal_nonce();
 }
-inline ::location::nearby::connections::ConnectionsDevice* ConnectionRequestFrame::release_connections_device() {
-  // @@protoc_insertion_point(field_release:location.nearby.connections.ConnectionRequestFrame.connections_device)
-  if (_internal_has_connections_device()) {
-    clear_has_Device();
-      ::location::nearby::connections::ConnectionsDevice* temp = Device_.connections_device_;
-    if (GetArenaForAllocation() != nullptr) {
-      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-    }
-    Device_.connections_device_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SharedKeyOffer::set_nonce(ArgT0&& arg0, ArgT... args) {
+ _has_bits_[0] |= 0x00000002u;
+ nonce_.SetBytes(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:location.nearby.connections.SharedKeyOffer.nonce)
 }
-inline const ::location::nearby::connections::ConnectionsDevice& ConnectionRequestFrame::_internal_connections_device() const {
-  return _internal_has_connections_device()
-      ? *Device_.connections_device_
-      : reinterpret_cast< ::location::nearby::connections::ConnectionsDevice&>(::location::nearby::connections::_ConnectionsDevice_default_instance_);
+inline std::string* SharedKeyOffer::mutable_nonce() {
+  std::string* _s = _internal_mutable_nonce();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.SharedKeyOffer.nonce)
+  return _s;
 }
-inline const ::location::nearby::connections::ConnectionsDevice& ConnectionRequestFrame::connections_device() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.connections_device)
-  return _internal_connections_device();
+inline const std::string& SharedKeyOffer::_internal_nonce() const {
+  return nonce_.Get();
 }
-inline ::location::nearby::connections::ConnectionsDevice* ConnectionRequestFrame::unsafe_arena_release_connections_device() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:location.nearby.connections.ConnectionRequestFrame.connections_device)
-  if (_internal_has_connections_device()) {
-    clear_has_Device();
-    ::location::nearby::connections::ConnectionsDevice* temp = Device_.connections_device_;
-    Device_.connections_device_ = nullptr;
-    return temp;
-  } else {
+inline void SharedKeyOffer::_internal_set_nonce(const std::string& value) {
+  _has_bits_[0] |= 0x00000002u;
+  nonce_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+}
+inline std::string* SharedKeyOffer::_internal_mutable_nonce() {
+  _has_bits_[0] |= 0x00000002u;
+  return nonce_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+}
+inline std::string* SharedKeyOffer::release_nonce() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.SharedKeyOffer.nonce)
+  if (!_internal_has_nonce()) {
     return nullptr;
   }
-}
-inline void ConnectionRequestFrame::unsafe_arena_set_allocated_connections_device(::location::nearby::connections::ConnectionsDevice* connections_device) {
-  clear_Device();
-  if (connections_device) {
-    set_has_connections_device();
-    Device_.connections_device_ = connections_device;
+  _has_bits_[0] &= ~0x00000002u;
+  auto* p = nonce_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (nonce_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
+    nonce_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.ConnectionRequestFrame.connections_device)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline ::location::nearby::connections::ConnectionsDevice* ConnectionRequestFrame::_internal_mutable_connections_device() {
-  if (!_internal_has_connections_device()) {
-    clear_Device();
-    set_has_connections_device();
-    Device_.connections_device_ = CreateMaybeMessage< ::location::nearby::connections::ConnectionsDevice >(GetArenaForAllocation());
+inline void SharedKeyOffer::set_allocated_nonce(std::string* nonce) {
+  if (nonce != nullptr) {
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
   }
-  return Device_.connections_device_;
+  nonce_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), nonce,
+      GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (nonce_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
+    nonce_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.SharedKeyOffer.nonce)
 }
-inline ::location::nearby::connections::ConnectionsDevice* ConnectionRequestFrame::mutable_connections_device() {
-  ::location::nearby::connections::ConnectionsDevice* _msg = _internal_mutable_connections_device();
-  // @@protoc_insertion_point(field_mutable:location.nearby.connections.ConnectionRequestFrame.connections_device)
-  return _msg;
+
+// -------------------------------------------------------------------
+
+// SharedKeyFrame
+
+// optional .location.nearby.connections.SharedKeyFrame.FrameType type = 1;
+inline bool SharedKeyFrame::_internal_has_type() const {
+  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SharedKeyFrame::has_type() const {
+  return _internal_has_type();
+}
+inline void SharedKeyFrame::clear_type() {
+  type_ = 0;
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline ::location::nearby::connections::SharedKeyFrame_FrameType SharedKeyFrame::_internal_type() const {
+  return static_cast< ::location::nearby::connections::SharedKeyFrame_FrameType >(type_);
+}
+inline ::location::nearby::connections::SharedKeyFrame_FrameType SharedKeyFrame::type() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.SharedKeyFrame.type)
+  return _internal_type();
+}
+inline void SharedKeyFrame::_internal_set_type(::location::nearby::connections::SharedKeyFrame_FrameType value) {
+  assert(::location::nearby::connections::SharedKeyFrame_FrameType_IsValid(value));
+  _has_bits_[0] |= 0x00000004u;
+  type_ = value;
+}
+inline void SharedKeyFrame::set_type(::location::nearby::connections::SharedKeyFrame_FrameType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:location.nearby.connections.SharedKeyFrame.type)
 }
 
-// .location.nearby.connections.PresenceDevice presence_device = 13;
-inline bool ConnectionRequestFrame::_internal_has_presence_device() const {
-  return Device_case() == kPresenceDevice;
+// optional bytes nonce = 2;
+inline bool SharedKeyFrame::_internal_has_nonce() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline bool ConnectionRequestFrame::has_presence_device() const {
-  return _internal_has_presence_device();
+inline bool SharedKeyFrame::has_nonce() const {
+  return _internal_has_nonce();
 }
-inline void ConnectionRequestFrame::set_has_presence_device() {
-  _oneof_case_[0] = kPresenceDevice;
+inline void SharedKeyFrame::clear_nonce() {
+  nonce_.ClearToEmpty();
+  _has_bits_[0] &= ~0x00000001u;
 }
-inline void ConnectionRequestFrame::clear_presence_device() {
-  if (_internal_has_presence_device()) {
-    if (GetArenaForAllocation() == nullptr) {
-      delete Device_.presence_device_;
-    }
-    clear_has_Device();
-  }
+inline const std::string& SharedKeyFrame::nonce() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.SharedKeyFrame.nonce)
+  return _internal_nonce();
 }
-inline ::location::nearby::connections::PresenceDevice* ConnectionRequestFrame::release_presence_device() {
-  // @@protoc_insertion_point(field_release:location.nearby.connections.ConnectionRequestFrame.presence_device)
-  if (_internal_has_presence_device()) {
-    clear_has_Device();
-      ::location::nearby::connections::PresenceDevice* temp = Device_.presence_device_;
-    if (GetArenaForAllocation() != nullptr) {
-      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-    }
-    Device_.presence_device_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SharedKeyFrame::set_nonce(ArgT0&& arg0, ArgT... args) {
+ _has_bits_[0] |= 0x00000001u;
+ nonce_.SetBytes(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:location.nearby.connections.SharedKeyFrame.nonce)
 }
-inline const ::location::nearby::connections::PresenceDevice& ConnectionRequestFrame::_internal_presence_device() const {
-  return _internal_has_presence_device()
-      ? *Device_.presence_device_
-      : reinterpret_cast< ::location::nearby::connections::PresenceDevice&>(::location::nearby::connections::_PresenceDevice_default_instance_);
+inline std::string* SharedKeyFrame::mutable_nonce() {
+  std::string* _s = _internal_mutable_nonce();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.SharedKeyFrame.nonce)
+  return _s;
 }
-inline const ::location::nearby::connections::PresenceDevice& ConnectionRequestFrame::presence_device() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.presence_device)
-  return _internal_presence_device();
+inline const std::string& SharedKeyFrame::_internal_nonce() const {
+  return nonce_.Get();
 }
-inline ::location::nearby::connections::PresenceDevice* ConnectionRequestFrame::unsafe_arena_release_presence_device() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:location.nearby.connections.ConnectionRequestFrame.presence_device)
-  if (_internal_has_presence_device()) {
-    clear_has_Device();
-    ::location::nearby::connections::PresenceDevice* temp = Device_.presence_device_;
-    Device_.presence_device_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline void SharedKeyFrame::_internal_set_nonce(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  nonce_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
 }
-inline void ConnectionRequestFrame::unsafe_arena_set_allocated_presence_device(::location::nearby::connections::PresenceDevice* presence_device) {
-  clear_Device();
-  if (presence_device) {
-    set_has_presence_device();
-    Device_.presence_device_ = presence_device;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.ConnectionRequestFrame.presence_device)
+inline std::string* SharedKeyFrame::_internal_mutable_nonce() {
+  _has_bits_[0] |= 0x00000001u;
+  return nonce_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
 }
-inline ::location::nearby::connections::PresenceDevice* ConnectionRequestFrame::_internal_mutable_presence_device() {
-  if (!_internal_has_presence_device()) {
-    clear_Device();
-    set_has_presence_device();
-    Device_.presence_device_ = CreateMaybeMessage< ::location::nearby::connections::PresenceDevice >(GetArenaForAllocation());
+inline std::string* SharedKeyFrame::release_nonce() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.SharedKeyFrame.nonce)
+  if (!_internal_has_nonce()) {
+    return nullptr;
   }
-  return Device_.presence_device_;
+  _has_bits_[0] &= ~0x00000001u;
+  auto* p = nonce_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (nonce_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
+    nonce_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline ::location::nearby::connections::PresenceDevice* ConnectionRequestFrame::mutable_presence_device() {
-  ::location::nearby::connections::PresenceDevice* _msg = _internal_mutable_presence_device();
-  // @@protoc_insertion_point(field_mutable:location.nearby.connections.ConnectionRequestFrame.presence_device)
-  return _msg;
+inline void SharedKeyFrame::set_allocated_nonce(std::string* nonce) {
+  if (nonce != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  nonce_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), nonce,
+      GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (nonce_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
+    nonce_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.SharedKeyFrame.nonce)
 }
 
-// optional .location.nearby.connections.ConnectionRequestFrame.ConnectionMode connection_mode = 14;
-inline bool ConnectionRequestFrame::_internal_has_connection_mode() const {
-  bool value = (_has_bits_[0] & 0x00000400u) != 0;
+// optional bytes confirmation = 3;
+inline bool SharedKeyFrame::_internal_has_confirmation() const {
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
-inline bool ConnectionRequestFrame::has_connection_mode() const {
-  return _internal_has_connection_mode();
+inline bool SharedKeyFrame::has_confirmation() const {
+  return _internal_has_confirmation();
 }
-inline void ConnectionRequestFrame::clear_connection_mode() {
-  connection_mode_ = 0;
-  _has_bits_[0] &= ~0x00000400u;
+inline void SharedKeyFrame::clear_confirmation() {
+  confirmation_.ClearToEmpty();
+  _has_bits_[0] &= ~0x00000002u;
 }
-inline ::location::nearby::connections::ConnectionRequestFrame_ConnectionMode ConnectionRequestFrame::_internal_connection_mode() const {
-  return static_cast< ::location::nearby::connections::ConnectionRequestFrame_ConnectionMode >(connection_mode_);
+inline const std::string& SharedKeyFrame::confirmation() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.SharedKeyFrame.confirmation)
+  return _internal_confirmation();
 }
-inline ::location::nearby::connections::ConnectionRequestFrame_ConnectionMode ConnectionRequestFrame::connection_mode() const {
-  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionRequestFrame.connection_mode)
-  return _internal_connection_mode();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SharedKeyFrame::set_confirmation(ArgT0&& arg0, ArgT... args) {
+ _has_bits_[0] |= 0x00000002u;
+ confirmation_.SetBytes(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:location.nearby.connections.SharedKeyFrame.confirmation)
 }
-inline void ConnectionRequestFrame::_internal_set_connection_mode(::location::nearby::connections::ConnectionRequestFrame_ConnectionMode value) {
-  assert(::location::nearby::connections::ConnectionRequestFrame_ConnectionMode_IsValid(value));
-  _has_bits_[0] |= 0x00000400u;
-  connection_mode_ = value;
+inline std::string* SharedKeyFrame::mutable_confirmation() {
+  std::string* _s = _internal_mutable_confirmation();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.SharedKeyFrame.confirmation)
+  return _s;
 }
-inline void ConnectionRequestFrame::set_connection_mode(::location::nearby::connections::ConnectionRequestFrame_ConnectionMode value) {
-  _internal_set_connection_mode(value);
-  // @@protoc_insertion_point(field_set:location.nearby.connections.ConnectionRequestFrame.connection_mode)
+inline const std::string& SharedKeyFrame::_internal_confirmation() const {
+  return confirmation_.Get();
 }
-
-inline bool ConnectionRequestFrame::has_Device() const {
-  return Device_case() != DEVICE_NOT_SET;
+inline void SharedKeyFrame::_internal_set_confirmation(const std::string& value) {
+  _has_bits_[0] |= 0x00000002u;
+  confirmation_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
 }
-inline void ConnectionRequestFrame::clear_has_Device() {
-  _oneof_case_[0] = DEVICE_NOT_SET;
+inline std::string* SharedKeyFrame::_internal_mutable_confirmation() {
+  _has_bits_[0] |= 0x00000002u;
+  return confirmation_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
 }
-inline ConnectionRequestFrame::DeviceCase ConnectionRequestFrame::Device_case() const {
-  return ConnectionRequestFrame::DeviceCase(_oneof_case_[0]);
+inline std::string* SharedKeyFrame::release_confirmation() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.SharedKeyFrame.confirmation)
+  if (!_internal_has_confirmation()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000002u;
+  auto* p = confirmation_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (confirmation_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
+    confirmation_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SharedKeyFrame::set_allocated_confirmation(std::string* confirmation) {
+  if (confirmation != nullptr) {
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
+  }
+  confirmation_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), confirmation,
+      GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (confirmation_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
+    confirmation_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.SharedKeyFrame.confirmation)
 }
+
 // -------------------------------------------------------------------
 
 // ConnectionResponseFrame
 
 // optional int32 status = 1 [deprecated = true];
 inline bool ConnectionResponseFrame::_internal_has_status() const {
-  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+  bool value = (_has_bits_[0] & 0x00000008u) != 0;
   return value;
 }
 inline bool ConnectionResponseFrame::has_status() const {
@@ -10574,7 +11633,7 @@ inline bool ConnectionResponseFrame::has_status() const {
 }
 inline void ConnectionResponseFrame::clear_status() {
   status_ = 0;
-  _has_bits_[0] &= ~0x00000004u;
+  _has_bits_[0] &= ~0x00000008u;
 }
 inline int32_t ConnectionResponseFrame::_internal_status() const {
   return status_;
@@ -10584,7 +11643,7 @@ inline int32_t ConnectionResponseFrame::status() const {
   return _internal_status();
 }
 inline void ConnectionResponseFrame::_internal_set_status(int32_t value) {
-  _has_bits_[0] |= 0x00000004u;
+  _has_bits_[0] |= 0x00000008u;
   status_ = value;
 }
 inline void ConnectionResponseFrame::set_status(int32_t value) {
@@ -10663,7 +11722,7 @@ inline void ConnectionResponseFrame::set_allocated_handshake_data(std::string* h
 
 // optional .location.nearby.connections.ConnectionResponseFrame.ResponseStatus response = 3;
 inline bool ConnectionResponseFrame::_internal_has_response() const {
-  bool value = (_has_bits_[0] & 0x00000008u) != 0;
+  bool value = (_has_bits_[0] & 0x00000010u) != 0;
   return value;
 }
 inline bool ConnectionResponseFrame::has_response() const {
@@ -10671,7 +11730,7 @@ inline bool ConnectionResponseFrame::has_response() const {
 }
 inline void ConnectionResponseFrame::clear_response() {
   response_ = 0;
-  _has_bits_[0] &= ~0x00000008u;
+  _has_bits_[0] &= ~0x00000010u;
 }
 inline ::location::nearby::connections::ConnectionResponseFrame_ResponseStatus ConnectionResponseFrame::_internal_response() const {
   return static_cast< ::location::nearby::connections::ConnectionResponseFrame_ResponseStatus >(response_);
@@ -10682,7 +11741,7 @@ inline ::location::nearby::connections::ConnectionResponseFrame_ResponseStatus C
 }
 inline void ConnectionResponseFrame::_internal_set_response(::location::nearby::connections::ConnectionResponseFrame_ResponseStatus value) {
   assert(::location::nearby::connections::ConnectionResponseFrame_ResponseStatus_IsValid(value));
-  _has_bits_[0] |= 0x00000008u;
+  _has_bits_[0] |= 0x00000010u;
   response_ = value;
 }
 inline void ConnectionResponseFrame::set_response(::location::nearby::connections::ConnectionResponseFrame_ResponseStatus value) {
@@ -10782,7 +11841,7 @@ inline void ConnectionResponseFrame::set_allocated_os_info(::location::nearby::c
 
 // optional int32 multiplex_socket_bitmask = 5;
 inline bool ConnectionResponseFrame::_internal_has_multiplex_socket_bitmask() const {
-  bool value = (_has_bits_[0] & 0x00000010u) != 0;
+  bool value = (_has_bits_[0] & 0x00000020u) != 0;
   return value;
 }
 inline bool ConnectionResponseFrame::has_multiplex_socket_bitmask() const {
@@ -10790,7 +11849,7 @@ inline bool ConnectionResponseFrame::has_multiplex_socket_bitmask() const {
 }
 inline void ConnectionResponseFrame::clear_multiplex_socket_bitmask() {
   multiplex_socket_bitmask_ = 0;
-  _has_bits_[0] &= ~0x00000010u;
+  _has_bits_[0] &= ~0x00000020u;
 }
 inline int32_t ConnectionResponseFrame::_internal_multiplex_socket_bitmask() const {
   return multiplex_socket_bitmask_;
@@ -10800,7 +11859,7 @@ inline int32_t ConnectionResponseFrame::multiplex_socket_bitmask() const {
   return _internal_multiplex_socket_bitmask();
 }
 inline void ConnectionResponseFrame::_internal_set_multiplex_socket_bitmask(int32_t value) {
-  _has_bits_[0] |= 0x00000010u;
+  _has_bits_[0] |= 0x00000020u;
   multiplex_socket_bitmask_ = value;
 }
 inline void ConnectionResponseFrame::set_multiplex_socket_bitmask(int32_t value) {
@@ -10810,7 +11869,7 @@ inline void ConnectionResponseFrame::set_multiplex_socket_bitmask(int32_t value)
 
 // optional int32 nearby_connections_version = 6 [deprecated = true];
 inline bool ConnectionResponseFrame::_internal_has_nearby_connections_version() const {
-  bool value = (_has_bits_[0] & 0x00000020u) != 0;
+  bool value = (_has_bits_[0] & 0x00000040u) != 0;
   return value;
 }
 inline bool ConnectionResponseFrame::has_nearby_connections_version() const {
@@ -10818,7 +11877,7 @@ inline bool ConnectionResponseFrame::has_nearby_connections_version() const {
 }
 inline void ConnectionResponseFrame::clear_nearby_connections_version() {
   nearby_connections_version_ = 0;
-  _has_bits_[0] &= ~0x00000020u;
+  _has_bits_[0] &= ~0x00000040u;
 }
 inline int32_t ConnectionResponseFrame::_internal_nearby_connections_version() const {
   return nearby_connections_version_;
@@ -10828,7 +11887,7 @@ inline int32_t ConnectionResponseFrame::nearby_connections_version() const {
   return _internal_nearby_connections_version();
 }
 inline void ConnectionResponseFrame::_internal_set_nearby_connections_version(int32_t value) {
-  _has_bits_[0] |= 0x00000020u;
+  _has_bits_[0] |= 0x00000040u;
   nearby_connections_version_ = value;
 }
 inline void ConnectionResponseFrame::set_nearby_connections_version(int32_t value) {
@@ -10838,7 +11897,7 @@ inline void ConnectionResponseFrame::set_nearby_connections_version(int32_t valu
 
 // optional int32 safe_to_disconnect_version = 7;
 inline bool ConnectionResponseFrame::_internal_has_safe_to_disconnect_version() const {
-  bool value = (_has_bits_[0] & 0x00000040u) != 0;
+  bool value = (_has_bits_[0] & 0x00000080u) != 0;
   return value;
 }
 inline bool ConnectionResponseFrame::has_safe_to_disconnect_version() const {
@@ -10846,7 +11905,7 @@ inline bool ConnectionResponseFrame::has_safe_to_disconnect_version() const {
 }
 inline void ConnectionResponseFrame::clear_safe_to_disconnect_version() {
   safe_to_disconnect_version_ = 0;
-  _has_bits_[0] &= ~0x00000040u;
+  _has_bits_[0] &= ~0x00000080u;
 }
 inline int32_t ConnectionResponseFrame::_internal_safe_to_disconnect_version() const {
   return safe_to_disconnect_version_;
@@ -10856,7 +11915,7 @@ inline int32_t ConnectionResponseFrame::safe_to_disconnect_version() const {
   return _internal_safe_to_disconnect_version();
 }
 inline void ConnectionResponseFrame::_internal_set_safe_to_disconnect_version(int32_t value) {
-  _has_bits_[0] |= 0x00000040u;
+  _has_bits_[0] |= 0x00000080u;
   safe_to_disconnect_version_ = value;
 }
 inline void ConnectionResponseFrame::set_safe_to_disconnect_version(int32_t value) {
@@ -10864,6 +11923,208 @@ inline void ConnectionResponseFrame::set_safe_to_disconnect_version(int32_t valu
   // @@protoc_insertion_point(field_set:location.nearby.connections.ConnectionResponseFrame.safe_to_disconnect_version)
 }
 
+// optional .location.nearby.connections.LocationHint location_hint = 8;
+inline bool ConnectionResponseFrame::_internal_has_location_hint() const {
+  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || location_hint_ != nullptr);
+  return value;
+}
+inline bool ConnectionResponseFrame::has_location_hint() const {
+  return _internal_has_location_hint();
+}
+inline void ConnectionResponseFrame::clear_location_hint() {
+  if (location_hint_ != nullptr) location_hint_->Clear();
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline const ::location::nearby::connections::LocationHint& ConnectionResponseFrame::_internal_location_hint() const {
+  const ::location::nearby::connections::LocationHint* p = location_hint_;
+  return p != nullptr ? *p : reinterpret_cast<const ::location::nearby::connections::LocationHint&>(
+      ::location::nearby::connections::_LocationHint_default_instance_);
+}
+inline const ::location::nearby::connections::LocationHint& ConnectionResponseFrame::location_hint() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionResponseFrame.location_hint)
+  return _internal_location_hint();
+}
+inline void ConnectionResponseFrame::unsafe_arena_set_allocated_location_hint(
+    ::location::nearby::connections::LocationHint* location_hint) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(location_hint_);
+  }
+  location_hint_ = location_hint;
+  if (location_hint) {
+    _has_bits_[0] |= 0x00000004u;
+  } else {
+    _has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:location.nearby.connections.ConnectionResponseFrame.location_hint)
+}
+inline ::location::nearby::connections::LocationHint* ConnectionResponseFrame::release_location_hint() {
+  _has_bits_[0] &= ~0x00000004u;
+  ::location::nearby::connections::LocationHint* temp = location_hint_;
+  location_hint_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::location::nearby::connections::LocationHint* ConnectionResponseFrame::unsafe_arena_release_location_hint() {
+  // @@protoc_insertion_point(field_release:location.nearby.connections.ConnectionResponseFrame.location_hint)
+  _has_bits_[0] &= ~0x00000004u;
+  ::location::nearby::connections::LocationHint* temp = location_hint_;
+  location_hint_ = nullptr;
+  return temp;
+}
+inline ::location::nearby::connections::LocationHint* ConnectionResponseFrame::_internal_mutable_location_hint() {
+  _has_bits_[0] |= 0x00000004u;
+  if (location_hint_ == nullptr) {
+    auto* p = CreateMaybeMessage<::location::nearby::connections::LocationHint>(GetArenaForAllocation());
+    location_hint_ = p;
+  }
+  return location_hint_;
+}
+inline ::location::nearby::connections::LocationHint* ConnectionResponseFrame::mutable_location_hint() {
+  ::location::nearby::connections::LocationHint* _msg = _internal_mutable_location_hint();
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.ConnectionResponseFrame.location_hint)
+  return _msg;
+}
+inline void ConnectionResponseFrame::set_allocated_location_hint(::location::nearby::connections::LocationHint* location_hint) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete location_hint_;
+  }
+  if (location_hint) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::location::nearby::connections::LocationHint>::GetOwningArena(location_hint);
+    if (message_arena != submessage_arena) {
+      location_hint = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, location_hint, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000004u;
+  } else {
+    _has_bits_[0] &= ~0x00000004u;
+  }
+  location_hint_ = location_hint;
+  // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.ConnectionResponseFrame.location_hint)
+}
+
+// optional int32 keep_alive_timeout_millis = 9;
+inline bool ConnectionResponseFrame::_internal_has_keep_alive_timeout_millis() const {
+  bool value = (_has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool ConnectionResponseFrame::has_keep_alive_timeout_millis() const {
+  return _internal_has_keep_alive_timeout_millis();
+}
+inline void ConnectionResponseFrame::clear_keep_alive_timeout_millis() {
+  keep_alive_timeout_millis_ = 0;
+  _has_bits_[0] &= ~0x00000100u;
+}
+inline int32_t ConnectionResponseFrame::_internal_keep_alive_timeout_millis() const {
+  return keep_alive_timeout_millis_;
+}
+inline int32_t ConnectionResponseFrame::keep_alive_timeout_millis() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionResponseFrame.keep_alive_timeout_millis)
+  return _internal_keep_alive_timeout_millis();
+}
+inline void ConnectionResponseFrame::_internal_set_keep_alive_timeout_millis(int32_t value) {
+  _has_bits_[0] |= 0x00000100u;
+  keep_alive_timeout_millis_ = value;
+}
+inline void ConnectionResponseFrame::set_keep_alive_timeout_millis(int32_t value) {
+  _internal_set_keep_alive_timeout_millis(value);
+  // @@protoc_insertion_point(field_set:location.nearby.connections.ConnectionResponseFrame.keep_alive_timeout_millis)
+}
+
+// optional bool supports_shared_key = 10;
+inline bool ConnectionResponseFrame::_internal_has_supports_shared_key() const {
+  bool value = (_has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool ConnectionResponseFrame::has_supports_shared_key() const {
+  return _internal_has_supports_shared_key();
+}
+inline void ConnectionResponseFrame::clear_supports_shared_key() {
+  supports_shared_key_ = false;
+  _has_bits_[0] &= ~0x00000200u;
+}
+inline bool ConnectionResponseFrame::_internal_supports_shared_key() const {
+  return supports_shared_key_;
+}
+inline bool ConnectionResponseFrame::supports_shared_key() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionResponseFrame.supports_shared_key)
+  return _internal_supports_shared_key();
+}
+inline void ConnectionResponseFrame::_internal_set_supports_shared_key(bool value) {
+  _has_bits_[0] |= 0x00000200u;
+  supports_shared_key_ = value;
+}
+inline void ConnectionResponseFrame::set_supports_shared_key(bool value) {
+  _internal_set_supports_shared_key(value);
+  // @@protoc_insertion_point(field_set:location.nearby.connections.ConnectionResponseFrame.supports_shared_key)
+}
+
+// optional bool supports_payload_header_elision = 11;
+inline bool ConnectionResponseFrame::_internal_has_supports_payload_header_elision() const {
+  bool value = (_has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool ConnectionResponseFrame::has_supports_payload_header_elision() const {
+  return _internal_has_supports_payload_header_elision();
+}
+inline void ConnectionResponseFrame::clear_supports_payload_header_elision() {
+  supports_payload_header_elision_ = false;
+  _has_bits_[0] &= ~0x00000400u;
+}
+inline bool ConnectionResponseFrame::_internal_supports_payload_header_elision() const {
+  return supports_payload_header_elision_;
+}
+inline bool ConnectionResponseFrame::supports_payload_header_elision() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionResponseFrame.supports_payload_header_elision)
+  return _internal_supports_payload_header_elision();
+}
+inline void ConnectionResponseFrame::_internal_set_supports_payload_header_elision(bool value) {
+  _has_bits_[0] |= 0x00000400u;
+  supports_payload_header_elision_ = value;
+}
+inline void ConnectionResponseFrame::set_supports_payload_header_elision(bool value) {
+  _internal_set_supports_payload_header_elision(value);
+  // @@protoc_insertion_point(field_set:location.nearby.connections.ConnectionResponseFrame.supports_payload_header_elision)
+}
+
+// optional bool supports_datagram = 12;
+inline bool ConnectionResponseFrame::_internal_has_supports_datagram() const {
+  bool value = (_has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool ConnectionResponseFrame::has_supports_datagram() const {
+  return _internal_has_supports_datagram();
+}
+inline void ConnectionResponseFrame::clear_supports_datagram() {
+  supports_datagram_ = false;
+  _has_bits_[0] &= ~0x00000800u;
+}
+inline bool ConnectionResponseFrame::_internal_supports_datagram() const {
+  return supports_datagram_;
+}
+inline bool ConnectionResponseFrame::supports_datagram() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.ConnectionResponseFrame.supports_datagram)
+  return _internal_supports_datagram();
+}
+inline void ConnectionResponseFrame::_internal_set_supports_datagram(bool value) {
+  _has_bits_[0] |= 0x00000800u;
+  supports_datagram_ = value;
+}
+inline void ConnectionResponseFrame::set_supports_datagram(bool value) {
+  _internal_set_supports_datagram(value);
+  // @@protoc_insertion_point(field_set:location.nearby.connections.ConnectionResponseFrame.supports_datagram)
+}
+
 // -------------------------------------------------------------------
 
 // PayloadTransferFrame_PayloadHeader
@@ -11119,6 +12380,34 @@ inline void PayloadTransferFrame_PayloadHeader::set_allocated_parent_folder(std:
   // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.PayloadTransferFrame.PayloadHeader.parent_folder)
 }
 
+// optional int64 sequence_number = 7;
+inline bool PayloadTransferFrame_PayloadHeader::_internal_has_sequence_number() const {
+  bool value = (_has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool PayloadTransferFrame_PayloadHeader::has_sequence_number() const {
+  return _internal_has_sequence_number();
+}
+inline void PayloadTransferFrame_PayloadHeader::clear_sequence_number() {
+  sequence_number_ = int64_t{0};
+  _has_bits_[0] &= ~0x00000040u;
+}
+inline int64_t PayloadTransferFrame_PayloadHeader::_internal_sequence_number() const {
+  return sequence_number_;
+}
+inline int64_t PayloadTransferFrame_PayloadHeader::sequence_number() const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.PayloadTransferFrame.PayloadHeader.sequence_number)
+  return _internal_sequence_number();
+}
+inline void PayloadTransferFrame_PayloadHeader::_internal_set_sequence_number(int64_t value) {
+  _has_bits_[0] |= 0x00000040u;
+  sequence_number_ = value;
+}
+inline void PayloadTransferFrame_PayloadHeader::set_sequence_number(int64_t value) {
+  _internal_set_sequence_number(value);
+  // @@protoc_insertion_point(field_set:location.nearby.connections.PayloadTransferFrame.PayloadHeader.sequence_number)
+}
+
 // -------------------------------------------------------------------
 
 // PayloadTransferFrame_PayloadChunk
@@ -14001,6 +15290,46 @@ inline void BandwidthUpgradeNegotiationFrame::set_allocated_safe_to_close_prior_
   // @@protoc_insertion_point(field_set_allocated:location.nearby.connections.BandwidthUpgradeNegotiationFrame.safe_to_close_prior_channel)
 }
 
+// repeated .location.nearby.connections.BandwidthUpgradeNegotiationFrame.UpgradePathInfo alternative_upgrade_path_infos = 6;
+inline int BandwidthUpgradeNegotiationFrame::_internal_alternative_upgrade_path_infos_size() const {
+  return alternative_upgrade_path_infos_.size();
+}
+inline int BandwidthUpgradeNegotiationFrame::alternative_upgrade_path_infos_size() const {
+  return _internal_alternative_upgrade_path_infos_size();
+}
+inline void BandwidthUpgradeNegotiationFrame::clear_alternative_upgrade_path_infos() {
+  alternative_upgrade_path_infos_.Clear();
+}
+inline ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo* BandwidthUpgradeNegotiationFrame::mutable_alternative_upgrade_path_infos(int index) {
+  // @@protoc_insertion_point(field_mutable:location.nearby.connections.BandwidthUpgradeNegotiationFrame.alternative_upgrade_path_infos)
+  return alternative_upgrade_path_infos_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo >*
+BandwidthUpgradeNegotiationFrame::mutable_alternative_upgrade_path_infos() {
+  // @@protoc_insertion_point(field_mutable_list:location.nearby.connections.BandwidthUpgradeNegotiationFrame.alternative_upgrade_path_infos)
+  return &alternative_upgrade_path_infos_;
+}
+inline const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo& BandwidthUpgradeNegotiationFrame::_internal_alternative_upgrade_path_infos(int index) const {
+  return alternative_upgrade_path_infos_.Get(index);
+}
+inline const ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo& BandwidthUpgradeNegotiationFrame::alternative_upgrade_path_infos(int index) const {
+  // @@protoc_insertion_point(field_get:location.nearby.connections.BandwidthUpgradeNegotiationFrame.alternative_upgrade_path_infos)
+  return _internal_alternative_upgrade_path_infos(index);
+}
+inline ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo* BandwidthUpgradeNegotiationFrame::_internal_add_alternative_upgrade_path_infos() {
+  return alternative_upgrade_path_infos_.Add();
+}
+inline ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo* BandwidthUpgradeNegotiationFrame::add_alternative_upgrade_path_infos() {
+  ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo* _add = _internal_add_alternative_upgrade_path_infos();
+  // @@protoc_insertion_point(field_add:location.nearby.connections.BandwidthUpgradeNegotiationFrame.alternative_upgrade_path_infos)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::location::nearby::connections::BandwidthUpgradeNegotiationFrame_UpgradePathInfo >&
+BandwidthUpgradeNegotiationFrame::alternative_upgrade_path_infos() const {
+  // @@protoc_insertion_point(field_list:location.nearby.connections.BandwidthUpgradeNegotiationFrame.alternative_upgrade_path_infos)
+  return alternative_upgrade_path_infos_;
+}
+
 // -------------------------------------------------------------------
 
 // BandwidthUpgradeRetryFrame
@@ -16487,6 +17816,10 @@ PresenceDevice::mutable_identity_type() {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -16500,6 +17833,7 @@ template <> struct is_proto_enum< ::location::nearby::connections::OfflineFrame_
 template <> struct is_proto_enum< ::location::nearby::connections::V1Frame_FrameType> : ::std::true_type {};
 template <> struct is_proto_enum< ::location::nearby::connections::ConnectionRequestFrame_Medium> : ::std::true_type {};
 template <> struct is_proto_enum< ::location::nearby::connections::ConnectionRequestFrame_ConnectionMode> : ::std::true_type {};
+template <> struct is_proto_enum< ::location::nearby::connections::SharedKeyFrame_FrameType> : ::std::true_type {};
 template <> struct is_proto_enum< ::location::nearby::connections::ConnectionResponseFrame_ResponseStatus> : ::std::true_type {};
 template <> struct is_proto_enum< ::location::nearby::connections::PayloadTransferFrame_PayloadHeader_PayloadType> : ::std::true_type {};
 template <> struct is_proto_enum< ::location::nearby::connections::PayloadTransferFrame_PayloadChunk_Flags> : ::std::true_type {};
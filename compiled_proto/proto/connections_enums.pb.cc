@@ -850,32 +850,36 @@ bool PayloadType_IsValid(int value) {
     case 1:
     case 2:
     case 3:
+    case 4:
       return true;
     default:
       return false;
   }
 }
 
-static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> PayloadType_strings[4] = {};
+static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> PayloadType_strings[5] = {};
 
 static const char PayloadType_names[] =
   "BYTES"
+  "DATAGRAM"
   "FILE"
   "STREAM"
   "UNKNOWN_PAYLOAD_TYPE";
 
 static const ::PROTOBUF_NAMESPACE_ID::internal::EnumEntry PayloadType_entries[] = {
   { {PayloadType_names + 0, 5}, 1 },
-  { {PayloadType_names + 5, 4}, 2 },
-  { {PayloadType_names + 9, 6}, 3 },
-  { {PayloadType_names + 15, 20}, 0 },
+  { {PayloadType_names + 5, 8}, 4 },
+  { {PayloadType_names + 13, 4}, 2 },
+  { {PayloadType_names + 17, 6}, 3 },
+  { {PayloadType_names + 23, 20}, 0 },
 };
 
 static const int PayloadType_entries_by_number[] = {
-  3, // 0 -> UNKNOWN_PAYLOAD_TYPE
+  4, // 0 -> UNKNOWN_PAYLOAD_TYPE
   0, // 1 -> BYTES
-  1, // 2 -> FILE
-  2, // 3 -> STREAM
+  2, // 2 -> FILE
+  3, // 3 -> STREAM
+  1, // 4 -> DATAGRAM
 };
 
 const std::string& PayloadType_Name(
@@ -884,12 +888,12 @@ const std::string& PayloadType_Name(
       ::PROTOBUF_NAMESPACE_ID::internal::InitializeEnumStrings(
           PayloadType_entries,
           PayloadType_entries_by_number,
-          4, PayloadType_strings);
+          5, PayloadType_strings);
   (void) dummy;
   int idx = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumName(
       PayloadType_entries,
       PayloadType_entries_by_number,
-      4, value);
+      5, value);
   return idx == -1 ? ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString() :
                      PayloadType_strings[idx].get();
 }
@@ -897,7 +901,7 @@ bool PayloadType_Parse(
     ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, PayloadType* value) {
   int int_value;
   bool success = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumValue(
-      PayloadType_entries, 4, name, &int_value);
+      PayloadType_entries, 5, name, &int_value);
   if (success) {
     *value = static_cast<PayloadType>(int_value);
   }
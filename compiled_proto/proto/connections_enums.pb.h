@@ -341,11 +341,12 @@ enum PayloadType : int {
   UNKNOWN_PAYLOAD_TYPE = 0,
   BYTES = 1,
   FILE = 2,
-  STREAM = 3
+  STREAM = 3,
+  DATAGRAM = 4
 };
 bool PayloadType_IsValid(int value);
 constexpr PayloadType PayloadType_MIN = UNKNOWN_PAYLOAD_TYPE;
-constexpr PayloadType PayloadType_MAX = STREAM;
+constexpr PayloadType PayloadType_MAX = DATAGRAM;
 constexpr int PayloadType_ARRAYSIZE = PayloadType_MAX + 1;
 
 const std::string& PayloadType_Name(PayloadType value);
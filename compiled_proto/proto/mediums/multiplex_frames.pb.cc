@@ -72,7 +72,7 @@ PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT ConnectionRequestFrameDefaultTy
 constexpr ConnectionResponseFrame::ConnectionResponseFrame(
   ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
   : connection_response_code_(0)
-{}
+  , buffers_early_data_(false){}
 struct ConnectionResponseFrameDefaultTypeInternal {
   constexpr ConnectionResponseFrameDefaultTypeInternal()
     : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
@@ -1522,6 +1522,9 @@ class ConnectionResponseFrame::_Internal {
   static void set_has_connection_response_code(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
+  static void set_has_buffers_early_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
 };
 
 ConnectionResponseFrame::ConnectionResponseFrame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
@@ -1537,12 +1540,17 @@ ConnectionResponseFrame::ConnectionResponseFrame(const ConnectionResponseFrame&
   : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
       _has_bits_(from._has_bits_) {
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
-  connection_response_code_ = from.connection_response_code_;
+  ::memcpy(&connection_response_code_, &from.connection_response_code_,
+    static_cast<size_t>(reinterpret_cast<char*>(&buffers_early_data_) -
+    reinterpret_cast<char*>(&connection_response_code_)) + sizeof(buffers_early_data_));
   // @@protoc_insertion_point(copy_constructor:location.nearby.mediums.ConnectionResponseFrame)
 }
 
 inline void ConnectionResponseFrame::SharedCtor() {
-connection_response_code_ = 0;
+::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+    reinterpret_cast<char*>(&connection_response_code_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&buffers_early_data_) -
+    reinterpret_cast<char*>(&connection_response_code_)) + sizeof(buffers_early_data_));
 }
 
 ConnectionResponseFrame::~ConnectionResponseFrame() {
@@ -1572,7 +1580,12 @@ void ConnectionResponseFrame::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  connection_response_code_ = 0;
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&connection_response_code_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&buffers_early_data_) -
+        reinterpret_cast<char*>(&connection_response_code_)) + sizeof(buffers_early_data_));
+  }
   _has_bits_.Clear();
   _internal_metadata_.Clear<std::string>();
 }
@@ -1597,6 +1610,15 @@ const char* ConnectionResponseFrame::_InternalParse(const char* ptr, ::PROTOBUF_
         } else
           goto handle_unusual;
         continue;
+      // optional bool buffers_early_data = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_buffers_early_data(&has_bits);
+          buffers_early_data_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1635,6 +1657,12 @@ uint8_t* ConnectionResponseFrame::_InternalSerialize(
       1, this->_internal_connection_response_code(), target);
   }
 
+  // optional bool buffers_early_data = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(2, this->_internal_buffers_early_data(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
         static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
@@ -1651,13 +1679,20 @@ size_t ConnectionResponseFrame::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // optional .location.nearby.mediums.ConnectionResponseFrame.ConnectionResponseCode connection_response_code = 1;
   cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_connection_response_code());
-  }
+  if (cached_has_bits & 0x00000003u) {
+    // optional .location.nearby.mediums.ConnectionResponseFrame.ConnectionResponseCode connection_response_code = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_connection_response_code());
+    }
+
+    // optional bool buffers_early_data = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 1;
+    }
 
+  }
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
   }
@@ -1678,8 +1713,15 @@ void ConnectionResponseFrame::MergeFrom(const ConnectionResponseFrame& from) {
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_connection_response_code()) {
-    _internal_set_connection_response_code(from._internal_connection_response_code());
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      connection_response_code_ = from.connection_response_code_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      buffers_early_data_ = from.buffers_early_data_;
+    }
+    _has_bits_[0] |= cached_has_bits;
   }
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
@@ -1699,7 +1741,12 @@ void ConnectionResponseFrame::InternalSwap(ConnectionResponseFrame* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_has_bits_[0], other->_has_bits_[0]);
-  swap(connection_response_code_, other->connection_response_code_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ConnectionResponseFrame, buffers_early_data_)
+      + sizeof(ConnectionResponseFrame::buffers_early_data_)
+      - PROTOBUF_FIELD_OFFSET(ConnectionResponseFrame, connection_response_code_)>(
+          reinterpret_cast<char*>(&connection_response_code_),
+          reinterpret_cast<char*>(&other->connection_response_code_));
 }
 
 std::string ConnectionResponseFrame::GetTypeName() const {
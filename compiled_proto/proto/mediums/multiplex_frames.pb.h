@@ -1089,6 +1089,7 @@ class ConnectionResponseFrame final :
 
   enum : int {
     kConnectionResponseCodeFieldNumber = 1,
+    kBuffersEarlyDataFieldNumber = 2,
   };
   // optional .location.nearby.mediums.ConnectionResponseFrame.ConnectionResponseCode connection_response_code = 1;
   bool has_connection_response_code() const;
@@ -1103,6 +1104,19 @@ class ConnectionResponseFrame final :
   void _internal_set_connection_response_code(::location::nearby::mediums::ConnectionResponseFrame_ConnectionResponseCode value);
   public:
 
+  // optional bool buffers_early_data = 2;
+  bool has_buffers_early_data() const;
+  private:
+  bool _internal_has_buffers_early_data() const;
+  public:
+  void clear_buffers_early_data();
+  bool buffers_early_data() const;
+  void set_buffers_early_data(bool value);
+  private:
+  bool _internal_buffers_early_data() const;
+  void _internal_set_buffers_early_data(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:location.nearby.mediums.ConnectionResponseFrame)
  private:
   class _Internal;
@@ -1113,6 +1127,7 @@ class ConnectionResponseFrame final :
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   int connection_response_code_;
+  bool buffers_early_data_;
   friend struct ::TableStruct_proto_2fmediums_2fmultiplex_5fframes_2eproto;
 };
 // -------------------------------------------------------------------
@@ -2116,6 +2131,34 @@ inline void ConnectionResponseFrame::set_connection_response_code(::location::ne
   // @@protoc_insertion_point(field_set:location.nearby.mediums.ConnectionResponseFrame.connection_response_code)
 }
 
+// optional bool buffers_early_data = 2;
+inline bool ConnectionResponseFrame::_internal_has_buffers_early_data() const {
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ConnectionResponseFrame::has_buffers_early_data() const {
+  return _internal_has_buffers_early_data();
+}
+inline void ConnectionResponseFrame::clear_buffers_early_data() {
+  buffers_early_data_ = false;
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline bool ConnectionResponseFrame::_internal_buffers_early_data() const {
+  return buffers_early_data_;
+}
+inline bool ConnectionResponseFrame::buffers_early_data() const {
+  // @@protoc_insertion_point(field_get:location.nearby.mediums.ConnectionResponseFrame.buffers_early_data)
+  return _internal_buffers_early_data();
+}
+inline void ConnectionResponseFrame::_internal_set_buffers_early_data(bool value) {
+  _has_bits_[0] |= 0x00000002u;
+  buffers_early_data_ = value;
+}
+inline void ConnectionResponseFrame::set_buffers_early_data(bool value) {
+  _internal_set_buffers_early_data(value);
+  // @@protoc_insertion_point(field_set:location.nearby.mediums.ConnectionResponseFrame.buffers_early_data)
+}
+
 // -------------------------------------------------------------------
 
 // DisconnectFrame
@@ -34,6 +34,10 @@ struct ConnectionInfo {
   std::vector<location::nearby::proto::connections::Medium> supported_mediums;
   std::int32_t keep_alive_interval_millis;
   std::int32_t keep_alive_timeout_millis;
+  // If set, the connection request offers to derive the connection's keys
+  // from this session shared with the remote device.
+  std::string shared_key_session_tag;
+  std::string shared_key_nonce;
 };
 
 // Connection Options: used for both Advertising and Discovery.
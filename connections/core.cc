@@ -33,6 +33,7 @@
 #include "connections/params.h"
 #include "connections/payload.h"
 #include "connections/payload_type.h"
+#include "connections/rate_limit.h"
 #include "connections/power_level.h"
 #include "connections/status.h"
 #include "connections/v3/advertising_options.h"
@@ -207,6 +208,23 @@ void Core::SetCustomSavePath(absl::string_view path, ResultCallback callback) {
   router_->SetCustomSavePath(&client_, path, std::move(callback));
 }
 
+void Core::SetRateLimit(RateLimit rate_limit, ResultCallback callback) {
+  router_->SetClientRateLimit(&client_, rate_limit, std::move(callback));
+}
+
+void Core::SetEndpointRateLimit(absl::string_view endpoint_id,
+                                RateLimit rate_limit,
+                                ResultCallback callback) {
+  router_->SetEndpointRateLimit(&client_, endpoint_id, rate_limit,
+                                std::move(callback));
+}
+
+void Core::SetPayloadRateLimit(std::int64_t payload_id, RateLimit rate_limit,
+                               ResultCallback callback) {
+  router_->SetPayloadRateLimit(&client_, payload_id, rate_limit,
+                               std::move(callback));
+}
+
 std::string Core::Dump() { return client_.Dump(); }
 
 // V3
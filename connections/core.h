@@ -33,6 +33,7 @@
 #include "connections/out_of_band_connection_metadata.h"
 #include "connections/params.h"
 #include "connections/payload.h"
+#include "connections/rate_limit.h"
 #include "connections/v3/advertising_options.h"
 #include "connections/v3/connection_listening_options.h"
 #include "connections/v3/connections_device_provider.h"
@@ -255,6 +256,24 @@ class Core {
   // path - The path where the received files will be saved to.
   void SetCustomSavePath(absl::string_view path, ResultCallback callback);
 
+  // Caps the rate at which this client sends payloads, in total. The cap can
+  // be changed at any time; an unlimited RateLimit removes it. See RateLimit.
+  void SetRateLimit(RateLimit rate_limit, ResultCallback callback);
+
+  // Caps the rate at which this client sends payloads to a connected
+  // endpoint, until it disconnects.
+  //
+  // endpoint_id - The identifier for the remote endpoint.
+  void SetEndpointRateLimit(absl::string_view endpoint_id,
+                            RateLimit rate_limit, ResultCallback callback);
+
+  // Caps the rate at which an outgoing payload is sent. Payload::SetRateLimit
+  // caps it from its first chunk instead.
+  //
+  // payload_id - The identifier for the payload being sent.
+  void SetPayloadRateLimit(std::int64_t payload_id, RateLimit rate_limit,
+                           ResultCallback callback);
+
   // Gets the local endpoint generated by Nearby Connections.
   std::string GetLocalEndpointId() { return client_.GetLocalEndpointId(); }
 
@@ -0,0 +1,181 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Parse and serialize cost of the advertisement codecs on the discovery hot
+// path.
+
+#include <list>
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "absl/status/statusor.h"
+#include "connections/implementation/ble_advertisement.h"
+#include "connections/implementation/bluetooth_device_name.h"
+#include "connections/implementation/mediums/ble_v2/ble_advertisement_header.h"
+#include "connections/implementation/mediums/ble_v2/ble_packet.h"
+#include "connections/implementation/mediums/ble_v2/instant_on_lost_advertisement.h"
+#include "connections/implementation/pcp.h"
+#include "connections/implementation/wifi_lan_service_info.h"
+#include "internal/platform/byte_array.h"
+#include "internal/platform/nsd_service_info.h"
+
+namespace nearby {
+namespace connections {
+namespace {
+
+constexpr char kServiceIdHashBytes[] = {0x0A, 0x0B, 0x0C};
+constexpr char kEndpointId[] = "AB12";
+constexpr char kEndpointName[] = "How much wood can a woodchuck chuck?";
+constexpr char kBluetoothMacAddress[] = "00:00:E6:88:64:13";
+constexpr char kFastEndpointName[] = "Fast Advertise";
+constexpr char kUwbAddress[] = {0x01, 0x02, 0x03, 0x04,
+                                0x05, 0x06, 0x07, 0x08};
+
+BleAdvertisement MakeBleAdvertisement() {
+  return BleAdvertisement(
+      BleAdvertisement::Version::kV1, Pcp::kP2pCluster,
+      ByteArray(kServiceIdHashBytes, sizeof(kServiceIdHashBytes)), kEndpointId,
+      ByteArray(std::string(kEndpointName)), kBluetoothMacAddress,
+      ByteArray(kUwbAddress, sizeof(kUwbAddress)), WebRtcState::kConnectable);
+}
+
+BleAdvertisement MakeFastBleAdvertisement() {
+  return BleAdvertisement(BleAdvertisement::Version::kV1, Pcp::kP2pCluster,
+                          kEndpointId,
+                          ByteArray(std::string(kFastEndpointName)),
+                          ByteArray());
+}
+
+void BM_BleAdvertisementParse(benchmark::State& state) {
+  ByteArray bytes(MakeBleAdvertisement());
+  for (auto _ : state) {
+    absl::StatusOr<BleAdvertisement> advertisement =
+        BleAdvertisement::CreateBleAdvertisement(/*fast_advertisement=*/false,
+                                                 bytes);
+    benchmark::DoNotOptimize(advertisement);
+  }
+  state.SetBytesProcessed(state.iterations() * bytes.size());
+}
+BENCHMARK(BM_BleAdvertisementParse);
+
+void BM_BleAdvertisementParseView(benchmark::State& state) {
+  ByteArray bytes(MakeBleAdvertisement());
+  for (auto _ : state) {
+    absl::StatusOr<BleAdvertisement::View> view =
+        BleAdvertisement::View::Parse(/*fast_advertisement=*/false,
+                                      bytes.AsStringView());
+    benchmark::DoNotOptimize(view);
+  }
+  state.SetBytesProcessed(state.iterations() * bytes.size());
+}
+BENCHMARK(BM_BleAdvertisementParseView);
+
+void BM_FastBleAdvertisementParseView(benchmark::State& state) {
+  ByteArray bytes(MakeFastBleAdvertisement());
+  for (auto _ : state) {
+    absl::StatusOr<BleAdvertisement::View> view =
+        BleAdvertisement::View::Parse(/*fast_advertisement=*/true,
+                                      bytes.AsStringView());
+    benchmark::DoNotOptimize(view);
+  }
+  state.SetBytesProcessed(state.iterations() * bytes.size());
+}
+BENCHMARK(BM_FastBleAdvertisementParseView);
+
+void BM_BleAdvertisementSerialize(benchmark::State& state) {
+  BleAdvertisement advertisement = MakeBleAdvertisement();
+  for (auto _ : state) {
+    ByteArray bytes(advertisement);
+    benchmark::DoNotOptimize(bytes);
+  }
+}
+BENCHMARK(BM_BleAdvertisementSerialize);
+
+void BM_BleAdvertisementHeaderParse(benchmark::State& state) {
+  ByteArray bytes(mediums::BleAdvertisementHeader(
+      mediums::BleAdvertisementHeader::Version::kV2,
+      /*support_extended_advertisement=*/false, /*num_slots=*/2,
+      ByteArray(std::string(
+          mediums::BleAdvertisementHeader::kServiceIdBloomFilterByteLength,
+          'b')),
+      ByteArray(std::string(
+          mediums::BleAdvertisementHeader::kAdvertisementHashByteLength, 'h')),
+      /*psm=*/127));
+  for (auto _ : state) {
+    mediums::BleAdvertisementHeader header(bytes);
+    benchmark::DoNotOptimize(header);
+  }
+}
+BENCHMARK(BM_BleAdvertisementHeaderParse);
+
+void BM_BlePacketRoundTrip(benchmark::State& state) {
+  ByteArray data(std::string(state.range(0), 'd'));
+  absl::StatusOr<mediums::BlePacket> packet =
+      mediums::BlePacket::CreateDataPacket(
+          ByteArray(kServiceIdHashBytes, sizeof(kServiceIdHashBytes)), data);
+  ByteArray bytes(*packet);
+  for (auto _ : state) {
+    mediums::BlePacket parsed(bytes);
+    ByteArray serialized(parsed);
+    benchmark::DoNotOptimize(serialized);
+  }
+  state.SetBytesProcessed(state.iterations() * bytes.size());
+}
+BENCHMARK(BM_BlePacketRoundTrip)->Arg(20)->Arg(512);
+
+void BM_BluetoothDeviceNameRoundTrip(benchmark::State& state) {
+  std::string name(BluetoothDeviceName(
+      BluetoothDeviceName::Version::kV1, Pcp::kP2pCluster, kEndpointId,
+      ByteArray(kServiceIdHashBytes, sizeof(kServiceIdHashBytes)),
+      ByteArray(std::string(kEndpointName)),
+      ByteArray(kUwbAddress, sizeof(kUwbAddress)), WebRtcState::kConnectable));
+  for (auto _ : state) {
+    BluetoothDeviceName parsed(name);
+    std::string serialized(parsed);
+    benchmark::DoNotOptimize(serialized);
+  }
+}
+BENCHMARK(BM_BluetoothDeviceNameRoundTrip);
+
+void BM_WifiLanServiceInfoRoundTrip(benchmark::State& state) {
+  NsdServiceInfo nsd_service_info(WifiLanServiceInfo(
+      WifiLanServiceInfo::Version::kV1, Pcp::kP2pCluster, kEndpointId,
+      ByteArray(kServiceIdHashBytes, sizeof(kServiceIdHashBytes)),
+      ByteArray(std::string(kEndpointName)),
+      ByteArray(kUwbAddress, sizeof(kUwbAddress)), WebRtcState::kConnectable));
+  for (auto _ : state) {
+    WifiLanServiceInfo parsed(nsd_service_info);
+    NsdServiceInfo serialized(parsed);
+    benchmark::DoNotOptimize(serialized);
+  }
+}
+BENCHMARK(BM_WifiLanServiceInfoRoundTrip);
+
+void BM_InstantOnLostAdvertisementRoundTrip(benchmark::State& state) {
+  std::list<std::string> hashes(
+      mediums::InstantOnLostAdvertisement::kMaxHashCount, "hash");
+  std::string bytes =
+      mediums::InstantOnLostAdvertisement::CreateFromHashes(hashes)->ToBytes();
+  for (auto _ : state) {
+    absl::StatusOr<mediums::InstantOnLostAdvertisement> parsed =
+        mediums::InstantOnLostAdvertisement::CreateFromBytes(bytes);
+    std::string serialized = parsed->ToBytes();
+    benchmark::DoNotOptimize(serialized);
+  }
+}
+BENCHMARK(BM_InstantOnLostAdvertisementRoundTrip);
+
+}  // namespace
+}  // namespace connections
+}  // namespace nearby
@@ -66,6 +66,7 @@ using ::location::nearby::proto::connections::ConnectionBand;
 using ::location::nearby::proto::connections::ConnectionRequestResponse;
 using ::location::nearby::proto::connections::ConnectionsStrategy;
 using ::location::nearby::proto::connections::ConnectionTechnology;
+using ::location::nearby::proto::connections::DATAGRAM;
 using ::location::nearby::proto::connections::DisconnectionReason;
 using ::location::nearby::proto::connections::DISCOVERER;
 using ::location::nearby::proto::connections::ERROR_CODE;
@@ -1434,6 +1435,8 @@ PayloadType AnalyticsRecorder::PayloadTypeToProtoPayloadType(
       return FILE;
     case connections::PayloadType::kStream:
       return STREAM;
+    case connections::PayloadType::kDatagram:
+      return DATAGRAM;
     default:
       return UNKNOWN_PAYLOAD_TYPE;
   }
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -49,6 +50,7 @@
 #include "connections/implementation/offline_frames.h"
 #include "connections/implementation/pcp.h"
 #include "connections/implementation/proto/offline_wire_formats.pb.h"
+#include "connections/implementation/shared_key_hub.h"
 #include "connections/listeners.h"
 #include "connections/medium_selector.h"
 #include "connections/out_of_band_connection_metadata.h"
@@ -545,6 +547,23 @@ EncryptionRunner::ResultListener BasePcpHandler::GetResultListener() {
                       auth_token, raw_auth_token);
                 });
           },
+      .on_shared_key_success_cb =
+          [this](const std::string& endpoint_id,
+                 std::unique_ptr<EndpointChannel::EncryptionContext> context,
+                 const std::string& auth_token,
+                 const ByteArray& raw_auth_token) {
+            RunOnPcpHandlerThread(
+                "encryption-success",
+                [this, endpoint_id, raw_context = context.release(),
+                 auth_token,
+                 raw_auth_token]() RUN_ON_PCP_HANDLER_THREAD() mutable {
+                  OnSharedKeySuccessRunnable(
+                      endpoint_id,
+                      std::unique_ptr<EndpointChannel::EncryptionContext>(
+                          raw_context),
+                      auth_token, raw_auth_token);
+                });
+          },
       .on_failure_cb =
           [this](const std::string& endpoint_id, EndpointChannel* channel) {
             RunOnPcpHandlerThread(
@@ -700,6 +719,40 @@ void BasePcpHandler::OnEncryptionSuccessRunnable(
       /*connection_info=*/connection_info);
 }
 
+void BasePcpHandler::OnSharedKeySuccessRunnable(
+    const std::string& endpoint_id,
+    std::unique_ptr<EndpointChannel::EncryptionContext> context,
+    const std::string& auth_token, const ByteArray& raw_auth_token) {
+  auto it = pending_connections_.find(endpoint_id);
+  if (it == pending_connections_.end()) {
+    NEARBY_LOGS(INFO)
+        << "Connection not found on shared key derivation complete; "
+           "endpoint_id="
+        << endpoint_id;
+    return;
+  }
+
+  BasePcpHandler::PendingConnectionInfo& connection_info = it->second;
+
+  if (!context) {
+    ProcessPreConnectionInitiationFailure(
+        connection_info.client, connection_info.medium, endpoint_id,
+        connection_info.channel.get(), connection_info.is_incoming,
+        connection_info.start_time, {Status::kEndpointIoError},
+        OperationResultCode::NEARBY_AUTHENTICATION_FAILURE,
+        connection_info.result.lock().get());
+    return;
+  }
+
+  NEARBY_LOGS(INFO) << "Derived keys from a shared session; endpoint_id="
+                    << endpoint_id;
+  connection_info.shared_key_context = std::move(context);
+  RegisterDeviceAfterEncryptionSuccess(
+      /*endpoint_id=*/endpoint_id, /*ukey2=*/nullptr,
+      /*auth_token=*/auth_token, /*raw_auth_token=*/raw_auth_token,
+      /*connection_info=*/connection_info);
+}
+
 void BasePcpHandler::RegisterDeviceAfterEncryptionSuccess(
     std::string_view endpoint_id, std::unique_ptr<UKey2Handshake> ukey2,
     std::string_view auth_token, const ByteArray& raw_auth_token,
@@ -878,6 +931,17 @@ Status BasePcpHandler::RequestConnection(
         ConnectionInfo connection_info =
             FillConnectionInfo(client, info, connection_options);
 
+        // Offer to derive the keys from a session with the same device, if
+        // an earlier connection established one.
+        std::optional<SharedKey> shared_key;
+        if (FeatureFlags::GetInstance().GetFlags().enable_shared_key_hub) {
+          shared_key = client->GetSharedKeyHub().CreateOffer(endpoint->endpoint_info);
+        }
+        if (shared_key.has_value()) {
+          connection_info.shared_key_session_tag = shared_key->session_tag;
+          connection_info.shared_key_nonce = shared_key->client_nonce;
+        }
+
         const NearbyDevice* local_device = client->GetLocalDevice();
         Exception write_exception = WriteConnectionRequestFrame(
             local_device->GetType(), local_device->ToProtoBytes(),
@@ -927,8 +991,14 @@ Status BasePcpHandler::RequestConnection(
                           << endpoint_id;
         // Next, we'll set up encryption. When it's done, our future will return
         // and RequestConnection() will finish.
-        encryption_runner_.StartClient(client, endpoint_id, endpoint_channel,
-                                       GetResultListener());
+        if (shared_key.has_value()) {
+          encryption_runner_.StartSharedKeyClient(
+              client, endpoint_id, endpoint_channel, *std::move(shared_key),
+              GetResultListener());
+        } else {
+          encryption_runner_.StartClient(client, endpoint_id, endpoint_channel,
+                                         GetResultListener());
+        }
       });
   NEARBY_LOGS(INFO) << "Waiting for connection to complete: endpoint_id="
                     << endpoint_id;
@@ -1573,6 +1643,14 @@ void BasePcpHandler::OnIncomingFrame(
               endpoint_id, connection_response.multiplex_socket_bitmask());
         }
 
+        if (connection_response.supports_payload_header_elision()) {
+          client->SetRemoteSupportsPayloadHeaderElision(endpoint_id);
+        }
+
+        if (connection_response.supports_datagram()) {
+          client->SetRemoteSupportsDatagram(endpoint_id);
+        }
+
         if (connection_response.has_safe_to_disconnect_version()) {
           NEARBY_LOGS(INFO)
               << "[safe-to-disconnect]: endpoint_id=" << endpoint_id
@@ -1583,6 +1661,12 @@ void BasePcpHandler::OnIncomingFrame(
         }
         channel_manager_->UpdateSafeToDisconnectForEndpoint(
             endpoint_id, client->IsSafeToDisconnectEnabled(endpoint_id));
+        if (connection_response.supports_shared_key()) {
+          auto it = pending_connections_.find(endpoint_id);
+          if (it != pending_connections_.end()) {
+            it->second.remote_supports_shared_key = true;
+          }
+        }
         EvaluateConnectionResult(client, endpoint_id,
                                  /* can_close_immediately= */ true);
 
@@ -2011,9 +2095,23 @@ Exception BasePcpHandler::OnIncomingConnection(
                                      std::move(pendingConnectionInfo))
                             .first->second.channel.get();
 
-  // Next, we'll set up encryption.
-  encryption_runner_.StartServer(client, connection_request.endpoint_id(),
-                                 owned_channel, GetResultListener());
+  // Next, we'll set up encryption. The initiator waits for an answer to a
+  // shared key offer, so the offer is declined rather than ignored when the
+  // session is unknown or the feature was disabled since.
+  if (connection_request.has_shared_key_offer()) {
+    std::optional<SharedKey> shared_key;
+    if (FeatureFlags::GetInstance().GetFlags().enable_shared_key_hub) {
+      shared_key = client->GetSharedKeyHub().AcceptOffer(
+          connection_request.shared_key_offer().session_tag(),
+          connection_request.shared_key_offer().nonce());
+    }
+    encryption_runner_.StartSharedKeyServer(
+        client, connection_request.endpoint_id(), owned_channel,
+        std::move(shared_key), GetResultListener());
+  } else {
+    encryption_runner_.StartServer(client, connection_request.endpoint_id(),
+                                   owned_channel, GetResultListener());
+  }
   return {Exception::kSuccess};
 }
 
@@ -2249,12 +2347,25 @@ void BasePcpHandler::EvaluateConnectionResult(ClientProxy* client,
     // channels
     // Now, after both parties accepted connection (presumably after verifying &
     // matching security tokens), we are allowed to extract the shared key.
-    auto ukey2 = std::move(connection_info.ukey2);
-    bool succeeded = ukey2->VerifyHandshake();
-    CHECK(succeeded);  // If this fails, it's a UKEY2 protocol bug.
-    auto context = ukey2->ToConnectionContext();
-    CHECK(context);  // there is no way how this can fail, if Verify succeeded.
-    // If it did, it's a UKEY2 protocol bug.
+    std::unique_ptr<EndpointChannel::EncryptionContext> context;
+    if (connection_info.shared_key_context != nullptr) {
+      context = std::move(connection_info.shared_key_context);
+    } else {
+      auto ukey2 = std::move(connection_info.ukey2);
+      bool succeeded = ukey2->VerifyHandshake();
+      CHECK(succeeded);  // If this fails, it's a UKEY2 protocol bug.
+      context = ukey2->ToConnectionContext();
+      CHECK(context);  // there is no way how this can fail, if Verify
+      // succeeded. If it did, it's a UKEY2 protocol bug.
+
+      // Both sides accepted, so later connections to this device may derive
+      // their keys from this session.
+      if (connection_info.remote_supports_shared_key &&
+          FeatureFlags::GetInstance().GetFlags().enable_shared_key_hub) {
+        client->GetSharedKeyHub().AddSession(
+            connection_info.remote_endpoint_info, *context);
+      }
+    }
 
     if (!channel_manager_->EncryptChannelForEndpoint(endpoint_id,
                                                      std::move(context))) {
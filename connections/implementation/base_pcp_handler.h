@@ -495,6 +495,14 @@ class BasePcpHandler : public PcpHandler,
     // switching to connected state, where Payload may be exchanged.
     std::unique_ptr<securegcm::UKey2Handshake> ukey2;
 
+    // Set instead of |ukey2| when the keys of the connection were derived from
+    // a session shared with the remote device.
+    std::unique_ptr<EndpointChannel::EncryptionContext> shared_key_context;
+
+    // Whether the remote device's connection response said that it supports
+    // shared keys, so the session of this connection may be shared.
+    bool remote_supports_shared_key = false;
+
     // Used in AnalyticsRecorder for devices connection tracking.
     std::string connection_token;
 
@@ -530,6 +538,10 @@ class BasePcpHandler : public PcpHandler,
       absl::string_view auth_token, const ByteArray& raw_auth_token,
       const EndpointChannel& endpoint_channel,
       const NearbyDeviceProvider& device_provider);
+  void OnSharedKeySuccessRunnable(
+      const std::string& endpoint_id,
+      std::unique_ptr<EndpointChannel::EncryptionContext> context,
+      const std::string& auth_token, const ByteArray& raw_auth_token);
   void OnEncryptionFailureRunnable(const std::string& endpoint_id,
                                    EndpointChannel* endpoint_channel);
   void RegisterDeviceAfterEncryptionSuccess(
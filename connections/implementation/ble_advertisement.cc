@@ -16,16 +16,21 @@
 
 #include <inttypes.h>
 
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
-#include "absl/strings/escaping.h"
 #include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 #include "connections/implementation/base_pcp_handler.h"
 #include "connections/implementation/pcp.h"
-#include "internal/platform/base_input_stream.h"
 #include "internal/platform/bluetooth_utils.h"
 #include "internal/platform/byte_array.h"
-#include "internal/platform/logging.h"
+#include "internal/platform/byte_span_reader.h"
+#include "internal/platform/byte_span_writer.h"
 
 namespace nearby {
 namespace connections {
@@ -93,9 +98,9 @@ void BleAdvertisement::DoInitialize(bool fast_advertisement, Version version,
   }
 }
 
-absl::StatusOr<BleAdvertisement> BleAdvertisement::CreateBleAdvertisement(
-    bool fast_advertisement, const ByteArray& ble_advertisement_bytes) {
-  if (ble_advertisement_bytes.Empty()) {
+absl::StatusOr<BleAdvertisement::View> BleAdvertisement::View::Parse(
+    bool fast_advertisement, absl::string_view ble_advertisement_bytes) {
+  if (ble_advertisement_bytes.empty()) {
     return absl::InvalidArgumentError(
         "Cannot deserialize BleAdvertisement: null bytes passed in.");
   }
@@ -111,92 +116,90 @@ absl::StatusOr<BleAdvertisement> BleAdvertisement::CreateBleAdvertisement(
                      ble_advertisement_bytes.size()));
   }
 
-  ByteArray advertisement_bytes{ble_advertisement_bytes};
-  BaseInputStream base_input_stream{advertisement_bytes};
+  ByteSpanReader reader{ble_advertisement_bytes};
+  View view;
+  view.fast_advertisement_ = fast_advertisement;
   // The first 1 byte is supposed to be the version and pcp.
-  auto version_and_pcp_byte = static_cast<char>(base_input_stream.ReadUint8());
+  auto version_and_pcp_byte = static_cast<char>(*reader.ReadUint8());
   // The upper 3 bits are supposed to be the version.
-  Version version =
+  view.version_ =
       static_cast<Version>((version_and_pcp_byte & kVersionBitmask) >> 5);
-  if (version != Version::kV1) {
+  if (view.version_ != Version::kV1) {
     return absl::InvalidArgumentError(absl::StrCat(
-        "Cannot deserialize BleAdvertisement: unsupported Version: ", version));
+        "Cannot deserialize BleAdvertisement: unsupported Version: ",
+        view.version_));
   }
 
   // The lower 5 bits are supposed to be the Pcp.
-  Pcp pcp = static_cast<Pcp>(version_and_pcp_byte & kPcpBitmask);
-  switch (pcp) {
+  view.pcp_ = static_cast<Pcp>(version_and_pcp_byte & kPcpBitmask);
+  switch (view.pcp_) {
     case Pcp::kP2pCluster:  // Fall through
     case Pcp::kP2pStar:     // Fall through
     case Pcp::kP2pPointToPoint:
       break;
     default:
       return absl::InvalidArgumentError(absl::StrCat(
-          "Cannot deserialize BleAdvertisement: unsupported V1 PCP ", pcp));
+          "Cannot deserialize BleAdvertisement: unsupported V1 PCP ",
+          view.pcp_));
   }
 
   // The next 3 bytes are supposed to be the service_id_hash if not fast
   // advertisement.
-  ByteArray service_id_hash;
   if (!fast_advertisement) {
-    service_id_hash = base_input_stream.ReadBytes(kServiceIdHashLength);
+    view.service_id_hash_ = *reader.ReadBytes(kServiceIdHashLength);
   }
 
   // The next 4 bytes are supposed to be the endpoint_id.
-  std::string endpoint_id =
-      std::string{base_input_stream.ReadBytes(kEndpointIdLength)};
+  view.endpoint_id_ = *reader.ReadBytes(kEndpointIdLength);
 
   // The next 1 byte is supposed to be the length of the endpoint_info.
-  auto expected_endpoint_info_length = base_input_stream.ReadUint8();
+  std::uint8_t expected_endpoint_info_length = *reader.ReadUint8();
 
   // The next x bytes are the endpoint info. (Max length is 131 bytes or 17
   // bytes as fast_advertisement being true).
-  auto endpoint_info =
-      base_input_stream.ReadBytes(expected_endpoint_info_length);
+  view.endpoint_info_ =
+      reader.ReadBytes(expected_endpoint_info_length).value_or("");
   const int max_endpoint_info_length =
       fast_advertisement ? kMaxFastEndpointInfoLength : kMaxEndpointInfoLength;
-  if (endpoint_info.Empty() ||
-      endpoint_info.size() != expected_endpoint_info_length ||
-      endpoint_info.size() > max_endpoint_info_length) {
+  if (view.endpoint_info_.empty() ||
+      view.endpoint_info_.size() != expected_endpoint_info_length ||
+      view.endpoint_info_.size() > max_endpoint_info_length) {
     return absl::InvalidArgumentError(absl::StrCat(
         "Cannot deserialize BleAdvertisement(fast advertisement=",
         fast_advertisement, "): expected endpointInfo to be ",
-        expected_endpoint_info_length, " bytes, got ", endpoint_info.size()));
+        expected_endpoint_info_length, " bytes, got ",
+        view.endpoint_info_.size()));
   }
 
   // The next 6 bytes are the bluetooth mac address if not fast advertisement.
-  std::string bluetooth_mac_address;
   if (!fast_advertisement) {
-    auto bluetooth_mac_address_bytes =
-        base_input_stream.ReadBytes(BluetoothUtils::kBluetoothMacAddressLength);
-    bluetooth_mac_address =
-        BluetoothUtils::ToString(bluetooth_mac_address_bytes);
+    view.bluetooth_mac_address_ =
+        reader.ReadBytes(BluetoothUtils::kBluetoothMacAddressLength)
+            .value_or("");
   }
 
   // The next 1 byte is supposed to be the length of the uwb_address. If the
   // next byte is not available then it should be a fast advertisement and skip
   // it for remaining bytes.
-  ByteArray uwb_address;
-  BleAdvertisement ble_advertisement;
-  if (base_input_stream.IsAvailable(1)) {
-    auto expected_uwb_address_length = base_input_stream.ReadUint8();
+  if (reader.IsAvailable(1)) {
+    std::uint8_t expected_uwb_address_length = *reader.ReadUint8();
     // If the length of uwb_address is not zero, then retrieve it.
     if (expected_uwb_address_length != 0) {
-      uwb_address = base_input_stream.ReadBytes(expected_uwb_address_length);
-      if (uwb_address.Empty() ||
-          uwb_address.size() != expected_uwb_address_length) {
+      auto uwb_address = reader.ReadBytes(expected_uwb_address_length);
+      if (!uwb_address.has_value()) {
         return absl::InvalidArgumentError(absl::StrCat(
             "Cannot deserialize BleAdvertisement: expected uwbAddress size to "
             "be ",
-            expected_uwb_address_length, " bytes, got ", uwb_address.size()));
+            expected_uwb_address_length, " bytes, got ", reader.remaining()));
       }
+      view.uwb_address_ = *uwb_address;
     }
 
     // The next 1 byte is extra field.
     if (!fast_advertisement) {
-      if (base_input_stream.IsAvailable(kExtraFieldLength)) {
-        auto extra_field = static_cast<char>(base_input_stream.ReadUint8());
-        ble_advertisement.web_rtc_state_ =
+      if (reader.IsAvailable(kExtraFieldLength)) {
+        auto extra_field = static_cast<char>(*reader.ReadUint8());
+        view.web_rtc_state_ =
             (extra_field & kWebRtcConnectableFlagBitmask) == 1
                 ? WebRtcState::kConnectable
                 : WebRtcState::kUnconnectable;
@@ -204,17 +207,48 @@ absl::StatusOr<BleAdvertisement> BleAdvertisement::CreateBleAdvertisement(
     }
   }
 
-  base_input_stream.Close();
-
-  ble_advertisement.fast_advertisement_ = fast_advertisement;
-  ble_advertisement.version_ = version;
-  ble_advertisement.pcp_ = pcp;
-  ble_advertisement.service_id_hash_ = service_id_hash;
-  ble_advertisement.endpoint_id_ = endpoint_id;
-  ble_advertisement.endpoint_info_ = endpoint_info;
-  ble_advertisement.bluetooth_mac_address_ = bluetooth_mac_address;
-  ble_advertisement.uwb_address_ = uwb_address;
-  return ble_advertisement;
+  return view;
+}
+
+BleAdvertisement::BleAdvertisement(const View& view)
+    : fast_advertisement_(view.IsFastAdvertisement()),
+      version_(view.GetVersion()),
+      pcp_(view.GetPcp()),
+      service_id_hash_(std::string(view.GetServiceIdHash())),
+      endpoint_id_(view.GetEndpointId()),
+      endpoint_info_(std::string(view.GetEndpointInfo())),
+      uwb_address_(std::string(view.GetUwbAddress())),
+      web_rtc_state_(view.GetWebRtcState()) {
+  if (!fast_advertisement_) {
+    bluetooth_mac_address_ = BluetoothUtils::ToString(
+        ByteArray(std::string(view.GetBluetoothMacAddressBytes())));
+  }
+}
+
+absl::StatusOr<BleAdvertisement> BleAdvertisement::CreateBleAdvertisement(
+    bool fast_advertisement, const ByteArray& ble_advertisement_bytes) {
+  absl::StatusOr<View> view = View::Parse(
+      fast_advertisement, ble_advertisement_bytes.AsStringView());
+  if (!view.ok()) {
+    return view.status();
+  }
+  return BleAdvertisement(*view);
+}
+
+size_t BleAdvertisement::GetSerializedSize() const {
+  if (!IsValid()) {
+    return 0;
+  }
+
+  size_t size = kVersionAndPcpLength + endpoint_id_.size() +
+                kEndpointInfoSizeLength + endpoint_info_.size();
+  if (!fast_advertisement_) {
+    size += service_id_hash_.size() + kBluetoothMacAddressLength +
+            kUwbAddressSizeLength + uwb_address_.size() + kExtraFieldLength;
+  } else if (!uwb_address_.Empty()) {
+    size += kUwbAddressSizeLength + uwb_address_.size();
+  }
+  return size;
 }
 
 BleAdvertisement::operator ByteArray() const {
@@ -222,51 +256,44 @@ BleAdvertisement::operator ByteArray() const {
     return ByteArray();
   }
 
+  ByteArray out(GetSerializedSize());
+  ByteSpanWriter writer{absl::MakeSpan(out.data(), out.size())};
+
   // The first 3 bits are the Version.
   char version_and_pcp_byte =
       (static_cast<char>(version_) << 5) & kVersionBitmask;
   // The next 5 bits are the Pcp.
   version_and_pcp_byte |= static_cast<char>(pcp_) & kPcpBitmask;
+  writer.WriteUint8(version_and_pcp_byte);
 
-  std::string out;
-  if (fast_advertisement_) {
-    // clang-format off
-    out = absl::StrCat(std::string(1, version_and_pcp_byte),
-                       endpoint_id_,
-                       std::string(1, endpoint_info_.size()),
-                       std::string(endpoint_info_));
-    // clang-format on
-  } else {
-    // clang-format off
-    out = absl::StrCat(std::string(1, version_and_pcp_byte),
-                       std::string(service_id_hash_),
-                       endpoint_id_,
-                       std::string(1, endpoint_info_.size()),
-                       std::string(endpoint_info_));
-    // clang-format on
+  if (!fast_advertisement_) {
+    writer.WriteBytes(service_id_hash_.AsStringView());
+  }
+  writer.WriteBytes(endpoint_id_);
+  writer.WriteUint8(endpoint_info_.size());
+  writer.WriteBytes(endpoint_info_.AsStringView());
 
+  if (!fast_advertisement_) {
     // The next 6 bytes are the bluetooth mac address. If bluetooth_mac_address
     // is invalid or empty, we get back an empty byte array.
     auto bluetooth_mac_address_bytes{
         BluetoothUtils::FromString(bluetooth_mac_address_)};
     if (!bluetooth_mac_address_bytes.Empty()) {
-      absl::StrAppend(&out, std::string(bluetooth_mac_address_bytes));
+      writer.WriteBytes(bluetooth_mac_address_bytes.AsStringView());
     } else {
       // If bluetooth MAC address is invalid, then reserve the bytes.
-      auto fake_bt_mac_address_bytes =
-          ByteArray(BluetoothUtils::kBluetoothMacAddressLength);
-      absl::StrAppend(&out, std::string(fake_bt_mac_address_bytes));
+      writer.WriteZeros(BluetoothUtils::kBluetoothMacAddressLength);
     }
   }
 
   // The next bytes are UWB address field.
   if (!uwb_address_.Empty()) {
-    absl::StrAppend(&out, std::string(1, uwb_address_.size()));
-    absl::StrAppend(&out, std::string(uwb_address_));
+    writer.WriteUint8(uwb_address_.size());
+    writer.WriteBytes(uwb_address_.AsStringView());
   } else if (!fast_advertisement_) {
     // Write UWB address with length 0 to be able to read the next field when
     // decode.
-    absl::StrAppend(&out, std::string(1, uwb_address_.size()));
+    writer.WriteUint8(0);
   }
 
   // The next 1 byte is extra field.
@@ -275,10 +302,13 @@ BleAdvertisement::operator ByteArray() const {
         (web_rtc_state_ == WebRtcState::kConnectable) ? 1 : 0;
     char extra_field_byte = static_cast<char>(web_rtc_connectable_flag) &
                             kWebRtcConnectableFlagBitmask;
-    absl::StrAppend(&out, std::string(1, extra_field_byte));
+    writer.WriteUint8(extra_field_byte);
   }
 
-  return ByteArray(std::move(out));
+  if (writer.overflowed() || writer.size() != out.size()) {
+    return ByteArray();
+  }
+  return out;
 }
 
 }  // namespace connections
@@ -15,7 +15,10 @@
 #ifndef CORE_INTERNAL_BLE_ADVERTISEMENT_H_
 #define CORE_INTERNAL_BLE_ADVERTISEMENT_H_
 
+#include <string>
+
 #include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
 #include "connections/implementation/base_pcp_handler.h"
 #include "connections/implementation/pcp.h"
 #include "internal/platform/bluetooth_utils.h"
@@ -69,7 +72,43 @@ class BleAdvertisement {
   static constexpr int kMaxEndpointInfoLength = 131;
   static constexpr int kMaxFastEndpointInfoLength = 17;
 
+  // A non-owning view of a serialized BleAdvertisement. Fields point into the
+  // buffer passed to Parse(), which must outlive the View. Scan results can be
+  // parsed and filtered through a View, and only the ones worth keeping are
+  // copied into a BleAdvertisement.
+  class View {
+   public:
+    static absl::StatusOr<View> Parse(
+        bool fast_advertisement, absl::string_view ble_advertisement_bytes);
+
+    bool IsFastAdvertisement() const { return fast_advertisement_; }
+    Version GetVersion() const { return version_; }
+    Pcp GetPcp() const { return pcp_; }
+    absl::string_view GetServiceIdHash() const { return service_id_hash_; }
+    absl::string_view GetEndpointId() const { return endpoint_id_; }
+    absl::string_view GetEndpointInfo() const { return endpoint_info_; }
+    // Raw 6-byte address; empty if the advertisement doesn't carry one.
+    absl::string_view GetBluetoothMacAddressBytes() const {
+      return bluetooth_mac_address_;
+    }
+    absl::string_view GetUwbAddress() const { return uwb_address_; }
+    WebRtcState GetWebRtcState() const { return web_rtc_state_; }
+
+   private:
+    bool fast_advertisement_ = false;
+    Version version_{Version::kUndefined};
+    Pcp pcp_{Pcp::kUnknown};
+    absl::string_view service_id_hash_;
+    absl::string_view endpoint_id_;
+    absl::string_view endpoint_info_;
+    absl::string_view bluetooth_mac_address_;
+    absl::string_view uwb_address_;
+    WebRtcState web_rtc_state_{WebRtcState::kUndefined};
+  };
+
   BleAdvertisement() = default;
+  // Takes an owned copy of `view`.
+  explicit BleAdvertisement(const View& view);
   BleAdvertisement(Version version, Pcp pcp, const std::string& endpoint_id,
                    const ByteArray& endpoint_info,
                    const ByteArray& uwb_address);
@@ -88,6 +127,9 @@ class BleAdvertisement {
 
   explicit operator ByteArray() const;
 
+  // Returns the number of bytes operator ByteArray() produces.
+  size_t GetSerializedSize() const;
+
   bool IsValid() const { return !endpoint_id_.empty(); }
   bool IsFastAdvertisement() const { return fast_advertisement_; }
   Version GetVersion() const { return version_; }
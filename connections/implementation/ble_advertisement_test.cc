@@ -440,6 +440,29 @@ TEST(BleAdvertisementTest,
               StatusIs(kInvalidArgument));
 }
 
+TEST(BleAdvertisementTest, ViewParsesWithoutCopying) {
+  ByteArray service_id_hash{std::string(kServiceIdHashBytes)};
+  ByteArray endpoint_info{std::string(kEndpointName)};
+  BleAdvertisement org_ble_advertisement{
+      kVersion,        kPcp,
+      service_id_hash, std::string(kEndpointId),
+      endpoint_info,   std::string(kBluetoothMacAddress),
+      ByteArray{},     kWebRtcState};
+  ByteArray ble_advertisement_bytes(org_ble_advertisement);
+  absl::string_view bytes = ble_advertisement_bytes.AsStringView();
+
+  auto view = BleAdvertisement::View::Parse(/*fast_advertisement=*/false,
+                                            bytes);
+
+  ASSERT_OK(view);
+  EXPECT_EQ(kServiceIdHashBytes, view->GetServiceIdHash());
+  EXPECT_EQ(kEndpointId, view->GetEndpointId());
+  EXPECT_EQ(kEndpointName, view->GetEndpointInfo());
+  EXPECT_GE(view->GetEndpointInfo().data(), bytes.data());
+  EXPECT_LE(view->GetEndpointInfo().data() + view->GetEndpointInfo().size(),
+            bytes.data() + bytes.size());
+  EXPECT_EQ(ble_advertisement_bytes, ByteArray(BleAdvertisement(*view)));
+}
 }  // namespace
 }  // namespace connections
 }  // namespace nearby
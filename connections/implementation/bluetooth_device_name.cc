@@ -16,13 +16,18 @@
 
 #include <inttypes.h>
 
-#include <cstring>
-#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
 
 #include "absl/strings/escaping.h"
-#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 #include "internal/platform/base64_utils.h"
-#include "internal/platform/base_input_stream.h"
+#include "internal/platform/byte_array.h"
+#include "internal/platform/byte_span_reader.h"
+#include "internal/platform/byte_span_writer.h"
 #include "internal/platform/logging.h"
 
 namespace nearby {
@@ -73,9 +78,9 @@ BluetoothDeviceName::BluetoothDeviceName(
     return;
   }
 
-  BaseInputStream base_input_stream{bluetooth_device_name_bytes};
+  ByteSpanReader reader{bluetooth_device_name_bytes.AsStringView()};
   // The first 1 byte is supposed to be the version and pcp.
-  auto version_and_pcp_byte = static_cast<char>(base_input_stream.ReadUint8());
+  auto version_and_pcp_byte = static_cast<char>(*reader.ReadUint8());
   // The upper 3 bits are supposed to be the version.
   version_ =
       static_cast<Version>((version_and_pcp_byte & kVersionBitmask) >> 5);
@@ -100,58 +105,61 @@ BluetoothDeviceName::BluetoothDeviceName(
   }
 
   // The next 4 bytes are supposed to be the endpoint_id.
-  endpoint_id_ = std::string{base_input_stream.ReadBytes(kEndpointIdLength)};
+  endpoint_id_ = std::string(*reader.ReadBytes(kEndpointIdLength));
 
   // The next 3 bytes are supposed to be the service_id_hash.
-  service_id_hash_ = base_input_stream.ReadBytes(kServiceIdHashLength);
+  absl::string_view service_id_hash = *reader.ReadBytes(kServiceIdHashLength);
+  service_id_hash_ = ByteArray(service_id_hash.data(), service_id_hash.size());
 
   // The next 1 byte is field containing WebRtc state.
-  auto field_byte = static_cast<char>(base_input_stream.ReadUint8());
+  auto field_byte = static_cast<char>(*reader.ReadUint8());
   web_rtc_state_ = (field_byte & kWebRtcConnectableFlagBitmask) == 1
                        ? WebRtcState::kConnectable
                        : WebRtcState::kUnconnectable;
 
   // The next 6 bytes are supposed to be reserved, and can be left
   // untouched.
-  base_input_stream.ReadBytes(kReservedLength);
+  reader.Skip(kReservedLength);
 
   // The next 1 byte is supposed to be the length of the endpoint_info.
-  std::uint32_t expected_endpoint_info_length = base_input_stream.ReadUint8();
+  std::uint32_t expected_endpoint_info_length = *reader.ReadUint8();
 
   // The rest bytes are supposed to be the endpoint_info
-  endpoint_info_ = base_input_stream.ReadBytes(expected_endpoint_info_length);
-  if (endpoint_info_.Empty() ||
-      endpoint_info_.size() != expected_endpoint_info_length) {
+  std::optional<absl::string_view> endpoint_info =
+      reader.ReadBytes(expected_endpoint_info_length);
+  if (!endpoint_info.has_value() || endpoint_info->empty()) {
     NEARBY_LOGS(INFO) << "Cannot deserialize BluetoothDeviceName: expected "
                          "endpoint info to be "
                       << expected_endpoint_info_length << " bytes, got "
-                      << endpoint_info_.size();
+                      << reader.remaining();
 
     // Clear endpoint_id for validity.
     endpoint_id_.clear();
     return;
   }
+  endpoint_info_ = ByteArray(endpoint_info->data(), endpoint_info->size());
 
   // If the input stream has extra bytes, it's for UWB address. The first byte
   // is the address length. It can be 2-byte short address or 8-byte extended
   // address.
-  if (base_input_stream.IsAvailable(1)) {
+  if (reader.IsAvailable(1)) {
     // The next 1 byte is supposed to be the length of the uwb_address.
-    std::uint32_t expected_uwb_address_length = base_input_stream.ReadUint8();
+    std::uint32_t expected_uwb_address_length = *reader.ReadUint8();
     // If the length of usb_address is not zero, then retrieve it.
     if (expected_uwb_address_length != 0) {
-      uwb_address_ = base_input_stream.ReadBytes(expected_uwb_address_length);
-      if (uwb_address_.Empty() ||
-          uwb_address_.size() != expected_uwb_address_length) {
+      std::optional<absl::string_view> uwb_address =
+          reader.ReadBytes(expected_uwb_address_length);
+      if (!uwb_address.has_value()) {
         NEARBY_LOGS(INFO) << "Cannot deserialize BluetoothDeviceName: expected "
                              "uwbAddress size to be "
                           << expected_uwb_address_length << " bytes, got "
-                          << uwb_address_.size();
+                          << reader.remaining();
 
         // Clear endpoint_id for validity.
         endpoint_id_.clear();
         return;
       }
+      uwb_address_ = ByteArray(uwb_address->data(), uwb_address->size());
     }
   }
 }
@@ -174,35 +182,37 @@ BluetoothDeviceName::operator std::string() const {
   char field_byte = static_cast<char>(web_rtc_connectable_flag) &
                     kWebRtcConnectableFlagBitmask;
 
-  ByteArray reserved_bytes{kReservedLength};
-
-  ByteArray usable_endpoint_info(endpoint_info_);
+  absl::string_view usable_endpoint_info = endpoint_info_.AsStringView();
   if (endpoint_info_.size() > kMaxEndpointInfoLength) {
     NEARBY_LOGS(INFO)
         << "While serializing Advertisement, truncating Endpoint Name "
         << absl::BytesToHexString(endpoint_info_.data()) << " ("
         << endpoint_info_.size() << " bytes) down to " << kMaxEndpointInfoLength
         << " bytes";
-    usable_endpoint_info.SetData(endpoint_info_.data(), kMaxEndpointInfoLength);
+    usable_endpoint_info =
+        usable_endpoint_info.substr(0, kMaxEndpointInfoLength);
   }
 
-  // clang-format off
-  std::string out = absl::StrCat(std::string(1, version_and_pcp_byte),
-                                 endpoint_id_,
-                                 std::string(service_id_hash_),
-                                 std::string(1, field_byte),
-                                 std::string(reserved_bytes),
-                                 std::string(1, usable_endpoint_info.size()),
-                                 std::string(usable_endpoint_info));
-  // clang-format on
-
+  size_t size = kMinBluetoothDeviceNameLength + usable_endpoint_info.size();
   // If UWB address is available, attach it at the end.
   if (!uwb_address_.Empty()) {
-    absl::StrAppend(&out, std::string(1, uwb_address_.size()));
-    absl::StrAppend(&out, std::string(uwb_address_));
+    size += 1 + uwb_address_.size();
+  }
+  ByteArray out(size);
+  ByteSpanWriter writer{absl::MakeSpan(out.data(), out.size())};
+  writer.WriteUint8(version_and_pcp_byte);
+  writer.WriteBytes(endpoint_id_);
+  writer.WriteBytes(service_id_hash_.AsStringView());
+  writer.WriteUint8(field_byte);
+  writer.WriteZeros(kReservedLength);
+  writer.WriteUint8(usable_endpoint_info.size());
+  writer.WriteBytes(usable_endpoint_info);
+  if (!uwb_address_.Empty()) {
+    writer.WriteUint8(uwb_address_.size());
+    writer.WriteBytes(uwb_address_.AsStringView());
   }
 
-  return Base64Utils::Encode(ByteArray{std::move(out)});
+  return Base64Utils::Encode(out);
 }
 
 }  // namespace connections
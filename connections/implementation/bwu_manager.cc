@@ -16,7 +16,9 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -45,11 +47,15 @@
 #include "connections/medium_selector.h"
 #include "internal/platform/byte_array.h"
 #include "internal/platform/cancelable_alarm.h"
+#include "internal/platform/condition_variable.h"
 #include "internal/platform/count_down_latch.h"
+#include "internal/platform/exception.h"
 #include "internal/platform/expected.h"
 #include "internal/platform/feature_flags.h"
 #include "internal/platform/implementation/system_clock.h"
 #include "internal/platform/logging.h"
+#include "internal/platform/mutex.h"
+#include "internal/platform/mutex_lock.h"
 #include "internal/platform/runnable.h"
 #include "proto/connections_enums.pb.h"
 
@@ -66,8 +72,79 @@ using ::location::nearby::proto::connections::ConnectionAttemptResult;
 using ::location::nearby::proto::connections::ConnectionAttemptType;
 using ::location::nearby::proto::connections::DisconnectionReason;
 using ::location::nearby::proto::connections::OperationResultCode;
+
+// Joining a Wi-Fi hotspot takes over the Wi-Fi station that Wi-Fi LAN is
+// connected through, so a device with one Wi-Fi radio can't be on both.
+bool ConflictsOnSingleRadio(Medium a, Medium b) {
+  return (a == Medium::WIFI_LAN && b == Medium::WIFI_HOTSPOT) ||
+         (a == Medium::WIFI_HOTSPOT && b == Medium::WIFI_LAN);
+}
+
+bool ConflictsOnSingleRadio(Medium medium,
+                            const std::vector<Medium>& other_mediums) {
+  return std::any_of(other_mediums.begin(), other_mediums.end(),
+                     [medium](Medium other_medium) {
+                       return ConflictsOnSingleRadio(medium, other_medium);
+                     });
+}
 }  // namespace
 
+class BwuManager::UpgradePathRace {
+ public:
+  struct Winner {
+    std::size_t path_index;
+    std::unique_ptr<EndpointChannel> channel;
+  };
+
+  explicit UpgradePathRace(std::size_t attempts)
+      : pending_attempts_(attempts) {}
+
+  // Reports that the attempt on upgrade path |path_index| introduced
+  // |channel|. Returns |channel| to the caller, to discard, if the race was
+  // already decided.
+  std::unique_ptr<EndpointChannel> OnAttemptSucceeded(
+      std::size_t path_index, std::unique_ptr<EndpointChannel> channel) {
+    MutexLock lock(&mutex_);
+    --pending_attempts_;
+    if (decided_) return channel;
+    decided_ = true;
+    winner_ = Winner{path_index, std::move(channel)};
+    condition_.Notify();
+    return nullptr;
+  }
+
+  void OnAttemptFailed() {
+    MutexLock lock(&mutex_);
+    if (--pending_attempts_ == 0) condition_.Notify();
+  }
+
+  // Ends the race without a winner.
+  void Cancel() {
+    MutexLock lock(&mutex_);
+    decided_ = true;
+    condition_.Notify();
+  }
+
+  // Blocks until an attempt succeeds, every attempt fails or the race is
+  // cancelled. Attempts that succeed afterwards are told to discard their
+  // channel.
+  std::optional<Winner> AwaitWinner() {
+    MutexLock lock(&mutex_);
+    while (!decided_ && pending_attempts_ > 0) {
+      condition_.Wait();
+    }
+    decided_ = true;
+    return std::move(winner_);
+  }
+
+ private:
+  Mutex mutex_;
+  ConditionVariable condition_{&mutex_};
+  std::size_t pending_attempts_ ABSL_GUARDED_BY(mutex_);
+  bool decided_ ABSL_GUARDED_BY(mutex_) = false;
+  std::optional<Winner> winner_ ABSL_GUARDED_BY(mutex_);
+};
+
 BwuManager::BwuManager(
     Mediums& mediums, EndpointManager& endpoint_manager,
     EndpointChannelManager& channel_manager,
@@ -198,6 +275,15 @@ void BwuManager::InvokeOnIncomingConnectionForTesting(
 }
 
 void BwuManager::ShutdownExecutors() {
+  {
+    MutexLock lock(&active_race_mutex_);
+    race_executor_shut_down_ = true;
+    if (active_race_) active_race_->Cancel();
+    while (running_race_attempts_ > 0) {
+      race_attempts_done_.Wait();
+    }
+  }
+  race_executor_.Shutdown();
   alarm_executor_.Shutdown();
   serial_executor_.Shutdown();
 }
@@ -319,6 +405,11 @@ void BwuManager::InitiateBwuForEndpoint(ClientProxy* client,
           OperationResultCode::CONNECTIVITY_GENERIC_WRITING_CHANNEL_IO_ERROR);
       return;
     }
+    if (IsBwuMediumRacingEnabled()) {
+      bytes = OfferRacedUpgradeMediums(client, service_id, endpoint_id,
+                                       channel->GetMedium(), proposed_medium,
+                                       std::move(bytes));
+    }
     if (!channel->Write(bytes).Ok()) {
       NEARBY_LOGS(ERROR)
           << "BwuManager couldn't complete the upgrade for endpoint "
@@ -326,6 +417,8 @@ void BwuManager::InitiateBwuForEndpoint(ClientProxy* client,
           << location::nearby::proto::connections::Medium_Name(proposed_medium)
           << " because it failed to write the "
              "BWU_NEGOTIATION.UPGRADE_PATH_AVAILABLE OfflineFrame.";
+      RevertRacedUpgradeMediums(endpoint_id, proposed_medium);
+      raced_upgrades_.erase(endpoint_id);
       return;
     }
 
@@ -394,6 +487,9 @@ void BwuManager::OnEndpointDisconnect(ClientProxy* client,
       }
     }
     in_progress_upgrades_.erase(endpoint_id);
+    RevertRacedUpgradeMediums(endpoint_id,
+                              GetBwuMediumForEndpoint(endpoint_id));
+    raced_upgrades_.erase(endpoint_id);
     retry_delays_.erase(endpoint_id);
     CancelRetryUpgradeAlarm(endpoint_id);
     successfully_upgraded_endpoints_.erase(endpoint_id);
@@ -454,6 +550,83 @@ void BwuManager::RevertBwuMediumForEndpoint(const std::string& service_id,
   handler->RevertInitiatorState(service_id, endpoint_id);
 }
 
+ByteArray BwuManager::OfferRacedUpgradeMediums(
+    ClientProxy* client, const std::string& service_id,
+    const std::string& endpoint_id, Medium channel_medium,
+    Medium proposed_medium, ByteArray path_available_frame) {
+  std::vector<Medium> mediums = StripOutUnavailableMediums(
+      client->GetUpgradeMediums(endpoint_id).GetMediums(true));
+  auto next = std::find(mediums.begin(), mediums.end(), proposed_medium);
+  if (next == mediums.end()) return path_available_frame;
+  ExceptionOr<OfflineFrame> frame = parser::FromBytes(path_available_frame);
+  if (!frame.ok()) return path_available_frame;
+
+  std::vector<UpgradePathInfo> upgrade_path_infos = {
+      frame.result().v1().bandwidth_upgrade_negotiation().upgrade_path_info()};
+  RacedUpgrade raced_upgrade;
+  raced_upgrade.upgrade_service_id = WrapInitiatorUpgradeServiceId(service_id);
+  raced_upgrade.mediums.push_back(proposed_medium);
+  for (++next; next != mediums.end() &&
+               raced_upgrade.mediums.size() < kMaxRacedUpgradeMediums;
+       ++next) {
+    Medium medium = *next;
+    // Same restrictions as for the proposed medium. Mediums that can't be
+    // used together with one already offered are never raced against it.
+    if (medium == channel_medium ||
+        (medium == Medium::WIFI_HOTSPOT &&
+         channel_manager_->isWifiLanConnected()) ||
+        ConflictsOnSingleRadio(medium, raced_upgrade.mediums)) {
+      continue;
+    }
+    ByteArray bytes =
+        GetHandlerForMedium(medium)->InitializeUpgradedMediumForEndpoint(
+            client, service_id, endpoint_id);
+    if (bytes.Empty()) {
+      NEARBY_LOGS(INFO) << "BwuManager couldn't offer medium "
+                        << location::nearby::proto::connections::Medium_Name(
+                               medium)
+                        << " to endpoint " << endpoint_id
+                        << " because it failed to initialize.";
+      continue;
+    }
+    ExceptionOr<OfflineFrame> alternative = parser::FromBytes(bytes);
+    if (!alternative.ok()) continue;
+    upgrade_path_infos.push_back(alternative.result()
+                                     .v1()
+                                     .bandwidth_upgrade_negotiation()
+                                     .upgrade_path_info());
+    raced_upgrade.mediums.push_back(medium);
+  }
+  if (raced_upgrade.mediums.size() == 1) return path_available_frame;
+
+  NEARBY_LOGS(INFO) << "BwuManager is offering "
+                    << raced_upgrade.mediums.size()
+                    << " upgrade mediums at once to endpoint " << endpoint_id;
+  raced_upgrades_[endpoint_id] = std::move(raced_upgrade);
+  return parser::ForBwuPathsAvailable(upgrade_path_infos);
+}
+
+void BwuManager::RevertRacedUpgradeMediums(const std::string& endpoint_id,
+                                           Medium keep_medium) {
+  auto item = raced_upgrades_.find(endpoint_id);
+  if (item == raced_upgrades_.end()) return;
+
+  RacedUpgrade& raced_upgrade = item->second;
+  for (Medium medium : raced_upgrade.mediums) {
+    if (medium == keep_medium) continue;
+    NEARBY_LOGS(INFO) << "Reverting raced medium "
+                      << location::nearby::proto::connections::Medium_Name(
+                             medium)
+                      << " for endpoint " << endpoint_id;
+    BwuHandler* handler = GetHandlerForMedium(medium);
+    if (handler) {
+      handler->RevertInitiatorState(raced_upgrade.upgrade_service_id,
+                                    endpoint_id);
+    }
+  }
+  raced_upgrade.mediums = {keep_medium};
+}
+
 bool BwuManager::IsUpgradeOngoing(const std::string& endpoint_id) {
   CountDownLatch latch(1);
   RunOnBwuManagerThread("is_upgrade_ongoing",
@@ -516,8 +689,13 @@ void BwuManager::OnBwuNegotiationFrame(ClientProxy* client,
 
   switch (frame.event_type()) {
     case BwuNegotiationFrame::UPGRADE_PATH_AVAILABLE:
-      ProcessBwuPathAvailableEvent(client, endpoint_id,
-                                   frame.upgrade_path_info());
+      if (frame.alternative_upgrade_path_infos_size() > 0 &&
+          IsBwuMediumRacingEnabled()) {
+        ProcessBwuPathsAvailableEvent(client, endpoint_id, frame);
+      } else {
+        ProcessBwuPathAvailableEvent(client, endpoint_id,
+                                     frame.upgrade_path_info());
+      }
       break;
     case BwuNegotiationFrame::UPGRADE_FAILURE:
       ProcessUpgradeFailureEvent(
@@ -585,6 +763,24 @@ void BwuManager::OnIncomingConnection(
                       "OfflineFrame on EndpointChannel "
                    << channel->GetName();
 
+    const std::string& endpoint_id = introduction.endpoint_id();
+    auto raced_upgrade = raced_upgrades_.find(endpoint_id);
+    if (raced_upgrade != raced_upgrades_.end() &&
+        raced_upgrade->second.winner != Medium::UNKNOWN_MEDIUM) {
+      // Another of the upgrade paths offered at once was introduced first.
+      // Without the ack, the remote device gives up on this one.
+      NEARBY_LOGS(INFO)
+          << "BwuManager is discarding the "
+          << location::nearby::proto::connections::Medium_Name(
+                 channel->GetMedium())
+          << " EndpointChannel for endpoint " << endpoint_id
+          << " because it already upgrades over "
+          << location::nearby::proto::connections::Medium_Name(
+                 raced_upgrade->second.winner);
+      channel->Close();
+      return;
+    }
+
     if (!WriteClientIntroductionAckFrame(channel)) {
       // This was never a fully EstablishedConnection, no need to provide a
       // closure reason.
@@ -601,7 +797,18 @@ void BwuManager::OnIncomingConnection(
                       "OfflineFrame on EndpointChannel "
                    << channel->GetName();
 
-    const std::string& endpoint_id = introduction.endpoint_id();
+    if (raced_upgrade != raced_upgrades_.end()) {
+      Medium winner = channel->GetMedium();
+      NEARBY_LOGS(INFO) << "BwuManager picked "
+                        << location::nearby::proto::connections::Medium_Name(
+                               winner)
+                        << " out of the upgrade mediums raced for endpoint "
+                        << endpoint_id;
+      raced_upgrade->second.winner = winner;
+      SetBwuMediumForEndpoint(endpoint_id, winner);
+      RevertRacedUpgradeMediums(endpoint_id, winner);
+    }
+
     ClientProxy* mapped_client;
     const auto item = in_progress_upgrades_.find(endpoint_id);
     if (item == in_progress_upgrades_.end()) return;
@@ -729,11 +936,7 @@ void BwuManager::ProcessBwuPathAvailableEvent(
                     << location::nearby::proto::connections::Medium_Name(
                            upgrade_medium);
 
-  if (channel_manager_->isWifiLanConnected() &&
-      ((upgrade_medium == Medium::WIFI_HOTSPOT) ||
-       ((upgrade_medium == Medium::WIFI_DIRECT) &&
-        (client->GetLocalOsInfo().type() ==
-         location::nearby::connections::OsInfo::WINDOWS)))) {
+  if (IsBlockedByWifiLan(client, upgrade_medium)) {
     NEARBY_LOGS(INFO)
         << "Some endpoint is using WIFI_LAN and proposed upgrade medium is "
         << location::nearby::proto::connections::Medium_Name(upgrade_medium)
@@ -903,6 +1106,14 @@ BwuManager::ProcessBwuPathAvailableEventInternal(
     service_id = old_channel->GetServiceId();
   }
 
+  return CreateIntroducedEndpointChannel(client, handler, service_id,
+                                         endpoint_id, upgrade_path_info);
+}
+
+ErrorOr<std::unique_ptr<EndpointChannel>>
+BwuManager::CreateIntroducedEndpointChannel(
+    ClientProxy* client, BwuHandler* handler, const std::string& service_id,
+    const std::string& endpoint_id, const UpgradePathInfo& upgrade_path_info) {
   ErrorOr<std::unique_ptr<EndpointChannel>> result =
       handler->CreateUpgradedEndpointChannel(client, service_id, endpoint_id,
                                              upgrade_path_info);
@@ -970,6 +1181,185 @@ BwuManager::ProcessBwuPathAvailableEventInternal(
   return {std::move(new_channel)};
 }
 
+// Outgoing BWU session over several upgrade paths at once.
+void BwuManager::ProcessBwuPathsAvailableEvent(
+    ClientProxy* client, const std::string& endpoint_id,
+    const BwuNegotiationFrame& frame) {
+  std::vector<UpgradePathInfo> upgrade_path_infos = {frame.upgrade_path_info()};
+  upgrade_path_infos.insert(upgrade_path_infos.end(),
+                            frame.alternative_upgrade_path_infos().begin(),
+                            frame.alternative_upgrade_path_infos().end());
+  NEARBY_LOGS(INFO) << "ProcessBwuPathsAvailableEvent for endpoint "
+                    << endpoint_id << " with " << upgrade_path_infos.size()
+                    << " upgrade paths";
+
+  // Racing relies on the initiator acknowledging only the first
+  // CLIENT_INTRODUCTION it reads, so that both devices agree on the winner,
+  // and the upgrade medium of an endpoint can't change once chosen. Anything
+  // other than a fresh upgrade goes through the single path flow, which also
+  // rejects advertisers and duplicate upgrades.
+  Medium current_bwu_medium = GetBwuMediumForEndpoint(endpoint_id);
+  bool all_paths_acknowledged =
+      std::all_of(upgrade_path_infos.begin(), upgrade_path_infos.end(),
+                  [](const UpgradePathInfo& upgrade_path_info) {
+                    return upgrade_path_info.supports_client_introduction_ack();
+                  });
+  if (!all_paths_acknowledged || current_bwu_medium != Medium::UNKNOWN_MEDIUM ||
+      client->IsIncomingConnection(endpoint_id) ||
+      in_progress_upgrades_.contains(endpoint_id)) {
+    const UpgradePathInfo* upgrade_path_info = &upgrade_path_infos.front();
+    for (const UpgradePathInfo& info : upgrade_path_infos) {
+      if (parser::UpgradePathInfoMediumToMedium(info.medium()) ==
+          current_bwu_medium) {
+        upgrade_path_info = &info;
+        break;
+      }
+    }
+    ProcessBwuPathAvailableEvent(client, endpoint_id, *upgrade_path_info);
+    return;
+  }
+
+  // Reporting the last path offered on failure makes the initiator move on to
+  // the mediums it didn't offer.
+  const UpgradePathInfo& last_upgrade_path_info = upgrade_path_infos.back();
+
+  std::string service_id;
+  Medium current_medium;
+  {
+    std::shared_ptr<EndpointChannel> current_channel =
+        channel_manager_->GetChannelForEndpoint(endpoint_id);
+    if (!current_channel) {
+      RunUpgradeFailedProtocol(client, endpoint_id, last_upgrade_path_info);
+      return;
+    }
+    service_id = current_channel->GetServiceId();
+    current_medium = current_channel->GetMedium();
+  }
+
+  // Paths are offered in order of preference, so a path that can't be joined
+  // together with an earlier one is dropped from the race.
+  std::vector<UpgradePathInfo> raced_paths;
+  std::vector<Medium> raced_mediums;
+  std::vector<BwuHandler*> raced_handlers;
+  for (const UpgradePathInfo& upgrade_path_info : upgrade_path_infos) {
+    Medium medium =
+        parser::UpgradePathInfoMediumToMedium(upgrade_path_info.medium());
+    BwuHandler* handler = GetHandlerForMedium(medium);
+    if (!handler || IsBlockedByWifiLan(client, medium) ||
+        ConflictsOnSingleRadio(medium, raced_mediums) ||
+        std::find(raced_handlers.begin(), raced_handlers.end(), handler) !=
+            raced_handlers.end()) {
+      NEARBY_LOGS(INFO) << "BwuManager is skipping upgrade path "
+                        << location::nearby::proto::connections::Medium_Name(
+                               medium)
+                        << " for endpoint " << endpoint_id;
+      continue;
+    }
+    raced_paths.push_back(upgrade_path_info);
+    raced_mediums.push_back(medium);
+    raced_handlers.push_back(handler);
+  }
+  if (raced_paths.empty()) {
+    RunUpgradeFailedProtocol(client, endpoint_id, last_upgrade_path_info);
+    return;
+  }
+
+  client->GetAnalyticsRecorder().OnBandwidthUpgradeStarted(
+      endpoint_id, current_medium,
+      parser::UpgradePathInfoMediumToMedium(raced_paths.front().medium()),
+      location::nearby::proto::connections::OUTGOING,
+      client->GetConnectionToken(endpoint_id));
+
+  absl::Time connection_attempt_start_time = SystemClock::ElapsedRealtime();
+  auto race = std::make_shared<UpgradePathRace>(raced_paths.size());
+  {
+    MutexLock lock(&active_race_mutex_);
+    active_race_ = race;
+  }
+  for (std::size_t path_index = 0; path_index < raced_paths.size();
+       ++path_index) {
+    race_executor_.Execute(
+        "bwu-race-upgrade-path",
+        [this, client, race, handler = raced_handlers[path_index], service_id,
+         endpoint_id, upgrade_path_info = raced_paths[path_index],
+         path_index]() {
+          if (!BeginRaceAttempt()) {
+            race->OnAttemptFailed();
+            return;
+          }
+          ErrorOr<std::unique_ptr<EndpointChannel>> result =
+              CreateIntroducedEndpointChannel(client, handler, service_id,
+                                              endpoint_id, upgrade_path_info);
+          std::unique_ptr<EndpointChannel> channel =
+              result.has_value() ? std::move(result.value()) : nullptr;
+          bool introduced = channel != nullptr;
+          if (introduced) {
+            channel = race->OnAttemptSucceeded(path_index, std::move(channel));
+            if (channel == nullptr) {
+              EndRaceAttempt();
+              return;
+            }
+            // This was never a fully EstablishedConnection, no need to
+            // provide a closure reason.
+            channel->Close();
+          }
+
+          // Undo what joining the path changed, as RevertBwuMediumForEndpoint
+          // does for the responder.
+          Medium medium = handler->GetUpgradeMedium();
+          if (medium == Medium::WIFI_HOTSPOT || medium == Medium::WIFI_DIRECT) {
+            RunOnBwuManagerThread("bwu-revert-raced-upgrade-path",
+                                  [handler, service_id]() {
+                                    handler->RevertResponderState(service_id);
+                                  });
+          }
+          if (!introduced) race->OnAttemptFailed();
+          EndRaceAttempt();
+        });
+  }
+
+  std::optional<UpgradePathRace::Winner> winner = race->AwaitWinner();
+  {
+    MutexLock lock(&active_race_mutex_);
+    active_race_.reset();
+  }
+  if (!winner.has_value()) {
+    NEARBY_LOGS(INFO) << "Failed to get new channel on any of "
+                      << raced_paths.size() << " upgrade paths.";
+    RunUpgradeFailedProtocol(client, endpoint_id, last_upgrade_path_info);
+    return;
+  }
+
+  const UpgradePathInfo& upgrade_path_info = raced_paths[winner->path_index];
+  std::unique_ptr<EndpointChannel> channel = std::move(winner->channel);
+  Medium upgrade_medium =
+      parser::UpgradePathInfoMediumToMedium(upgrade_path_info.medium());
+  NEARBY_LOGS(INFO) << "BwuManager introduced itself over "
+                    << location::nearby::proto::connections::Medium_Name(
+                           upgrade_medium)
+                    << " first out of " << raced_paths.size()
+                    << " upgrade paths for endpoint " << endpoint_id;
+  SetBwuMediumForEndpoint(endpoint_id, upgrade_medium);
+
+  std::unique_ptr<ConnectionAttemptMetadataParams>
+      connections_attempt_metadata_params =
+          client->GetAnalyticsRecorder().BuildConnectionAttemptMetadataParams(
+              channel->GetTechnology(), channel->GetBand(),
+              channel->GetFrequency(), channel->GetTryCount());
+  connections_attempt_metadata_params->operation_result_code =
+      OperationResultCode::DETAIL_SUCCESS;
+  client->GetAnalyticsRecorder().OnOutgoingConnectionAttempt(
+      endpoint_id, ConnectionAttemptType::UPGRADE, upgrade_medium,
+      location::nearby::proto::connections::RESULT_SUCCESS,
+      SystemClock::ElapsedRealtime() - connection_attempt_start_time,
+      client->GetConnectionToken(endpoint_id),
+      connections_attempt_metadata_params.get());
+
+  in_progress_upgrades_.emplace(endpoint_id, client);
+  RunUpgradeProtocol(client, endpoint_id, std::move(channel),
+                     !upgrade_path_info.supports_disabling_encryption());
+}
+
 void BwuManager::RunUpgradeFailedProtocol(
     ClientProxy* client, const std::string& endpoint_id,
     const UpgradePathInfo& upgrade_path_info) {
@@ -1256,6 +1646,7 @@ void BwuManager::ProcessSafeToClosePriorChannelEvent(
   }
   client->OnBandwidthChanged(endpoint_id, medium);
   in_progress_upgrades_.erase(endpoint_id);
+  raced_upgrades_.erase(endpoint_id);
 }
 
 void BwuManager::ProcessUpgradeFailureEvent(
@@ -1296,7 +1687,10 @@ void BwuManager::ProcessUpgradeFailureEvent(
       channel_manager_->GetChannelForEndpoint(endpoint_id).get();
   std::string service_id =
       channel ? channel->GetServiceId() : std::string(kUnknownServiceId);
-  // Revert the existing upgrade medium for now.
+  // Revert the existing upgrade medium, and any offered along with it, for
+  // now.
+  RevertRacedUpgradeMediums(endpoint_id, GetBwuMediumForEndpoint(endpoint_id));
+  raced_upgrades_.erase(endpoint_id);
   if (GetBwuMediumForEndpoint(endpoint_id) != Medium::UNKNOWN_MEDIUM) {
     // This is the BWU initiator, so append "_UPGRADE" to service_id.
     // Otherwise the Revert logic won't call into platform medium layer code.
@@ -1460,6 +1854,31 @@ Medium BwuManager::ChooseBestUpgradeMedium(
   return Medium::UNKNOWN_MEDIUM;
 }
 
+bool BwuManager::IsBwuMediumRacingEnabled() const {
+  const FeatureFlags::Flags& flags = FeatureFlags::GetInstance().GetFlags();
+  return flags.enable_bwu_medium_racing && flags.support_multiple_bwu_mediums;
+}
+
+bool BwuManager::BeginRaceAttempt() {
+  MutexLock lock(&active_race_mutex_);
+  if (race_executor_shut_down_) return false;
+  ++running_race_attempts_;
+  return true;
+}
+
+void BwuManager::EndRaceAttempt() {
+  MutexLock lock(&active_race_mutex_);
+  if (--running_race_attempts_ == 0) race_attempts_done_.Notify();
+}
+
+bool BwuManager::IsBlockedByWifiLan(ClientProxy* client, Medium medium) const {
+  return channel_manager_->isWifiLanConnected() &&
+         ((medium == Medium::WIFI_HOTSPOT) ||
+          ((medium == Medium::WIFI_DIRECT) &&
+           (client->GetLocalOsInfo().type() ==
+            location::nearby::connections::OsInfo::WINDOWS)));
+}
+
 void BwuManager::RetryUpgradesAfterDelay(ClientProxy* client,
                                          const std::string& endpoint_id) {
   absl::Duration delay = CalculateNextRetryDelay(endpoint_id);
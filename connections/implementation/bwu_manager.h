@@ -15,11 +15,13 @@
 #ifndef CORE_INTERNAL_BWU_MANAGER_H_
 #define CORE_INTERNAL_BWU_MANAGER_H_
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_map.h"
 #include "absl/container/flat_hash_set.h"
 #include "absl/time/time.h"
@@ -31,8 +33,11 @@
 #include "connections/implementation/mediums/mediums.h"
 #include "connections/medium_selector.h"
 #include "internal/platform/cancelable_alarm.h"
+#include "internal/platform/condition_variable.h"
 #include "internal/platform/count_down_latch.h"
 #include "internal/platform/expected.h"
+#include "internal/platform/multi_thread_executor.h"
+#include "internal/platform/mutex.h"
 #include "internal/platform/runnable.h"
 #include "internal/platform/scheduled_executor.h"
 #include "internal/platform/single_thread_executor.h"
@@ -63,6 +68,13 @@ namespace connections {
 //   - Both then wait to receive
 //     BANDWIDTH_UPGRADE_NEGOTIATION.SAFE_TO_CLOSE_PRIOR_CHANNEL from the
 //     other, and upon doing so, close the prior EndpointChannel.
+//
+// With FeatureFlags::enable_bwu_medium_racing, the Initiator may offer
+// alternative upgrade paths along with the primary one. The Responder then
+// joins all of them concurrently, and the Initiator acknowledges only the
+// first CLIENT_INTRODUCTION it reads; that path wins and the others are
+// reverted. Wi-Fi LAN and Wi-Fi hotspot are never raced against each other,
+// since a single Wi-Fi radio can't stay on a LAN while joining a hotspot.
 class BwuManager : public EndpointManager::FrameProcessor {
  public:
   using UpgradePathInfo = BwuHandler::UpgradePathInfo;
@@ -128,6 +140,21 @@ class BwuManager : public EndpointManager::FrameProcessor {
  private:
   static constexpr absl::Duration kReadClientIntroductionFrameTimeout =
       absl::Seconds(5);
+  // The most upgrade paths offered in one UPGRADE_PATH_AVAILABLE frame.
+  static constexpr std::size_t kMaxRacedUpgradeMediums = 3;
+
+  // The upgrade mediums offered to an endpoint in one negotiation.
+  struct RacedUpgrade {
+    std::string upgrade_service_id;
+    // The offered mediums that have not been reverted yet.
+    std::vector<Medium> mediums;
+    // The medium of the first CLIENT_INTRODUCTION read, once there is one.
+    Medium winner = Medium::UNKNOWN_MEDIUM;
+  };
+
+  // Collects the outcome of the Responder's concurrent attempts on the
+  // upgrade paths of one UPGRADE_PATH_AVAILABLE frame.
+  class UpgradePathRace;
 
   void InitBwuHandlers();
   void RunOnBwuManagerThread(const std::string& name, Runnable runnable);
@@ -135,6 +162,10 @@ class BwuManager : public EndpointManager::FrameProcessor {
       const std::vector<Medium>& mediums) const;
   Medium ChooseBestUpgradeMedium(const std::string& endpoint_id,
                                  const std::vector<Medium>& mediums) const;
+  bool IsBwuMediumRacingEnabled() const;
+  // Returns true if upgrading to |medium| would disconnect Wi-Fi LAN that
+  // some endpoint is connected over.
+  bool IsBlockedByWifiLan(ClientProxy* client, Medium medium) const;
 
   // BaseBwuHandler
   using ClientIntroduction = BwuNegotiationFrame::ClientIntroduction;
@@ -150,6 +181,22 @@ class BwuManager : public EndpointManager::FrameProcessor {
   void RevertBwuMediumForEndpoint(const std::string& service_id,
                                   const std::string& endpoint_id);
 
+  // Initializes the upgrade mediums that follow |proposed_medium| in the
+  // endpoint's upgrade medium order, up to kMaxRacedUpgradeMediums in total,
+  // and returns an UPGRADE_PATH_AVAILABLE frame offering them as alternatives
+  // to |path_available_frame|. Returns |path_available_frame| unchanged if
+  // there is nothing else to offer.
+  ByteArray OfferRacedUpgradeMediums(ClientProxy* client,
+                                     const std::string& service_id,
+                                     const std::string& endpoint_id,
+                                     Medium channel_medium,
+                                     Medium proposed_medium,
+                                     ByteArray path_available_frame);
+  // Reverts the initiator state of every medium offered to |endpoint_id|,
+  // except |keep_medium|.
+  void RevertRacedUpgradeMediums(const std::string& endpoint_id,
+                                 Medium keep_medium);
+
   // Get/Set the currently selected upgrade medium for this endpoint, or
   // UNKNOWN_MEDIUM if nothing is selected. This is the medium we are attempting
   // to upgrade to, not necessarily the endpoint's current connection medium.
@@ -178,6 +225,20 @@ class BwuManager : public EndpointManager::FrameProcessor {
   ProcessBwuPathAvailableEventInternal(
       ClientProxy* client, const std::string& endpoint_id,
       const UpgradePathInfo& upgrade_path_info);
+  // Responder side of a raced upgrade: joins every upgrade path in |frame|
+  // concurrently and runs the upgrade protocol over the first one introduced.
+  void ProcessBwuPathsAvailableEvent(ClientProxy* client,
+                                     const std::string& endpoint_id,
+                                     const BwuNegotiationFrame& frame);
+  // Joins |upgrade_path_info| and introduces this device over the new
+  // EndpointChannel. Safe to call off the BwuManager thread.
+  ErrorOr<std::unique_ptr<EndpointChannel>> CreateIntroducedEndpointChannel(
+      ClientProxy* client, BwuHandler* handler, const std::string& service_id,
+      const std::string& endpoint_id, const UpgradePathInfo& upgrade_path_info);
+  // Bracket an attempt running on race_executor_. BeginRaceAttempt() returns
+  // false if the attempt must not start because of Shutdown().
+  bool BeginRaceAttempt();
+  void EndRaceAttempt();
   void ProcessLastWriteToPriorChannelEvent(ClientProxy* client,
                                            const std::string& endpoint_id);
   void ProcessSafeToClosePriorChannelEvent(ClientProxy* client,
@@ -230,6 +291,18 @@ class BwuManager : public EndpointManager::FrameProcessor {
   EndpointChannelManager* channel_manager_;
   ScheduledExecutor alarm_executor_;
   SingleThreadExecutor serial_executor_;
+  // Runs the Responder's attempts on raced upgrade paths.
+  MultiThreadExecutor race_executor_{kMaxRacedUpgradeMediums};
+  // The race the BwuManager thread is waiting on, so that Shutdown() can
+  // release it.
+  Mutex active_race_mutex_;
+  std::shared_ptr<UpgradePathRace> active_race_
+      ABSL_GUARDED_BY(active_race_mutex_);
+  // Attempts still running on race_executor_, including those that lost.
+  // Shutdown() waits for them, since they use the BwuHandlers.
+  std::size_t running_race_attempts_ ABSL_GUARDED_BY(active_race_mutex_) = 0;
+  bool race_executor_shut_down_ ABSL_GUARDED_BY(active_race_mutex_) = false;
+  ConditionVariable race_attempts_done_{&active_race_mutex_};
   // Stores each upgraded endpoint's previous EndpointChannel (that was
   // displaced in favor of a new EndpointChannel) temporarily, until it can
   // safely be shut down for good in processLastWriteToPriorChannelEvent().
@@ -240,6 +313,9 @@ class BwuManager : public EndpointManager::FrameProcessor {
   // initiateBwuForEndpoint() has been called but which have not
   // yet completed the upgrade via onIncomingConnection().
   absl::flat_hash_map<std::string, ClientProxy*> in_progress_upgrades_;
+  // Maps endpointId -> upgrade mediums offered at once to it, for upgrades in
+  // progress that offered more than one.
+  absl::flat_hash_map<std::string, RacedUpgrade> raced_upgrades_;
   // Maps endpointId -> timestamp of when the SAFE_TO_CLOSE message was written.
   absl::flat_hash_map<std::string, absl::Time> safe_to_close_write_timestamps_;
   absl::flat_hash_map<
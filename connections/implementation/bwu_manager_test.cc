@@ -20,6 +20,8 @@
 
 #include "gtest/gtest.h"
 #include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 #include "connections/connection_options.h"
 #include "connections/implementation/client_proxy.h"
 #include "connections/implementation/endpoint_channel.h"
@@ -49,6 +51,7 @@ using ::location::nearby::connections::
 using ::location::nearby::connections::OfflineFrame;
 using ::location::nearby::connections::V1Frame;
 using ::location::nearby::proto::connections::DisconnectionReason;
+using ::location::nearby::proto::connections::OperationResultCode;
 
 constexpr absl::string_view kServiceIdA = "ServiceA";
 constexpr absl::string_view kServiceIdB = "ServiceB";
@@ -1012,6 +1015,220 @@ TEST_F(BwuManagerTest, BlockBwuFrameFromAdvertiser) {
   UnRegisterChannelForEndpoint(kEndpointId2);
 }
 
+// Races bandwidth upgrade mediums. Joining an upgrade path is simulated by
+// the fake handlers, with the delay and result set per medium.
+class BwuManagerRacingTest : public BwuManagerTest {
+ protected:
+  BwuManagerRacingTest() {
+    FeatureFlags::GetMutableFlagsForTesting().support_multiple_bwu_mediums =
+        true;
+    FeatureFlags::GetMutableFlagsForTesting().enable_bwu_medium_racing = true;
+  }
+  ~BwuManagerRacingTest() override {
+    FeatureFlags::GetMutableFlagsForTesting().enable_bwu_medium_racing = false;
+  }
+
+  static BandwidthUpgradeNegotiationFrame_UpgradePathInfo
+  LanUpgradePathInfo() {
+    return parser::FromBytes(parser::ForBwuWifiLanPathAvailable(
+                                 /*ip_address=*/"ABCD", /*port=*/1234))
+        .result()
+        .v1()
+        .bandwidth_upgrade_negotiation()
+        .upgrade_path_info();
+  }
+
+  static BandwidthUpgradeNegotiationFrame_UpgradePathInfo
+  HotspotUpgradePathInfo() {
+    return parser::FromBytes(parser::ForBwuWifiHotspotPathAvailable(
+                                 /*ssid=*/"Direct-357a2d8c",
+                                 /*password=*/"b592f7d3", /*port=*/1234,
+                                 /*frequency=*/2412,
+                                 /*gateway=*/"123.234.23.1", false))
+        .result()
+        .v1()
+        .bandwidth_upgrade_negotiation()
+        .upgrade_path_info();
+  }
+
+  static BandwidthUpgradeNegotiationFrame_UpgradePathInfo
+  DirectUpgradePathInfo() {
+    return parser::FromBytes(parser::ForBwuWifiDirectPathAvailable(
+                                 /*ssid=*/"Direct-12345678",
+                                 /*password=*/"87654321", /*port=*/2143,
+                                 /*frequency=*/2412,
+                                 /*supports_disabling_encryption=*/false,
+                                 /*gateway=*/"123.234.23.1"))
+        .result()
+        .v1()
+        .bandwidth_upgrade_negotiation()
+        .upgrade_path_info();
+  }
+
+  // Returns an UPGRADE_PATH_AVAILABLE frame offering Wi-Fi LAN, then Wi-Fi
+  // Direct.
+  static OfflineFrame CreateLanAndDirectPathsAvailableFrame() {
+    return parser::FromBytes(
+               parser::ForBwuPathsAvailable(
+                   {LanUpgradePathInfo(), DirectUpgradePathInfo()}))
+        .result();
+  }
+
+  // Returns an UPGRADE_PATH_AVAILABLE frame offering Wi-Fi LAN, then Wi-Fi
+  // hotspot.
+  static OfflineFrame CreateLanAndHotspotPathsAvailableFrame() {
+    return parser::FromBytes(
+               parser::ForBwuPathsAvailable(
+                   {LanUpgradePathInfo(), HotspotUpgradePathInfo()}))
+        .result();
+  }
+
+  // Delivers |frame| to the BwuManager and returns how long it took to handle
+  // it. The BwuManager is single-threaded, so this includes the whole race.
+  absl::Duration DeliverFrame(OfflineFrame frame,
+                              absl::string_view endpoint_id) {
+    absl::Time start = absl::Now();
+    bwu_manager_->OnIncomingFrame(frame, std::string(endpoint_id), &client_,
+                                  Medium::BLUETOOTH, packet_meta_data_);
+    absl::Duration elapsed = absl::Now() - start;
+    RecordProperty("time_to_upgrade_ms",
+                   static_cast<int>(absl::ToInt64Milliseconds(elapsed)));
+    return elapsed;
+  }
+};
+
+TEST_F(BwuManagerRacingTest, Responder_UpgradesOverFirstIntroducedPath) {
+  constexpr absl::Duration kLanFailureDelay = absl::Milliseconds(500);
+  fake_wifi_lan_bwu_handler_->set_create_result(
+      kLanFailureDelay,
+      OperationResultCode::CONNECTIVITY_WIFI_LAN_SOCKET_CONNECT_TIMEOUT);
+  fake_wifi_direct_bwu_handler_->set_create_result(absl::Milliseconds(50));
+  CreateInitialEndpoint(&client_, kServiceIdA, kEndpointId1, Medium::BLUETOOTH);
+
+  absl::Duration time_to_upgrade =
+      DeliverFrame(CreateLanAndDirectPathsAvailableFrame(), kEndpointId1);
+
+  // The slow failure on Wi-Fi LAN did not hold back the upgrade.
+  EXPECT_LT(time_to_upgrade, kLanFailureDelay);
+  EXPECT_EQ(fake_wifi_direct_bwu_handler_->create_calls().size(), 1u);
+  EXPECT_EQ(ecm_.GetChannelForEndpoint(std::string(kEndpointId1))->GetMedium(),
+            Medium::WIFI_DIRECT);
+  EXPECT_TRUE(bwu_manager_->IsUpgradeOngoing(std::string(kEndpointId1)));
+  EXPECT_TRUE(fake_wifi_direct_bwu_handler_->handle_revert_calls().empty());
+  UnRegisterChannelForEndpoint(kEndpointId1);
+}
+
+TEST_F(BwuManagerRacingTest, Responder_FailsAfterEveryPathFails) {
+  constexpr absl::Duration kLanFailureDelay = absl::Milliseconds(100);
+  fake_wifi_lan_bwu_handler_->set_create_result(
+      kLanFailureDelay,
+      OperationResultCode::CONNECTIVITY_WIFI_LAN_SOCKET_CONNECT_TIMEOUT);
+  fake_wifi_direct_bwu_handler_->set_create_result(
+      absl::ZeroDuration(),
+      OperationResultCode::CONNECTIVITY_WIFI_DIRECT_INVALID_CREDENTIAL);
+  CreateInitialEndpoint(&client_, kServiceIdA, kEndpointId1, Medium::BLUETOOTH);
+
+  absl::Duration time_to_fail =
+      DeliverFrame(CreateLanAndDirectPathsAvailableFrame(), kEndpointId1);
+
+  EXPECT_GE(time_to_fail, kLanFailureDelay);
+  EXPECT_EQ(fake_wifi_lan_bwu_handler_->create_calls().size(), 1u);
+  EXPECT_EQ(fake_wifi_direct_bwu_handler_->create_calls().size(), 1u);
+  EXPECT_EQ(ecm_.GetChannelForEndpoint(std::string(kEndpointId1))->GetMedium(),
+            Medium::BLUETOOTH);
+  EXPECT_FALSE(bwu_manager_->IsUpgradeOngoing(std::string(kEndpointId1)));
+  // The Wi-Fi Direct group that was joined for the race is left again.
+  EXPECT_EQ(fake_wifi_direct_bwu_handler_->handle_revert_calls().size(), 1u);
+  UnRegisterChannelForEndpoint(kEndpointId1);
+}
+
+TEST_F(BwuManagerRacingTest, Responder_JoinsPrimaryPathOnlyWhenDisabled) {
+  FeatureFlags::GetMutableFlagsForTesting().enable_bwu_medium_racing = false;
+  CreateInitialEndpoint(&client_, kServiceIdA, kEndpointId1, Medium::BLUETOOTH);
+
+  DeliverFrame(CreateLanAndHotspotPathsAvailableFrame(), kEndpointId1);
+
+  EXPECT_EQ(fake_wifi_lan_bwu_handler_->create_calls().size(), 1u);
+  EXPECT_TRUE(fake_wifi_hotspot_bwu_handler_->create_calls().empty());
+  EXPECT_EQ(ecm_.GetChannelForEndpoint(std::string(kEndpointId1))->GetMedium(),
+            Medium::WIFI_LAN);
+  UnRegisterChannelForEndpoint(kEndpointId1);
+}
+
+TEST_F(BwuManagerRacingTest, Responder_NeverJoinsHotspotAlongWithLan) {
+  CreateInitialEndpoint(&client_, kServiceIdA, kEndpointId1, Medium::BLUETOOTH);
+
+  DeliverFrame(CreateLanAndHotspotPathsAvailableFrame(), kEndpointId1);
+
+  // Joining the hotspot would drop the Wi-Fi LAN path being raced.
+  EXPECT_EQ(fake_wifi_lan_bwu_handler_->create_calls().size(), 1u);
+  EXPECT_TRUE(fake_wifi_hotspot_bwu_handler_->create_calls().empty());
+  EXPECT_EQ(ecm_.GetChannelForEndpoint(std::string(kEndpointId1))->GetMedium(),
+            Medium::WIFI_LAN);
+  UnRegisterChannelForEndpoint(kEndpointId1);
+}
+
+TEST_F(BwuManagerRacingTest, Initiator_AcksFirstIntroductionAndRevertsRest) {
+  CreateInitialEndpoint(&client_, kServiceIdA, kEndpointId1, Medium::BLUETOOTH);
+
+  bwu_manager_->InitiateBwuForEndpoint(&client_, std::string(kEndpointId1),
+                                       Medium::WIFI_LAN);
+
+  // The next mediums in upgrade order are offered along with Wi-Fi LAN.
+  ASSERT_EQ(fake_wifi_lan_bwu_handler_->handle_initialize_calls().size(), 1u);
+  ASSERT_EQ(fake_wifi_direct_bwu_handler_->handle_initialize_calls().size(),
+            1u);
+
+  FakeEndpointChannel* direct_channel =
+      fake_wifi_direct_bwu_handler_->NotifyBwuManagerOfIncomingConnection(
+          0, bwu_manager_.get());
+  EXPECT_FALSE(direct_channel->is_closed());
+  EXPECT_EQ(ecm_.GetChannelForEndpoint(std::string(kEndpointId1))->GetMedium(),
+            Medium::WIFI_DIRECT);
+  EXPECT_EQ(fake_wifi_lan_bwu_handler_->handle_revert_calls().size(), 1u);
+  EXPECT_TRUE(fake_wifi_direct_bwu_handler_->handle_revert_calls().empty());
+
+  // An introduction over a medium that lost the race is not acknowledged.
+  FakeEndpointChannel* lan_channel =
+      fake_wifi_lan_bwu_handler_->NotifyBwuManagerOfIncomingConnection(
+          0, bwu_manager_.get());
+  EXPECT_TRUE(lan_channel->is_closed());
+  EXPECT_EQ(ecm_.GetChannelForEndpoint(std::string(kEndpointId1))->GetMedium(),
+            Medium::WIFI_DIRECT);
+  UnRegisterChannelForEndpoint(kEndpointId1);
+}
+
+TEST_F(BwuManagerRacingTest, Initiator_NeverOffersHotspotAlongWithLan) {
+  CreateInitialEndpoint(&client_, kServiceIdA, kEndpointId1, Medium::BLUETOOTH);
+
+  bwu_manager_->InitiateBwuForEndpoint(&client_, std::string(kEndpointId1),
+                                       Medium::WIFI_LAN);
+
+  EXPECT_EQ(fake_wifi_lan_bwu_handler_->handle_initialize_calls().size(), 1u);
+  EXPECT_TRUE(
+      fake_wifi_hotspot_bwu_handler_->handle_initialize_calls().empty());
+  UnRegisterChannelForEndpoint(kEndpointId1);
+}
+
+TEST_F(BwuManagerRacingTest, Initiator_RevertsEveryOfferedMediumOnFailure) {
+  CreateInitialEndpoint(&client_, kServiceIdA, kEndpointId1, Medium::BLUETOOTH);
+  bwu_manager_->InitiateBwuForEndpoint(&client_, std::string(kEndpointId1),
+                                       Medium::WIFI_LAN);
+  ASSERT_EQ(fake_wifi_direct_bwu_handler_->handle_initialize_calls().size(),
+            1u);
+
+  // The Responder reports the last offered path when every path failed.
+  ExceptionOr<OfflineFrame> failure_frame =
+      parser::FromBytes(parser::ForBwuFailure(DirectUpgradePathInfo()));
+  bwu_manager_->OnIncomingFrame(failure_frame.result(),
+                                std::string(kEndpointId1), &client_,
+                                Medium::BLUETOOTH, packet_meta_data_);
+
+  EXPECT_EQ(fake_wifi_lan_bwu_handler_->handle_revert_calls().size(), 1u);
+  EXPECT_EQ(fake_wifi_direct_bwu_handler_->handle_revert_calls().size(), 1u);
+  UnRegisterChannelForEndpoint(kEndpointId1);
+}
+
 INSTANTIATE_TEST_SUITE_P(BwuManagerTestParam, BwuManagerTestParam,
                          testing::Bool());
 
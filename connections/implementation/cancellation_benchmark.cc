@@ -0,0 +1,248 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Latency from a cancellation to its callback, in simulation.
+//
+//   BM_CancelBusyStream      The sender cancels a STREAM payload between two
+//                            simulation users connected over Wi-Fi LAN, while
+//                            its source has data to send.
+//   BM_CancelStalledStream   Same, but the source has stopped producing data
+//                            and the sender is blocked reading it.
+//   BM_CancelStalledConnect  A Wi-Fi LAN connect that nobody accepts is
+//                            cancelled through its CancellationFlag.
+//   BM_PollCancellationFlag  Cost of checking an uncancelled flag, as the send
+//                            and connect loops do.
+// The first three benchmarks time each iteration from the cancellation until
+// the receiver is told, or the connect returns, and report this counter:
+//   cancel_to_callback_ms   Mean latency of the cancellation.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "benchmark/benchmark.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/notification.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "connections/implementation/simulation_user.h"
+#include "connections/implementation/simulation_user_pair.h"
+#include "connections/medium_selector.h"
+#include "connections/payload.h"
+#include "connections/payload_type.h"
+#include "internal/platform/byte_array.h"
+#include "internal/platform/cancellation_flag.h"
+#include "internal/platform/count_down_latch.h"
+#include "internal/platform/exception.h"
+#include "internal/platform/input_stream.h"
+#include "internal/platform/medium_environment.h"
+#include "internal/platform/nsd_service_info.h"
+#include "internal/platform/single_thread_executor.h"
+#include "internal/platform/wifi_lan.h"
+
+namespace nearby {
+namespace connections {
+namespace {
+
+constexpr absl::string_view kServiceId = "service-id";
+constexpr absl::Duration kTimeout = absl::Seconds(10);
+// Bytes the receiver must have before the sender cancels.
+constexpr std::int64_t kBytesBeforeCancel = 1024 * 1024;
+
+// Produces data until it is closed. A stalling stream only produces the first
+// read, then blocks, like a socket whose peer went quiet.
+class SourceInputStream : public InputStream {
+ public:
+  explicit SourceInputStream(bool stalls) : stalls_(stalls) {}
+
+  ExceptionOr<ByteArray> Read(std::int64_t size) override {
+    if (stalls_ && reads_++ > 0) closed_.WaitForNotification();
+    if (closed_.HasBeenNotified()) return {Exception::kIo};
+    return ExceptionOr<ByteArray>(ByteArray(std::string(size, 'x')));
+  }
+
+  Exception Close() override {
+    if (!closed_.HasBeenNotified()) closed_.Notify();
+    return {Exception::kSuccess};
+  }
+
+ private:
+  const bool stalls_;
+  int reads_ = 0;
+  absl::Notification closed_;
+};
+
+class CancellationSimulationUser : public SimulationUser {
+ public:
+  explicit CancellationSimulationUser(absl::string_view name)
+      : SimulationUser(std::string(name),
+                       BooleanMediumSelector{.wifi_lan = true}) {}
+
+  void SendPayload(Payload payload) {
+    pm_.SendPayload(&client_, {discovered_.endpoint_id}, std::move(payload));
+  }
+  void CancelPayload(Payload::Id payload_id) {
+    pm_.CancelPayload(&client_, payload_id);
+  }
+};
+
+// Sends and cancels streams between a connected sender and receiver. One
+// instance is shared by the stream benchmarks.
+class StreamSimulation {
+ public:
+  bool connected() const { return users_.connected(); }
+
+  // Sends a stream, cancels it on the sender once the receiver has some of
+  // it, and returns how long the receiver took to be told. Returns
+  // absl::InfiniteDuration() on failure.
+  absl::Duration SendAndCancelStream(bool stalls) {
+    CountDownLatch payload_latch(1);
+    users_.receiver().ExpectPayload(payload_latch);
+    Payload payload(std::make_unique<SourceInputStream>(stalls));
+    Payload::Id payload_id = payload.GetId();
+    users_.sender().SendPayload(std::move(payload));
+    if (!payload_latch.Await(kTimeout).result()) {
+      return absl::InfiniteDuration();
+    }
+    std::int64_t bytes_before_cancel = stalls ? 1 : kBytesBeforeCancel;
+    if (!users_.receiver().WaitForProgress(
+            [bytes_before_cancel](const PayloadProgressInfo& info) {
+              return info.bytes_transferred >= bytes_before_cancel;
+            },
+            kTimeout)) {
+      return absl::InfiniteDuration();
+    }
+
+    absl::Time start = absl::Now();
+    users_.sender().CancelPayload(payload_id);
+    bool canceled = users_.receiver().WaitForProgress(
+        [](const PayloadProgressInfo& info) {
+          return info.status == PayloadProgressInfo::Status::kCanceled;
+        },
+        kTimeout);
+    absl::Duration latency = absl::Now() - start;
+    users_.receiver().ExpectPayload(idle_latch_);
+    return canceled ? latency : absl::InfiniteDuration();
+  }
+
+ private:
+  SimulationUserPair<CancellationSimulationUser> users_{kServiceId, kTimeout};
+  // Parks the receiver's payload latch between streams.
+  CountDownLatch idle_latch_{1};
+};
+
+StreamSimulation& GetSimulation() {
+  static StreamSimulation* simulation = new StreamSimulation();
+  return *simulation;
+}
+
+void ReportLatency(benchmark::State& state, absl::Duration total_latency) {
+  state.counters["cancel_to_callback_ms"] = benchmark::Counter(
+      absl::ToDoubleMilliseconds(total_latency),
+      benchmark::Counter::kAvgIterations);
+}
+
+void RunStreamBenchmark(benchmark::State& state, bool stalls) {
+  StreamSimulation& simulation = GetSimulation();
+  if (!simulation.connected()) {
+    state.SkipWithError("Simulation users failed to connect.");
+    return;
+  }
+
+  absl::Duration total_latency;
+  for (auto _ : state) {
+    absl::Duration latency = simulation.SendAndCancelStream(stalls);
+    if (latency == absl::InfiniteDuration()) {
+      state.SkipWithError("The receiver was not told of the cancellation.");
+      return;
+    }
+    state.SetIterationTime(absl::ToDoubleSeconds(latency));
+    total_latency += latency;
+  }
+  ReportLatency(state, total_latency);
+}
+
+void BM_CancelBusyStream(benchmark::State& state) {
+  RunStreamBenchmark(state, /*stalls=*/false);
+}
+
+void BM_CancelStalledStream(benchmark::State& state) {
+  RunStreamBenchmark(state, /*stalls=*/true);
+}
+
+void BM_CancelStalledConnect(benchmark::State& state) {
+  // Shared with the stream simulation, if it runs too.
+  MediumEnvironment::Instance().Start();
+  WifiLanMedium client_medium;
+  WifiLanMedium server_medium;
+  absl::Duration total_latency;
+  for (auto _ : state) {
+    // Nobody accepts on the server socket, so the connect blocks.
+    WifiLanServerSocket server_socket = server_medium.ListenForService();
+    NsdServiceInfo nsd_service_info;
+    nsd_service_info.SetServiceName("stalled-service");
+    nsd_service_info.SetServiceType("_stalled._tcp");
+    nsd_service_info.SetIPAddress(server_socket.GetIPAddress());
+    nsd_service_info.SetPort(server_socket.GetPort());
+    server_medium.StartAdvertising(nsd_service_info);
+
+    CancellationFlag flag;
+    bool connected = false;
+    absl::Time returned_at;
+    absl::Time start;
+    {
+      SingleThreadExecutor client_executor;
+      client_executor.Execute([&]() {
+        WifiLanSocket socket =
+            client_medium.ConnectToService(nsd_service_info, &flag);
+        returned_at = absl::Now();
+        connected = socket.IsValid();
+      });
+      // Give the connect time to block before cancelling it.
+      absl::SleepFor(absl::Milliseconds(10));
+      start = absl::Now();
+      flag.Cancel();
+    }
+    server_medium.StopAdvertising(nsd_service_info);
+    server_socket.Close();
+    if (connected) {
+      state.SkipWithError("The connect was not cancelled.");
+      return;
+    }
+    state.SetIterationTime(absl::ToDoubleSeconds(returned_at - start));
+    total_latency += returned_at - start;
+  }
+  ReportLatency(state, total_latency);
+}
+
+void BM_PollCancellationFlag(benchmark::State& state) {
+  CancellationFlag flag;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(flag.Cancelled());
+  }
+}
+
+BENCHMARK(BM_CancelBusyStream)->Unit(benchmark::kMillisecond)->UseManualTime();
+BENCHMARK(BM_CancelStalledStream)
+    ->Unit(benchmark::kMillisecond)
+    ->UseManualTime();
+BENCHMARK(BM_CancelStalledConnect)
+    ->Unit(benchmark::kMillisecond)
+    ->UseManualTime();
+BENCHMARK(BM_PollCancellationFlag)->ThreadRange(1, 8);
+
+}  // namespace
+}  // namespace connections
+}  // namespace nearby
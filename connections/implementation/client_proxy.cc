@@ -958,6 +958,39 @@ void ClientProxy::SetRemoteOsInfo(absl::string_view endpoint_id,
   }
 }
 
+void ClientProxy::SetRemoteSupportsPayloadHeaderElision(
+    absl::string_view endpoint_id) {
+  MutexLock lock(&mutex_);
+  ConnectionPair* item = LookupConnection(endpoint_id);
+  if (item != nullptr) {
+    item->first.supports_payload_header_elision = true;
+  }
+}
+
+bool ClientProxy::IsPayloadHeaderElisionEnabled(
+    absl::string_view endpoint_id) const {
+  if (!FeatureFlags::GetInstance().GetFlags().enable_payload_header_elision) {
+    return false;
+  }
+  MutexLock lock(&mutex_);
+  const ConnectionPair* item = LookupConnection(endpoint_id);
+  return item != nullptr && item->first.supports_payload_header_elision;
+}
+
+void ClientProxy::SetRemoteSupportsDatagram(absl::string_view endpoint_id) {
+  MutexLock lock(&mutex_);
+  ConnectionPair* item = LookupConnection(endpoint_id);
+  if (item != nullptr) {
+    item->first.supports_datagram = true;
+  }
+}
+
+bool ClientProxy::SupportsDatagram(absl::string_view endpoint_id) const {
+  MutexLock lock(&mutex_);
+  const ConnectionPair* item = LookupConnection(endpoint_id);
+  return item != nullptr && item->first.supports_datagram;
+}
+
 std::optional<std::int32_t> ClientProxy::GetRemoteSafeToDisconnectVersion(
     absl::string_view endpoint_id) const {
   MutexLock lock(&mutex_);
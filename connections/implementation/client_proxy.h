@@ -30,6 +30,7 @@
 #include "connections/discovery_options.h"
 #include "connections/implementation/analytics/analytics_recorder.h"
 #include "connections/implementation/proto/offline_wire_formats.pb.h"
+#include "connections/implementation/shared_key_hub.h"
 #include "connections/listeners.h"
 #include "connections/medium_selector.h"
 #include "connections/payload.h"
@@ -81,6 +82,10 @@ class ClientProxy final {
     return *analytics_recorder_;
   }
 
+  // Sessions of the accepted connections of this client, from which its later
+  // connections to the same devices derive their keys.
+  SharedKeyHub& GetSharedKeyHub() { return *shared_key_hub_; }
+
   std::string GetConnectionToken(const std::string& endpoint_id);
   std::optional<std::string> GetBluetoothMacAddress(
       const std::string& endpoint_id);
@@ -292,6 +297,17 @@ class ClientProxy final {
       absl::string_view endpoint_id,
       const location::nearby::connections::OsInfo& remote_os_info);
 
+  // Records that the remote device can receive DATA frames whose payload
+  // header was elided after the first frame of a payload.
+  void SetRemoteSupportsPayloadHeaderElision(absl::string_view endpoint_id);
+  // Returns true if payload headers sent to the endpoint can be elided.
+  bool IsPayloadHeaderElisionEnabled(absl::string_view endpoint_id) const;
+
+  // Records that the remote device can receive DATAGRAM payloads.
+  void SetRemoteSupportsDatagram(absl::string_view endpoint_id);
+  // Returns true if DATAGRAM payloads can be sent to the endpoint.
+  bool SupportsDatagram(absl::string_view endpoint_id) const;
+
   void RegisterDeviceProvider(NearbyDeviceProvider* provider) {
     external_device_provider_ = provider;
   }
@@ -383,6 +399,8 @@ class ClientProxy final {
     std::optional<location::nearby::connections::OsInfo> os_info;
     std::int32_t safe_to_disconnect_version;
     std::int32_t remote_multiplex_socket_bitmask;
+    bool supports_payload_header_elision{false};
+    bool supports_datagram{false};
   };
   using ConnectionPair = std::pair<Connection, PayloadListener>;
 
@@ -516,6 +534,9 @@ class ClientProxy final {
   NearbyDeviceProvider* external_device_provider_ = nullptr;
   // For Nearby Connections' own device provider.
   std::unique_ptr<v3::ConnectionsDeviceProvider> connections_device_provider_;
+  // Held by pointer, so that ClientProxy stays movable.
+  std::unique_ptr<SharedKeyHub> shared_key_hub_ =
+      std::make_unique<SharedKeyHub>();
   bool supports_safe_to_disconnect_;
   bool support_auto_reconnect_;
   std::int32_t local_safe_to_disconnect_version_;
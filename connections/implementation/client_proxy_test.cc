@@ -33,6 +33,7 @@
 #include "connections/advertising_options.h"
 #include "connections/connection_options.h"
 #include "connections/discovery_options.h"
+#include "connections/implementation/endpoint_channel.h"
 #include "connections/implementation/flags/nearby_connections_feature_flags.h"
 #include "connections/listeners.h"
 #include "connections/medium_selector.h"
@@ -55,6 +56,7 @@
 #include "internal/platform/mutex.h"
 #include "internal/platform/mutex_lock.h"
 #include "proto/connections_enums.pb.h"
+#include "securemessage/crypto_ops.h"
 
 namespace nearby {
 namespace connections {
@@ -66,6 +68,7 @@ using ::location::nearby::proto::connections::CLIENT_SESSION;
 using ::location::nearby::proto::connections::START_CLIENT_SESSION;
 using ::location::nearby::proto::connections::STOP_CLIENT_SESSION;
 using ::testing::MockFunction;
+using ::securemessage::CryptoOps;
 using ::testing::StrictMock;
 
 constexpr FeatureFlags::Flags kTestCases[] = {
@@ -1601,6 +1604,24 @@ TEST_F(ClientProxyTest, TestRemoteMultiplexSocketBitmask) {
       false);
 }
 
+TEST_F(ClientProxyTest, SharedKeySessionsArePerClient) {
+  ByteArray remote_endpoint_info("remote");
+  EndpointChannel::EncryptionContext context(
+      CryptoOps::SecretKey(std::string(32, 'a'), CryptoOps::AES_256_KEY),
+      CryptoOps::SecretKey(std::string(32, 'b'), CryptoOps::AES_256_KEY),
+      0, 0);
+  client1()->GetSharedKeyHub().AddSession(remote_endpoint_info, context);
+
+  EXPECT_TRUE(client1()
+                  ->GetSharedKeyHub()
+                  .CreateOffer(remote_endpoint_info)
+                  .has_value());
+  EXPECT_FALSE(client2()
+                   ->GetSharedKeyHub()
+                   .CreateOffer(remote_endpoint_info)
+                   .has_value());
+}
+
 }  // namespace
 }  // namespace connections
 }  // namespace nearby
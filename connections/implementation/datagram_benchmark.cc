@@ -0,0 +1,224 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Latency of frequently superseded state updates, sent as BYTES or DATAGRAM
+// payloads between two simulation users connected over Wi-Fi LAN.
+//
+// The sender produces small position updates at a constant rate, each
+// stamped with the time it was produced. The simulated link does not lose
+// frames, so loss is modeled at the sender with the benchmark argument as
+// the loss rate in percent: a lost DATAGRAM is never sent, while a lost BYTES
+// payload is sent again after kRetransmitTimeout and holds back the updates
+// behind it, as a reliable ordered transport would. The last update is never
+// lost. Each benchmark reports these counters:
+//   p50_ms, p90_ms, p99_ms, max_ms
+//                   Update latency from production to delivery.
+//   lost_updates    Updates that were never delivered, per run.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "connections/implementation/simulation_user.h"
+#include "connections/implementation/simulation_user_pair.h"
+#include "connections/listeners.h"
+#include "connections/medium_selector.h"
+#include "connections/payload.h"
+#include "internal/platform/byte_array.h"
+#include "internal/platform/count_down_latch.h"
+#include "internal/platform/mutex.h"
+#include "internal/platform/mutex_lock.h"
+
+namespace nearby {
+namespace connections {
+namespace {
+
+constexpr absl::string_view kServiceId = "service-id";
+constexpr absl::Duration kTimeout = absl::Seconds(10);
+// 64 byte updates every 5ms, e.g. cursor positions at 200 Hz.
+constexpr int kUpdateSize = 64;
+constexpr absl::Duration kUpdateInterval = absl::Milliseconds(5);
+constexpr int kUpdatesPerRun = 200;
+constexpr absl::Duration kRetransmitTimeout = absl::Milliseconds(100);
+
+// The latencies of the updates delivered during one run.
+struct Run {
+  std::vector<absl::Duration> latencies;
+  CountDownLatch last_update_latch{1};
+};
+
+class DatagramSimulationUser : public SimulationUser {
+ public:
+  explicit DatagramSimulationUser(absl::string_view name)
+      : SimulationUser(std::string(name),
+                       BooleanMediumSelector{.wifi_lan = true}) {}
+
+  void SendPayload(Payload payload) {
+    pm_.SendPayload(&client_, {discovered_.endpoint_id}, std::move(payload));
+  }
+
+  // Accepts the connection and records the latency of every update received
+  // into the current run. Hides SimulationUser::AcceptConnection().
+  void AcceptConnection(CountDownLatch* latch) {
+    accept_latch_ = latch;
+    PayloadListener listener = {
+        .payload_cb = [this](absl::string_view,
+                             Payload payload) { OnUpdate(payload); },
+    };
+    mgr_.AcceptConnection(&client_, discovered_.endpoint_id,
+                          std::move(listener));
+  }
+
+  void SetRun(Run* run) {
+    MutexLock lock(&run_mutex_);
+    run_ = run;
+  }
+
+ private:
+  void OnUpdate(const Payload& payload) {
+    absl::Time received_at = absl::Now();
+    const ByteArray& bytes = payload.AsBytes();
+    std::int64_t produced_at_nanos;
+    std::int32_t index;
+    if (bytes.size() < sizeof(produced_at_nanos) + sizeof(index)) return;
+    std::memcpy(&produced_at_nanos, bytes.data(), sizeof(produced_at_nanos));
+    std::memcpy(&index, bytes.data() + sizeof(produced_at_nanos),
+                sizeof(index));
+    MutexLock lock(&run_mutex_);
+    if (run_ == nullptr) return;
+    run_->latencies.push_back(received_at -
+                              absl::FromUnixNanos(produced_at_nanos));
+    if (index == kUpdatesPerRun - 1) run_->last_update_latch.CountDown();
+  }
+
+  Mutex run_mutex_;
+  Run* run_ ABSL_GUARDED_BY(run_mutex_) = nullptr;
+};
+
+// Sends updates between a connected sender and receiver. One instance is
+// shared by all benchmarks.
+class DatagramSimulation {
+ public:
+  bool connected() const { return users_.connected(); }
+
+  // Sends kUpdatesPerRun updates, losing each one with probability
+  // |loss_percent| / 100, and returns the latency of every update delivered.
+  std::vector<absl::Duration> SendUpdates(bool datagram, int loss_percent) {
+    Run run;
+    users_.receiver().SetRun(&run);
+    std::bernoulli_distribution lost(loss_percent / 100.0);
+    absl::Time start = absl::Now();
+    for (std::int32_t index = 0; index < kUpdatesPerRun; ++index) {
+      absl::Time produced_at = start + index * kUpdateInterval;
+      absl::SleepFor(produced_at - absl::Now());
+      std::string update(kUpdateSize, '\0');
+      std::int64_t produced_at_nanos = absl::ToUnixNanos(produced_at);
+      std::memcpy(update.data(), &produced_at_nanos,
+                  sizeof(produced_at_nanos));
+      std::memcpy(update.data() + sizeof(produced_at_nanos), &index,
+                  sizeof(index));
+      if (index < kUpdatesPerRun - 1 && lost(random_)) {
+        if (datagram) continue;
+        absl::SleepFor(produced_at + kRetransmitTimeout - absl::Now());
+      }
+      users_.sender().SendPayload(
+          datagram ? Payload::Datagram(ByteArray(std::move(update)), index)
+                   : Payload(ByteArray(std::move(update))));
+    }
+    run.last_update_latch.Await(kTimeout);
+    users_.receiver().SetRun(nullptr);
+    return std::move(run.latencies);
+  }
+
+ private:
+  SimulationUserPair<DatagramSimulationUser> users_{kServiceId, kTimeout};
+  // Fixed seed, so every benchmark loses the same updates.
+  std::mt19937 random_{42};
+};
+
+DatagramSimulation& GetSimulation() {
+  static DatagramSimulation* simulation = new DatagramSimulation();
+  return *simulation;
+}
+
+double ToMs(absl::Duration duration) {
+  return absl::ToDoubleMilliseconds(duration);
+}
+
+void RunUpdateBenchmark(benchmark::State& state, bool datagram) {
+  DatagramSimulation& simulation = GetSimulation();
+  if (!simulation.connected()) {
+    state.SkipWithError("Simulation users failed to connect.");
+    return;
+  }
+
+  std::vector<absl::Duration> latencies;
+  std::int64_t updates_sent = 0;
+  for (auto _ : state) {
+    std::vector<absl::Duration> run_latencies =
+        simulation.SendUpdates(datagram, state.range(0));
+    latencies.insert(latencies.end(), run_latencies.begin(),
+                     run_latencies.end());
+    updates_sent += kUpdatesPerRun;
+  }
+  if (latencies.empty()) {
+    state.SkipWithError("No updates received.");
+    return;
+  }
+
+  std::sort(latencies.begin(), latencies.end());
+  auto percentile = [&latencies](int p) {
+    return ToMs(latencies[(latencies.size() - 1) * p / 100]);
+  };
+  state.counters["p50_ms"] = percentile(50);
+  state.counters["p90_ms"] = percentile(90);
+  state.counters["p99_ms"] = percentile(99);
+  state.counters["max_ms"] = ToMs(latencies.back());
+  state.counters["lost_updates"] = benchmark::Counter(
+      updates_sent - latencies.size(), benchmark::Counter::kAvgIterations);
+}
+
+void BM_BytesUpdateLatency(benchmark::State& state) {
+  RunUpdateBenchmark(state, /*datagram=*/false);
+}
+
+void BM_DatagramUpdateLatency(benchmark::State& state) {
+  RunUpdateBenchmark(state, /*datagram=*/true);
+}
+
+BENCHMARK(BM_BytesUpdateLatency)
+    ->Arg(0)
+    ->Arg(1)
+    ->Arg(5)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_DatagramUpdateLatency)
+    ->Arg(0)
+    ->Arg(1)
+    ->Arg(5)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace connections
+}  // namespace nearby
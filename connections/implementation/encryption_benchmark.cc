@@ -0,0 +1,242 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Time to encrypt a new connection to a device, as the first service that
+// connects to it and as a later service that derives its keys from the
+// session shared with the device.
+//
+// A server and a client EncryptionRunner talk over in-memory pipes, so the
+// medium is not measured. Each iteration encrypts one connection, up to the
+// point where both sides hold a connection context:
+//   BM_Ukey2Handshake       A full UKEY2 handshake.
+//   BM_SharedKeyHandshake   Keys derived from a SharedKeyHub session.
+// Each benchmark reports this counter:
+//   handshakes_per_second   Connections encrypted per second.
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "benchmark/benchmark.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/time.h"
+#include "connections/implementation/client_proxy.h"
+#include "connections/implementation/encryption_runner.h"
+#include "connections/implementation/endpoint_channel.h"
+#include "connections/implementation/fake_endpoint_channel.h"
+#include "connections/implementation/shared_key_hub.h"
+#include "internal/platform/byte_array.h"
+#include "internal/platform/count_down_latch.h"
+#include "internal/platform/exception.h"
+#include "internal/platform/input_stream.h"
+#include "internal/platform/output_stream.h"
+#include "internal/platform/pipe.h"
+#include "proto/connections_enums.pb.h"
+#include "securegcm/ukey2_handshake.h"
+
+namespace nearby {
+namespace connections {
+namespace {
+
+using ::location::nearby::proto::connections::Medium;
+using EncryptionContext = EndpointChannel::EncryptionContext;
+
+constexpr absl::string_view kServiceId = "service-id";
+constexpr absl::Duration kTimeout = absl::Seconds(10);
+constexpr int kMaxReadSize = 64 * 1024;
+
+// An endpoint channel that reads from and writes to in-memory pipes.
+class PipeEndpointChannel : public FakeEndpointChannel {
+ public:
+  PipeEndpointChannel(InputStream* in, OutputStream* out)
+      : FakeEndpointChannel(Medium::WIFI_LAN, std::string(kServiceId)),
+        in_(in),
+        out_(out) {}
+
+  ExceptionOr<ByteArray> Read() override { return in_->Read(kMaxReadSize); }
+  ExceptionOr<ByteArray> Read(PacketMetaData& packet_meta_data) override {
+    return Read();
+  }
+  Exception Write(const ByteArray& data) override { return out_->Write(data); }
+  Exception Write(const ByteArray& data,
+                  PacketMetaData& packet_meta_data) override {
+    return Write(data);
+  }
+  void Close() override {
+    in_->Close();
+    out_->Close();
+  }
+
+ private:
+  InputStream* in_;
+  OutputStream* out_;
+};
+
+// The channels of one connection between the server and the client.
+class Connection {
+ public:
+  Connection()
+      : to_server_(CreatePipe()),
+        to_client_(CreatePipe()),
+        server_channel_(to_server_.first.get(), to_client_.second.get()),
+        client_channel_(to_client_.first.get(), to_server_.second.get()) {}
+
+  EndpointChannel* server_channel() { return &server_channel_; }
+  EndpointChannel* client_channel() { return &client_channel_; }
+
+ private:
+  std::pair<std::unique_ptr<InputStream>, std::unique_ptr<OutputStream>>
+      to_server_;
+  std::pair<std::unique_ptr<InputStream>, std::unique_ptr<OutputStream>>
+      to_client_;
+  PipeEndpointChannel server_channel_;
+  PipeEndpointChannel client_channel_;
+};
+
+// The connection contexts that both sides end up with.
+struct Contexts {
+  std::unique_ptr<EncryptionContext> server;
+  std::unique_ptr<EncryptionContext> client;
+};
+
+// Stores the connection context of one side of a handshake in |context|.
+EncryptionRunner::ResultListener CreateListener(
+    std::unique_ptr<EncryptionContext>& context, CountDownLatch& latch) {
+  return {
+      .on_success_cb =
+          [&context, &latch](const std::string& endpoint_id,
+                             std::unique_ptr<securegcm::UKey2Handshake> ukey2,
+                             const std::string& auth_token,
+                             const ByteArray& raw_auth_token) {
+            // Done by BasePcpHandler once both sides accept the connection.
+            if (ukey2->VerifyHandshake()) {
+              context = ukey2->ToConnectionContext();
+            }
+            latch.CountDown();
+          },
+      .on_shared_key_success_cb =
+          [&context, &latch](
+              const std::string& endpoint_id,
+              std::unique_ptr<EncryptionContext> shared_key_context,
+              const std::string& auth_token, const ByteArray& raw_auth_token) {
+            context = std::move(shared_key_context);
+            latch.CountDown();
+          },
+      .on_failure_cb =
+          [&latch](const std::string& endpoint_id, EndpointChannel* channel) {
+            channel->Close();
+            latch.CountDown();
+          },
+  };
+}
+
+// A server and a client device, and the sessions that they share.
+class EncryptionSimulation {
+ public:
+  // Encrypts a connection with UKEY2. Returns false on failure.
+  bool RunUkey2Handshake(Contexts& contexts) {
+    Connection connection;
+    CountDownLatch latch(2);
+    server_.StartServer(&server_client_, "client", connection.server_channel(),
+                        CreateListener(contexts.server, latch));
+    client_.StartClient(&client_client_, "server", connection.client_channel(),
+                        CreateListener(contexts.client, latch));
+    return latch.Await(kTimeout).result() && contexts.server != nullptr &&
+           contexts.client != nullptr;
+  }
+
+  // Encrypts a connection with keys derived from the shared session, as
+  // BasePcpHandler does for a device that it is already connected to.
+  bool RunSharedKeyHandshake(Contexts& contexts) {
+    std::optional<SharedKey> offer =
+        client_hub_.CreateOffer(ByteArray("server"));
+    if (!offer.has_value()) return false;
+    std::optional<SharedKey> accepted =
+        server_hub_.AcceptOffer(offer->session_tag, offer->client_nonce);
+    if (!accepted.has_value()) return false;
+
+    Connection connection;
+    CountDownLatch latch(2);
+    server_.StartSharedKeyServer(&server_client_, "client",
+                                 connection.server_channel(),
+                                 std::move(accepted),
+                                 CreateListener(contexts.server, latch));
+    client_.StartSharedKeyClient(&client_client_, "server",
+                                 connection.client_channel(), *std::move(offer),
+                                 CreateListener(contexts.client, latch));
+    return latch.Await(kTimeout).result() && contexts.server != nullptr &&
+           contexts.client != nullptr;
+  }
+
+  // Encrypts a first connection with UKEY2 and shares its session. Returns
+  // false on failure.
+  bool ShareSession() {
+    Contexts contexts;
+    if (!RunUkey2Handshake(contexts)) return false;
+    server_hub_.AddSession(ByteArray("client"), *contexts.server);
+    client_hub_.AddSession(ByteArray("server"), *contexts.client);
+    return true;
+  }
+
+ private:
+  EncryptionRunner server_;
+  EncryptionRunner client_;
+  ClientProxy server_client_;
+  ClientProxy client_client_;
+  SharedKeyHub server_hub_;
+  SharedKeyHub client_hub_;
+};
+
+EncryptionSimulation& GetSimulation() {
+  static EncryptionSimulation* simulation = new EncryptionSimulation();
+  return *simulation;
+}
+
+void BM_Ukey2Handshake(benchmark::State& state) {
+  EncryptionSimulation& simulation = GetSimulation();
+  for (auto _ : state) {
+    Contexts contexts;
+    if (!simulation.RunUkey2Handshake(contexts)) {
+      state.SkipWithError("UKEY2 handshake failed.");
+      return;
+    }
+  }
+  state.counters["handshakes_per_second"] =
+      benchmark::Counter(state.iterations(), benchmark::Counter::kIsRate);
+}
+
+void BM_SharedKeyHandshake(benchmark::State& state) {
+  EncryptionSimulation& simulation = GetSimulation();
+  if (!simulation.ShareSession()) {
+    state.SkipWithError("Unable to share a session.");
+    return;
+  }
+  for (auto _ : state) {
+    Contexts contexts;
+    if (!simulation.RunSharedKeyHandshake(contexts)) {
+      state.SkipWithError("Shared key handshake failed.");
+      return;
+    }
+  }
+  state.counters["handshakes_per_second"] =
+      benchmark::Counter(state.iterations(), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_Ukey2Handshake)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_SharedKeyHandshake)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+}  // namespace
+}  // namespace connections
+}  // namespace nearby
@@ -14,34 +14,57 @@
 
 #include "connections/implementation/encryption_runner.h"
 
+#include <algorithm>
 #include <cinttypes>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
+#include <tuple>
 #include <utility>
 
 #include "securegcm/ukey2_handshake.h"
+#include "securemessage/crypto_ops.h"
 #include "absl/strings/ascii.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "connections/implementation/client_proxy.h"
 #include "connections/implementation/endpoint_channel.h"
+#include "connections/implementation/proto/offline_wire_formats.pb.h"
+#include "connections/implementation/shared_key_hub.h"
+#include "internal/crypto_cros/hkdf.h"
+#include "internal/crypto_cros/secure_util.h"
 #include "internal/platform/base64_utils.h"
 #include "internal/platform/byte_array.h"
 #include "internal/platform/cancelable_alarm.h"
 #include "internal/platform/exception.h"
+#include "internal/platform/implementation/system_clock.h"
 #include "internal/platform/logging.h"
+#include "internal/platform/multi_thread_executor.h"
+#include "internal/platform/mutex_lock.h"
+#include "internal/platform/runnable.h"
 #include "internal/platform/scheduled_executor.h"
 
 namespace nearby {
 namespace connections {
 namespace {
 
+using ::location::nearby::connections::SharedKeyFrame;
+
 constexpr absl::Duration kTimeout = absl::Seconds(15);
 constexpr std::int32_t kMaxUkey2VerificationStringLength = 32;
 constexpr std::int32_t kTokenLength = 5;
 constexpr securegcm::UKey2Handshake::HandshakeCipher kCipher =
     securegcm::UKey2Handshake::HandshakeCipher::P256_SHA512;
+constexpr std::size_t kSharedKeyDerivedSize = 32;
+constexpr absl::string_view kClientKeyInfo = "client key";
+constexpr absl::string_view kServerKeyInfo = "server key";
+constexpr absl::string_view kClientConfirmationInfo = "client confirmation";
+constexpr absl::string_view kServerConfirmationInfo = "server confirmation";
+constexpr absl::string_view kAuthTokenInfo = "auth token";
 
 // Transforms a raw UKEY2 token (which is a random ByteArray that's
 // kMaxUkey2VerificationStringLength long) into a kTokenLength string that only
@@ -70,6 +93,54 @@ bool HandleEncryptionSuccess(const std::string& endpoint_id,
   return true;
 }
 
+// Derives a value for the connection from |shared_key| and both nonces. |info|
+// tells apart the values derived for different uses.
+std::string DeriveFromSharedKey(const SharedKey& shared_key,
+                                absl::string_view server_nonce,
+                                absl::string_view info) {
+  return crypto::HkdfSha256(shared_key.secret,
+                            absl::StrCat(shared_key.client_nonce, server_nonce),
+                            info, kSharedKeyDerivedSize);
+}
+
+bool VerifySharedKeyConfirmation(const SharedKey& shared_key,
+                                 absl::string_view server_nonce,
+                                 absl::string_view info,
+                                 absl::string_view confirmation) {
+  std::string expected = DeriveFromSharedKey(shared_key, server_nonce, info);
+  return confirmation.size() == expected.size() &&
+         crypto::SecureMemEqual(confirmation.data(), expected.data(),
+                                expected.size());
+}
+
+ByteArray ToBytes(const SharedKeyFrame& frame) {
+  return ByteArray(frame.SerializeAsString());
+}
+
+void HandleSharedKeySuccess(const std::string& endpoint_id,
+                            const SharedKey& shared_key,
+                            absl::string_view server_nonce, bool is_client,
+                            EncryptionRunner::ResultListener& listener) {
+  securemessage::CryptoOps::SecretKey client_key(
+      DeriveFromSharedKey(shared_key, server_nonce, kClientKeyInfo),
+      securemessage::CryptoOps::AES_256_KEY);
+  securemessage::CryptoOps::SecretKey server_key(
+      DeriveFromSharedKey(shared_key, server_nonce, kServerKeyInfo),
+      securemessage::CryptoOps::AES_256_KEY);
+  // Both sides start a fresh D2D session at sequence number zero.
+  auto context = std::make_unique<EndpointChannel::EncryptionContext>(
+      is_client ? client_key : server_key, is_client ? server_key : client_key,
+      /*encode_sequence_number=*/0, /*decode_sequence_number=*/0);
+
+  ByteArray raw_authentication_token(
+      DeriveFromSharedKey(shared_key, server_nonce, kAuthTokenInfo));
+
+  listener.CallSharedKeySuccessCallback(
+      endpoint_id, std::move(context),
+      ToHumanReadableString(raw_authentication_token),
+      raw_authentication_token);
+}
+
 void CancelableAlarmRunnable(ClientProxy* client,
                              const std::string& endpoint_id,
                              EndpointChannel* endpoint_channel) {
@@ -80,22 +151,45 @@ void CancelableAlarmRunnable(ClientProxy* client,
   endpoint_channel->Close();
 }
 
+// Returns the time left until |deadline|, when the remote device gives up on
+// the handshake.
+absl::Duration TimeLeft(absl::Time deadline) {
+  return std::max(deadline - SystemClock::ElapsedRealtime(),
+                  absl::ZeroDuration());
+}
+
+// Returns true if the remote device gave up on the handshake while it waited
+// for a worker, so that it fails without any crypto work.
+bool HasExpired(absl::Time deadline, const std::string& endpoint_id) {
+  if (TimeLeft(deadline) > absl::ZeroDuration()) return false;
+  NEARBY_LOGS(WARNING) << "Dropping the expired encryption handshake with "
+                          "endpoint(id="
+                       << endpoint_id << ").";
+  return true;
+}
+
 class ServerRunnable final {
  public:
   ServerRunnable(ClientProxy* client, ScheduledExecutor* alarm_executor,
-                 const std::string& endpoint_id, EndpointChannel* channel,
+                 absl::Time deadline, const std::string& endpoint_id,
+                 EndpointChannel* channel,
                  EncryptionRunner::ResultListener listener)
       : client_(client),
         alarm_executor_(alarm_executor),
+        deadline_(deadline),
         endpoint_id_(endpoint_id),
         channel_(channel),
         listener_(std::move(listener)) {}
 
   void operator()() {
+    if (HasExpired(deadline_, endpoint_id_)) {
+      listener_.CallFailureCallback(endpoint_id_, channel_);
+      return;
+    }
     CancelableAlarm timeout_alarm(
         "EncryptionRunner.StartServer() timeout",
         [this]() { CancelableAlarmRunnable(client_, endpoint_id_, channel_); },
-        kTimeout, alarm_executor_);
+        TimeLeft(deadline_), alarm_executor_);
 
     std::unique_ptr<securegcm::UKey2Handshake> server =
         securegcm::UKey2Handshake::ForResponder(kCipher);
@@ -188,6 +282,9 @@ class ServerRunnable final {
     }
   }
 
+  // Reports the handshake as failed without running it.
+  void Fail() { listener_.CallFailureCallback(endpoint_id_, channel_); }
+
  private:
   void LogException() const {
     NEARBY_LOGS(ERROR) << "In StartServer(), UKEY2 failed with endpoint(id="
@@ -213,6 +310,7 @@ class ServerRunnable final {
 
   ClientProxy* client_;
   ScheduledExecutor* alarm_executor_;
+  const absl::Time deadline_;
   const std::string endpoint_id_;
   EndpointChannel* channel_;
   EncryptionRunner::ResultListener listener_;
@@ -221,19 +319,25 @@ class ServerRunnable final {
 class ClientRunnable final {
  public:
   ClientRunnable(ClientProxy* client, ScheduledExecutor* alarm_executor,
-                 const std::string& endpoint_id, EndpointChannel* channel,
+                 absl::Time deadline, const std::string& endpoint_id,
+                 EndpointChannel* channel,
                  EncryptionRunner::ResultListener listener)
       : client_(client),
         alarm_executor_(alarm_executor),
+        deadline_(deadline),
         endpoint_id_(endpoint_id),
         channel_(channel),
         listener_(std::move(listener)) {}
 
   void operator()() {
+    if (HasExpired(deadline_, endpoint_id_)) {
+      listener_.CallFailureCallback(endpoint_id_, channel_);
+      return;
+    }
     CancelableAlarm timeout_alarm(
         "EncryptionRunner.StartClient() timeout",
         [this]() { CancelableAlarmRunnable(client_, endpoint_id_, channel_); },
-        kTimeout, alarm_executor_);
+        TimeLeft(deadline_), alarm_executor_);
 
     std::unique_ptr<securegcm::UKey2Handshake> crypto =
         securegcm::UKey2Handshake::ForInitiator(kCipher);
@@ -325,6 +429,9 @@ class ClientRunnable final {
     }
   }
 
+  // Reports the handshake as failed without running it.
+  void Fail() { listener_.CallFailureCallback(endpoint_id_, channel_); }
+
  private:
   void LogException() const {
     NEARBY_LOGS(ERROR) << "In StartClient(), UKEY2 failed with endpoint(id="
@@ -350,11 +457,220 @@ class ClientRunnable final {
 
   ClientProxy* client_;
   ScheduledExecutor* alarm_executor_;
+  const absl::Time deadline_;
   const std::string endpoint_id_;
   EndpointChannel* channel_;
   EncryptionRunner::ResultListener listener_;
 };
 
+class SharedKeyServerRunnable final {
+ public:
+  SharedKeyServerRunnable(ClientProxy* client,
+                          ScheduledExecutor* alarm_executor,
+                          absl::Time deadline,
+                          const std::string& endpoint_id,
+                          EndpointChannel* channel,
+                          std::optional<SharedKey> shared_key,
+                          EncryptionRunner::ResultListener listener)
+      : client_(client),
+        alarm_executor_(alarm_executor),
+        deadline_(deadline),
+        endpoint_id_(endpoint_id),
+        channel_(channel),
+        shared_key_(std::move(shared_key)),
+        listener_(std::move(listener)) {}
+
+  void operator()() {
+    if (HasExpired(deadline_, endpoint_id_)) {
+      listener_.CallFailureCallback(endpoint_id_, channel_);
+      return;
+    }
+    if (!shared_key_.has_value()) {
+      NEARBY_LOGS(INFO) << "In StartSharedKeyServer(), declining the shared "
+                           "key offered by endpoint(id="
+                        << endpoint_id_ << ").";
+      SharedKeyFrame decline;
+      decline.set_type(SharedKeyFrame::DECLINE);
+      if (!channel_->Write(ToBytes(decline)).Ok()) {
+        LogException();
+        listener_.CallFailureCallback(endpoint_id_, channel_);
+        return;
+      }
+      ServerRunnable ukey2_runnable(client_, alarm_executor_, deadline_,
+                                    endpoint_id_, channel_,
+                                    std::move(listener_));
+      ukey2_runnable();
+      return;
+    }
+
+    CancelableAlarm timeout_alarm(
+        "EncryptionRunner.StartSharedKeyServer() timeout",
+        [this]() { CancelableAlarmRunnable(client_, endpoint_id_, channel_); },
+        TimeLeft(deadline_), alarm_executor_);
+
+    std::string server_nonce = SharedKeyHub::GenerateNonce();
+    SharedKeyFrame server_init;
+    server_init.set_type(SharedKeyFrame::SERVER_INIT);
+    server_init.set_nonce(server_nonce);
+    server_init.set_confirmation(DeriveFromSharedKey(
+        *shared_key_, server_nonce, kServerConfirmationInfo));
+    if (!channel_->Write(ToBytes(server_init)).Ok()) {
+      LogException();
+      HandleException(&timeout_alarm);
+      return;
+    }
+
+    ExceptionOr<ByteArray> client_finish_bytes = channel_->Read();
+    if (!client_finish_bytes.ok()) {
+      LogException();
+      HandleException(&timeout_alarm);
+      return;
+    }
+
+    SharedKeyFrame client_finish;
+    if (!client_finish.ParseFromString(
+            std::string(client_finish_bytes.result())) ||
+        client_finish.type() != SharedKeyFrame::CLIENT_FINISH ||
+        !VerifySharedKeyConfirmation(*shared_key_, server_nonce,
+                                     kClientConfirmationInfo,
+                                     client_finish.confirmation())) {
+      LogException();
+      HandleException(&timeout_alarm);
+      return;
+    }
+
+    timeout_alarm.Cancel();
+
+    HandleSharedKeySuccess(endpoint_id_, *shared_key_, server_nonce,
+                           /*is_client=*/false, listener_);
+  }
+
+  // Reports the handshake as failed without running it.
+  void Fail() { listener_.CallFailureCallback(endpoint_id_, channel_); }
+
+ private:
+  void LogException() const {
+    NEARBY_LOGS(ERROR)
+        << "In StartSharedKeyServer(), shared key failed with endpoint(id="
+        << endpoint_id_ << ").";
+  }
+
+  void HandleException(CancelableAlarm* timeout_alarm) {
+    timeout_alarm->Cancel();
+    listener_.CallFailureCallback(endpoint_id_, channel_);
+  }
+
+  ClientProxy* client_;
+  ScheduledExecutor* alarm_executor_;
+  const absl::Time deadline_;
+  const std::string endpoint_id_;
+  EndpointChannel* channel_;
+  std::optional<SharedKey> shared_key_;
+  EncryptionRunner::ResultListener listener_;
+};
+
+class SharedKeyClientRunnable final {
+ public:
+  SharedKeyClientRunnable(ClientProxy* client,
+                          ScheduledExecutor* alarm_executor,
+                          absl::Time deadline,
+                          const std::string& endpoint_id,
+                          EndpointChannel* channel, SharedKey shared_key,
+                          EncryptionRunner::ResultListener listener)
+      : client_(client),
+        alarm_executor_(alarm_executor),
+        deadline_(deadline),
+        endpoint_id_(endpoint_id),
+        channel_(channel),
+        shared_key_(std::move(shared_key)),
+        listener_(std::move(listener)) {}
+
+  void operator()() {
+    if (HasExpired(deadline_, endpoint_id_)) {
+      listener_.CallFailureCallback(endpoint_id_, channel_);
+      return;
+    }
+    CancelableAlarm timeout_alarm(
+        "EncryptionRunner.StartSharedKeyClient() timeout",
+        [this]() { CancelableAlarmRunnable(client_, endpoint_id_, channel_); },
+        TimeLeft(deadline_), alarm_executor_);
+
+    ExceptionOr<ByteArray> server_init_bytes = channel_->Read();
+    if (!server_init_bytes.ok()) {
+      LogException();
+      HandleException(&timeout_alarm);
+      return;
+    }
+
+    SharedKeyFrame server_init;
+    if (!server_init.ParseFromString(std::string(server_init_bytes.result()))) {
+      LogException();
+      HandleException(&timeout_alarm);
+      return;
+    }
+
+    if (server_init.type() == SharedKeyFrame::DECLINE) {
+      timeout_alarm.Cancel();
+      NEARBY_LOGS(INFO) << "In StartSharedKeyClient(), endpoint(id="
+                        << endpoint_id_
+                        << ") declined the shared key; running UKEY2.";
+      ClientRunnable ukey2_runnable(client_, alarm_executor_, deadline_,
+                                    endpoint_id_, channel_,
+                                    std::move(listener_));
+      ukey2_runnable();
+      return;
+    }
+
+    if (server_init.type() != SharedKeyFrame::SERVER_INIT ||
+        server_init.nonce().size() != SharedKeyHub::kNonceSize ||
+        !VerifySharedKeyConfirmation(shared_key_, server_init.nonce(),
+                                     kServerConfirmationInfo,
+                                     server_init.confirmation())) {
+      LogException();
+      HandleException(&timeout_alarm);
+      return;
+    }
+
+    SharedKeyFrame client_finish;
+    client_finish.set_type(SharedKeyFrame::CLIENT_FINISH);
+    client_finish.set_confirmation(DeriveFromSharedKey(
+        shared_key_, server_init.nonce(), kClientConfirmationInfo));
+    if (!channel_->Write(ToBytes(client_finish)).Ok()) {
+      LogException();
+      HandleException(&timeout_alarm);
+      return;
+    }
+
+    timeout_alarm.Cancel();
+
+    HandleSharedKeySuccess(endpoint_id_, shared_key_, server_init.nonce(),
+                           /*is_client=*/true, listener_);
+  }
+
+  // Reports the handshake as failed without running it.
+  void Fail() { listener_.CallFailureCallback(endpoint_id_, channel_); }
+
+ private:
+  void LogException() const {
+    NEARBY_LOGS(ERROR)
+        << "In StartSharedKeyClient(), shared key failed with endpoint(id="
+        << endpoint_id_ << ").";
+  }
+
+  void HandleException(CancelableAlarm* timeout_alarm) {
+    timeout_alarm->Cancel();
+    listener_.CallFailureCallback(endpoint_id_, channel_);
+  }
+
+  ClientProxy* client_;
+  ScheduledExecutor* alarm_executor_;
+  const absl::Time deadline_;
+  const std::string endpoint_id_;
+  EndpointChannel* channel_;
+  SharedKey shared_key_;
+  EncryptionRunner::ResultListener listener_;
+};
+
 }  // namespace
 
 EncryptionRunner::~EncryptionRunner() { Shutdown(); }
@@ -363,18 +679,48 @@ void EncryptionRunner::StartServer(ClientProxy* client,
                                    const std::string& endpoint_id,
                                    EndpointChannel* endpoint_channel,
                                    EncryptionRunner::ResultListener listener) {
-  ServerRunnable runnable(client, &alarm_executor_, endpoint_id,
+  if (!TryAdmitServerHandshake()) {
+    RejectHandshake(endpoint_id, endpoint_channel, std::move(listener));
+    return;
+  }
+  ServerRunnable runnable(client, &alarm_executor_, GetDeadline(), endpoint_id,
                           endpoint_channel, std::move(listener));
-  server_executor_.Execute("encryption-server", std::move(runnable));
+  ExecuteServerHandshake(client, "encryption-server", std::move(runnable));
 }
 
 void EncryptionRunner::StartClient(ClientProxy* client,
                                    const std::string& endpoint_id,
                                    EndpointChannel* endpoint_channel,
                                    EncryptionRunner::ResultListener listener) {
-  ClientRunnable runnable(client, &alarm_executor_, endpoint_id,
+  ClientRunnable runnable(client, &alarm_executor_, GetDeadline(), endpoint_id,
                           endpoint_channel, std::move(listener));
-  client_executor_.Execute("encryption-client", std::move(runnable));
+  ExecuteHandshake(client, "encryption-client", std::move(runnable));
+}
+
+void EncryptionRunner::StartSharedKeyServer(
+    ClientProxy* client, const std::string& endpoint_id,
+    EndpointChannel* endpoint_channel, std::optional<SharedKey> shared_key,
+    EncryptionRunner::ResultListener listener) {
+  if (!TryAdmitServerHandshake()) {
+    RejectHandshake(endpoint_id, endpoint_channel, std::move(listener));
+    return;
+  }
+  SharedKeyServerRunnable runnable(client, &alarm_executor_, GetDeadline(),
+                                   endpoint_id, endpoint_channel,
+                                   std::move(shared_key), std::move(listener));
+  ExecuteServerHandshake(client, "encryption-shared-key-server",
+                         std::move(runnable));
+}
+
+void EncryptionRunner::StartSharedKeyClient(
+    ClientProxy* client, const std::string& endpoint_id,
+    EndpointChannel* endpoint_channel, SharedKey shared_key,
+    EncryptionRunner::ResultListener listener) {
+  SharedKeyClientRunnable runnable(client, &alarm_executor_, GetDeadline(),
+                                   endpoint_id, endpoint_channel,
+                                   std::move(shared_key), std::move(listener));
+  ExecuteHandshake(client, "encryption-shared-key-client",
+                   std::move(runnable));
 }
 
 void EncryptionRunner::Shutdown() {
@@ -383,11 +729,126 @@ void EncryptionRunner::Shutdown() {
   }
 
   // Stop all the ongoing Runnables (as gracefully as possible).
-  client_executor_.Shutdown();
-  server_executor_.Shutdown();
+  MultiThreadExecutor* handshake_executor;
+  {
+    MutexLock lock(&mutex_);
+    handshake_executor = handshake_executor_.get();
+  }
+  // Outside the lock, as the running handshakes take it when they end.
+  if (handshake_executor != nullptr) {
+    handshake_executor->Shutdown();
+  }
   alarm_executor_.Shutdown();
 }
 
+absl::Time EncryptionRunner::GetDeadline() {
+  return SystemClock::ElapsedRealtime() + kTimeout;
+}
+
+bool EncryptionRunner::TryAdmitServerHandshake() {
+  if (pending_server_handshakes_.fetch_add(1) < kMaxPendingServerHandshakes) {
+    return true;
+  }
+  pending_server_handshakes_.fetch_sub(1);
+  return false;
+}
+
+void EncryptionRunner::RejectHandshake(const std::string& endpoint_id,
+                                       EndpointChannel* endpoint_channel,
+                                       ResultListener listener) {
+  NEARBY_LOGS(WARNING) << "Rejecting the encryption handshake with endpoint(id="
+                       << endpoint_id << "); "
+                       << kMaxPendingServerHandshakes
+                       << " incoming handshakes are pending already.";
+  alarm_executor_.Execute(
+      "encryption-reject", [endpoint_id, endpoint_channel,
+                            listener = std::move(listener)]() mutable {
+        listener.CallFailureCallback(endpoint_id, endpoint_channel);
+      });
+}
+
+template <typename HandshakeRunnable>
+void EncryptionRunner::ExecuteServerHandshake(ClientProxy* client,
+                                              const std::string& name,
+                                              HandshakeRunnable runnable) {
+  ExecuteHandshake(client, name, std::move(runnable),
+                   [this]() { pending_server_handshakes_.fetch_sub(1); });
+}
+
+template <typename HandshakeRunnable>
+void EncryptionRunner::ExecuteHandshake(ClientProxy* client,
+                                        const std::string& name,
+                                        HandshakeRunnable runnable,
+                                        Runnable on_end) {
+  MultiThreadExecutor* handshake_executor = nullptr;
+  {
+    MutexLock lock(&mutex_);
+    if (!is_stopped_.Get()) {
+      if (handshake_executor_ == nullptr) {
+        handshake_executor_ =
+            std::make_unique<MultiThreadExecutor>(kMaxParallelHandshakes);
+      }
+      client_handshakes_[client].queued.push_back(
+          {next_handshake_sequence_++,
+           [runnable = std::move(runnable),
+            on_end = std::move(on_end)]() mutable {
+             runnable();
+             if (on_end) on_end();
+           }});
+      handshake_executor = handshake_executor_.get();
+    }
+  }
+  if (handshake_executor == nullptr) {
+    // Nothing runs handshakes anymore, so the caller hears about the failure
+    // here.
+    NEARBY_LOGS(WARNING) << "Failing " << name
+                         << " handshake, the encryption runner is stopped.";
+    runnable.Fail();
+    if (on_end) on_end();
+    return;
+  }
+  // There is one task per queued handshake, but the task runs whichever
+  // handshake is next in line once it gets a worker.
+  handshake_executor->Execute(name, [this]() { RunNextHandshake(); });
+}
+
+void EncryptionRunner::RunNextHandshake() {
+  ClientProxy* client;
+  Runnable runnable;
+  {
+    MutexLock lock(&mutex_);
+    auto next = client_handshakes_.end();
+    for (auto it = client_handshakes_.begin(); it != client_handshakes_.end();
+         ++it) {
+      const ClientHandshakes& handshakes = it->second;
+      if (handshakes.queued.empty()) {
+        continue;
+      }
+      if (next == client_handshakes_.end() ||
+          std::tie(handshakes.running, handshakes.queued.front().sequence) <
+              std::tie(next->second.running,
+                       next->second.queued.front().sequence)) {
+        next = it;
+      }
+    }
+    if (next == client_handshakes_.end()) {
+      return;
+    }
+    client = next->first;
+    runnable = std::move(next->second.queued.front().runnable);
+    next->second.queued.pop_front();
+    ++next->second.running;
+  }
+
+  runnable();
+
+  MutexLock lock(&mutex_);
+  auto it = client_handshakes_.find(client);
+  if (--it->second.running == 0 && it->second.queued.empty()) {
+    client_handshakes_.erase(it);
+  }
+}
+
 void EncryptionRunner::ResultListener::CallSuccessCallback(
     const std::string& endpoint_id,
     std::unique_ptr<securegcm::UKey2Handshake> ukey2,
@@ -399,6 +860,17 @@ void EncryptionRunner::ResultListener::CallSuccessCallback(
   Reset();
 }
 
+void EncryptionRunner::ResultListener::CallSharedKeySuccessCallback(
+    const std::string& endpoint_id,
+    std::unique_ptr<EndpointChannel::EncryptionContext> context,
+    const std::string& auth_token, const ByteArray& raw_auth_token) {
+  if (on_shared_key_success_cb) {
+    std::move(on_shared_key_success_cb)(endpoint_id, std::move(context),
+                                        auth_token, raw_auth_token);
+  }
+  Reset();
+}
+
 void EncryptionRunner::ResultListener::CallFailureCallback(
     const std::string& endpoint_id, EndpointChannel* channel) {
   if (on_failure_cb) {
@@ -409,6 +881,7 @@ void EncryptionRunner::ResultListener::CallFailureCallback(
 
 void EncryptionRunner::ResultListener::Reset() {
   on_success_cb = nullptr;
+  on_shared_key_success_cb = nullptr;
   on_failure_cb = nullptr;
 }
 
@@ -15,28 +15,48 @@
 #ifndef CORE_INTERNAL_ENCRYPTION_RUNNER_H_
 #define CORE_INTERNAL_ENCRYPTION_RUNNER_H_
 
+#include <atomic>
+#include <cstdint>
+#include <deque>
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "securegcm/ukey2_handshake.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/functional/any_invocable.h"
+#include "absl/time/time.h"
 #include "connections/implementation/client_proxy.h"
 #include "connections/implementation/endpoint_channel.h"
+#include "connections/implementation/shared_key_hub.h"
 #include "internal/platform/atomic_boolean.h"
 #include "internal/platform/byte_array.h"
+#include "internal/platform/multi_thread_executor.h"
+#include "internal/platform/mutex.h"
+#include "internal/platform/runnable.h"
 #include "internal/platform/scheduled_executor.h"
-#include "internal/platform/single_thread_executor.h"
 
 namespace nearby {
 namespace connections {
 
 // Encrypts a connection over UKEY2.
 //
-// NOTE: Stalled EndpointChannels will be disconnected after kTimeout.
+// NOTE: Stalled EndpointChannels will be disconnected kTimeout after the
+// handshake starts, including any time spent waiting for a free worker.
 // This is to prevent unverified endpoints from maintaining an
 // indefinite connection to us.
 class EncryptionRunner {
  public:
+  // Handshakes in both directions share this many workers, which start with
+  // the first handshake. A free worker takes the oldest queued handshake of
+  // the client with the fewest running ones, so that one client's slow or
+  // stalled remote devices do not hold up another client's handshakes.
+  static constexpr int kMaxParallelHandshakes = 8;
+  // Incoming handshakes beyond this many queued or running ones fail right
+  // away, as they would not finish before the remote device times out.
+  static constexpr int kMaxPendingServerHandshakes = 256;
+
   EncryptionRunner() = default;
   ~EncryptionRunner();
 
@@ -45,6 +65,10 @@ class EncryptionRunner {
                              std::unique_ptr<securegcm::UKey2Handshake> ukey2,
                              const std::string& auth_token,
                              const ByteArray& raw_auth_token);
+    void CallSharedKeySuccessCallback(
+        const std::string& endpoint_id,
+        std::unique_ptr<EndpointChannel::EncryptionContext> context,
+        const std::string& auth_token, const ByteArray& raw_auth_token);
     void CallFailureCallback(const std::string& endpoint_id,
                              EndpointChannel* channel);
     void Reset();
@@ -56,6 +80,16 @@ class EncryptionRunner {
                             const ByteArray& raw_auth_token) &&>
         on_success_cb;
 
+    // Like on_success_cb, for a connection whose keys were derived from a
+    // SharedKey instead of a UKEY2 handshake. The context is ready to use.
+    //
+    // @EncryptionRunnerThread
+    absl::AnyInvocable<void(
+        const std::string& endpoint_id,
+        std::unique_ptr<EndpointChannel::EncryptionContext> context,
+        const std::string& auth_token, const ByteArray& raw_auth_token) &&>
+        on_shared_key_success_cb;
+
     // Encryption has failed. The remote_endpoint_id and channel are given so
     // that any pending state can be cleaned up.
     //
@@ -79,14 +113,69 @@ class EncryptionRunner {
                    EndpointChannel* endpoint_channel,
                    ResultListener result_listener);
 
+  // Like StartServer(), for a connection request that offered a shared key.
+  // Derives the keys from |shared_key| if it is set, and otherwise declines
+  // the offer and runs UKEY2.
+  //
+  // @AnyThread
+  void StartSharedKeyServer(ClientProxy* client, const std::string& endpoint_id,
+                            EndpointChannel* endpoint_channel,
+                            std::optional<SharedKey> shared_key,
+                            ResultListener result_listener);
+  // Like StartClient(), after offering |shared_key| in the connection request.
+  // Runs UKEY2 if the responder declines the offer.
+  //
+  // @AnyThread
+  void StartSharedKeyClient(ClientProxy* client, const std::string& endpoint_id,
+                            EndpointChannel* endpoint_channel,
+                            SharedKey shared_key,
+                            ResultListener result_listener);
+
   // @AnyThread
   void Shutdown();
 
  private:
+  // Returns when a handshake starting now times out on the remote device.
+  static absl::Time GetDeadline();
+  // Counts a new incoming handshake as pending, unless
+  // kMaxPendingServerHandshakes are pending already.
+  bool TryAdmitServerHandshake();
+  void RejectHandshake(const std::string& endpoint_id,
+                       EndpointChannel* endpoint_channel,
+                       ResultListener listener);
+  // Runs an admitted incoming handshake, which stops being pending once it
+  // ends.
+  template <typename HandshakeRunnable>
+  void ExecuteServerHandshake(ClientProxy* client, const std::string& name,
+                              HandshakeRunnable runnable);
+  // Queues a handshake for |client| and hands a worker to the next one. Runs
+  // |on_end| once the handshake ends. If the runner is stopped, the handshake
+  // fails right away instead.
+  template <typename HandshakeRunnable>
+  void ExecuteHandshake(ClientProxy* client, const std::string& name,
+                        HandshakeRunnable runnable, Runnable on_end = nullptr);
+  // Runs the queued handshake that is next in line, see
+  // kMaxParallelHandshakes.
+  void RunNextHandshake();
+
+  struct QueuedHandshake {
+    std::uint64_t sequence;
+    Runnable runnable;
+  };
+  struct ClientHandshakes {
+    int running = 0;
+    std::deque<QueuedHandshake> queued;
+  };
+
   AtomicBoolean is_stopped_{false};
+  std::atomic<int> pending_server_handshakes_{0};
   ScheduledExecutor alarm_executor_;
-  SingleThreadExecutor server_executor_;
-  SingleThreadExecutor client_executor_;
+  Mutex mutex_;
+  std::uint64_t next_handshake_sequence_ ABSL_GUARDED_BY(mutex_) = 0;
+  absl::flat_hash_map<ClientProxy*, ClientHandshakes> client_handshakes_
+      ABSL_GUARDED_BY(mutex_);
+  std::unique_ptr<MultiThreadExecutor> handshake_executor_
+      ABSL_GUARDED_BY(mutex_);
 };
 
 }  // namespace connections
@@ -15,13 +15,21 @@
 #include "connections/implementation/encryption_runner.h"
 
 #include <cstddef>
+#include <memory>
+#include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "gtest/gtest.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "connections/implementation/analytics/analytics_recorder.h"
 #include "connections/implementation/client_proxy.h"
 #include "connections/implementation/endpoint_channel.h"
+#include "connections/implementation/shared_key_hub.h"
 #include "internal/platform/byte_array.h"
 #include "internal/platform/count_down_latch.h"
 #include "internal/platform/exception.h"
@@ -133,6 +141,104 @@ struct Response {
   Status client_status = Status::kUnknown;
 };
 
+// The outcome of one side of a handshake.
+struct Result {
+  Response::Status status = Response::Status::kUnknown;
+  bool ran_ukey2 = false;
+  std::unique_ptr<EndpointChannel::EncryptionContext> context;
+  std::string auth_token;
+};
+
+struct HandshakeResults {
+  Result server;
+  Result client;
+};
+
+EncryptionRunner::ResultListener CreateListener(Result& result,
+                                                CountDownLatch& latch) {
+  return {
+      .on_success_cb =
+          [&result, &latch](const std::string& endpoint_id,
+                            std::unique_ptr<securegcm::UKey2Handshake> ukey2,
+                            const std::string& auth_token,
+                            const ByteArray& raw_auth_token) {
+            result.status = Response::Status::kDone;
+            result.ran_ukey2 = true;
+            result.auth_token = auth_token;
+            latch.CountDown();
+          },
+      .on_shared_key_success_cb =
+          [&result, &latch](
+              const std::string& endpoint_id,
+              std::unique_ptr<EndpointChannel::EncryptionContext> context,
+              const std::string& auth_token, const ByteArray& raw_auth_token) {
+            result.status = Response::Status::kDone;
+            result.context = std::move(context);
+            result.auth_token = auth_token;
+            latch.CountDown();
+          },
+      .on_failure_cb =
+          [&result, &latch](const std::string& endpoint_id,
+                            EndpointChannel* channel) {
+            result.status = Response::Status::kFailed;
+            // Unblocks the other side, as closing the pending connection
+            // does in BasePcpHandler.
+            channel->Close();
+            latch.CountDown();
+          },
+  };
+}
+
+// Runs a shared key handshake between a server that holds |server_key| and a
+// client that offered |client_key|.
+HandshakeResults RunSharedKeyHandshake(std::optional<SharedKey> server_key,
+                                       SharedKey client_key) {
+  auto from_a_to_b = CreatePipe();
+  auto from_b_to_a = CreatePipe();
+  User user_a(/*reader=*/from_b_to_a.first.get(),
+              /*writer=*/from_a_to_b.second.get());
+  User user_b(/*reader=*/from_a_to_b.first.get(),
+              /*writer=*/from_b_to_a.second.get());
+  HandshakeResults results;
+  CountDownLatch latch(2);
+
+  user_a.crypto.StartSharedKeyServer(&user_a.client, "endpoint_id",
+                                     &user_a.channel, std::move(server_key),
+                                     CreateListener(results.server, latch));
+  user_b.crypto.StartSharedKeyClient(&user_b.client, "endpoint_id",
+                                     &user_b.channel, std::move(client_key),
+                                     CreateListener(results.client, latch));
+  EXPECT_TRUE(latch.Await(absl::Milliseconds(5000)).result());
+  return results;
+}
+
+// The pipes and channels of a connection between a server and a client.
+struct Connection {
+  Connection()
+      : to_server(CreatePipe()),
+        to_client(CreatePipe()),
+        server_channel(/*in=*/to_server.first.get(),
+                       /*out=*/to_client.second.get()),
+        client_channel(/*in=*/to_client.first.get(),
+                       /*out=*/to_server.second.get()) {}
+
+  std::pair<std::unique_ptr<InputStream>, std::unique_ptr<OutputStream>>
+      to_server;
+  std::pair<std::unique_ptr<InputStream>, std::unique_ptr<OutputStream>>
+      to_client;
+  FakeEndpointChannel server_channel;
+  FakeEndpointChannel client_channel;
+  HandshakeResults results;
+};
+
+SharedKey CreateSharedKey(absl::string_view secret) {
+  return {
+      .session_tag = "session_tag",
+      .secret = std::string(secret),
+      .client_nonce = SharedKeyHub::GenerateNonce(),
+  };
+}
+
 TEST(EncryptionRunnerTest, ConstructorDestructorWorks) { EncryptionRunner enc; }
 
 TEST(EncryptionRunnerTest, ReadWrite) {
@@ -185,6 +291,190 @@ TEST(EncryptionRunnerTest, ReadWrite) {
   EXPECT_EQ(response.client_status, Response::Status::kDone);
 }
 
+TEST(EncryptionRunnerTest, SharedKeyDerivesMatchingKeys) {
+  SharedKey shared_key = CreateSharedKey("secret");
+
+  HandshakeResults results = RunSharedKeyHandshake(shared_key, shared_key);
+
+  ASSERT_EQ(results.server.status, Response::Status::kDone);
+  ASSERT_EQ(results.client.status, Response::Status::kDone);
+  EXPECT_FALSE(results.server.ran_ukey2);
+  EXPECT_FALSE(results.client.ran_ukey2);
+  EXPECT_FALSE(results.client.auth_token.empty());
+  EXPECT_EQ(results.server.auth_token, results.client.auth_token);
+  ASSERT_NE(results.server.context, nullptr);
+  ASSERT_NE(results.client.context, nullptr);
+  std::unique_ptr<std::string> to_server =
+      results.client.context->EncodeMessageToPeer("to server");
+  ASSERT_NE(to_server, nullptr);
+  std::unique_ptr<std::string> decoded =
+      results.server.context->DecodeMessageFromPeer(*to_server);
+  ASSERT_NE(decoded, nullptr);
+  EXPECT_EQ(*decoded, "to server");
+  std::unique_ptr<std::string> to_client =
+      results.server.context->EncodeMessageToPeer("to client");
+  ASSERT_NE(to_client, nullptr);
+  decoded = results.client.context->DecodeMessageFromPeer(*to_client);
+  ASSERT_NE(decoded, nullptr);
+  EXPECT_EQ(*decoded, "to client");
+}
+
+TEST(EncryptionRunnerTest, SharedKeyDerivesNewKeysForEveryConnection) {
+  SharedKey shared_key = CreateSharedKey("secret");
+  HandshakeResults first = RunSharedKeyHandshake(shared_key, shared_key);
+  shared_key.client_nonce = SharedKeyHub::GenerateNonce();
+
+  HandshakeResults second = RunSharedKeyHandshake(shared_key, shared_key);
+
+  ASSERT_EQ(first.client.status, Response::Status::kDone);
+  ASSERT_EQ(second.client.status, Response::Status::kDone);
+  EXPECT_NE(first.client.auth_token, second.client.auth_token);
+  std::unique_ptr<std::string> message =
+      first.client.context->EncodeMessageToPeer("message");
+  ASSERT_NE(message, nullptr);
+  EXPECT_EQ(second.server.context->DecodeMessageFromPeer(*message), nullptr);
+}
+
+TEST(EncryptionRunnerTest, DeclinedSharedKeyFallsBackToUkey2) {
+  HandshakeResults results =
+      RunSharedKeyHandshake(std::nullopt, CreateSharedKey("secret"));
+
+  EXPECT_EQ(results.server.status, Response::Status::kDone);
+  EXPECT_EQ(results.client.status, Response::Status::kDone);
+  EXPECT_TRUE(results.server.ran_ukey2);
+  EXPECT_TRUE(results.client.ran_ukey2);
+  EXPECT_EQ(results.server.auth_token, results.client.auth_token);
+}
+
+TEST(EncryptionRunnerTest, MismatchedSharedKeyFails) {
+  HandshakeResults results = RunSharedKeyHandshake(
+      CreateSharedKey("server secret"), CreateSharedKey("client secret"));
+
+  EXPECT_EQ(results.server.status, Response::Status::kFailed);
+  EXPECT_EQ(results.client.status, Response::Status::kFailed);
+}
+
+TEST(EncryptionRunnerTest, ManySimultaneousIncomingHandshakesSucceed) {
+  constexpr int kConnections = 200;
+  // A remote device that never sends its first message.
+  Connection stalled;
+  CountDownLatch stalled_latch(1);
+  std::vector<std::unique_ptr<Connection>> connections;
+  CountDownLatch latch(2 * kConnections);
+  ClientProxy server_client;
+  ClientProxy client_client;
+  EncryptionRunner server;
+  EncryptionRunner client;
+
+  server.StartServer(&server_client, "stalled", &stalled.server_channel,
+                     CreateListener(stalled.results.server, stalled_latch));
+  for (int i = 0; i < kConnections; ++i) {
+    connections.push_back(std::make_unique<Connection>());
+    Connection& connection = *connections.back();
+    std::string endpoint_id = absl::StrCat("endpoint_id_", i);
+    server.StartServer(&server_client, endpoint_id, &connection.server_channel,
+                       CreateListener(connection.results.server, latch));
+    client.StartClient(&client_client, endpoint_id, &connection.client_channel,
+                       CreateListener(connection.results.client, latch));
+  }
+
+  // Well before the stalled handshake times out.
+  ASSERT_TRUE(latch.Await(absl::Seconds(10)).result());
+  for (const std::unique_ptr<Connection>& connection : connections) {
+    EXPECT_EQ(connection->results.server.status, Response::Status::kDone);
+    EXPECT_EQ(connection->results.client.status, Response::Status::kDone);
+  }
+  stalled.server_channel.Close();
+  EXPECT_TRUE(stalled_latch.Await(absl::Seconds(1)).result());
+  EXPECT_EQ(stalled.results.server.status, Response::Status::kFailed);
+}
+
+TEST(EncryptionRunnerTest, StalledHandshakesDoNotHoldUpOtherClients) {
+  // Enough stalled handshakes of one client to take every worker, and one
+  // more queued behind them.
+  std::vector<std::unique_ptr<Connection>> stalled;
+  CountDownLatch stalled_latch(EncryptionRunner::kMaxParallelHandshakes + 1);
+  Connection connection;
+  CountDownLatch latch(2);
+  ClientProxy stalled_client;
+  ClientProxy server_client;
+  ClientProxy client_client;
+  EncryptionRunner server;
+  EncryptionRunner client;
+  for (int i = 0; i <= EncryptionRunner::kMaxParallelHandshakes; ++i) {
+    stalled.push_back(std::make_unique<Connection>());
+    Connection& stalled_connection = *stalled.back();
+    server.StartServer(
+        &stalled_client, absl::StrCat("stalled_", i),
+        &stalled_connection.server_channel,
+        CreateListener(stalled_connection.results.server, stalled_latch));
+  }
+  // Let the stalled handshakes take the workers.
+  absl::SleepFor(absl::Milliseconds(100));
+
+  server.StartServer(&server_client, "endpoint_id", &connection.server_channel,
+                     CreateListener(connection.results.server, latch));
+  client.StartClient(&client_client, "endpoint_id", &connection.client_channel,
+                     CreateListener(connection.results.client, latch));
+  // The freed worker goes to the client without a running handshake, rather
+  // than to the stalled client's queued one.
+  stalled.front()->server_channel.Close();
+
+  // Well before the stalled handshakes time out.
+  ASSERT_TRUE(latch.Await(absl::Seconds(5)).result());
+  EXPECT_EQ(connection.results.server.status, Response::Status::kDone);
+  EXPECT_EQ(connection.results.client.status, Response::Status::kDone);
+  for (const std::unique_ptr<Connection>& stalled_connection : stalled) {
+    stalled_connection->server_channel.Close();
+  }
+  EXPECT_TRUE(stalled_latch.Await(absl::Seconds(5)).result());
+}
+
+TEST(EncryptionRunnerTest, RejectsIncomingHandshakesBeyondPendingLimit) {
+  std::vector<std::unique_ptr<Connection>> stalled;
+  CountDownLatch stalled_latch(EncryptionRunner::kMaxPendingServerHandshakes);
+  Connection rejected;
+  CountDownLatch rejected_latch(1);
+  ClientProxy server_client;
+  EncryptionRunner server;
+  for (int i = 0; i < EncryptionRunner::kMaxPendingServerHandshakes; ++i) {
+    stalled.push_back(std::make_unique<Connection>());
+    Connection& connection = *stalled.back();
+    server.StartServer(
+        &server_client, absl::StrCat("endpoint_id_", i),
+        &connection.server_channel,
+        CreateListener(connection.results.server, stalled_latch));
+  }
+
+  server.StartServer(&server_client, "rejected", &rejected.server_channel,
+                     CreateListener(rejected.results.server, rejected_latch));
+
+  EXPECT_TRUE(rejected_latch.Await(absl::Seconds(1)).result());
+  EXPECT_EQ(rejected.results.server.status, Response::Status::kFailed);
+  for (const std::unique_ptr<Connection>& connection : stalled) {
+    connection->server_channel.Close();
+  }
+  EXPECT_TRUE(stalled_latch.Await(absl::Seconds(5)).result());
+}
+
+TEST(EncryptionRunnerTest, HandshakesFailAfterShutdown) {
+  Connection connection;
+  CountDownLatch latch(2);
+  ClientProxy server_client;
+  ClientProxy client_client;
+  EncryptionRunner runner;
+  runner.Shutdown();
+
+  runner.StartServer(&server_client, "server", &connection.server_channel,
+                     CreateListener(connection.results.server, latch));
+  runner.StartClient(&client_client, "client", &connection.client_channel,
+                     CreateListener(connection.results.client, latch));
+
+  EXPECT_TRUE(latch.Await(absl::Seconds(1)).result());
+  EXPECT_EQ(connection.results.server.status, Response::Status::kFailed);
+  EXPECT_EQ(connection.results.client.status, Response::Status::kFailed);
+}
+
 }  // namespace
 }  // namespace connections
 }  // namespace nearby
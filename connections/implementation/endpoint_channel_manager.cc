@@ -18,6 +18,8 @@
 #include <string>
 #include <utility>
 
+#include "absl/hash/hash.h"
+#include "absl/strings/string_view.h"
 #include "absl/time/time.h"
 #include "connections/implementation/client_proxy.h"
 #include "connections/implementation/endpoint_channel.h"
@@ -91,16 +93,13 @@ bool EndpointChannelManager::EncryptChannelForEndpoint(
 }
 
 std::shared_ptr<EndpointChannel> EndpointChannelManager::GetChannelForEndpoint(
-    const std::string& endpoint_id) {
-  MutexLock lock(&mutex_);
-
-  auto* endpoint = channel_state_.LookupEndpointData(endpoint_id);
-  if (endpoint == nullptr) {
+    const std::string& endpoint_id) const {
+  std::shared_ptr<EndpointChannel> channel =
+      channel_state_.GetChannel(endpoint_id);
+  if (channel == nullptr) {
     LOG(INFO) << "No channel info for endpoint " << endpoint_id;
-    return {};
   }
-
-  return endpoint->channel;
+  return channel;
 }
 
 void EndpointChannelManager::SetActiveEndpointChannel(
@@ -159,6 +158,42 @@ void EndpointChannelManager::RemoveTimeoutDisconnectedState(
   channel_state_.RemoveTimeoutDisconnectedState(endpoint_id);
 }
 
+///////////////////////////////// ChannelTable /////////////////////////////////
+
+std::shared_ptr<EndpointChannel> EndpointChannelManager::ChannelTable::Get(
+    absl::string_view endpoint_id) const {
+  Shard& shard = GetShard(endpoint_id);
+  MutexLock lock(&shard.mutex);
+  auto item = shard.channels.find(endpoint_id);
+  return item != shard.channels.end() ? item->second : nullptr;
+}
+
+void EndpointChannelManager::ChannelTable::Set(
+    absl::string_view endpoint_id, std::shared_ptr<EndpointChannel> channel) {
+  Shard& shard = GetShard(endpoint_id);
+  MutexLock lock(&shard.mutex);
+  // Swap rather than assign, so that the previous channel is released after
+  // the shard is unlocked.
+  channel.swap(shard.channels[endpoint_id]);
+}
+
+void EndpointChannelManager::ChannelTable::Erase(
+    absl::string_view endpoint_id) {
+  std::shared_ptr<EndpointChannel> channel;
+  Shard& shard = GetShard(endpoint_id);
+  MutexLock lock(&shard.mutex);
+  auto item = shard.channels.find(endpoint_id);
+  if (item == shard.channels.end()) return;
+  channel = std::move(item->second);
+  shard.channels.erase(item);
+}
+
+EndpointChannelManager::ChannelTable::Shard&
+EndpointChannelManager::ChannelTable::GetShard(
+    absl::string_view endpoint_id) const {
+  return shards_[absl::Hash<absl::string_view>{}(endpoint_id) % kShards];
+}
+
 ///////////////////////////////// ChannelState /////////////////////////////////
 
 // endpoint - channel endpoint to encrypt
@@ -180,18 +215,21 @@ EndpointChannelManager::ChannelState::LookupEndpointData(
 }
 
 void EndpointChannelManager::ChannelState::DestroyAll() {
-  for (auto& item : endpoints_) {
-    RemoveEndpoint(item.first, DisconnectionReason::SHUTDOWN,
+  while (!endpoints_.empty()) {
+    // RemoveEndpoint() erases the entry, so it gets a copy of the ID.
+    std::string endpoint_id = endpoints_.begin()->first;
+    RemoveEndpoint(endpoint_id, DisconnectionReason::SHUTDOWN,
                    /* safe_to_disconnect_enabled */ false,
                    ConnectionsLog::EstablishedConnection::SAFE_DISCONNECTION);
   }
-  endpoints_.clear();
 }
 
 void EndpointChannelManager::ChannelState::UpdateChannelForEndpoint(
     const std::string& endpoint_id, std::unique_ptr<EndpointChannel> channel) {
   // Create EndpointData instance, if necessary, and populate channel.
-  endpoints_[endpoint_id].channel = std::move(channel);
+  EndpointData& endpoint = endpoints_[endpoint_id];
+  endpoint.channel = std::move(channel);
+  channels_.Set(endpoint_id, endpoint.channel);
 }
 
 void EndpointChannelManager::ChannelState::UpdateEncryptionContextForEndpoint(
@@ -226,6 +264,9 @@ bool EndpointChannelManager::ChannelState::RemoveEndpoint(
     bool safe_to_disconnect_enabled, SafeDisconnectionResult result) {
   auto item = endpoints_.find(endpoint_id);
   if (item == endpoints_.end()) return false;
+  // Unpublish the channel first, so that lookups without the lock do not hand
+  // it out for new writes while the DISCONNECTION frame is being sent.
+  channels_.Erase(endpoint_id);
 
   MarkEndpointStopWaitToDisconnect(
       endpoint_id,
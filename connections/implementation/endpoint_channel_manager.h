@@ -15,11 +15,13 @@
 #ifndef CORE_INTERNAL_ENDPOINT_CHANNEL_MANAGER_H_
 #define CORE_INTERNAL_ENDPOINT_CHANNEL_MANAGER_H_
 
+#include <array>
 #include <memory>
 #include <string>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
 #include "absl/time/time.h"
 #include "connections/implementation/client_proxy.h"
 #include "connections/implementation/endpoint_channel.h"
@@ -92,8 +94,11 @@ class EndpointChannelManager final {
   // If EndpointChannelManager replaces the current channel, and any (or both)
   // EndpointManager methods that use a channel are running, it is better to
   // have a shared ownership.
+  //
+  // This is called on every send, so it does not take mutex_, and does not
+  // wait for changes to other endpoints.
   std::shared_ptr<EndpointChannel> GetChannelForEndpoint(
-      const std::string& endpoint_id) ABSL_LOCKS_EXCLUDED(mutex_);
+      const std::string& endpoint_id) const;
 
   // Returns true if 'endpoint_id' actually had a registered EndpointChannel.
   // IOW, a return of false signifies a no-op.
@@ -122,6 +127,32 @@ class EndpointChannelManager final {
       ABSL_LOCKS_EXCLUDED(mutex_);
 
  private:
+  // The current channel of every endpoint, published for lookups on the data
+  // path. Endpoints are spread over shards with their own mutex, which is only
+  // held to find or swap a channel, never across I/O like mutex_ is (e.g.
+  // while a DISCONNECTION frame goes out), so lookups never wait for slow
+  // changes to any endpoint.
+  class ChannelTable {
+   public:
+    std::shared_ptr<EndpointChannel> Get(absl::string_view endpoint_id) const;
+    void Set(absl::string_view endpoint_id,
+             std::shared_ptr<EndpointChannel> channel);
+    void Erase(absl::string_view endpoint_id);
+
+   private:
+    static constexpr int kShards = 16;
+
+    struct Shard {
+      mutable Mutex mutex;
+      absl::flat_hash_map<std::string, std::shared_ptr<EndpointChannel>>
+          channels ABSL_GUARDED_BY(mutex);
+    };
+
+    Shard& GetShard(absl::string_view endpoint_id) const;
+
+    mutable std::array<Shard, kShards> shards_;
+  };
+
   // Tracks channel state for all endpoints. This includes what EndpointChannel
   // the endpoint is currently using and whether or not the EndpointChannel has
   // been encrypted yet.
@@ -164,6 +195,12 @@ class EndpointChannelManager final {
     void DestroyAll();
     // Return pointer to endpoint data, or nullptr, it not found.
     EndpointData* LookupEndpointData(const std::string& endpoint_id);
+    // Returns the channel of the endpoint, or nullptr. Safe to call without
+    // holding the lock that guards all the other methods.
+    std::shared_ptr<EndpointChannel> GetChannel(
+        const std::string& endpoint_id) const {
+      return channels_.Get(endpoint_id);
+    }
 
     // Stores a new EndpointChannel for the endpoint.
     // Prevoius one is destroyed, if it existed.
@@ -203,6 +240,8 @@ class EndpointChannelManager final {
     // Endpoint ID -> EndpointData. Contains everything we know about the
     // endpoint.
     absl::flat_hash_map<std::string, EndpointData> endpoints_;
+    // Endpoint ID -> EndpointData::channel, kept in sync with endpoints_.
+    ChannelTable channels_;
   };
 
   void SetActiveEndpointChannel(ClientProxy* client,
@@ -0,0 +1,141 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Rate of EndpointChannelManager::GetChannelForEndpoint() lookups, which run
+// on every send to an endpoint.
+//
+// kEndpoints endpoints are registered with fake channels, and every benchmark
+// thread looks up their channels in turn. BM_GetChannel runs the lookups
+// alone. BM_GetChannelDuringChanges also replaces the channel of another
+// endpoint, and registers and unregisters a third one, on a background thread
+// for the whole run, as bandwidth upgrades and disconnections do. Both run
+// with 1 to 8 lookup threads. Each benchmark reports this counter:
+//   lookups_per_second   Lookups per second, over all threads.
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "absl/strings/str_cat.h"
+#include "connections/implementation/client_proxy.h"
+#include "connections/implementation/endpoint_channel_manager.h"
+#include "connections/implementation/fake_endpoint_channel.h"
+#include "internal/platform/multi_thread_executor.h"
+#include "internal/proto/analytics/connections_log.pb.h"
+#include "proto/connections_enums.pb.h"
+
+namespace nearby {
+namespace connections {
+namespace {
+
+using ::location::nearby::analytics::proto::ConnectionsLog;
+using ::location::nearby::proto::connections::DisconnectionReason;
+using ::location::nearby::proto::connections::Medium;
+
+constexpr int kEndpoints = 16;
+
+std::unique_ptr<EndpointChannel> CreateChannel() {
+  return std::make_unique<FakeEndpointChannel>(Medium::WIFI_LAN, "service-id");
+}
+
+// Endpoints with channels, shared by all benchmarks. Never destroyed, so that
+// the channels are not disconnected on exit.
+class Endpoints {
+ public:
+  Endpoints() {
+    for (int i = 0; i < kEndpoints; ++i) {
+      endpoint_ids_.push_back(absl::StrCat("endpoint-", i));
+      channel_manager_.RegisterChannelForEndpoint(&client_, endpoint_ids_[i],
+                                                  CreateChannel());
+    }
+  }
+
+  // Looks up the channel of every endpoint. Returns the number of channels
+  // found.
+  int LookUpAll() const {
+    int found = 0;
+    for (const std::string& endpoint_id : endpoint_ids_) {
+      if (channel_manager_.GetChannelForEndpoint(endpoint_id) != nullptr) {
+        ++found;
+      }
+    }
+    return found;
+  }
+
+  // Changes the channels of other endpoints until StopChanges() is called.
+  void StartChanges() {
+    stopped_ = false;
+    executor_.Execute([this]() {
+      while (!stopped_) {
+        channel_manager_.ReplaceChannelForEndpoint(
+            &client_, "replaced", CreateChannel(),
+            /*enable_encryption=*/false);
+        channel_manager_.RegisterChannelForEndpoint(&client_, "leaving",
+                                                    CreateChannel());
+        channel_manager_.UnregisterChannelForEndpoint(
+            "leaving", DisconnectionReason::LOCAL_DISCONNECTION,
+            ConnectionsLog::EstablishedConnection::SAFE_DISCONNECTION);
+      }
+    });
+  }
+
+  void StopChanges() { stopped_ = true; }
+
+ private:
+  ClientProxy client_;
+  EndpointChannelManager channel_manager_;
+  std::vector<std::string> endpoint_ids_;
+  std::atomic<bool> stopped_ = true;
+  MultiThreadExecutor executor_{1};
+};
+
+Endpoints& GetEndpoints() {
+  static Endpoints* endpoints = new Endpoints();
+  return *endpoints;
+}
+
+void RunLookups(benchmark::State& state, const Endpoints& endpoints) {
+  for (auto _ : state) {
+    if (endpoints.LookUpAll() != kEndpoints) {
+      state.SkipWithError("Channel not found.");
+      return;
+    }
+  }
+  state.counters["lookups_per_second"] = benchmark::Counter(
+      state.iterations() * kEndpoints, benchmark::Counter::kIsRate);
+}
+
+void BM_GetChannel(benchmark::State& state) {
+  RunLookups(state, GetEndpoints());
+}
+
+void BM_GetChannelDuringChanges(benchmark::State& state) {
+  Endpoints& endpoints = GetEndpoints();
+  if (state.thread_index() == 0) {
+    endpoints.StartChanges();
+  }
+  RunLookups(state, endpoints);
+  if (state.thread_index() == 0) {
+    endpoints.StopChanges();
+  }
+}
+
+BENCHMARK(BM_GetChannel)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_GetChannelDuringChanges)->ThreadRange(1, 8)->UseRealTime();
+
+}  // namespace
+}  // namespace connections
+}  // namespace nearby
@@ -14,16 +14,19 @@
 
 #include "connections/implementation/endpoint_channel_manager.h"
 
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "securegcm/ukey2_handshake.h"
 #include "gmock/gmock.h"
 #include "protobuf-matchers/protocol-buffer-matchers.h"
 #include "gtest/gtest.h"
+#include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 #include "absl/synchronization/mutex.h"
 #include "absl/time/time.h"
@@ -34,6 +37,7 @@
 #include "internal/platform/byte_array.h"
 #include "internal/platform/count_down_latch.h"
 #include "internal/platform/exception.h"
+#include "internal/platform/implementation/system_clock.h"
 #include "internal/platform/input_stream.h"
 #include "internal/platform/logging.h"
 #include "internal/platform/multi_thread_executor.h"
@@ -49,6 +53,7 @@ namespace {
 using ::location::nearby::analytics::proto::ConnectionsLog;
 using ::location::nearby::proto::connections::DisconnectionReason;
 using ::location::nearby::proto::connections::Medium;
+using ::testing::NiceMock;
 using EncryptionContext = BaseEndpointChannel::EncryptionContext;
 
 constexpr size_t kChunkSize = 64 * 1024;
@@ -67,6 +72,23 @@ class MockEndpointChannel : public BaseEndpointChannel {
   MOCK_METHOD(void, CloseImpl, (), (override));
 };
 
+// Creates channels whose pipes stay open until the pool is destroyed, so that
+// channels that are still in use after being replaced remain valid.
+class ChannelPool {
+ public:
+  std::unique_ptr<MockEndpointChannel> CreateChannel() {
+    pipes_.push_back(CreatePipe());
+    auto& pipe = pipes_.back();
+    return std::make_unique<NiceMock<MockEndpointChannel>>(pipe.first.get(),
+                                                           pipe.second.get());
+  }
+
+ private:
+  std::vector<
+      std::pair<std::unique_ptr<InputStream>, std::unique_ptr<OutputStream>>>
+      pipes_;
+};
+
 std::function<void()> MakeDataPump(
     absl::string_view label, InputStream* input, OutputStream* output,
     std::function<void(const ByteArray&)> monitor = nullptr) {
@@ -317,6 +339,89 @@ TEST(BaseEndpointChannelManagerTest, ReplaceChannelNoEncrypted) {
         std::string(kEndpointId), DisconnectionReason::REMOTE_DISCONNECTION,
         ConnectionsLog::EstablishedConnection::SAFE_DISCONNECTION);}
 
+TEST(BaseEndpointChannelManagerTest, ConcurrentLookupsAndReplacements) {
+  constexpr int kEndpoints = 8;
+  constexpr int kReaders = 4;
+  constexpr int kLookupsPerReader = 20000;
+  constexpr int kReplacements = 200;
+  ChannelPool pool;
+  ClientProxy proxy;
+  EndpointChannelManager ecm;
+  for (int i = 0; i < kEndpoints; ++i) {
+    ecm.RegisterChannelForEndpoint(&proxy, absl::StrCat(kEndpointId, i),
+                                   pool.CreateChannel());
+  }
+  std::vector<std::unique_ptr<MockEndpointChannel>> replacements;
+  for (int i = 0; i < kReplacements; ++i) {
+    replacements.push_back(pool.CreateChannel());
+  }
+  std::atomic<int> missing_channels = 0;
+  CountDownLatch latch(kReaders + 1);
+  MultiThreadExecutor executor(kReaders + 1);
+
+  for (int reader = 0; reader < kReaders; ++reader) {
+    executor.Execute([&ecm, &missing_channels, &latch]() {
+      for (int i = 0; i < kLookupsPerReader; ++i) {
+        if (ecm.GetChannelForEndpoint(
+                absl::StrCat(kEndpointId, i % kEndpoints)) == nullptr) {
+          ++missing_channels;
+        }
+      }
+      latch.CountDown();
+    });
+  }
+  executor.Execute([&ecm, &proxy, &replacements, &latch]() {
+    for (int i = 0; i < kReplacements; ++i) {
+      ecm.ReplaceChannelForEndpoint(&proxy,
+                                    absl::StrCat(kEndpointId, i % kEndpoints),
+                                    std::move(replacements[i]),
+                                    /*enable_encryption=*/false);
+    }
+    latch.CountDown();
+  });
+
+  EXPECT_TRUE(latch.Await(absl::Seconds(30)).result());
+  EXPECT_EQ(missing_channels.load(), 0);
+  EXPECT_EQ(ecm.GetConnectedEndpointsCount(), kEndpoints);
+
+  // Skips the DISCONNECTION frames on shutdown.
+  for (int i = 0; i < kEndpoints; ++i) {
+    ecm.GetChannelForEndpoint(absl::StrCat(kEndpointId, i))
+        ->Close(DisconnectionReason::LOCAL_DISCONNECTION);
+  }
+}
+
+TEST(BaseEndpointChannelManagerTest, LookupDoesNotWaitForUnregistration) {
+  ChannelPool pool;
+  ClientProxy proxy;
+  EndpointChannelManager ecm;
+  ecm.RegisterChannelForEndpoint(&proxy, "leaving", pool.CreateChannel());
+  ecm.RegisterChannelForEndpoint(&proxy, "staying", pool.CreateChannel());
+  CountDownLatch unregistered(1);
+  MultiThreadExecutor executor(1);
+
+  // Sends a DISCONNECTION frame, then gives it time to go out before closing
+  // the channel.
+  executor.Execute([&ecm, &unregistered]() {
+    ecm.UnregisterChannelForEndpoint(
+        "leaving", DisconnectionReason::LOCAL_DISCONNECTION,
+        ConnectionsLog::EstablishedConnection::SAFE_DISCONNECTION);
+    unregistered.CountDown();
+  });
+  SystemClock::Sleep(absl::Milliseconds(100));
+  absl::Time start = SystemClock::ElapsedRealtime();
+  std::shared_ptr<EndpointChannel> channel =
+      ecm.GetChannelForEndpoint("staying");
+  absl::Duration lookup_time = SystemClock::ElapsedRealtime() - start;
+
+  ASSERT_NE(channel, nullptr);
+  EXPECT_LT(lookup_time, absl::Milliseconds(200));
+  EXPECT_TRUE(unregistered.Await(absl::Seconds(5)).result());
+  EXPECT_EQ(ecm.GetChannelForEndpoint("leaving"), nullptr);
+
+  channel->Close(DisconnectionReason::LOCAL_DISCONNECTION);
+}
+
 }  // namespace
 }  // namespace connections
 }  // namespace nearby
@@ -15,6 +15,7 @@
 #include "connections/implementation/endpoint_manager.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -115,7 +116,7 @@ class EndpointManager::LockedFrameProcessor {
 //           handler(EndpointChannel) will be called again.
 void EndpointManager::EndpointChannelLoopRunnable(
     const std::string& runnable_name, ClientProxy* client,
-    const std::string& endpoint_id,
+    const std::string& endpoint_id, const std::atomic<bool>* stopped,
     absl::AnyInvocable<ExceptionOr<bool>(EndpointChannel*)> handler) {
   // EndpointChannelManager will not let multiple channels exist simultaneously
   // for the same endpoint_id; it will be closing "old" channels as new ones
@@ -128,6 +129,12 @@ void EndpointManager::EndpointChannelLoopRunnable(
                     << ", endpoint=" << endpoint_id;
   Medium last_failed_medium = Medium::UNKNOWN_MEDIUM;
   while (true) {
+    // A stopped worker must not pick up the channel of an endpoint that has
+    // been registered again since.
+    if (stopped->load()) {
+      NEARBY_LOGS(INFO) << "Worker stopped, bail out.";
+      break;
+    }
     // It's important to keep re-fetching the EndpointChannel for an endpoint
     // because it can be changed out from under us (for example, when we
     // upgrade from Bluetooth to Wifi).
@@ -194,8 +201,10 @@ void EndpointManager::EndpointChannelLoopRunnable(
   NEARBY_LOGS(INFO) << "Worker going down; worker name=" << runnable_name
                     << "; endpoint_id=" << endpoint_id;
   // Always clear out all state related to this endpoint before terminating
-  // this thread.
-  DiscardEndpoint(client, endpoint_id, DisconnectionReason::IO_ERROR);
+  // this thread, unless it was already removed.
+  if (!stopped->load()) {
+    DiscardEndpoint(client, endpoint_id, DisconnectionReason::IO_ERROR);
+  }
   NEARBY_LOGS(INFO) << "Worker done; worker name=" << runnable_name
                     << "; endpoint_id=" << endpoint_id;
 }
@@ -432,11 +441,17 @@ EndpointManager::~EndpointManager() {
   CountDownLatch latch(1);
   RunOnEndpointManagerThread("bring-down-endpoints", [this, &latch]() {
     NEARBY_LOGS(INFO) << "Bringing down endpoints";
-    endpoints_.clear();
+    while (!endpoints_.empty()) {
+      std::string endpoint_id = endpoints_.begin()->first;
+      RemoveEndpointState(endpoint_id);
+    }
     latch.CountDown();
   });
   latch.Await();
 
+  NEARBY_LOGS(INFO) << "Waiting for endpoint workers to finish";
+  reaper_executor_.Shutdown();
+
   NEARBY_LOGS(INFO) << "Bringing down control thread";
   serial_executor_->Shutdown();
   NEARBY_LOGS(INFO) << "EndpointManager is down";
@@ -504,9 +519,13 @@ void EndpointManager::RemoveEndpointState(const std::string& endpoint_id) {
   if (item != endpoints_.end()) {
     NEARBY_LOGS(INFO) << "EndpointState found for endpoint " << endpoint_id;
     // If another instance of data and keep-alive handlers is running, it will
-    // terminate soon. Removing EndpointState waits for workers to complete.
+    // terminate soon. Its medium read may only return once the socket is
+    // really closed though, so the workers are waited for on the reaper
+    // thread rather than here, where they would hold up every other endpoint.
+    item->second->Stop();
+    DestroyOnExecutor(std::move(item->second), &reaper_executor_);
     endpoints_.erase(item);
-    NEARBY_VLOG(1) << "Workers terminated for endpoint " << endpoint_id;
+    NEARBY_VLOG(1) << "Workers stopped for endpoint " << endpoint_id;
   } else {
     NEARBY_LOGS(INFO) << "EndpointState not found for endpoint " << endpoint_id;
   }
@@ -558,9 +577,11 @@ void EndpointManager::RegisterEndpoint(
         client, endpoint_id, std::unique_ptr<EndpointChannel>(channel));
 
     EndpointState& endpoint_state =
-        endpoints_
-            .emplace(endpoint_id, EndpointState(endpoint_id, channel_manager_))
-            .first->second;
+        *endpoints_
+             .emplace(endpoint_id, std::make_unique<EndpointState>(
+                                       endpoint_id, channel_manager_))
+             .first->second;
+    const std::atomic<bool>* stopped = endpoint_state.stopped();
 
     NEARBY_LOGS(INFO) << "Starting workers: endpoint " << endpoint_id;
     // For every endpoint, there's normally only one Read handler instance
@@ -570,9 +591,9 @@ void EndpointManager::RegisterEndpoint(
     // for the next frame. If the handler fails its read and no other
     // EndpointChannels are available for this endpoint, a disconnection
     // will be initiated.
-    endpoint_state.StartEndpointReader([this, client, endpoint_id]() {
+    endpoint_state.StartEndpointReader([this, client, endpoint_id, stopped]() {
       EndpointChannelLoopRunnable(
-          "Read", client, endpoint_id,
+          "Read", client, endpoint_id, stopped,
           [this, client, endpoint_id](EndpointChannel* channel) {
             return HandleData(endpoint_id, client, channel);
           });
@@ -593,11 +614,11 @@ void EndpointManager::RegisterEndpoint(
     NEARBY_VLOG(1) << "EndpointManager enabling KeepAlive for endpoint "
                    << endpoint_id;
     endpoint_state.StartEndpointKeepAliveManager(
-        [this, client, endpoint_id, keep_alive_interval, keep_alive_timeout](
-            Mutex* keep_alive_waiter_mutex,
-            ConditionVariable* keep_alive_waiter) {
+        [this, client, endpoint_id, stopped, keep_alive_interval,
+         keep_alive_timeout](Mutex* keep_alive_waiter_mutex,
+                             ConditionVariable* keep_alive_waiter) {
           EndpointChannelLoopRunnable(
-              "KeepAliveManager", client, endpoint_id,
+              "KeepAliveManager", client, endpoint_id, stopped,
               [this, keep_alive_interval, keep_alive_timeout,
                keep_alive_waiter_mutex,
                keep_alive_waiter](EndpointChannel* channel) {
@@ -658,6 +679,27 @@ std::vector<std::string> EndpointManager::SendPayloadChunk(
       packet_meta_data);
 }
 
+std::vector<std::string> EndpointManager::SendDatagram(
+    const PayloadTransferFrame::PayloadHeader& payload_header,
+    const PayloadTransferFrame::PayloadChunk& payload_chunk,
+    const std::vector<std::string>& endpoint_ids) {
+  ByteArray bytes =
+      parser::ForDataPayloadTransfer(payload_header, payload_chunk);
+  PacketMetaData packet_meta_data;
+
+  std::vector<std::string> failed_endpoint_ids;
+  for (const std::string& endpoint_id : endpoint_ids) {
+    std::shared_ptr<EndpointChannel> channel =
+        channel_manager_->GetChannelForEndpoint(endpoint_id);
+    if (channel == nullptr || !channel->Write(bytes, packet_meta_data).Ok()) {
+      NEARBY_VLOG(1) << "EndpointManager failed to send datagram "
+                     << payload_header.id() << " to endpoint " << endpoint_id;
+      failed_endpoint_ids.push_back(endpoint_id);
+    }
+  }
+  return failed_endpoint_ids;
+}
+
 // Designed to run asynchronously. It is called from IO thread pools, and
 // jobs in these pools may be waited for from the EndpointManager thread. If
 // we allow synchronous behavior here it will cause a live lock.
@@ -960,23 +1002,22 @@ std::vector<std::string> EndpointManager::SendTransferFrameBytes(
 }
 
 EndpointManager::EndpointState::~EndpointState() {
+  // SingleThreadExecutor destructors will wait for the workers to finish.
+  Stop();
+}
+
+void EndpointManager::EndpointState::Stop() {
+  if (stopped_.exchange(true)) return;
   // We must unregister the endpoint first to signal the runnables that they
-  // should exit their loops. SingleThreadExecutor destructors will wait for
-  // the workers to finish. |channel_manager_| is null after moved from this
-  // object (in move constructor) which prevents unregistering the channel
-  // prematurely.
-  if (channel_manager_) {
-    NEARBY_VLOG(1) << "EndpointState destructor " << endpoint_id_;
-    channel_manager_->UnregisterChannelForEndpoint(
-        endpoint_id_, DisconnectionReason::SHUTDOWN,
-        ConnectionsLog::EstablishedConnection::SAFE_DISCONNECTION);
-  }
+  // should exit their loops.
+  NEARBY_VLOG(1) << "Stopping workers of endpoint " << endpoint_id_;
+  channel_manager_->UnregisterChannelForEndpoint(
+      endpoint_id_, DisconnectionReason::SHUTDOWN,
+      ConnectionsLog::EstablishedConnection::SAFE_DISCONNECTION);
 
   // Make sure the KeepAlive thread isn't blocking shutdown.
-  if (keep_alive_waiter_mutex_ && keep_alive_waiter_) {
-    MutexLock lock(keep_alive_waiter_mutex_.get());
-    keep_alive_waiter_->Notify();
-  }
+  MutexLock lock(keep_alive_waiter_mutex_.get());
+  keep_alive_waiter_->Notify();
 }
 
 void EndpointManager::EndpointState::StartEndpointReader(Runnable&& runnable) {
@@ -15,6 +15,7 @@
 #ifndef CORE_INTERNAL_ENDPOINT_MANAGER_H_
 #define CORE_INTERNAL_ENDPOINT_MANAGER_H_
 
+#include <atomic>
 #include <cstdint>
 #include <functional>
 #include <memory>
@@ -135,6 +136,18 @@ class EndpointManager {
           payload_chunk,
       const std::vector<std::string>& endpoint_ids,
       analytics::PacketMetaData& packet_meta_data);
+  // Sends a DATAGRAM payload as a single DATA frame. Returns the list of
+  // endpoints to which sending it failed.
+  //
+  // None of the mediums expose an unreliable socket yet, so the frame goes
+  // over the endpoint channel like any other; datagrams only skip the
+  // per-payload throughput accounting.
+  std::vector<std::string> SendDatagram(
+      const location::nearby::connections::PayloadTransferFrame::PayloadHeader&
+          payload_header,
+      const location::nearby::connections::PayloadTransferFrame::PayloadChunk&
+          payload_chunk,
+      const std::vector<std::string>& endpoint_ids);
   std::vector<std::string> SendControlMessage(
       const location::nearby::connections::PayloadTransferFrame::PayloadHeader&
           payload_header,
@@ -178,28 +191,29 @@ class EndpointManager {
               keep_alive_waiter_mutex_.get())} {}
 
     EndpointState(const EndpointState&) = delete;
-    // The default move constructor would not reset |channel_manager_|, for
-    // example. This needs to be nullified so the destructor shutdown logic is
-    // bypassed when objects are moved.
-    EndpointState(EndpointState&& other)
-        : endpoint_id_{std::move(other.endpoint_id_)},
-          channel_manager_{std::exchange(other.channel_manager_, nullptr)},
-          reader_thread_{std::move(other.reader_thread_)},
-          keep_alive_waiter_mutex_{
-              std::exchange(other.keep_alive_waiter_mutex_, nullptr)},
-          keep_alive_waiter_{std::exchange(other.keep_alive_waiter_, nullptr)},
-          keep_alive_thread_{std::move(other.keep_alive_thread_)} {}
     EndpointState& operator=(const EndpointState&) = delete;
-    EndpointState&& operator=(EndpointState&&) = delete;
+    // Stops the workers, if Stop() was not called, and waits for them to
+    // finish.
     ~EndpointState();
 
     void StartEndpointReader(Runnable&& runnable);
     void StartEndpointKeepAliveManager(
         absl::AnyInvocable<void(Mutex*, ConditionVariable*)> runnable);
 
+    // Signals the workers to exit their loops, by unregistering the channel
+    // of the endpoint and waking up the KeepAlive worker, without waiting for
+    // them. A worker blocked in a medium read exits once the read returns.
+    void Stop();
+
+    // Set by Stop(). Workers check it to exit without touching the endpoint,
+    // which may have been registered again since.
+    const std::atomic<bool>* stopped() const { return &stopped_; }
+
    private:
     const std::string endpoint_id_;
     EndpointChannelManager* channel_manager_;
+    // Declared before the worker threads, which read it until they finish.
+    std::atomic<bool> stopped_ = false;
     SingleThreadExecutor reader_thread_;
 
     // Use a condition variable so we can wait on the thread but still be able
@@ -241,16 +255,18 @@ class EndpointManager {
                                     Mutex* keep_alive_waiter_mutex,
                                     ConditionVariable* keep_alive_waiter);
 
-  // Waits for a given endpoint EndpointChannelLoopRunnable() workers to
-  // terminate.
+  // Stops a given endpoint EndpointChannelLoopRunnable() workers, and hands
+  // them to the reaper thread, which waits for them to terminate. Does not
+  // block on the workers, which may be stuck in a medium read for a while.
   // Is called from RegisterEndpoint to avoid races; also called from
   // RemoveEndpoint as part of proper endpoint shutdown sequence.
   // @EndpointManagerThread
   void RemoveEndpointState(const std::string& endpoint_id);
 
+  // |stopped| is set once the endpoint state of the worker is removed.
   void EndpointChannelLoopRunnable(
       const std::string& runnable_name, ClientProxy* client_proxy,
-      const std::string& endpoint_id,
+      const std::string& endpoint_id, const std::atomic<bool>* stopped,
       absl::AnyInvocable<ExceptionOr<bool>(EndpointChannel*)> handler);
 
   static void WaitForLatch(const std::string& method_name,
@@ -300,7 +316,7 @@ class EndpointManager {
       frame_processors_ ABSL_GUARDED_BY(frame_processors_lock_);
 
   // We keep track of all registered channel endpoints here.
-  absl::flat_hash_map<std::string, EndpointState> endpoints_;
+  absl::flat_hash_map<std::string, std::unique_ptr<EndpointState>> endpoints_;
 
   // Indicates whether the destructor has been called yet. If `is_shutdown_`
   // is true, assume any `ClientProxy` pointers are invalid, and should not
@@ -314,6 +330,10 @@ class EndpointManager {
   mutable RecursiveMutex mutex_;
   bool is_shutdown_ ABSL_GUARDED_BY(mutex_) = false;
 
+  // Destroys removed endpoint states, i.e. waits for their workers to finish,
+  // off the endpoint manager thread. Shut down by the destructor before the
+  // other members go away.
+  SingleThreadExecutor reaper_executor_;
   std::unique_ptr<SingleThreadExecutor> serial_executor_;
 };
 
@@ -356,6 +356,74 @@ TEST_F(EndpointManagerTest, SendControlMessageAndPayloadAckWorks) {
   NEARBY_LOGS(INFO) << "Will call destructors now";
 }
 
+// A medium read may only return once the socket is really gone, well after
+// the channel is closed. That must not hold up other endpoints.
+TEST_F(EndpointManagerTest, SlowReadDoesNotBlockOtherEndpoints) {
+  constexpr absl::Duration kSlowReadDelay = absl::Seconds(3);
+  auto slow_channel = std::make_unique<MockEndpointChannel>();
+  CountDownLatch read_started(1);
+  EXPECT_CALL(*slow_channel, Read(_))
+      .WillOnce([&read_started, kSlowReadDelay](PacketMetaData&) {
+        read_started.CountDown();
+        // Ignores Close().
+        absl::SleepFor(kSlowReadDelay);
+        return ExceptionOr<ByteArray>(Exception::kIo);
+      })
+      .WillRepeatedly(Return(ExceptionOr<ByteArray>(Exception::kIo)));
+  RegisterEndpoint(std::move(slow_channel), /*should_close=*/false);
+  ASSERT_TRUE(read_started.Await(absl::Milliseconds(1000)).result());
+
+  absl::Time start = absl::Now();
+  em_.UnregisterEndpoint(client_.get(), endpoint_id_);
+  endpoint_id_ = "other_endpoint_id";
+  auto other_channel = std::make_unique<MockEndpointChannel>();
+  EXPECT_CALL(*other_channel, Read(_))
+      .WillRepeatedly(Return(ExceptionOr<ByteArray>(Exception::kIo)));
+  RegisterEndpoint(std::move(other_channel));
+  em_.UnregisterEndpoint(client_.get(), endpoint_id_);
+
+  EXPECT_LT(absl::Now() - start, kSlowReadDelay / 2);
+}
+
+// A slow worker of a removed endpoint must not pick up the channel of the
+// endpoint registered again under the same ID.
+TEST_F(EndpointManagerTest, StoppedWorkerLeavesReregisteredEndpointAlone) {
+  constexpr absl::Duration kSlowReadDelay = absl::Milliseconds(500);
+  auto slow_channel = std::make_unique<MockEndpointChannel>();
+  CountDownLatch read_started(1);
+  EXPECT_CALL(*slow_channel, Read(_))
+      .WillOnce([&read_started, kSlowReadDelay](PacketMetaData&) {
+        read_started.CountDown();
+        absl::SleepFor(kSlowReadDelay);
+        return ExceptionOr<ByteArray>(Exception::kIo);
+      });
+  RegisterEndpoint(std::move(slow_channel), /*should_close=*/false);
+  ASSERT_TRUE(read_started.Await(absl::Milliseconds(1000)).result());
+
+  CountDownLatch new_read_started(1);
+  auto new_channel = std::make_unique<MockEndpointChannel>();
+  // Shared with the worker, which may outlive the test body.
+  auto new_channel_closed = std::make_shared<CountDownLatch>(1);
+  ON_CALL(*new_channel, Close(_))
+      .WillByDefault([new_channel_closed](DisconnectionReason) {
+        new_channel_closed->CountDown();
+      });
+  EXPECT_CALL(*new_channel, Read(_))
+      .WillOnce([&new_read_started, new_channel_closed](PacketMetaData&) {
+        new_read_started.CountDown();
+        new_channel_closed->Await();
+        return ExceptionOr<ByteArray>(Exception::kIo);
+      })
+      .WillRepeatedly(Return(ExceptionOr<ByteArray>(Exception::kIo)));
+  RegisterEndpoint(std::move(new_channel), /*should_close=*/false);
+  ASSERT_TRUE(new_read_started.Await(absl::Milliseconds(1000)).result());
+
+  // Once the old worker gives up, the new channel is still registered and read
+  // by its own worker only.
+  absl::SleepFor(2 * kSlowReadDelay);
+  EXPECT_NE(ecm_.GetChannelForEndpoint(endpoint_id_), nullptr);
+}
+
 TEST_F(EndpointManagerTest, SingleReadOnReadError) {
   auto endpoint_channel = std::make_unique<MockEndpointChannel>();
   EXPECT_CALL(*endpoint_channel, Read(_))
@@ -22,6 +22,8 @@
 #include <utility>
 #include <vector>
 
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 #include "connections/implementation/base_bwu_handler.h"
 #include "connections/implementation/bwu_handler.h"
 #include "connections/implementation/bwu_manager.h"
@@ -32,6 +34,9 @@
 #include "internal/platform/byte_array.h"
 #include "internal/platform/exception.h"
 #include "internal/platform/expected.h"
+#include "internal/platform/mutex.h"
+#include "internal/platform/mutex_lock.h"
+#include "proto/connections_enums.pb.h"
 
 namespace nearby {
 namespace connections {
@@ -40,7 +45,8 @@ namespace connections {
 // service and endpoint IDs inputs are recorded and can be inspected. The method
 // NotifyBwuManagerOfIncomingConnection will send the BwuManager an incoming
 // connection corresponding to a previous
-// HandleInitializeUpgradedMediumForEndpoint call.
+// HandleInitializeUpgradedMediumForEndpoint call. Joining an upgrade path can
+// be made slow or failing with set_create_result().
 class FakeBwuHandler : public BaseBwuHandler {
  public:
   using Medium = ::location::nearby::proto::connections::Medium;
@@ -68,6 +74,17 @@ class FakeBwuHandler : public BaseBwuHandler {
     return handle_revert_calls_;
   }
 
+  // Makes CreateUpgradedEndpointChannel() take |delay|, then fail with
+  // |error| if it is set.
+  void set_create_result(
+      absl::Duration delay,
+      std::optional<location::nearby::proto::connections::OperationResultCode>
+          error = std::nullopt) {
+    MutexLock lock(&mutex_);
+    create_delay_ = delay;
+    create_error_ = error;
+  }
+
   // Builds an incoming connection corresponding to
   // handle_initialize_calls()[initialize_call_index], and sends it to the
   // BwuManager. Return a pointer to the upgraded channel.
@@ -116,10 +133,25 @@ class FakeBwuHandler : public BaseBwuHandler {
       ClientProxy* client, const std::string& service_id,
       const std::string& endpoint_id,
       const UpgradePathInfo& upgrade_path_info) final {
-    create_calls_.push_back({.client = client,
-                             .service_id = service_id,
-                             .endpoint_id = endpoint_id});
-    return {std::make_unique<FakeEndpointChannel>(medium_, service_id)};
+    absl::Duration delay;
+    std::optional<location::nearby::proto::connections::OperationResultCode>
+        error;
+    {
+      MutexLock lock(&mutex_);
+      create_calls_.push_back({.client = client,
+                               .service_id = service_id,
+                               .endpoint_id = endpoint_id});
+      delay = create_delay_;
+      error = create_error_;
+    }
+    absl::SleepFor(delay);
+    if (error.has_value()) return {Error(*error)};
+    // Load the BANDWIDTH_UPGRADE_NEGOTIATION.CLIENT_INTRODUCTION_ACK that the
+    // remote device (BWU Initiator) writes once it has read the introduction.
+    auto channel = std::make_unique<FakeEndpointChannel>(medium_, service_id);
+    channel->set_read_output(
+        ExceptionOr<ByteArray>(parser::ForBwuIntroductionAck()));
+    return {std::move(channel)};
   }
 
   Medium GetUpgradeMedium() const final { return medium_; }
@@ -172,10 +204,18 @@ class FakeBwuHandler : public BaseBwuHandler {
 
   void HandleRevertInitiatorStateForService(
       const std::string& upgrade_service_id) final {
+    MutexLock lock(&mutex_);
     handle_revert_calls_.push_back({.service_id = upgrade_service_id});
   }
 
   Medium medium_;
+  // Guards the state used by CreateUpgradedEndpointChannel() and
+  // RevertResponderState(), which the BwuManager may call from several threads
+  // at once.
+  Mutex mutex_;
+  absl::Duration create_delay_ = absl::ZeroDuration();
+  std::optional<location::nearby::proto::connections::OperationResultCode>
+      create_error_;
   std::vector<InputData> create_calls_;
   std::vector<InputData> disconnect_calls_;
   std::vector<InputData> handle_initialize_calls_;
@@ -0,0 +1,131 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Round-trip fuzzer for the advertisement codecs. Any input one of the
+// decoders accepts must serialize to a canonical form that decodes back to
+// itself byte for byte.
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "connections/implementation/ble_advertisement.h"
+#include "connections/implementation/bluetooth_device_name.h"
+#include "connections/implementation/mediums/ble_v2/ble_advertisement_header.h"
+#include "connections/implementation/mediums/ble_v2/ble_packet.h"
+#include "connections/implementation/mediums/ble_v2/instant_on_lost_advertisement.h"
+#include "connections/implementation/wifi_lan_service_info.h"
+#include "internal/platform/base64_utils.h"
+#include "internal/platform/byte_array.h"
+#include "internal/platform/logging.h"
+#include "internal/platform/nsd_service_info.h"
+
+namespace nearby {
+namespace connections {
+namespace {
+
+void RoundTripBleAdvertisement(bool fast_advertisement,
+                               const ByteArray& bytes) {
+  absl::StatusOr<BleAdvertisement> advertisement =
+      BleAdvertisement::CreateBleAdvertisement(fast_advertisement, bytes);
+  if (!advertisement.ok()) return;
+
+  ByteArray canonical(*advertisement);
+  absl::StatusOr<BleAdvertisement> reparsed =
+      BleAdvertisement::CreateBleAdvertisement(fast_advertisement, canonical);
+  CHECK(reparsed.ok());
+  CHECK(ByteArray(*reparsed) == canonical);
+  CHECK_EQ(canonical.size(), advertisement->GetSerializedSize());
+}
+
+void RoundTripBleAdvertisementHeader(const ByteArray& bytes) {
+  mediums::BleAdvertisementHeader header(bytes);
+  if (!header.IsValid()) return;
+
+  ByteArray canonical(header);
+  mediums::BleAdvertisementHeader reparsed(canonical);
+  CHECK(reparsed.IsValid());
+  CHECK(ByteArray(reparsed) == canonical);
+}
+
+void RoundTripBlePacket(const ByteArray& bytes) {
+  mediums::BlePacket packet(bytes);
+  if (!packet.IsValid()) return;
+
+  ByteArray canonical(packet);
+  CHECK(canonical == bytes);
+  mediums::BlePacket reparsed(canonical);
+  CHECK_EQ(reparsed.IsControlPacket(), packet.IsControlPacket());
+}
+
+void RoundTripBluetoothDeviceName(const ByteArray& bytes) {
+  BluetoothDeviceName name(Base64Utils::Encode(bytes));
+  if (!name.IsValid()) return;
+
+  std::string canonical(name);
+  BluetoothDeviceName reparsed(canonical);
+  CHECK(reparsed.IsValid());
+  CHECK_EQ(std::string(reparsed), canonical);
+}
+
+void RoundTripWifiLanServiceInfo(const ByteArray& bytes) {
+  NsdServiceInfo nsd_service_info;
+  nsd_service_info.SetServiceName(Base64Utils::Encode(bytes));
+  WifiLanServiceInfo service_info(nsd_service_info);
+  if (!service_info.IsValid()) return;
+
+  NsdServiceInfo canonical(service_info);
+  WifiLanServiceInfo reparsed(canonical);
+  CHECK(reparsed.IsValid());
+  CHECK_EQ(NsdServiceInfo(reparsed).GetServiceName(),
+           canonical.GetServiceName());
+}
+
+void RoundTripInstantOnLostAdvertisement(absl::string_view bytes) {
+  absl::StatusOr<mediums::InstantOnLostAdvertisement> advertisement =
+      mediums::InstantOnLostAdvertisement::CreateFromBytes(bytes);
+  if (!advertisement.ok()) return;
+
+  std::string canonical = advertisement->ToBytes();
+  absl::StatusOr<mediums::InstantOnLostAdvertisement> reparsed =
+      mediums::InstantOnLostAdvertisement::CreateFromBytes(canonical);
+  CHECK(reparsed.ok());
+  CHECK(reparsed->hashes() == advertisement->hashes());
+  CHECK_EQ(reparsed->ToBytes(), canonical);
+}
+
+}  // namespace
+}  // namespace connections
+}  // namespace nearby
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+  nearby::ByteArray byte_array;
+  byte_array.SetData(reinterpret_cast<const char*>(data), size);
+
+  nearby::connections::RoundTripBleAdvertisement(/*fast_advertisement=*/false,
+                                                 byte_array);
+  nearby::connections::RoundTripBleAdvertisement(/*fast_advertisement=*/true,
+                                                 byte_array);
+  nearby::connections::RoundTripBleAdvertisementHeader(byte_array);
+  nearby::connections::RoundTripBlePacket(byte_array);
+  nearby::connections::RoundTripBluetoothDeviceName(byte_array);
+  nearby::connections::RoundTripWifiLanServiceInfo(byte_array);
+  nearby::connections::RoundTripInstantOnLostAdvertisement(
+      byte_array.AsStringView());
+
+  return 0;
+}
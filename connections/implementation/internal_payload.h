@@ -92,6 +92,10 @@ class InternalPayload {
   // @return the offset really skipped
   virtual ExceptionOr<size_t> SkipToOffset(size_t offset) = 0;
 
+  // Called once the chunk last returned by DetachNextChunk() was written to
+  // all of its recipients.
+  virtual void OnChunkSent() {}
+
   // Cleans up any resources used by this Payload. Called when we're stopping
   // early, e.g. after being cancelled or having no more recipients left.
   virtual void Close() {}
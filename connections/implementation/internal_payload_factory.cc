@@ -14,15 +14,20 @@
 
 #include "connections/implementation/internal_payload_factory.h"
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
 
 #include "absl/strings/str_cat.h"
+#include "absl/time/time.h"
 #include "connections/implementation/internal_payload.h"
+#include "connections/implementation/low_latency_stream_reader.h"
 #include "connections/implementation/proto/offline_wire_formats.pb.h"
+#include "connections/low_latency_stream_options.h"
 #include "connections/payload.h"
 #include "connections/payload_type.h"
 #include "internal/platform/byte_array.h"
@@ -155,6 +160,72 @@ class OutgoingStreamInternalPayload : public InternalPayload {
   }
 };
 
+// Outgoing STREAM payload whose chunks hold whatever data has arrived instead
+// of waiting for full chunks; see LowLatencyStreamOptions.
+class OutgoingLowLatencyStreamInternalPayload : public InternalPayload {
+ public:
+  explicit OutgoingLowLatencyStreamInternalPayload(Payload payload)
+      : InternalPayload(std::move(payload)),
+        latency_stats_cb_(
+            payload_.GetLowLatencyStreamOptions()->latency_stats_cb),
+        reader_(*payload_.AsStream(), *payload_.GetLowLatencyStreamOptions()) {
+  }
+  ~OutgoingLowLatencyStreamInternalPayload() override { Close(); }
+
+  PayloadTransferFrame::PayloadHeader::PayloadType GetType() const override {
+    return PayloadTransferFrame::PayloadHeader::STREAM;
+  }
+
+  std::int64_t GetTotalSize() const override { return -1; }
+
+  ByteArray DetachNextChunk(int chunk_size) override {
+    ByteArray chunk = reader_.NextChunk(chunk_size);
+    if (chunk.Empty()) {
+      LOG(INFO) << "No more data for outgoing low latency payload " << this
+                << ", closing InputStream.";
+      Close();
+    }
+    return chunk;
+  }
+
+  void OnChunkSent() override { reader_.OnChunkSent(); }
+
+  Exception AttachNextChunk(const ByteArray& chunk) override {
+    return {Exception::kIo};
+  }
+
+  // Data read before a reconnection is stale by the time the transfer
+  // resumes, so a low latency stream can't be resumed.
+  ExceptionOr<size_t> SkipToOffset(size_t offset) override {
+    Close();
+    return {Exception::kIo};
+  }
+
+  void Close() override {
+    // Closing the stream unblocks the reading thread.
+    reader_.Close();
+    InputStream* stream = payload_.AsStream();
+    if (stream) stream->Close();
+    if (stats_reported_.exchange(true)) return;
+
+    StreamLatencyStats stats = reader_.GetStats();
+    LOG(INFO) << "Low latency payload " << payload_id_ << " sent "
+              << stats.bytes_sent << " bytes in " << stats.chunks_sent
+              << " chunks, dropped " << stats.bytes_dropped
+              << " bytes; latency p50="
+              << absl::FormatDuration(stats.p50_latency)
+              << " p90=" << absl::FormatDuration(stats.p90_latency)
+              << " p99=" << absl::FormatDuration(stats.p99_latency)
+              << " max=" << absl::FormatDuration(stats.max_latency);
+    if (latency_stats_cb_) latency_stats_cb_(stats);
+  }
+
+ private:
+  std::function<void(const StreamLatencyStats&)> latency_stats_cb_;
+  std::atomic<bool> stats_reported_ = false;
+  LowLatencyStreamReader reader_;
+};
+
 class IncomingStreamInternalPayload : public InternalPayload {
  public:
   IncomingStreamInternalPayload(Payload payload,
@@ -320,6 +391,11 @@ ErrorOr<std::unique_ptr<InternalPayload>> CreateOutgoingInternalPayload(
     }
 
     case PayloadType::kStream:
+      if (payload.GetLowLatencyStreamOptions() != nullptr &&
+          payload.AsStream() != nullptr) {
+        return {std::make_unique<OutgoingLowLatencyStreamInternalPayload>(
+            std::move(payload))};
+      }
       return {
           std::make_unique<OutgoingStreamInternalPayload>(std::move(payload))};
 
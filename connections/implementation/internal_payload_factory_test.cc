@@ -23,6 +23,7 @@
 #include "gtest/gtest.h"
 #include "connections/implementation/internal_payload.h"
 #include "connections/implementation/proto/offline_wire_formats.pb.h"
+#include "connections/low_latency_stream_options.h"
 #include "connections/payload.h"
 #include "connections/payload_type.h"
 #include "internal/platform/byte_array.h"
@@ -64,6 +65,30 @@ TEST(InternalPayloadFactoryTest, CanCreateInternalPayloadFromStreamPayload) {
   EXPECT_EQ(payload.AsBytes(), ByteArray());
 }
 
+TEST(InternalPayloadFactoryTest, LowLatencyStreamPayloadSendsPartialChunks) {
+  auto [input, output] = CreatePipe();
+  StreamLatencyStats stats;
+  LowLatencyStreamOptions options;
+  options.latency_stats_cb = [&stats](const StreamLatencyStats& result) {
+    stats = result;
+  };
+  ErrorOr<std::unique_ptr<InternalPayload>> result =
+      CreateOutgoingInternalPayload(Payload(std::move(input), options));
+  ASSERT_FALSE(result.has_error());
+  std::unique_ptr<InternalPayload> internal_payload = std::move(result.value());
+  EXPECT_EQ(internal_payload->GetType(),
+            PayloadTransferFrame::PayloadHeader::STREAM);
+  output->Write(ByteArray(kText));
+
+  EXPECT_EQ(internal_payload->DetachNextChunk(64 * 1024), ByteArray(kText));
+  internal_payload->OnChunkSent();
+  output->Close();
+  EXPECT_EQ(internal_payload->DetachNextChunk(64 * 1024), ByteArray());
+
+  EXPECT_EQ(stats.chunks_sent, 1);
+  EXPECT_EQ(stats.bytes_sent, sizeof(kText) - 1);
+}
+
 TEST(InternalPayloadFactoryTest, CanCreateInternalPayloadFromFilePayload) {
   Payload::Id payload_id = Payload::GenerateId();
   InputFile inputFile(payload_id, 512);
@@ -0,0 +1,123 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Lock contention of two simulation users exchanging payloads.
+//
+// Only meaningful in a build with the lock profiler, where it logs the
+// hottest lock sites:
+//   bazel test --config=lock_profiling --test_output=all \
+//     //connections/implementation:lock_contention_simulation_test
+
+#include <string>
+#include <utility>
+
+#include "gtest/gtest.h"
+#include "absl/strings/match.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/time.h"
+#include "connections/implementation/simulation_user.h"
+#include "connections/medium_selector.h"
+#include "connections/payload.h"
+#include "internal/platform/byte_array.h"
+#include "internal/platform/count_down_latch.h"
+#include "internal/platform/lock_profiler.h"
+#include "internal/platform/logging.h"
+#include "internal/platform/medium_environment.h"
+#include "internal/platform/pipe.h"
+
+namespace nearby {
+namespace connections {
+namespace {
+
+constexpr absl::string_view kServiceId = "service-id";
+constexpr absl::string_view kMessage = "message";
+constexpr absl::Duration kDefaultTimeout = absl::Milliseconds(1000);
+constexpr int kPayloads = 50;
+
+class PayloadSimulationUser : public SimulationUser {
+ public:
+  explicit PayloadSimulationUser(absl::string_view name)
+      : SimulationUser(std::string(name),
+                       BooleanMediumSelector{.wifi_lan = true}) {}
+
+  Payload& GetPayload() { return payload_; }
+  void SendPayload(Payload payload) {
+    pm_.SendPayload(&client_, {discovered_.endpoint_id}, std::move(payload));
+  }
+};
+
+TEST(LockContentionSimulationTest, ReportsHottestLockSites) {
+  if (!LockProfiler::IsEnabled()) {
+    GTEST_SKIP() << "Needs a build with NEARBY_LOCK_PROFILING.";
+  }
+  MediumEnvironment& env = MediumEnvironment::Instance();
+  env.Start();
+  {
+    PayloadSimulationUser user_a("device-a");
+    PayloadSimulationUser user_b("device-b");
+    CountDownLatch discovery_latch(1);
+    CountDownLatch connection_latch(2);
+    CountDownLatch accept_latch(2);
+    user_a.StartAdvertising(std::string(kServiceId), &connection_latch);
+    user_b.StartDiscovery(std::string(kServiceId), &discovery_latch);
+    ASSERT_TRUE(discovery_latch.Await(kDefaultTimeout).result());
+    user_b.RequestConnection(&connection_latch);
+    ASSERT_TRUE(connection_latch.Await(kDefaultTimeout).result());
+    user_a.AcceptConnection(&accept_latch);
+    user_b.AcceptConnection(&accept_latch);
+    ASSERT_TRUE(accept_latch.Await(kDefaultTimeout).result());
+    // Only profile the payload exchange.
+    LockProfiler::Reset();
+
+    // A stream, while small payloads are sent alongside it.
+    auto [input, tx] = CreatePipe();
+    CountDownLatch stream_latch(1);
+    user_a.ExpectPayload(stream_latch);
+    const ByteArray message{std::string(kMessage)};
+    tx->Write(message);
+    user_b.SendPayload(Payload(std::move(input)));
+    ASSERT_TRUE(stream_latch.Await(kDefaultTimeout).result());
+    // Keep the stream open while the other payloads arrive.
+    Payload stream = std::move(user_a.GetPayload());
+    for (int i = 0; i < kPayloads; ++i) {
+      user_b.SendPayload(Payload(ByteArray(std::string(kMessage))));
+      tx->Write(message);
+    }
+    EXPECT_TRUE(user_a.WaitForProgress(
+        [](const PayloadProgressInfo& info) {
+          return info.status == PayloadProgressInfo::Status::kSuccess;
+        },
+        kDefaultTimeout));
+    tx->Close();
+    user_a.Stop();
+    user_b.Stop();
+  }
+  env.Stop();
+
+  NEARBY_LOGS(INFO) << "Lock contention profile:\n"
+                    << LockProfiler::FormatReport();
+  bool saw_connections = false;
+  for (const LockProfiler::SiteStats& stats : LockProfiler::GetReport()) {
+    if (absl::StrContains(stats.site, "connections/implementation/") &&
+        stats.acquisitions > 0) {
+      saw_connections = true;
+      break;
+    }
+  }
+  EXPECT_TRUE(saw_connections);
+}
+
+}  // namespace
+}  // namespace connections
+}  // namespace nearby
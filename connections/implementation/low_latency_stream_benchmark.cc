@@ -0,0 +1,220 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// End-to-end latency of a real-time STREAM payload between two simulation
+// users connected over Wi-Fi LAN.
+//
+// A synthetic source produces fixed size frames at a constant rate, each
+// stamped with the time it was produced, and the receiver measures how long
+// every frame took to arrive. Like file and socket streams, the source only
+// returns from Read() once the requested number of bytes exists, so a normal
+// STREAM payload waits for a full chunk while a low latency one sends what
+// has arrived. Each benchmark reports these counters:
+//   p50_ms, p90_ms, p99_ms, max_ms
+//                  Frame latency from production to arrival.
+//   dropped_frames Frames dropped under backpressure, per stream.
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "connections/implementation/simulation_user.h"
+#include "connections/implementation/simulation_user_pair.h"
+#include "connections/low_latency_stream_options.h"
+#include "connections/medium_selector.h"
+#include "connections/payload.h"
+#include "internal/platform/byte_array.h"
+#include "internal/platform/count_down_latch.h"
+#include "internal/platform/exception.h"
+#include "internal/platform/input_stream.h"
+
+namespace nearby {
+namespace connections {
+namespace {
+
+constexpr absl::string_view kServiceId = "service-id";
+constexpr absl::Duration kTimeout = absl::Seconds(10);
+// 160 byte frames every 2ms, e.g. 16 bit mono audio at 40 kHz.
+constexpr int kFrameSize = 160;
+constexpr absl::Duration kFrameInterval = absl::Milliseconds(2);
+constexpr int kFramesPerStream = 250;
+
+// Produces kFramesPerStream frames at a constant rate. Each frame starts with
+// the time it was produced, in nanoseconds since the epoch.
+class ConstantRateInputStream : public InputStream {
+ public:
+  ConstantRateInputStream() : start_(absl::Now()) {}
+
+  ExceptionOr<ByteArray> Read(std::int64_t size) override {
+    while (!closed_) {
+      int due_frames = std::min<std::int64_t>(
+          kFramesPerStream, (absl::Now() - start_) / kFrameInterval + 1);
+      for (; produced_frames_ < due_frames; ++produced_frames_) {
+        std::int64_t produced_at_nanos = absl::ToUnixNanos(
+            start_ + produced_frames_ * kFrameInterval);
+        std::string frame(kFrameSize, '\0');
+        std::memcpy(frame.data(), &produced_at_nanos,
+                    sizeof(produced_at_nanos));
+        buffer_ += frame;
+      }
+      if (buffer_.size() >= size || produced_frames_ == kFramesPerStream) {
+        size_t read_size = std::min<size_t>(size, buffer_.size());
+        ByteArray bytes(buffer_.substr(0, read_size));
+        buffer_.erase(0, read_size);
+        return ExceptionOr<ByteArray>(std::move(bytes));
+      }
+      absl::SleepFor(start_ + produced_frames_ * kFrameInterval - absl::Now());
+    }
+    return {Exception::kIo};
+  }
+
+  Exception Close() override {
+    closed_ = true;
+    return {Exception::kSuccess};
+  }
+
+ private:
+  const absl::Time start_;
+  std::atomic<bool> closed_ = false;
+  int produced_frames_ = 0;
+  std::string buffer_;
+};
+
+class StreamSimulationUser : public SimulationUser {
+ public:
+  explicit StreamSimulationUser(absl::string_view name)
+      : SimulationUser(std::string(name),
+                       BooleanMediumSelector{.wifi_lan = true}) {}
+
+  Payload& GetPayload() { return payload_; }
+  void SendPayload(Payload payload) {
+    pm_.SendPayload(&client_, {discovered_.endpoint_id}, std::move(payload));
+  }
+};
+
+// Streams frames between a connected sender and receiver. One instance is
+// shared by all benchmarks.
+class StreamSimulation {
+ public:
+  bool connected() const { return users_.connected(); }
+
+  // Sends one stream and returns the latency of every frame received.
+  std::vector<absl::Duration> SendStream(Payload payload) {
+    CountDownLatch payload_latch(1);
+    users_.receiver().ExpectPayload(payload_latch);
+    users_.sender().SendPayload(std::move(payload));
+    std::vector<absl::Duration> latencies;
+    if (!payload_latch.Await(kTimeout).result()) return latencies;
+
+    InputStream* stream = users_.receiver().GetPayload().AsStream();
+    std::string pending;
+    while (stream != nullptr) {
+      ExceptionOr<ByteArray> bytes = stream->Read(64 * 1024);
+      if (!bytes.ok() || bytes.result().Empty()) break;
+      absl::Time received_at = absl::Now();
+      pending += std::string(bytes.result());
+      size_t offset = 0;
+      for (; offset + kFrameSize <= pending.size(); offset += kFrameSize) {
+        std::int64_t produced_at_nanos;
+        std::memcpy(&produced_at_nanos, pending.data() + offset,
+                    sizeof(produced_at_nanos));
+        latencies.push_back(received_at -
+                            absl::FromUnixNanos(produced_at_nanos));
+      }
+      pending.erase(0, offset);
+    }
+    users_.receiver().ExpectPayload(idle_latch_);
+    return latencies;
+  }
+
+ private:
+  SimulationUserPair<StreamSimulationUser> users_{kServiceId, kTimeout};
+  // Parks the receiver's payload latch between streams.
+  CountDownLatch idle_latch_{1};
+};
+
+StreamSimulation& GetSimulation() {
+  static StreamSimulation* simulation = new StreamSimulation();
+  return *simulation;
+}
+
+double ToMs(absl::Duration duration) {
+  return absl::ToDoubleMilliseconds(duration);
+}
+
+void RunStreamBenchmark(benchmark::State& state, bool low_latency) {
+  StreamSimulation& simulation = GetSimulation();
+  if (!simulation.connected()) {
+    state.SkipWithError("Simulation users failed to connect.");
+    return;
+  }
+
+  std::vector<absl::Duration> latencies;
+  std::int64_t frames_sent = 0;
+  // Reads of one frame return as soon as the frame is produced.
+  LowLatencyStreamOptions options;
+  options.read_size = kFrameSize;
+  for (auto _ : state) {
+    auto source = std::make_unique<ConstantRateInputStream>();
+    Payload payload = low_latency ? Payload(std::move(source), options)
+                                  : Payload(std::move(source));
+    std::vector<absl::Duration> stream_latencies =
+        simulation.SendStream(std::move(payload));
+    latencies.insert(latencies.end(), stream_latencies.begin(),
+                     stream_latencies.end());
+    frames_sent += kFramesPerStream;
+  }
+  if (latencies.empty()) {
+    state.SkipWithError("No frames received.");
+    return;
+  }
+
+  std::sort(latencies.begin(), latencies.end());
+  auto percentile = [&latencies](int p) {
+    return ToMs(latencies[(latencies.size() - 1) * p / 100]);
+  };
+  state.counters["p50_ms"] = percentile(50);
+  state.counters["p90_ms"] = percentile(90);
+  state.counters["p99_ms"] = percentile(99);
+  state.counters["max_ms"] = ToMs(latencies.back());
+  state.counters["dropped_frames"] = benchmark::Counter(
+      frames_sent - latencies.size(), benchmark::Counter::kAvgIterations);
+}
+
+void BM_StreamLatency(benchmark::State& state) {
+  RunStreamBenchmark(state, /*low_latency=*/false);
+}
+
+void BM_LowLatencyStreamLatency(benchmark::State& state) {
+  RunStreamBenchmark(state, /*low_latency=*/true);
+}
+
+BENCHMARK(BM_StreamLatency)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_LowLatencyStreamLatency)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace connections
+}  // namespace nearby
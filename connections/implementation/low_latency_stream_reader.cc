@@ -0,0 +1,178 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "connections/implementation/low_latency_stream_reader.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/time/time.h"
+#include "connections/low_latency_stream_options.h"
+#include "internal/platform/byte_array.h"
+#include "internal/platform/exception.h"
+#include "internal/platform/input_stream.h"
+#include "internal/platform/logging.h"
+#include "internal/platform/mutex_lock.h"
+#include "internal/platform/system_clock.h"
+
+namespace nearby {
+namespace connections {
+
+namespace {
+
+// Returns the `percentile` of `sorted_latencies`, which must not be empty.
+absl::Duration Percentile(const std::vector<absl::Duration>& sorted_latencies,
+                          int percentile) {
+  size_t index = (sorted_latencies.size() - 1) * percentile / 100;
+  return sorted_latencies[index];
+}
+
+}  // namespace
+
+LowLatencyStreamReader::LowLatencyStreamReader(
+    InputStream& stream, const LowLatencyStreamOptions& options)
+    : stream_(stream),
+      overflow_policy_(options.overflow_policy),
+      max_chunk_delay_(std::max(options.max_chunk_delay, absl::ZeroDuration())),
+      read_size_(std::max<std::int64_t>(options.read_size, 1)),
+      max_queued_bytes_(std::max(options.max_queued_bytes, read_size_)) {
+  latencies_.reserve(kMaxLatencySamples);
+  read_executor_.Execute("low-latency-stream-read", [this]() { ReadLoop(); });
+}
+
+LowLatencyStreamReader::~LowLatencyStreamReader() { Close(); }
+
+void LowLatencyStreamReader::ReadLoop() {
+  while (true) {
+    ExceptionOr<ByteArray> bytes_read = stream_.Read(read_size_);
+    absl::Time read_at = SystemClock::ElapsedRealtime();
+    MutexLock lock(&mutex_);
+    if (closed_) return;
+    if (!bytes_read.ok() || bytes_read.result().Empty()) {
+      end_of_stream_ = true;
+      cond_.Notify();
+      return;
+    }
+
+    queued_bytes_ += bytes_read.result().size();
+    queue_.push_back({std::move(bytes_read.result()), read_at});
+    if (overflow_policy_ ==
+        LowLatencyStreamOptions::OverflowPolicy::kDropOldest) {
+      while (queued_bytes_ > max_queued_bytes_ && queue_.size() > 1) {
+        queued_bytes_ -= queue_.front().data.size();
+        stats_.bytes_dropped += queue_.front().data.size();
+        queue_.pop_front();
+      }
+    }
+    cond_.Notify();
+
+    if (overflow_policy_ == LowLatencyStreamOptions::OverflowPolicy::kBlock) {
+      while (queued_bytes_ >= max_queued_bytes_ && !closed_) {
+        cond_.Wait();
+      }
+    }
+  }
+}
+
+ByteArray LowLatencyStreamReader::NextChunk(int chunk_size) {
+  if (chunk_size <= 0) return {};
+
+  MutexLock lock(&mutex_);
+  while (!closed_ && queued_bytes_ < chunk_size) {
+    if (queue_.empty()) {
+      if (end_of_stream_) break;
+      cond_.Wait();
+      continue;
+    }
+    if (end_of_stream_) break;
+    absl::Duration wait = queue_.front().read_at + max_chunk_delay_ -
+                          SystemClock::ElapsedRealtime();
+    if (wait <= absl::ZeroDuration()) break;
+    cond_.Wait(wait);
+  }
+  if (closed_ || queue_.empty()) {
+    pending_chunk_size_ = 0;
+    return {};
+  }
+
+  // Merge queued reads, splitting the last one if it overflows the chunk.
+  pending_chunk_read_at_ = queue_.front().read_at;
+  size_t max_size = chunk_size;
+  std::string chunk;
+  chunk.reserve(std::min<std::int64_t>(queued_bytes_, chunk_size));
+  while (!queue_.empty() && chunk.size() < max_size) {
+    Segment& segment = queue_.front();
+    size_t remaining = max_size - chunk.size();
+    if (segment.data.size() <= remaining) {
+      chunk.append(segment.data.data(), segment.data.size());
+      queue_.pop_front();
+    } else {
+      chunk.append(segment.data.data(), remaining);
+      segment.data = ByteArray(segment.data.data() + remaining,
+                               segment.data.size() - remaining);
+    }
+  }
+  queued_bytes_ -= chunk.size();
+  pending_chunk_size_ = chunk.size();
+  // Wakes the reading thread if it is blocked on a full queue.
+  cond_.Notify();
+  return ByteArray(std::move(chunk));
+}
+
+void LowLatencyStreamReader::OnChunkSent() {
+  MutexLock lock(&mutex_);
+  if (pending_chunk_size_ == 0) return;
+
+  absl::Duration latency =
+      SystemClock::ElapsedRealtime() - pending_chunk_read_at_;
+  if (latencies_.size() < kMaxLatencySamples) {
+    latencies_.push_back(latency);
+  } else {
+    latencies_[next_latency_index_] = latency;
+  }
+  next_latency_index_ = (next_latency_index_ + 1) % kMaxLatencySamples;
+  stats_.chunks_sent++;
+  stats_.bytes_sent += pending_chunk_size_;
+  pending_chunk_size_ = 0;
+}
+
+void LowLatencyStreamReader::Close() {
+  MutexLock lock(&mutex_);
+  if (closed_) return;
+  closed_ = true;
+  queue_.clear();
+  queued_bytes_ = 0;
+  cond_.Notify();
+}
+
+StreamLatencyStats LowLatencyStreamReader::GetStats() const {
+  MutexLock lock(&mutex_);
+  StreamLatencyStats stats = stats_;
+  if (latencies_.empty()) return stats;
+
+  std::vector<absl::Duration> sorted_latencies = latencies_;
+  std::sort(sorted_latencies.begin(), sorted_latencies.end());
+  stats.p50_latency = Percentile(sorted_latencies, 50);
+  stats.p90_latency = Percentile(sorted_latencies, 90);
+  stats.p99_latency = Percentile(sorted_latencies, 99);
+  stats.max_latency = sorted_latencies.back();
+  return stats;
+}
+
+}  // namespace connections
+}  // namespace nearby
@@ -0,0 +1,109 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef CORE_INTERNAL_LOW_LATENCY_STREAM_READER_H_
+#define CORE_INTERNAL_LOW_LATENCY_STREAM_READER_H_
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/time/time.h"
+#include "connections/low_latency_stream_options.h"
+#include "internal/platform/byte_array.h"
+#include "internal/platform/condition_variable.h"
+#include "internal/platform/input_stream.h"
+#include "internal/platform/mutex.h"
+#include "internal/platform/single_thread_executor.h"
+
+namespace nearby {
+namespace connections {
+
+// Reads an InputStream ahead of the payload send loop for a low latency
+// STREAM payload, and hands out chunks holding whatever data has arrived.
+//
+// A background thread reads the stream in reads of
+// LowLatencyStreamOptions::read_size into a bounded queue. NextChunk() merges
+// queued reads into one chunk as soon as a full chunk is queued or the oldest
+// queued read has waited max_chunk_delay.
+// This class is thread-safe.
+class LowLatencyStreamReader {
+ public:
+  // Number of chunk latencies kept for the percentiles in GetStats().
+  static constexpr int kMaxLatencySamples = 1024;
+
+  // `stream` must outlive this object, and its Read() must return once the
+  // stream is closed.
+  LowLatencyStreamReader(InputStream& stream,
+                         const LowLatencyStreamOptions& options);
+  ~LowLatencyStreamReader();
+
+  // Returns the next chunk of at most `chunk_size` bytes. Blocks until a full
+  // chunk is queued, the oldest queued byte has waited max_chunk_delay, or the
+  // stream ends. Returns an empty ByteArray once the stream has ended and all
+  // queued data has been returned, or after Close().
+  ByteArray NextChunk(int chunk_size) ABSL_LOCKS_EXCLUDED(mutex_);
+
+  // Records that the chunk last returned by NextChunk() was sent.
+  void OnChunkSent() ABSL_LOCKS_EXCLUDED(mutex_);
+
+  // Stops handing out chunks and unblocks NextChunk(). The reading thread
+  // exits once its pending Read() returns, e.g. after the stream is closed.
+  void Close() ABSL_LOCKS_EXCLUDED(mutex_);
+
+  StreamLatencyStats GetStats() const ABSL_LOCKS_EXCLUDED(mutex_);
+
+ private:
+  // One Read() from the stream.
+  struct Segment {
+    ByteArray data;
+    absl::Time read_at;
+  };
+
+  void ReadLoop() ABSL_LOCKS_EXCLUDED(mutex_);
+
+  InputStream& stream_;
+  const LowLatencyStreamOptions::OverflowPolicy overflow_policy_;
+  const absl::Duration max_chunk_delay_;
+  const std::int64_t read_size_;
+  const std::int64_t max_queued_bytes_;
+
+  mutable Mutex mutex_;
+  ConditionVariable cond_{&mutex_};
+  std::deque<Segment> queue_ ABSL_GUARDED_BY(mutex_);
+  std::int64_t queued_bytes_ ABSL_GUARDED_BY(mutex_) = 0;
+  bool end_of_stream_ ABSL_GUARDED_BY(mutex_) = false;
+  bool closed_ ABSL_GUARDED_BY(mutex_) = false;
+
+  // Read time of the oldest byte and size of the chunk last returned by
+  // NextChunk().
+  absl::Time pending_chunk_read_at_ ABSL_GUARDED_BY(mutex_);
+  std::int64_t pending_chunk_size_ ABSL_GUARDED_BY(mutex_) = 0;
+
+  StreamLatencyStats stats_ ABSL_GUARDED_BY(mutex_);
+  // Ring buffer of the latest chunk latencies.
+  std::vector<absl::Duration> latencies_ ABSL_GUARDED_BY(mutex_);
+  int next_latency_index_ ABSL_GUARDED_BY(mutex_) = 0;
+
+  // Declared last so that the reading thread is joined before the members it
+  // uses are destroyed.
+  SingleThreadExecutor read_executor_;
+};
+
+}  // namespace connections
+}  // namespace nearby
+
+#endif  // CORE_INTERNAL_LOW_LATENCY_STREAM_READER_H_
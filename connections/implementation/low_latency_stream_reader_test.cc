@@ -0,0 +1,154 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "connections/implementation/low_latency_stream_reader.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "connections/low_latency_stream_options.h"
+#include "internal/platform/byte_array.h"
+#include "internal/platform/pipe.h"
+
+namespace nearby {
+namespace connections {
+namespace {
+
+constexpr absl::Duration kTimeout = absl::Seconds(1);
+
+LowLatencyStreamOptions MakeOptions(absl::Duration max_chunk_delay) {
+  LowLatencyStreamOptions options;
+  options.max_chunk_delay = max_chunk_delay;
+  options.read_size = 10;
+  options.max_queued_bytes = 20;
+  return options;
+}
+
+// Waits for the reading thread to drop `bytes` bytes.
+bool WaitForDroppedBytes(LowLatencyStreamReader& reader, int bytes) {
+  absl::Time deadline = absl::Now() + kTimeout;
+  while (reader.GetStats().bytes_dropped < bytes) {
+    if (absl::Now() > deadline) return false;
+    absl::SleepFor(absl::Milliseconds(1));
+  }
+  return true;
+}
+
+TEST(LowLatencyStreamReaderTest, SendsPartialChunkAfterDelay) {
+  auto [input, output] = CreatePipe();
+  LowLatencyStreamReader reader(*input, MakeOptions(absl::Milliseconds(20)));
+  output->Write(ByteArray("abcde"));
+
+  absl::Time start = absl::Now();
+  ByteArray chunk = reader.NextChunk(1024);
+
+  EXPECT_EQ(chunk, ByteArray("abcde"));
+  EXPECT_LT(absl::Now() - start, kTimeout);
+  input->Close();
+}
+
+TEST(LowLatencyStreamReaderTest, MergesReadsIntoFullChunk) {
+  auto [input, output] = CreatePipe();
+  LowLatencyStreamReader reader(*input, MakeOptions(absl::Hours(1)));
+  output->Write(ByteArray("0123456789"));
+  output->Write(ByteArray("abcdefghij"));
+
+  // A full chunk is sent without waiting for the delay; the remainder of the
+  // split read stays queued.
+  EXPECT_EQ(reader.NextChunk(15), ByteArray("0123456789abcde"));
+  output->Close();
+  EXPECT_EQ(reader.NextChunk(15), ByteArray("fghij"));
+  EXPECT_TRUE(reader.NextChunk(15).Empty());
+  input->Close();
+}
+
+TEST(LowLatencyStreamReaderTest, DropOldestKeepsFreshData) {
+  auto [input, output] = CreatePipe();
+  LowLatencyStreamOptions options = MakeOptions(absl::ZeroDuration());
+  options.overflow_policy =
+      LowLatencyStreamOptions::OverflowPolicy::kDropOldest;
+  LowLatencyStreamReader reader(*input, options);
+  output->Write(ByteArray("0000000000"));
+  output->Write(ByteArray("1111111111"));
+  output->Write(ByteArray("2222222222"));
+  output->Write(ByteArray("3333333333"));
+
+  ASSERT_TRUE(WaitForDroppedBytes(reader, 20));
+
+  EXPECT_EQ(reader.NextChunk(1024), ByteArray("22222222223333333333"));
+  input->Close();
+}
+
+TEST(LowLatencyStreamReaderTest, BlockKeepsAllData) {
+  auto [input, output] = CreatePipe();
+  LowLatencyStreamOptions options = MakeOptions(absl::ZeroDuration());
+  options.overflow_policy = LowLatencyStreamOptions::OverflowPolicy::kBlock;
+  LowLatencyStreamReader reader(*input, options);
+  std::string expected;
+  for (char c = '0'; c < '5'; ++c) {
+    output->Write(ByteArray(std::string(10, c)));
+    expected += std::string(10, c);
+  }
+  output->Close();
+
+  std::string received;
+  while (true) {
+    ByteArray chunk = reader.NextChunk(1024);
+    if (chunk.Empty()) break;
+    received += std::string(chunk);
+  }
+
+  EXPECT_EQ(received, expected);
+  EXPECT_EQ(reader.GetStats().bytes_dropped, 0);
+  input->Close();
+}
+
+TEST(LowLatencyStreamReaderTest, ReportsLatencyOfSentChunks) {
+  auto [input, output] = CreatePipe();
+  LowLatencyStreamReader reader(*input, MakeOptions(absl::ZeroDuration()));
+  output->Write(ByteArray("abc"));
+  ASSERT_FALSE(reader.NextChunk(1024).Empty());
+  absl::SleepFor(absl::Milliseconds(10));
+  reader.OnChunkSent();
+  // Not sent, so not counted.
+  output->Write(ByteArray("de"));
+  ASSERT_FALSE(reader.NextChunk(1024).Empty());
+
+  StreamLatencyStats stats = reader.GetStats();
+
+  EXPECT_EQ(stats.chunks_sent, 1);
+  EXPECT_EQ(stats.bytes_sent, 3);
+  EXPECT_GE(stats.p50_latency, absl::Milliseconds(10));
+  EXPECT_EQ(stats.p99_latency, stats.p50_latency);
+  EXPECT_EQ(stats.max_latency, stats.p50_latency);
+  input->Close();
+}
+
+TEST(LowLatencyStreamReaderTest, NoChunksAfterClose) {
+  auto [input, output] = CreatePipe();
+  LowLatencyStreamReader reader(*input, MakeOptions(absl::Hours(1)));
+  output->Write(ByteArray("abc"));
+
+  reader.Close();
+
+  EXPECT_TRUE(reader.NextChunk(1024).Empty());
+  input->Close();
+}
+
+}  // namespace
+}  // namespace connections
+}  // namespace nearby
@@ -638,6 +638,15 @@ ErrorOr<BleV2Socket> BleV2::Connect(const std::string& service_id,
   return socket;
 }
 
+BleV2Peripheral BleV2::GetRemotePeripheral(const std::string& mac_address) {
+  MutexLock lock(&mutex_);
+  if (!IsAvailableLocked()) {
+    LOG(INFO) << "Can't get remote Ble peripheral; Ble isn't available.";
+    return {};
+  }
+  return medium_.GetRemotePeripheral(mac_address);
+}
+
 bool BleV2::IsAvailableLocked() const { return medium_.IsValid(); }
 
 bool BleV2::IsAdvertisingLocked(const std::string& service_id) const {
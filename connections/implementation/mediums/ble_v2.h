@@ -144,6 +144,12 @@ class BleV2 final {
                                CancellationFlag* cancellation_flag)
       ABSL_LOCKS_EXCLUDED(mutex_);
 
+  // Returns the peripheral with the given MAC address, in canonical format,
+  // so that it can be connected to without scanning for it first. The
+  // returned peripheral is invalid if the platform cannot resolve the address.
+  BleV2Peripheral GetRemotePeripheral(const std::string& mac_address)
+      ABSL_LOCKS_EXCLUDED(mutex_);
+
   // Returns true if this object owns a valid platform implementation.
   bool IsMediumValid() const ABSL_LOCKS_EXCLUDED(mutex_) {
     MutexLock lock(&mutex_);
@@ -16,15 +16,19 @@
 
 #include <inttypes.h>
 
+#include <cstdint>
+#include <optional>
 #include <string>
 #include <utility>
 
-#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 #include "connections/implementation/flags/nearby_connections_feature_flags.h"
 #include "internal/flags/nearby_flags.h"
 #include "internal/platform/base64_utils.h"
-#include "internal/platform/base_input_stream.h"
 #include "internal/platform/byte_array.h"
+#include "internal/platform/byte_span_reader.h"
+#include "internal/platform/byte_span_writer.h"
 #include "internal/platform/logging.h"
 
 namespace nearby {
@@ -59,16 +63,17 @@ BleAdvertisementHeader::BleAdvertisementHeader(
     const ByteArray &ble_advertisement_header_bytes) {
   ByteArray advertisement_header_bytes =
       Base64Utils::Decode(ble_advertisement_header_bytes.AsStringView());
+  absl::string_view header_bytes = advertisement_header_bytes.AsStringView();
   if (advertisement_header_bytes.Empty()) {
     if (NearbyFlags::GetInstance().GetBoolFlag(
             config_package_nearby::nearby_connections_feature::kEnableBleV2)) {
       // The BLE advertisement header is not encoded in base64, but still try to
-      // parse it as raw bytes.
+      // parse it as raw bytes. Parse in place rather than copying the input.
       if (ble_advertisement_header_bytes.size() ==
               kMinAdvertisementHeaderLength ||
           ble_advertisement_header_bytes.size() ==
               kMinAdvertisementHeaderLength + 2) {
-        advertisement_header_bytes = ble_advertisement_header_bytes;
+        header_bytes = ble_advertisement_header_bytes.AsStringView();
       } else {
         NEARBY_VLOG(1) << "Cannot deserialize BLEAdvertisementHeader. "
                           "Invalid advertising data.";
@@ -81,18 +86,17 @@ BleAdvertisementHeader::BleAdvertisementHeader(
     }
   }
 
-  if (advertisement_header_bytes.size() < kMinAdvertisementHeaderLength) {
+  if (header_bytes.size() < kMinAdvertisementHeaderLength) {
     NEARBY_LOGS(ERROR)
         << "Cannot deserialize BleAdvertisementHeader: expecting min "
         << kMinAdvertisementHeaderLength << "raw bytes, got "
-        << advertisement_header_bytes.size();
+        << header_bytes.size();
     return;
   }
 
-  BaseInputStream base_input_stream(advertisement_header_bytes);
+  ByteSpanReader reader{header_bytes};
   // The first 1 byte is supposed to be the version and number of slots.
-  auto version_and_num_slots_byte =
-      static_cast<char>(base_input_stream.ReadUint8());
+  auto version_and_num_slots_byte = static_cast<char>(*reader.ReadUint8());
   // The upper 3 bits are supposed to be the version.
   version_ =
       static_cast<Version>((version_and_num_slots_byte & kVersionBitmask) >> 5);
@@ -113,16 +117,20 @@ BleAdvertisementHeader::BleAdvertisementHeader(
   }
 
   // The next 10 bytes are supposed to be the service_id_bloom_filter.
-  service_id_bloom_filter_ =
-      base_input_stream.ReadBytes(kServiceIdBloomFilterByteLength);
+  absl::string_view service_id_bloom_filter =
+      *reader.ReadBytes(kServiceIdBloomFilterByteLength);
+  service_id_bloom_filter_ = ByteArray(service_id_bloom_filter.data(),
+                                       service_id_bloom_filter.size());
 
   // The next 4 bytes are supposed to be the advertisement_hash.
+  absl::string_view advertisement_hash =
+      *reader.ReadBytes(kAdvertisementHashByteLength);
   advertisement_hash_ =
-      base_input_stream.ReadBytes(kAdvertisementHashByteLength);
+      ByteArray(advertisement_hash.data(), advertisement_hash.size());
 
   // The next 2 bytes are PSM value.
-  if (base_input_stream.IsAvailable(kPsmValueByteLength)) {
-    psm_ = static_cast<int>(base_input_stream.ReadUint16());
+  if (std::optional<uint16_t> psm = reader.ReadUint16(); psm.has_value()) {
+    psm_ = static_cast<int>(*psm);
   }
 }
 
@@ -142,18 +150,14 @@ BleAdvertisementHeader::operator ByteArray() const {
   version_and_num_slots_byte |=
       static_cast<char>(num_slots_) & kNumSlotsBitmask;
 
-  // Convert psm_ value to 2-bytes.
-  ByteArray psm_bytes{kPsmValueByteLength};
-  char *data = psm_bytes.data();
-  data[0] = psm_ & 0xFF00;
-  data[1] = psm_ & 0x00FF;
-
-  // clang-format off
-  std::string out = absl::StrCat(std::string(1, version_and_num_slots_byte),
-                                 std::string(service_id_bloom_filter_),
-                                 std::string(advertisement_hash_),
-                                 std::string(psm_bytes));
-  // clang-format on
+  std::string out(kMinAdvertisementHeaderLength + kPsmValueByteLength, '\0');
+  ByteSpanWriter writer{absl::MakeSpan(out)};
+  writer.WriteUint8(version_and_num_slots_byte);
+  writer.WriteBytes(service_id_bloom_filter_.AsStringView());
+  writer.WriteBytes(advertisement_hash_.AsStringView());
+  // The PSM is written big-endian, matching how it is read back.
+  writer.WriteUint16(static_cast<uint16_t>(psm_));
+
   if (NearbyFlags::GetInstance().GetBoolFlag(
           config_package_nearby::nearby_connections_feature::kEnableBleV2)) {
     return ByteArray(std::move(out));
@@ -15,11 +15,13 @@
 #include "connections/implementation/mediums/ble_v2/ble_packet.h"
 
 #include <limits>
-#include <string>
-#include <utility>
 
 #include "absl/strings/str_cat.h"
-#include "internal/platform/base_input_stream.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "internal/platform/byte_array.h"
+#include "internal/platform/byte_span_reader.h"
+#include "internal/platform/byte_span_writer.h"
 #include "internal/platform/logging.h"
 #include "proto/mediums/ble_frames.pb.h"
 
@@ -133,20 +135,20 @@ BlePacket::BlePacket(const ByteArray& ble_packet_bytes) {
     return;
   }
 
-  ByteArray packet_bytes(ble_packet_bytes);
-  BaseInputStream base_input_stream{packet_bytes};
+  ByteSpanReader reader{ble_packet_bytes.AsStringView()};
   // The first 3 bytes are supposed to be the service_id_hash.
-  service_id_hash_ = base_input_stream.ReadBytes(kServiceIdHashLength);
-  if (service_id_hash_ ==
-      ByteArray(kControlPacketServiceIdHash, kServiceIdHashLength)) {
+  absl::string_view service_id_hash = *reader.ReadBytes(kServiceIdHashLength);
+  if (service_id_hash ==
+      absl::string_view(kControlPacketServiceIdHash, kServiceIdHashLength)) {
     packet_type_ = BlePacketType::kControl;
   } else {
     packet_type_ = BlePacketType::kData;
   }
+  service_id_hash_ = ByteArray(service_id_hash.data(), service_id_hash.size());
 
   // The rest bytes are supposed to be the data.
-  data_ = base_input_stream.ReadBytes(ble_packet_bytes.size() -
-                                      kServiceIdHashLength);
+  absl::string_view data = reader.ReadRemaining();
+  data_ = ByteArray(data.data(), data.size());
 }
 
 BlePacket::operator ByteArray() const {
@@ -154,10 +156,11 @@ BlePacket::operator ByteArray() const {
     return ByteArray();
   }
 
-  std::string out =
-      absl::StrCat(std::string(service_id_hash_), std::string(data_));
-
-  return ByteArray(std::move(out));
+  ByteArray out(GetPacketSize());
+  ByteSpanWriter writer{absl::MakeSpan(out.data(), out.size())};
+  writer.WriteBytes(service_id_hash_.AsStringView());
+  writer.WriteBytes(data_.AsStringView());
+  return out;
 }
 
 bool BlePacket::IsValid() const {
@@ -17,14 +17,17 @@
 #include <cstdint>
 #include <list>
 #include <string>
+#include <utility>
 
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/escaping.h"
-#include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 #include "connections/implementation/mediums/ble_v2/ble_advertisement_header.h"
+#include "internal/platform/byte_span_reader.h"
+#include "internal/platform/byte_span_writer.h"
 #include "internal/platform/logging.h"
 
 namespace nearby {
@@ -76,7 +79,11 @@ std::string InstantOnLostAdvertisement::ToBytes() const {
 
   // 2. Hash counts.
   uint8_t count = static_cast<uint8_t>(hashes_.size() & kHashCountBitmask);
-  std::string result = absl::StrFormat("%c%c", header, count);
+  std::string result(
+      kMetadataLength + hashes_.size() * kAdvertisementHashLength, '\0');
+  ByteSpanWriter writer{absl::MakeSpan(result)};
+  writer.WriteUint8(header);
+  writer.WriteUint8(count);
   for (const auto& hash : hashes_) {
     if (hash.length() != kAdvertisementHashLength) {
       NEARBY_LOGS(ERROR) << __func__
@@ -85,7 +92,7 @@ std::string InstantOnLostAdvertisement::ToBytes() const {
                          << absl::BytesToHexString(hash);
       return "";
     }
-    absl::StrAppend(&result, hash);
+    writer.WriteBytes(hash);
   }
   return result;
 }
@@ -98,8 +105,9 @@ InstantOnLostAdvertisement::CreateFromBytes(absl::string_view bytes) {
         bytes.length()));
   }
 
+  ByteSpanReader reader{bytes};
   // 1. Parse header.
-  uint8_t header = bytes[0];
+  uint8_t header = *reader.ReadUint8();
   int type = (header & kTypeBitmask) >> 4;
   if (type != kAdvertisementType) {
     return absl::InvalidArgumentError(
@@ -114,19 +122,19 @@ InstantOnLostAdvertisement::CreateFromBytes(absl::string_view bytes) {
   }
 
   // 3. Parse hash counts.
-  uint8_t count = (bytes[1] & kHashCountBitmask);
-  if (count * kAdvertisementHashLength + 2 != bytes.length()) {
+  uint8_t count = (*reader.ReadUint8() & kHashCountBitmask);
+  if (count * kAdvertisementHashLength != reader.remaining()) {
     return absl::InvalidArgumentError(
         absl::StrFormat("Failed to parse due to incorrect count %d.", count));
   }
 
   // 4. Parse hashes.
   std::list<std::string> hashes;
-  for (int i = 2; i < bytes.length(); i += kAdvertisementHashLength) {
-    hashes.push_back(std::string(bytes.substr(i, kAdvertisementHashLength)));
+  for (int i = 0; i < count; ++i) {
+    hashes.emplace_back(*reader.ReadBytes(kAdvertisementHashLength));
   }
 
-  return InstantOnLostAdvertisement(hashes);
+  return InstantOnLostAdvertisement(std::move(hashes));
 }
 
 }  // namespace mediums
@@ -17,6 +17,7 @@
 
 #include <list>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "absl/status/statusor.h"
@@ -54,8 +55,8 @@ class InstantOnLostAdvertisement {
   std::list<std::string> hashes() const { return hashes_; }
 
  private:
-  explicit InstantOnLostAdvertisement(const std::list<std::string>& hashes)
-      : hashes_(hashes) {}
+  explicit InstantOnLostAdvertisement(std::list<std::string> hashes)
+      : hashes_(std::move(hashes)) {}
 
   std::list<std::string> hashes_;
 };
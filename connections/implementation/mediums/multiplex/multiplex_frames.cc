@@ -100,6 +100,8 @@ ByteArray ForConnectionResponse(
 
   auto* response_frame = control_frame->mutable_connection_response_frame();
   response_frame->set_connection_response_code(response_code);
+  // MultiplexSocket always buffers the data that arrives ahead of its answer.
+  response_frame->set_buffers_early_data(true);
 
   return ToBytes(std::move(frame));
 }
@@ -135,6 +135,8 @@ TEST(MultiplexFrameTest, CanGenerateConnectionRespons) {
                 .connection_response_frame()
                 .connection_response_code(),
             ConnectionResponseFrame::CONNECTION_ACCEPTED);
+  EXPECT_TRUE(
+      frame.control_frame().connection_response_frame().buffers_early_data());
 }
 
 TEST(MultiplexFrameTest, CanGenerateDisconnection) {
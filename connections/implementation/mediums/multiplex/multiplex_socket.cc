@@ -290,15 +290,22 @@ void MultiplexSocket::ListVirtualSocket() {
 }
 
 std::shared_ptr<Future<ConnectionResponseCode>>
-MultiplexSocket::RegisterConnectionResponse(const std::string& service_id) {
-  auto future = std::make_shared<Future<ConnectionResponseCode>>();
-  connection_response_futures_.emplace(service_id, future);
+MultiplexSocket::RegisterConnectionResponse(const std::string& service_id,
+                                            absl::Duration timeout) {
+  auto future = std::make_shared<Future<ConnectionResponseCode>>(timeout);
+  MutexLock lock(&connection_response_mutex_);
+  if (!connection_response_futures_.emplace(service_id, future).second) {
+    NEARBY_LOGS(WARNING) << "A virtual socket for service_id=" << service_id
+                         << " is already being requested.";
+    return nullptr;
+  }
 
   return future;
 }
 
 void MultiplexSocket::UnRegisterConnectionResponse(
     const std::string& service_id) {
+  MutexLock lock(&connection_response_mutex_);
   connection_response_futures_.erase(service_id);
 }
 
@@ -310,15 +317,33 @@ MediumSocket* MultiplexSocket::EstablishVirtualSocket(
     return nullptr;
   }
 
+  if (FeatureFlags::GetInstance()
+          .GetFlags()
+          .enable_multiplex_optimistic_virtual_socket) {
+    return EstablishVirtualSocketOptimistically(
+        service_id,
+        [](const std::string& service_id,
+           ConnectionResponseCode response_code) {});
+  }
+  return EstablishVirtualSocketAndWait(service_id);
+}
+
+MediumSocket* MultiplexSocket::EstablishVirtualSocketAndWait(
+    const std::string& service_id) {
   std::string service_id_hash_salt = Utils::GenerateSalt();
-  auto future = RegisterConnectionResponse(service_id);
+  absl::Duration timeout =
+      FeatureFlags::GetInstance()
+          .GetFlags()
+          .multiplex_socket_connection_response_timeout_millis;
+  auto future = RegisterConnectionResponse(service_id, timeout);
+  if (future == nullptr) {
+    return nullptr;
+  }
 
   multiplex_output_stream_.WriteConnectionRequestFrame(service_id,
                                                        service_id_hash_salt);
-  auto result =
-      future->Get(FeatureFlags::GetInstance()
-                      .GetFlags()
-                      .multiplex_socket_connection_response_timeout_millis);
+  auto result = future->Get(timeout);
+  UnRegisterConnectionResponse(service_id);
   if (!result.ok()) {
     NEARBY_LOGS(ERROR) << __func__
                        << "EstablishVirtualSocket failed with response code="
@@ -350,6 +375,106 @@ MediumSocket* MultiplexSocket::EstablishVirtualSocket(
   return nullptr;
 }
 
+MediumSocket* MultiplexSocket::EstablishVirtualSocketOptimistically(
+    const std::string& service_id,
+    MultiplexVirtualSocketRejectedCb rejected_cb) {
+  if (!IsEnabled()) {
+    NEARBY_LOGS(ERROR)
+        << "MultiplexSocket is disabled, cannot establish virtual socket.";
+    return nullptr;
+  }
+
+  // An older remote drops data frames for a virtual socket it hasn't
+  // accepted yet.
+  if (!remote_buffers_early_data_.Get()) {
+    NEARBY_LOGS(INFO) << "Remote doesn't buffer early data yet, wait for the "
+                         "CONNECTION_RESPONSE of service_id="
+                      << service_id;
+    return EstablishVirtualSocketAndWait(service_id);
+  }
+
+  std::string service_id_hash_salt = Utils::GenerateSalt();
+  auto future = RegisterConnectionResponse(
+      service_id, FeatureFlags::GetInstance()
+                      .GetFlags()
+                      .multiplex_socket_connection_response_timeout_millis);
+  if (future == nullptr) {
+    return nullptr;
+  }
+
+  if (!multiplex_output_stream_.WriteConnectionRequestFrame(
+          service_id, service_id_hash_salt)) {
+    NEARBY_LOGS(ERROR) << __func__
+                       << " Failed to write CONNECTION_REQUEST frame for "
+                          "service_id="
+                       << service_id;
+    UnRegisterConnectionResponse(service_id);
+    return nullptr;
+  }
+
+  // The request is already written to the physical socket, so any data frame
+  // written to the new virtual socket reaches the remote after it.
+  NEARBY_LOGS(INFO) << "EstablishVirtualSocketOptimistically with service_id="
+                    << service_id
+                    << ", service_id_hash_salt=" << service_id_hash_salt;
+  MediumSocket* virtual_socket =
+      CreateVirtualSocket(service_id, service_id_hash_salt);
+  future->AddListener(
+      [this, service_id, service_id_hash_salt,
+       rejected_cb = std::move(rejected_cb)](
+          ExceptionOr<ConnectionResponseCode> result) mutable {
+        OnOptimisticConnectionResponse(service_id, service_id_hash_salt,
+                                       std::move(result), rejected_cb);
+      },
+      &connection_response_executor_);
+  return virtual_socket;
+}
+
+void MultiplexSocket::OnOptimisticConnectionResponse(
+    const std::string& service_id, const std::string& service_id_hash_salt,
+    ExceptionOr<ConnectionResponseCode> result,
+    MultiplexVirtualSocketRejectedCb& rejected_cb) {
+  UnRegisterConnectionResponse(service_id);
+  if (is_shutdown_) {
+    return;
+  }
+
+  ConnectionResponseCode response_code =
+      result.ok() ? result.GetResult()
+                  : ConnectionResponseFrame::UNKNOWN_RESPONSE_CODE;
+  if (response_code == ConnectionResponseFrame::CONNECTION_ACCEPTED) {
+    NEARBY_LOGS(INFO) << "Remote accepted the optimistic virtual socket for "
+                         "service_id="
+                      << service_id
+                      << ", service_id_hash_salt=" << service_id_hash_salt;
+    return;
+  }
+
+  NEARBY_LOGS(ERROR) << "EstablishVirtualSocketOptimistically failed for "
+                        "service_id="
+                     << service_id
+                     << ", service_id_hash_salt=" << service_id_hash_salt
+                     << " with response code=" << response_code
+                     << ", exception=" << result.exception();
+  // Look up by the salted key so a re-established virtual socket is left
+  // alone, and keep it alive until Close() returns.
+  std::shared_ptr<MediumSocket> virtual_socket;
+  {
+    MutexLock lock(&virtual_socket_mutex_);
+    auto item = virtual_sockets_.find(
+        GenerateServiceIdHashKeyWithSalt(service_id, service_id_hash_salt));
+    if (item != virtual_sockets_.end()) {
+      virtual_socket = item->second;
+    }
+  }
+  if (virtual_socket != nullptr) {
+    virtual_socket->Close();
+  }
+  if (rejected_cb) {
+    rejected_cb(service_id, response_code);
+  }
+}
+
 void MultiplexSocket::StartReaderThread(std::int32_t first_frame_len) {
   if (is_shutdown_) {
     NEARBY_LOGS(WARNING) << "Stop to start reader thread since socket is "
@@ -466,12 +591,20 @@ void MultiplexSocket::HandleControlFrame(
     const std::string& service_id_hash_salt,
     const MultiplexControlFrame& frame) {
   switch (frame.control_frame_type()) {
-    case MultiplexControlFrame::CONNECTION_REQUEST:
+    case MultiplexControlFrame::CONNECTION_REQUEST: {
+      // The remote may send data frames for the requested virtual socket
+      // right after the request. Keep them until the request is answered.
+      {
+        MutexLock lock(&pending_virtual_socket_mutex_);
+        pending_virtual_sockets_.try_emplace(
+            GenerateServiceIdHashKey(salted_service_id_hash));
+      }
       RunOffloadThread("CONNECTION_REQUEST", [this, salted_service_id_hash,
                                               service_id_hash_salt] {
         HandleConnectionRequest(salted_service_id_hash, service_id_hash_salt);
       });
       break;
+    }
     case MultiplexControlFrame::CONNECTION_RESPONSE:
       NEARBY_LOGS(INFO)
           << __func__ << "Received an CONNECTION_RESPONSE frame."
@@ -502,15 +635,16 @@ void MultiplexSocket::HandleControlFrame(
 void MultiplexSocket::HandleConnectionRequest(
     const ByteArray& salted_service_id_hash,
     const std::string& service_id_hash_salt) {
+  std::string salted_service_id_hash_key =
+      GenerateServiceIdHashKey(salted_service_id_hash);
   if (!IsEnabled()) {
     NEARBY_LOGS(WARNING) << "Received a CONNECTION_REQUEST frame on medium "
                          << Medium_Name(medium_)
                          << " but status is disabled, ignore it.";
+    ErasePendingVirtualSocket(salted_service_id_hash_key);
     return;
   }
 
-  std::string salted_service_id_hash_key =
-      GenerateServiceIdHashKey(salted_service_id_hash);
   MultiplexIncomingConnectionCb* incoming_connection_callback = nullptr;
   std::string listening_service_id = "";
   for (auto& [service_id_medium_pair, callback] :
@@ -531,6 +665,7 @@ void MultiplexSocket::HandleConnectionRequest(
 
     NEARBY_LOGS(INFO) << "The size of incomingConnectionCallbacks : "
                       << GetIncomingConnectionCallbacks().size();
+    ErasePendingVirtualSocket(salted_service_id_hash_key);
     if (!multiplex_output_stream_.WriteConnectionResponseFrame(
             salted_service_id_hash, service_id_hash_salt,
             ConnectionResponseFrame::NOT_LISTENING)) {
@@ -544,10 +679,32 @@ void MultiplexSocket::HandleConnectionRequest(
                     << ", hash key : " << salted_service_id_hash_key
                     << " on medium " << Medium_Name(medium_);
 
+  bool overflowed = false;
+  {
+    MutexLock lock(&pending_virtual_socket_mutex_);
+    auto item = pending_virtual_sockets_.find(salted_service_id_hash_key);
+    if (item != pending_virtual_sockets_.end()) {
+      overflowed = item->second.overflowed;
+      item->second.accepted = !overflowed;
+    }
+  }
+  if (overflowed) {
+    NEARBY_LOGS(WARNING) << "Too much data buffered for hash key : "
+                         << salted_service_id_hash_key << ", reject it.";
+    ErasePendingVirtualSocket(salted_service_id_hash_key);
+    if (!multiplex_output_stream_.WriteConnectionResponseFrame(
+            salted_service_id_hash, service_id_hash_salt,
+            ConnectionResponseFrame::UNKNOWN_RESPONSE_CODE)) {
+      NEARBY_LOGS(INFO) << "Failed to write UNKNOWN_RESPONSE_CODE frame.";
+    }
+    return;
+  }
+
   if (!multiplex_output_stream_.WriteConnectionResponseFrame(
           salted_service_id_hash, service_id_hash_salt,
           ConnectionResponseFrame::CONNECTION_ACCEPTED)) {
     NEARBY_LOGS(INFO) << "Failed to write CONNECTION_ACCEPTED frame.";
+    ErasePendingVirtualSocket(salted_service_id_hash_key);
     return;
   }
 
@@ -557,6 +714,21 @@ void MultiplexSocket::HandleConnectionRequest(
       << listening_service_id << ", serviceIdHashSalt=" << service_id_hash_salt;
   MediumSocket* virtual_socket =
       CreateVirtualSocket(listening_service_id, service_id_hash_salt);
+  {
+    // Hold the lock while feeding so the reader thread can't deliver a newer
+    // data frame ahead of the buffered ones.
+    MutexLock lock(&pending_virtual_socket_mutex_);
+    auto item = pending_virtual_sockets_.find(salted_service_id_hash_key);
+    if (item != pending_virtual_sockets_.end()) {
+      NEARBY_LOGS(INFO) << "Feed " << item->second.data.size()
+                        << " buffered data frames to hash key : "
+                        << salted_service_id_hash_key;
+      for (ByteArray& data : item->second.data) {
+        virtual_socket->FeedIncomingData(std::move(data));
+      }
+      pending_virtual_sockets_.erase(item);
+    }
+  }
   (*incoming_connection_callback)(std::move(listening_service_id),
                                   virtual_socket);
 }
@@ -567,6 +739,10 @@ void MultiplexSocket::HandleConnectionResponse(
     const ConnectionResponseFrame& frame) {
   NEARBY_LOGS(INFO) << __func__ << "connection_response_code: "
                     << frame.connection_response_code();
+  if (frame.buffers_early_data()) {
+    remote_buffers_early_data_.Set(true);
+  }
+  MutexLock lock(&connection_response_mutex_);
   for (auto& [service_id, future] : connection_response_futures_) {
     if (GenerateServiceIdHashWithSalt(service_id, service_id_hash_salt) ==
         salted_service_id_hash) {
@@ -617,6 +793,9 @@ void MultiplexSocket::HandleDataFrame(const ByteArray& salted_service_id_hash,
       GenerateServiceIdHashKey(salted_service_id_hash);
   MediumSocket* virtual_socket = nullptr;
   if (service_id_hash_salt.empty()) {
+    if (BufferPendingData(salted_service_id_hash_key, frame)) {
+      return;
+    }
     {
       MutexLock lock(&virtual_socket_mutex_);
       auto item = virtual_sockets_.find(salted_service_id_hash_key);
@@ -643,6 +822,45 @@ void MultiplexSocket::HandleDataFrame(const ByteArray& salted_service_id_hash,
   }
 }
 
+bool MultiplexSocket::BufferPendingData(
+    const std::string& salted_service_id_hash_key,
+    const MultiplexDataFrame& frame) {
+  MutexLock lock(&pending_virtual_socket_mutex_);
+  auto item = pending_virtual_sockets_.find(salted_service_id_hash_key);
+  if (item == pending_virtual_sockets_.end()) {
+    return false;
+  }
+  PendingVirtualSocket& pending = item->second;
+  if (pending.overflowed) {
+    return true;
+  }
+  // Once accepted, the request is only waiting for the virtual socket to be
+  // created, so don't cap the buffer anymore.
+  if (!pending.accepted &&
+      pending.size + frame.data().size() >
+          FeatureFlags::GetInstance().GetFlags().connection_max_frame_length) {
+    NEARBY_LOGS(WARNING) << "Drop the data buffered for hash key "
+                         << salted_service_id_hash_key
+                         << " because it exceeds the max frame length.";
+    pending.overflowed = true;
+    pending.data.clear();
+    pending.size = 0;
+    return true;
+  }
+  NEARBY_VLOG(1) << "Buffer a DATA frame for pending salted service ID Hash "
+                    "Key "
+                 << salted_service_id_hash_key;
+  pending.size += frame.data().size();
+  pending.data.emplace_back(frame.data());
+  return true;
+}
+
+void MultiplexSocket::ErasePendingVirtualSocket(
+    const std::string& salted_service_id_hash_key) {
+  MutexLock lock(&pending_virtual_socket_mutex_);
+  pending_virtual_sockets_.erase(salted_service_id_hash_key);
+}
+
 void MultiplexSocket::OnPhysicalSocketClosed() {
   RunOffloadThread("Shutdown", [this]() { Shutdown(); });
 }
@@ -756,7 +974,14 @@ void MultiplexSocket::Shutdown() {
   }
 
   GetIncomingConnectionCallbacks().clear();
-  connection_response_futures_.clear();
+  {
+    MutexLock lock(&connection_response_mutex_);
+    connection_response_futures_.clear();
+  }
+  {
+    MutexLock lock(&pending_virtual_socket_mutex_);
+    pending_virtual_sockets_.clear();
+  }
 
   is_shutdown_ = true;
   enabled_.Set(false);
@@ -795,6 +1020,7 @@ void MultiplexSocket::ShutdownAll() {
       << "Shutdown single_thread_offloader_ and physical_reader_thread_";
   single_thread_offloader_.Shutdown();
   physical_reader_thread_.Shutdown();
+  connection_response_executor_.Shutdown();
   NEARBY_LOGS(INFO) << __func__ << " end";
 }
 
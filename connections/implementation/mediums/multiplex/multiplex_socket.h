@@ -15,18 +15,22 @@
 #ifndef CORE_INTERNAL_MEDIUMS_MULTIPLEX_MULTIPLEX_SOCKET_H_
 #define CORE_INTERNAL_MEDIUMS_MULTIPLEX_MULTIPLEX_SOCKET_H_
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/container/flat_hash_map.h"
 #include "absl/functional/any_invocable.h"
+#include "absl/time/time.h"
 #include "connections/implementation/mediums/multiplex/multiplex_output_stream.h"
 #include "connections/medium_selector.h"
 #include "internal/platform/atomic_boolean.h"
 #include "internal/platform/byte_array.h"
 #include "internal/platform/count_down_latch.h"
+#include "internal/platform/exception.h"
 #include "internal/platform/future.h"
 #include "internal/platform/input_stream.h"
 #include "internal/platform/logging.h"
@@ -44,6 +48,10 @@ namespace multiplex {
 using MultiplexEnbaleCb = absl::AnyInvocable<void()>;
 using MultiplexIncomingConnectionCb = absl::AnyInvocable<void(
     const std::string& service_id, MediumSocket* socket)>;
+using MultiplexVirtualSocketRejectedCb = absl::AnyInvocable<void(
+    const std::string& service_id,
+    ::location::nearby::mediums::ConnectionResponseFrame::ConnectionResponseCode
+        response_code)>;
 
 class MultiplexSocket {
  public:
@@ -105,6 +113,18 @@ class MultiplexSocket {
 
   // Establishes the virtual socket by service id.
   MediumSocket* EstablishVirtualSocket(const std::string& service_id);
+  // Establishes the virtual socket by service id without waiting for the
+  // CONNECTION_RESPONSE frame. The returned socket can be written to right
+  // away; the remote buffers the data frames until it accepts the request.
+  // If the remote rejects the request or doesn't answer in time, the virtual
+  // socket is closed and `rejected_cb` is called with the response code.
+  // Until a CONNECTION_RESPONSE has shown that the remote buffers such data,
+  // this waits for the response like EstablishVirtualSocket() instead, and
+  // returns null if the request fails.
+  // Returns null if a request for the service id is already in flight.
+  MediumSocket* EstablishVirtualSocketOptimistically(
+      const std::string& service_id,
+      MultiplexVirtualSocketRejectedCb rejected_cb);
   // Shuts down the multiplex socket.
   void Shutdown();
   bool IsShutdown() { return is_shutdown_; }
@@ -121,10 +141,14 @@ class MultiplexSocket {
   // Creates the virtual socket for the service id.
   MediumSocket* CreateVirtualSocket(const std::string& service_id,
                                     const std::string& service_id_hash_salt);
-  // Registers the connection response future for the service id.
+  // Establishes the virtual socket by service id once the remote accepts it.
+  MediumSocket* EstablishVirtualSocketAndWait(const std::string& service_id);
+  // Registers the connection response future for the service id. Returns null
+  // if one is already registered, i.e. a request is in flight.
   std::shared_ptr<Future<::location::nearby::mediums::ConnectionResponseFrame::
                              ConnectionResponseCode>>
-  RegisterConnectionResponse(const std::string& service_id);
+  RegisterConnectionResponse(const std::string& service_id,
+                             absl::Duration timeout);
   // Unregisters the connection response future for the service id.
   void UnRegisterConnectionResponse(const std::string& service_id);
   // Starts the reader thread to read the incoming MultiplexFrame from the
@@ -152,6 +176,22 @@ class MultiplexSocket {
       const ByteArray& salted_service_id_hash,
       const std::string& service_id_hash_salt,
       const ::location::nearby::mediums::MultiplexDataFrame& frame);
+  // Buffers the data frame if it belongs to a virtual socket whose
+  // CONNECTION_REQUEST is still being handled. Returns false if there is no
+  // such pending virtual socket.
+  bool BufferPendingData(const std::string& salted_service_id_hash_key,
+                         const ::location::nearby::mediums::MultiplexDataFrame&
+                             frame);
+  // Discards the data frames buffered for the pending virtual socket.
+  void ErasePendingVirtualSocket(const std::string& salted_service_id_hash_key);
+  // Handles the CONNECTION_RESPONSE of an optimistically established virtual
+  // socket.
+  void OnOptimisticConnectionResponse(
+      const std::string& service_id, const std::string& service_id_hash_salt,
+      ExceptionOr<::location::nearby::mediums::ConnectionResponseFrame::
+                      ConnectionResponseCode>
+          result,
+      MultiplexVirtualSocketRejectedCb& rejected_cb);
   // Handles the physical socket closed.
   void OnPhysicalSocketClosed();
   // Remaps and gets the virtual socket by service id hash.
@@ -181,11 +221,17 @@ class MultiplexSocket {
 
   // A map of service Id -> {@link SettableFuture} for waiting the
   // ConnectionResponse. Non-empty while requesting the virtual socket.
+  Mutex connection_response_mutex_;
   absl::flat_hash_map<std::string,
                       std::shared_ptr<Future<
                           ::location::nearby::mediums::ConnectionResponseFrame::
                               ConnectionResponseCode>>>
-      connection_response_futures_;
+      connection_response_futures_
+          ABSL_GUARDED_BY(connection_response_mutex_);
+  // Whether the remote has answered a CONNECTION_REQUEST with
+  // `buffers_early_data`, so that virtual sockets can be established
+  // optimistically.
+  AtomicBoolean remote_buffers_early_data_{false};
 
   // A map of service Id hash key -> virtual socket. Non-empty while at least
   // one virtual socket alive. Class derived from "MediumSocket" should define a
@@ -197,10 +243,27 @@ class MultiplexSocket {
       // virtual_sockets_ ABSL_GUARDED_BY(virtual_socket_mutex_);
       virtual_sockets_;
 
+  // The data frames received for a requested virtual socket before it is
+  // accepted locally.
+  struct PendingVirtualSocket {
+    std::vector<ByteArray> data;
+    std::size_t size = 0;
+    bool accepted = false;
+    bool overflowed = false;
+  };
+  // A map of salted service Id hash key -> PendingVirtualSocket. Non-empty
+  // between receiving a CONNECTION_REQUEST frame and answering it.
+  Mutex pending_virtual_socket_mutex_;
+  absl::flat_hash_map<std::string, PendingVirtualSocket>
+      pending_virtual_sockets_;
+
   // The thread to receive incoming MultiplexFrame from the physical socket.
   SingleThreadExecutor physical_reader_thread_;
   // The single thread we throw the potentially blocking work on to.
   SingleThreadExecutor single_thread_offloader_;
+  // The thread to handle the CONNECTION_RESPONSE of the optimistically
+  // established virtual sockets.
+  SingleThreadExecutor connection_response_executor_;
 
   // The status of the MultiplexSocket enabled or disabled, it depends on both
   // Sender and Receiver supports MultiplexSocket or not. Default disabled and
@@ -49,6 +49,7 @@ namespace multiplex {
 
 constexpr absl::string_view SERVICE_ID_1 = "serviceId_1";
 constexpr absl::string_view SERVICE_ID_2 = "serviceId_2";
+constexpr absl::string_view SERVICE_ID_3 = "serviceId_3";
 
 using location::nearby::mediums::MultiplexFrame;
 using location::nearby::mediums::MultiplexControlFrame;
@@ -79,7 +80,9 @@ class FakeSocket : public MediumSocket {
    * OutputStream} and {@link InputStream}.
    */
   explicit FakeSocket(Medium medium, OutputStream* virtualOutputStream)
-      : MediumSocket(medium), is_virtual_socket_(true) {
+      : MediumSocket(medium),
+        is_virtual_socket_(true),
+        virtual_output_stream_(virtualOutputStream) {
     pipe_1_ = CreatePipe();
     reader_1_ = std::move(pipe_1_.first);
     writer_1_ = std::move(pipe_1_.second);
@@ -89,7 +92,12 @@ class FakeSocket : public MediumSocket {
   }
 
   InputStream& GetInputStream() override { return *reader_1_; }
-  OutputStream& GetOutputStream() override { return *writer_2_; }
+  OutputStream& GetOutputStream() override {
+    if (virtual_output_stream_ != nullptr) {
+      return *virtual_output_stream_;
+    }
+    return *writer_2_;
+  }
   Exception Close() override {
     if (IsVirtualSocket()) {
       NEARBY_LOGS(INFO) << "Multiplex: Closing virtual socket: " << this;
@@ -149,11 +157,25 @@ class FakeSocket : public MediumSocket {
 
  private:
   bool is_virtual_socket_ = false;
+  OutputStream* virtual_output_stream_ = nullptr;
   Future<ByteArray> bytes_read_future_;
   absl::flat_hash_map<std::string, std::shared_ptr<MediumSocket>>*
       virtual_sockets_ptr_ = nullptr;
 };
 
+// Reads one length-prefixed MultiplexFrame written to the physical socket.
+ExceptionOr<MultiplexFrame> ReadMultiplexFrame(InputStream* reader) {
+  ExceptionOr<std::int32_t> read_int = Base64Utils::ReadInt(reader);
+  if (!read_int.ok()) {
+    return ExceptionOr<MultiplexFrame>(read_int.exception());
+  }
+  ExceptionOr<ByteArray> bytes = reader->ReadExactly(read_int.result());
+  if (!bytes.ok()) {
+    return ExceptionOr<MultiplexFrame>(bytes.exception());
+  }
+  return multiplex::FromBytes(bytes.result());
+}
+
 TEST(MultiplexSocketTest, CreateSuccessAndReaderThreadStarted) {
   auto fake_socket_ptr =
       std::make_shared<FakeSocket>(Medium::BLUETOOTH);
@@ -294,6 +316,53 @@ TEST(MultiplexSocketTest,
   EXPECT_EQ(multiplex_socket->GetVirtualSocketCount(), 0);
 }
 
+// Reads the next CONNECTION_REQUEST written to |socket| and answers it with
+// |response_code|, as a remote that buffers early data or, if not
+// |buffers_early_data|, as an older one.
+void AnswerConnectionRequest(
+    FakeSocket& socket,
+    ConnectionResponseFrame::ConnectionResponseCode response_code,
+    bool buffers_early_data = true) {
+  ExceptionOr<MultiplexFrame> request =
+      ReadMultiplexFrame(socket.reader_2_.get());
+  ASSERT_TRUE(request.ok());
+  ASSERT_EQ(request.result().control_frame().control_frame_type(),
+            MultiplexControlFrame::CONNECTION_REQUEST);
+  ExceptionOr<MultiplexFrame> response = multiplex::FromBytes(
+      ForConnectionResponse(
+          ByteArray(request.result().header().salted_service_id_hash()),
+          request.result().header().service_id_hash_salt(), response_code));
+  ASSERT_TRUE(response.ok());
+  MultiplexFrame response_frame = response.result();
+  if (!buffers_early_data) {
+    response_frame.mutable_control_frame()
+        ->mutable_connection_response_frame()
+        ->clear_buffers_early_data();
+  }
+  ByteArray bytes(response_frame.SerializeAsString());
+  socket.writer_1_->Write(Base64Utils::IntToBytes(bytes.size()));
+  socket.writer_1_->Write(bytes);
+  socket.writer_1_->Flush();
+}
+
+// Establishes a virtual socket for |service_id| that the remote accepts, so
+// that |multiplex_socket| learns whether the remote buffers early data.
+void EstablishAcceptedVirtualSocket(MultiplexSocket* multiplex_socket,
+                                    FakeSocket& socket,
+                                    absl::string_view service_id,
+                                    bool buffers_early_data) {
+  CountDownLatch established_latch(1);
+  SingleThreadExecutor executor;
+  executor.Execute([&]() {
+    EXPECT_NE(multiplex_socket->EstablishVirtualSocket(std::string(service_id)),
+              nullptr);
+    established_latch.CountDown();
+  });
+  AnswerConnectionRequest(socket, ConnectionResponseFrame::CONNECTION_ACCEPTED,
+                          buffers_early_data);
+  EXPECT_TRUE(established_latch.Await(absl::Milliseconds(1000)).result());
+}
+
 TEST(MultiplexSocketTest,
      EstablishVirtualSocket_RemoteAccepted) {
   auto fake_socket_ptr = std::make_shared<FakeSocket>(Medium::BLUETOOTH);
@@ -377,6 +446,259 @@ TEST(MultiplexSocketTest,
   EXPECT_EQ(multiplex_socket->GetVirtualSocketCount(), 0);
 }
 
+TEST(MultiplexSocketTest,
+     EstablishVirtualSocketOptimistically_SendDataBeforeRemoteRejected) {
+  auto fake_socket_ptr = std::make_shared<FakeSocket>(Medium::WIFI_LAN);
+  MultiplexSocket::StopListeningForIncomingConnection(std::string(SERVICE_ID_1),
+                                                      Medium::WIFI_LAN);
+  MultiplexSocket::StopListeningForIncomingConnection(std::string(SERVICE_ID_2),
+                                                      Medium::WIFI_LAN);
+  MultiplexSocket* multiplex_socket = MultiplexSocket::CreateOutgoingSocket(
+      fake_socket_ptr, std::string(SERVICE_ID_1));
+  ASSERT_NE(multiplex_socket, nullptr);
+  multiplex_socket->Enable();
+  EstablishAcceptedVirtualSocket(multiplex_socket, *fake_socket_ptr,
+                                 SERVICE_ID_2, /*buffers_early_data=*/true);
+
+  CountDownLatch rejected_latch(1);
+  ConnectionResponseFrame::ConnectionResponseCode rejected_code =
+      ConnectionResponseFrame::CONNECTION_ACCEPTED;
+  MediumSocket* socket = multiplex_socket->EstablishVirtualSocketOptimistically(
+      std::string(SERVICE_ID_3),
+      [&rejected_latch, &rejected_code](
+          const std::string& service_id,
+          ConnectionResponseFrame::ConnectionResponseCode response_code) {
+        rejected_code = response_code;
+        rejected_latch.CountDown();
+      });
+  // The socket is usable before the remote answers the request.
+  ASSERT_NE(socket, nullptr);
+  EXPECT_TRUE(socket->GetOutputStream().Write(ByteArray("hello")).Ok());
+
+  auto reader = fake_socket_ptr->reader_2_.get();
+  ExceptionOr<MultiplexFrame> request = ReadMultiplexFrame(reader);
+  ASSERT_TRUE(request.ok());
+  ASSERT_EQ(request.result().frame_type(), MultiplexFrame::CONTROL_FRAME);
+  ASSERT_EQ(request.result().control_frame().control_frame_type(),
+            MultiplexControlFrame::CONNECTION_REQUEST);
+  ExceptionOr<MultiplexFrame> data = ReadMultiplexFrame(reader);
+  ASSERT_TRUE(data.ok());
+  ASSERT_EQ(data.result().frame_type(), MultiplexFrame::DATA_FRAME);
+  EXPECT_EQ(data.result().data_frame().data(), "hello");
+
+  ByteArray connection_response_frame = ForConnectionResponse(
+      ByteArray(request.result().header().salted_service_id_hash()),
+      request.result().header().service_id_hash_salt(),
+      ConnectionResponseFrame::NOT_LISTENING);
+  auto& writer = fake_socket_ptr->writer_1_;
+  writer->Write(Base64Utils::IntToBytes(connection_response_frame.size()));
+  writer->Write(connection_response_frame);
+  writer->Flush();
+
+  ASSERT_TRUE(rejected_latch.Await(absl::Milliseconds(1000)).result());
+  EXPECT_EQ(rejected_code, ConnectionResponseFrame::NOT_LISTENING);
+  EXPECT_EQ(multiplex_socket->GetVirtualSocket(std::string(SERVICE_ID_3)),
+            nullptr);
+
+  fake_socket_ptr->reader_1_->Close();
+  multiplex_socket->ShutdownAll();
+  EXPECT_EQ(multiplex_socket->GetVirtualSocketCount(), 0);
+}
+
+TEST(MultiplexSocketTest,
+     EstablishVirtualSocketOptimistically_WaitsForOlderRemote) {
+  auto fake_socket_ptr = std::make_shared<FakeSocket>(Medium::WIFI_LAN);
+  MultiplexSocket::StopListeningForIncomingConnection(std::string(SERVICE_ID_1),
+                                                      Medium::WIFI_LAN);
+  MultiplexSocket* multiplex_socket = MultiplexSocket::CreateOutgoingSocket(
+      fake_socket_ptr, std::string(SERVICE_ID_1));
+  ASSERT_NE(multiplex_socket, nullptr);
+  multiplex_socket->Enable();
+  EstablishAcceptedVirtualSocket(multiplex_socket, *fake_socket_ptr,
+                                 SERVICE_ID_2, /*buffers_early_data=*/false);
+
+  // The remote would drop data sent ahead of its answer.
+  CountDownLatch established_latch(1);
+  SingleThreadExecutor executor;
+  executor.Execute([&]() {
+    EXPECT_NE(multiplex_socket->EstablishVirtualSocketOptimistically(
+                  std::string(SERVICE_ID_3),
+                  [](const std::string& service_id,
+                     ConnectionResponseFrame::ConnectionResponseCode
+                         response_code) {}),
+              nullptr);
+    established_latch.CountDown();
+  });
+  EXPECT_FALSE(established_latch.Await(absl::Milliseconds(200)).result());
+  AnswerConnectionRequest(*fake_socket_ptr,
+                          ConnectionResponseFrame::CONNECTION_ACCEPTED,
+                          /*buffers_early_data=*/false);
+  EXPECT_TRUE(established_latch.Await(absl::Milliseconds(1000)).result());
+
+  fake_socket_ptr->reader_1_->Close();
+  multiplex_socket->ShutdownAll();
+  EXPECT_EQ(multiplex_socket->GetVirtualSocketCount(), 0);
+}
+
+TEST(MultiplexSocketTest, EstablishVirtualSocket_RejectsDuplicateRequest) {
+  auto fake_socket_ptr = std::make_shared<FakeSocket>(Medium::BLUETOOTH);
+  MultiplexSocket::StopListeningForIncomingConnection(std::string(SERVICE_ID_1),
+                                                      Medium::BLUETOOTH);
+  MultiplexSocket* multiplex_socket = MultiplexSocket::CreateOutgoingSocket(
+      fake_socket_ptr, std::string(SERVICE_ID_1));
+  ASSERT_NE(multiplex_socket, nullptr);
+  multiplex_socket->Enable();
+
+  CountDownLatch established_latch(1);
+  SingleThreadExecutor executor;
+  executor.Execute([&]() {
+    EXPECT_NE(multiplex_socket->EstablishVirtualSocket(
+                  std::string(SERVICE_ID_2)),
+              nullptr);
+    established_latch.CountDown();
+  });
+  ExceptionOr<MultiplexFrame> request =
+      ReadMultiplexFrame(fake_socket_ptr->reader_2_.get());
+  ASSERT_TRUE(request.ok());
+
+  // The first request is still waiting for its answer.
+  EXPECT_EQ(multiplex_socket->EstablishVirtualSocket(std::string(SERVICE_ID_2)),
+            nullptr);
+
+  ByteArray connection_response_frame = ForConnectionResponse(
+      ByteArray(request.result().header().salted_service_id_hash()),
+      request.result().header().service_id_hash_salt(),
+      ConnectionResponseFrame::CONNECTION_ACCEPTED);
+  auto& writer = fake_socket_ptr->writer_1_;
+  writer->Write(Base64Utils::IntToBytes(connection_response_frame.size()));
+  writer->Write(connection_response_frame);
+  writer->Flush();
+  EXPECT_TRUE(established_latch.Await(absl::Milliseconds(1000)).result());
+
+  fake_socket_ptr->reader_1_->Close();
+  multiplex_socket->ShutdownAll();
+  EXPECT_EQ(multiplex_socket->GetVirtualSocketCount(), 0);
+}
+
+// Measures the time to first byte of a service added to a shared physical
+// socket, while the remote takes |kResponseDelay| to answer each request.
+TEST(MultiplexSocketTest, EstablishVirtualSocket_TimeToFirstByte) {
+  constexpr absl::Duration kResponseDelay = absl::Milliseconds(300);
+  auto fake_socket_ptr = std::make_shared<FakeSocket>(Medium::BLUETOOTH);
+  MultiplexSocket::StopListeningForIncomingConnection(std::string(SERVICE_ID_1),
+                                                      Medium::BLUETOOTH);
+  MultiplexSocket* multiplex_socket = MultiplexSocket::CreateOutgoingSocket(
+      fake_socket_ptr, std::string(SERVICE_ID_1));
+  ASSERT_NE(multiplex_socket, nullptr);
+  multiplex_socket->Enable();
+  auto reader = fake_socket_ptr->reader_2_.get();
+
+  // Returns how long it took for a byte written to a new virtual socket for
+  // |service_id| to reach the wire.
+  auto time_to_first_byte = [&](absl::string_view service_id) {
+    absl::Time start = absl::Now();
+    SingleThreadExecutor executor;
+    executor.Execute([&]() {
+      MediumSocket* socket =
+          multiplex_socket->EstablishVirtualSocketOptimistically(
+              std::string(service_id),
+              [](const std::string& service_id,
+                 ConnectionResponseFrame::ConnectionResponseCode
+                     response_code) {});
+      ASSERT_NE(socket, nullptr);
+      socket->GetOutputStream().Write(ByteArray("x"));
+    });
+    ExceptionOr<MultiplexFrame> request = ReadMultiplexFrame(reader);
+    EXPECT_TRUE(request.ok());
+    // Answer late, unless the data shows up first.
+    SingleThreadExecutor responder;
+    responder.Execute([&]() {
+      absl::SleepFor(kResponseDelay);
+      ByteArray connection_response_frame = ForConnectionResponse(
+          ByteArray(request.result().header().salted_service_id_hash()),
+          request.result().header().service_id_hash_salt(),
+          ConnectionResponseFrame::CONNECTION_ACCEPTED);
+      auto& writer = fake_socket_ptr->writer_1_;
+      writer->Write(Base64Utils::IntToBytes(connection_response_frame.size()));
+      writer->Write(connection_response_frame);
+      writer->Flush();
+    });
+    ExceptionOr<MultiplexFrame> data = ReadMultiplexFrame(reader);
+    absl::Duration ttfb = absl::Now() - start;
+    EXPECT_TRUE(data.ok());
+    EXPECT_EQ(data.result().frame_type(), MultiplexFrame::DATA_FRAME);
+    return ttfb;
+  };
+
+  // The first request shows that the remote buffers early data; later ones
+  // don't wait for the answer.
+  absl::Duration second_service_ttfb = time_to_first_byte(SERVICE_ID_2);
+  absl::Duration third_service_ttfb = time_to_first_byte(SERVICE_ID_3);
+  NEARBY_LOGS(INFO) << "Time to first byte: second service="
+                    << second_service_ttfb
+                    << ", third service=" << third_service_ttfb;
+  EXPECT_GE(second_service_ttfb, kResponseDelay);
+  EXPECT_LT(third_service_ttfb, kResponseDelay);
+
+  fake_socket_ptr->reader_1_->Close();
+  multiplex_socket->ShutdownAll();
+  EXPECT_EQ(multiplex_socket->GetVirtualSocketCount(), 0);
+}
+
+TEST(MultiplexSocketTest,
+     HandleConnectionRequest_FeedDataReceivedBeforeAccept) {
+  auto fake_socket_ptr = std::make_shared<FakeSocket>(Medium::BLE);
+  MultiplexSocket::StopListeningForIncomingConnection(std::string(SERVICE_ID_1),
+                                                      Medium::BLE);
+  CountDownLatch accepted_latch(1);
+  FakeSocket* accepted_socket = nullptr;
+  MultiplexSocket::ListenForIncomingConnection(
+      std::string(SERVICE_ID_2), Medium::BLE,
+      [&accepted_latch, &accepted_socket](const std::string& service_id,
+                                          MediumSocket* socket) {
+        accepted_socket = (FakeSocket*)socket;
+        accepted_latch.CountDown();
+      });
+  MultiplexSocket* multiplex_socket = MultiplexSocket::CreateIncomingSocket(
+      fake_socket_ptr, std::string(SERVICE_ID_1), /*first_frame_len*/ 0);
+  ASSERT_NE(multiplex_socket, nullptr);
+  multiplex_socket->Enable();
+
+  // The data frame follows the request without waiting for the response.
+  const std::string salt = "salt";
+  ByteArray request_frame =
+      ForConnectionRequest(std::string(SERVICE_ID_2), salt);
+  ByteArray data_frame =
+      ForData(std::string(SERVICE_ID_2), salt, /*should_pass_salt=*/false,
+              ByteArray("hello"));
+  auto& writer = fake_socket_ptr->writer_1_;
+  writer->Write(Base64Utils::IntToBytes(request_frame.size()));
+  writer->Write(request_frame);
+  writer->Write(Base64Utils::IntToBytes(data_frame.size()));
+  writer->Write(data_frame);
+  writer->Flush();
+
+  ASSERT_TRUE(accepted_latch.Await(absl::Milliseconds(1000)).result());
+  ASSERT_NE(accepted_socket, nullptr);
+  ExceptionOr<ByteArray> result =
+      accepted_socket->GetByteReadFuture().Get(absl::Milliseconds(1000));
+  ASSERT_TRUE(result.ok());
+  EXPECT_EQ(std::string(result.result()), "hello");
+
+  ExceptionOr<MultiplexFrame> response =
+      ReadMultiplexFrame(fake_socket_ptr->reader_2_.get());
+  ASSERT_TRUE(response.ok());
+  EXPECT_EQ(response.result()
+                .control_frame()
+                .connection_response_frame()
+                .connection_response_code(),
+            ConnectionResponseFrame::CONNECTION_ACCEPTED);
+
+  fake_socket_ptr->reader_1_->Close();
+  multiplex_socket->ShutdownAll();
+  EXPECT_EQ(multiplex_socket->GetVirtualSocketCount(), 0);
+}
+
 }  // namespace multiplex
 }  // namespace mediums
 }  // namespace connections
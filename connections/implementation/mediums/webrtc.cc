@@ -22,6 +22,7 @@
 #include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/container/flat_hash_set.h"
 #include "absl/functional/bind_front.h"
 #include "absl/time/time.h"
@@ -58,6 +59,10 @@ constexpr absl::Duration kDataChannelTimeout = absl::Seconds(10);
 // Delay between restarting signaling messenger to receive messages.
 constexpr absl::Duration kRestartReceiveMessagesDuration = absl::Seconds(60);
 
+// How long to wait for more local ICE candidates before sending them. Host
+// candidates are usually gathered within a few milliseconds of each other.
+constexpr absl::Duration kIceCandidateBatchDelay = absl::Milliseconds(5);
+
 }  // namespace
 
 WebRtc::WebRtc() : WebRtc(std::make_unique<WebRtcMedium>()) {}
@@ -69,6 +74,7 @@ WebRtc::~WebRtc() {
   // This ensures that all pending callbacks are run before we reset the medium
   // and we are not accepting new runnables.
   single_thread_executor_.Shutdown();
+  signaling_executor_.Shutdown();
 
   // Stop accepting all connections
   absl::flat_hash_set<std::string> service_ids;
@@ -167,8 +173,15 @@ void WebRtc::StopAcceptingConnections(const std::string& service_id) {
   // Grab our info from the map.
   auto& info = accepting_connections_info_.find(service_id)->second;
 
-  // Stop receiving messages from Tachyon.
+  // Stop receiving messages from Tachyon, and don't send the ICE candidates
+  // that are still queued for our peers.
   info.signaling_messenger->StopReceivingMessages();
+  {
+    MutexLock ice_candidates_lock(&ice_candidates_mutex_);
+    absl::erase_if(pending_ice_candidates_, [&info](const auto& item) {
+      return item.second.signaling_messenger == info.signaling_messenger;
+    });
+  }
   info.signaling_messenger.reset();
 
   // Cancel the scheduled alarm.
@@ -375,47 +388,84 @@ void WebRtc::ProcessLocalIceCandidate(
   MutexLock lock(&mutex_);
 
   // Check first if we have an outgoing request w/ this peer. As this request is
-  // tied to a specific peer, it takes precedence.
+  // tied to a specific peer, it takes precedence. Otherwise, check if we're
+  // expecting incoming connection requests.
+  std::shared_ptr<WebRtcSignalingMessenger> signaling_messenger;
+  WebrtcPeerId self_peer_id;
   const auto& connection_request_entry =
       requesting_connections_info_.find(remote_peer_id.GetId());
+  const auto& accepting_connection_entry =
+      accepting_connections_info_.find(service_id);
   if (connection_request_entry != requesting_connections_info_.end()) {
-    // Pass the ice candidate to the remote side.
-    if (!connection_request_entry->second.signaling_messenger->SendMessage(
-            remote_peer_id.GetId(),
-            webrtc_frames::EncodeIceCandidates(
-                connection_request_entry->second.self_peer_id,
-                {ice_candidate}))) {
-      NEARBY_LOGS(INFO) << "Failed to send ice candidate to "
-                        << remote_peer_id.GetId();
-    }
-
-    NEARBY_LOGS(INFO) << "Sent ice candidate to " << remote_peer_id.GetId();
+    signaling_messenger = connection_request_entry->second.signaling_messenger;
+    self_peer_id = connection_request_entry->second.self_peer_id;
+  } else if (accepting_connection_entry != accepting_connections_info_.end()) {
+    signaling_messenger =
+        accepting_connection_entry->second.signaling_messenger;
+    self_peer_id = accepting_connection_entry->second.self_peer_id;
+  } else {
+    NEARBY_LOGS(INFO) << "Skipping ice candidate for " << remote_peer_id.GetId()
+                      << " since we are not accepting connections for service "
+                      << service_id;
+    return;
+  }
+  if (!signaling_messenger) {
+    NEARBY_LOGS(INFO) << "Skipping ice candidate for " << remote_peer_id.GetId()
+                      << " since we are no longer signaling with it.";
     return;
   }
 
-  // Check next if we're expecting incoming connection requests.
-  const auto& accepting_connection_entry =
-      accepting_connections_info_.find(service_id);
-  if (accepting_connection_entry != accepting_connections_info_.end()) {
-    // Pass the ice candidate to the remote side.
-    // TODO(xlythe) Consider not blocking here, since this can eat into the
-    // connection time
-    if (!accepting_connection_entry->second.signaling_messenger->SendMessage(
-            remote_peer_id.GetId(),
-            webrtc_frames::EncodeIceCandidates(
-                accepting_connection_entry->second.self_peer_id,
-                {ice_candidate}))) {
-      NEARBY_LOGS(INFO) << "Failed to send ice candidate to "
-                        << remote_peer_id.GetId();
+  // Pass the ice candidate to the remote side. Candidates are queued and sent
+  // off this thread, so that gathering isn't held up by Tachyon.
+  MutexLock ice_candidates_lock(&ice_candidates_mutex_);
+  auto [entry, inserted] =
+      pending_ice_candidates_.try_emplace(remote_peer_id.GetId());
+  PendingIceCandidates& pending = entry->second;
+  if (!inserted && pending.signaling_messenger != signaling_messenger) {
+    // Left over from an earlier attempt with this peer.
+    pending.ice_candidates.clear();
+  }
+  pending.signaling_messenger = std::move(signaling_messenger);
+  pending.self_peer_id = self_peer_id;
+  pending.ice_candidates.push_back(ice_candidate);
+  if (pending.ice_candidates.size() == 1) {
+    signaling_executor_.Schedule(
+        [this, remote_peer_id]() { SendPendingIceCandidates(remote_peer_id); },
+        kIceCandidateBatchDelay);
+  }
+}
+
+void WebRtc::SendPendingIceCandidates(const WebrtcPeerId& remote_peer_id) {
+  PendingIceCandidates pending;
+  {
+    MutexLock ice_candidates_lock(&ice_candidates_mutex_);
+    auto entry = pending_ice_candidates_.find(remote_peer_id.GetId());
+    if (entry == pending_ice_candidates_.end()) {
+      return;
     }
+    pending = std::move(entry->second);
+    pending_ice_candidates_.erase(entry);
+  }
+  if (pending.ice_candidates.empty()) {
+    return;
+  }
 
-    NEARBY_LOGS(INFO) << "Sent ice candidate to " << remote_peer_id.GetId();
+  if (!pending.signaling_messenger->SendMessage(
+          remote_peer_id.GetId(),
+          webrtc_frames::EncodeIceCandidates(pending.self_peer_id,
+                                             pending.ice_candidates))) {
+    NEARBY_LOGS(INFO) << "Failed to send " << pending.ice_candidates.size()
+                      << " ice candidates to " << remote_peer_id.GetId();
     return;
   }
 
-  NEARBY_LOGS(INFO) << "Skipping restart listening for tachyon inbox messages "
-                       "since we are not accepting connections for service "
-                    << service_id;
+  NEARBY_LOGS(INFO) << "Sent " << pending.ice_candidates.size()
+                    << " ice candidates to " << remote_peer_id.GetId();
+}
+
+void WebRtc::DropPendingIceCandidates(const WebrtcPeerId& remote_peer_id) {
+  MutexLock ice_candidates_lock(&ice_candidates_mutex_);
+  pending_ice_candidates_.erase(remote_peer_id.GetId());
 }
 
 void WebRtc::OnSignalingMessage(const std::string& service_id,
@@ -783,6 +833,7 @@ void WebRtc::RemoveConnectionFlow(const WebrtcPeerId& remote_peer_id) {
   if (!connection_flows_.erase(remote_peer_id.GetId())) {
     return;
   }
+  DropPendingIceCandidates(remote_peer_id);
 
   // If we had an outgoing connection request w/ this peer, report the failure
   // to the future that's being waited on.
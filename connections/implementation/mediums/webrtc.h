@@ -101,6 +101,13 @@ class WebRtc {
   // occured during a call to `Connect`, per service id.
   std::map<std::string, int> service_id_to_connect_attempts_count_map_;
 
+  // Runs on |single_thread_executor_|. Called directly by unit tests to gather
+  // candidates faster than a real connection flow does.
+  void ProcessLocalIceCandidate(
+      const std::string& service_id, const WebrtcPeerId& remote_peer_id,
+      const location::nearby::mediums::IceCandidate ice_candidate)
+      ABSL_LOCKS_EXCLUDED(mutex_);
+
  private:
   static constexpr int kConnectAttemptsLimit = 3;
   static constexpr int kRestartAcceptConnectionsLimit = 3;
@@ -120,8 +127,9 @@ class WebRtc {
     // callback is notified.
     AcceptedConnectionCallback accepted_connection_callback;
 
-    // Allows us to communicate with the Tachyon web server.
-    std::unique_ptr<WebRtcSignalingMessenger> signaling_messenger;
+    // Allows us to communicate with the Tachyon web server. Shared with the
+    // ICE candidate sends that are still queued on |signaling_executor_|.
+    std::shared_ptr<WebRtcSignalingMessenger> signaling_messenger;
 
     // Restarts the tachyon inbox receives messages streaming rpc if the
     // streaming rpc times out. The streaming rpc times out after 60s while
@@ -140,14 +148,24 @@ class WebRtc {
     // message us over Tachyon.
     WebrtcPeerId self_peer_id;
 
-    // Allows us to communicate with the Tachyon web server.
-    std::unique_ptr<WebRtcSignalingMessenger> signaling_messenger;
+    // Allows us to communicate with the Tachyon web server. Shared with the
+    // ICE candidate sends that are still queued on |signaling_executor_|.
+    std::shared_ptr<WebRtcSignalingMessenger> signaling_messenger;
 
     // The pending DataChannel future. Our client will be blocked on this while
     // they wait for us to set up the channel over Tachyon.
     Future<WebRtcSocketWrapper> socket_future;
   };
 
+  struct PendingIceCandidates {
+    // The messenger and sender ID to send the candidates with.
+    std::shared_ptr<WebRtcSignalingMessenger> signaling_messenger;
+    WebrtcPeerId self_peer_id;
+
+    // Local ICE candidates gathered for the remote peer, in gathering order.
+    std::vector<location::nearby::mediums::IceCandidate> ice_candidates;
+  };
+
   // Attempt to initiates a WebRtc connection with peer device identified by
   // |peer_id|.
   // Runs on @MainThread.
@@ -221,11 +239,13 @@ class WebRtc {
   void ProcessDataChannelClosed(const WebrtcPeerId& remote_peer_id)
       ABSL_LOCKS_EXCLUDED(mutex_);
 
-  // Runs on |single_thread_executor_|.
-  void ProcessLocalIceCandidate(
-      const std::string& service_id, const WebrtcPeerId& remote_peer_id,
-      const location::nearby::mediums::IceCandidate ice_candidate)
-      ABSL_LOCKS_EXCLUDED(mutex_);
+  // Runs on |signaling_executor_|.
+  void SendPendingIceCandidates(const WebrtcPeerId& remote_peer_id)
+      ABSL_LOCKS_EXCLUDED(ice_candidates_mutex_);
+
+  // Drops the ICE candidates that have not been sent to |remote_peer_id| yet.
+  void DropPendingIceCandidates(const WebrtcPeerId& remote_peer_id)
+      ABSL_LOCKS_EXCLUDED(ice_candidates_mutex_);
 
   // Runs on |single_thread_executor_|.
   void ProcessRestartTachyonReceiveMessages(const std::string& service_id)
@@ -265,6 +285,23 @@ class WebRtc {
       connection_flows_ ABSL_GUARDED_BY(mutex_);
 
   bool is_using_cellular_ ABSL_GUARDED_BY(mutex_) = true;
+
+  // Guards |pending_ice_candidates_|. Acquired after |mutex_| when both are
+  // held, and never held while talking to Tachyon.
+  Mutex ice_candidates_mutex_;
+
+  // A map of a remote PeerId -> local ICE candidates not yet sent to it.
+  // Candidates gathered within kIceCandidateBatchDelay of each other, or while
+  // a previous batch is still being sent, go out in one message.
+  absl::flat_hash_map<std::string, PendingIceCandidates> pending_ice_candidates_
+      ABSL_GUARDED_BY(ice_candidates_mutex_);
+
+  // Sends ICE candidates to Tachyon so that neither candidate gathering nor
+  // other operations on |mutex_| wait on the signaling round trip. Batches are
+  // sent one at a time, in order. Offers and answers are still sent
+  // synchronously, and a flow only gathers candidates once its local
+  // description is set, so its candidates always follow its offer or answer.
+  ScheduledExecutor signaling_executor_;
 };
 
 }  // namespace mediums
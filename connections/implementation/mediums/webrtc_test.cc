@@ -21,6 +21,9 @@
 #include "gmock/gmock.h"
 #include "protobuf-matchers/protocol-buffer-matchers.h"
 #include "gtest/gtest.h"
+#include "absl/strings/str_cat.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 #include "connections/implementation/mediums/webrtc_peer_id.h"
 #include "connections/implementation/mediums/webrtc_socket.h"
 #include "internal/platform/byte_array.h"
@@ -29,9 +32,11 @@
 #include "internal/platform/expected.h"
 #include "internal/platform/feature_flags.h"
 #include "internal/platform/future.h"
+#include "internal/platform/logging.h"
 #include "internal/platform/medium_environment.h"
 #include "internal/platform/webrtc.h"
 #include "internal/test/fake_webrtc.h"
+#include "proto/mediums/web_rtc_signaling_frames.pb.h"
 
 namespace nearby {
 namespace connections {
@@ -55,6 +60,8 @@ class TestWebRtc : public WebRtc {
   int connect_attempts_count(std::string service_id) {
     return service_id_to_connect_attempts_count_map_[service_id];
   }
+
+  using WebRtc::ProcessLocalIceCandidate;
 };
 
 class WebRtcTest : public ::testing::TestWithParam<WebRtcTestParams> {
@@ -613,6 +620,115 @@ TEST_P(WebRtcTest, CancelDuringConnect_MultipleConnect) {
   env_.Stop();
 }
 
+// Tests that the devices still connect when every signaling message takes a
+// while to reach the other side, and reports how long connecting took.
+TEST_P(WebRtcTest, ConnectWithSignalingLatency) {
+  env_.Start({.webrtc_enabled = true});
+  WebRtcTestParams params = GetParam();
+  env_.SetFeatureFlags(params.feature_flags);
+  constexpr absl::Duration kSignalingLatency = absl::Milliseconds(100);
+  WebRtcSocketWrapper receiver_socket;
+  const WebrtcPeerId self_id("self_id");
+  const std::string service_id("NearbySharing");
+  LocationHint location_hint;
+  Future<bool> connected;
+
+  CancellationFlag receiver_flag;
+  auto receiver_medium = std::make_unique<FakeWebRtcMedium>(&receiver_flag);
+  receiver_medium->SetSignalingLatency(kSignalingLatency);
+  FakeWebRtcMedium* fake_receiver_medium = receiver_medium.get();
+  auto receiver = std::make_unique<TestWebRtc>(std::move(receiver_medium));
+
+  CancellationFlag sender_flag;
+  auto sender_medium = std::make_unique<FakeWebRtcMedium>(&sender_flag);
+  sender_medium->SetSignalingLatency(kSignalingLatency);
+  FakeWebRtcMedium* fake_sender_medium = sender_medium.get();
+  auto sender = std::make_unique<TestWebRtc>(std::move(sender_medium));
+
+  receiver->StartAcceptingConnections(
+      service_id, self_id, location_hint,
+      [&receiver_socket, connected](const std::string& service_id,
+                                    WebRtcSocketWrapper wrapper) mutable {
+        receiver_socket = wrapper;
+        connected.Set(receiver_socket.IsValid());
+      },
+      params.non_cellular);
+
+  absl::Time start = absl::Now();
+  ErrorOr<WebRtcSocketWrapper> sender_socket_result = sender->Connect(
+      service_id, self_id, location_hint, &sender_flag, params.non_cellular);
+  absl::Duration connect_time = absl::Now() - start;
+  ASSERT_TRUE(sender_socket_result.has_value());
+  EXPECT_TRUE(sender_socket_result.value().IsValid());
+  ExceptionOr<bool> devices_connected = connected.Get();
+  ASSERT_TRUE(devices_connected.ok());
+  EXPECT_TRUE(devices_connected.result());
+  EXPECT_EQ(1, sender->connect_attempts_count(service_id));
+
+  for (const FakeWebRtcMedium* medium :
+       {fake_receiver_medium, fake_sender_medium}) {
+    const FakeWebRtcSignalingMessenger::Stats& stats =
+        medium->GetSignalingStats();
+    NEARBY_LOGS(INFO) << "Sent " << stats.sent_ice_candidates.load()
+                      << " ice candidates in "
+                      << stats.sent_ice_candidates_messages.load()
+                      << " messages";
+  }
+  NEARBY_LOGS(INFO) << "Connected in " << connect_time << " with "
+                    << kSignalingLatency << " signaling latency";
+
+  receiver_socket.Close();
+  sender_socket_result.value().Close();
+  env_.Stop();
+}
+
+// Tests that local ICE candidates gathered in quick succession reach the
+// remote peer in fewer signaling messages than there are candidates.
+TEST_P(WebRtcTest, BatchesLocalIceCandidates) {
+  env_.Start({.webrtc_enabled = true});
+  WebRtcTestParams params = GetParam();
+  env_.SetFeatureFlags(params.feature_flags);
+  constexpr int kIceCandidates = 10;
+  const WebrtcPeerId self_id("self_id");
+  const WebrtcPeerId remote_peer_id("remote_peer_id");
+  const std::string service_id("NearbySharing");
+  LocationHint location_hint;
+
+  CancellationFlag flag;
+  auto medium = std::make_unique<FakeWebRtcMedium>(&flag);
+  // Long enough that the candidates gathered while the first batch is being
+  // sent all go out in the next one.
+  medium->SetSignalingLatency(absl::Milliseconds(100));
+  FakeWebRtcMedium* fake_medium = medium.get();
+  TestWebRtc webrtc(std::move(medium));
+  ASSERT_TRUE(webrtc.StartAcceptingConnections(
+      service_id, self_id, location_hint,
+      [](const std::string& service_id, WebRtcSocketWrapper wrapper) {},
+      params.non_cellular));
+
+  for (int i = 0; i < kIceCandidates; ++i) {
+    location::nearby::mediums::IceCandidate ice_candidate;
+    ice_candidate.set_sdp(absl::StrCat("candidate:", i));
+    ice_candidate.set_sdp_mid("data");
+    ice_candidate.set_sdp_m_line_index(0);
+    webrtc.ProcessLocalIceCandidate(service_id, remote_peer_id,
+                                    ice_candidate);
+  }
+
+  const FakeWebRtcSignalingMessenger::Stats& stats =
+      fake_medium->GetSignalingStats();
+  absl::Time deadline = absl::Now() + absl::Seconds(5);
+  while (stats.sent_ice_candidates.load() < kIceCandidates &&
+         absl::Now() < deadline) {
+    absl::SleepFor(absl::Milliseconds(10));
+  }
+  EXPECT_EQ(stats.sent_ice_candidates.load(), kIceCandidates);
+  EXPECT_LT(stats.sent_ice_candidates_messages.load(), kIceCandidates);
+
+  webrtc.StopAcceptingConnections(service_id);
+  env_.Stop();
+}
+
 INSTANTIATE_TEST_SUITE_P(ParametrisedWebRtcTest, WebRtcTest,
                          testing::ValuesIn<WebRtcTestParams>({
                              {.feature_flags =
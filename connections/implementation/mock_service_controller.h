@@ -21,6 +21,7 @@
 #include "gmock/gmock.h"
 #include "connections/implementation/service_controller.h"
 #include "connections/listeners.h"
+#include "connections/rate_limit.h"
 #include "connections/v3/connection_listening_options.h"
 #include "internal/interop/device.h"
 
@@ -119,6 +120,17 @@ class MockServiceController : public ServiceController {
 
   MOCK_METHOD(void, SetCustomSavePath,
               (ClientProxy * client, const std::string& path), (override));
+
+  MOCK_METHOD(Status, SetClientRateLimit,
+              (ClientProxy * client, RateLimit rate_limit), (override));
+  MOCK_METHOD(Status, SetEndpointRateLimit,
+              (ClientProxy * client, const std::string& endpoint_id,
+               RateLimit rate_limit),
+              (override));
+  MOCK_METHOD(Status, SetPayloadRateLimit,
+              (ClientProxy * client, Payload::Id payload_id,
+               RateLimit rate_limit),
+              (override));
 };
 
 }  // namespace connections
@@ -18,6 +18,7 @@
 #include "gmock/gmock.h"
 #include "connections/implementation/service_controller_router.h"
 #include "connections/listeners.h"
+#include "connections/rate_limit.h"
 
 namespace nearby {
 namespace connections {
@@ -93,6 +94,19 @@ class MockServiceControllerRouter : public ServiceControllerRouter {
                ResultCallback callback),
               (override));
 
+  MOCK_METHOD(void, SetClientRateLimit,
+              (ClientProxy * client, RateLimit rate_limit,
+               ResultCallback callback),
+              (override));
+  MOCK_METHOD(void, SetEndpointRateLimit,
+              (ClientProxy * client, absl::string_view endpoint_id,
+               RateLimit rate_limit, ResultCallback callback),
+              (override));
+  MOCK_METHOD(void, SetPayloadRateLimit,
+              (ClientProxy * client, std::uint64_t payload_id,
+               RateLimit rate_limit, ResultCallback callback),
+              (override));
+
   MOCK_METHOD(void, RequestConnectionV3,
               (ClientProxy * client, const NearbyDevice&,
                v3::ConnectionRequestInfo, const ConnectionOptions&,
@@ -27,6 +27,7 @@
 #include "connections/status.h"
 #include "internal/flags/nearby_flags.h"
 #include "internal/platform/byte_array.h"
+#include "internal/platform/feature_flags.h"
 
 namespace nearby {
 namespace connections {
@@ -120,6 +121,11 @@ ByteArray ForConnectionRequestConnections(
     connection_request->set_keep_alive_timeout_millis(
         conection_info.keep_alive_timeout_millis);
   }
+  if (!conection_info.shared_key_session_tag.empty()) {
+    auto* shared_key_offer = connection_request->mutable_shared_key_offer();
+    shared_key_offer->set_session_tag(conection_info.shared_key_session_tag);
+    shared_key_offer->set_nonce(conection_info.shared_key_nonce);
+  }
 
   return ToBytes(std::move(frame));
 }
@@ -191,6 +197,13 @@ ByteArray ForConnectionResponse(std::int32_t status, const OsInfo& os_info,
       NearbyFlags::GetInstance().GetInt64Flag(
           config_package_nearby::nearby_connections_feature::
               kSafeToDisconnectVersion));
+  if (FeatureFlags::GetInstance().GetFlags().enable_shared_key_hub) {
+    sub_frame->set_supports_shared_key(true);
+  }
+  if (FeatureFlags::GetInstance().GetFlags().enable_payload_header_elision) {
+    sub_frame->set_supports_payload_header_elision(true);
+  }
+  sub_frame->set_supports_datagram(true);
 
   return ToBytes(std::move(frame));
 }
@@ -449,6 +462,27 @@ ByteArray ForBwuIntroductionAck() {
   return ToBytes(std::move(frame));
 }
 
+ByteArray ForBwuPathsAvailable(
+    const std::vector<UpgradePathInfo>& upgrade_path_infos) {
+  OfflineFrame frame;
+
+  frame.set_version(OfflineFrame::V1);
+  auto* v1_frame = frame.mutable_v1();
+  v1_frame->set_type(V1Frame::BANDWIDTH_UPGRADE_NEGOTIATION);
+  auto* sub_frame = v1_frame->mutable_bandwidth_upgrade_negotiation();
+  sub_frame->set_event_type(
+      BandwidthUpgradeNegotiationFrame::UPGRADE_PATH_AVAILABLE);
+  for (const UpgradePathInfo& info : upgrade_path_infos) {
+    if (!sub_frame->has_upgrade_path_info()) {
+      *sub_frame->mutable_upgrade_path_info() = info;
+    } else {
+      *sub_frame->add_alternative_upgrade_path_infos() = info;
+    }
+  }
+
+  return ToBytes(std::move(frame));
+}
+
 ByteArray ForBwuFailure(const UpgradePathInfo& info) {
   OfflineFrame frame;
 
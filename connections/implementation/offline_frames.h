@@ -96,6 +96,11 @@ ByteArray ForBwuBluetoothPathAvailable(const std::string& service_id,
 ByteArray ForBwuWebrtcPathAvailable(
     const std::string& peer_id,
     const location::nearby::connections::LocationHint& location_hint_a);
+// Offers |upgrade_path_infos| in order of preference. The first one is the
+// primary upgrade path; the rest are alternatives the responder may race
+// against it.
+ByteArray ForBwuPathsAvailable(
+    const std::vector<UpgradePathInfo>& upgrade_path_infos);
 ByteArray ForBwuFailure(const UpgradePathInfo& info);
 ByteArray ForBwuLastWrite();
 ByteArray ForBwuSafeToClose();
@@ -272,6 +272,7 @@ TEST(OfflineFramesTest, CanGenerateConnectionResponse) {
         os_info { type: LINUX }
         multiplex_socket_bitmask: 0x01
         safe_to_disconnect_version: 5
+        supports_datagram: true
       >
     >)pb";
 
@@ -414,6 +415,54 @@ TEST(OfflineFramesTest, CanGenerateBwuWifiLanPathAvailable) {
   EXPECT_THAT(message, EqualsProto(kExpected));
 }
 
+TEST(OfflineFramesTest, CanGenerateBwuPathsAvailable) {
+  constexpr absl::string_view kExpected =
+      R"pb(
+    version: V1
+    v1: <
+      type: BANDWIDTH_UPGRADE_NEGOTIATION
+      bandwidth_upgrade_negotiation: <
+        event_type: UPGRADE_PATH_AVAILABLE
+        upgrade_path_info: <
+          medium: WIFI_LAN
+          wifi_lan_socket: < ip_address: "\x01\x02\x03\x04" wifi_port: 1234 >
+          supports_client_introduction_ack: true
+        >
+        alternative_upgrade_path_infos: <
+          medium: WIFI_HOTSPOT
+          wifi_hotspot_credentials: <
+            ssid: "ssid"
+            password: "password"
+            port: 1234
+            gateway: "0.0.0.0"
+            frequency: 2412
+          >
+          supports_disabling_encryption: false
+          supports_client_introduction_ack: true
+        >
+      >
+    >)pb";
+  auto wifi_lan =
+      FromBytes(ForBwuWifiLanPathAvailable("\x01\x02\x03\x04", 1234));
+  auto hotspot = FromBytes(ForBwuWifiHotspotPathAvailable(
+      "ssid", "password", 1234, /*frequency=*/2412, "0.0.0.0", false));
+  ASSERT_TRUE(wifi_lan.ok());
+  ASSERT_TRUE(hotspot.ok());
+
+  const UpgradePathInfo& wifi_lan_path = wifi_lan.result()
+                                             .v1()
+                                             .bandwidth_upgrade_negotiation()
+                                             .upgrade_path_info();
+  const UpgradePathInfo& hotspot_path =
+      hotspot.result().v1().bandwidth_upgrade_negotiation().upgrade_path_info();
+
+  ByteArray bytes = ForBwuPathsAvailable({wifi_lan_path, hotspot_path});
+  auto response = FromBytes(bytes);
+  ASSERT_TRUE(response.ok());
+  OfflineFrame message = response.result();
+  EXPECT_THAT(message, EqualsProto(kExpected));
+}
+
 TEST(OfflineFramesTest, CanGenerateBwuWifiAwarePathAvailable) {
   constexpr absl::string_view kExpected =
       R"pb(
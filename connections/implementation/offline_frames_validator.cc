@@ -394,6 +394,13 @@ Exception EnsureValidBandwidthUpgradeNegotiationFrame(
   switch (frame.event_type()) {
     case BandwidthUpgradeNegotiationFrame::UPGRADE_PATH_AVAILABLE:
       if (frame.has_upgrade_path_info()) {
+        for (const auto& upgrade_path_info :
+             frame.alternative_upgrade_path_infos()) {
+          if (!EnsureValidBandwidthUpgradePathAvailableFrame(upgrade_path_info)
+                   .Ok()) {
+            return {Exception::kInvalidProtocolBuffer};
+          }
+        }
         return EnsureValidBandwidthUpgradePathAvailableFrame(
             frame.upgrade_path_info());
       }
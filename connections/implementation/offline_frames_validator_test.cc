@@ -632,6 +632,38 @@ TEST(OfflineFramesValidatorTest, ValidatesAsOkBandwidthUpgradeWifiDirect) {
   EXPECT_TRUE(ret_value.Ok());
 }
 
+TEST(OfflineFramesValidatorTest,
+     ValidatesAlternativeUpgradePathsInBandwidthUpgradeNegotiation) {
+  OfflineFrame hotspot_frame;
+  OfflineFrame wifi_direct_frame;
+  OfflineFrame offline_frame_1;
+  OfflineFrame offline_frame_2;
+
+  hotspot_frame.ParseFromString(std::string(ForBwuWifiHotspotPathAvailable(
+      std::string(kSsid), std::string(kPassword), kPort, kHotspotFrequency,
+      std::string(kWifiHotspotGateway), kSupportsDisablingEncryption)));
+  // Anything less than -1 is an invalid frequency.
+  wifi_direct_frame.ParseFromString(std::string(ForBwuWifiDirectPathAvailable(
+      std::string(kWifiDirectSsid), std::string(kWifiDirectPassword), kPort, -2,
+      kSupportsDisablingEncryption, std::string(kGateway))));
+  const UpgradePathInfo& hotspot_path =
+      hotspot_frame.v1().bandwidth_upgrade_negotiation().upgrade_path_info();
+  UpgradePathInfo wifi_direct_path = wifi_direct_frame.v1()
+                                         .bandwidth_upgrade_negotiation()
+                                         .upgrade_path_info();
+
+  offline_frame_1.ParseFromString(
+      std::string(ForBwuPathsAvailable({hotspot_path, wifi_direct_path})));
+
+  EXPECT_FALSE(EnsureValidOfflineFrame(offline_frame_1).Ok());
+
+  wifi_direct_path.mutable_wifi_direct_credentials()->set_frequency(-1);
+  offline_frame_2.ParseFromString(
+      std::string(ForBwuPathsAvailable({hotspot_path, wifi_direct_path})));
+
+  EXPECT_TRUE(EnsureValidOfflineFrame(offline_frame_2).Ok());
+}
+
 TEST(OfflineFramesValidatorTest,
      ValidatesValidFrequencyInBandwidthUpgradeWifiDirect) {
   OfflineFrame offline_frame_1;
@@ -29,6 +29,7 @@
 #include "connections/out_of_band_connection_metadata.h"
 #include "connections/params.h"
 #include "connections/payload.h"
+#include "connections/rate_limit.h"
 #include "connections/status.h"
 #include "connections/v3/connection_listening_options.h"
 #include "connections/v3/listeners.h"
@@ -232,6 +233,40 @@ void OfflineServiceController::SetCustomSavePath(ClientProxy* client,
   payload_manager_.SetCustomSavePath(client, path);
 }
 
+Status OfflineServiceController::SetClientRateLimit(ClientProxy* client,
+                                                    RateLimit rate_limit) {
+  if (stop_) return {Status::kOutOfOrderApiCall};
+  NEARBY_LOGS(INFO) << "Client " << client->GetClientId()
+                    << " set its rate limit to " << rate_limit.bytes_per_second
+                    << " bytes/s";
+  payload_manager_.SetClientRateLimit(client, rate_limit);
+  return {Status::kSuccess};
+}
+
+Status OfflineServiceController::SetEndpointRateLimit(
+    ClientProxy* client, const std::string& endpoint_id,
+    RateLimit rate_limit) {
+  if (stop_) return {Status::kOutOfOrderApiCall};
+  if (!client->IsConnectedToEndpoint(endpoint_id)) {
+    return {Status::kNotConnectedToEndpoint};
+  }
+  NEARBY_LOGS(INFO) << "Client " << client->GetClientId()
+                    << " set the rate limit of endpoint " << endpoint_id
+                    << " to " << rate_limit.bytes_per_second << " bytes/s";
+  payload_manager_.SetEndpointRateLimit(client, endpoint_id, rate_limit);
+  return {Status::kSuccess};
+}
+
+Status OfflineServiceController::SetPayloadRateLimit(ClientProxy* client,
+                                                     Payload::Id payload_id,
+                                                     RateLimit rate_limit) {
+  if (stop_) return {Status::kOutOfOrderApiCall};
+  NEARBY_LOGS(INFO) << "Client " << client->GetClientId()
+                    << " set the rate limit of payload " << payload_id
+                    << " to " << rate_limit.bytes_per_second << " bytes/s";
+  return payload_manager_.SetPayloadRateLimit(client, payload_id, rate_limit);
+}
+
 void OfflineServiceController::ShutdownBwuManagerExecutors() {
   NEARBY_LOGS(INFO) << "Shutting down BwuManager executors.";
   bwu_manager_.ShutdownExecutors();
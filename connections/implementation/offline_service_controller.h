@@ -30,6 +30,7 @@
 #include "connections/implementation/service_controller.h"
 #include "connections/listeners.h"
 #include "connections/payload.h"
+#include "connections/rate_limit.h"
 #include "connections/status.h"
 #include "connections/v3/connection_listening_options.h"
 
@@ -100,6 +101,14 @@ class OfflineServiceController : public ServiceController {
 
   void SetCustomSavePath(ClientProxy* client, const std::string& path) override;
 
+  Status SetClientRateLimit(ClientProxy* client,
+                            RateLimit rate_limit) override;
+  Status SetEndpointRateLimit(ClientProxy* client,
+                              const std::string& endpoint_id,
+                              RateLimit rate_limit) override;
+  Status SetPayloadRateLimit(ClientProxy* client, Payload::Id payload_id,
+                             RateLimit rate_limit) override;
+
   void ShutdownBwuManagerExecutors() override;
 
  private:
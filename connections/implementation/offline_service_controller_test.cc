@@ -518,7 +518,8 @@ INSTANTIATE_TEST_SUITE_P(ParametrisedOfflineServiceControllerTest,
 
 // Verifies that InjectEndpoint() can be run successfully; does not test the
 // full connection flow given that normal discovery/advertisement is skipped.
-// Note: Not parameterized because InjectEndpoint only works over Bluetooth.
+// Note: Not parameterized; Wi-Fi LAN and BLE injection are covered by
+// P2pClusterPcpHandlerTest.
 TEST_F(OfflineServiceControllerTest, InjectEndpoint) {
   env_.Start();
   OfflineSimulationUser user_a(kDeviceA,
@@ -23,6 +23,7 @@
 
 #include "absl/functional/bind_front.h"
 #include "absl/strings/escaping.h"
+#include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/string_view.h"
 #include "connections/advertising_options.h"
@@ -57,10 +58,12 @@
 #include "internal/platform/ble_v2.h"
 #include "internal/platform/bluetooth_adapter.h"
 #include "internal/platform/bluetooth_classic.h"
+#include "internal/platform/bluetooth_utils.h"
 #include "internal/platform/byte_array.h"
 #include "internal/platform/expected.h"
 #include "internal/platform/implementation/platform.h"
 #include "internal/platform/logging.h"
+#include "internal/platform/mutex_lock.h"
 #include "internal/platform/nsd_service_info.h"
 #include "internal/platform/os_name.h"
 #include "internal/platform/types.h"
@@ -114,6 +117,9 @@ P2pClusterPcpHandler::P2pClusterPcpHandler(
 
 P2pClusterPcpHandler::~P2pClusterPcpHandler() {
   NEARBY_VLOG(1) << __func__;
+  // Drain the discovery lane first; its tasks post to the PCP handler thread.
+  DisconnectFromEndpointManager();
+  discovery_executor_.Shutdown();
   Shutdown();
 }
 
@@ -348,31 +354,70 @@ Status P2pClusterPcpHandler::StopAdvertisingImpl(ClientProxy* client) {
   return {Status::kSuccess};
 }
 
+void P2pClusterPcpHandler::RunOnDiscoveryThread(const std::string& name,
+                                                Runnable runnable) {
+  if (stop_.Get()) {
+    NEARBY_VLOG(1) << "Skip to run discovery task " << name
+                   << " due to PCP Handler is stopped";
+    return;
+  }
+
+  discovery_executor_.Execute(name, std::move(runnable));
+}
+
+ByteArray P2pClusterPcpHandler::GetServiceIdHash(absl::string_view service_id,
+                                                 size_t size) const {
+  MutexLock lock(&service_id_hash_mutex_);
+  auto key = std::make_pair(std::string(service_id), size);
+  auto it = service_id_hashes_.find(key);
+  if (it != service_id_hashes_.end()) {
+    return it->second;
+  }
+  ByteArray hash = GenerateHash(key.first, size);
+  service_id_hashes_.emplace(std::move(key), hash);
+  return hash;
+}
+
+bool P2pClusterPcpHandler::MarkDiscoveryPending(const std::string& key) {
+  MutexLock lock(&pending_discoveries_mutex_);
+  return pending_discoveries_.insert(key).second;
+}
+
+void P2pClusterPcpHandler::ClearDiscoveryPending(const std::string& key) {
+  MutexLock lock(&pending_discoveries_mutex_);
+  pending_discoveries_.erase(key);
+}
+
+size_t P2pClusterPcpHandler::GetPendingDiscoveryCountForTesting() {
+  MutexLock lock(&pending_discoveries_mutex_);
+  return pending_discoveries_.size();
+}
+
 bool P2pClusterPcpHandler::IsRecognizedBluetoothEndpoint(
     const std::string& name_string, const std::string& service_id,
     const BluetoothDeviceName& name) const {
   if (!name.IsValid()) {
-    NEARBY_LOGS(INFO) << name_string
-                      << " doesn't have any endpoint id, discarding.";
+    NEARBY_VLOG(1) << name_string
+                   << " doesn't have any endpoint id, discarding.";
     return false;
   }
 
   if (name.GetPcp() != GetPcp()) {
-    NEARBY_LOGS(INFO) << name_string << " doesn't match on Pcp; expected "
-                      << PcpToStrategy(GetPcp()).GetName() << ", found "
-                      << PcpToStrategy(name.GetPcp()).GetName();
+    NEARBY_VLOG(1) << name_string << " doesn't match on Pcp; expected "
+                   << PcpToStrategy(GetPcp()).GetName() << ", found "
+                   << PcpToStrategy(name.GetPcp()).GetName();
     return false;
   }
 
   ByteArray expected_service_id_hash =
-      GenerateHash(service_id, BluetoothDeviceName::kServiceIdHashLength);
+      GetServiceIdHash(service_id, BluetoothDeviceName::kServiceIdHashLength);
 
   if (name.GetServiceIdHash() != expected_service_id_hash) {
-    NEARBY_LOGS(INFO) << name_string
-                      << " doesn't match on expected service_id_hash; expected "
-                      << absl::BytesToHexString(expected_service_id_hash.data())
-                      << ", found "
-                      << absl::BytesToHexString(name.GetServiceIdHash().data());
+    NEARBY_VLOG(1) << name_string
+                   << " doesn't match on expected service_id_hash; expected "
+                   << absl::BytesToHexString(expected_service_id_hash.data())
+                   << ", found "
+                   << absl::BytesToHexString(name.GetServiceIdHash().data());
     return false;
   }
 
@@ -382,137 +427,161 @@ bool P2pClusterPcpHandler::IsRecognizedBluetoothEndpoint(
 void P2pClusterPcpHandler::BluetoothDeviceDiscoveredHandler(
     ClientProxy* client, const std::string& service_id,
     BluetoothDevice device) {
-  RunOnPcpHandlerThread(
-      "p2p-bt-device-discovered",
-      [this, client, service_id, device]()
-          RUN_ON_PCP_HANDLER_THREAD() {
-            if (!device.IsValid()) {
-              NEARBY_LOGS(WARNING) << "BluetoothDeviceDiscoveredHandler: "
-                                      "Skipping the invalid Bluetooth device";
-              return;
-            }
-
-            // Make sure we are still discovering before proceeding.
-            if (!client->IsDiscovering()) {
-              NEARBY_LOGS(WARNING) << "Skipping discovery of BluetoothDevice "
-                                   << device.GetName()
-                                   << " because we are no longer discovering.";
-              return;
-            }
-
-            // Parse the Bluetooth device name.
-            const std::string device_name_string = device.GetName();
-            BluetoothDeviceName device_name(device_name_string);
-
-            // Make sure the Bluetooth device name points to a valid
-            // endpoint we're discovering.
-            if (!IsRecognizedBluetoothEndpoint(device_name_string, service_id,
-                                               device_name)) {
-              NEARBY_LOGS(INFO) << "Found unrecognized BluetoothDeviceName "
-                                << device_name_string;
-              return;
-            }
+  RunOnDiscoveryThread(
+      "p2p-bt-device-discovered", [this, client, service_id, device]() {
+        if (!device.IsValid()) {
+          NEARBY_LOGS(WARNING) << "BluetoothDeviceDiscoveredHandler: "
+                                  "Skipping the invalid Bluetooth device";
+          return;
+        }
 
-            // Report the discovered endpoint to the client.
-            NEARBY_LOGS(INFO)
-                << "Found BluetoothDeviceName " << device_name_string
-                << " (with endpoint_id=" << device_name.GetEndpointId()
-                << " and endpoint_info="
-                << absl::BytesToHexString(device_name.GetEndpointInfo().data())
-                << ").";
-            OnEndpointFound(
-                client,
-                std::make_shared<BluetoothEndpoint>(BluetoothEndpoint{
-                    {device_name.GetEndpointId(), device_name.GetEndpointInfo(),
-                     service_id, BLUETOOTH, device_name.GetWebRtcState()},
-                    device,
-                }));
-          });
+        // Make sure we are still discovering before proceeding.
+        if (!client->IsDiscovering()) {
+          NEARBY_LOGS(WARNING) << "Skipping discovery of BluetoothDevice "
+                               << device.GetName()
+                               << " because we are no longer discovering.";
+          return;
+        }
+
+        // Parse the Bluetooth device name.
+        const std::string device_name_string = device.GetName();
+        BluetoothDeviceName device_name(device_name_string);
+
+        // Make sure the Bluetooth device name points to a valid
+        // endpoint we're discovering.
+        if (!IsRecognizedBluetoothEndpoint(device_name_string, service_id,
+                                           device_name)) {
+          NEARBY_VLOG(1) << "Found unrecognized BluetoothDeviceName "
+                         << device_name_string;
+          return;
+        }
+
+        std::string pending_key =
+            absl::StrCat("bt:", device.GetMacAddress(), device_name_string);
+        if (!MarkDiscoveryPending(pending_key)) {
+          NEARBY_VLOG(1) << "Dropping duplicate BluetoothDeviceName "
+                         << device_name_string;
+          return;
+        }
+
+        RunOnPcpHandlerThread(
+            "p2p-bt-device-discovered",
+            [this, client, service_id, device, device_name,
+             pending_key]() RUN_ON_PCP_HANDLER_THREAD() {
+              ClearDiscoveryPending(pending_key);
+              if (!client->IsDiscovering()) return;
+
+              // Report the discovered endpoint to the client.
+              NEARBY_VLOG(1) << "Found BluetoothDeviceName "
+                             << device.GetName()
+                             << " (with endpoint_id="
+                             << device_name.GetEndpointId()
+                             << " and endpoint_info="
+                             << absl::BytesToHexString(
+                                    device_name.GetEndpointInfo().data())
+                             << ").";
+              OnEndpointFound(
+                  client,
+                  std::make_shared<BluetoothEndpoint>(BluetoothEndpoint{
+                      {device_name.GetEndpointId(),
+                       device_name.GetEndpointInfo(), service_id, BLUETOOTH,
+                       device_name.GetWebRtcState()},
+                      device,
+                  }));
+            });
+      });
 }
 
 void P2pClusterPcpHandler::BluetoothNameChangedHandler(
     ClientProxy* client, const std::string& service_id,
     BluetoothDevice device) {
-  RunOnPcpHandlerThread(
-      "p2p-bt-name-changed",
-      [this, client, service_id, device]()
-          RUN_ON_PCP_HANDLER_THREAD() {
-            // Make sure we are still discovering before proceeding.
-            if (!device.IsValid()) {
-              NEARBY_LOGS(WARNING)
-                  << "BluetoothNameChangedHandler: Skipping the "
-                     "invalid Bluetooth device";
-              return;
-            }
-
-            if (!client->IsDiscovering()) {
-              NEARBY_LOGS(WARNING)
-                  << "Ignoring lost BluetoothDevice " << device.GetName()
-                  << " because Connections is no longer discovering.";
-              return;
-            }
-
-            // Parse the Bluetooth device name.
-            const std::string device_name_string = device.GetName();
-            BluetoothDeviceName device_name(device_name_string);
-            NEARBY_LOGS(INFO)
-                << "BT discovery handler (CHANGED) [client_id="
-                << client->GetClientId() << ", service_id=" << service_id
-                << "]: processing new name " << device_name_string;
+  RunOnDiscoveryThread(
+      "p2p-bt-name-changed", [this, client, service_id, device]() {
+        // Make sure we are still discovering before proceeding.
+        if (!device.IsValid()) {
+          NEARBY_LOGS(WARNING) << "BluetoothNameChangedHandler: Skipping the "
+                                  "invalid Bluetooth device";
+          return;
+        }
+
+        if (!client->IsDiscovering()) {
+          NEARBY_LOGS(WARNING)
+              << "Ignoring lost BluetoothDevice " << device.GetName()
+              << " because Connections is no longer discovering.";
+          return;
+        }
+
+        // Parse the Bluetooth device name.
+        const std::string device_name_string = device.GetName();
+        BluetoothDeviceName device_name(device_name_string);
+        NEARBY_LOGS(INFO) << "BT discovery handler (CHANGED) [client_id="
+                          << client->GetClientId()
+                          << ", service_id=" << service_id
+                          << "]: processing new name " << device_name_string;
 
         // Make sure the Bluetooth device name points to a valid
         // endpoint we're discovering.
         if (!IsRecognizedBluetoothEndpoint(device_name_string, service_id,
                                            device_name)) {
-          NEARBY_LOGS(INFO) << "Found unrecognized BluetoothDeviceName "
-                            << device_name_string;
+          NEARBY_VLOG(1) << "Found unrecognized BluetoothDeviceName "
+                         << device_name_string;
           return;
         }
 
-        // By this point, the BluetoothDevice passed to us has a different
-        // name than what we may have discovered before. We need to iterate
-        // over the found BluetoothEndpoints and compare their addresses to
-        // see the devices are the same. We are not guaranteed to discover a
-        // match, since the old name may not have been formatted for Nearby
-        // Connections.
-        for (auto endpoint : GetDiscoveredEndpoints(Medium::BLUETOOTH)) {
-          BluetoothEndpoint* bluetoothEndpoint =
-              static_cast<BluetoothEndpoint*>(endpoint);
-          NEARBY_LOGS(INFO)
-              << "BT discovery handler (CHANGED) [client_id="
-              << client->GetClientId() << ", service_id=" << service_id
-              << "]: comparing MAC addresses with existing endpoint "
-              << bluetoothEndpoint->bluetooth_device.GetName()
-              << ". They have MAC address "
-              << bluetoothEndpoint->bluetooth_device.GetMacAddress()
-              << " and the new endpoint has MAC address "
-              << device.GetMacAddress();
-          if (bluetoothEndpoint->bluetooth_device.GetMacAddress() ==
-              device.GetMacAddress()) {
-            // Report the BluetoothEndpoint as lost to the client.
-            NEARBY_LOGS(INFO) << "Reporting lost BluetoothDevice "
-                              << bluetoothEndpoint->bluetooth_device.GetName()
-                              << ", due to device name change.";
-            OnEndpointLost(client, *endpoint);
-            break;
-          }
-        }
-
-        // Report the discovered endpoint to the client.
-        NEARBY_LOGS(INFO) << "Found BluetoothDeviceName " << device_name_string
-                          << " (with endpoint_id="
-                          << device_name.GetEndpointId()
-                          << " and endpoint_info="
-                          << absl::BytesToHexString(
-                                 device_name.GetEndpointInfo().data())
-                          << ").";
-        OnEndpointFound(
-            client,
-            std::make_shared<BluetoothEndpoint>(BluetoothEndpoint{
-                {device_name.GetEndpointId(), device_name.GetEndpointInfo(),
-                 service_id, Medium::BLUETOOTH, device_name.GetWebRtcState()},
-                device,
-            }));
+        RunOnPcpHandlerThread(
+            "p2p-bt-name-changed",
+            [this, client, service_id, device,
+             device_name]() RUN_ON_PCP_HANDLER_THREAD() {
+              if (!client->IsDiscovering()) return;
+
+              // By this point, the BluetoothDevice passed to us has a
+              // different name than what we may have discovered before. We
+              // need to iterate over the found BluetoothEndpoints and compare
+              // their addresses to see the devices are the same. We are not
+              // guaranteed to discover a match, since the old name may not
+              // have been formatted for Nearby Connections.
+              for (auto endpoint : GetDiscoveredEndpoints(Medium::BLUETOOTH)) {
+                BluetoothEndpoint* bluetoothEndpoint =
+                    static_cast<BluetoothEndpoint*>(endpoint);
+                NEARBY_LOGS(INFO)
+                    << "BT discovery handler (CHANGED) [client_id="
+                    << client->GetClientId() << ", service_id=" << service_id
+                    << "]: comparing MAC addresses with existing endpoint "
+                    << bluetoothEndpoint->bluetooth_device.GetName()
+                    << ". They have MAC address "
+                    << bluetoothEndpoint->bluetooth_device.GetMacAddress()
+                    << " and the new endpoint has MAC address "
+                    << device.GetMacAddress();
+                if (bluetoothEndpoint->bluetooth_device.GetMacAddress() ==
+                    device.GetMacAddress()) {
+                  // Report the BluetoothEndpoint as lost to the client.
+                  NEARBY_LOGS(INFO)
+                      << "Reporting lost BluetoothDevice "
+                      << bluetoothEndpoint->bluetooth_device.GetName()
+                      << ", due to device name change.";
+                  OnEndpointLost(client, *endpoint);
+                  break;
+                }
+              }
+
+              // Report the discovered endpoint to the client.
+              NEARBY_VLOG(1) << "Found BluetoothDeviceName "
+                             << device.GetName()
+                             << " (with endpoint_id="
+                             << device_name.GetEndpointId()
+                             << " and endpoint_info="
+                             << absl::BytesToHexString(
+                                    device_name.GetEndpointInfo().data())
+                             << ").";
+              OnEndpointFound(
+                  client,
+                  std::make_shared<BluetoothEndpoint>(BluetoothEndpoint{
+                      {device_name.GetEndpointId(),
+                       device_name.GetEndpointInfo(), service_id,
+                       Medium::BLUETOOTH, device_name.GetWebRtcState()},
+                      device,
+                  }));
+            });
       });
 }
 
@@ -526,9 +595,8 @@ void P2pClusterPcpHandler::BluetoothDeviceLostHandler(
   }
 
   const std::string& device_name_string = device.GetName();
-  RunOnPcpHandlerThread(
-      "p2p-bt-device-lost", [this, client, service_id,
-                             device_name_string]() RUN_ON_PCP_HANDLER_THREAD() {
+  RunOnDiscoveryThread(
+      "p2p-bt-device-lost", [this, client, service_id, device_name_string]() {
         // Make sure we are still discovering before proceeding.
         if (!client->IsDiscovering()) {
           NEARBY_LOGS(WARNING)
@@ -547,23 +615,31 @@ void P2pClusterPcpHandler::BluetoothDeviceLostHandler(
                                            device_name))
           return;
 
-        // Report the BluetoothEndpoint as lost to the client.
-        NEARBY_LOGS(INFO) << "Processing lost BluetoothDeviceName "
-                          << device_name_string;
-        OnEndpointLost(client, DiscoveredEndpoint{device_name.GetEndpointId(),
-                                                  device_name.GetEndpointInfo(),
-                                                  service_id, BLUETOOTH,
-                                                  WebRtcState::kUndefined});
+        RunOnPcpHandlerThread(
+            "p2p-bt-device-lost",
+            [this, client, service_id, device_name_string,
+             device_name]() RUN_ON_PCP_HANDLER_THREAD() {
+              if (!client->IsDiscovering()) return;
+
+              // Report the BluetoothEndpoint as lost to the client.
+              NEARBY_LOGS(INFO) << "Processing lost BluetoothDeviceName "
+                                << device_name_string;
+              OnEndpointLost(client,
+                             DiscoveredEndpoint{device_name.GetEndpointId(),
+                                                device_name.GetEndpointInfo(),
+                                                service_id, BLUETOOTH,
+                                                WebRtcState::kUndefined});
+            });
       });
 }
 
 bool P2pClusterPcpHandler::IsRecognizedBleEndpoint(
     const std::string& service_id,
-    const BleAdvertisement& advertisement) const {
+    const BleAdvertisement::View& advertisement) const {
   if (advertisement.GetPcp() != GetPcp()) {
-    NEARBY_LOGS(INFO) << "BleAdvertisement doesn't match on Pcp; expected "
-                      << PcpToStrategy(GetPcp()).GetName() << ", found "
-                      << PcpToStrategy(advertisement.GetPcp()).GetName();
+    NEARBY_VLOG(1) << "BleAdvertisement doesn't match on Pcp; expected "
+                   << PcpToStrategy(GetPcp()).GetName() << ", found "
+                   << PcpToStrategy(advertisement.GetPcp()).GetName();
     return false;
   }
 
@@ -571,15 +647,16 @@ bool P2pClusterPcpHandler::IsRecognizedBleEndpoint(
   // ServiceIdHash is empty for fast advertisement.
   if (!advertisement.IsFastAdvertisement()) {
     ByteArray expected_service_id_hash =
-        GenerateHash(service_id, BleAdvertisement::kServiceIdHashLength);
+        GetServiceIdHash(service_id, BleAdvertisement::kServiceIdHashLength);
 
-    if (advertisement.GetServiceIdHash() != expected_service_id_hash) {
-      NEARBY_LOGS(INFO)
+    if (advertisement.GetServiceIdHash() !=
+        expected_service_id_hash.AsStringView()) {
+      NEARBY_VLOG(1)
           << "BleAdvertisement doesn't match on expected service_id_hash; "
              "expected "
-          << absl::BytesToHexString(expected_service_id_hash.data())
+          << absl::BytesToHexString(expected_service_id_hash.AsStringView())
           << ", found "
-          << absl::BytesToHexString(advertisement.GetServiceIdHash().data());
+          << absl::BytesToHexString(advertisement.GetServiceIdHash());
       return false;
     }
   }
@@ -591,10 +668,10 @@ void P2pClusterPcpHandler::BlePeripheralDiscoveredHandler(
     ClientProxy* client, BlePeripheral& peripheral,
     const std::string& service_id, const ByteArray& advertisement_bytes,
     bool fast_advertisement) {
-  RunOnPcpHandlerThread(
+  RunOnDiscoveryThread(
       "p2p-ble-device-discovered",
       [this, client, &peripheral, service_id, advertisement_bytes,
-       fast_advertisement]() RUN_ON_PCP_HANDLER_THREAD() {
+       fast_advertisement]() {
         // Make sure we are still discovering before proceeding.
         if (!client->IsDiscovering() || stop_.Get()) {
           NEARBY_LOGS(WARNING)
@@ -604,76 +681,101 @@ void P2pClusterPcpHandler::BlePeripheralDiscoveredHandler(
           return;
         }
 
-        auto ble_status_or = BleAdvertisement::CreateBleAdvertisement(
-            fast_advertisement, advertisement_bytes);
-        if (!ble_status_or.ok()) {
-          NEARBY_LOGS(ERROR) << ble_status_or.status().ToString();
+        // Parse in place and only materialize an owning BleAdvertisement once
+        // it is known to be one of ours; most advertisements seen while
+        // scanning are not.
+        auto view_status_or = BleAdvertisement::View::Parse(
+            fast_advertisement, advertisement_bytes.AsStringView());
+        if (!view_status_or.ok()) {
+          NEARBY_LOGS(ERROR) << view_status_or.status().ToString();
           return;
         }
-        const auto& advertisement = ble_status_or.value();
 
         // Make sure the BLE advertisement points to a valid
         // endpoint we're discovering.
-        if (!IsRecognizedBleEndpoint(service_id, advertisement)) return;
-
-        // Store all the state we need to be able to re-create a BleEndpoint
-        // in BlePeripheralLostHandler, since that isn't privy to
-        // the bytes of the ble advertisement itself.
-        found_ble_endpoints_.emplace(
-            peripheral.GetName(),
-            BleEndpointState(advertisement.GetEndpointId(),
-                             advertisement.GetEndpointInfo()));
-
-        StopEndpointLostByMediumAlarm(advertisement.GetEndpointId(), BLE);
-
-        // Report the discovered endpoint to the client.
-        NEARBY_LOGS(INFO) << "Found BleAdvertisement "
-                          << absl::BytesToHexString(advertisement_bytes.data())
-                          << " (with endpoint_id="
-                          << advertisement.GetEndpointId()
-                          << ", and endpoint_info="
-                          << absl::BytesToHexString(
-                                 advertisement.GetEndpointInfo().data())
-                          << ").";
-        OnEndpointFound(
-            client,
-            std::make_shared<BleEndpoint>(BleEndpoint{
-                {advertisement.GetEndpointId(), advertisement.GetEndpointInfo(),
-                 service_id, BLE, advertisement.GetWebRtcState()},
-                peripheral,
-            }));
-
-        // Make sure we can connect to this device via Classic Bluetooth.
-        std::string remote_bluetooth_mac_address =
-            advertisement.GetBluetoothMacAddress();
-        if (remote_bluetooth_mac_address.empty()) {
-          NEARBY_LOGS(INFO)
-              << "No Bluetooth Classic MAC address found in advertisement.";
+        if (!IsRecognizedBleEndpoint(service_id, view_status_or.value()))
           return;
-        }
 
-        BluetoothDevice remote_bluetooth_device =
-            bluetooth_medium_.GetRemoteDevice(remote_bluetooth_mac_address);
-        if (!remote_bluetooth_device.IsValid()) {
-          NEARBY_LOGS(INFO)
-              << "A valid Bluetooth device could not be derived from the MAC "
-                 "address "
-              << remote_bluetooth_mac_address;
+        std::string pending_key =
+            absl::StrCat("ble:", peripheral.GetName(),
+                         advertisement_bytes.AsStringView());
+        if (!MarkDiscoveryPending(pending_key)) {
+          NEARBY_VLOG(1) << "Dropping duplicate BleAdvertisement for "
+                         << peripheral.GetName();
           return;
         }
 
-        StopEndpointLostByMediumAlarm(advertisement.GetEndpointId(), BLUETOOTH);
-        OnEndpointFound(client,
-                        std::make_shared<BluetoothEndpoint>(BluetoothEndpoint{
-                            {
-                                advertisement.GetEndpointId(),
-                                advertisement.GetEndpointInfo(),
-                                service_id,
-                                BLUETOOTH,
-                                advertisement.GetWebRtcState(),
-                            },
-                            remote_bluetooth_device,
-                        }));
+        RunOnPcpHandlerThread(
+            "p2p-ble-device-discovered",
+            [this, client, &peripheral, service_id,
+             advertisement = BleAdvertisement(*view_status_or),
+             pending_key]() RUN_ON_PCP_HANDLER_THREAD() {
+              ClearDiscoveryPending(pending_key);
+              if (!client->IsDiscovering() || stop_.Get()) return;
+
+              // Store all the state we need to be able to re-create a
+              // BleEndpoint in BlePeripheralLostHandler, since that isn't
+              // privy to the bytes of the ble advertisement itself.
+              found_ble_endpoints_.emplace(
+                  peripheral.GetName(),
+                  BleEndpointState(advertisement.GetEndpointId(),
+                                   advertisement.GetEndpointInfo()));
+
+              StopEndpointLostByMediumAlarm(advertisement.GetEndpointId(),
+                                            BLE);
+
+              // Report the discovered endpoint to the client.
+              NEARBY_VLOG(1) << "Found BleAdvertisement for "
+                             << peripheral.GetName()
+                             << " (with endpoint_id="
+                             << advertisement.GetEndpointId()
+                             << ", and endpoint_info="
+                             << absl::BytesToHexString(
+                                    advertisement.GetEndpointInfo().data())
+                             << ").";
+              OnEndpointFound(
+                  client, std::make_shared<BleEndpoint>(BleEndpoint{
+                              {advertisement.GetEndpointId(),
+                               advertisement.GetEndpointInfo(), service_id,
+                               BLE, advertisement.GetWebRtcState()},
+                              peripheral,
+                          }));
+
+              // Make sure we can connect to this device via Classic
+              // Bluetooth.
+              std::string remote_bluetooth_mac_address =
+                  advertisement.GetBluetoothMacAddress();
+              if (remote_bluetooth_mac_address.empty()) {
+                NEARBY_VLOG(1) << "No Bluetooth Classic MAC address found in "
+                                  "advertisement.";
+                return;
+              }
+
+              BluetoothDevice remote_bluetooth_device =
+                  bluetooth_medium_.GetRemoteDevice(
+                      remote_bluetooth_mac_address);
+              if (!remote_bluetooth_device.IsValid()) {
+                NEARBY_LOGS(INFO) << "A valid Bluetooth device could not be "
+                                     "derived from the MAC address "
+                                  << remote_bluetooth_mac_address;
+                return;
+              }
+
+              StopEndpointLostByMediumAlarm(advertisement.GetEndpointId(),
+                                            BLUETOOTH);
+              OnEndpointFound(
+                  client,
+                  std::make_shared<BluetoothEndpoint>(BluetoothEndpoint{
+                      {
+                          advertisement.GetEndpointId(),
+                          advertisement.GetEndpointInfo(),
+                          service_id,
+                          BLUETOOTH,
+                          advertisement.GetWebRtcState(),
+                      },
+                      remote_bluetooth_device,
+                  }));
+            });
       });
 }
 
@@ -682,77 +784,82 @@ void P2pClusterPcpHandler::BlePeripheralLostHandler(
     const std::string& service_id) {
   std::string peripheral_name = peripheral.GetName();
   NEARBY_LOGS(INFO) << "Ble: [LOST, SCHED] peripheral_name=" << peripheral_name;
-  RunOnPcpHandlerThread(
-      "p2p-ble-device-lost",
-      [this, client, service_id, &peripheral]() RUN_ON_PCP_HANDLER_THREAD() {
-        // Make sure we are still discovering before proceeding.
-        if (!client->IsDiscovering() || stop_.Get()) {
-          NEARBY_LOGS(WARNING) << "Ignoring lost BlePeripheral  because we are "
-                                  "no longer discovering.";
-          return;
-        }
-
-        // Remove this BlePeripheral from found_ble_endpoints_, and
-        // report the endpoint as lost to the client.
-        auto item = found_ble_endpoints_.find(peripheral.GetName());
-        if (item != found_ble_endpoints_.end()) {
-          BleEndpointState ble_endpoint_state(item->second);
-          found_ble_endpoints_.erase(item);
-
-          // Report the discovered endpoint to the client.
-          NEARBY_LOGS(INFO)
-              << "Lost BleEndpoint for BlePeripheral " << peripheral.GetName()
-              << " (with endpoint_id=" << ble_endpoint_state.endpoint_id
-              << " and endpoint_info="
-              << absl::BytesToHexString(ble_endpoint_state.endpoint_info.data())
-              << ").";
-          OnEndpointLost(client, DiscoveredEndpoint{
-                                     ble_endpoint_state.endpoint_id,
-                                     ble_endpoint_state.endpoint_info,
-                                     service_id,
-                                     BLE,
-                                     WebRtcState::kUndefined,
-                                 });
-        }
+  // Nothing to parse here, but the lost event still goes through the
+  // discovery lane so that it stays ordered after any pending discovery of the
+  // same peripheral.
+  RunOnDiscoveryThread(
+      "p2p-ble-device-lost", [this, client, service_id, &peripheral]() {
+        RunOnPcpHandlerThread(
+            "p2p-ble-device-lost",
+            [this, client, service_id,
+             &peripheral]() RUN_ON_PCP_HANDLER_THREAD() {
+              // Make sure we are still discovering before proceeding.
+              if (!client->IsDiscovering() || stop_.Get()) {
+                NEARBY_LOGS(WARNING)
+                    << "Ignoring lost BlePeripheral  because we are "
+                       "no longer discovering.";
+                return;
+              }
+
+              // Remove this BlePeripheral from found_ble_endpoints_, and
+              // report the endpoint as lost to the client.
+              auto item = found_ble_endpoints_.find(peripheral.GetName());
+              if (item != found_ble_endpoints_.end()) {
+                BleEndpointState ble_endpoint_state(item->second);
+                found_ble_endpoints_.erase(item);
+
+                // Report the discovered endpoint to the client.
+                NEARBY_LOGS(INFO)
+                    << "Lost BleEndpoint for BlePeripheral "
+                    << peripheral.GetName()
+                    << " (with endpoint_id=" << ble_endpoint_state.endpoint_id
+                    << " and endpoint_info="
+                    << absl::BytesToHexString(
+                           ble_endpoint_state.endpoint_info.data())
+                    << ").";
+                OnEndpointLost(client, DiscoveredEndpoint{
+                                           ble_endpoint_state.endpoint_id,
+                                           ble_endpoint_state.endpoint_info,
+                                           service_id,
+                                           BLE,
+                                           WebRtcState::kUndefined,
+                                       });
+              }
+            });
       });
 }
 
 bool P2pClusterPcpHandler::IsRecognizedBleV2Endpoint(
-    absl::string_view service_id, const BleAdvertisement& advertisement) const {
-  if (!advertisement.IsValid()) {
-    NEARBY_LOGS(INFO)
-        << "BleAdvertisement doesn't conform to the format, discarding.";
-    return false;
-  }
-
+    absl::string_view service_id,
+    const BleAdvertisement::View& advertisement) const {
   if (advertisement.GetVersion() != kBleAdvertisementVersion) {
-    NEARBY_LOGS(INFO) << "BleAdvertisement has an unknown version; expected "
-                      << static_cast<int>(kBleAdvertisementVersion)
-                      << ", found "
-                      << static_cast<int>(advertisement.GetVersion());
+    NEARBY_VLOG(1) << "BleAdvertisement has an unknown version; expected "
+                   << static_cast<int>(kBleAdvertisementVersion) << ", found "
+                   << static_cast<int>(advertisement.GetVersion());
     return false;
   }
 
   if (advertisement.GetPcp() != GetPcp()) {
-    NEARBY_LOGS(INFO) << "BleAdvertisement doesn't match on Pcp; expected "
-                      << PcpToStrategy(GetPcp()).GetName() << ", found "
-                      << PcpToStrategy(advertisement.GetPcp()).GetName();
+    NEARBY_VLOG(1) << "BleAdvertisement doesn't match on Pcp; expected "
+                   << PcpToStrategy(GetPcp()).GetName() << ", found "
+                   << PcpToStrategy(advertisement.GetPcp()).GetName();
     return false;
   }
 
   // Check ServiceId for normal advertisement.
   // ServiceIdHash is empty for fast advertisement.
   if (!advertisement.IsFastAdvertisement()) {
-    ByteArray expected_service_id_hash = GenerateHash(
-        std::string(service_id), BleAdvertisement::kServiceIdHashLength);
+    ByteArray expected_service_id_hash =
+        GetServiceIdHash(service_id, BleAdvertisement::kServiceIdHashLength);
 
-    if (advertisement.GetServiceIdHash() != expected_service_id_hash) {
-      NEARBY_LOGS(INFO)
+    if (advertisement.GetServiceIdHash() !=
+        expected_service_id_hash.AsStringView()) {
+      NEARBY_VLOG(1)
           << "BleAdvertisement doesn't match on expected service_id_hash; "
              "expected "
-          << absl::BytesToHexString(expected_service_id_hash.data())
+          << absl::BytesToHexString(expected_service_id_hash.AsStringView())
           << ", found "
-          << absl::BytesToHexString(advertisement.GetServiceIdHash().data());
+          << absl::BytesToHexString(advertisement.GetServiceIdHash());
       return false;
     }
   }
@@ -764,10 +871,10 @@ void P2pClusterPcpHandler::BleV2PeripheralDiscoveredHandler(
     ClientProxy* client, BleV2Peripheral peripheral,
     const std::string& service_id, const ByteArray& advertisement_bytes,
     bool fast_advertisement) {
-  RunOnPcpHandlerThread(
+  RunOnDiscoveryThread(
       "p2p-ble-peripheral-discovered",
       [this, client, peripheral = std::move(peripheral), service_id,
-       advertisement_bytes, fast_advertisement]() RUN_ON_PCP_HANDLER_THREAD() {
+       advertisement_bytes, fast_advertisement]() mutable {
         // Make sure we are still discovering before proceeding.
         if (!client->IsDiscovering() || stop_.Get()) {
           NEARBY_LOGS(WARNING)
@@ -780,82 +887,109 @@ void P2pClusterPcpHandler::BleV2PeripheralDiscoveredHandler(
         if (client->GetDiscoveryOptions()
                 .fast_advertisement_service_uuid.empty() &&
             fast_advertisement) {
-          NEARBY_LOGS(INFO) << "Ignore the fast advertisement due to cient "
-                               "doesn't receive it.";
+          NEARBY_VLOG(1) << "Ignore the fast advertisement due to cient "
+                            "doesn't receive it.";
           return;
         }
 
-        auto ble_status_or = BleAdvertisement::CreateBleAdvertisement(
-            fast_advertisement, advertisement_bytes);
-        if (!ble_status_or.ok()) {
-          NEARBY_LOGS(ERROR) << ble_status_or.status();
+        auto view_status_or = BleAdvertisement::View::Parse(
+            fast_advertisement, advertisement_bytes.AsStringView());
+        if (!view_status_or.ok()) {
+          NEARBY_LOGS(ERROR) << view_status_or.status();
           return;
         }
-        const auto& advertisement = ble_status_or.value();
 
         // Make sure the BLE advertisement points to a valid
         // endpoint we're discovering.
-        if (!IsRecognizedBleV2Endpoint(service_id, advertisement)) return;
-
-        // Report the discovered endpoint to the client.
-        BleV2EndpointState ble_endpoint_state;
-        ByteArray peripheral_id = peripheral.GetId();
-        found_endpoints_in_ble_discover_cb_.insert(
-            {peripheral_id, ble_endpoint_state});
-
-        ble_endpoint_state.ble = true;
-        found_endpoints_in_ble_discover_cb_[peripheral_id] = ble_endpoint_state;
-        NEARBY_LOGS(INFO) << "Found BleAdvertisement "
-                          << absl::BytesToHexString(advertisement_bytes.data())
-                          << " (with endpoint_id="
-                          << advertisement.GetEndpointId()
-                          << ", and endpoint_info="
-                          << absl::BytesToHexString(
-                                 advertisement.GetEndpointInfo().data())
-                          << ").";
-        StopEndpointLostByMediumAlarm(advertisement.GetEndpointId(), BLE);
-        OnEndpointFound(
-            client,
-            std::make_shared<BleV2Endpoint>(BleV2Endpoint{
-                {advertisement.GetEndpointId(), advertisement.GetEndpointInfo(),
-                 service_id, BLE, advertisement.GetWebRtcState()},
-                std::move(peripheral),
-            }));
-
-        // Make sure we can connect to this device via Classic Bluetooth.
-        std::string remote_bluetooth_mac_address =
-            advertisement.GetBluetoothMacAddress();
-        if (remote_bluetooth_mac_address.empty()) {
-          NEARBY_LOGS(INFO)
-              << "No Bluetooth Classic MAC address found in advertisement.";
+        if (!IsRecognizedBleV2Endpoint(service_id, view_status_or.value()))
           return;
-        }
 
-        BluetoothDevice remote_bluetooth_device =
-            bluetooth_medium_.GetRemoteDevice(remote_bluetooth_mac_address);
-        if (!remote_bluetooth_device.IsValid()) {
-          NEARBY_LOGS(ERROR)
-              << "A valid Bluetooth device could not be derived from the MAC "
-                 "address "
-              << remote_bluetooth_mac_address;
+        // A peripheral re-advertising the same bytes while the previous
+        // sighting is still queued behind connect/accept work on the PCP
+        // handler thread adds nothing; drop it here.
+        std::string pending_key =
+            absl::StrCat("ble_v2:", peripheral.GetId().AsStringView(),
+                         advertisement_bytes.AsStringView());
+        if (!MarkDiscoveryPending(pending_key)) {
+          NEARBY_VLOG(1) << "Dropping duplicate BleAdvertisement for "
+                         << absl::BytesToHexString(peripheral.GetId().data());
           return;
         }
 
-        ble_endpoint_state.bt = true;
-        found_endpoints_in_ble_discover_cb_[peripheral_id] = ble_endpoint_state;
-        StopEndpointLostByMediumAlarm(advertisement.GetEndpointId(), BLUETOOTH);
-
-        OnEndpointFound(client,
-                        std::make_shared<BluetoothEndpoint>(BluetoothEndpoint{
-                            {
-                                advertisement.GetEndpointId(),
-                                advertisement.GetEndpointInfo(),
-                                service_id,
-                                BLUETOOTH,
-                                advertisement.GetWebRtcState(),
-                            },
-                            remote_bluetooth_device,
-                        }));
+        RunOnPcpHandlerThread(
+            "p2p-ble-peripheral-discovered",
+            [this, client, peripheral = std::move(peripheral), service_id,
+             advertisement = BleAdvertisement(*view_status_or),
+             pending_key]() RUN_ON_PCP_HANDLER_THREAD() mutable {
+              ClearDiscoveryPending(pending_key);
+              if (!client->IsDiscovering() || stop_.Get()) return;
+
+              // Report the discovered endpoint to the client.
+              BleV2EndpointState ble_endpoint_state;
+              ByteArray peripheral_id = peripheral.GetId();
+              found_endpoints_in_ble_discover_cb_.insert(
+                  {peripheral_id, ble_endpoint_state});
+
+              ble_endpoint_state.ble = true;
+              found_endpoints_in_ble_discover_cb_[peripheral_id] =
+                  ble_endpoint_state;
+              NEARBY_VLOG(1) << "Found BleAdvertisement for "
+                             << absl::BytesToHexString(peripheral_id.data())
+                             << " (with endpoint_id="
+                             << advertisement.GetEndpointId()
+                             << ", and endpoint_info="
+                             << absl::BytesToHexString(
+                                    advertisement.GetEndpointInfo().data())
+                             << ").";
+              StopEndpointLostByMediumAlarm(advertisement.GetEndpointId(),
+                                            BLE);
+              OnEndpointFound(
+                  client, std::make_shared<BleV2Endpoint>(BleV2Endpoint{
+                              {advertisement.GetEndpointId(),
+                               advertisement.GetEndpointInfo(), service_id,
+                               BLE, advertisement.GetWebRtcState()},
+                              std::move(peripheral),
+                          }));
+
+              // Make sure we can connect to this device via Classic
+              // Bluetooth.
+              std::string remote_bluetooth_mac_address =
+                  advertisement.GetBluetoothMacAddress();
+              if (remote_bluetooth_mac_address.empty()) {
+                NEARBY_VLOG(1) << "No Bluetooth Classic MAC address found in "
+                                  "advertisement.";
+                return;
+              }
+
+              BluetoothDevice remote_bluetooth_device =
+                  bluetooth_medium_.GetRemoteDevice(
+                      remote_bluetooth_mac_address);
+              if (!remote_bluetooth_device.IsValid()) {
+                NEARBY_LOGS(ERROR) << "A valid Bluetooth device could not be "
+                                      "derived from the MAC address "
+                                   << remote_bluetooth_mac_address;
+                return;
+              }
+
+              ble_endpoint_state.bt = true;
+              found_endpoints_in_ble_discover_cb_[peripheral_id] =
+                  ble_endpoint_state;
+              StopEndpointLostByMediumAlarm(advertisement.GetEndpointId(),
+                                            BLUETOOTH);
+
+              OnEndpointFound(
+                  client,
+                  std::make_shared<BluetoothEndpoint>(BluetoothEndpoint{
+                      {
+                          advertisement.GetEndpointId(),
+                          advertisement.GetEndpointInfo(),
+                          service_id,
+                          BLUETOOTH,
+                          advertisement.GetWebRtcState(),
+                      },
+                      remote_bluetooth_device,
+                  }));
+            });
       });
 }
 
@@ -864,10 +998,10 @@ void P2pClusterPcpHandler::BleV2PeripheralLostHandler(
     ClientProxy* client, BleV2Peripheral peripheral,
     const std::string& service_id, const ByteArray& advertisement_bytes,
     bool fast_advertisement) {
-  RunOnPcpHandlerThread(
+  RunOnDiscoveryThread(
       "p2p-ble-peripheral-lost",
       [this, client, service_id, peripheral = std::move(peripheral),
-       advertisement_bytes, fast_advertisement]() RUN_ON_PCP_HANDLER_THREAD() {
+       advertisement_bytes, fast_advertisement]() mutable {
         // Make sure we are still discovering before proceeding.
         if (!client->IsDiscovering() || stop_.Get()) {
           NEARBY_LOGS(WARNING)
@@ -877,62 +1011,74 @@ void P2pClusterPcpHandler::BleV2PeripheralLostHandler(
           return;
         }
 
-        auto ble_status_or = BleAdvertisement::CreateBleAdvertisement(
-            fast_advertisement, advertisement_bytes);
-        if (!ble_status_or.ok()) {
-          NEARBY_LOGS(ERROR) << ble_status_or.status();
+        auto view_status_or = BleAdvertisement::View::Parse(
+            fast_advertisement, advertisement_bytes.AsStringView());
+        if (!view_status_or.ok()) {
+          NEARBY_LOGS(ERROR) << view_status_or.status();
           return;
         }
-        const auto& advertisement = ble_status_or.value();
 
         // Make sure the BLE advertisement points to a valid
         // endpoint we're discovering.
-        if (!IsRecognizedBleV2Endpoint(service_id, advertisement)) return;
-
-        // Remove this BlePeripheral from found_ble_endpoints_, and
-        // report the endpoint as lost to the client.
-        auto const item =
-            found_endpoints_in_ble_discover_cb_.find(peripheral.GetId());
-        if (item == found_endpoints_in_ble_discover_cb_.end()) {
+        if (!IsRecognizedBleV2Endpoint(service_id, view_status_or.value()))
           return;
-        }
-        BleV2EndpointState ble_endpoint_state(item->second);
-        found_endpoints_in_ble_discover_cb_.erase(item);
 
-        if (ble_endpoint_state.ble) {
-          // Report the lost endpoint to the client.
-          NEARBY_LOGS(INFO)
-              << "Lost BleEndpoint for BlePeripheral "
-              << absl::BytesToHexString(peripheral.GetId().data())
-              << " (with endpoint_id=" << advertisement.GetEndpointId()
-              << " and endpoint_info="
-              << absl::BytesToHexString(advertisement.GetEndpointInfo().data())
-              << ").";
-          OnEndpointLost(client, DiscoveredEndpoint{
-                                     advertisement.GetEndpointId(),
-                                     advertisement.GetEndpointInfo(),
-                                     service_id,
-                                     BLE,
-                                     WebRtcState::kUndefined,
-                                 });
-        }
-        if (ble_endpoint_state.bt) {
-          // Report the lost endpoint to the client.
-          NEARBY_LOGS(INFO)
-              << "Lost BluetoothEndpoint for BlePeripheral "
-              << absl::BytesToHexString(peripheral.GetId().data())
-              << " (with endpoint_id=" << advertisement.GetEndpointId()
-              << " and endpoint_info="
-              << absl::BytesToHexString(advertisement.GetEndpointInfo().data())
-              << ").";
-          OnEndpointLost(client, DiscoveredEndpoint{
-                                     advertisement.GetEndpointId(),
-                                     advertisement.GetEndpointInfo(),
-                                     service_id,
-                                     BLUETOOTH,
-                                     WebRtcState::kUndefined,
-                                 });
-        }
+        RunOnPcpHandlerThread(
+            "p2p-ble-peripheral-lost",
+            [this, client, service_id, peripheral = std::move(peripheral),
+             advertisement = BleAdvertisement(*view_status_or)]()
+                RUN_ON_PCP_HANDLER_THREAD() {
+                  if (!client->IsDiscovering() || stop_.Get()) return;
+
+                  // Remove this BlePeripheral from found_ble_endpoints_, and
+                  // report the endpoint as lost to the client.
+                  auto const item = found_endpoints_in_ble_discover_cb_.find(
+                      peripheral.GetId());
+                  if (item == found_endpoints_in_ble_discover_cb_.end()) {
+                    return;
+                  }
+                  BleV2EndpointState ble_endpoint_state(item->second);
+                  found_endpoints_in_ble_discover_cb_.erase(item);
+
+                  if (ble_endpoint_state.ble) {
+                    // Report the lost endpoint to the client.
+                    NEARBY_LOGS(INFO)
+                        << "Lost BleEndpoint for BlePeripheral "
+                        << absl::BytesToHexString(peripheral.GetId().data())
+                        << " (with endpoint_id="
+                        << advertisement.GetEndpointId()
+                        << " and endpoint_info="
+                        << absl::BytesToHexString(
+                               advertisement.GetEndpointInfo().data())
+                        << ").";
+                    OnEndpointLost(client, DiscoveredEndpoint{
+                                               advertisement.GetEndpointId(),
+                                               advertisement.GetEndpointInfo(),
+                                               service_id,
+                                               BLE,
+                                               WebRtcState::kUndefined,
+                                           });
+                  }
+                  if (ble_endpoint_state.bt) {
+                    // Report the lost endpoint to the client.
+                    NEARBY_LOGS(INFO)
+                        << "Lost BluetoothEndpoint for BlePeripheral "
+                        << absl::BytesToHexString(peripheral.GetId().data())
+                        << " (with endpoint_id="
+                        << advertisement.GetEndpointId()
+                        << " and endpoint_info="
+                        << absl::BytesToHexString(
+                               advertisement.GetEndpointInfo().data())
+                        << ").";
+                    OnEndpointLost(client, DiscoveredEndpoint{
+                                               advertisement.GetEndpointId(),
+                                               advertisement.GetEndpointInfo(),
+                                               service_id,
+                                               BLUETOOTH,
+                                               WebRtcState::kUndefined,
+                                           });
+                  }
+                });
       });
 }
 
@@ -940,10 +1086,10 @@ void P2pClusterPcpHandler::BleV2InstantLostHandler(
     ClientProxy* client, BleV2Peripheral peripheral,
     const std::string& service_id, const ByteArray& advertisement_bytes,
     bool fast_advertisement) {
-  RunOnPcpHandlerThread(
+  RunOnDiscoveryThread(
       "p2p-ble-peripheral-instant-lost",
       [this, client, service_id, peripheral = std::move(peripheral),
-       advertisement_bytes, fast_advertisement]() RUN_ON_PCP_HANDLER_THREAD() {
+       advertisement_bytes, fast_advertisement]() mutable {
         std::string service_id = client->GetDiscoveryServiceId();
 
         if (!client->IsDiscovering() || stop_.Get()) {
@@ -956,31 +1102,39 @@ void P2pClusterPcpHandler::BleV2InstantLostHandler(
 
         NEARBY_LOGS(INFO) << "Processing instant lost on BlePeripheral "
                           << absl::BytesToHexString(peripheral.GetId().data());
-        auto ble_status_or = BleAdvertisement::CreateBleAdvertisement(
-            fast_advertisement, advertisement_bytes);
-        if (!ble_status_or.ok()) {
-          NEARBY_LOGS(ERROR) << ble_status_or.status();
+        auto view_status_or = BleAdvertisement::View::Parse(
+            fast_advertisement, advertisement_bytes.AsStringView());
+        if (!view_status_or.ok()) {
+          NEARBY_LOGS(ERROR) << view_status_or.status();
           return;
         }
-        const auto& advertisement = ble_status_or.value();
 
         // Make sure the BLE advertisement points to a valid
         // endpoint we're discovering.
-        if (!IsRecognizedBleV2Endpoint(service_id, advertisement)) return;
-
-        // Remove this BlePeripheral from found_ble_endpoints_, and
-        // report the endpoint as lost to the client.
-        auto const item =
-            found_endpoints_in_ble_discover_cb_.find(peripheral.GetId());
-        if (item == found_endpoints_in_ble_discover_cb_.end()) {
+        if (!IsRecognizedBleV2Endpoint(service_id, view_status_or.value()))
           return;
-        }
-
-        found_endpoints_in_ble_discover_cb_.erase(item);
 
-        // Report the instant lost endpoint.
-        OnInstantLost(client, advertisement.GetEndpointId(),
-                      advertisement.GetEndpointInfo());
+        RunOnPcpHandlerThread(
+            "p2p-ble-peripheral-instant-lost",
+            [this, client, peripheral = std::move(peripheral),
+             advertisement = BleAdvertisement(*view_status_or)]()
+                RUN_ON_PCP_HANDLER_THREAD() {
+                  if (!client->IsDiscovering() || stop_.Get()) return;
+
+                  // Remove this BlePeripheral from found_ble_endpoints_, and
+                  // report the endpoint as lost to the client.
+                  auto const item = found_endpoints_in_ble_discover_cb_.find(
+                      peripheral.GetId());
+                  if (item == found_endpoints_in_ble_discover_cb_.end()) {
+                    return;
+                  }
+
+                  found_endpoints_in_ble_discover_cb_.erase(item);
+
+                  // Report the instant lost endpoint.
+                  OnInstantLost(client, advertisement.GetEndpointId(),
+                                advertisement.GetEndpointInfo());
+                });
       });
 }
 
@@ -1026,24 +1180,23 @@ bool P2pClusterPcpHandler::IsRecognizedWifiLanEndpoint(
     const std::string& service_id,
     const WifiLanServiceInfo& wifi_lan_service_info) const {
   if (!wifi_lan_service_info.IsValid()) {
-    NEARBY_LOGS(INFO)
+    NEARBY_VLOG(1)
         << "WifiLanServiceInfo doesn't conform to the format, discarding.";
     return false;
   }
 
   if (wifi_lan_service_info.GetPcp() != GetPcp()) {
-    NEARBY_LOGS(INFO)
-        << "WifiLanServiceInfo doesn't match on Pcp; expected "
-        << PcpToStrategy(GetPcp()).GetName() << ", found "
-        << PcpToStrategy(wifi_lan_service_info.GetPcp()).GetName();
+    NEARBY_VLOG(1) << "WifiLanServiceInfo doesn't match on Pcp; expected "
+                   << PcpToStrategy(GetPcp()).GetName() << ", found "
+                   << PcpToStrategy(wifi_lan_service_info.GetPcp()).GetName();
     return false;
   }
 
   ByteArray expected_service_id_hash =
-      GenerateHash(service_id, WifiLanServiceInfo::kServiceIdHashLength);
+      GetServiceIdHash(service_id, WifiLanServiceInfo::kServiceIdHashLength);
 
   if (wifi_lan_service_info.GetServiceIdHash() != expected_service_id_hash) {
-    NEARBY_LOGS(INFO)
+    NEARBY_VLOG(1)
         << "WifiLanServiceInfo doesn't match on expected service_id_hash; "
            "expected "
         << absl::BytesToHexString(expected_service_id_hash.data()) << ", found "
@@ -1058,9 +1211,9 @@ bool P2pClusterPcpHandler::IsRecognizedWifiLanEndpoint(
 void P2pClusterPcpHandler::WifiLanServiceDiscoveredHandler(
     ClientProxy* client, NsdServiceInfo service_info,
     const std::string& service_id) {
-  RunOnPcpHandlerThread(
-      "p2p-wifi-service-discovered",
-      [this, client, service_id, service_info]() RUN_ON_PCP_HANDLER_THREAD() {
+  RunOnDiscoveryThread(
+      "p2p-wifi-service-discovered", [this, client, service_id,
+                                      service_info]() {
         // Make sure we are still discovering before proceeding.
         if (!client->IsDiscovering()) {
           NEARBY_LOGS(WARNING) << "Skipping discovery of NsdServiceInfo "
@@ -1069,36 +1222,62 @@ void P2pClusterPcpHandler::WifiLanServiceDiscoveredHandler(
           return;
         }
 
-        // Parse the WifiLanServiceInfo.
-        WifiLanServiceInfo wifi_lan_service_info(service_info);
+        // Parse the WifiLanServiceInfo, unless this is a re-announcement of
+        // a service that was already handled.
+        WifiLanServiceInfoCache::Result cached =
+            wifi_lan_service_info_cache_.Update(service_id, service_info);
+        if (cached.is_reannouncement) {
+          NEARBY_VLOG(1) << "Ignoring unchanged NsdServiceInfo "
+                         << service_info.GetServiceName();
+          return;
+        }
+        const WifiLanServiceInfo& wifi_lan_service_info = cached.service_info;
         // Make sure the WifiLan service name points to a valid
         // endpoint we're discovering.
         if (!IsRecognizedWifiLanEndpoint(service_id, wifi_lan_service_info)) {
           return;
         }
 
-        // Report the discovered endpoint to the client.
-        NEARBY_LOGS(INFO) << "Found NsdServiceInfo "
-                          << service_info.GetServiceName()
-                          << " (with endpoint_id="
-                          << wifi_lan_service_info.GetEndpointId()
-                          << "and endpoint_info="
-                          << absl::BytesToHexString(
-                                 wifi_lan_service_info.GetEndpointInfo().data())
-                          << ").";
-        StopEndpointLostByMediumAlarm(wifi_lan_service_info.GetEndpointId(),
-                                      WIFI_LAN);
-        OnEndpointFound(client,
-                        std::make_shared<WifiLanEndpoint>(WifiLanEndpoint{
-                            {
-                                wifi_lan_service_info.GetEndpointId(),
-                                wifi_lan_service_info.GetEndpointInfo(),
-                                service_id,
-                                WIFI_LAN,
-                                wifi_lan_service_info.GetWebRtcState(),
-                            },
-                            service_info,
-                        }));
+        std::string pending_key = absl::StrCat(
+            "wifi_lan:", service_info.GetServiceName(), ":",
+            service_info.GetIPAddress(), ":", service_info.GetPort());
+        if (!MarkDiscoveryPending(pending_key)) {
+          NEARBY_VLOG(1) << "Dropping duplicate NsdServiceInfo "
+                         << service_info.GetServiceName();
+          return;
+        }
+
+        RunOnPcpHandlerThread(
+            "p2p-wifi-service-discovered",
+            [this, client, service_id, service_info, wifi_lan_service_info,
+             pending_key]() RUN_ON_PCP_HANDLER_THREAD() {
+              ClearDiscoveryPending(pending_key);
+              if (!client->IsDiscovering()) return;
+
+              // Report the discovered endpoint to the client.
+              NEARBY_VLOG(1) << "Found NsdServiceInfo "
+                             << service_info.GetServiceName()
+                             << " (with endpoint_id="
+                             << wifi_lan_service_info.GetEndpointId()
+                             << "and endpoint_info="
+                             << absl::BytesToHexString(
+                                    wifi_lan_service_info.GetEndpointInfo()
+                                        .data())
+                             << ").";
+              StopEndpointLostByMediumAlarm(
+                  wifi_lan_service_info.GetEndpointId(), WIFI_LAN);
+              OnEndpointFound(
+                  client, std::make_shared<WifiLanEndpoint>(WifiLanEndpoint{
+                              {
+                                  wifi_lan_service_info.GetEndpointId(),
+                                  wifi_lan_service_info.GetEndpointInfo(),
+                                  service_id,
+                                  WIFI_LAN,
+                                  wifi_lan_service_info.GetWebRtcState(),
+                              },
+                              service_info,
+                          }));
+            });
       });
 }
 
@@ -1107,9 +1286,8 @@ void P2pClusterPcpHandler::WifiLanServiceLostHandler(
     const std::string& service_id) {
   NEARBY_LOGS(INFO) << "WifiLan: [LOST, SCHED] service_info=" << &service_info
                     << ", service_name=" << service_info.GetServiceName();
-  RunOnPcpHandlerThread(
-      "p2p-wifi-service-lost",
-      [this, client, service_id, service_info]() RUN_ON_PCP_HANDLER_THREAD() {
+  RunOnDiscoveryThread(
+      "p2p-wifi-service-lost", [this, client, service_id, service_info]() {
         // Make sure we are still discovering before proceeding.
         if (!client->IsDiscovering()) {
           NEARBY_LOGS(WARNING) << "Ignoring lost NsdServiceInfo "
@@ -1118,6 +1296,8 @@ void P2pClusterPcpHandler::WifiLanServiceLostHandler(
                                   "discovering.";
           return;
         }
+        wifi_lan_service_info_cache_.Remove(service_id,
+                                            service_info.GetServiceName());
 
         // Parse the WifiLanServiceInfo.
         WifiLanServiceInfo wifi_lan_service_info(service_info);
@@ -1127,22 +1307,30 @@ void P2pClusterPcpHandler::WifiLanServiceLostHandler(
         if (!IsRecognizedWifiLanEndpoint(service_id, wifi_lan_service_info))
           return;
 
-        // Report the lost endpoint to the client.
-        NEARBY_LOGS(INFO) << "Lost NsdServiceInfo "
-                          << service_info.GetServiceName()
-                          << " (with endpoint_id="
-                          << wifi_lan_service_info.GetEndpointId()
-                          << " and endpoint_info="
-                          << absl::BytesToHexString(
-                                 wifi_lan_service_info.GetEndpointInfo().data())
-                          << ").";
-        OnEndpointLost(client, DiscoveredEndpoint{
-                                   wifi_lan_service_info.GetEndpointId(),
-                                   wifi_lan_service_info.GetEndpointInfo(),
-                                   service_id,
-                                   WIFI_LAN,
-                                   WebRtcState::kUndefined,
-                               });
+        RunOnPcpHandlerThread(
+            "p2p-wifi-service-lost",
+            [this, client, service_id, service_info,
+             wifi_lan_service_info]() RUN_ON_PCP_HANDLER_THREAD() {
+              if (!client->IsDiscovering()) return;
+
+              // Report the lost endpoint to the client.
+              NEARBY_LOGS(INFO)
+                  << "Lost NsdServiceInfo " << service_info.GetServiceName()
+                  << " (with endpoint_id="
+                  << wifi_lan_service_info.GetEndpointId()
+                  << " and endpoint_info="
+                  << absl::BytesToHexString(
+                         wifi_lan_service_info.GetEndpointInfo().data())
+                  << ").";
+              OnEndpointLost(client,
+                             DiscoveredEndpoint{
+                                 wifi_lan_service_info.GetEndpointId(),
+                                 wifi_lan_service_info.GetEndpointInfo(),
+                                 service_id,
+                                 WIFI_LAN,
+                                 WebRtcState::kUndefined,
+                             });
+            });
       });
 }
 
@@ -1304,10 +1492,17 @@ Status P2pClusterPcpHandler::InjectEndpointImpl(
     ClientProxy* client, const std::string& service_id,
     const OutOfBandConnectionMetadata& metadata) {
   NEARBY_LOGS(INFO) << "InjectEndpoint.";
-  // Bluetooth is the only supported out-of-band connection medium.
-  if (metadata.medium != BLUETOOTH) {
-    NEARBY_LOGS(WARNING) << "InjectEndpointImpl: Only Bluetooth is supported.";
-    return {Status::kError};
+  switch (metadata.medium) {
+    case BLUETOOTH:
+      break;
+    case WIFI_LAN:
+      return InjectWifiLanEndpoint(client, service_id, metadata);
+    case BLE:
+      return InjectBleV2Endpoint(client, service_id, metadata);
+    default:
+      NEARBY_LOGS(WARNING) << "InjectEndpointImpl: Only Bluetooth, WifiLan "
+                              "and BLE are supported.";
+      return {Status::kError};
   }
 
   BluetoothDevice remote_bluetooth_device =
@@ -2670,6 +2865,49 @@ ErrorOr<Medium> P2pClusterPcpHandler::StartBleV2Scanning(
   return {Error(ble_v2_result.error().operation_result_code().value())};
 }
 
+Status P2pClusterPcpHandler::InjectBleV2Endpoint(
+    ClientProxy* client, const std::string& service_id,
+    const OutOfBandConnectionMetadata& metadata) {
+  if (!NearbyFlags::GetInstance().GetBoolFlag(
+          config_package_nearby::nearby_connections_feature::kEnableBleV2)) {
+    NEARBY_LOGS(WARNING) << "InjectEndpointImpl: BLE requires BLE v2.";
+    return {Status::kError};
+  }
+  std::string mac_address =
+      BluetoothUtils::ToString(metadata.remote_ble_mac_address);
+  if (mac_address.empty() ||
+      metadata.endpoint_id.size() != BleAdvertisement::kEndpointIdLength ||
+      metadata.endpoint_info.Empty() ||
+      metadata.endpoint_info.size() >
+          BleAdvertisement::kMaxEndpointInfoLength ||
+      metadata.remote_ble_psm < 0) {
+    NEARBY_LOGS(WARNING) << "InjectEndpointImpl: Invalid parameters.";
+    return {Status::kError};
+  }
+
+  BleV2Peripheral peripheral = ble_v2_medium_.GetRemotePeripheral(mac_address);
+  if (!peripheral.IsValid()) {
+    NEARBY_LOGS(WARNING) << "InjectEndpointImpl: Unknown BLE peripheral "
+                         << mac_address;
+    return {Status::kError};
+  }
+  // There is no advertisement to identify the peripheral by, so use its MAC
+  // address instead.
+  peripheral.SetId(metadata.remote_ble_mac_address);
+  peripheral.SetPsm(metadata.remote_ble_psm);
+
+  if (!client->IsDiscovering()) {
+    NEARBY_LOGS(WARNING) << "InjectEndpointImpl: Not discovering.";
+    return {Status::kError};
+  }
+  OnEndpointFound(client, std::make_shared<BleV2Endpoint>(BleV2Endpoint{
+                              {metadata.endpoint_id, metadata.endpoint_info,
+                               service_id, BLE, WebRtcState::kConnectable},
+                              std::move(peripheral),
+                          }));
+  return {Status::kSuccess};
+}
+
 BasePcpHandler::ConnectImplResult P2pClusterPcpHandler::BleV2ConnectImpl(
     ClientProxy* client, BleV2Endpoint* endpoint) {
   NEARBY_VLOG(1) << "Client " << client->GetClientId()
@@ -2765,7 +3003,7 @@ ErrorOr<Medium> P2pClusterPcpHandler::StartWifiLanAdvertising(
   // Generate a WifiLanServiceInfo with which to become WifiLan discoverable.
   // TODO(b/169550050): Implement UWBAddress.
   const ByteArray service_id_hash =
-      GenerateHash(service_id, WifiLanServiceInfo::kServiceIdHashLength);
+      GetServiceIdHash(service_id, WifiLanServiceInfo::kServiceIdHashLength);
   WifiLanServiceInfo service_info{kWifiLanServiceInfoVersion,
                                   GetPcp(),
                                   local_endpoint_id,
@@ -2819,6 +3057,8 @@ ErrorOr<Medium> P2pClusterPcpHandler::StartWifiLanAdvertising(
 
 ErrorOr<Medium> P2pClusterPcpHandler::StartWifiLanDiscovery(
     ClientProxy* client, const std::string& service_id) {
+  // Services found by an earlier discovery are reported again.
+  wifi_lan_service_info_cache_.Clear(service_id);
   ErrorOr<bool> result = wifi_lan_medium_.StartDiscovery(
       service_id,
       {
@@ -2843,6 +3083,47 @@ ErrorOr<Medium> P2pClusterPcpHandler::StartWifiLanDiscovery(
   }
 }
 
+Status P2pClusterPcpHandler::InjectWifiLanEndpoint(
+    ClientProxy* client, const std::string& service_id,
+    const OutOfBandConnectionMetadata& metadata) {
+  const std::string& ip_address = metadata.remote_wifi_lan_ip_address;
+  if ((ip_address.size() != 4 && ip_address.size() != 16) ||
+      metadata.remote_wifi_lan_port <= 0 ||
+      metadata.remote_wifi_lan_port > 65535 || metadata.endpoint_info.Empty()) {
+    NEARBY_LOGS(WARNING) << "InjectEndpointImpl: Invalid parameters.";
+    return {Status::kError};
+  }
+
+  // Build the service info that the remote device would have advertised over
+  // mDNS, so that the endpoint connects exactly like a discovered one.
+  WifiLanServiceInfo wifi_lan_service_info(
+      WifiLanServiceInfo::Version::kV1, GetPcp(), metadata.endpoint_id,
+      GetServiceIdHash(service_id, WifiLanServiceInfo::kServiceIdHashLength),
+      metadata.endpoint_info, /*uwb_address=*/ByteArray(),
+      WebRtcState::kConnectable);
+  // Note: WifiLanServiceInfo internally verifies that |endpoint_id| and
+  // |endpoint_info| are valid; the check below will fail if they are
+  // malformed.
+  if (!wifi_lan_service_info.IsValid()) {
+    NEARBY_LOGS(WARNING) << "InjectEndpointImpl: Invalid parameters.";
+    return {Status::kError};
+  }
+  NsdServiceInfo service_info(wifi_lan_service_info);
+  service_info.SetIPAddress(ip_address);
+  service_info.SetPort(metadata.remote_wifi_lan_port);
+
+  if (!client->IsDiscovering()) {
+    NEARBY_LOGS(WARNING) << "InjectEndpointImpl: Not discovering.";
+    return {Status::kError};
+  }
+  OnEndpointFound(client, std::make_shared<WifiLanEndpoint>(WifiLanEndpoint{
+                              {metadata.endpoint_id, metadata.endpoint_info,
+                               service_id, WIFI_LAN, WebRtcState::kConnectable},
+                              service_info,
+                          }));
+  return {Status::kSuccess};
+}
+
 BasePcpHandler::ConnectImplResult P2pClusterPcpHandler::WifiLanConnectImpl(
     ClientProxy* client, WifiLanEndpoint* endpoint) {
   NEARBY_LOGS(INFO) << "Client " << client->GetClientId()
@@ -18,9 +18,12 @@
 #include <cstddef>
 #include <cstdint>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
 #include "absl/strings/string_view.h"
 #include "connections/advertising_options.h"
 #include "connections/discovery_options.h"
@@ -60,8 +63,12 @@
 #endif
 #include "connections/implementation/pcp.h"
 #include "connections/implementation/wifi_lan_service_info.h"
+#include "connections/implementation/wifi_lan_service_info_cache.h"
 #include "internal/platform/byte_array.h"
 #include "internal/platform/expected.h"
+#include "internal/platform/mutex.h"
+#include "internal/platform/runnable.h"
+#include "internal/platform/single_thread_executor.h"
 
 namespace nearby {
 namespace connections {
@@ -82,6 +89,11 @@ class P2pClusterPcpHandler : public BasePcpHandler {
       Pcp pcp = Pcp::kP2pCluster);
   ~P2pClusterPcpHandler() override;
 
+  // Returns the number of discoveries that the discovery lane recognized and
+  // that wait for the PCP handler thread.
+  size_t GetPendingDiscoveryCountForTesting()
+      ABSL_LOCKS_EXCLUDED(pending_discoveries_mutex_);
+
  protected:
   std::vector<location::nearby::proto::connections::Medium>
   GetConnectionMediumsByPriority() override;
@@ -175,6 +187,25 @@ class P2pClusterPcpHandler : public BasePcpHandler {
       WifiLanServiceInfo::Version::kV1;
 
   static ByteArray GenerateHash(const std::string& source, size_t size);
+
+  // Medium discovery callbacks parse and filter advertisements on a dedicated
+  // discovery lane, so that scan results don't queue up behind connect and
+  // accept work on the PCP handler thread. Only recognized endpoints are
+  // forwarded to the PCP handler thread.
+  void RunOnDiscoveryThread(const std::string& name, Runnable runnable);
+
+  // Same as GenerateHash(service_id, size), but computed at most once for
+  // each (service_id, size) pair. Safe to call from any thread.
+  ByteArray GetServiceIdHash(absl::string_view service_id, size_t size) const
+      ABSL_LOCKS_EXCLUDED(service_id_hash_mutex_);
+
+  // Records that a discovery identified by `key` has been forwarded to the
+  // PCP handler thread. Returns false if an identical discovery is already
+  // waiting there, in which case the caller should drop its copy.
+  bool MarkDiscoveryPending(const std::string& key)
+      ABSL_LOCKS_EXCLUDED(pending_discoveries_mutex_);
+  void ClearDiscoveryPending(const std::string& key)
+      ABSL_LOCKS_EXCLUDED(pending_discoveries_mutex_);
   static bool ShouldAdvertiseBluetoothMacOverBle(PowerLevel power_level);
   static bool ShouldAcceptBluetoothConnections(
       const AdvertisingOptions& advertising_options);
@@ -216,8 +247,9 @@ class P2pClusterPcpHandler : public BasePcpHandler {
       ClientProxy* client, BluetoothEndpoint* endpoint);
 
   // Ble
-  bool IsRecognizedBleEndpoint(const std::string& service_id,
-                               const BleAdvertisement& advertisement) const;
+  bool IsRecognizedBleEndpoint(
+      const std::string& service_id,
+      const BleAdvertisement::View& advertisement) const;
   void BlePeripheralDiscoveredHandler(ClientProxy* client,
                                       BlePeripheral& peripheral,
                                       const std::string& service_id,
@@ -242,8 +274,9 @@ class P2pClusterPcpHandler : public BasePcpHandler {
                                                    BleEndpoint* endpoint);
 
   // BleV2
-  bool IsRecognizedBleV2Endpoint(absl::string_view service_id,
-                                 const BleAdvertisement& advertisement) const;
+  bool IsRecognizedBleV2Endpoint(
+      absl::string_view service_id,
+      const BleAdvertisement::View& advertisement) const;
   void BleV2PeripheralDiscoveredHandler(ClientProxy* client,
                                         BleV2Peripheral peripheral,
                                         const std::string& service_id,
@@ -275,6 +308,8 @@ class P2pClusterPcpHandler : public BasePcpHandler {
       const DiscoveryOptions& discovery_options);
   BasePcpHandler::ConnectImplResult BleV2ConnectImpl(ClientProxy* client,
                                                      BleV2Endpoint* endpoint);
+  Status InjectBleV2Endpoint(ClientProxy* client, const std::string& service_id,
+                             const OutOfBandConnectionMetadata& metadata);
 
   // WifiLan
   bool IsRecognizedWifiLanEndpoint(
@@ -300,6 +335,9 @@ class P2pClusterPcpHandler : public BasePcpHandler {
       ClientProxy* client, const std::string& service_id);
   BasePcpHandler::ConnectImplResult WifiLanConnectImpl(
       ClientProxy* client, WifiLanEndpoint* endpoint);
+  Status InjectWifiLanEndpoint(ClientProxy* client,
+                               const std::string& service_id,
+                               const OutOfBandConnectionMetadata& metadata);
 
   BluetoothRadio& bluetooth_radio_;
   BluetoothClassic& bluetooth_medium_;
@@ -326,6 +364,23 @@ class P2pClusterPcpHandler : public BasePcpHandler {
   // Maps service id to its client.
   absl::flat_hash_map<std::string, ClientProxy*>
       paused_bluetooth_clients_discoveries_;
+
+  // Service ID hashes keyed by (service_id, hash length).
+  mutable Mutex service_id_hash_mutex_;
+  mutable absl::flat_hash_map<std::pair<std::string, size_t>, ByteArray>
+      service_id_hashes_ ABSL_GUARDED_BY(service_id_hash_mutex_);
+
+  // Discoveries that passed the discovery lane and are waiting to be processed
+  // on the PCP handler thread.
+  Mutex pending_discoveries_mutex_;
+  absl::flat_hash_set<std::string> pending_discoveries_
+      ABSL_GUARDED_BY(pending_discoveries_mutex_);
+
+  // WifiLanServiceInfo of the services found while discovering, to skip the
+  // re-announcements of unchanged services.
+  WifiLanServiceInfoCache wifi_lan_service_info_cache_;
+
+  SingleThreadExecutor discovery_executor_;
 };
 
 }  // namespace connections
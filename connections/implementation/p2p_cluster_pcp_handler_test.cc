@@ -17,6 +17,7 @@
 #include <cstdint>
 #include <string>
 #include <tuple>
+#include <utility>
 
 #include "gtest/gtest.h"
 #include "absl/time/clock.h"
@@ -39,6 +40,7 @@
 #include "connections/strategy.h"
 #include "connections/v3/connection_listening_options.h"
 #include "internal/flags/nearby_flags.h"
+#include "internal/platform/bluetooth_utils.h"
 #include "internal/platform/byte_array.h"
 #include "internal/platform/count_down_latch.h"
 #include "internal/platform/logging.h"
@@ -77,6 +79,14 @@ constexpr BooleanMediumSelector kTestCases[] = {
     },
 };
 
+// Exposes the PCP handler thread so tests can keep it busy, the way a
+// connection attempt in flight does.
+class BusyP2pClusterPcpHandler : public P2pClusterPcpHandler {
+ public:
+  using P2pClusterPcpHandler::P2pClusterPcpHandler;
+  using P2pClusterPcpHandler::RunOnPcpHandlerThread;
+};
+
 class P2pClusterPcpHandlerTest : public testing::Test {
  protected:
   void SetUp() override {
@@ -231,6 +241,184 @@ TEST_F(P2pClusterPcpHandlerTest,
   env_.Stop();
 }
 
+TEST_F(P2pClusterPcpHandlerTest, CanConnectToInjectedWifiLanEndpoint) {
+  env_.Start();
+  Mediums mediums_a;
+  Mediums mediums_b;
+  EndpointChannelManager ecm_a;
+  EndpointChannelManager ecm_b;
+  EndpointManager em_a(&ecm_a);
+  EndpointManager em_b(&ecm_b);
+  BwuManager bwu_a(mediums_a, em_a, ecm_a, {}, {});
+  BwuManager bwu_b(mediums_b, em_b, ecm_b, {}, {});
+  InjectedBluetoothDeviceStore ibds_a;
+  InjectedBluetoothDeviceStore ibds_b;
+  P2pClusterPcpHandler handler_a(&mediums_a, &em_a, &ecm_a, &bwu_a, ibds_a);
+  P2pClusterPcpHandler handler_b(&mediums_b, &em_b, &ecm_b, &bwu_b, ibds_b);
+  CountDownLatch found_latch(1);
+  CountDownLatch connect_latch(1);
+  absl::Time connected_at;
+  ASSERT_EQ(handler_a.StartAdvertising(
+                &client_a_, service_id_,
+                AdvertisingOptions{{Strategy::kP2pCluster,
+                                    BooleanMediumSelector{.wifi_lan = true}}},
+                {.endpoint_info = ByteArray{"endpoint_name"}}),
+            Status{Status::kSuccess});
+  std::pair<std::string, int> credentials =
+      mediums_a.GetWifiLan().GetCredentials(service_id_);
+  // Discovery only has to be running to receive the injected endpoint; it
+  // never finds Wi-Fi LAN advertisements here.
+  ASSERT_EQ(handler_b.StartDiscovery(
+                &client_b_, service_id_, GetBluetoothOnlyDiscoveryOptions(),
+                {.endpoint_found_cb =
+                     [&found_latch](const std::string& endpoint_id,
+                                    const ByteArray& endpoint_info,
+                                    const std::string& service_id) {
+                       found_latch.CountDown();
+                     }}),
+            Status{Status::kSuccess});
+
+  absl::Time injected_at = absl::Now();
+  handler_b.InjectEndpoint(&client_b_, service_id_,
+                           {.medium = Medium::WIFI_LAN,
+                            .endpoint_id = client_a_.GetLocalEndpointId(),
+                            .endpoint_info = ByteArray{"endpoint_name"},
+                            .remote_wifi_lan_ip_address = credentials.first,
+                            .remote_wifi_lan_port = credentials.second});
+  ASSERT_TRUE(found_latch.Await(absl::Milliseconds(1000)).result());
+  client_b_.AddCancellationFlag(client_a_.GetLocalEndpointId());
+  handler_b.RequestConnection(
+      &client_b_, client_a_.GetLocalEndpointId(),
+      {.endpoint_info = ByteArray{"endpoint_name"},
+       .listener = {.initiated_cb =
+                        [&](const std::string& endpoint_id,
+                            const ConnectionResponseInfo& info) {
+                          connected_at = absl::Now();
+                          connect_latch.CountDown();
+                        }}},
+      ConnectionOptions{{Strategy::kP2pCluster,
+                         BooleanMediumSelector{.wifi_lan = true}}});
+
+  ASSERT_TRUE(connect_latch.Await(absl::Milliseconds(1000)).result());
+  NEARBY_LOGS(INFO) << "Time to connect to injected Wi-Fi LAN endpoint: "
+                    << absl::FormatDuration(connected_at - injected_at);
+  EXPECT_LT(connected_at - injected_at, absl::Milliseconds(500));
+  handler_b.StopDiscovery(&client_b_);
+  handler_a.StopAdvertising(&client_a_);
+  bwu_a.Shutdown();
+  bwu_b.Shutdown();
+  env_.Stop();
+}
+
+TEST_F(P2pClusterPcpHandlerTest, CanConnectToInjectedBleEndpoint) {
+  env_.Start();
+  Mediums mediums_a;
+  Mediums mediums_b;
+  EndpointChannelManager ecm_a;
+  EndpointChannelManager ecm_b;
+  EndpointManager em_a(&ecm_a);
+  EndpointManager em_b(&ecm_b);
+  BwuManager bwu_a(mediums_a, em_a, ecm_a, {}, {});
+  BwuManager bwu_b(mediums_b, em_b, ecm_b, {}, {});
+  InjectedBluetoothDeviceStore ibds_a;
+  InjectedBluetoothDeviceStore ibds_b;
+  P2pClusterPcpHandler handler_a(&mediums_a, &em_a, &ecm_a, &bwu_a, ibds_a);
+  P2pClusterPcpHandler handler_b(&mediums_b, &em_b, &ecm_b, &bwu_b, ibds_b);
+  CountDownLatch found_latch(1);
+  CountDownLatch connect_latch(1);
+  absl::Time connected_at;
+  ASSERT_EQ(handler_a.StartAdvertising(
+                &client_a_, service_id_,
+                AdvertisingOptions{{Strategy::kP2pCluster,
+                                    BooleanMediumSelector{.ble = true}}},
+                {.endpoint_info = ByteArray{"endpoint_name"}}),
+            Status{Status::kSuccess});
+  // Discovery only has to be running to receive the injected endpoint; it
+  // never finds BLE advertisements here.
+  ASSERT_EQ(handler_b.StartDiscovery(
+                &client_b_, service_id_, GetBluetoothOnlyDiscoveryOptions(),
+                {.endpoint_found_cb =
+                     [&found_latch](const std::string& endpoint_id,
+                                    const ByteArray& endpoint_info,
+                                    const std::string& service_id) {
+                       found_latch.CountDown();
+                     }}),
+            Status{Status::kSuccess});
+
+  ByteArray mac_address_a = BluetoothUtils::FromString(
+      mediums_a.GetBluetoothRadio().GetBluetoothAdapter().GetMacAddress());
+
+  absl::Time injected_at = absl::Now();
+  handler_b.InjectEndpoint(&client_b_, service_id_,
+                           {.medium = Medium::BLE,
+                            .endpoint_id = client_a_.GetLocalEndpointId(),
+                            .endpoint_info = ByteArray{"endpoint_name"},
+                            .remote_ble_mac_address = mac_address_a});
+  ASSERT_TRUE(found_latch.Await(absl::Milliseconds(1000)).result());
+  client_b_.AddCancellationFlag(client_a_.GetLocalEndpointId());
+  handler_b.RequestConnection(
+      &client_b_, client_a_.GetLocalEndpointId(),
+      {.endpoint_info = ByteArray{"endpoint_name"},
+       .listener = {.initiated_cb =
+                        [&](const std::string& endpoint_id,
+                            const ConnectionResponseInfo& info) {
+                          connected_at = absl::Now();
+                          connect_latch.CountDown();
+                        }}},
+      ConnectionOptions{{Strategy::kP2pCluster,
+                         BooleanMediumSelector{.ble = true}}});
+
+  ASSERT_TRUE(connect_latch.Await(absl::Milliseconds(1000)).result());
+  NEARBY_LOGS(INFO) << "Time to connect to injected BLE endpoint: "
+                    << absl::FormatDuration(connected_at - injected_at);
+  EXPECT_LT(connected_at - injected_at, absl::Milliseconds(500));
+  handler_b.StopDiscovery(&client_b_);
+  handler_a.StopAdvertising(&client_a_);
+  bwu_a.Shutdown();
+  bwu_b.Shutdown();
+  env_.Stop();
+}
+
+TEST_F(P2pClusterPcpHandlerTest, InjectEndpointRejectsInvalidWifiLanMetadata) {
+  env_.Start();
+  Mediums mediums;
+  EndpointChannelManager ecm;
+  EndpointManager em(&ecm);
+  BwuManager bwu(mediums, em, ecm, {}, {});
+  InjectedBluetoothDeviceStore ibds;
+  P2pClusterPcpHandler handler(&mediums, &em, &ecm, &bwu, ibds);
+  CountDownLatch found_latch(1);
+  ASSERT_EQ(handler.StartDiscovery(
+                &client_b_, service_id_, GetBluetoothOnlyDiscoveryOptions(),
+                {.endpoint_found_cb =
+                     [&found_latch](const std::string& endpoint_id,
+                                    const ByteArray& endpoint_info,
+                                    const std::string& service_id) {
+                       found_latch.CountDown();
+                     }}),
+            Status{Status::kSuccess});
+
+  // Three byte IP address.
+  handler.InjectEndpoint(&client_b_, service_id_,
+                         {.medium = Medium::WIFI_LAN,
+                          .endpoint_id = "ABCD",
+                          .endpoint_info = ByteArray{"endpoint_name"},
+                          .remote_wifi_lan_ip_address =
+                              std::string("\x0a\x00\x01", 3),
+                          .remote_wifi_lan_port = 8080});
+  // Missing port.
+  handler.InjectEndpoint(&client_b_, service_id_,
+                         {.medium = Medium::WIFI_LAN,
+                          .endpoint_id = "ABCD",
+                          .endpoint_info = ByteArray{"endpoint_name"},
+                          .remote_wifi_lan_ip_address =
+                              std::string("\x0a\x00\x00\x01", 4)});
+
+  EXPECT_FALSE(found_latch.Await(absl::Milliseconds(100)).result());
+  handler.StopDiscovery(&client_b_);
+  env_.Stop();
+}
+
 // Combines the bool `kEnableBleV2` as param testing but should revert it back
 // if ble_v2 is done and ble will be replaced by ble_v2.
 class P2pClusterPcpHandlerTestWithParam
@@ -1186,6 +1374,74 @@ TEST_P(P2pClusterPcpHandlerTestWithParam,
   env_.Stop();
 }
 
+TEST_P(P2pClusterPcpHandlerTestWithParam,
+       DiscoveryIsProcessedWhilePcpHandlerThreadIsBusy) {
+  env_.Start();
+  std::string endpoint_name{"endpoint_name"};
+  Mediums mediums_a;
+  Mediums mediums_b;
+  EndpointChannelManager ecm_a;
+  EndpointChannelManager ecm_b;
+  EndpointManager em_a(&ecm_a);
+  EndpointManager em_b(&ecm_b);
+  BwuManager bwu_a(mediums_a, em_a, ecm_a, {}, {});
+  BwuManager bwu_b(mediums_b, em_b, ecm_b, {}, {});
+  InjectedBluetoothDeviceStore ibds_a;
+  InjectedBluetoothDeviceStore ibds_b;
+  P2pClusterPcpHandler handler_a(&mediums_a, &em_a, &ecm_a, &bwu_a, ibds_a);
+  BusyP2pClusterPcpHandler handler_b(&mediums_b, &em_b, &ecm_b, &bwu_b,
+                                     ibds_b);
+  CountDownLatch found_latch(1);
+  CountDownLatch started_latch(1);
+  CountDownLatch released_latch(1);
+  bool recognized_while_busy = false;
+  absl::Time released_at;
+  absl::Time found_at;
+  EXPECT_EQ(handler_b.StartDiscovery(
+                &client_b_, service_id_, discovery_options_,
+                {
+                    .endpoint_found_cb =
+                        [&](const std::string& endpoint_id,
+                            const ByteArray& endpoint_info,
+                            const std::string& service_id) {
+                          found_at = absl::Now();
+                          found_latch.CountDown();
+                        },
+                }),
+            Status{Status::kSuccess});
+  // Hold the PCP handler thread the way a slow connect does, until the
+  // advertisement is recognized or the deadline passes. Discovery results
+  // that are parsed on the PCP handler thread cannot meet the deadline.
+  handler_b.RunOnPcpHandlerThread("simulated-connect", [&]() {
+    started_latch.CountDown();
+    absl::Time deadline = absl::Now() + absl::Milliseconds(1000);
+    while (absl::Now() < deadline) {
+      if (handler_b.GetPendingDiscoveryCountForTesting() > 0) {
+        recognized_while_busy = true;
+        break;
+      }
+      absl::SleepFor(absl::Milliseconds(10));
+    }
+    released_at = absl::Now();
+    released_latch.CountDown();
+  });
+  ASSERT_TRUE(started_latch.Await(absl::Milliseconds(1000)).result());
+  EXPECT_EQ(
+      handler_a.StartAdvertising(&client_a_, service_id_, advertising_options_,
+                                 {.endpoint_info = ByteArray{endpoint_name}}),
+      Status{Status::kSuccess});
+  ASSERT_TRUE(released_latch.Await(absl::Milliseconds(2000)).result());
+  EXPECT_TRUE(recognized_while_busy);
+  ASSERT_TRUE(found_latch.Await(absl::Milliseconds(1000)).result());
+  // Only the state machine update remains once the thread frees up.
+  NEARBY_LOGS(INFO) << "Discovery latency after simulated connect: "
+                    << absl::FormatDuration(found_at - released_at);
+  EXPECT_LT(found_at - released_at, absl::Milliseconds(500));
+  handler_b.StopDiscovery(&client_b_);
+  handler_a.StopAdvertising(&client_a_);
+  env_.Stop();
+}
+
 INSTANTIATE_TEST_SUITE_P(
     ParametrisedPcpHandlerTest, P2pClusterPcpHandlerTestWithParam,
     ::testing::Combine(/*mediums=*/::testing::ValuesIn(kTestCases),
@@ -0,0 +1,145 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Discovery latency of P2pClusterPcpHandler while a connection attempt keeps
+// the PCP handler thread busy.
+//
+// Each iteration starts advertising on one simulated device while the PCP
+// handler thread of the discovering device is held for as many milliseconds
+// as the benchmark argument, the way a slow connect holds it. The iteration
+// time is from the start of advertising until the endpoint is reported.
+// Each benchmark reports this counter:
+//   after_connect_ms   Time from the end of the simulated connect until the
+//                      endpoint is reported, per iteration.
+
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "connections/advertising_options.h"
+#include "connections/discovery_options.h"
+#include "connections/implementation/bwu_manager.h"
+#include "connections/implementation/client_proxy.h"
+#include "connections/implementation/endpoint_channel_manager.h"
+#include "connections/implementation/endpoint_manager.h"
+#include "connections/implementation/injected_bluetooth_device_store.h"
+#include "connections/implementation/mediums/mediums.h"
+#include "connections/implementation/p2p_cluster_pcp_handler.h"
+#include "connections/listeners.h"
+#include "connections/medium_selector.h"
+#include "connections/status.h"
+#include "connections/strategy.h"
+#include "internal/platform/byte_array.h"
+#include "internal/platform/count_down_latch.h"
+#include "internal/platform/medium_environment.h"
+
+namespace nearby {
+namespace connections {
+namespace {
+
+constexpr absl::string_view kServiceId = "service-id";
+constexpr absl::Duration kTimeout = absl::Seconds(10);
+
+// Exposes the PCP handler thread, to keep it busy.
+class BusyP2pClusterPcpHandler : public P2pClusterPcpHandler {
+ public:
+  using P2pClusterPcpHandler::P2pClusterPcpHandler;
+  using P2pClusterPcpHandler::RunOnPcpHandlerThread;
+};
+
+void BM_DiscoveryDuringConnect(benchmark::State& state) {
+  const absl::Duration connect_duration = absl::Milliseconds(state.range(0));
+  const BooleanMediumSelector mediums{.ble = true};
+  MediumEnvironment::Instance().Start();
+  {
+    Mediums mediums_a;
+    Mediums mediums_b;
+    EndpointChannelManager ecm_a;
+    EndpointChannelManager ecm_b;
+    EndpointManager em_a(&ecm_a);
+    EndpointManager em_b(&ecm_b);
+    BwuManager bwu_a(mediums_a, em_a, ecm_a, {}, {});
+    BwuManager bwu_b(mediums_b, em_b, ecm_b, {}, {});
+    InjectedBluetoothDeviceStore ibds_a;
+    InjectedBluetoothDeviceStore ibds_b;
+    P2pClusterPcpHandler handler_a(&mediums_a, &em_a, &ecm_a, &bwu_a, ibds_a);
+    BusyP2pClusterPcpHandler handler_b(&mediums_b, &em_b, &ecm_b, &bwu_b,
+                                       ibds_b);
+    ClientProxy client_a;
+    ClientProxy client_b;
+    absl::Duration after_connect;
+    for (auto _ : state) {
+      CountDownLatch found_latch(1);
+      CountDownLatch released_latch(1);
+      absl::Time released_at;
+      absl::Time found_at;
+      if (handler_b.StartDiscovery(
+              &client_b, std::string(kServiceId),
+              DiscoveryOptions{{Strategy::kP2pCluster, mediums}},
+              {.endpoint_found_cb =
+                   [&](const std::string&, const ByteArray&,
+                       const std::string&) {
+                     found_at = absl::Now();
+                     found_latch.CountDown();
+                   }}) != Status{Status::kSuccess}) {
+        state.SkipWithError("Discovery does not start");
+        break;
+      }
+      handler_b.RunOnPcpHandlerThread("simulated-connect", [&]() {
+        absl::SleepFor(connect_duration);
+        released_at = absl::Now();
+        released_latch.CountDown();
+      });
+      absl::Time start = absl::Now();
+      if (handler_a.StartAdvertising(
+              &client_a, std::string(kServiceId),
+              AdvertisingOptions{{Strategy::kP2pCluster, mediums}},
+              {.endpoint_info = ByteArray("endpoint")}) !=
+          Status{Status::kSuccess}) {
+        state.SkipWithError("Advertising does not start");
+        break;
+      }
+      if (!found_latch.Await(kTimeout).result()) {
+        state.SkipWithError("Endpoint not found");
+        break;
+      }
+      // Also orders the read of |released_at| after its write.
+      if (!released_latch.Await(kTimeout).result()) {
+        state.SkipWithError("Simulated connection does not end");
+        break;
+      }
+      state.SetIterationTime(absl::ToDoubleSeconds(found_at - start));
+      after_connect += found_at - released_at;
+      handler_b.StopDiscovery(&client_b);
+      handler_a.StopAdvertising(&client_a);
+    }
+    state.counters["after_connect_ms"] =
+        benchmark::Counter(absl::ToDoubleMilliseconds(after_connect),
+                           benchmark::Counter::kAvgIterations);
+  }
+  MediumEnvironment::Instance().Stop();
+}
+
+BENCHMARK(BM_DiscoveryDuringConnect)
+    ->Arg(0)
+    ->Arg(100)
+    ->Arg(500)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace connections
+}  // namespace nearby
@@ -0,0 +1,118 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Cost of the payload header in the intermediate DATA frames of a FILE
+// payload, on mediums with small chunks such as BLE and Bluetooth.
+//
+// Each iteration encodes one chunk of a file with a long name and parent
+// folder into a PAYLOAD_TRANSFER frame and encrypts it, as EndpointManager and
+// the endpoint channel do. The chunk size in bytes is the benchmark argument.
+//   BM_FullHeader     Every frame carries the full payload header.
+//   BM_ElidedHeader   The header only has the id and total size, as sent after
+//                     the first chunk when payload header elision is enabled.
+// Each benchmark reports these counters:
+//   wire_bytes_per_chunk   Encrypted frame size, with its length prefix.
+//   goodput_percent        Share of the wire bytes that is payload data.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "connections/implementation/endpoint_channel.h"
+#include "connections/implementation/offline_frames.h"
+#include "connections/payload.h"
+#include "internal/platform/byte_array.h"
+#include "securemessage/crypto_ops.h"
+
+namespace nearby {
+namespace connections {
+namespace {
+
+using ::location::nearby::connections::PayloadTransferFrame;
+using EncryptionContext = EndpointChannel::EncryptionContext;
+
+// Size of the length prefix that the endpoint channel writes before a frame.
+constexpr int kFrameLengthSize = 4;
+constexpr std::int64_t kFileSize = 100 * 1024 * 1024;
+
+PayloadTransferFrame::PayloadHeader CreateFullHeader() {
+  PayloadTransferFrame::PayloadHeader header;
+  header.set_id(Payload::GenerateId());
+  header.set_type(PayloadTransferFrame::PayloadHeader::FILE);
+  header.set_total_size(kFileSize);
+  header.set_is_sensitive(false);
+  header.set_file_name("IMG_20240612_183045_HDR_portrait_mode_edited.jpg");
+  header.set_parent_folder("DCIM/Camera/Shared with nearby devices");
+  return header;
+}
+
+PayloadTransferFrame::PayloadHeader CreateElidedHeader(
+    const PayloadTransferFrame::PayloadHeader& full_header) {
+  PayloadTransferFrame::PayloadHeader header;
+  header.set_id(full_header.id());
+  header.set_total_size(full_header.total_size());
+  return header;
+}
+
+// Returns a connection context with fixed keys.
+std::unique_ptr<EncryptionContext> CreateEncryptionContext() {
+  securemessage::CryptoOps::SecretKey key(
+      std::string(32, '\x5a'), securemessage::CryptoOps::AES_256_KEY);
+  return std::make_unique<EncryptionContext>(key, key,
+                                             /*encode_sequence_number=*/0,
+                                             /*decode_sequence_number=*/0);
+}
+
+void RunChunks(benchmark::State& state,
+               const PayloadTransferFrame::PayloadHeader& header) {
+  std::unique_ptr<EncryptionContext> context = CreateEncryptionContext();
+  const int chunk_size = state.range(0);
+  PayloadTransferFrame::PayloadChunk chunk;
+  chunk.set_body(std::string(chunk_size, 'x'));
+  chunk.set_index(1);
+  std::int64_t wire_bytes = 0;
+  for (auto _ : state) {
+    chunk.set_offset(chunk.offset() + chunk_size);
+    ByteArray frame = parser::ForDataPayloadTransfer(header, chunk);
+    std::unique_ptr<std::string> encrypted =
+        context->EncodeMessageToPeer(std::string(frame));
+    if (encrypted == nullptr) {
+      state.SkipWithError("Unable to encrypt the frame.");
+      return;
+    }
+    wire_bytes += encrypted->size() + kFrameLengthSize;
+  }
+  if (state.iterations() == 0) return;
+  double wire_bytes_per_chunk =
+      static_cast<double>(wire_bytes) / state.iterations();
+  state.counters["wire_bytes_per_chunk"] = wire_bytes_per_chunk;
+  state.counters["goodput_percent"] = 100.0 * chunk_size / wire_bytes_per_chunk;
+}
+
+void BM_FullHeader(benchmark::State& state) {
+  RunChunks(state, CreateFullHeader());
+}
+
+void BM_ElidedHeader(benchmark::State& state) {
+  RunChunks(state, CreateElidedHeader(CreateFullHeader()));
+}
+
+// Chunk sizes of BLE and Bluetooth, and a larger one for comparison.
+BENCHMARK(BM_FullHeader)->Arg(256)->Arg(512)->Arg(1000)->Arg(4096);
+BENCHMARK(BM_ElidedHeader)->Arg(256)->Arg(512)->Arg(1000)->Arg(4096);
+
+}  // namespace
+}  // namespace connections
+}  // namespace nearby
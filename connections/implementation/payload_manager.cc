@@ -15,10 +15,12 @@
 #include "connections/implementation/payload_manager.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -43,6 +45,7 @@
 #include "connections/medium_selector.h"
 #include "connections/payload.h"
 #include "connections/payload_type.h"
+#include "connections/rate_limit.h"
 #include "connections/status.h"
 #include "internal/flags/nearby_flags.h"
 #include "internal/platform/byte_array.h"
@@ -50,6 +53,7 @@
 #include "internal/platform/exception.h"
 #include "internal/platform/expected.h"
 #include "internal/platform/feature_flags.h"
+#include "internal/platform/implementation/system_clock.h"
 #include "internal/platform/logging.h"
 #include "internal/platform/mutex_lock.h"
 #include "internal/platform/single_thread_executor.h"
@@ -70,12 +74,25 @@ using ::nearby::analytics::ThroughputRecorderContainer;
 using PayloadDirection = ::nearby::connections::PayloadDirection;
 
 constexpr absl::Duration kMinTransferUpdateInterval = absl::Milliseconds(50);
+// Longest wait of a payload held back by a rate limit before it is requeued to
+// check whether it was canceled.
+constexpr absl::Duration kRateLimitRequeueInterval = absl::Milliseconds(20);
+
+PayloadTransferFrame::PayloadHeader CreateElidedPayloadHeader(
+    const PayloadTransferFrame::PayloadHeader& payload_header) {
+  PayloadTransferFrame::PayloadHeader elided_header;
+  elided_header.set_id(payload_header.id());
+  // Kept for OfflineFramesValidator, which checks chunk offsets against it.
+  elided_header.set_total_size(payload_header.total_size());
+  return elided_header;
+}
 }  // namespace
 
 bool PayloadManager::SendPayloadLoop(
     ClientProxy* client, PendingPayload& pending_payload,
     PayloadTransferFrame::PayloadHeader& payload_header,
-    std::int64_t& next_chunk_offset, size_t resume_offset, int index) {
+    std::int64_t& next_chunk_offset, size_t resume_offset, int index,
+    std::optional<ReservedChunk>& held_chunk) {
   // in lieu of structured binding:
   auto pair = GetAvailableAndUnavailableEndpoints(pending_payload);
   const EndpointIds& available_endpoint_ids =
@@ -117,7 +134,7 @@ bool PayloadManager::SendPayloadLoop(
   // payload. For the sake of accuracy, we update the pending payload here
   // because it's after all payload terminating events are handled, but
   // right before we actually start detaching the next chunk.
-  if (next_chunk_offset == 0 && resume_offset > 0) {
+  if (next_chunk_offset == 0 && resume_offset > 0 && !held_chunk.has_value()) {
     ExceptionOr<size_t> real_offset =
         pending_payload.GetInternalPayload()->SkipToOffset(resume_offset);
     if (!real_offset.ok()) {
@@ -140,14 +157,40 @@ bool PayloadManager::SendPayloadLoop(
     pending_payload.SetOffsetForEndpoint(endpoint_id, next_chunk_offset);
   }
 
-  // This will block if there is no data to transfer.
-  // It will resume when new data arrives, or if Close() is called.
-  int chunk_size = GetOptimalChunkSize(available_endpoint_ids);
-  packet_meta_data.StartFileIo();
-  ByteArray next_chunk =
-      pending_payload.GetInternalPayload()->DetachNextChunk(chunk_size);
-  packet_meta_data.StopFileIo();
-  if (shutdown_.Get()) return false;
+  if (!held_chunk.has_value()) {
+    // This will block if there is no data to transfer.
+    // It will resume when new data arrives, or if Close() is called.
+    int chunk_size = GetOptimalChunkSize(available_endpoint_ids);
+    packet_meta_data.StartFileIo();
+    ByteArray next_chunk =
+        pending_payload.GetInternalPayload()->DetachNextChunk(chunk_size);
+    packet_meta_data.StopFileIo();
+    if (shutdown_.Get()) return false;
+    // The payload may have been canceled, and its stream closed, while we were
+    // blocked on it; don't mistake that for the end of the data.
+    if (pending_payload.IsLocallyCanceled()) {
+      LOG(INFO) << "Aborting send of payload_id="
+                << pending_payload.GetInternalPayload()->GetId()
+                << " at offset " << next_chunk_offset
+                << " since it was canceled while reading.";
+      HandleFinishedOutgoingPayload(
+          client, available_endpoint_ids, payload_header, next_chunk_offset,
+          OperationResultCode::CLIENT_CANCELLATION_LOCAL_CANCEL_PAYLOAD,
+          PayloadStatus::LOCAL_CANCELLATION);
+      return false;
+    }
+    held_chunk = ReserveRateLimits(client, pending_payload,
+                                   available_endpoint_ids,
+                                   std::move(next_chunk));
+  }
+  // Let the caller requeue us until the rate limits let the chunk go.
+  if (held_chunk->send_time > absl::InfinitePast() &&
+      SystemClock::ElapsedRealtime() < held_chunk->send_time) {
+    return true;
+  }
+  ByteArray next_chunk = std::move(held_chunk->body);
+  held_chunk.reset();
+
   // Save chunk size. We'll need it after we move next_chunk.
   auto next_chunk_size = next_chunk.size();
   if (!next_chunk_size &&
@@ -168,8 +211,13 @@ bool PayloadManager::SendPayloadLoop(
   // happened.
   PayloadTransferFrame::PayloadChunk payload_chunk(CreatePayloadChunk(
       next_chunk_offset - resume_offset, std::move(next_chunk), index));
-  const EndpointIds& failed_endpoint_ids = endpoint_manager_->SendPayloadChunk(
-      payload_header, payload_chunk, available_endpoint_ids, packet_meta_data);
+  BeginPayloadChunkWrite();
+  const EndpointIds failed_endpoint_ids = endpoint_manager_->SendPayloadChunk(
+      CanElidePayloadHeader(client, available_endpoint_ids, payload_chunk)
+          ? CreateElidedPayloadHeader(payload_header)
+          : payload_header,
+      payload_chunk, available_endpoint_ids, packet_meta_data);
+  EndPayloadChunkWrite();
   // Check whether at least one endpoint failed.
   if (!failed_endpoint_ids.empty()) {
     LOG(INFO) << "Payload xfer: endpoints failed: payload_id="
@@ -185,6 +233,7 @@ bool PayloadManager::SendPayloadLoop(
   // we'll just go right back to the top of the loop and break out when
   // availableEndpointIds is re-synced and found to be empty at that point.
   if (failed_endpoint_ids.size() < available_endpoint_ids.size()) {
+    pending_payload.GetInternalPayload()->OnChunkSent();
     for (const auto& endpoint_id : available_endpoint_ids) {
       if (std::find(failed_endpoint_ids.begin(), failed_endpoint_ids.end(),
                     endpoint_id) == failed_endpoint_ids.end()) {
@@ -284,6 +333,8 @@ std::string PayloadManager::ToString(PayloadType type) {
       return std::string("Stream");
     case PayloadType::kFile:
       return std::string("File");
+    case PayloadType::kDatagram:
+      return std::string("Datagram");
     case PayloadType::kUnknown:
       return std::string("Unknown");
   }
@@ -305,6 +356,7 @@ std::string PayloadManager::ToString(EndpointInfo::Status status) {
 // Creates and starts tracking a PendingPayload for this Payload.
 Payload::Id PayloadManager::CreateOutgoingPayload(
     Payload payload, const EndpointIds& endpoint_ids) {
+  RateLimit rate_limit = payload.GetRateLimit();
   ErrorOr<std::unique_ptr<InternalPayload>> result =
       CreateOutgoingInternalPayload(std::move(payload));
   if (result.has_error()) {
@@ -315,13 +367,16 @@ Payload::Id PayloadManager::CreateOutgoingPayload(
   std::unique_ptr<InternalPayload> internal_payload = std::move(result.value());
   Payload::Id payload_id = internal_payload->GetId();
   LOG(INFO) << "CreateOutgoingPayload: payload_id=" << payload_id;
+  auto pending_payload = std::make_unique<PendingPayload>(
+      std::move(internal_payload), endpoint_ids,
+      /*is_incoming=*/false,
+      absl::bind_front(&PayloadManager::OnPendingPayloadDestroy, this));
+  if (!rate_limit.IsUnlimited()) {
+    pending_payload->GetRateLimiter().SetRateLimit(rate_limit);
+  }
   MutexLock lock(&mutex_);
-  pending_payloads_.StartTrackingPayload(
-      payload_id,
-      std::make_unique<PendingPayload>(
-          std::move(internal_payload), endpoint_ids,
-          /*is_incoming=*/false,
-          absl::bind_front(&PayloadManager::OnPendingPayloadDestroy, this)));
+  pending_payloads_.StartTrackingPayload(payload_id,
+                                         std::move(pending_payload));
 
   return payload_id;
 }
@@ -368,8 +423,10 @@ PayloadManager::~PayloadManager() {
   DisconnectFromEndpointManager();
   CancelAllPayloads();
   LOG(INFO) << "PayloadManager: turn down payload executors; self=" << this;
+  rate_limit_executor_.Shutdown();
   bytes_payload_executor_.Shutdown();
   stream_payload_executor_.Shutdown();
+  datagram_payload_executor_.Shutdown();
   file_payload_executor_.Shutdown();
   send_payload_ack_executor_.Shutdown();
 
@@ -406,11 +463,16 @@ void PayloadManager::SendPayload(ClientProxy* client,
                                  Payload payload) {
   if (shutdown_.Get()) return;
   LOG(INFO) << "SendPayload: endpoint_ids={" << ToString(endpoint_ids) << "}";
+  if (payload.GetType() == PayloadType::kDatagram) {
+    SendDatagram(client, endpoint_ids, std::move(payload));
+    return;
+  }
   // Before transfer to internal payload, retrieves the Payload size for
   // analytics.
   std::int64_t payload_total_size;
   switch (payload.GetType()) {
     case connections::PayloadType::kBytes:
+    case connections::PayloadType::kDatagram:
       payload_total_size = payload.AsBytes().size();
       break;
     case connections::PayloadType::kFile:
@@ -450,8 +512,8 @@ void PayloadManager::SendPayload(ClientProxy* client,
 
   Payload::Id payload_id =
       CreateOutgoingPayload(std::move(payload), endpoint_ids);
-  executor->Execute("send-payload", [this, client, endpoint_ids, payload_id,
-                                     payload_type, resume_offset,
+  executor->Execute("send-payload", [this, executor, client, endpoint_ids,
+                                     payload_id, payload_type, resume_offset,
                                      payload_total_size]() {
     if (shutdown_.Get()) return;
     PendingPayloadHandle pending_payload = GetPayload(payload_id);
@@ -475,35 +537,71 @@ void PayloadManager::SendPayload(ClientProxy* client,
                                   payload_type, resume_offset,
                                   internal_payload->GetTotalSize());
 
-    PayloadTransferFrame::PayloadHeader payload_header{CreatePayloadHeader(
+    auto transfer = std::make_unique<OutgoingTransfer>();
+    transfer->client = client;
+    transfer->payload_id = payload_id;
+    transfer->payload_header = CreatePayloadHeader(
         *internal_payload, resume_offset, internal_payload->GetParentFolder(),
-        internal_payload->GetFileName())};
-
-    bool should_continue = true;
-    std::int64_t next_chunk_offset = 0;
-    int index = 0;
+        internal_payload->GetFileName());
+    transfer->resume_offset = resume_offset;
 
     ThroughputRecorderContainer::GetInstance()
         .GetTPRecorder(payload_id, PayloadDirection::OUTGOING_PAYLOAD)
         ->Start(payload_type, PayloadDirection::OUTGOING_PAYLOAD);
-    while (should_continue && !shutdown_.Get()) {
-      should_continue =
-          SendPayloadLoop(client, *pending_payload, payload_header,
-                          next_chunk_offset, resume_offset, index);
-      index++;
-    }
-
-    RunOnStatusUpdateThread("destroy-payload",
-                            [this, payload_id]()
-                                RUN_ON_PAYLOAD_STATUS_UPDATE_THREAD() {
-                                  DestroyPendingPayload(payload_id);
-                                });
+    SendPayloadChunks(executor, std::move(transfer));
   });
   LOG(INFO) << "PayloadManager: xfer scheduled: self=" << this
             << "; payload_id=" << payload_id
             << ", payload_type=" << ToString(payload_type);
 }
 
+void PayloadManager::SendPayloadChunks(
+    SingleThreadExecutor* executor,
+    std::unique_ptr<OutgoingTransfer> transfer) {
+  Payload::Id payload_id = transfer->payload_id;
+  PendingPayloadHandle pending_payload = GetPayload(payload_id);
+  if (!pending_payload) return;
+
+  bool should_continue = true;
+  while (should_continue && !shutdown_.Get()) {
+    should_continue = SendPayloadLoop(
+        transfer->client, *pending_payload, transfer->payload_header,
+        transfer->next_chunk_offset, transfer->resume_offset, transfer->index,
+        transfer->held_chunk);
+    if (should_continue && transfer->held_chunk.has_value()) {
+      // Give way to the other payloads of this type, and check back often
+      // enough to notice a cancellation right away.
+      absl::Duration delay =
+          std::min(transfer->held_chunk->send_time -
+                       SystemClock::ElapsedRealtime(),
+                   kRateLimitRequeueInterval);
+      rate_limit_executor_.Schedule(
+          [this, executor, transfer = std::move(transfer)]() mutable {
+            executor->Execute("send-payload",
+                              [this, executor,
+                               transfer = std::move(transfer)]() mutable {
+                                if (shutdown_.Get()) return;
+                                SendPayloadChunks(executor,
+                                                  std::move(transfer));
+                              });
+          },
+          delay);
+      return;
+    }
+    transfer->index++;
+  }
+
+  // The payload ended while a chunk was held back; it was never sent.
+  if (transfer->held_chunk.has_value()) {
+    RefundRateLimits(*pending_payload, *transfer->held_chunk);
+  }
+  RunOnStatusUpdateThread("destroy-payload",
+                          [this, payload_id]()
+                              RUN_ON_PAYLOAD_STATUS_UPDATE_THREAD() {
+                                DestroyPendingPayload(payload_id);
+                              });
+}
+
 PayloadManager::PendingPayloadHandle PayloadManager::GetPayload(
     Payload::Id payload_id) const {
   return pending_payloads_.GetPayload(payload_id);
@@ -524,6 +622,14 @@ Status PayloadManager::CancelPayload(ClientProxy* client,
             << (canceled_payload->IsIncoming() ? "incoming" : "outgoing")
             << " payload_id=" << payload_id << " at request of client.";
 
+  // An outgoing stream blocks its sender thread until the client writes more
+  // data; close it so that the send loop sees the cancellation right away.
+  if (!canceled_payload->IsIncoming() &&
+      canceled_payload->GetInternalPayload()->GetType() ==
+          PayloadTransferFrame::PayloadHeader::STREAM) {
+    canceled_payload->Close();
+  }
+
   // Return SUCCESS immediately. Remaining cleanup and updates will be sent
   // in SendPayload() or OnIncomingFrame()
   return {Status::kSuccess};
@@ -591,6 +697,11 @@ void PayloadManager::OnEndpointDisconnect(ClientProxy* client,
     barrier.CountDown();
     return;
   }
+  {
+    MutexLock lock(&datagram_mutex_);
+    last_datagram_sequence_numbers_.erase(endpoint_id);
+  }
+  SetRateLimit(client->GetClientId(), endpoint_id, RateLimit{});
   RunOnStatusUpdateThread(
       "payload-manager-on-disconnect",
       [this, client, endpoint_id, barrier,
@@ -793,6 +904,16 @@ PayloadTransferFrame::PayloadChunk PayloadManager::CreatePayloadChunk(
   return payload_chunk;
 }
 
+bool PayloadManager::CanElidePayloadHeader(
+    ClientProxy* client, const EndpointIds& endpoint_ids,
+    const PayloadTransferFrame::PayloadChunk& payload_chunk) {
+  if (payload_chunk.offset() == 0) return false;
+  for (const auto& endpoint_id : endpoint_ids) {
+    if (!client->IsPayloadHeaderElisionEnabled(endpoint_id)) return false;
+  }
+  return true;
+}
+
 ErrorOr<PayloadManager::PendingPayloadHandle>
 PayloadManager::CreateIncomingPayload(const PayloadTransferFrame& frame,
                                       const std::string& endpoint_id) {
@@ -1222,12 +1343,6 @@ void PayloadManager::HandleSuccessfulIncomingChunk(
     const PayloadTransferFrame::PayloadHeader& payload_header,
     std::int32_t payload_chunk_flags, std::int64_t payload_chunk_offset,
     std::int64_t payload_chunk_body_size) {
-  if (NearbyFlags::GetInstance().GetBoolFlag(
-          config_package_nearby::nearby_connections_feature::
-              kEnablePayloadManagerToSkipChunkUpdate)) {
-    MutexLock lock(&chunk_update_mutex_);
-    ++incoming_chunk_update_count_;
-  }
   RunOnStatusUpdateThread(
       "incoming-chunk-success",
       [this, client, endpoint_id, payload_header, payload_chunk_flags,
@@ -1238,40 +1353,6 @@ void PayloadManager::HandleSuccessfulIncomingChunk(
             (payload_chunk_flags &
              PayloadTransferFrame::PayloadChunk::LAST_CHUNK) != 0;
 
-        if (NearbyFlags::GetInstance().GetBoolFlag(
-                config_package_nearby::nearby_connections_feature::
-                    kEnablePayloadManagerToSkipChunkUpdate)) {
-          MutexLock lock(&chunk_update_mutex_);
-          --incoming_chunk_update_count_;
-          if (payload_header.has_type() &&
-              payload_header.type() ==
-                  PayloadTransferFrame::PayloadTransferFrame::PayloadHeader::
-                      FILE) {
-            if (incoming_chunk_update_count_ > 0 && !is_last_chunk &&
-                payload_chunk_offset != 0) {
-              VLOG(1) << "Skip the incoming chunk update with offset="
-                      << payload_chunk_offset;
-              client->GetAnalyticsRecorder().OnPayloadChunkReceived(
-                  endpoint_id, payload_header.id(), payload_chunk_body_size);
-              return;
-            }
-
-            absl::Time current_time = absl::Now();
-            if (!is_last_chunk && payload_chunk_offset != 0 &&
-                current_time - last_incoming_chunk_update_time_ <
-                    kMinTransferUpdateInterval) {
-              VLOG(1) << "Skip the incoming chunk update with offset="
-                      << payload_chunk_offset
-                      << " because it's too close to the previous update.";
-              client->GetAnalyticsRecorder().OnPayloadChunkSent(
-                  endpoint_id, payload_header.id(), payload_chunk_body_size);
-              return;
-            }
-
-            last_incoming_chunk_update_time_ = current_time;
-          }
-        }
-
         PendingPayloadHandle pending_payload = GetPayload(payload_header.id());
         if (!pending_payload) {
           return;
@@ -1301,6 +1382,51 @@ void PayloadManager::HandleSuccessfulIncomingChunk(
       });
 }
 
+// @EndpointManagerReaderThread
+void PayloadManager::HandleSuccessfulIncomingIntermediateChunk(
+    ClientProxy* client, const std::string& endpoint_id,
+    PendingPayload& pending_payload,
+    PayloadTransferFrame::PayloadHeader::PayloadType payload_type,
+    std::int64_t payload_chunk_offset, std::int64_t payload_chunk_body_size) {
+  client->GetAnalyticsRecorder().OnPayloadChunkReceived(
+      endpoint_id, pending_payload.GetId(), payload_chunk_body_size);
+
+  // When callbacks cannot keep up with a file transfer, only report its
+  // progress every kMinTransferUpdateInterval.
+  absl::Duration min_update_interval = absl::ZeroDuration();
+  if (payload_type == PayloadTransferFrame::PayloadHeader::FILE &&
+      NearbyFlags::GetInstance().GetBoolFlag(
+          config_package_nearby::nearby_connections_feature::
+              kEnablePayloadManagerToSkipChunkUpdate)) {
+    min_update_interval = kMinTransferUpdateInterval;
+  }
+  if (!pending_payload.AddIncomingProgress(
+          payload_chunk_offset + payload_chunk_body_size,
+          min_update_interval)) {
+    // Either the update already scheduled reports this chunk too, or a later
+    // one will.
+    return;
+  }
+
+  RunOnStatusUpdateThread(
+      "incoming-chunk-progress",
+      [this, client, endpoint_id, payload_id = pending_payload.GetId()]()
+          RUN_ON_PAYLOAD_STATUS_UPDATE_THREAD() {
+            PendingPayloadHandle pending_payload = GetPayload(payload_id);
+            if (!pending_payload) return;
+            std::optional<std::int64_t> bytes_transferred =
+                pending_payload->TakeIncomingProgress();
+            if (!bytes_transferred.has_value()) return;
+
+            PayloadProgressInfo update{
+                payload_id, PayloadProgressInfo::Status::kInProgress,
+                pending_payload->GetInternalPayload()->GetTotalSize(),
+                *bytes_transferred};
+            NotifyClientOfIncomingPayloadProgressInfo(client, endpoint_id,
+                                                      update);
+          });
+}
+
 // @EndpointManagerDataPool
 void PayloadManager::ProcessDataPacket(
     ClientProxy* to_client, const std::string& from_endpoint_id,
@@ -1310,6 +1436,10 @@ void PayloadManager::ProcessDataPacket(
       *payload_transfer_frame.mutable_payload_header();
   PayloadTransferFrame::PayloadChunk& payload_chunk =
       *payload_transfer_frame.mutable_payload_chunk();
+  if (payload_header.type() == PayloadTransferFrame::PayloadHeader::DATAGRAM) {
+    ProcessDatagram(to_client, from_endpoint_id, payload_transfer_frame);
+    return;
+  }
   NEARBY_VLOG(1) << "PayloadManager got data OfflineFrame for payload_id="
                  << payload_header.id()
                  << " from endpoint_id=" << from_endpoint_id << " at offset "
@@ -1332,16 +1462,13 @@ void PayloadManager::ProcessDataPacket(
         ->Start((PayloadType)payload_header.type(),
                 PayloadDirection::INCOMING_PAYLOAD);
     packet_meta_data.Reset();
-    RunOnStatusUpdateThread(
-        "process-data-packet", [to_client, from_endpoint_id, payload_header,
-                                this]() RUN_ON_PAYLOAD_STATUS_UPDATE_THREAD() {
-          // This is the first chunk of a new incoming
-          // payload. Start the analysis.
-          to_client->GetAnalyticsRecorder().OnIncomingPayloadStarted(
-              from_endpoint_id, payload_header.id(),
-              FramePayloadTypeToPayloadType(payload_header.type()),
-              payload_header.total_size());
-        });
+    // This is the first chunk of a new incoming payload. Start the analysis
+    // here rather than on the status update thread, since the analysis of its
+    // chunks is recorded here too.
+    to_client->GetAnalyticsRecorder().OnIncomingPayloadStarted(
+        from_endpoint_id, payload_header.id(),
+        FramePayloadTypeToPayloadType(payload_header.type()),
+        payload_header.total_size());
 
     ErrorOr<PendingPayloadHandle> result =
         CreateIncomingPayload(payload_transfer_frame, from_endpoint_id);
@@ -1394,6 +1521,11 @@ void PayloadManager::ProcessDataPacket(
                  << from_endpoint_id << "; payload_id=" << payload_header.id();
     return;
   }
+  if (!payload_header.has_type()) {
+    // The sender elided the payload header, which came in full with the first
+    // chunk. Restore the type, which is all that is used from here on.
+    payload_header.set_type(pending_payload->GetInternalPayload()->GetType());
+  }
   if (pending_payload->IsLocallyCanceled()) {
     // This incoming payload was canceled by the client. Drop this frame and
     // do all the cleanup. See go/nc-cancel-payload
@@ -1435,9 +1567,15 @@ void PayloadManager::ProcessDataPacket(
   SendPayloadReceivedAck(to_client, *pending_payload, from_endpoint_id,
                          is_last_chunk);
 
-  HandleSuccessfulIncomingChunk(to_client, from_endpoint_id, payload_header,
-                                payload_chunk.flags(), payload_chunk.offset(),
-                                payload_body_size);
+  if (is_last_chunk) {
+    HandleSuccessfulIncomingChunk(to_client, from_endpoint_id, payload_header,
+                                  payload_chunk.flags(), payload_chunk.offset(),
+                                  payload_body_size);
+  } else {
+    HandleSuccessfulIncomingIntermediateChunk(
+        to_client, from_endpoint_id, *pending_payload, payload_header.type(),
+        payload_chunk.offset(), payload_body_size);
+  }
 
   ThroughputRecorderContainer::GetInstance()
       .GetTPRecorder(payload_header.id(), PayloadDirection::INCOMING_PAYLOAD)
@@ -1449,6 +1587,186 @@ void PayloadManager::ProcessDataPacket(
   }
 }
 
+void PayloadManager::SendDatagram(ClientProxy* client,
+                                  const EndpointIds& endpoint_ids,
+                                  Payload payload) {
+  std::size_t size = payload.AsBytes().size();
+  if (size > Payload::kMaxDatagramSize) {
+    LOG(WARNING) << "PayloadManager dropped datagram payload_id="
+                 << payload.GetId() << " of " << size
+                 << " bytes; the limit is " << Payload::kMaxDatagramSize;
+    NotifyDatagramResult(client, endpoint_ids, endpoint_ids, payload.GetId(),
+                         size);
+    return;
+  }
+
+  // A remote device that does not know the DATAGRAM type would treat the
+  // frame as the start of a payload it never completes.
+  EndpointIds supported_endpoint_ids;
+  EndpointIds unsupported_endpoint_ids;
+  for (const auto& endpoint_id : endpoint_ids) {
+    if (client->SupportsDatagram(endpoint_id)) {
+      supported_endpoint_ids.push_back(endpoint_id);
+    } else {
+      unsupported_endpoint_ids.push_back(endpoint_id);
+    }
+  }
+  if (!unsupported_endpoint_ids.empty()) {
+    LOG(WARNING) << "PayloadManager can't send datagram payload_id="
+                 << payload.GetId() << " to endpoint_ids={"
+                 << ToString(unsupported_endpoint_ids)
+                 << "}; they don't support datagrams";
+    NotifyDatagramResult(client, unsupported_endpoint_ids,
+                         unsupported_endpoint_ids, payload.GetId(), size);
+  }
+  if (supported_endpoint_ids.empty()) return;
+
+  std::optional<QueuedDatagram> dropped;
+  {
+    MutexLock lock(&datagram_mutex_);
+    if (queued_datagrams_.size() >= kMaxQueuedDatagrams) {
+      dropped = std::move(queued_datagrams_.front());
+      queued_datagrams_.pop_front();
+    }
+    queued_datagrams_.push_back(
+        {client, std::move(supported_endpoint_ids), std::move(payload)});
+  }
+  if (dropped.has_value()) {
+    NEARBY_VLOG(1) << "PayloadManager dropped stale datagram payload_id="
+                   << dropped->payload.GetId();
+    NotifyDatagramResult(dropped->client, dropped->endpoint_ids,
+                         dropped->endpoint_ids, dropped->payload.GetId(),
+                         dropped->payload.AsBytes().size());
+  }
+  datagram_payload_executor_.Execute("send-datagram",
+                                     [this]() { SendNextDatagram(); });
+}
+
+void PayloadManager::SendNextDatagram() {
+  if (shutdown_.Get()) return;
+  std::optional<QueuedDatagram> datagram;
+  {
+    MutexLock lock(&datagram_mutex_);
+    // Give way to the other payloads. Newer datagrams keep replacing the
+    // oldest ones in the meantime.
+    absl::Time deadline = SystemClock::ElapsedRealtime() + kMaxDatagramDeferral;
+    while (payload_chunk_writes_ > 0 && !shutdown_.Get()) {
+      absl::Duration time_left = deadline - SystemClock::ElapsedRealtime();
+      if (time_left <= absl::ZeroDuration()) break;
+      payload_chunk_writes_done_.Wait(time_left);
+    }
+    // Dropping a datagram leaves its job queued, so there may be nothing left
+    // to send.
+    if (queued_datagrams_.empty()) return;
+    datagram = std::move(queued_datagrams_.front());
+    queued_datagrams_.pop_front();
+  }
+
+  const ByteArray& body = datagram->payload.AsBytes();
+  PayloadTransferFrame::PayloadHeader payload_header;
+  payload_header.set_id(datagram->payload.GetId());
+  payload_header.set_type(PayloadTransferFrame::PayloadHeader::DATAGRAM);
+  payload_header.set_total_size(body.size());
+  if (datagram->payload.GetSequenceNumber().has_value()) {
+    payload_header.set_sequence_number(
+        *datagram->payload.GetSequenceNumber());
+  }
+  PayloadTransferFrame::PayloadChunk payload_chunk;
+  payload_chunk.set_offset(0);
+  payload_chunk.set_flags(PayloadTransferFrame::PayloadChunk::LAST_CHUNK);
+  payload_chunk.set_body(std::string(body));
+
+  EndpointIds failed_endpoint_ids = endpoint_manager_->SendDatagram(
+      payload_header, payload_chunk, datagram->endpoint_ids);
+  NotifyDatagramResult(datagram->client, datagram->endpoint_ids,
+                       failed_endpoint_ids, payload_header.id(),
+                       payload_header.total_size());
+}
+
+void PayloadManager::BeginPayloadChunkWrite() {
+  MutexLock lock(&datagram_mutex_);
+  ++payload_chunk_writes_;
+}
+
+void PayloadManager::EndPayloadChunkWrite() {
+  MutexLock lock(&datagram_mutex_);
+  if (--payload_chunk_writes_ == 0) {
+    payload_chunk_writes_done_.Notify();
+  }
+}
+
+void PayloadManager::NotifyDatagramResult(
+    ClientProxy* client, const EndpointIds& endpoint_ids,
+    const EndpointIds& failed_endpoint_ids, Payload::Id payload_id,
+    std::int64_t size) {
+  RunOnStatusUpdateThread(
+      "datagram-callbacks",
+      [client, endpoint_ids, failed_endpoint_ids, payload_id,
+       size]() RUN_ON_PAYLOAD_STATUS_UPDATE_THREAD() {
+        for (const auto& endpoint_id : endpoint_ids) {
+          bool failed = std::find(failed_endpoint_ids.begin(),
+                                  failed_endpoint_ids.end(),
+                                  endpoint_id) != failed_endpoint_ids.end();
+          client->OnPayloadProgress(
+              endpoint_id,
+              {payload_id,
+               failed ? PayloadProgressInfo::Status::kFailure
+                      : PayloadProgressInfo::Status::kSuccess,
+               size, failed ? 0 : size});
+        }
+      });
+}
+
+// @EndpointManagerDataPool
+void PayloadManager::ProcessDatagram(
+    ClientProxy* to_client, const std::string& from_endpoint_id,
+    PayloadTransferFrame& payload_transfer_frame) {
+  const PayloadTransferFrame::PayloadHeader& payload_header =
+      payload_transfer_frame.payload_header();
+  PayloadTransferFrame::PayloadChunk& payload_chunk =
+      *payload_transfer_frame.mutable_payload_chunk();
+  if (payload_header.id() == 0 ||
+      payload_chunk.body().size() > Payload::kMaxDatagramSize) {
+    LOG(WARNING) << "PayloadManager dropped invalid datagram payload_id="
+                 << payload_header.id()
+                 << " from endpoint_id=" << from_endpoint_id;
+    return;
+  }
+
+  std::optional<std::int64_t> sequence_number;
+  if (payload_header.has_sequence_number()) {
+    sequence_number = payload_header.sequence_number();
+    MutexLock lock(&datagram_mutex_);
+    auto [it, inserted] = last_datagram_sequence_numbers_.emplace(
+        from_endpoint_id, *sequence_number);
+    if (!inserted) {
+      if (*sequence_number <= it->second) {
+        NEARBY_VLOG(1) << "PayloadManager dropped stale datagram payload_id="
+                       << payload_header.id()
+                       << " from endpoint_id=" << from_endpoint_id;
+        return;
+      }
+      it->second = *sequence_number;
+    }
+  }
+
+  Payload payload = Payload::Datagram(
+      payload_header.id(),
+      ByteArray(std::move(*payload_chunk.mutable_body())), sequence_number);
+  RunOnStatusUpdateThread(
+      "process-datagram",
+      [to_client, from_endpoint_id, payload = std::move(payload)]()
+          RUN_ON_PAYLOAD_STATUS_UPDATE_THREAD() mutable {
+            Payload::Id payload_id = payload.GetId();
+            std::int64_t size = payload.AsBytes().size();
+            to_client->OnPayload(from_endpoint_id, std::move(payload));
+            to_client->OnPayloadProgress(
+                from_endpoint_id,
+                {payload_id, PayloadProgressInfo::Status::kSuccess, size,
+                 size});
+          });
+}
+
 // @EndpointManagerDataPool
 void PayloadManager::ProcessControlPacket(
     ClientProxy* to_client, const std::string& from_endpoint_id,
@@ -1574,6 +1892,8 @@ PayloadType PayloadManager::FramePayloadTypeToPayloadType(
       return connections::PayloadType::kFile;
     case PayloadTransferFrame::PayloadHeader::STREAM:
       return connections::PayloadType::kStream;
+    case PayloadTransferFrame::PayloadHeader::DATAGRAM:
+      return connections::PayloadType::kDatagram;
     default:
       return connections::PayloadType::kUnknown;
   }
@@ -1584,6 +1904,89 @@ void PayloadManager::SetCustomSavePath(ClientProxy* client,
   custom_save_path_ = path;
 }
 
+void PayloadManager::SetClientRateLimit(ClientProxy* client,
+                                        RateLimit rate_limit) {
+  SetRateLimit(client->GetClientId(), /*endpoint_id=*/"", rate_limit);
+}
+
+void PayloadManager::SetEndpointRateLimit(ClientProxy* client,
+                                          const std::string& endpoint_id,
+                                          RateLimit rate_limit) {
+  if (endpoint_id.empty()) return;
+  SetRateLimit(client->GetClientId(), endpoint_id, rate_limit);
+}
+
+Status PayloadManager::SetPayloadRateLimit(ClientProxy* client,
+                                           Payload::Id payload_id,
+                                           RateLimit rate_limit) {
+  PendingPayloadHandle pending_payload = GetPayload(payload_id);
+  if (!pending_payload || pending_payload->IsIncoming()) {
+    LOG(INFO) << "Client requested rate limit for unknown payload_id="
+              << payload_id << ", ignoring.";
+    return {Status::kPayloadUnknown};
+  }
+  pending_payload->GetRateLimiter().SetRateLimit(rate_limit);
+  return {Status::kSuccess};
+}
+
+void PayloadManager::SetRateLimit(std::int64_t client_id,
+                                  const std::string& endpoint_id,
+                                  RateLimit rate_limit) {
+  MutexLock lock(&rate_limiters_mutex_);
+  auto key = std::make_pair(client_id, endpoint_id);
+  if (rate_limit.IsUnlimited()) {
+    rate_limiters_.erase(key);
+  } else {
+    std::shared_ptr<RateLimiter>& rate_limiter = rate_limiters_[key];
+    if (rate_limiter == nullptr) {
+      rate_limiter = std::make_shared<RateLimiter>();
+    }
+    rate_limiter->SetRateLimit(rate_limit);
+  }
+  has_rate_limiters_.store(!rate_limiters_.empty(), std::memory_order_release);
+}
+
+PayloadManager::ReservedChunk PayloadManager::ReserveRateLimits(
+    ClientProxy* client, PendingPayload& pending_payload,
+    const EndpointIds& endpoint_ids, ByteArray chunk) {
+  std::int64_t chunk_size = chunk.size();
+  ReservedChunk reserved_chunk{.body = std::move(chunk)};
+  absl::Duration delay = pending_payload.GetRateLimiter().Reserve(chunk_size);
+  if (has_rate_limiters_.load(std::memory_order_acquire)) {
+    {
+      MutexLock lock(&rate_limiters_mutex_);
+      std::int64_t client_id = client->GetClientId();
+      auto it = rate_limiters_.find(std::make_pair(client_id, std::string()));
+      if (it != rate_limiters_.end()) {
+        reserved_chunk.rate_limiters.push_back(it->second);
+      }
+      for (const auto& endpoint_id : endpoint_ids) {
+        it = rate_limiters_.find(std::make_pair(client_id, endpoint_id));
+        if (it != rate_limiters_.end()) {
+          reserved_chunk.rate_limiters.push_back(it->second);
+        }
+      }
+    }
+    // Every limit is charged, and the chunk waits for the slowest one.
+    for (const auto& rate_limiter : reserved_chunk.rate_limiters) {
+      delay = std::max(delay, rate_limiter->Reserve(chunk_size));
+    }
+  }
+  reserved_chunk.send_time = delay > absl::ZeroDuration()
+                                 ? SystemClock::ElapsedRealtime() + delay
+                                 : absl::InfinitePast();
+  return reserved_chunk;
+}
+
+void PayloadManager::RefundRateLimits(PendingPayload& pending_payload,
+                                      const ReservedChunk& chunk) {
+  std::int64_t chunk_size = chunk.body.size();
+  pending_payload.GetRateLimiter().Refund(chunk_size);
+  for (const auto& rate_limiter : chunk.rate_limiters) {
+    rate_limiter->Refund(chunk_size);
+  }
+}
+
 ///////////////////////////////// EndpointInfo
 ////////////////////////////////////
 
@@ -1728,6 +2131,32 @@ void PayloadManager::PendingPayload::SetOffsetForEndpoint(
   }
 }
 
+bool PayloadManager::PendingPayload::AddIncomingProgress(
+    std::int64_t bytes_transferred, absl::Duration min_update_interval) {
+  MutexLock lock(&mutex_);
+
+  unreported_bytes_transferred_ = bytes_transferred;
+  if (is_progress_update_scheduled_) return false;
+  if (min_update_interval > absl::ZeroDuration()) {
+    absl::Time now = absl::Now();
+    if (now - last_progress_update_time_ < min_update_interval) return false;
+    last_progress_update_time_ = now;
+  }
+  is_progress_update_scheduled_ = true;
+  return true;
+}
+
+std::optional<std::int64_t>
+PayloadManager::PendingPayload::TakeIncomingProgress() {
+  MutexLock lock(&mutex_);
+
+  is_progress_update_scheduled_ = false;
+  std::optional<std::int64_t> bytes_transferred =
+      unreported_bytes_transferred_;
+  unreported_bytes_transferred_.reset();
+  return bytes_transferred;
+}
+
 void PayloadManager::PendingPayload::Close() {
   bool was_closed = is_closed_.Set(true);
   if (was_closed) return;
@@ -15,9 +15,12 @@
 #ifndef CORE_INTERNAL_PAYLOAD_MANAGER_H_
 #define CORE_INTERNAL_PAYLOAD_MANAGER_H_
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -30,9 +33,11 @@
 #include "connections/implementation/client_proxy.h"
 #include "connections/implementation/endpoint_manager.h"
 #include "connections/implementation/internal_payload.h"
+#include "connections/implementation/rate_limiter.h"
 #include "connections/listeners.h"
 #include "connections/payload.h"
 #include "connections/payload_type.h"
+#include "connections/rate_limit.h"
 #include "connections/status.h"
 #include "internal/platform/atomic_boolean.h"
 #include "internal/platform/atomic_reference.h"
@@ -41,6 +46,7 @@
 #include "internal/platform/count_down_latch.h"
 #include "internal/platform/expected.h"
 #include "internal/platform/mutex.h"
+#include "internal/platform/scheduled_executor.h"
 #include "internal/platform/single_thread_executor.h"
 
 namespace nearby {
@@ -81,6 +87,19 @@ class PayloadManager : public EndpointManager::FrameProcessor {
 
   void SetCustomSavePath(ClientProxy* client, const std::string& path);
 
+  // Cap the rate at which |client| sends payloads: in total, to |endpoint_id|
+  // until it disconnects, or for the outgoing payload |payload_id|. An
+  // unlimited RateLimit removes the cap. Caps can be changed at any time, and
+  // apply from the next chunk.
+  void SetClientRateLimit(ClientProxy* client, RateLimit rate_limit)
+      ABSL_LOCKS_EXCLUDED(rate_limiters_mutex_);
+  void SetEndpointRateLimit(ClientProxy* client,
+                            const std::string& endpoint_id,
+                            RateLimit rate_limit)
+      ABSL_LOCKS_EXCLUDED(rate_limiters_mutex_);
+  Status SetPayloadRateLimit(ClientProxy* client, Payload::Id payload_id,
+                             RateLimit rate_limit);
+
  private:
   // Information about an endpoint for a particular payload.
   struct EndpointInfo {
@@ -161,11 +180,26 @@ class PayloadManager : public EndpointManager::FrameProcessor {
     void SetOffsetForEndpoint(const std::string& endpoint_id,
                               std::int64_t offset) ABSL_LOCKS_EXCLUDED(mutex_);
 
+    // Records that |bytes_transferred| bytes of this incoming payload have
+    // been received. Returns true if the caller must schedule a progress
+    // update, i.e. none is scheduled yet and the last one was scheduled at
+    // least |min_update_interval| ago.
+    bool AddIncomingProgress(std::int64_t bytes_transferred,
+                             absl::Duration min_update_interval)
+        ABSL_LOCKS_EXCLUDED(mutex_);
+    // Returns the progress recorded since the last call, if any, and lets
+    // AddIncomingProgress() schedule the next update.
+    std::optional<std::int64_t> TakeIncomingProgress()
+        ABSL_LOCKS_EXCLUDED(mutex_);
+
     // Closes internal_payload_.
     // Close is called when a pending peyload does not have associated
     // endpoints.
     void Close();
 
+    // Rate limit of this payload alone.
+    RateLimiter& GetRateLimiter() { return rate_limiter_; }
+
     std::string ToString() const;
 
     // Ref counting for `PendingPayloads` use only. `PendingPayloads` class owns
@@ -182,6 +216,13 @@ class PayloadManager : public EndpointManager::FrameProcessor {
     DestroyCallback destroy_callback_;
     absl::flat_hash_map<std::string, EndpointInfo> endpoints_
         ABSL_GUARDED_BY(mutex_);
+    // Incoming progress not reported to the client yet.
+    std::optional<std::int64_t> unreported_bytes_transferred_
+        ABSL_GUARDED_BY(mutex_);
+    bool is_progress_update_scheduled_ ABSL_GUARDED_BY(mutex_) = false;
+    absl::Time last_progress_update_time_ ABSL_GUARDED_BY(mutex_) =
+        absl::InfinitePast();
+    RateLimiter rate_limiter_;
     int refcount_ = 0;
   };
 
@@ -273,11 +314,43 @@ class PayloadManager : public EndpointManager::FrameProcessor {
   // Returns list of endpoint ids.
   static EndpointIds EndpointsToEndpointIds(const Endpoints& endpoints);
 
+  // A chunk detached from an outgoing payload, charged to its rate limits and
+  // not sent yet.
+  struct ReservedChunk {
+    ByteArray body;
+    // The client and endpoint rate limiters charged for |body|, besides the
+    // payload's own.
+    std::vector<std::shared_ptr<RateLimiter>> rate_limiters;
+    // When the rate limits let |body| be sent.
+    absl::Time send_time;
+  };
+  // Progress of an outgoing payload, carried from one send task to the next.
+  struct OutgoingTransfer {
+    ClientProxy* client;
+    Payload::Id payload_id;
+    location::nearby::connections::PayloadTransferFrame::PayloadHeader
+        payload_header;
+    std::int64_t next_chunk_offset = 0;
+    size_t resume_offset = 0;
+    int index = 0;
+    // Set while a chunk is held back by a rate limit.
+    std::optional<ReservedChunk> held_chunk;
+  };
+
+  // Sends the chunks of |transfer| on |executor|, which runs every outgoing
+  // payload of its type. While a chunk is held back by a rate limit, the
+  // transfer is requeued instead, so that it doesn't hold up the others.
+  void SendPayloadChunks(SingleThreadExecutor* executor,
+                         std::unique_ptr<OutgoingTransfer> transfer);
+  // Sends the next chunk of |pending_payload|. Returns false once the payload
+  // is done with. Returns true with |held_chunk| set if the chunk must wait
+  // for a rate limit; the caller should try again later.
   bool SendPayloadLoop(
       ClientProxy* client, PendingPayload& pending_payload,
       location::nearby::connections::PayloadTransferFrame::PayloadHeader&
           payload_header,
-      std::int64_t& next_chunk_offset, size_t resume_offset, int index);
+      std::int64_t& next_chunk_offset, size_t resume_offset, int index,
+      std::optional<ReservedChunk>& held_chunk);
   void SendClientCallbacksForFinishedIncomingPayloadRunnable(
       ClientProxy* client, const std::string& endpoint_id,
       const location::nearby::connections::PayloadTransferFrame::PayloadHeader&
@@ -317,6 +390,27 @@ class PayloadManager : public EndpointManager::FrameProcessor {
 
   location::nearby::connections::PayloadTransferFrame::PayloadChunk
   CreatePayloadChunk(std::int64_t offset, ByteArray body, int index);
+  // Returns true if |payload_chunk| can be sent with an elided payload header,
+  // which only has the id and total size, to all of |endpoint_ids|. Only the
+  // first chunk of a payload needs the full header, to create the incoming
+  // payload.
+  bool CanElidePayloadHeader(
+      ClientProxy* client, const EndpointIds& endpoint_ids,
+      const location::nearby::connections::PayloadTransferFrame::PayloadChunk&
+          payload_chunk);
+  // Charges |chunk| of |pending_payload| to every rate limit that applies to
+  // sending it to |endpoint_ids|.
+  ReservedChunk ReserveRateLimits(ClientProxy* client,
+                                  PendingPayload& pending_payload,
+                                  const EndpointIds& endpoint_ids,
+                                  ByteArray chunk)
+      ABSL_LOCKS_EXCLUDED(rate_limiters_mutex_);
+  // Gives back the tokens of a reserved chunk that won't be sent.
+  static void RefundRateLimits(PendingPayload& pending_payload,
+                               const ReservedChunk& chunk);
+  void SetRateLimit(std::int64_t client_id, const std::string& endpoint_id,
+                    RateLimit rate_limit)
+      ABSL_LOCKS_EXCLUDED(rate_limiters_mutex_);
   bool IsLastChunk(
       location::nearby::connections::PayloadTransferFrame::PayloadChunk
           payload_chunk) {
@@ -405,6 +499,15 @@ class PayloadManager : public EndpointManager::FrameProcessor {
           payload_header,
       std::int32_t payload_chunk_flags, std::int64_t payload_chunk_offset,
       std::int64_t payload_chunk_body_size);
+  // Handles any chunk but the last one of an incoming payload on the reader
+  // thread. Progress updates for consecutive chunks are coalesced, so the
+  // status update thread is only involved once per batch of chunks.
+  void HandleSuccessfulIncomingIntermediateChunk(
+      ClientProxy* client, const std::string& endpoint_id,
+      PendingPayload& pending_payload,
+      location::nearby::connections::PayloadTransferFrame::PayloadHeader::
+          PayloadType payload_type,
+      std::int64_t payload_chunk_offset, std::int64_t payload_chunk_body_size);
 
   void ProcessDataPacket(ClientProxy* to_client,
                          const std::string& from_endpoint_id,
@@ -455,6 +558,42 @@ class PayloadManager : public EndpointManager::FrameProcessor {
           PayloadType type);
 
   void OnPendingPayloadDestroy(const PendingPayload* payload);
+
+  // DATAGRAM payloads bypass PendingPayload tracking. They are queued for
+  // their own low-priority lane and sent as a single frame, with no acks,
+  // control messages or resumption, and only to endpoints that announced
+  // support for them.
+  struct QueuedDatagram {
+    ClientProxy* client;
+    EndpointIds endpoint_ids;
+    Payload payload;
+  };
+  // Once this many datagrams are waiting to be sent, the oldest is dropped to
+  // make room for a new one.
+  static constexpr std::size_t kMaxQueuedDatagrams = 16;
+  // How long a datagram gives way to the chunks of other payloads being
+  // written, before it is sent anyway.
+  static constexpr absl::Duration kMaxDatagramDeferral = absl::Milliseconds(20);
+
+  void SendDatagram(ClientProxy* client, const EndpointIds& endpoint_ids,
+                    Payload payload) ABSL_LOCKS_EXCLUDED(datagram_mutex_);
+  // Sends the oldest queued datagram, if any, once no payload chunk is being
+  // written or kMaxDatagramDeferral passed. Runs on the datagram executor.
+  void SendNextDatagram() ABSL_LOCKS_EXCLUDED(datagram_mutex_);
+  // Bracket the write of a chunk of a non-datagram payload, which the
+  // datagram lane gives way to.
+  void BeginPayloadChunkWrite() ABSL_LOCKS_EXCLUDED(datagram_mutex_);
+  void EndPayloadChunkWrite() ABSL_LOCKS_EXCLUDED(datagram_mutex_);
+  // Reports the final status of an outgoing datagram to the client.
+  void NotifyDatagramResult(ClientProxy* client,
+                            const EndpointIds& endpoint_ids,
+                            const EndpointIds& failed_endpoint_ids,
+                            Payload::Id payload_id, std::int64_t size);
+  void ProcessDatagram(
+      ClientProxy* to_client, const std::string& from_endpoint_id,
+      location::nearby::connections::PayloadTransferFrame& frame)
+      ABSL_LOCKS_EXCLUDED(datagram_mutex_);
+
   mutable Mutex mutex_;
   std::string custom_save_path_;
   AtomicBoolean shutdown_{false};
@@ -463,11 +602,33 @@ class PayloadManager : public EndpointManager::FrameProcessor {
   SingleThreadExecutor bytes_payload_executor_;
   SingleThreadExecutor file_payload_executor_;
   SingleThreadExecutor stream_payload_executor_;
+  SingleThreadExecutor datagram_payload_executor_;
   SingleThreadExecutor payload_status_update_executor_;
   SingleThreadExecutor send_payload_ack_executor_;
+  // Requeues outgoing payloads held back by a rate limit.
+  ScheduledExecutor rate_limit_executor_;
   PendingPayloads pending_payloads_;
   EndpointManager* endpoint_manager_;
 
+  Mutex datagram_mutex_;
+  std::deque<QueuedDatagram> queued_datagrams_
+      ABSL_GUARDED_BY(datagram_mutex_);
+  int payload_chunk_writes_ ABSL_GUARDED_BY(datagram_mutex_) = 0;
+  ConditionVariable payload_chunk_writes_done_{&datagram_mutex_};
+  // Sequence number of the last datagram delivered from each endpoint.
+  absl::flat_hash_map<std::string, std::int64_t>
+      last_datagram_sequence_numbers_ ABSL_GUARDED_BY(datagram_mutex_);
+
+  // Client and endpoint rate limiters, keyed by client ID and endpoint ID. A
+  // client's own limiter has an empty endpoint ID.
+  Mutex rate_limiters_mutex_;
+  absl::flat_hash_map<std::pair<std::int64_t, std::string>,
+                      std::shared_ptr<RateLimiter>>
+      rate_limiters_ ABSL_GUARDED_BY(rate_limiters_mutex_);
+  // Whether |rate_limiters_| is not empty, so that chunks are sent without
+  // taking |rate_limiters_mutex_| when no limit is set.
+  std::atomic<bool> has_rate_limiters_ = false;
+
   // When callback processing cannot keep the speed of callback update, the
   // callback thread will be lag to the real transfer. In order to keep sync
   // between callback and sending/receiving threads, we will skip
@@ -476,9 +637,6 @@ class PayloadManager : public EndpointManager::FrameProcessor {
   int outgoing_chunk_update_count_ ABSL_GUARDED_BY(chunk_update_mutex_) = 0;
   absl::Time last_outgoing_chunk_update_time_
       ABSL_GUARDED_BY(chunk_update_mutex_) = absl::InfinitePast();
-  int incoming_chunk_update_count_ ABSL_GUARDED_BY(chunk_update_mutex_) = 0;
-  absl::Time last_incoming_chunk_update_time_
-      ABSL_GUARDED_BY(chunk_update_mutex_) = absl::InfinitePast();
 };
 
 }  // namespace connections
@@ -14,12 +14,15 @@
 
 #include "connections/implementation/payload_manager.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <string>
 #include <utility>
 
 #include "gtest/gtest.h"
 #include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "connections/implementation/analytics/packet_meta_data.h"
 #include "connections/implementation/offline_frames.h"
@@ -27,10 +30,13 @@
 #include "connections/listeners.h"
 #include "connections/medium_selector.h"
 #include "connections/payload.h"
+#include "connections/payload_type.h"
+#include "connections/rate_limit.h"
 #include "connections/status.h"
 #include "internal/platform/byte_array.h"
 #include "internal/platform/count_down_latch.h"
 #include "internal/platform/exception.h"
+#include "internal/platform/feature_flags.h"
 #include "internal/platform/input_stream.h"
 #include "internal/platform/logging.h"
 #include "internal/platform/medium_environment.h"
@@ -51,6 +57,12 @@ constexpr absl::string_view kDeviceB = "device-b";
 constexpr absl::string_view kMessage = "message";
 constexpr absl::Duration kProgressTimeout = absl::Milliseconds(1000);
 constexpr absl::Duration kDefaultTimeout = absl::Milliseconds(1000);
+// A chunk of a bulk stream, sent under a cap of half a chunk per second, so
+// that a chunk sent right after the burst is held back for about 2 seconds.
+constexpr size_t kBulkChunkSize = 100;
+constexpr RateLimit kBulkRateLimit{.bytes_per_second = kBulkChunkSize / 2,
+                                   .burst_bytes = kBulkChunkSize};
+constexpr absl::Duration kBulkRateLimitTimeout = absl::Seconds(3);
 
 constexpr BooleanMediumSelector kTestCases[] = {
     BooleanMediumSelector{
@@ -121,6 +133,19 @@ class PayloadSimulationUser : public SimulationUser {
                         Medium::WIFI_HOTSPOT, packet_meta_data);
   }
 
+  // Hands a DATA frame to the PayloadManager, as if it was read from
+  // |from_endpoint_id|.
+  void ReceiveChunk(const PayloadTransferFrame::PayloadHeader& header,
+                    const PayloadTransferFrame::PayloadChunk& chunk,
+                    const std::string& from_endpoint_id) {
+    OfflineFrame offline_frame;
+    offline_frame.ParseFromString(
+        std::string(parser::ForDataPayloadTransfer(header, chunk)));
+    PacketMetaData packet_meta_data;
+    pm_.OnIncomingFrame(offline_frame, from_endpoint_id, &client_,
+                        Medium::WIFI_LAN, packet_meta_data);
+  }
+
   Status CancelPayload() {
     if (sender_payload_id_) {
       return pm_.CancelPayload(&client_, sender_payload_id_);
@@ -129,6 +154,10 @@ class PayloadSimulationUser : public SimulationUser {
     }
   }
 
+  void SetEndpointRateLimit(RateLimit rate_limit) {
+    pm_.SetEndpointRateLimit(&client_, discovered_.endpoint_id, rate_limit);
+  }
+
   bool IsConnected() const {
     return client_.IsConnectedToEndpoint(discovered_.endpoint_id);
   }
@@ -200,6 +229,70 @@ TEST_P(PayloadManagerTest, CanSendBytePayload) {
   env_.Stop();
 }
 
+TEST_P(PayloadManagerTest, CanSendDatagramPayload) {
+  env_.Start();
+  PayloadSimulationUser user_a(kDeviceA, GetParam());
+  PayloadSimulationUser user_b(kDeviceB, GetParam());
+  ASSERT_TRUE(SetupConnection(user_a, user_b));
+
+  user_a.ExpectPayload(payload_latch_);
+  user_b.SendPayload(Payload::Datagram(ByteArray{std::string(kMessage)}, 1));
+  EXPECT_TRUE(payload_latch_.Await(kDefaultTimeout).result());
+  EXPECT_EQ(user_a.GetPayload().GetType(), PayloadType::kDatagram);
+  EXPECT_EQ(user_a.GetPayload().AsBytes(), ByteArray(std::string(kMessage)));
+  EXPECT_EQ(user_a.GetPayload().GetSequenceNumber(), 1);
+  EXPECT_TRUE(user_b.WaitForProgress(
+      [](const PayloadProgressInfo& info) {
+        return info.status == PayloadProgressInfo::Status::kSuccess;
+      },
+      kDefaultTimeout));
+
+  user_a.Stop();
+  user_b.Stop();
+  env_.Stop();
+}
+
+TEST_P(PayloadManagerTest, DropsStaleDatagramPayload) {
+  env_.Start();
+  PayloadSimulationUser user_a(kDeviceA, GetParam());
+  PayloadSimulationUser user_b(kDeviceB, GetParam());
+  ASSERT_TRUE(SetupConnection(user_a, user_b));
+  CountDownLatch latch(2);
+
+  user_a.ExpectPayload(latch);
+  user_b.SendPayload(Payload::Datagram(ByteArray("new"), 2));
+  user_b.SendPayload(Payload::Datagram(ByteArray("stale"), 1));
+  user_b.SendPayload(Payload::Datagram(ByteArray("newest"), 3));
+  EXPECT_TRUE(latch.Await(kDefaultTimeout).result());
+  EXPECT_EQ(user_a.GetPayload().AsBytes(), ByteArray("newest"));
+  EXPECT_EQ(user_a.GetPayload().GetSequenceNumber(), 3);
+
+  user_a.Stop();
+  user_b.Stop();
+  env_.Stop();
+}
+
+TEST_P(PayloadManagerTest, OversizedDatagramPayloadFails) {
+  env_.Start();
+  PayloadSimulationUser user_a(kDeviceA, GetParam());
+  PayloadSimulationUser user_b(kDeviceB, GetParam());
+  ASSERT_TRUE(SetupConnection(user_a, user_b));
+
+  user_a.ExpectPayload(payload_latch_);
+  user_b.SendPayload(
+      Payload::Datagram(ByteArray(Payload::kMaxDatagramSize + 1)));
+  EXPECT_TRUE(user_b.WaitForProgress(
+      [](const PayloadProgressInfo& info) {
+        return info.status == PayloadProgressInfo::Status::kFailure;
+      },
+      kDefaultTimeout));
+  EXPECT_FALSE(payload_latch_.Await(absl::Milliseconds(100)).result());
+
+  user_a.Stop();
+  user_b.Stop();
+  env_.Stop();
+}
+
 TEST_P(PayloadManagerTest, PayloadId0IsError) {
   env_.Start();
   PayloadSimulationUser user_a(kDeviceA, GetParam());
@@ -367,6 +460,248 @@ TEST_P(PayloadManagerTest, CanCancelPayloadOnSenderSide) {
   env_.Stop();
 }
 
+TEST_P(PayloadManagerTest, CanCancelStalledStreamOnSenderSide) {
+  env_.Start();
+  PayloadSimulationUser user_a(kDeviceA, GetParam());
+  PayloadSimulationUser user_b(kDeviceB, GetParam());
+  ASSERT_TRUE(SetupConnection(user_a, user_b));
+  auto [input, tx] = CreatePipe();
+  user_a.ExpectPayload(payload_latch_);
+  const ByteArray message{std::string(kMessage)};
+  tx->Write(message);
+
+  user_b.SendPayload(Payload(std::move(input)));
+  ASSERT_TRUE(payload_latch_.Await(kDefaultTimeout).result());
+  EXPECT_TRUE(user_a.WaitForProgress(
+      [&message](const PayloadProgressInfo& info) {
+        return info.bytes_transferred >= message.size();
+      },
+      kProgressTimeout));
+
+  // The sender is now blocked waiting for more data, which never comes.
+  EXPECT_EQ(user_b.CancelPayload(), Status{Status::kSuccess});
+
+  EXPECT_TRUE(user_a.WaitForProgress(
+      [status = PayloadProgressInfo::Status::kCanceled](
+          const PayloadProgressInfo& info) { return info.status == status; },
+      kProgressTimeout));
+  EXPECT_FALSE(tx->Write(message).Ok());
+
+  tx->Close();
+  user_a.Stop();
+  user_b.Stop();
+  env_.Stop();
+}
+
+TEST_P(PayloadManagerTest, CapsStreamPayloadRate) {
+  env_.Start();
+  PayloadSimulationUser user_a(kDeviceA, GetParam());
+  PayloadSimulationUser user_b(kDeviceB, GetParam());
+  ASSERT_TRUE(SetupConnection(user_a, user_b));
+  auto [input, tx] = CreatePipe();
+  user_a.ExpectPayload(payload_latch_);
+  const ByteArray chunk{std::string(kBulkChunkSize, 'x')};
+  tx->Write(chunk);
+
+  Payload bulk(std::move(input));
+  bulk.SetRateLimit(kBulkRateLimit);
+  Payload::Id bulk_id = bulk.GetId();
+  user_b.SendPayload(std::move(bulk));
+  ASSERT_TRUE(payload_latch_.Await(kDefaultTimeout).result());
+  // Keep the stream open while other payloads arrive.
+  Payload incoming_bulk = std::move(user_a.GetPayload());
+  EXPECT_TRUE(user_a.WaitForProgress(
+      [bulk_id](const PayloadProgressInfo& info) {
+        return info.payload_id == bulk_id &&
+               info.bytes_transferred >= kBulkChunkSize;
+      },
+      kProgressTimeout));
+
+  // The burst is spent, so the next chunk is held back by the cap...
+  absl::Time held_at = absl::Now();
+  tx->Write(chunk);
+
+  // ...while small interactive payloads go through.
+  absl::Duration max_latency;
+  for (int i = 0; i < 5; ++i) {
+    Payload message{ByteArray(std::string(kMessage))};
+    Payload::Id message_id = message.GetId();
+    absl::Time sent_at = absl::Now();
+    user_b.SendPayload(std::move(message));
+    EXPECT_TRUE(user_a.WaitForProgress(
+        [message_id](const PayloadProgressInfo& info) {
+          return info.payload_id == message_id &&
+                 info.status == PayloadProgressInfo::Status::kSuccess;
+        },
+        kProgressTimeout));
+    max_latency = std::max(max_latency, absl::Now() - sent_at);
+  }
+  NEARBY_LOGS(INFO) << "Interactive payload latency: max=" << max_latency;
+
+  EXPECT_TRUE(user_a.WaitForProgress(
+      [bulk_id](const PayloadProgressInfo& info) {
+        return info.payload_id == bulk_id &&
+               info.bytes_transferred >= 2 * kBulkChunkSize;
+      },
+      kBulkRateLimitTimeout));
+  absl::Duration held_for = absl::Now() - held_at;
+  NEARBY_LOGS(INFO) << "Capped chunk held for " << held_for;
+  EXPECT_GE(held_for, absl::Seconds(1));
+  EXPECT_LT(max_latency, held_for);
+
+  tx->Close();
+  user_a.Stop();
+  user_b.Stop();
+  env_.Stop();
+}
+
+TEST_P(PayloadManagerTest, CanLiftEndpointRateLimit) {
+  env_.Start();
+  PayloadSimulationUser user_a(kDeviceA, GetParam());
+  PayloadSimulationUser user_b(kDeviceB, GetParam());
+  ASSERT_TRUE(SetupConnection(user_a, user_b));
+  user_b.SetEndpointRateLimit(kBulkRateLimit);
+  auto [input, tx] = CreatePipe();
+  user_a.ExpectPayload(payload_latch_);
+  const ByteArray chunk{std::string(kBulkChunkSize, 'x')};
+  tx->Write(chunk);
+
+  user_b.SendPayload(Payload(std::move(input)));
+  ASSERT_TRUE(payload_latch_.Await(kDefaultTimeout).result());
+  EXPECT_TRUE(user_a.WaitForProgress(
+      [](const PayloadProgressInfo& info) {
+        return info.bytes_transferred >= kBulkChunkSize;
+      },
+      kProgressTimeout));
+
+  absl::Time held_at = absl::Now();
+  tx->Write(chunk);
+  EXPECT_TRUE(user_a.WaitForProgress(
+      [](const PayloadProgressInfo& info) {
+        return info.bytes_transferred >= 2 * kBulkChunkSize;
+      },
+      kBulkRateLimitTimeout));
+  EXPECT_GE(absl::Now() - held_at, absl::Seconds(1));
+
+  // Without the cap, the next chunk is sent right away.
+  user_b.SetEndpointRateLimit(RateLimit{});
+  tx->Write(chunk);
+  EXPECT_TRUE(user_a.WaitForProgress(
+      [](const PayloadProgressInfo& info) {
+        return info.bytes_transferred >= 3 * kBulkChunkSize;
+      },
+      kProgressTimeout));
+
+  tx->Close();
+  user_a.Stop();
+  user_b.Stop();
+  env_.Stop();
+}
+
+TEST_P(PayloadManagerTest, HeldPayloadLetsSameTypePayloadsThrough) {
+  env_.Start();
+  PayloadSimulationUser user_a(kDeviceA, GetParam());
+  PayloadSimulationUser user_b(kDeviceB, GetParam());
+  ASSERT_TRUE(SetupConnection(user_a, user_b));
+  auto [input, tx] = CreatePipe();
+  user_a.ExpectPayload(payload_latch_);
+  const ByteArray chunk{std::string(kBulkChunkSize, 'x')};
+  tx->Write(chunk);
+
+  Payload bulk(std::move(input));
+  bulk.SetRateLimit(kBulkRateLimit);
+  Payload::Id bulk_id = bulk.GetId();
+  user_b.SendPayload(std::move(bulk));
+  ASSERT_TRUE(payload_latch_.Await(kDefaultTimeout).result());
+  Payload incoming_bulk = std::move(user_a.GetPayload());
+  EXPECT_TRUE(user_a.WaitForProgress(
+      [bulk_id](const PayloadProgressInfo& info) {
+        return info.payload_id == bulk_id &&
+               info.bytes_transferred >= kBulkChunkSize;
+      },
+      kProgressTimeout));
+  absl::Time held_at = absl::Now();
+  tx->Write(chunk);
+
+  // Another stream shares the sender thread of the held one.
+  auto [other_input, other_tx] = CreatePipe();
+  CountDownLatch other_latch(1);
+  user_a.ExpectPayload(other_latch);
+  other_tx->Write(ByteArray(std::string(kMessage)));
+  other_tx->Close();
+  Payload other(std::move(other_input));
+  Payload::Id other_id = other.GetId();
+  user_b.SendPayload(std::move(other));
+  EXPECT_TRUE(user_a.WaitForProgress(
+      [other_id](const PayloadProgressInfo& info) {
+        return info.payload_id == other_id &&
+               info.status == PayloadProgressInfo::Status::kSuccess;
+      },
+      kProgressTimeout));
+  absl::Duration other_latency = absl::Now() - held_at;
+
+  EXPECT_TRUE(user_a.WaitForProgress(
+      [bulk_id](const PayloadProgressInfo& info) {
+        return info.payload_id == bulk_id &&
+               info.bytes_transferred >= 2 * kBulkChunkSize;
+      },
+      kBulkRateLimitTimeout));
+  EXPECT_LT(other_latency, absl::Now() - held_at);
+
+  tx->Close();
+  user_a.Stop();
+  user_b.Stop();
+  env_.Stop();
+}
+
+TEST_P(PayloadManagerTest, CancelingHeldPayloadRefundsRateLimit) {
+  env_.Start();
+  PayloadSimulationUser user_a(kDeviceA, GetParam());
+  PayloadSimulationUser user_b(kDeviceB, GetParam());
+  ASSERT_TRUE(SetupConnection(user_a, user_b));
+  user_b.SetEndpointRateLimit(kBulkRateLimit);
+  auto [input, tx] = CreatePipe();
+  user_a.ExpectPayload(payload_latch_);
+  const ByteArray chunk{std::string(kBulkChunkSize, 'x')};
+  tx->Write(chunk);
+
+  user_b.SendPayload(Payload(std::move(input)));
+  ASSERT_TRUE(payload_latch_.Await(kDefaultTimeout).result());
+  Payload incoming_bulk = std::move(user_a.GetPayload());
+  EXPECT_TRUE(user_a.WaitForProgress(
+      [](const PayloadProgressInfo& info) {
+        return info.bytes_transferred >= kBulkChunkSize;
+      },
+      kProgressTimeout));
+  // Held back for about 2 seconds.
+  tx->Write(chunk);
+  SystemClock::Sleep(absl::Milliseconds(100));
+
+  EXPECT_EQ(user_b.CancelPayload(), Status{Status::kSuccess});
+  EXPECT_TRUE(user_a.WaitForProgress(
+      [](const PayloadProgressInfo& info) {
+        return info.status == PayloadProgressInfo::Status::kCanceled;
+      },
+      kProgressTimeout));
+
+  // The canceled chunk's tokens are back, so a small payload isn't held back
+  // behind it.
+  Payload message{ByteArray(std::string(kMessage))};
+  Payload::Id message_id = message.GetId();
+  user_b.SendPayload(std::move(message));
+  EXPECT_TRUE(user_a.WaitForProgress(
+      [message_id](const PayloadProgressInfo& info) {
+        return info.payload_id == message_id &&
+               info.status == PayloadProgressInfo::Status::kSuccess;
+      },
+      kProgressTimeout));
+
+  tx->Close();
+  user_a.Stop();
+  user_b.Stop();
+  env_.Stop();
+}
+
 TEST_P(PayloadManagerTest, SendPayloadWithSkip_StreamPayload) {
   constexpr size_t kOffset = 3;
   env_.Start();
@@ -428,6 +763,133 @@ TEST_P(PayloadManagerTest, OfflineFrame_BeforeConnected_ShouldDrop) {
   env_.Stop();
 }
 
+TEST_P(PayloadManagerTest, ReportsProgressOfIncomingChunks) {
+  constexpr int kChunks = 100;
+  constexpr std::size_t kPayloadSize = kChunks * kMessage.size();
+  env_.Start();
+  PayloadSimulationUser user_a(kDeviceA, GetParam());
+  PayloadSimulationUser user_b(kDeviceB, GetParam());
+  ASSERT_TRUE(SetupConnection(user_a, user_b));
+  user_a.ExpectPayload(payload_latch_);
+
+  PayloadTransferFrame::PayloadHeader header;
+  header.set_id(Payload::GenerateId());
+  header.set_type(PayloadTransferFrame::PayloadHeader::STREAM);
+  header.set_total_size(-1);
+  for (int index = 0; index <= kChunks; ++index) {
+    PayloadTransferFrame::PayloadChunk chunk;
+    chunk.set_offset(std::int64_t{index} * kMessage.size());
+    chunk.set_index(index);
+    if (index < kChunks) {
+      chunk.set_body(std::string(kMessage));
+    } else {
+      chunk.set_flags(PayloadTransferFrame::PayloadChunk::LAST_CHUNK);
+    }
+    user_a.ReceiveChunk(header, chunk, user_a.GetDiscovered().endpoint_id);
+  }
+
+  ASSERT_TRUE(payload_latch_.Await(kDefaultTimeout).result());
+  // The progress of the intermediate chunks may be coalesced, but the final
+  // update reports every chunk.
+  EXPECT_TRUE(user_a.WaitForProgress(
+      [&header](const PayloadProgressInfo& info) {
+        return info.payload_id == header.id() &&
+               info.status == PayloadProgressInfo::Status::kSuccess &&
+               info.bytes_transferred ==
+                   static_cast<std::int64_t>(kPayloadSize);
+      },
+      kProgressTimeout));
+  InputStream* rx = user_a.GetPayload().AsStream();
+  ASSERT_NE(rx, nullptr);
+  EXPECT_EQ(rx->ReadExactly(kPayloadSize).result().size(), kPayloadSize);
+  user_a.Stop();
+  user_b.Stop();
+  env_.Stop();
+}
+
+TEST_P(PayloadManagerTest, ReceivesChunksWithElidedHeaders) {
+  constexpr int kChunks = 10;
+  constexpr std::size_t kPayloadSize = kChunks * kMessage.size();
+  env_.Start();
+  PayloadSimulationUser user_a(kDeviceA, GetParam());
+  PayloadSimulationUser user_b(kDeviceB, GetParam());
+  ASSERT_TRUE(SetupConnection(user_a, user_b));
+  user_a.ExpectPayload(payload_latch_);
+
+  PayloadTransferFrame::PayloadHeader header;
+  header.set_id(Payload::GenerateId());
+  header.set_type(PayloadTransferFrame::PayloadHeader::STREAM);
+  header.set_total_size(-1);
+  // Later chunks only carry the id and total size of the payload.
+  PayloadTransferFrame::PayloadHeader elided_header;
+  elided_header.set_id(header.id());
+  elided_header.set_total_size(header.total_size());
+  for (int index = 0; index <= kChunks; ++index) {
+    PayloadTransferFrame::PayloadChunk chunk;
+    chunk.set_offset(std::int64_t{index} * kMessage.size());
+    chunk.set_index(index);
+    if (index < kChunks) {
+      chunk.set_body(std::string(kMessage));
+    } else {
+      chunk.set_flags(PayloadTransferFrame::PayloadChunk::LAST_CHUNK);
+    }
+    user_a.ReceiveChunk(index == 0 ? header : elided_header, chunk,
+                        user_a.GetDiscovered().endpoint_id);
+  }
+
+  ASSERT_TRUE(payload_latch_.Await(kDefaultTimeout).result());
+  EXPECT_TRUE(user_a.WaitForProgress(
+      [&header](const PayloadProgressInfo& info) {
+        return info.payload_id == header.id() &&
+               info.status == PayloadProgressInfo::Status::kSuccess &&
+               info.bytes_transferred ==
+                   static_cast<std::int64_t>(kPayloadSize);
+      },
+      kProgressTimeout));
+  InputStream* rx = user_a.GetPayload().AsStream();
+  ASSERT_NE(rx, nullptr);
+  EXPECT_EQ(rx->ReadExactly(kPayloadSize).result().size(), kPayloadSize);
+  user_a.Stop();
+  user_b.Stop();
+  env_.Stop();
+}
+
+TEST_P(PayloadManagerTest, CanSendStreamPayloadWithHeaderElision) {
+  FeatureFlags::GetMutableFlagsForTesting().enable_payload_header_elision =
+      true;
+  env_.Start();
+  PayloadSimulationUser user_a(kDeviceA, GetParam());
+  PayloadSimulationUser user_b(kDeviceB, GetParam());
+  ASSERT_TRUE(SetupConnection(user_a, user_b));
+
+  auto [input, tx] = CreatePipe();
+  user_a.ExpectPayload(payload_latch_);
+  const ByteArray message{std::string(kMessage)};
+  tx->Write(message);
+  user_b.SendPayload(Payload(std::move(input)));
+  ASSERT_TRUE(payload_latch_.Await(kDefaultTimeout).result());
+  ASSERT_NE(user_a.GetPayload().AsStream(), nullptr);
+  InputStream& rx = *user_a.GetPayload().AsStream();
+  EXPECT_EQ(rx.Read(kChunkSize).result(), message);
+
+  // Sent with an elided header.
+  tx->Write(message);
+  EXPECT_TRUE(user_a.WaitForProgress(
+      [&message](const PayloadProgressInfo& info) {
+        return info.bytes_transferred >= 2 * message.size();
+      },
+      kProgressTimeout));
+  EXPECT_EQ(rx.Read(kChunkSize).result(), message);
+
+  rx.Close();
+  tx->Close();
+  user_a.Stop();
+  user_b.Stop();
+  env_.Stop();
+  FeatureFlags::GetMutableFlagsForTesting().enable_payload_header_elision =
+      false;
+}
+
 INSTANTIATE_TEST_SUITE_P(ParametrisedPayloadManagerTest, PayloadManagerTest,
                          ::testing::ValuesIn(kTestCases));
 
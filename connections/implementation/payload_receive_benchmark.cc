@@ -0,0 +1,159 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Rate at which PayloadManager handles the incoming chunks of a STREAM
+// payload.
+//
+// Two simulation users are connected over Wi-Fi LAN. PAYLOAD_TRANSFER DATA
+// frames are fed straight into the receiver's PayloadManager, as the
+// EndpointManager reader thread does, so the medium is not measured. Each
+// iteration receives one payload of kChunksPerPayload chunks, with the chunk
+// size in bytes as the benchmark argument, and waits for the final progress
+// update of the payload. Each benchmark reports this counter:
+//   chunks_per_second   Chunks handled per second, including client callbacks.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/time.h"
+#include "connections/implementation/analytics/packet_meta_data.h"
+#include "connections/implementation/offline_frames.h"
+#include "connections/implementation/simulation_user.h"
+#include "connections/implementation/simulation_user_pair.h"
+#include "connections/listeners.h"
+#include "connections/medium_selector.h"
+#include "connections/payload.h"
+#include "internal/platform/byte_array.h"
+#include "internal/platform/count_down_latch.h"
+#include "proto/connections_enums.pb.h"
+
+namespace nearby {
+namespace connections {
+namespace {
+
+using ::location::nearby::connections::OfflineFrame;
+using ::location::nearby::connections::PayloadTransferFrame;
+using ::location::nearby::proto::connections::Medium;
+using ::nearby::analytics::PacketMetaData;
+
+constexpr absl::string_view kServiceId = "service-id";
+constexpr absl::Duration kTimeout = absl::Seconds(10);
+constexpr int kChunksPerPayload = 1000;
+
+class ReceiverSimulationUser : public SimulationUser {
+ public:
+  explicit ReceiverSimulationUser(absl::string_view name)
+      : SimulationUser(std::string(name),
+                       BooleanMediumSelector{.wifi_lan = true}) {}
+
+  // Hands |frames| to the PayloadManager as if they were read from the
+  // connected endpoint.
+  void ReceiveFrames(std::vector<OfflineFrame>& frames) {
+    for (OfflineFrame& frame : frames) {
+      pm_.OnIncomingFrame(frame, discovered_.endpoint_id, &client_,
+                          Medium::WIFI_LAN, packet_meta_data_);
+    }
+  }
+
+ private:
+  PacketMetaData packet_meta_data_;
+};
+
+// Feeds payload frames to the receiver of a connected pair. One instance is
+// shared by all benchmarks.
+class ReceiveSimulation {
+ public:
+  bool connected() const { return users_.connected(); }
+
+  // Returns the frames of a new STREAM payload of kChunksPerPayload chunks of
+  // |chunk_size| bytes, followed by the empty last chunk.
+  static std::vector<OfflineFrame> CreatePayloadFrames(int chunk_size) {
+    PayloadTransferFrame::PayloadHeader header;
+    header.set_id(Payload::GenerateId());
+    header.set_type(PayloadTransferFrame::PayloadHeader::STREAM);
+    header.set_total_size(-1);
+    std::string body(chunk_size, 'x');
+    std::vector<OfflineFrame> frames(kChunksPerPayload + 1);
+    for (int index = 0; index <= kChunksPerPayload; ++index) {
+      PayloadTransferFrame::PayloadChunk chunk;
+      chunk.set_offset(std::int64_t{index} * chunk_size);
+      chunk.set_index(index);
+      if (index < kChunksPerPayload) {
+        chunk.set_body(body);
+      } else {
+        chunk.set_flags(PayloadTransferFrame::PayloadChunk::LAST_CHUNK);
+      }
+      frames[index].ParseFromString(
+          std::string(parser::ForDataPayloadTransfer(header, chunk)));
+    }
+    return frames;
+  }
+
+  // Receives |frames| and waits until the client is told that their payload
+  // was received.
+  bool ReceivePayload(std::vector<OfflineFrame>& frames) {
+    Payload::Id payload_id =
+        frames.front().v1().payload_transfer().payload_header().id();
+    users_.receiver().ReceiveFrames(frames);
+    return users_.receiver().WaitForProgress(
+        [payload_id](const PayloadProgressInfo& info) {
+          return info.payload_id == payload_id &&
+                 info.status == PayloadProgressInfo::Status::kSuccess;
+        },
+        kTimeout);
+  }
+
+ private:
+  SimulationUserPair<ReceiverSimulationUser> users_{kServiceId, kTimeout};
+};
+
+ReceiveSimulation& GetSimulation() {
+  static ReceiveSimulation* simulation = new ReceiveSimulation();
+  return *simulation;
+}
+
+void BM_ReceiveStreamChunks(benchmark::State& state) {
+  ReceiveSimulation& simulation = GetSimulation();
+  if (!simulation.connected()) {
+    state.SkipWithError("Simulation users failed to connect.");
+    return;
+  }
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::vector<OfflineFrame> frames =
+        ReceiveSimulation::CreatePayloadFrames(state.range(0));
+    state.ResumeTiming();
+    if (!simulation.ReceivePayload(frames)) {
+      state.SkipWithError("Payload was not received.");
+      return;
+    }
+  }
+  state.counters["chunks_per_second"] = benchmark::Counter(
+      state.iterations() * kChunksPerPayload, benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_ReceiveStreamChunks)
+    ->Arg(256)
+    ->Arg(4 * 1024)
+    ->Arg(64 * 1024)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace connections
+}  // namespace nearby
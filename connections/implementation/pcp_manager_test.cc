@@ -237,7 +237,8 @@ INSTANTIATE_TEST_SUITE_P(ParametrisedPcpManagerTest, PcpManagerTest,
 
 // Verifies that InjectEndpoint() can be run successfully; does not test the
 // full connection flow given that normal discovery/advertisement is skipped.
-// Note: Not parameterized because InjectEndpoint only works over Bluetooth.
+// Note: Not parameterized; Wi-Fi LAN and BLE injection are covered by
+// p2p_cluster_pcp_handler_test.
 TEST_F(PcpManagerTest, InjectEndpoint) {
   env_.Start();
   SimulationUser user_a(kDeviceA, BooleanMediumSelector{.bluetooth = true});
@@ -0,0 +1,82 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "connections/implementation/rate_limiter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+#include "absl/time/time.h"
+#include "connections/rate_limit.h"
+#include "internal/platform/implementation/system_clock.h"
+#include "internal/platform/mutex_lock.h"
+
+namespace nearby {
+namespace connections {
+
+void RateLimiter::SetRateLimit(RateLimit rate_limit) {
+  MutexLock lock(&mutex_);
+  absl::Time now = SystemClock::ElapsedRealtime();
+  bool was_limited = !rate_limit_.IsUnlimited();
+  if (was_limited) Refill(now);
+  rate_limit_ = rate_limit;
+  last_refill_ = now;
+  if (rate_limit.IsUnlimited()) {
+    is_limited_.store(false, std::memory_order_release);
+    return;
+  }
+
+  burst_bytes_ = rate_limit.burst_bytes > 0 ? rate_limit.burst_bytes
+                                            : rate_limit.bytes_per_second;
+  // A new limit starts with a full bucket.
+  tokens_ = was_limited ? std::min(tokens_, burst_bytes_) : burst_bytes_;
+  is_limited_.store(true, std::memory_order_release);
+}
+
+RateLimit RateLimiter::GetRateLimit() const {
+  MutexLock lock(&mutex_);
+  return rate_limit_;
+}
+
+absl::Duration RateLimiter::Reserve(std::int64_t bytes) {
+  if (IsUnlimited()) return absl::ZeroDuration();
+
+  MutexLock lock(&mutex_);
+  if (rate_limit_.IsUnlimited()) return absl::ZeroDuration();
+  Refill(SystemClock::ElapsedRealtime());
+  tokens_ -= bytes;
+  if (tokens_ >= 0) return absl::ZeroDuration();
+  return absl::Seconds(-tokens_ / rate_limit_.bytes_per_second);
+}
+
+void RateLimiter::Refund(std::int64_t bytes) {
+  if (IsUnlimited()) return;
+
+  MutexLock lock(&mutex_);
+  if (rate_limit_.IsUnlimited()) return;
+  Refill(SystemClock::ElapsedRealtime());
+  tokens_ = std::min(burst_bytes_, tokens_ + bytes);
+}
+
+void RateLimiter::Refill(absl::Time now) {
+  double elapsed_seconds = absl::ToDoubleSeconds(now - last_refill_);
+  last_refill_ = now;
+  if (elapsed_seconds <= 0) return;
+  tokens_ = std::min(burst_bytes_,
+                     tokens_ + elapsed_seconds * rate_limit_.bytes_per_second);
+}
+
+}  // namespace connections
+}  // namespace nearby
@@ -0,0 +1,75 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef CORE_INTERNAL_RATE_LIMITER_H_
+#define CORE_INTERNAL_RATE_LIMITER_H_
+
+#include <atomic>
+#include <cstdint>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/time/time.h"
+#include "connections/rate_limit.h"
+#include "internal/platform/mutex.h"
+
+namespace nearby {
+namespace connections {
+
+// Token bucket enforcing a RateLimit on outgoing payload chunks.
+//
+// Reserve() takes the tokens for a chunk right away and returns how long the
+// sender must wait before sending it. The bucket may go into debt, so that a
+// chunk larger than the burst is still sent, and senders sharing the bucket
+// wait their turn in the order they reserved.
+// This class is thread-safe.
+class RateLimiter {
+ public:
+  // Creates an unlimited rate limiter.
+  RateLimiter() = default;
+  explicit RateLimiter(RateLimit rate_limit) { SetRateLimit(rate_limit); }
+
+  // Changes the rate limit. Tokens accumulated so far are kept, up to the new
+  // burst size.
+  void SetRateLimit(RateLimit rate_limit) ABSL_LOCKS_EXCLUDED(mutex_);
+  RateLimit GetRateLimit() const ABSL_LOCKS_EXCLUDED(mutex_);
+
+  // Returns true if there is no rate limit. Lock-free.
+  bool IsUnlimited() const {
+    return !is_limited_.load(std::memory_order_acquire);
+  }
+
+  // Takes |bytes| tokens and returns how long to wait before sending them.
+  absl::Duration Reserve(std::int64_t bytes) ABSL_LOCKS_EXCLUDED(mutex_);
+
+  // Gives back |bytes| tokens taken by Reserve() for a chunk that was not
+  // sent, up to the burst size.
+  void Refund(std::int64_t bytes) ABSL_LOCKS_EXCLUDED(mutex_);
+
+ private:
+  // Adds the tokens earned since the last refill.
+  void Refill(absl::Time now) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  std::atomic<bool> is_limited_ = false;
+  mutable Mutex mutex_;
+  RateLimit rate_limit_ ABSL_GUARDED_BY(mutex_);
+  double burst_bytes_ ABSL_GUARDED_BY(mutex_) = 0;
+  // Negative while in debt.
+  double tokens_ ABSL_GUARDED_BY(mutex_) = 0;
+  absl::Time last_refill_ ABSL_GUARDED_BY(mutex_);
+};
+
+}  // namespace connections
+}  // namespace nearby
+
+#endif  // CORE_INTERNAL_RATE_LIMITER_H_
@@ -0,0 +1,126 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "connections/implementation/rate_limiter.h"
+
+#include "gtest/gtest.h"
+#include "absl/time/time.h"
+#include "connections/rate_limit.h"
+
+namespace nearby {
+namespace connections {
+namespace {
+
+// Refills between two calls add a little to the bucket; well under a
+// millisecond's worth at the rates below.
+constexpr double kToleranceSeconds = 0.05;
+
+TEST(RateLimiterTest, UnlimitedByDefault) {
+  RateLimiter rate_limiter;
+
+  EXPECT_TRUE(rate_limiter.IsUnlimited());
+  EXPECT_EQ(rate_limiter.Reserve(1 << 30), absl::ZeroDuration());
+}
+
+TEST(RateLimiterTest, SendsBurstWithoutWaiting) {
+  RateLimiter rate_limiter(
+      RateLimit{.bytes_per_second = 1000, .burst_bytes = 4000});
+
+  EXPECT_FALSE(rate_limiter.IsUnlimited());
+  EXPECT_EQ(rate_limiter.Reserve(3000), absl::ZeroDuration());
+  EXPECT_EQ(rate_limiter.Reserve(1000), absl::ZeroDuration());
+}
+
+TEST(RateLimiterTest, BurstDefaultsToOneSecond) {
+  RateLimiter rate_limiter(RateLimit{.bytes_per_second = 1000});
+
+  EXPECT_EQ(rate_limiter.Reserve(1000), absl::ZeroDuration());
+  EXPECT_NEAR(absl::ToDoubleSeconds(rate_limiter.Reserve(500)), 0.5,
+              kToleranceSeconds);
+}
+
+TEST(RateLimiterTest, WaitsForTokensBeyondBurst) {
+  RateLimiter rate_limiter(
+      RateLimit{.bytes_per_second = 1000, .burst_bytes = 1000});
+  rate_limiter.Reserve(1000);
+
+  EXPECT_NEAR(absl::ToDoubleSeconds(rate_limiter.Reserve(2000)), 2.0,
+              kToleranceSeconds);
+  // Later reservations queue behind the debt.
+  EXPECT_NEAR(absl::ToDoubleSeconds(rate_limiter.Reserve(1000)), 3.0,
+              kToleranceSeconds);
+}
+
+TEST(RateLimiterTest, NewRateAppliesToDebt) {
+  RateLimiter rate_limiter(
+      RateLimit{.bytes_per_second = 1000, .burst_bytes = 1000});
+  rate_limiter.Reserve(2000);
+
+  rate_limiter.SetRateLimit(
+      RateLimit{.bytes_per_second = 4000, .burst_bytes = 1000});
+
+  EXPECT_NEAR(absl::ToDoubleSeconds(rate_limiter.Reserve(1000)), 0.5,
+              kToleranceSeconds);
+  EXPECT_EQ(rate_limiter.GetRateLimit().bytes_per_second, 4000);
+}
+
+TEST(RateLimiterTest, RefundPaysBackDebt) {
+  RateLimiter rate_limiter(
+      RateLimit{.bytes_per_second = 1000, .burst_bytes = 1000});
+  rate_limiter.Reserve(1000);
+  rate_limiter.Reserve(2000);
+
+  rate_limiter.Refund(2000);
+
+  EXPECT_NEAR(absl::ToDoubleSeconds(rate_limiter.Reserve(1000)), 1.0,
+              kToleranceSeconds);
+}
+
+TEST(RateLimiterTest, RefundDoesNotExceedBurst) {
+  RateLimiter rate_limiter(
+      RateLimit{.bytes_per_second = 1000, .burst_bytes = 1000});
+
+  rate_limiter.Refund(5000);
+
+  EXPECT_EQ(rate_limiter.Reserve(1000), absl::ZeroDuration());
+  EXPECT_NEAR(absl::ToDoubleSeconds(rate_limiter.Reserve(1000)), 1.0,
+              kToleranceSeconds);
+}
+
+TEST(RateLimiterTest, CanRemoveLimit) {
+  RateLimiter rate_limiter(
+      RateLimit{.bytes_per_second = 1000, .burst_bytes = 1000});
+  rate_limiter.Reserve(5000);
+
+  rate_limiter.SetRateLimit(RateLimit{});
+
+  EXPECT_TRUE(rate_limiter.IsUnlimited());
+  EXPECT_EQ(rate_limiter.Reserve(5000), absl::ZeroDuration());
+}
+
+TEST(RateLimiterTest, NewLimitStartsWithFullBucket) {
+  RateLimiter rate_limiter(
+      RateLimit{.bytes_per_second = 1000, .burst_bytes = 1000});
+  rate_limiter.Reserve(5000);
+  rate_limiter.SetRateLimit(RateLimit{});
+
+  rate_limiter.SetRateLimit(
+      RateLimit{.bytes_per_second = 1000, .burst_bytes = 1000});
+
+  EXPECT_EQ(rate_limiter.Reserve(1000), absl::ZeroDuration());
+}
+
+}  // namespace
+}  // namespace connections
+}  // namespace nearby
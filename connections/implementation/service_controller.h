@@ -26,6 +26,7 @@
 #include "connections/out_of_band_connection_metadata.h"
 #include "connections/params.h"
 #include "connections/payload.h"
+#include "connections/rate_limit.h"
 #include "connections/status.h"
 #include "connections/v3/connection_listening_options.h"
 #include "connections/v3/listeners.h"
@@ -126,6 +127,15 @@ class ServiceController {
 
   virtual void SetCustomSavePath(ClientProxy* client,
                                  const std::string& path) = 0;
+
+  virtual Status SetClientRateLimit(ClientProxy* client,
+                                    RateLimit rate_limit) = 0;
+  virtual Status SetEndpointRateLimit(ClientProxy* client,
+                                      const std::string& endpoint_id,
+                                      RateLimit rate_limit) = 0;
+  virtual Status SetPayloadRateLimit(ClientProxy* client,
+                                     Payload::Id payload_id,
+                                     RateLimit rate_limit) = 0;
 };
 
 }  // namespace connections
@@ -24,8 +24,10 @@
 #include "connections/implementation/flags/nearby_connections_feature_flags.h"
 #include "connections/implementation/offline_service_controller.h"
 #include "connections/listeners.h"
+#include "connections/out_of_band_connection_metadata.h"
 #include "connections/params.h"
 #include "connections/payload.h"
+#include "connections/rate_limit.h"
 #include "connections/v3/bandwidth_info.h"
 #include "connections/v3/connection_result.h"
 #include "connections/v3/connections_device.h"
@@ -51,6 +53,31 @@ const std::size_t kEndpointIdLength = 4u;
 // advertiser.
 const std::size_t kMaxEndpointInfoLength = 131u;
 
+// Length of an IPv4 and an IPv6 address, in bytes.
+const std::size_t kIpv4AddressLength = 4u;
+const std::size_t kIpv6AddressLength = 16u;
+
+// Returns true if |metadata| has a well-formed address of the remote device
+// on its medium. Bluetooth, Wi-Fi LAN and BLE support endpoint injection.
+bool HasRemoteAddress(const OutOfBandConnectionMetadata& metadata) {
+  switch (metadata.medium) {
+    case Medium::BLUETOOTH:
+      return metadata.remote_bluetooth_mac_address.size() == kMacAddressLength;
+    case Medium::WIFI_LAN:
+      return (metadata.remote_wifi_lan_ip_address.size() ==
+                  kIpv4AddressLength ||
+              metadata.remote_wifi_lan_ip_address.size() ==
+                  kIpv6AddressLength) &&
+             metadata.remote_wifi_lan_port > 0 &&
+             metadata.remote_wifi_lan_port <= 65535;
+    case Medium::BLE:
+      return metadata.remote_ble_mac_address.size() == kMacAddressLength &&
+             metadata.remote_ble_psm >= 0;
+    default:
+      return false;
+  }
+}
+
 bool ClientHasConnectionToAtLeastOneEndpoint(
     ClientProxy* client, const std::vector<std::string>& remote_endpoint_ids) {
   for (auto& endpoint_id : remote_endpoint_ids) {
@@ -185,10 +212,7 @@ void ServiceControllerRouter::InjectEndpoint(
       "scr-inject-endpoint",
       [this, client, service_id = std::string(service_id), metadata,
        callback = std::move(callback)]() mutable {
-        // Currently, Bluetooth is the only supported medium for endpoint
-        // injection.
-        if (metadata.medium != Medium::BLUETOOTH ||
-            metadata.remote_bluetooth_mac_address.size() != kMacAddressLength) {
+        if (!HasRemoteAddress(metadata)) {
           callback({Status::kError});
           return;
         }
@@ -706,6 +730,42 @@ void ServiceControllerRouter::SetCustomSavePath(ClientProxy* client,
       });
 }
 
+void ServiceControllerRouter::SetClientRateLimit(ClientProxy* client,
+                                                 RateLimit rate_limit,
+                                                 ResultCallback callback) {
+  RouteToServiceController(
+      "scr-set-client-rate-limit",
+      [this, client, rate_limit, callback = std::move(callback)]() mutable {
+        callback(
+            GetServiceController()->SetClientRateLimit(client, rate_limit));
+      });
+}
+
+void ServiceControllerRouter::SetEndpointRateLimit(
+    ClientProxy* client, absl::string_view endpoint_id, RateLimit rate_limit,
+    ResultCallback callback) {
+  RouteToServiceController(
+      "scr-set-endpoint-rate-limit",
+      [this, client, endpoint_id = std::string(endpoint_id), rate_limit,
+       callback = std::move(callback)]() mutable {
+        callback(GetServiceController()->SetEndpointRateLimit(
+            client, endpoint_id, rate_limit));
+      });
+}
+
+void ServiceControllerRouter::SetPayloadRateLimit(ClientProxy* client,
+                                                  std::uint64_t payload_id,
+                                                  RateLimit rate_limit,
+                                                  ResultCallback callback) {
+  RouteToServiceController(
+      "scr-set-payload-rate-limit",
+      [this, client, payload_id, rate_limit,
+       callback = std::move(callback)]() mutable {
+        callback(GetServiceController()->SetPayloadRateLimit(client, payload_id,
+                                                             rate_limit));
+      });
+}
+
 void ServiceControllerRouter::SetServiceControllerForTesting(
     std::unique_ptr<ServiceController> service_controller) {
   service_controller_ = std::move(service_controller);
@@ -732,6 +792,8 @@ void ServiceControllerRouter::FinishClientSession(ClientProxy* client) {
   GetServiceController()->StopAdvertising(client);
   GetServiceController()->StopDiscovery(client);
   GetServiceController()->ShutdownBwuManagerExecutors();
+  // Drop the client's rate limit; its endpoints' limits went with them.
+  GetServiceController()->SetClientRateLimit(client, RateLimit{});
 
   // Finally, clear all state maintained by this client.
   client->Reset();
@@ -26,6 +26,7 @@
 #include "connections/implementation/service_controller.h"
 #include "connections/listeners.h"
 #include "connections/params.h"
+#include "connections/rate_limit.h"
 #include "connections/v3/connection_listening_options.h"
 #include "connections/v3/listeners.h"
 #include "connections/v3/listening_result.h"
@@ -171,6 +172,17 @@ class ServiceControllerRouter {
   virtual void SetCustomSavePath(ClientProxy* client, absl::string_view path,
                                  ResultCallback callback);
 
+  virtual void SetClientRateLimit(ClientProxy* client, RateLimit rate_limit,
+                                  ResultCallback callback);
+  virtual void SetEndpointRateLimit(ClientProxy* client,
+                                    absl::string_view endpoint_id,
+                                    RateLimit rate_limit,
+                                    ResultCallback callback);
+  virtual void SetPayloadRateLimit(ClientProxy* client,
+                                   std::uint64_t payload_id,
+                                   RateLimit rate_limit,
+                                   ResultCallback callback);
+
   void SetServiceControllerForTesting(
       std::unique_ptr<ServiceController> service_controller);
 
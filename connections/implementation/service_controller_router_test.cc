@@ -52,6 +52,10 @@ using ::testing::Return;
 constexpr std::array<char, 6> kFakeMacAddress = {'a', 'b', 'c', 'd', 'e', 'f'};
 constexpr std::array<char, 6> kFakeInjectedEndpointInfo = {'g', 'h', 'i'};
 const char kFakeInejctedEndpointId[] = "abcd";
+// 192.168.1.2, in network byte order.
+constexpr char kFakeIpAddress[] = "\xc0\xa8\x01\x02";
+constexpr int kFakePort = 4242;
+constexpr int kFakePsm = 192;
 }  // namespace
 
 class FakeNearbyDevice : public NearbyDevice {
@@ -640,6 +644,113 @@ TEST_F(ServiceControllerRouterTest, InjectEndpointCalled) {
   });
 }
 
+TEST_F(ServiceControllerRouterTest, InjectEndpointCalledWifiLan) {
+  StartDiscovery(&client_, kServiceId, kDiscoveryOptions, DiscoveryListener{},
+                 [this](Status status) {
+                   MutexLock lock(&mutex_);
+                   result_ = status;
+                   complete_ = true;
+                   cond_.Notify();
+                 });
+  InjectEndpoint(&client_, kServiceId,
+                 OutOfBandConnectionMetadata{
+                     .medium = Medium::WIFI_LAN,
+                     .endpoint_id = kFakeInejctedEndpointId,
+                     .endpoint_info = ByteArray(kFakeInjectedEndpointInfo),
+                     .remote_wifi_lan_ip_address = kFakeIpAddress,
+                     .remote_wifi_lan_port = kFakePort,
+                 },
+                 [this](Status status) {
+                   MutexLock lock(&mutex_);
+                   result_ = status;
+                   complete_ = true;
+                   cond_.Notify();
+                 });
+  {
+    MutexLock lock(&mutex_);
+    EXPECT_EQ(result_, Status{Status::kSuccess});
+  }
+  StopDiscovery(&client_, [this](Status status) {
+    MutexLock lock(&mutex_);
+    result_ = status;
+    complete_ = true;
+    cond_.Notify();
+  });
+}
+
+TEST_F(ServiceControllerRouterTest, InjectEndpointCalledBle) {
+  StartDiscovery(&client_, kServiceId, kDiscoveryOptions, DiscoveryListener{},
+                 [this](Status status) {
+                   MutexLock lock(&mutex_);
+                   result_ = status;
+                   complete_ = true;
+                   cond_.Notify();
+                 });
+  InjectEndpoint(&client_, kServiceId,
+                 OutOfBandConnectionMetadata{
+                     .medium = Medium::BLE,
+                     .endpoint_id = kFakeInejctedEndpointId,
+                     .endpoint_info = ByteArray(kFakeInjectedEndpointInfo),
+                     .remote_ble_mac_address = ByteArray(kFakeMacAddress),
+                     .remote_ble_psm = kFakePsm,
+                 },
+                 [this](Status status) {
+                   MutexLock lock(&mutex_);
+                   result_ = status;
+                   complete_ = true;
+                   cond_.Notify();
+                 });
+  {
+    MutexLock lock(&mutex_);
+    EXPECT_EQ(result_, Status{Status::kSuccess});
+  }
+  StopDiscovery(&client_, [this](Status status) {
+    MutexLock lock(&mutex_);
+    result_ = status;
+    complete_ = true;
+    cond_.Notify();
+  });
+}
+
+TEST_F(ServiceControllerRouterTest,
+       InjectEndpointRejectsAddressOfAnotherMedium) {
+  StartDiscovery(&client_, kServiceId, kDiscoveryOptions, DiscoveryListener{},
+                 [this](Status status) {
+                   MutexLock lock(&mutex_);
+                   result_ = status;
+                   complete_ = true;
+                   cond_.Notify();
+                 });
+  EXPECT_CALL(*mock_, InjectEndpoint).Times(0);
+  {
+    MutexLock lock(&mutex_);
+    complete_ = false;
+    // A Wi-Fi LAN endpoint with only a Bluetooth MAC address.
+    router_.InjectEndpoint(
+        &client_, kServiceId,
+        OutOfBandConnectionMetadata{
+            .medium = Medium::WIFI_LAN,
+            .endpoint_id = kFakeInejctedEndpointId,
+            .endpoint_info = ByteArray(kFakeInjectedEndpointInfo),
+            .remote_bluetooth_mac_address = ByteArray(kFakeMacAddress),
+        },
+        [this](Status status) {
+          MutexLock lock(&mutex_);
+          result_ = status;
+          complete_ = true;
+          cond_.Notify();
+        });
+    while (!complete_) cond_.Wait();
+    EXPECT_EQ(result_, Status{Status::kError});
+  }
+  StopDiscovery(&client_, [this](Status status) {
+    MutexLock lock(&mutex_);
+    result_ = status;
+    complete_ = true;
+    cond_.Notify();
+  });
+}
+
 TEST_F(ServiceControllerRouterTest, RequestConnectionCalled) {
   // Either Advertising, or Discovery should be ongoing.
   StartDiscovery(&client_, kServiceId, kDiscoveryOptions, DiscoveryListener{},
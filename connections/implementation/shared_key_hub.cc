@@ -0,0 +1,196 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "connections/implementation/shared_key_hub.h"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/time.h"
+#include "connections/implementation/endpoint_channel.h"
+#include "internal/crypto_cros/hkdf.h"
+#include "internal/crypto_cros/hmac.h"
+#include "internal/platform/byte_array.h"
+#include "internal/platform/crypto.h"
+#include "internal/platform/implementation/system_clock.h"
+#include "internal/platform/logging.h"
+#include "internal/platform/mutex_lock.h"
+
+namespace nearby {
+namespace connections {
+namespace {
+
+// A saved D2D session is the protocol version (1 byte), the encode and decode
+// sequence numbers (4 bytes each), then the encode and decode keys.
+constexpr size_t kSavedSessionKeysOffset = 9;
+constexpr size_t kSessionKeySize = 32;
+constexpr size_t kSecretSize = 32;
+constexpr size_t kSessionIdSize = 16;
+constexpr absl::string_view kHkdfSalt = "Nearby Connections shared key";
+constexpr absl::string_view kSecretInfo = "session secret";
+constexpr absl::string_view kSessionIdInfo = "session id";
+constexpr absl::string_view kTagKeyInfo = "session tag key";
+
+}  // namespace
+
+void SharedKeyHub::AddSession(const ByteArray& remote_endpoint_info,
+                              EndpointChannel::EncryptionContext& context) {
+  std::unique_ptr<std::string> saved_session = context.SaveSession();
+  if (saved_session == nullptr ||
+      saved_session->size() != kSavedSessionKeysOffset + 2 * kSessionKeySize) {
+    NEARBY_LOGS(WARNING) << "SharedKeyHub: unable to save session.";
+    return;
+  }
+  // Our encode key is the remote device's decode key. Order the keys so that
+  // both sides derive the same secret.
+  absl::string_view keys(*saved_session);
+  absl::string_view encode_key =
+      keys.substr(kSavedSessionKeysOffset, kSessionKeySize);
+  absl::string_view decode_key =
+      keys.substr(kSavedSessionKeysOffset + kSessionKeySize, kSessionKeySize);
+  std::string input_key = encode_key < decode_key
+                              ? absl::StrCat(encode_key, decode_key)
+                              : absl::StrCat(decode_key, encode_key);
+  std::string session_id =
+      crypto::HkdfSha256(input_key, kHkdfSalt, kSessionIdInfo, kSessionIdSize);
+  Session session{
+      .remote_endpoint_info = remote_endpoint_info.string_data(),
+      .secret =
+          crypto::HkdfSha256(input_key, kHkdfSalt, kSecretInfo, kSecretSize),
+      .tag_key =
+          crypto::HkdfSha256(input_key, kHkdfSalt, kTagKeyInfo, kSecretSize),
+      .expires_at = SystemClock::ElapsedRealtime() + session_lifetime_,
+  };
+
+  MutexLock lock(&mutex_);
+  session.number = next_session_number_++;
+  auto it = session_ids_.find(session.remote_endpoint_info);
+  if (it != session_ids_.end()) {
+    EraseSession(std::string(it->second));
+  }
+  if (sessions_.size() >= kMaxSessions) {
+    // Make room by forgetting the oldest session.
+    auto oldest = sessions_.begin();
+    for (auto candidate = sessions_.begin(); candidate != sessions_.end();
+         ++candidate) {
+      if (candidate->second.number < oldest->second.number) {
+        oldest = candidate;
+      }
+    }
+    EraseSession(std::string(oldest->first));
+  }
+  session_ids_[session.remote_endpoint_info] = session_id;
+  sessions_[session_id] = std::move(session);
+}
+
+std::optional<SharedKey> SharedKeyHub::CreateOffer(
+    const ByteArray& remote_endpoint_info) {
+  MutexLock lock(&mutex_);
+  auto it = session_ids_.find(remote_endpoint_info.string_data());
+  if (it == session_ids_.end()) return std::nullopt;
+  std::string session_id = it->second;
+  const Session* session = GetSession(session_id);
+  if (session == nullptr) return std::nullopt;
+  std::string client_nonce = GenerateNonce();
+  std::string session_tag = ComputeSessionTag(session->tag_key, client_nonce);
+  if (session_tag.empty()) return std::nullopt;
+  return SharedKey{
+      .session_tag = std::move(session_tag),
+      .secret = session->secret,
+      .client_nonce = std::move(client_nonce),
+  };
+}
+
+std::optional<SharedKey> SharedKeyHub::AcceptOffer(
+    absl::string_view session_tag, absl::string_view client_nonce) {
+  if (client_nonce.size() != kNonceSize ||
+      session_tag.size() != kSessionTagSize) {
+    return std::nullopt;
+  }
+  MutexLock lock(&mutex_);
+  absl::Time now = SystemClock::ElapsedRealtime();
+  std::vector<std::string> expired;
+  std::optional<SharedKey> shared_key;
+  // There are at most kMaxSessions candidates, each costing one HMAC.
+  for (const auto& [session_id, session] : sessions_) {
+    if (session.expires_at <= now) {
+      expired.push_back(session_id);
+      continue;
+    }
+    if (shared_key.has_value()) continue;
+    crypto::HMAC hmac(crypto::HMAC::HashAlgorithm::SHA256);
+    if (hmac.Init(session.tag_key) &&
+        hmac.VerifyTruncated(client_nonce, session_tag)) {
+      shared_key = SharedKey{
+          .session_tag = std::string(session_tag),
+          .secret = session.secret,
+          .client_nonce = std::string(client_nonce),
+      };
+    }
+  }
+  for (const std::string& session_id : expired) {
+    EraseSession(session_id);
+  }
+  return shared_key;
+}
+
+std::string SharedKeyHub::GenerateNonce(std::size_t size) {
+  std::string nonce(size, '\0');
+  RandBytes(nonce.data(), nonce.size());
+  return nonce;
+}
+
+std::string SharedKeyHub::ComputeSessionTag(absl::string_view tag_key,
+                                            absl::string_view client_nonce) {
+  crypto::HMAC hmac(crypto::HMAC::HashAlgorithm::SHA256);
+  std::string session_tag(kSessionTagSize, '\0');
+  if (!hmac.Init(tag_key) ||
+      !hmac.Sign(client_nonce,
+                 reinterpret_cast<unsigned char*>(session_tag.data()),
+                 session_tag.size())) {
+    NEARBY_LOGS(WARNING) << "SharedKeyHub: unable to compute session tag.";
+    return "";
+  }
+  return session_tag;
+}
+
+const SharedKeyHub::Session* SharedKeyHub::GetSession(
+    absl::string_view session_id) {
+  auto it = sessions_.find(session_id);
+  if (it == sessions_.end()) return nullptr;
+  if (it->second.expires_at <= SystemClock::ElapsedRealtime()) {
+    EraseSession(std::string(session_id));
+    return nullptr;
+  }
+  return &it->second;
+}
+
+void SharedKeyHub::EraseSession(absl::string_view session_id) {
+  auto it = sessions_.find(session_id);
+  if (it == sessions_.end()) return;
+  auto id_it = session_ids_.find(it->second.remote_endpoint_info);
+  if (id_it != session_ids_.end() && id_it->second == session_id) {
+    session_ids_.erase(id_it);
+  }
+  sessions_.erase(it);
+}
+
+}  // namespace connections
+}  // namespace nearby
@@ -0,0 +1,120 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef CORE_INTERNAL_SHARED_KEY_HUB_H_
+#define CORE_INTERNAL_SHARED_KEY_HUB_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/time.h"
+#include "connections/implementation/endpoint_channel.h"
+#include "internal/platform/byte_array.h"
+#include "internal/platform/mutex.h"
+
+namespace nearby {
+namespace connections {
+
+// The secret of a session shared with a remote device, and the nonce chosen
+// by the initiator of the connection that uses it. |session_tag| names the
+// session in the offer. It is keyed by the session and bound to the nonce, so
+// offers for the same session cannot be linked by an observer.
+struct SharedKey {
+  std::string session_tag;
+  std::string secret;
+  std::string client_nonce;
+};
+
+// Remembers the sessions of accepted UKEY2 connections, so that later
+// connections to the same remote device, e.g. for another service, can derive
+// their keys from the session instead of running another handshake.
+//
+// Sessions are looked up by the endpoint info that the remote device
+// advertises. A session found for the wrong device is harmless: that device
+// does not know the session and declines the offer.
+class SharedKeyHub {
+ public:
+  static constexpr absl::Duration kDefaultSessionLifetime = absl::Hours(1);
+  static constexpr std::size_t kMaxSessions = 32;
+  static constexpr std::size_t kNonceSize = 16;
+  static constexpr std::size_t kSessionTagSize = 16;
+
+  explicit SharedKeyHub(
+      absl::Duration session_lifetime = kDefaultSessionLifetime)
+      : session_lifetime_(session_lifetime) {}
+
+  // Remembers the session of |context|, a connection to the device that
+  // advertises |remote_endpoint_info|. Both sides of the connection get the
+  // same session secret and tag key.
+  void AddSession(const ByteArray& remote_endpoint_info,
+                  EndpointChannel::EncryptionContext& context)
+      ABSL_LOCKS_EXCLUDED(mutex_);
+
+  // Returns the key to offer in a connection request to the device that
+  // advertises |remote_endpoint_info|, with a new client nonce and the session
+  // tag for it, or nullopt if no session with the device is known.
+  std::optional<SharedKey> CreateOffer(const ByteArray& remote_endpoint_info)
+      ABSL_LOCKS_EXCLUDED(mutex_);
+
+  // Returns the key offered by an initiator, found by testing |session_tag|
+  // against every known session, or nullopt if no session matches or the
+  // offer is malformed.
+  std::optional<SharedKey> AcceptOffer(absl::string_view session_tag,
+                                       absl::string_view client_nonce)
+      ABSL_LOCKS_EXCLUDED(mutex_);
+
+  // Returns |size| random bytes.
+  static std::string GenerateNonce(std::size_t size = kNonceSize);
+
+  // Returns the tag that names the session with |tag_key| in an offer with
+  // |client_nonce|, or an empty string on failure.
+  static std::string ComputeSessionTag(absl::string_view tag_key,
+                                       absl::string_view client_nonce);
+
+ private:
+  struct Session {
+    std::string remote_endpoint_info;
+    std::string secret;
+    // Key of the session tags of offers.
+    std::string tag_key;
+    absl::Time expires_at;
+    // Order in which the session was added, to forget the oldest first.
+    std::uint64_t number = 0;
+  };
+
+  // Returns the unexpired session |session_id|, or nullptr.
+  const Session* GetSession(absl::string_view session_id)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+  void EraseSession(absl::string_view session_id)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  const absl::Duration session_lifetime_;
+  Mutex mutex_;
+  std::uint64_t next_session_number_ ABSL_GUARDED_BY(mutex_) = 0;
+  // Local session ID -> session. The ID is never sent.
+  absl::flat_hash_map<std::string, Session> sessions_ ABSL_GUARDED_BY(mutex_);
+  // Remote endpoint info -> ID of the latest session with the device.
+  absl::flat_hash_map<std::string, std::string> session_ids_
+      ABSL_GUARDED_BY(mutex_);
+};
+
+}  // namespace connections
+}  // namespace nearby
+
+#endif  // CORE_INTERNAL_SHARED_KEY_HUB_H_
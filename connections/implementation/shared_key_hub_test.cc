@@ -0,0 +1,183 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "connections/implementation/shared_key_hub.h"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "absl/strings/str_cat.h"
+#include "absl/time/time.h"
+#include "connections/implementation/endpoint_channel.h"
+#include "internal/platform/byte_array.h"
+#include "securegcm/ukey2_handshake.h"
+
+namespace nearby {
+namespace connections {
+namespace {
+
+using EncryptionContext = EndpointChannel::EncryptionContext;
+using ::securegcm::UKey2Handshake;
+
+constexpr UKey2Handshake::HandshakeCipher kCipher =
+    UKey2Handshake::HandshakeCipher::P256_SHA512;
+
+// The connection contexts of both sides of a UKEY2 handshake.
+struct Contexts {
+  std::unique_ptr<EncryptionContext> initiator;
+  std::unique_ptr<EncryptionContext> responder;
+};
+
+// Runs a UKEY2 handshake in memory.
+Contexts CreateContexts() {
+  std::unique_ptr<UKey2Handshake> initiator =
+      UKey2Handshake::ForInitiator(kCipher);
+  std::unique_ptr<UKey2Handshake> responder =
+      UKey2Handshake::ForResponder(kCipher);
+  EXPECT_TRUE(
+      responder->ParseHandshakeMessage(*initiator->GetNextHandshakeMessage())
+          .success);
+  EXPECT_TRUE(
+      initiator->ParseHandshakeMessage(*responder->GetNextHandshakeMessage())
+          .success);
+  EXPECT_TRUE(
+      responder->ParseHandshakeMessage(*initiator->GetNextHandshakeMessage())
+          .success);
+  EXPECT_NE(initiator->GetVerificationString(32), nullptr);
+  EXPECT_NE(responder->GetVerificationString(32), nullptr);
+  EXPECT_TRUE(initiator->VerifyHandshake());
+  EXPECT_TRUE(responder->VerifyHandshake());
+  return {
+      .initiator = initiator->ToConnectionContext(),
+      .responder = responder->ToConnectionContext(),
+  };
+}
+
+TEST(SharedKeyHubTest, BothSidesShareTheSession) {
+  Contexts contexts = CreateContexts();
+  SharedKeyHub initiator_hub;
+  SharedKeyHub responder_hub;
+  initiator_hub.AddSession(ByteArray("responder"), *contexts.initiator);
+  responder_hub.AddSession(ByteArray("initiator"), *contexts.responder);
+
+  std::optional<SharedKey> offer =
+      initiator_hub.CreateOffer(ByteArray("responder"));
+  ASSERT_TRUE(offer.has_value());
+  std::optional<SharedKey> accepted =
+      responder_hub.AcceptOffer(offer->session_tag, offer->client_nonce);
+
+  ASSERT_TRUE(accepted.has_value());
+  EXPECT_EQ(accepted->secret, offer->secret);
+  EXPECT_EQ(accepted->client_nonce, offer->client_nonce);
+  EXPECT_EQ(offer->client_nonce.size(), SharedKeyHub::kNonceSize);
+  EXPECT_TRUE(responder_hub.CreateOffer(ByteArray("initiator")).has_value());
+}
+
+TEST(SharedKeyHubTest, OffersCannotBeLinked) {
+  Contexts contexts = CreateContexts();
+  SharedKeyHub hub;
+  hub.AddSession(ByteArray("remote"), *contexts.initiator);
+
+  std::optional<SharedKey> first = hub.CreateOffer(ByteArray("remote"));
+  std::optional<SharedKey> second = hub.CreateOffer(ByteArray("remote"));
+
+  ASSERT_TRUE(first.has_value());
+  ASSERT_TRUE(second.has_value());
+  EXPECT_NE(first->client_nonce, second->client_nonce);
+  EXPECT_EQ(first->session_tag.size(), SharedKeyHub::kSessionTagSize);
+  EXPECT_NE(first->session_tag, second->session_tag);
+}
+
+TEST(SharedKeyHubTest, NoOfferForUnknownDevice) {
+  Contexts contexts = CreateContexts();
+  SharedKeyHub hub;
+  hub.AddSession(ByteArray("remote"), *contexts.initiator);
+
+  EXPECT_FALSE(hub.CreateOffer(ByteArray("other")).has_value());
+}
+
+TEST(SharedKeyHubTest, RejectsUnknownSessionOrMalformedOffer) {
+  Contexts contexts = CreateContexts();
+  SharedKeyHub initiator_hub;
+  SharedKeyHub responder_hub;
+  initiator_hub.AddSession(ByteArray("responder"), *contexts.initiator);
+  responder_hub.AddSession(ByteArray("initiator"), *contexts.responder);
+  std::optional<SharedKey> offer =
+      initiator_hub.CreateOffer(ByteArray("responder"));
+  ASSERT_TRUE(offer.has_value());
+
+  EXPECT_FALSE(responder_hub
+                   .AcceptOffer(std::string(SharedKeyHub::kSessionTagSize, 'x'),
+                                offer->client_nonce)
+                   .has_value());
+  EXPECT_FALSE(
+      responder_hub.AcceptOffer(offer->session_tag, "short").has_value());
+  EXPECT_FALSE(
+      responder_hub.AcceptOffer("short", offer->client_nonce).has_value());
+  // The tag is bound to the nonce of its offer.
+  EXPECT_FALSE(responder_hub
+                   .AcceptOffer(offer->session_tag,
+                                SharedKeyHub::GenerateNonce())
+                   .has_value());
+}
+
+TEST(SharedKeyHubTest, ForgetsExpiredSessions) {
+  Contexts contexts = CreateContexts();
+  SharedKeyHub hub(/*session_lifetime=*/absl::ZeroDuration());
+  hub.AddSession(ByteArray("remote"), *contexts.initiator);
+
+  EXPECT_FALSE(hub.CreateOffer(ByteArray("remote")).has_value());
+}
+
+TEST(SharedKeyHubTest, NewSessionReplacesOldOne) {
+  Contexts old_contexts = CreateContexts();
+  Contexts new_contexts = CreateContexts();
+  SharedKeyHub hub;
+  hub.AddSession(ByteArray("remote"), *old_contexts.initiator);
+  std::optional<SharedKey> old_offer = hub.CreateOffer(ByteArray("remote"));
+  ASSERT_TRUE(old_offer.has_value());
+
+  hub.AddSession(ByteArray("remote"), *new_contexts.initiator);
+
+  std::optional<SharedKey> new_offer = hub.CreateOffer(ByteArray("remote"));
+  ASSERT_TRUE(new_offer.has_value());
+  EXPECT_NE(new_offer->secret, old_offer->secret);
+  EXPECT_FALSE(
+      hub.AcceptOffer(old_offer->session_tag, old_offer->client_nonce)
+          .has_value());
+  EXPECT_TRUE(
+      hub.AcceptOffer(new_offer->session_tag, new_offer->client_nonce)
+          .has_value());
+}
+
+TEST(SharedKeyHubTest, KeepsAtMostMaxSessions) {
+  SharedKeyHub hub;
+  for (std::size_t i = 0; i <= SharedKeyHub::kMaxSessions; ++i) {
+    Contexts contexts = CreateContexts();
+    hub.AddSession(ByteArray(absl::StrCat("remote", i)), *contexts.initiator);
+  }
+
+  EXPECT_FALSE(hub.CreateOffer(ByteArray("remote0")).has_value());
+  EXPECT_TRUE(
+      hub.CreateOffer(ByteArray(absl::StrCat("remote",
+                                             SharedKeyHub::kMaxSessions)))
+          .has_value());
+}
+
+}  // namespace
+}  // namespace connections
+}  // namespace nearby
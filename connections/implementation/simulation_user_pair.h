@@ -0,0 +1,80 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef CORE_INTERNAL_SIMULATION_USER_PAIR_H_
+#define CORE_INTERNAL_SIMULATION_USER_PAIR_H_
+
+#include <memory>
+#include <string>
+
+#include "absl/strings/string_view.h"
+#include "absl/time/time.h"
+#include "internal/platform/count_down_latch.h"
+#include "internal/platform/medium_environment.h"
+
+namespace nearby {
+namespace connections {
+
+// Test-only pair of simulation users named "sender" and "receiver", connected
+// to each other on construction: the receiver advertises |service_id|, the
+// sender discovers it and requests a connection, and both accept it.
+//
+// |User| is SimulationUser or a subclass constructible from its name. The
+// pair calls User::AcceptConnection(CountDownLatch*), so a subclass may hide
+// it to accept with its own payload listener.
+template <typename User>
+class SimulationUserPair {
+ public:
+  explicit SimulationUserPair(absl::string_view service_id,
+                              absl::Duration timeout = absl::Seconds(10)) {
+    env_.Start();
+    sender_ = std::make_unique<User>("sender");
+    receiver_ = std::make_unique<User>("receiver");
+    CountDownLatch discovery_latch(1);
+    CountDownLatch connection_latch(2);
+    CountDownLatch accept_latch(2);
+    receiver_->StartAdvertising(std::string(service_id), &connection_latch);
+    sender_->StartDiscovery(std::string(service_id), &discovery_latch);
+    discovery_latch.Await(timeout);
+    sender_->RequestConnection(&connection_latch);
+    connection_latch.Await(timeout);
+    receiver_->AcceptConnection(&accept_latch);
+    sender_->AcceptConnection(&accept_latch);
+    connected_ = accept_latch.Await(timeout).result();
+  }
+
+  ~SimulationUserPair() {
+    sender_.reset();
+    receiver_.reset();
+    env_.Stop();
+  }
+
+  SimulationUserPair(const SimulationUserPair&) = delete;
+  SimulationUserPair& operator=(const SimulationUserPair&) = delete;
+
+  bool connected() const { return connected_; }
+  User& sender() { return *sender_; }
+  User& receiver() { return *receiver_; }
+
+ private:
+  MediumEnvironment& env_ = MediumEnvironment::Instance();
+  std::unique_ptr<User> sender_;
+  std::unique_ptr<User> receiver_;
+  bool connected_ = false;
+};
+
+}  // namespace connections
+}  // namespace nearby
+
+#endif  // CORE_INTERNAL_SIMULATION_USER_PAIR_H_
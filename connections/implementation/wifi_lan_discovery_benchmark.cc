@@ -0,0 +1,101 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Cost of handling the mDNS announcements of a busy LAN while discovering
+// over Wi-Fi LAN.
+//
+// The LAN has as many advertised services as the benchmark argument, which
+// announce themselves again and again without changes. Each iteration
+// handles one announcement of every service, as
+// P2pClusterPcpHandler::WifiLanServiceDiscoveredHandler does before it
+// reports an endpoint:
+//   BM_DecodeAnnouncements   Every announcement is decoded.
+//   BM_CachedAnnouncements   Announcements go through WifiLanServiceInfoCache,
+//                            which only decodes the first one of a service.
+// Each benchmark reports this counter:
+//   announcements_per_second   Announcements handled per second.
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "absl/strings/str_cat.h"
+#include "connections/implementation/pcp.h"
+#include "connections/implementation/wifi_lan_service_info.h"
+#include "connections/implementation/wifi_lan_service_info_cache.h"
+#include "internal/platform/byte_array.h"
+#include "internal/platform/nsd_service_info.h"
+
+namespace nearby {
+namespace connections {
+namespace {
+
+constexpr char kServiceId[] = "service-id";
+constexpr char kServiceIdHashBytes[] = {0x0A, 0x0B, 0x0C};
+
+// Returns the services advertised on the LAN, with distinct endpoints.
+std::vector<NsdServiceInfo> CreateServices(int count) {
+  std::vector<NsdServiceInfo> services;
+  services.reserve(count);
+  for (int i = 0; i < count; ++i) {
+    WifiLanServiceInfo wifi_lan_service_info{
+        WifiLanServiceInfo::Version::kV1,
+        Pcp::kP2pCluster,
+        absl::StrCat(1000 + i % 9000),
+        ByteArray(kServiceIdHashBytes, sizeof(kServiceIdHashBytes)),
+        ByteArray(absl::StrCat("Advertiser number ", i)),
+        ByteArray{},
+        WebRtcState::kConnectable};
+    NsdServiceInfo service{wifi_lan_service_info};
+    service.SetIPAddress(std::string{10, 0, static_cast<char>(i / 256),
+                                     static_cast<char>(i % 256)});
+    service.SetPort(8000 + i);
+    services.push_back(std::move(service));
+  }
+  return services;
+}
+
+void BM_DecodeAnnouncements(benchmark::State& state) {
+  std::vector<NsdServiceInfo> services = CreateServices(state.range(0));
+  for (auto _ : state) {
+    for (const NsdServiceInfo& service : services) {
+      WifiLanServiceInfo wifi_lan_service_info(service);
+      benchmark::DoNotOptimize(wifi_lan_service_info);
+    }
+  }
+  state.counters["announcements_per_second"] = benchmark::Counter(
+      state.iterations() * services.size(), benchmark::Counter::kIsRate);
+}
+
+void BM_CachedAnnouncements(benchmark::State& state) {
+  std::vector<NsdServiceInfo> services = CreateServices(state.range(0));
+  WifiLanServiceInfoCache cache;
+  for (auto _ : state) {
+    for (const NsdServiceInfo& service : services) {
+      WifiLanServiceInfoCache::Result result =
+          cache.Update(kServiceId, service);
+      benchmark::DoNotOptimize(result);
+    }
+  }
+  state.counters["announcements_per_second"] = benchmark::Counter(
+      state.iterations() * services.size(), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_DecodeAnnouncements)->Arg(100)->Arg(500)->Arg(1000);
+BENCHMARK(BM_CachedAnnouncements)->Arg(100)->Arg(500)->Arg(1000);
+
+}  // namespace
+}  // namespace connections
+}  // namespace nearby
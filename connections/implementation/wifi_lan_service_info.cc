@@ -16,12 +16,17 @@
 
 #include <inttypes.h>
 
-#include <cstring>
-#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
 
-#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
 #include "internal/platform/base64_utils.h"
-#include "internal/platform/base_input_stream.h"
+#include "internal/platform/byte_array.h"
+#include "internal/platform/byte_span_reader.h"
+#include "internal/platform/byte_span_writer.h"
 #include "internal/platform/logging.h"
 
 namespace nearby {
@@ -93,9 +98,9 @@ WifiLanServiceInfo::WifiLanServiceInfo(const NsdServiceInfo& nsd_service_info) {
     return;
   }
 
-  BaseInputStream base_input_stream{service_info_bytes};
+  ByteSpanReader reader{service_info_bytes.AsStringView()};
   // The first 1 byte is supposed to be the version and pcp.
-  auto version_and_pcp_byte = static_cast<char>(base_input_stream.ReadUint8());
+  auto version_and_pcp_byte = static_cast<char>(*reader.ReadUint8());
   // The upper 3 bits are supposed to be the version.
   version_ =
       static_cast<Version>((version_and_pcp_byte & kVersionBitmask) >> 5);
@@ -119,35 +124,37 @@ WifiLanServiceInfo::WifiLanServiceInfo(const NsdServiceInfo& nsd_service_info) {
   }
 
   // The next 4 bytes are supposed to be the endpoint_id.
-  endpoint_id_ = std::string{base_input_stream.ReadBytes(kEndpointIdLength)};
+  endpoint_id_ = std::string(*reader.ReadBytes(kEndpointIdLength));
 
   // The next 3 bytes are supposed to be the service_id_hash.
-  service_id_hash_ = base_input_stream.ReadBytes(kServiceIdHashLength);
+  absl::string_view service_id_hash = *reader.ReadBytes(kServiceIdHashLength);
+  service_id_hash_ = ByteArray(service_id_hash.data(), service_id_hash.size());
 
   // The next 1 byte is supposed to be the length of the uwb_address. If
   // available, continues to deserialize UWB address and extra field of WebRtc
   // state.
-  if (base_input_stream.IsAvailable(1)) {
-    std::uint32_t expected_uwb_address_length = base_input_stream.ReadUint8();
+  if (reader.IsAvailable(1)) {
+    std::uint32_t expected_uwb_address_length = *reader.ReadUint8();
     // If the length of uwb_address is not zero, then retrieve it.
     if (expected_uwb_address_length != 0) {
-      uwb_address_ = base_input_stream.ReadBytes(expected_uwb_address_length);
-      if (uwb_address_.Empty() ||
-          uwb_address_.size() != expected_uwb_address_length) {
+      std::optional<absl::string_view> uwb_address =
+          reader.ReadBytes(expected_uwb_address_length);
+      if (!uwb_address.has_value()) {
         NEARBY_LOGS(INFO) << "Cannot deserialize WifiLanServiceInfo: expected "
                              "uwbAddress size to be "
                           << expected_uwb_address_length << " bytes, got "
-                          << uwb_address_.size();
+                          << reader.remaining();
         // Clear enpoint_id for validity.
         endpoint_id_.clear();
         return;
       }
+      uwb_address_ = ByteArray(uwb_address->data(), uwb_address->size());
     }
 
     // The next 1 byte is extra field.
     web_rtc_state_ = WebRtcState::kUndefined;
-    if (base_input_stream.IsAvailable(kExtraFieldLength)) {
-      auto extra_field = static_cast<char>(base_input_stream.ReadUint8());
+    if (reader.IsAvailable(kExtraFieldLength)) {
+      auto extra_field = static_cast<char>(*reader.ReadUint8());
       web_rtc_state_ = (extra_field & kWebRtcConnectableFlagBitmask) == 1
                            ? WebRtcState::kConnectable
                            : WebRtcState::kUnconnectable;
@@ -167,32 +174,35 @@ WifiLanServiceInfo::operator NsdServiceInfo() const {
   version_and_pcp_byte |=
       static_cast<char>(static_cast<uint32_t>(pcp_) & kPcpBitmask);
 
-  std::string out = absl::StrCat(std::string(1, version_and_pcp_byte),
-                                 endpoint_id_, std::string(service_id_hash_));
+  // The UWB length byte is always written, even when zero: without it the
+  // name would be shorter than kMinLanServiceNameLength and fail to parse.
+  const bool has_extra_field = web_rtc_state_ != WebRtcState::kUndefined;
+  size_t size = 1 + endpoint_id_.size() + service_id_hash_.size() +
+                kUwbAddressLengthSize + uwb_address_.size();
+  if (has_extra_field) {
+    size += kExtraFieldLength;
+  }
+  ByteArray out(size);
+  ByteSpanWriter writer{absl::MakeSpan(out.data(), out.size())};
+  writer.WriteUint8(version_and_pcp_byte);
+  writer.WriteBytes(endpoint_id_);
+  writer.WriteBytes(service_id_hash_.AsStringView());
 
   // The next bytes are UWB address field.
-  if (!uwb_address_.Empty()) {
-    absl::StrAppend(&out, std::string(1, uwb_address_.size()));
-    absl::StrAppend(&out, std::string(uwb_address_));
-  } else {
-    // Write UWB address with length 0 to be able to read the next field, which
-    // needs to be appended.
-    if (web_rtc_state_ != WebRtcState::kUndefined)
-      absl::StrAppend(&out, std::string(1, uwb_address_.size()));
-  }
+  writer.WriteUint8(uwb_address_.size());
+  writer.WriteBytes(uwb_address_.AsStringView());
 
   // The next 1 byte is extra field.
-  if (web_rtc_state_ != WebRtcState::kUndefined) {
+  if (has_extra_field) {
     int web_rtc_connectable_flag =
         (web_rtc_state_ == WebRtcState::kConnectable) ? 1 : 0;
     char field_byte = static_cast<char>(web_rtc_connectable_flag) &
                       kWebRtcConnectableFlagBitmask;
-    absl::StrAppend(&out, std::string(1, field_byte));
+    writer.WriteUint8(field_byte);
   }
 
   NsdServiceInfo nsd_service_info;
-  nsd_service_info.SetServiceName(
-      Base64Utils::Encode(ByteArray{std::move(out)}));
+  nsd_service_info.SetServiceName(Base64Utils::Encode(out));
   nsd_service_info.SetTxtRecord(std::string(kKeyEndpointInfo),
                                 Base64Utils::Encode(endpoint_info_));
   return nsd_service_info;
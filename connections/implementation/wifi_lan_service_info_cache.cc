@@ -0,0 +1,92 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "connections/implementation/wifi_lan_service_info_cache.h"
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+#include "absl/hash/hash.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/time.h"
+#include "connections/implementation/wifi_lan_service_info.h"
+#include "internal/platform/implementation/system_clock.h"
+#include "internal/platform/mutex_lock.h"
+#include "internal/platform/nsd_service_info.h"
+
+namespace nearby {
+namespace connections {
+
+WifiLanServiceInfoCache::Result WifiLanServiceInfoCache::Update(
+    absl::string_view service_id, const NsdServiceInfo& nsd_service_info) {
+  const std::string& service_name = nsd_service_info.GetServiceName();
+  KeyView key_view(service_id, service_name);
+  std::size_t digest = GetDigest(nsd_service_info);
+  absl::Time now = SystemClock::ElapsedRealtime();
+  {
+    MutexLock lock(&mutex_);
+    auto it = entries_.find(key_view);
+    if (it != entries_.end() && it->second.digest == digest &&
+        it->second.expires_at > now) {
+      return {.is_reannouncement = true};
+    }
+  }
+
+  // Decode outside of the lock; the service is new, changed or expired.
+  WifiLanServiceInfo service_info(nsd_service_info);
+  MutexLock lock(&mutex_);
+  if (entries_.size() >= kMaxServices && !entries_.contains(key_view)) {
+    absl::erase_if(entries_, [now](const auto& entry) {
+      return entry.second.expires_at <= now;
+    });
+    if (entries_.size() >= kMaxServices) {
+      entries_.clear();
+    }
+  }
+  entries_.insert_or_assign(Key(service_id, service_name),
+                            Entry{
+                                .digest = digest,
+                                .expires_at = now + ttl_,
+                            });
+  return {.service_info = std::move(service_info)};
+}
+
+void WifiLanServiceInfoCache::Remove(absl::string_view service_id,
+                                     absl::string_view service_name) {
+  MutexLock lock(&mutex_);
+  entries_.erase(KeyView(service_id, service_name));
+}
+
+void WifiLanServiceInfoCache::Clear(absl::string_view service_id) {
+  MutexLock lock(&mutex_);
+  absl::erase_if(entries_, [service_id](const auto& entry) {
+    return entry.first.first == service_id;
+  });
+}
+
+std::size_t WifiLanServiceInfoCache::GetDigest(
+    const NsdServiceInfo& nsd_service_info) {
+  // Combined so that the digest does not depend on the iteration order of the
+  // TXT records.
+  std::size_t txt_records_digest = 0;
+  for (const auto& [key, value] : nsd_service_info.GetTxtRecords()) {
+    txt_records_digest += absl::HashOf(key, value);
+  }
+  return absl::HashOf(txt_records_digest, nsd_service_info.GetIPAddress(),
+                      nsd_service_info.GetPort());
+}
+
+}  // namespace connections
+}  // namespace nearby
@@ -0,0 +1,108 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef CORE_INTERNAL_WIFI_LAN_SERVICE_INFO_CACHE_H_
+#define CORE_INTERNAL_WIFI_LAN_SERVICE_INFO_CACHE_H_
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/hash/hash.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/time.h"
+#include "connections/implementation/wifi_lan_service_info.h"
+#include "internal/platform/mutex.h"
+#include "internal/platform/nsd_service_info.h"
+
+namespace nearby {
+namespace connections {
+
+// Remembers the WifiLanServiceInfo decoded from the mDNS services found while
+// discovering, so that the periodic re-announcements of an unchanged service
+// are neither decoded nor reported again.
+//
+// Services are keyed by service ID and instance name, and are unchanged as
+// long as their TXT records, IP address and port are. A cached service is
+// reported again once its TTL has passed, so that an endpoint lost in the
+// meantime by other means is found again.
+class WifiLanServiceInfoCache {
+ public:
+  // The default TTL of mDNS records that carry a host name (RFC 6762).
+  static constexpr absl::Duration kDefaultTtl = absl::Seconds(120);
+  static constexpr std::size_t kMaxServices = 1024;
+
+  struct Result {
+    // Empty for a re-announcement, which is not decoded again.
+    WifiLanServiceInfo service_info;
+    // True if the service was cached, unchanged and unexpired, i.e. it has
+    // already been reported.
+    bool is_reannouncement = false;
+  };
+
+  explicit WifiLanServiceInfoCache(absl::Duration ttl = kDefaultTtl)
+      : ttl_(ttl) {}
+
+  // Returns the WifiLanServiceInfo of |nsd_service_info|, found while
+  // discovering |service_id|, if the service is new, changed or expired.
+  // Re-announcements are recognized without copying or decoding anything.
+  Result Update(absl::string_view service_id,
+                const NsdServiceInfo& nsd_service_info)
+      ABSL_LOCKS_EXCLUDED(mutex_);
+
+  // Forgets the service |service_name|, e.g. when it is lost.
+  void Remove(absl::string_view service_id, absl::string_view service_name)
+      ABSL_LOCKS_EXCLUDED(mutex_);
+
+  // Forgets every service found while discovering |service_id|, e.g. when
+  // discovery restarts.
+  void Clear(absl::string_view service_id) ABSL_LOCKS_EXCLUDED(mutex_);
+
+ private:
+  struct Entry {
+    std::size_t digest = 0;
+    absl::Time expires_at;
+  };
+
+  // (service ID, instance name), looked up as string_views so that a
+  // re-announcement does not copy its key.
+  using Key = std::pair<std::string, std::string>;
+  using KeyView = std::pair<absl::string_view, absl::string_view>;
+  struct KeyHash {
+    using is_transparent = void;
+    std::size_t operator()(KeyView key) const {
+      return absl::HashOf(key.first, key.second);
+    }
+  };
+  struct KeyEq {
+    using is_transparent = void;
+    bool operator()(KeyView a, KeyView b) const { return a == b; }
+  };
+
+  // Hashes the parts of |nsd_service_info| that WifiLanServiceInfo and
+  // WifiLanEndpoint are made of, other than the instance name.
+  static std::size_t GetDigest(const NsdServiceInfo& nsd_service_info);
+
+  const absl::Duration ttl_;
+  Mutex mutex_;
+  absl::flat_hash_map<Key, Entry, KeyHash, KeyEq> entries_
+      ABSL_GUARDED_BY(mutex_);
+};
+
+}  // namespace connections
+}  // namespace nearby
+
+#endif  // CORE_INTERNAL_WIFI_LAN_SERVICE_INFO_CACHE_H_
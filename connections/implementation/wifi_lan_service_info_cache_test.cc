@@ -0,0 +1,166 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "connections/implementation/wifi_lan_service_info_cache.h"
+
+#include <cstddef>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/time.h"
+#include "connections/implementation/wifi_lan_service_info.h"
+#include "internal/platform/byte_array.h"
+#include "internal/platform/nsd_service_info.h"
+
+namespace nearby {
+namespace connections {
+namespace {
+
+constexpr absl::string_view kServiceId{"service-id"};
+constexpr absl::string_view kEndpointId{"AB12"};
+constexpr absl::string_view kServiceIdHashBytes{"\x0a\x0b\x0c"};
+constexpr absl::string_view kEndpointName{"RAWK + ROWL!"};
+
+NsdServiceInfo CreateNsdServiceInfo(absl::string_view endpoint_id,
+                                    absl::string_view endpoint_name) {
+  WifiLanServiceInfo wifi_lan_service_info{
+      WifiLanServiceInfo::Version::kV1,
+      Pcp::kP2pCluster,
+      endpoint_id,
+      ByteArray{std::string(kServiceIdHashBytes)},
+      ByteArray{std::string(endpoint_name)},
+      ByteArray{},
+      WebRtcState::kConnectable};
+  NsdServiceInfo nsd_service_info{wifi_lan_service_info};
+  nsd_service_info.SetIPAddress(std::string("\xc0\xa8\x01\x02", 4));
+  nsd_service_info.SetPort(1234);
+  return nsd_service_info;
+}
+
+TEST(WifiLanServiceInfoCacheTest, DecodesNewService) {
+  WifiLanServiceInfoCache cache;
+  NsdServiceInfo nsd_service_info =
+      CreateNsdServiceInfo(kEndpointId, kEndpointName);
+
+  WifiLanServiceInfoCache::Result result =
+      cache.Update(kServiceId, nsd_service_info);
+
+  EXPECT_FALSE(result.is_reannouncement);
+  EXPECT_TRUE(result.service_info.IsValid());
+  EXPECT_EQ(result.service_info.GetEndpointId(), kEndpointId);
+  EXPECT_EQ(result.service_info.GetEndpointInfo(),
+            ByteArray{std::string(kEndpointName)});
+}
+
+TEST(WifiLanServiceInfoCacheTest, RecognizesUnchangedReannouncement) {
+  WifiLanServiceInfoCache cache;
+  NsdServiceInfo nsd_service_info =
+      CreateNsdServiceInfo(kEndpointId, kEndpointName);
+  cache.Update(kServiceId, nsd_service_info);
+
+  WifiLanServiceInfoCache::Result result =
+      cache.Update(kServiceId, nsd_service_info);
+
+  EXPECT_TRUE(result.is_reannouncement);
+  // Already reported, so it is not decoded again.
+  EXPECT_FALSE(result.service_info.IsValid());
+}
+
+TEST(WifiLanServiceInfoCacheTest, ReportsChangedTxtRecords) {
+  WifiLanServiceInfoCache cache;
+  NsdServiceInfo nsd_service_info =
+      CreateNsdServiceInfo(kEndpointId, kEndpointName);
+  cache.Update(kServiceId, nsd_service_info);
+  NsdServiceInfo renamed = CreateNsdServiceInfo(kEndpointId, "Renamed");
+  ASSERT_EQ(renamed.GetServiceName(), nsd_service_info.GetServiceName());
+
+  WifiLanServiceInfoCache::Result result = cache.Update(kServiceId, renamed);
+
+  EXPECT_FALSE(result.is_reannouncement);
+  EXPECT_EQ(result.service_info.GetEndpointInfo(), ByteArray{"Renamed"});
+}
+
+TEST(WifiLanServiceInfoCacheTest, ReportsChangedAddress) {
+  WifiLanServiceInfoCache cache;
+  NsdServiceInfo nsd_service_info =
+      CreateNsdServiceInfo(kEndpointId, kEndpointName);
+  cache.Update(kServiceId, nsd_service_info);
+  nsd_service_info.SetPort(4321);
+
+  EXPECT_FALSE(cache.Update(kServiceId, nsd_service_info).is_reannouncement);
+}
+
+TEST(WifiLanServiceInfoCacheTest, KeepsServicesOfEachServiceIdApart) {
+  WifiLanServiceInfoCache cache;
+  NsdServiceInfo nsd_service_info =
+      CreateNsdServiceInfo(kEndpointId, kEndpointName);
+  cache.Update(kServiceId, nsd_service_info);
+
+  EXPECT_FALSE(
+      cache.Update("other-service-id", nsd_service_info).is_reannouncement);
+}
+
+TEST(WifiLanServiceInfoCacheTest, ReportsServiceAgainAfterTtl) {
+  WifiLanServiceInfoCache cache(/*ttl=*/absl::ZeroDuration());
+  NsdServiceInfo nsd_service_info =
+      CreateNsdServiceInfo(kEndpointId, kEndpointName);
+  cache.Update(kServiceId, nsd_service_info);
+
+  EXPECT_FALSE(cache.Update(kServiceId, nsd_service_info).is_reannouncement);
+}
+
+TEST(WifiLanServiceInfoCacheTest, ReportsServiceAgainAfterRemove) {
+  WifiLanServiceInfoCache cache;
+  NsdServiceInfo nsd_service_info =
+      CreateNsdServiceInfo(kEndpointId, kEndpointName);
+  cache.Update(kServiceId, nsd_service_info);
+
+  cache.Remove(kServiceId, nsd_service_info.GetServiceName());
+
+  EXPECT_FALSE(cache.Update(kServiceId, nsd_service_info).is_reannouncement);
+}
+
+TEST(WifiLanServiceInfoCacheTest, ClearForgetsOnlyTheServiceId) {
+  WifiLanServiceInfoCache cache;
+  NsdServiceInfo nsd_service_info =
+      CreateNsdServiceInfo(kEndpointId, kEndpointName);
+  cache.Update(kServiceId, nsd_service_info);
+  cache.Update("other-service-id", nsd_service_info);
+
+  cache.Clear(kServiceId);
+
+  EXPECT_FALSE(cache.Update(kServiceId, nsd_service_info).is_reannouncement);
+  EXPECT_TRUE(
+      cache.Update("other-service-id", nsd_service_info).is_reannouncement);
+}
+
+TEST(WifiLanServiceInfoCacheTest, KeepsAtMostMaxServices) {
+  WifiLanServiceInfoCache cache;
+  NsdServiceInfo first = CreateNsdServiceInfo(kEndpointId, kEndpointName);
+  cache.Update(kServiceId, first);
+  for (std::size_t i = 0; i < WifiLanServiceInfoCache::kMaxServices; ++i) {
+    NsdServiceInfo nsd_service_info =
+        CreateNsdServiceInfo(kEndpointId, kEndpointName);
+    nsd_service_info.SetServiceName(absl::StrCat("service-", i));
+    cache.Update(kServiceId, nsd_service_info);
+  }
+
+  EXPECT_FALSE(cache.Update(kServiceId, first).is_reannouncement);
+}
+
+}  // namespace
+}  // namespace connections
+}  // namespace nearby
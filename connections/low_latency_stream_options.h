@@ -0,0 +1,78 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef CORE_LOW_LATENCY_STREAM_OPTIONS_H_
+#define CORE_LOW_LATENCY_STREAM_OPTIONS_H_
+
+#include <cstdint>
+#include <functional>
+
+#include "absl/time/time.h"
+
+namespace nearby {
+namespace connections {
+
+// Latency of a low latency STREAM payload, measured from the time data was
+// read from the InputStream to the time the chunk carrying it was written to
+// every recipient.
+struct StreamLatencyStats {
+  // Number of chunks and bytes written to the recipients.
+  std::int64_t chunks_sent = 0;
+  std::int64_t bytes_sent = 0;
+  // Bytes read from the InputStream but dropped under backpressure.
+  std::int64_t bytes_dropped = 0;
+  // Latency percentiles over the most recent chunks.
+  absl::Duration p50_latency = absl::ZeroDuration();
+  absl::Duration p90_latency = absl::ZeroDuration();
+  absl::Duration p99_latency = absl::ZeroDuration();
+  absl::Duration max_latency = absl::ZeroDuration();
+};
+
+// Options for STREAM payloads that carry real-time data, such as audio or
+// sensor readings, where fresh data matters more than full chunks.
+//
+// By default a STREAM payload asks its InputStream for a full chunk at a time
+// and sends whatever that read returns. With these options the InputStream is
+// read ahead in small reads instead, and a chunk is sent as soon as a full
+// chunk is queued or the oldest queued byte has waited max_chunk_delay.
+struct LowLatencyStreamOptions {
+  // What to do when the queue of read-ahead data is full, i.e. the recipients
+  // can't keep up with the InputStream.
+  enum class OverflowPolicy {
+    // Stops reading the InputStream until queued data is sent. Nothing is
+    // lost, but latency grows with the backlog.
+    kBlock,
+    // Drops the oldest queued reads, so fresh data never waits behind stale
+    // data. Each read is dropped as a whole; writers that need to keep
+    // messages intact should write them in single writes no larger than
+    // read_size.
+    kDropOldest,
+  };
+
+  // Longest time data waits for more data to fill its chunk.
+  absl::Duration max_chunk_delay = absl::Milliseconds(5);
+  // Size of each read from the InputStream.
+  std::int64_t read_size = 1024;
+  // Most bytes read ahead of the send loop.
+  std::int64_t max_queued_bytes = 64 * 1024;
+  OverflowPolicy overflow_policy = OverflowPolicy::kDropOldest;
+  // Called once when the payload finishes, succeeds or not.
+  std::function<void(const StreamLatencyStats&)> latency_stats_cb;
+};
+
+}  // namespace connections
+}  // namespace nearby
+
+#endif  // CORE_LOW_LATENCY_STREAM_OPTIONS_H_
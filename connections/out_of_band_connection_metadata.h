@@ -26,8 +26,8 @@ namespace connections {
 
 // Metadata injected to facilitate out-of-band connections. The medium field is
 // required, and the other fields are only specified for a specific medium.
-// Currently, Bluetooth is the only supported medium for out-of-band
-// connections.
+// Bluetooth, Wi-Fi LAN and BLE (with BLE v2 enabled) are supported for
+// out-of-band connections.
 struct OutOfBandConnectionMetadata {
   // Medium to use for the out-of-band connection.
   Medium medium;
@@ -47,6 +47,18 @@ struct OutOfBandConnectionMetadata {
 
   // Used for Bluetooth connections.
   ByteArray remote_bluetooth_mac_address;
+
+  // Used for Wi-Fi LAN connections: the IPv4 or IPv6 address (4 or 16 bytes,
+  // in network byte order) and the port that the remote device accepts
+  // connections on, as reported by its WifiLan medium.
+  std::string remote_wifi_lan_ip_address;
+  int remote_wifi_lan_port = 0;
+
+  // Used for BLE connections: the 6-byte MAC address that identifies the
+  // remote peripheral, and the PSM of its L2CAP server socket, or 0 if it
+  // only accepts GATT connections.
+  ByteArray remote_ble_mac_address;
+  int remote_ble_psm = 0;
 };
 
 }  // namespace connections
@@ -16,15 +16,19 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <variant>
 
 #include "absl/random/random.h"
+#include "connections/low_latency_stream_options.h"
 #include "connections/payload_type.h"
+#include "connections/rate_limit.h"
 #include "internal/platform/byte_array.h"
 #include "internal/platform/file.h"
 #include "internal/platform/input_stream.h"
@@ -81,6 +85,12 @@ Payload::Payload(std::string parent_folder, std::string file_name,
 Payload::Payload(std::unique_ptr<InputStream> stream)
     : type_(PayloadType::kStream), content_(std::move(stream)) {}
 
+Payload::Payload(std::unique_ptr<InputStream> stream,
+                 LowLatencyStreamOptions low_latency_stream_options)
+    : type_(PayloadType::kStream),
+      content_(std::move(stream)),
+      low_latency_stream_options_(std::move(low_latency_stream_options)) {}
+
 // Constructors for incoming payloads.
 Payload::Payload(Id id, ByteArray&& bytes)
     : id_(id), type_(PayloadType::kBytes), content_(std::move(bytes)) {}
@@ -105,6 +115,19 @@ Payload::Payload(Id id, std::string parent_folder, std::string file_name,
 Payload::Payload(Id id, std::unique_ptr<InputStream> stream)
     : id_(id), type_(PayloadType::kStream), content_(std::move(stream)) {}
 
+Payload Payload::Datagram(ByteArray bytes,
+                          std::optional<std::int64_t> sequence_number) {
+  return Datagram(GenerateId(), std::move(bytes), sequence_number);
+}
+
+Payload Payload::Datagram(Id id, ByteArray bytes,
+                          std::optional<std::int64_t> sequence_number) {
+  Payload payload(id, std::move(bytes));
+  payload.type_ = PayloadType::kDatagram;
+  payload.sequence_number_ = sequence_number;
+  return payload;
+}
+
 // Returns ByteArray payload, if it has been defined, or empty ByteArray.
 const ByteArray& Payload::AsBytes() const& {
   static const ByteArray empty;  // NOLINT: function-level static is OK.
@@ -153,5 +176,17 @@ const std::string& Payload::GetParentFolder() const { return parent_folder_; }
 
 const std::string& Payload::GetFileName() const { return file_name_; }
 
+const LowLatencyStreamOptions* Payload::GetLowLatencyStreamOptions() const {
+  return low_latency_stream_options_ ? &*low_latency_stream_options_ : nullptr;
+}
+
+std::optional<std::int64_t> Payload::GetSequenceNumber() const {
+  return sequence_number_;
+}
+
+void Payload::SetRateLimit(RateLimit rate_limit) { rate_limit_ = rate_limit; }
+
+RateLimit Payload::GetRateLimit() const { return rate_limit_; }
+
 }  // namespace connections
 }  // namespace nearby
@@ -15,14 +15,18 @@
 #ifndef CORE_PAYLOAD_H_
 #define CORE_PAYLOAD_H_
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <variant>
 
 #include "absl/types/variant.h"
+#include "connections/low_latency_stream_options.h"
 #include "connections/payload_type.h"
+#include "connections/rate_limit.h"
 #include "internal/platform/byte_array.h"
 #include "internal/platform/file.h"
 #include "internal/platform/input_stream.h"
@@ -39,6 +43,10 @@ namespace connections {
 class Payload {
  public:
   using Id = PayloadId;
+  // Largest body of a DATAGRAM payload, in bytes. A datagram is always sent in
+  // a single frame.
+  static constexpr std::size_t kMaxDatagramSize = 16 * 1024;
+
   // Order of types in variant, and values in Type enum is important.
   // Enum values must match respective variant types.
   using Content = std::variant<std::monostate, ByteArray,
@@ -74,6 +82,11 @@ class Payload {
 
   explicit Payload(std::unique_ptr<InputStream> stream);
 
+  // Outgoing STREAM payload that is sent with low latency; see
+  // LowLatencyStreamOptions.
+  Payload(std::unique_ptr<InputStream> stream,
+          LowLatencyStreamOptions low_latency_stream_options);
+
   // Constructors for incoming payloads.
   Payload(Id id, ByteArray&& bytes);
   Payload(Id id, const ByteArray& bytes);
@@ -82,6 +95,17 @@ class Payload {
           InputFile input_file);
   Payload(Id id, std::unique_ptr<InputStream> stream);
 
+  // DATAGRAM payloads are delivered best effort: they are never acked or
+  // retransmitted, may be dropped under backpressure and must not exceed
+  // kMaxDatagramSize. If |sequence_number| is set, the receiver drops
+  // datagrams whose sequence number is not greater than that of the last
+  // datagram it delivered from the same endpoint.
+  static Payload Datagram(ByteArray bytes,
+                          std::optional<std::int64_t> sequence_number = {});
+  // Incoming DATAGRAM payload.
+  static Payload Datagram(Id id, ByteArray bytes,
+                          std::optional<std::int64_t> sequence_number);
+
   // Returns ByteArray payload, if it has been defined, or empty ByteArray.
   const ByteArray& AsBytes() const&;
   // Returns InputStream* payload, if it has been defined, or nullptr.
@@ -106,6 +130,18 @@ class Payload {
   const std::string& GetFileName() const;
   const std::string& GetParentFolder() const;
 
+  // Returns the low latency options of an outgoing STREAM payload, or nullptr
+  // if it is sent normally.
+  const LowLatencyStreamOptions* GetLowLatencyStreamOptions() const;
+
+  // Returns the sequence number of a DATAGRAM payload, if it has one.
+  std::optional<std::int64_t> GetSequenceNumber() const;
+
+  // Caps the rate at which an outgoing payload is sent, from its first chunk.
+  // The cap can be changed while the payload is sent; see RateLimit.
+  void SetRateLimit(RateLimit rate_limit);
+  RateLimit GetRateLimit() const;
+
  private:
   PayloadType FindType() const;
 
@@ -117,6 +153,9 @@ class Payload {
 
   PayloadType type_{FindType()};
   Content content_;
+  std::optional<LowLatencyStreamOptions> low_latency_stream_options_;
+  std::optional<std::int64_t> sequence_number_;
+  RateLimit rate_limit_;
 };
 
 }  // namespace connections
@@ -15,6 +15,7 @@
 #include "connections/payload.h"
 
 #include <memory>
+#include <optional>
 #include <type_traits>
 #include <utility>
 
@@ -109,6 +110,19 @@ TEST(PayloadTest, SupportsStreamType) {
   EXPECT_EQ(payload.GetOffset(), kOffset);
 }
 
+TEST(PayloadTest, SupportsDatagramType) {
+  const ByteArray bytes("datagram");
+
+  Payload payload = Payload::Datagram(bytes, 7);
+
+  EXPECT_EQ(payload.GetType(), PayloadType::kDatagram);
+  EXPECT_EQ(payload.AsStream(), nullptr);
+  EXPECT_EQ(payload.AsFile(), nullptr);
+  EXPECT_EQ(payload.AsBytes(), bytes);
+  EXPECT_EQ(payload.GetSequenceNumber(), 7);
+  EXPECT_EQ(Payload(bytes).GetSequenceNumber(), std::nullopt);
+}
+
 TEST(PayloadTest, PayloadIsMoveable) {
   Payload payload1;
   Payload payload2(ByteArray("bytes"));
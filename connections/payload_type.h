@@ -18,7 +18,13 @@
 namespace nearby {
 namespace connections {
 
-enum class PayloadType { kUnknown = 0, kBytes = 1, kFile = 2, kStream = 3 };
+enum class PayloadType {
+  kUnknown = 0,
+  kBytes = 1,
+  kFile = 2,
+  kStream = 3,
+  kDatagram = 4,
+};
 enum class PayloadDirection {
   UNKNOWN_DIRECTION_PAYLOAD = 0,
   INCOMING_PAYLOAD = 1,
@@ -0,0 +1,43 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef CORE_RATE_LIMIT_H_
+#define CORE_RATE_LIMIT_H_
+
+#include <cstdint>
+
+namespace nearby {
+namespace connections {
+
+// A cap on the rate at which payloads are sent, so that a bulk transfer
+// leaves room on the link for other payloads and other traffic.
+//
+// The cap is a token bucket: it holds up to burst_bytes, refills at
+// bytes_per_second, and each chunk takes its size from it before it is sent.
+// A cap may apply to a single payload, to everything sent to an endpoint, or
+// to everything a client sends; a chunk waits for every cap that applies.
+struct RateLimit {
+  // Sustained sending rate. Zero or less means unlimited.
+  std::int64_t bytes_per_second = 0;
+  // Bytes that may be sent back to back after being idle. Zero or less means
+  // one second's worth of bytes_per_second.
+  std::int64_t burst_bytes = 0;
+
+  bool IsUnlimited() const { return bytes_per_second <= 0; }
+};
+
+}  // namespace connections
+}  // namespace nearby
+
+#endif  // CORE_RATE_LIMIT_H_
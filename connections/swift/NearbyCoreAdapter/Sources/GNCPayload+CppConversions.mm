@@ -33,7 +33,9 @@ using ::nearby::connections::Payload;
 + (GNCPayload *)fromCpp:(Payload)payload {
   int64_t payloadId = payload.GetId();
   switch (payload.GetType()) {
-    case nearby::connections::PayloadType::kBytes: {
+    // Datagrams are surfaced as bytes payloads.
+    case nearby::connections::PayloadType::kBytes:
+    case nearby::connections::PayloadType::kDatagram: {
       ByteArray bytes = payload.AsBytes();
       NSData *payloadData = [NSData dataWithBytes:bytes.data() length:bytes.size()];
       return [[GNCBytesPayload alloc] initWithData:payloadData identifier:payloadId];
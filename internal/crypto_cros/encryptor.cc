@@ -17,6 +17,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <algorithm>
+#include <memory>
 #include <optional>
 #include <string>
 #include <utility>
@@ -79,6 +81,17 @@ bool Encryptor::Init(const SymmetricKey* key, Mode mode,
 
   if (GetCipherForKey(key) == nullptr) return false;
 
+  if (mode == CTR) {
+    auto ctr_key = std::make_unique<AES_KEY>();
+    if (AES_set_encrypt_key(reinterpret_cast<const uint8_t*>(key->key().data()),
+                            key->key().size() * 8, ctr_key.get()) != 0) {
+      return false;
+    }
+    ctr_key_ = std::move(ctr_key);
+  } else {
+    ctr_key_.reset();
+  }
+
   key_ = key;
   mode_ = mode;
   iv_.assign(iv.begin(), iv.end());
@@ -119,6 +132,22 @@ bool Encryptor::SetCounter(absl::Span<const uint8_t> counter) {
   return true;
 }
 
+bool Encryptor::CryptWithCounter(absl::Span<const uint8_t> counter,
+                                 absl::Span<const uint8_t> input,
+                                 absl::Span<uint8_t> output) const {
+  if (mode_ != CTR || !ctr_key_) return false;
+  if (counter.size() != AES_BLOCK_SIZE) return false;
+  CHECK_GE(output.size(), input.size());
+
+  uint8_t ivec[AES_BLOCK_SIZE];
+  std::copy(counter.begin(), counter.end(), ivec);
+  uint8_t ecount_buf[AES_BLOCK_SIZE] = {0};
+  unsigned int block_offset = 0;
+  AES_ctr128_encrypt(input.data(), output.data(), input.size(), ctr_key_.get(),
+                     ivec, ecount_buf, &block_offset);
+  return true;
+}
+
 bool Encryptor::CryptString(bool do_encrypt, absl::string_view input,
                             std::string* output) {
   size_t out_size = MaxOutput(do_encrypt, input.size());
@@ -205,9 +234,7 @@ absl::optional<size_t> Encryptor::CryptCTR(bool do_encrypt,
     return absl::nullopt;
   }
 
-  AES_KEY aes_key;
-  if (AES_set_encrypt_key(reinterpret_cast<const uint8_t*>(key_->key().data()),
-                          key_->key().size() * 8, &aes_key) != 0) {
+  if (!ctr_key_) {
     return absl::nullopt;
   }
 
@@ -218,7 +245,7 @@ absl::optional<size_t> Encryptor::CryptCTR(bool do_encrypt,
   CHECK_GE(output.size(), input.size());
   // Note AES_ctr128_encrypt() will update |iv_|. However, this method discards
   // |ecount_buf| and |block_offset|, so this is not quite a streaming API.
-  AES_ctr128_encrypt(input.data(), output.data(), input.size(), &aes_key,
+  AES_ctr128_encrypt(input.data(), output.data(), input.size(), ctr_key_.get(),
                      iv_.data(), ecount_buf, &block_offset);
   return input.size();
 }
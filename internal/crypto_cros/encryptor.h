@@ -28,6 +28,8 @@
 #include "absl/types/span.h"
 #include "internal/crypto_cros/crypto_export.h"
 
+struct aes_key_st;
+
 namespace nearby::crypto {
 
 class SymmetricKey;
@@ -80,11 +82,24 @@ class CRYPTO_EXPORT Encryptor {
   bool SetCounter(absl::string_view counter);
   bool SetCounter(absl::Span<const uint8_t> counter);
 
+  // Encrypts or decrypts |input| into |output| in CTR mode, starting at
+  // |counter|. The counter set by SetCounter() is neither used nor updated.
+  // |output| must have room for |input|. The AES key schedule is expanded
+  // once by Init(), so one Encryptor can process many short messages with
+  // different counters without reinitializing.
+  //
+  // Returns false if the mode is not CTR or |counter| is not 16 bytes.
+  bool CryptWithCounter(absl::Span<const uint8_t> counter,
+                        absl::Span<const uint8_t> input,
+                        absl::Span<uint8_t> output) const;
+
   // TODO(albertb): Support streaming encryption.
 
  private:
   const SymmetricKey* key_;
   Mode mode_;
+  // In CTR mode, the expanded AES key schedule of |key_|.
+  std::unique_ptr<aes_key_st> ctr_key_;
 
   bool CryptString(bool do_encrypt, absl::string_view input,
                    std::string* output);
@@ -344,6 +344,31 @@ TEST(EncryptorTest, EncryptDecryptCTR) {
   EXPECT_EQ(plaintext, decrypted);
 }
 
+TEST(EncryptorTest, CryptWithCounterAES256CTR) {
+  std::string key_str(reinterpret_cast<const char*>(kAES256CTRKey),
+                      std::size(kAES256CTRKey));
+  std::unique_ptr<crypto::SymmetricKey> sym_key(
+      crypto::SymmetricKey::Import(crypto::SymmetricKey::AES, key_str));
+  ASSERT_TRUE(sym_key.get());
+
+  crypto::Encryptor encryptor;
+  EXPECT_TRUE(encryptor.Init(sym_key.get(), crypto::Encryptor::CTR, ""));
+
+  // The same encryptor decrypts repeatedly without resetting the counter.
+  for (int i = 0; i < 2; ++i) {
+    uint8_t decrypted[std::size(kAESCTRPlaintext)];
+    EXPECT_TRUE(encryptor.CryptWithCounter(
+        absl::MakeSpan(kAESCTRInitCounter),
+        absl::MakeSpan(kAES256CTRCiphertext), absl::MakeSpan(decrypted)));
+    EXPECT_EQ(0, memcmp(decrypted, kAESCTRPlaintext, std::size(decrypted)));
+  }
+
+  uint8_t output[std::size(kAESCTRPlaintext)];
+  EXPECT_FALSE(encryptor.CryptWithCounter(
+      absl::MakeSpan(kAESCTRInitCounter, 8),
+      absl::MakeSpan(kAES256CTRCiphertext), absl::MakeSpan(output)));
+}
+
 // TODO(wtc): add more known-answer tests.  Test vectors are available from
 // http://www.ietf.org/rfc/rfc3602
 // http://csrc.nist.gov/publications/nistpubs/800-38a/sp800-38a.pdf
@@ -0,0 +1,186 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "internal/perf/benchmark_comparator.h"
+
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "internal/perf/benchmark_results.h"
+
+namespace nearby::perf {
+namespace {
+
+// Two-sided 95% critical values of Student's t distribution for 1 to 30
+// degrees of freedom.
+constexpr double kStudentT95[] = {
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201,  2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080,  2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042,
+};
+
+const std::vector<double>& GetSamples(const BenchmarkResult& result,
+                                      BenchmarkMetric metric) {
+  switch (metric) {
+    case BenchmarkMetric::kRealTime:
+      return result.real_time_ns;
+    case BenchmarkMetric::kCpuTime:
+      return result.cpu_time_ns;
+  }
+  return result.real_time_ns;
+}
+
+double GetThreshold(absl::string_view key, const ComparisonOptions& options) {
+  double threshold = options.threshold;
+  size_t longest_match = 0;
+  for (const auto& [prefix, value] : options.threshold_overrides) {
+    if (prefix.size() >= longest_match && absl::StartsWith(key, prefix)) {
+      longest_match = prefix.size();
+      threshold = value;
+    }
+  }
+  return threshold;
+}
+
+ComparisonVerdict Judge(const BenchmarkComparison& comparison,
+                        int min_repetitions) {
+  if (comparison.baseline.count < min_repetitions ||
+      comparison.candidate.count < min_repetitions ||
+      comparison.baseline.count < 2 || comparison.candidate.count < 2 ||
+      comparison.baseline.mean <= 0) {
+    return ComparisonVerdict::kInsufficientData;
+  }
+  if (comparison.change > comparison.threshold) {
+    return comparison.change_ci_low > 0 ? ComparisonVerdict::kRegressed
+                                        : ComparisonVerdict::kNoisy;
+  }
+  if (comparison.change < -comparison.threshold) {
+    return comparison.change_ci_high < 0 ? ComparisonVerdict::kImproved
+                                         : ComparisonVerdict::kNoisy;
+  }
+  return ComparisonVerdict::kUnchanged;
+}
+
+}  // namespace
+
+double StudentT95(double degrees_of_freedom) {
+  if (degrees_of_freedom < 1) {
+    return kStudentT95[0];
+  }
+  // Rounding down keeps the interval conservative for the fractional degrees
+  // of freedom produced by Welch's approximation.
+  int df = static_cast<int>(degrees_of_freedom);
+  if (df <= 30) return kStudentT95[df - 1];
+  if (df < 40) return 2.042;
+  if (df < 60) return 2.021;
+  if (df < 120) return 2.000;
+  return 1.960;
+}
+
+SampleStats ComputeSampleStats(absl::Span<const double> samples) {
+  SampleStats stats;
+  stats.count = samples.size();
+  if (samples.empty()) {
+    return stats;
+  }
+  double sum = 0;
+  for (double sample : samples) {
+    sum += sample;
+  }
+  stats.mean = sum / stats.count;
+  stats.ci_low = stats.ci_high = stats.mean;
+  if (stats.count < 2) {
+    return stats;
+  }
+  double squares = 0;
+  for (double sample : samples) {
+    squares += (sample - stats.mean) * (sample - stats.mean);
+  }
+  stats.stddev = std::sqrt(squares / (stats.count - 1));
+  double margin =
+      StudentT95(stats.count - 1) * stats.stddev / std::sqrt(stats.count);
+  stats.ci_low = stats.mean - margin;
+  stats.ci_high = stats.mean + margin;
+  return stats;
+}
+
+std::vector<BenchmarkComparison> CompareBenchmarkRuns(
+    const BenchmarkRun& baseline, const BenchmarkRun& candidate,
+    const ComparisonOptions& options) {
+  std::vector<BenchmarkComparison> comparisons;
+  for (const BenchmarkResult& candidate_result : candidate.results) {
+    const BenchmarkResult* baseline_result =
+        baseline.FindResult(candidate_result.binary, candidate_result.name);
+    if (baseline_result == nullptr) {
+      continue;
+    }
+    BenchmarkComparison comparison;
+    comparison.binary = candidate_result.binary;
+    comparison.name = candidate_result.name;
+    comparison.baseline =
+        ComputeSampleStats(GetSamples(*baseline_result, options.metric));
+    comparison.candidate =
+        ComputeSampleStats(GetSamples(candidate_result, options.metric));
+    comparison.threshold = GetThreshold(
+        absl::StrCat(comparison.binary, "/", comparison.name), options);
+
+    const SampleStats& a = comparison.baseline;
+    const SampleStats& b = comparison.candidate;
+    if (a.count >= 2 && b.count >= 2 && a.mean > 0) {
+      // Welch's t-test: the confidence interval of the difference of the means
+      // without assuming equal variances.
+      double var_a = a.stddev * a.stddev / a.count;
+      double var_b = b.stddev * b.stddev / b.count;
+      double standard_error = std::sqrt(var_a + var_b);
+      double margin = 0;
+      if (standard_error > 0) {
+        double df = (var_a + var_b) * (var_a + var_b) /
+                    (var_a * var_a / (a.count - 1) +
+                     var_b * var_b / (b.count - 1));
+        margin = StudentT95(df) * standard_error;
+      }
+      double difference = b.mean - a.mean;
+      comparison.change = difference / a.mean;
+      comparison.change_ci_low = (difference - margin) / a.mean;
+      comparison.change_ci_high = (difference + margin) / a.mean;
+    }
+    comparison.verdict = Judge(comparison, options.min_repetitions);
+    comparisons.push_back(std::move(comparison));
+  }
+  return comparisons;
+}
+
+absl::string_view ComparisonVerdictToString(ComparisonVerdict verdict) {
+  switch (verdict) {
+    case ComparisonVerdict::kUnchanged:
+      return "unchanged";
+    case ComparisonVerdict::kImproved:
+      return "improved";
+    case ComparisonVerdict::kRegressed:
+      return "REGRESSED";
+    case ComparisonVerdict::kNoisy:
+      return "noisy";
+    case ComparisonVerdict::kInsufficientData:
+      return "insufficient data";
+  }
+  return "unknown";
+}
+
+}  // namespace nearby::perf
@@ -0,0 +1,100 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef THIRD_PARTY_NEARBY_INTERNAL_PERF_BENCHMARK_COMPARATOR_H_
+#define THIRD_PARTY_NEARBY_INTERNAL_PERF_BENCHMARK_COMPARATOR_H_
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "internal/perf/benchmark_results.h"
+
+namespace nearby::perf {
+
+// Summary statistics of the repetitions of a benchmark.
+struct SampleStats {
+  int count = 0;
+  double mean = 0;
+  // Sample standard deviation. Zero when there are fewer than two samples.
+  double stddev = 0;
+  // Bounds of the 95% confidence interval of the mean.
+  double ci_low = 0;
+  double ci_high = 0;
+};
+
+// Computes the statistics of |samples|.
+SampleStats ComputeSampleStats(absl::Span<const double> samples);
+
+// Returns the two-sided 95% critical value of Student's t distribution with
+// |degrees_of_freedom|.
+double StudentT95(double degrees_of_freedom);
+
+enum class BenchmarkMetric {
+  kRealTime,
+  kCpuTime,
+};
+
+struct ComparisonOptions {
+  BenchmarkMetric metric = BenchmarkMetric::kRealTime;
+  // Relative slowdown of the mean above which a benchmark regressed, e.g. 0.05
+  // for 5%.
+  double threshold = 0.05;
+  // Per benchmark thresholds overriding |threshold|. The key is matched as a
+  // prefix of "<binary>/<benchmark name>"; the longest matching key wins.
+  std::vector<std::pair<std::string, double>> threshold_overrides;
+  // Benchmarks with fewer repetitions on either side are not judged.
+  int min_repetitions = 3;
+};
+
+enum class ComparisonVerdict {
+  kUnchanged,
+  kImproved,
+  kRegressed,
+  // The means differ by more than the threshold but the difference is not
+  // statistically significant. Rerun with more repetitions.
+  kNoisy,
+  kInsufficientData,
+};
+
+struct BenchmarkComparison {
+  std::string binary;
+  std::string name;
+  SampleStats baseline;
+  SampleStats candidate;
+  // Relative change of the mean, (candidate - baseline) / baseline. Positive
+  // values are slowdowns.
+  double change = 0;
+  // Bounds of the 95% confidence interval of |change|.
+  double change_ci_low = 0;
+  double change_ci_high = 0;
+  double threshold = 0;
+  ComparisonVerdict verdict = ComparisonVerdict::kInsufficientData;
+};
+
+// Compares every benchmark present in both |baseline| and |candidate|.
+// The difference of the means is tested with Welch's t-test, so a benchmark is
+// only reported as regressed or improved when its change exceeds the
+// threshold and the 95% confidence interval of the change excludes zero.
+std::vector<BenchmarkComparison> CompareBenchmarkRuns(
+    const BenchmarkRun& baseline, const BenchmarkRun& candidate,
+    const ComparisonOptions& options);
+
+absl::string_view ComparisonVerdictToString(ComparisonVerdict verdict);
+
+}  // namespace nearby::perf
+
+#endif  // THIRD_PARTY_NEARBY_INTERNAL_PERF_BENCHMARK_COMPARATOR_H_
@@ -0,0 +1,115 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "internal/perf/benchmark_comparator.h"
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "internal/perf/benchmark_results.h"
+
+namespace nearby::perf {
+namespace {
+
+BenchmarkRun MakeRun(const std::vector<double>& real_time_ns) {
+  BenchmarkRun run;
+  BenchmarkResult& result = run.results.emplace_back();
+  result.binary = "codecs";
+  result.name = "BM_Encode";
+  result.real_time_ns = real_time_ns;
+  result.cpu_time_ns = real_time_ns;
+  return run;
+}
+
+ComparisonVerdict Compare(const std::vector<double>& baseline,
+                          const std::vector<double>& candidate,
+                          const ComparisonOptions& options = {}) {
+  std::vector<BenchmarkComparison> comparisons =
+      CompareBenchmarkRuns(MakeRun(baseline), MakeRun(candidate), options);
+  EXPECT_EQ(comparisons.size(), 1);
+  return comparisons.empty() ? ComparisonVerdict::kInsufficientData
+                             : comparisons[0].verdict;
+}
+
+TEST(BenchmarkComparatorTest, ComputeSampleStats) {
+  SampleStats stats = ComputeSampleStats({98, 100, 102, 100});
+
+  EXPECT_EQ(stats.count, 4);
+  EXPECT_DOUBLE_EQ(stats.mean, 100);
+  EXPECT_NEAR(stats.stddev, 1.633, 0.001);
+  // t(3) = 3.182, margin = 3.182 * 1.633 / 2.
+  EXPECT_NEAR(stats.ci_low, 97.402, 0.01);
+  EXPECT_NEAR(stats.ci_high, 102.598, 0.01);
+}
+
+TEST(BenchmarkComparatorTest, ComputeSampleStatsSingleSample) {
+  SampleStats stats = ComputeSampleStats({42});
+
+  EXPECT_EQ(stats.count, 1);
+  EXPECT_DOUBLE_EQ(stats.mean, 42);
+  EXPECT_DOUBLE_EQ(stats.stddev, 0);
+  EXPECT_DOUBLE_EQ(stats.ci_low, 42);
+  EXPECT_DOUBLE_EQ(stats.ci_high, 42);
+}
+
+TEST(BenchmarkComparatorTest, StudentT95) {
+  EXPECT_DOUBLE_EQ(StudentT95(1), 12.706);
+  EXPECT_DOUBLE_EQ(StudentT95(9.7), 2.262);
+  EXPECT_DOUBLE_EQ(StudentT95(1000), 1.960);
+}
+
+TEST(BenchmarkComparatorTest, SignificantSlowdownIsRegression) {
+  EXPECT_EQ(Compare({100, 101, 99, 100, 100}, {120, 121, 119, 120, 120}),
+            ComparisonVerdict::kRegressed);
+}
+
+TEST(BenchmarkComparatorTest, SignificantSpeedupIsImprovement) {
+  EXPECT_EQ(Compare({100, 101, 99, 100, 100}, {80, 81, 79, 80, 80}),
+            ComparisonVerdict::kImproved);
+}
+
+TEST(BenchmarkComparatorTest, ChangeBelowThresholdIsUnchanged) {
+  EXPECT_EQ(Compare({100, 101, 99, 100, 100}, {102, 103, 101, 102, 102}),
+            ComparisonVerdict::kUnchanged);
+}
+
+TEST(BenchmarkComparatorTest, InsignificantChangeIsNoisy) {
+  EXPECT_EQ(Compare({100, 50, 150, 100}, {120, 60, 180, 120}),
+            ComparisonVerdict::kNoisy);
+}
+
+TEST(BenchmarkComparatorTest, TooFewRepetitionsIsInsufficientData) {
+  EXPECT_EQ(Compare({100, 100}, {200, 200}),
+            ComparisonVerdict::kInsufficientData);
+}
+
+TEST(BenchmarkComparatorTest, ThresholdOverrideUsesLongestPrefix) {
+  ComparisonOptions options;
+  options.threshold_overrides = {{"codecs/", 0.1}, {"codecs/BM_Enc", 0.5}};
+
+  EXPECT_EQ(Compare({100, 101, 99, 100}, {120, 121, 119, 120}, options),
+            ComparisonVerdict::kUnchanged);
+}
+
+TEST(BenchmarkComparatorTest, SkipsBenchmarksMissingFromBaseline) {
+  BenchmarkRun baseline = MakeRun({100, 100, 100});
+  BenchmarkRun candidate = MakeRun({100, 100, 100});
+  candidate.results[0].name = "BM_Decode";
+
+  EXPECT_TRUE(CompareBenchmarkRuns(baseline, candidate, {}).empty());
+}
+
+}  // namespace
+}  // namespace nearby::perf
@@ -0,0 +1,257 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "internal/perf/benchmark_results.h"
+
+#include <filesystem>  // NOLINT(build/c++17)
+#include <fstream>
+#include <optional>
+#include <string>
+#include <system_error>  // NOLINT(build/c++11)
+#include <utility>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "nlohmann/json.hpp"
+
+namespace nearby::perf {
+namespace {
+
+using json = ::nlohmann::json;
+
+// Returns the number of nanoseconds in one |time_unit| as reported by Google
+// Benchmark, or nullopt if the unit is unknown.
+std::optional<double> NanosecondsPerUnit(absl::string_view time_unit) {
+  if (time_unit == "ns") return 1;
+  if (time_unit == "us") return 1e3;
+  if (time_unit == "ms") return 1e6;
+  if (time_unit == "s") return 1e9;
+  return std::nullopt;
+}
+
+json MetadataToJson(const BenchmarkMetadata& metadata) {
+  return {
+      {"timestamp", metadata.timestamp},
+      {"host_name", metadata.host_name},
+      {"kernel", metadata.kernel},
+      {"num_cpus", metadata.num_cpus},
+      {"mhz_per_cpu", metadata.mhz_per_cpu},
+      {"cpu_scaling_enabled", metadata.cpu_scaling_enabled},
+      {"build_type", metadata.build_type},
+      {"revision", metadata.revision},
+  };
+}
+
+BenchmarkMetadata MetadataFromJson(const json& value) {
+  BenchmarkMetadata metadata;
+  metadata.timestamp = value.value("timestamp", "");
+  metadata.host_name = value.value("host_name", "");
+  metadata.kernel = value.value("kernel", "");
+  metadata.num_cpus = value.value("num_cpus", 0);
+  metadata.mhz_per_cpu = value.value("mhz_per_cpu", 0.0);
+  metadata.cpu_scaling_enabled = value.value("cpu_scaling_enabled", false);
+  metadata.build_type = value.value("build_type", "");
+  metadata.revision = value.value("revision", "");
+  return metadata;
+}
+
+json RunToJson(const BenchmarkRun& run) {
+  json results = json::array();
+  for (const BenchmarkResult& result : run.results) {
+    results.push_back({
+        {"binary", result.binary},
+        {"name", result.name},
+        {"real_time_ns", result.real_time_ns},
+        {"cpu_time_ns", result.cpu_time_ns},
+    });
+  }
+  return {
+      {"id", run.id},
+      {"metadata", MetadataToJson(run.metadata)},
+      {"results", std::move(results)},
+  };
+}
+
+BenchmarkRun RunFromJson(const json& value) {
+  BenchmarkRun run;
+  run.id = value.at("id").get<std::string>();
+  run.metadata = MetadataFromJson(value.at("metadata"));
+  for (const json& result : value.at("results")) {
+    BenchmarkResult& run_result = run.results.emplace_back();
+    run_result.binary = result.at("binary").get<std::string>();
+    run_result.name = result.at("name").get<std::string>();
+    run_result.real_time_ns =
+        result.at("real_time_ns").get<std::vector<double>>();
+    run_result.cpu_time_ns =
+        result.at("cpu_time_ns").get<std::vector<double>>();
+  }
+  return run;
+}
+
+}  // namespace
+
+const BenchmarkResult* BenchmarkRun::FindResult(absl::string_view binary,
+                                                absl::string_view name) const {
+  for (const BenchmarkResult& result : results) {
+    if (result.binary == binary && result.name == name) {
+      return &result;
+    }
+  }
+  return nullptr;
+}
+
+absl::Status AppendGoogleBenchmarkJson(absl::string_view binary,
+                                       absl::string_view json_output,
+                                       BenchmarkRun& run) {
+  json output = json::parse(json_output, nullptr, /*allow_exceptions=*/false);
+  if (output.is_discarded() || !output.is_object()) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Output of ", binary, " is not valid JSON"));
+  }
+  try {
+    if (run.metadata.timestamp.empty() && output.contains("context")) {
+      const json& context = output["context"];
+      run.metadata.timestamp = context.value("date", "");
+      run.metadata.host_name = context.value("host_name", "");
+      run.metadata.num_cpus = context.value("num_cpus", 0);
+      run.metadata.mhz_per_cpu = context.value("mhz_per_cpu", 0.0);
+      run.metadata.cpu_scaling_enabled =
+          context.value("cpu_scaling_enabled", false);
+      run.metadata.build_type = context.value("library_build_type", "");
+    }
+
+    // Repetitions of a benchmark are reported as separate entries that share
+    // the same run name.
+    absl::flat_hash_map<std::string, size_t> result_index;
+    for (const json& benchmark : output.value("benchmarks", json::array())) {
+      if (benchmark.value("run_type", "iteration") != "iteration" ||
+          benchmark.value("error_occurred", false)) {
+        continue;
+      }
+      std::string name =
+          benchmark.value("run_name", benchmark.value("name", ""));
+      std::optional<double> unit =
+          NanosecondsPerUnit(benchmark.value("time_unit", "ns"));
+      if (name.empty() || !unit.has_value()) {
+        return absl::InvalidArgumentError(
+            absl::StrCat("Malformed benchmark entry in output of ", binary));
+      }
+      auto [it, inserted] = result_index.emplace(name, run.results.size());
+      if (inserted) {
+        BenchmarkResult& new_result = run.results.emplace_back();
+        new_result.binary = std::string(binary);
+        new_result.name = name;
+      }
+      BenchmarkResult& result = run.results[it->second];
+      result.real_time_ns.push_back(benchmark.at("real_time").get<double>() *
+                                    *unit);
+      result.cpu_time_ns.push_back(benchmark.at("cpu_time").get<double>() *
+                                   *unit);
+    }
+  } catch (const json::exception& e) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Malformed output of ", binary, ": ", e.what()));
+  }
+  return absl::OkStatus();
+}
+
+absl::StatusOr<BenchmarkResultStore> BenchmarkResultStore::Load(
+    const std::filesystem::path& path) {
+  BenchmarkResultStore store;
+  std::error_code error_code;
+  if (!std::filesystem::exists(path, error_code)) {
+    return store;
+  }
+  std::ifstream file(path);
+  if (!file.good()) {
+    return absl::NotFoundError(absl::StrCat("Cannot open ", path.string()));
+  }
+  json contents = json::parse(file, nullptr, /*allow_exceptions=*/false);
+  if (contents.is_discarded() || !contents.is_object()) {
+    return absl::DataLossError(
+        absl::StrCat(path.string(), " is not valid JSON"));
+  }
+  try {
+    int version = contents.at("version").get<int>();
+    if (version > kBenchmarkResultStoreVersion) {
+      return absl::FailedPreconditionError(
+          absl::StrCat(path.string(), " has version ", version,
+                       ", newer than the supported version ",
+                       kBenchmarkResultStoreVersion));
+    }
+    for (const json& run : contents.at("runs")) {
+      store.runs_.push_back(RunFromJson(run));
+    }
+  } catch (const json::exception& e) {
+    return absl::DataLossError(
+        absl::StrCat(path.string(), " is malformed: ", e.what()));
+  }
+  return store;
+}
+
+absl::Status BenchmarkResultStore::Save(
+    const std::filesystem::path& path) const {
+  json runs = json::array();
+  for (const BenchmarkRun& run : runs_) {
+    runs.push_back(RunToJson(run));
+  }
+  json contents = {
+      {"version", kBenchmarkResultStoreVersion},
+      {"runs", std::move(runs)},
+  };
+
+  // Write to a temporary file first so an interrupted save does not lose the
+  // history.
+  std::filesystem::path temp_path = path;
+  temp_path += ".tmp";
+  {
+    std::ofstream file(temp_path, std::ios::trunc);
+    file << contents.dump(/*indent=*/2) << "\n";
+    if (!file.good()) {
+      return absl::InternalError(
+          absl::StrCat("Cannot write ", temp_path.string()));
+    }
+  }
+  std::error_code error_code;
+  std::filesystem::rename(temp_path, path, error_code);
+  if (error_code) {
+    return absl::InternalError(absl::StrCat("Cannot replace ", path.string(),
+                                            ": ", error_code.message()));
+  }
+  return absl::OkStatus();
+}
+
+absl::Status BenchmarkResultStore::AddRun(BenchmarkRun run) {
+  if (FindRun(run.id) != nullptr) {
+    return absl::AlreadyExistsError(
+        absl::StrCat("Run ", run.id, " already exists"));
+  }
+  runs_.push_back(std::move(run));
+  return absl::OkStatus();
+}
+
+const BenchmarkRun* BenchmarkResultStore::FindRun(absl::string_view id) const {
+  for (const BenchmarkRun& run : runs_) {
+    if (run.id == id) {
+      return &run;
+    }
+  }
+  return nullptr;
+}
+
+}  // namespace nearby::perf
@@ -0,0 +1,105 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef THIRD_PARTY_NEARBY_INTERNAL_PERF_BENCHMARK_RESULTS_H_
+#define THIRD_PARTY_NEARBY_INTERNAL_PERF_BENCHMARK_RESULTS_H_
+
+#include <cstdint>
+#include <filesystem>  // NOLINT(build/c++17)
+#include <string>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+
+namespace nearby::perf {
+
+// Version of the results file format written by BenchmarkResultStore. Files
+// with a newer version are rejected instead of being silently misread.
+inline constexpr int kBenchmarkResultStoreVersion = 1;
+
+// Describes the machine and the build a benchmark run was taken on. Runs are
+// only comparable when they come from the same machine and build type.
+struct BenchmarkMetadata {
+  // Time the run started, in RFC 3339 format.
+  std::string timestamp;
+  std::string host_name;
+  // Operating system and kernel release, e.g. "Linux 6.1.0".
+  std::string kernel;
+  int num_cpus = 0;
+  double mhz_per_cpu = 0;
+  bool cpu_scaling_enabled = false;
+  // Build type of the benchmark library, "release" or "debug".
+  std::string build_type;
+  // Source revision the benchmarks were built from.
+  std::string revision;
+};
+
+// All repetitions of one benchmark. Times are in nanoseconds per iteration.
+struct BenchmarkResult {
+  // Benchmark binary the result came from, e.g. "presence_benchmark".
+  std::string binary;
+  // Benchmark name including its arguments, e.g. "BM_Encode/16".
+  std::string name;
+  std::vector<double> real_time_ns;
+  std::vector<double> cpu_time_ns;
+};
+
+// One invocation of the benchmark tool, possibly across several binaries.
+struct BenchmarkRun {
+  std::string id;
+  BenchmarkMetadata metadata;
+  std::vector<BenchmarkResult> results;
+
+  // Returns the result of |name| in |binary|, or nullptr if not found.
+  const BenchmarkResult* FindResult(absl::string_view binary,
+                                    absl::string_view name) const;
+};
+
+// Parses the JSON written by a benchmark binary with
+// --benchmark_format=json and appends its per-repetition results to |run|.
+// Aggregates (mean, median, stddev) and benchmarks that reported an error are
+// skipped, since statistics are computed from the raw repetitions. If |run|
+// has no metadata yet, it is filled in from the JSON context.
+absl::Status AppendGoogleBenchmarkJson(absl::string_view binary,
+                                       absl::string_view json_output,
+                                       BenchmarkRun& run);
+
+// A local file holding the history of benchmark runs, oldest first.
+// This class is thread-compatible.
+class BenchmarkResultStore {
+ public:
+  // Loads the store from |path|. A missing file yields an empty store.
+  static absl::StatusOr<BenchmarkResultStore> Load(
+      const std::filesystem::path& path);
+
+  // Writes the store to |path|, replacing the file atomically.
+  absl::Status Save(const std::filesystem::path& path) const;
+
+  // Appends |run|. Fails if a run with the same id is already stored.
+  absl::Status AddRun(BenchmarkRun run);
+
+  // Returns the run with |id|, or nullptr if not found.
+  const BenchmarkRun* FindRun(absl::string_view id) const;
+
+  const std::vector<BenchmarkRun>& runs() const { return runs_; }
+
+ private:
+  std::vector<BenchmarkRun> runs_;
+};
+
+}  // namespace nearby::perf
+
+#endif  // THIRD_PARTY_NEARBY_INTERNAL_PERF_BENCHMARK_RESULTS_H_
@@ -0,0 +1,139 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "internal/perf/benchmark_results.h"
+
+#include <filesystem>  // NOLINT
+#include <fstream>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+
+namespace nearby::perf {
+namespace {
+
+using ::testing::ElementsAre;
+
+constexpr char kBenchmarkJson[] = R"json({
+  "context": {
+    "date": "2024-05-02T10:00:00+00:00",
+    "host_name": "devbox",
+    "num_cpus": 8,
+    "mhz_per_cpu": 3000,
+    "cpu_scaling_enabled": false,
+    "library_build_type": "release"
+  },
+  "benchmarks": [
+    {"name": "BM_Encode/16", "run_name": "BM_Encode/16",
+     "run_type": "iteration", "repetitions": 2, "repetition_index": 0,
+     "real_time": 1.5, "cpu_time": 1.25, "time_unit": "us"},
+    {"name": "BM_Encode/16", "run_name": "BM_Encode/16",
+     "run_type": "iteration", "repetitions": 2, "repetition_index": 1,
+     "real_time": 2.5, "cpu_time": 2.0, "time_unit": "us"},
+    {"name": "BM_Encode/16_mean", "run_name": "BM_Encode/16",
+     "run_type": "aggregate", "aggregate_name": "mean",
+     "real_time": 2.0, "cpu_time": 1.625, "time_unit": "us"},
+    {"name": "BM_Decode", "run_name": "BM_Decode", "run_type": "iteration",
+     "real_time": 40, "cpu_time": 30, "time_unit": "ns"},
+    {"name": "BM_Broken", "run_name": "BM_Broken", "run_type": "iteration",
+     "error_occurred": true, "error_message": "skipped"}
+  ]
+})json";
+
+TEST(BenchmarkResultsTest, AppendGoogleBenchmarkJson) {
+  BenchmarkRun run;
+
+  ASSERT_TRUE(AppendGoogleBenchmarkJson("codecs", kBenchmarkJson, run).ok());
+
+  EXPECT_EQ(run.metadata.host_name, "devbox");
+  EXPECT_EQ(run.metadata.num_cpus, 8);
+  EXPECT_EQ(run.metadata.build_type, "release");
+  ASSERT_EQ(run.results.size(), 2);
+  const BenchmarkResult* encode = run.FindResult("codecs", "BM_Encode/16");
+  ASSERT_NE(encode, nullptr);
+  EXPECT_THAT(encode->real_time_ns, ElementsAre(1500, 2500));
+  EXPECT_THAT(encode->cpu_time_ns, ElementsAre(1250, 2000));
+  const BenchmarkResult* decode = run.FindResult("codecs", "BM_Decode");
+  ASSERT_NE(decode, nullptr);
+  EXPECT_THAT(decode->real_time_ns, ElementsAre(40));
+  EXPECT_EQ(run.FindResult("codecs", "BM_Broken"), nullptr);
+}
+
+TEST(BenchmarkResultsTest, AppendInvalidJsonFails) {
+  BenchmarkRun run;
+
+  EXPECT_EQ(AppendGoogleBenchmarkJson("codecs", "{not json", run).code(),
+            absl::StatusCode::kInvalidArgument);
+}
+
+TEST(BenchmarkResultsTest, StoreRoundTrip) {
+  std::filesystem::path path =
+      std::filesystem::path(testing::TempDir()) / "round_trip.json";
+  std::filesystem::remove(path);
+  BenchmarkRun run;
+  run.id = "before";
+  run.metadata.revision = "abc123";
+  ASSERT_TRUE(AppendGoogleBenchmarkJson("codecs", kBenchmarkJson, run).ok());
+  BenchmarkResultStore store;
+  ASSERT_TRUE(store.AddRun(run).ok());
+
+  ASSERT_TRUE(store.Save(path).ok());
+  absl::StatusOr<BenchmarkResultStore> loaded =
+      BenchmarkResultStore::Load(path);
+
+  ASSERT_TRUE(loaded.ok());
+  const BenchmarkRun* loaded_run = loaded->FindRun("before");
+  ASSERT_NE(loaded_run, nullptr);
+  EXPECT_EQ(loaded_run->metadata.revision, "abc123");
+  EXPECT_EQ(loaded_run->metadata.host_name, "devbox");
+  const BenchmarkResult* encode =
+      loaded_run->FindResult("codecs", "BM_Encode/16");
+  ASSERT_NE(encode, nullptr);
+  EXPECT_THAT(encode->real_time_ns, ElementsAre(1500, 2500));
+  std::filesystem::remove(path);
+}
+
+TEST(BenchmarkResultsTest, LoadMissingFileReturnsEmptyStore) {
+  absl::StatusOr<BenchmarkResultStore> store = BenchmarkResultStore::Load(
+      std::filesystem::path(testing::TempDir()) / "does_not_exist.json");
+
+  ASSERT_TRUE(store.ok());
+  EXPECT_TRUE(store->runs().empty());
+}
+
+TEST(BenchmarkResultsTest, LoadNewerVersionFails) {
+  std::filesystem::path path =
+      std::filesystem::path(testing::TempDir()) / "newer.json";
+  std::ofstream(path) << R"({"version": )" << kBenchmarkResultStoreVersion + 1
+                      << R"(, "runs": []})";
+
+  EXPECT_EQ(BenchmarkResultStore::Load(path).status().code(),
+            absl::StatusCode::kFailedPrecondition);
+  std::filesystem::remove(path);
+}
+
+TEST(BenchmarkResultsTest, AddRunRejectsDuplicateId) {
+  BenchmarkResultStore store;
+  BenchmarkRun run;
+  run.id = "before";
+
+  ASSERT_TRUE(store.AddRun(run).ok());
+  EXPECT_EQ(store.AddRun(run).code(), absl::StatusCode::kAlreadyExists);
+  EXPECT_EQ(store.runs().size(), 1);
+}
+
+}  // namespace
+}  // namespace nearby::perf
@@ -0,0 +1,163 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "internal/perf/benchmark_runner.h"
+
+#include <sys/utsname.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <filesystem>  // NOLINT(build/c++17)
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <system_error>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/strip.h"
+#include "absl/types/span.h"
+#include "internal/perf/benchmark_results.h"
+
+namespace nearby::perf {
+namespace {
+
+// Every cc_binary of the repository that links
+// @com_github_google_benchmark//:benchmark_main, so that a run covers them
+// all unless --benchmarks narrows it down.
+constexpr RegisteredBenchmark kRegisteredBenchmarks[] = {
+    {"advertisement_codecs",
+     "connections/implementation/advertisement_codecs_benchmark"},
+    {"cancellation", "connections/implementation/cancellation_benchmark"},
+    {"datagram", "connections/implementation/datagram_benchmark"},
+    {"encryption", "connections/implementation/encryption_benchmark"},
+    {"endpoint_channel_manager",
+     "connections/implementation/endpoint_channel_manager_benchmark"},
+    {"low_latency_stream",
+     "connections/implementation/low_latency_stream_benchmark"},
+    {"p2p_discovery", "connections/implementation/p2p_discovery_benchmark"},
+    {"payload_header", "connections/implementation/payload_header_benchmark"},
+    {"payload_receive", "connections/implementation/payload_receive_benchmark"},
+    {"wifi_lan_discovery",
+     "connections/implementation/wifi_lan_discovery_benchmark"},
+    {"presence", "presence/implementation/presence_benchmark"},
+    {"public_certificate_decryption",
+     "sharing/certificates/public_certificate_decryption_benchmark"},
+    {"nearby_sharing_transfer", "sharing/nearby_sharing_transfer_benchmark"},
+};
+
+// Runs |argv| and waits for it to exit. Returns the exit status.
+absl::StatusOr<int> RunProcess(const std::vector<std::string>& argv) {
+  std::vector<char*> args;
+  for (const std::string& arg : argv) {
+    args.push_back(const_cast<char*>(arg.c_str()));
+  }
+  args.push_back(nullptr);
+
+  pid_t pid = fork();
+  if (pid < 0) {
+    return absl::InternalError("fork failed");
+  }
+  if (pid == 0) {
+    execv(args[0], args.data());
+    _exit(127);
+  }
+  int status = 0;
+  if (waitpid(pid, &status, 0) < 0) {
+    return absl::InternalError("waitpid failed");
+  }
+  if (!WIFEXITED(status)) {
+    return absl::AbortedError(
+        absl::StrCat(argv[0], " was terminated by a signal"));
+  }
+  return WEXITSTATUS(status);
+}
+
+std::string GetGitRevision() {
+  FILE* pipe = popen("git rev-parse HEAD 2>/dev/null", "r");
+  if (pipe == nullptr) {
+    return "";
+  }
+  char buffer[128] = {};
+  std::string revision;
+  if (fgets(buffer, sizeof(buffer), pipe) != nullptr) {
+    revision = std::string(absl::StripTrailingAsciiWhitespace(buffer));
+  }
+  pclose(pipe);
+  return revision;
+}
+
+}  // namespace
+
+absl::Span<const RegisteredBenchmark> GetRegisteredBenchmarks() {
+  return kRegisteredBenchmarks;
+}
+
+absl::StatusOr<std::string> RunBenchmarkBinary(
+    const std::filesystem::path& binary, const BenchmarkRunOptions& options) {
+  std::error_code error_code;
+  if (!std::filesystem::exists(binary, error_code)) {
+    return absl::NotFoundError(
+        absl::StrCat(binary.string(), " does not exist; build it first"));
+  }
+  std::filesystem::path output_path =
+      std::filesystem::temp_directory_path(error_code) /
+      absl::StrCat("nearby_benchmark_", getpid(), ".json");
+
+  std::vector<std::string> argv = {
+      binary.string(),
+      absl::StrCat("--benchmark_out=", output_path.string()),
+      "--benchmark_out_format=json",
+      absl::StrCat("--benchmark_repetitions=", options.repetitions),
+      "--benchmark_enable_random_interleaving=true",
+  };
+  if (!options.filter.empty()) {
+    argv.push_back(absl::StrCat("--benchmark_filter=", options.filter));
+  }
+  absl::StatusOr<int> exit_code = RunProcess(argv);
+  if (!exit_code.ok()) {
+    return exit_code.status();
+  }
+  if (*exit_code != 0) {
+    std::filesystem::remove(output_path, error_code);
+    return absl::InternalError(
+        absl::StrCat(binary.string(), " exited with code ", *exit_code));
+  }
+
+  std::ifstream output_file(output_path);
+  std::stringstream output;
+  output << output_file.rdbuf();
+  output_file.close();
+  std::filesystem::remove(output_path, error_code);
+  if (output.str().empty()) {
+    return absl::DataLossError(
+        absl::StrCat(binary.string(), " produced no results"));
+  }
+  return output.str();
+}
+
+void AddHostMetadata(BenchmarkMetadata& metadata) {
+  struct utsname name;
+  if (uname(&name) == 0) {
+    metadata.kernel = absl::StrCat(name.sysname, " ", name.release);
+  }
+  if (metadata.revision.empty()) {
+    metadata.revision = GetGitRevision();
+  }
+}
+
+}  // namespace nearby::perf
@@ -0,0 +1,59 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef THIRD_PARTY_NEARBY_INTERNAL_PERF_BENCHMARK_RUNNER_H_
+#define THIRD_PARTY_NEARBY_INTERNAL_PERF_BENCHMARK_RUNNER_H_
+
+#include <filesystem>  // NOLINT(build/c++17)
+#include <string>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "internal/perf/benchmark_results.h"
+
+namespace nearby::perf {
+
+// A benchmark binary known to the benchmark tool.
+struct RegisteredBenchmark {
+  // Short name used on the command line.
+  absl::string_view name;
+  // Path of the binary relative to the Bazel output directory.
+  absl::string_view path;
+};
+
+// Returns the benchmark binaries of the repository.
+absl::Span<const RegisteredBenchmark> GetRegisteredBenchmarks();
+
+struct BenchmarkRunOptions {
+  // Number of times each benchmark is repeated. The comparator needs several
+  // repetitions to estimate the noise.
+  int repetitions = 10;
+  // Regular expression selecting the benchmarks to run. Empty runs all.
+  std::string filter;
+};
+
+// Runs |binary| and returns its results in Google Benchmark JSON format.
+// Repetitions are interleaved with the other benchmarks of the binary so that
+// slow drifts of the machine state do not bias a single benchmark.
+absl::StatusOr<std::string> RunBenchmarkBinary(
+    const std::filesystem::path& binary, const BenchmarkRunOptions& options);
+
+// Fills in the parts of |metadata| that Google Benchmark does not report: the
+// kernel and, if empty, the source revision of the current git checkout.
+void AddHostMetadata(BenchmarkMetadata& metadata);
+
+}  // namespace nearby::perf
+
+#endif  // THIRD_PARTY_NEARBY_INTERNAL_PERF_BENCHMARK_RUNNER_H_
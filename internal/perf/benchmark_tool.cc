@@ -0,0 +1,285 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Records benchmark results in a local file and compares runs against each
+// other. Works offline; the benchmark binaries must be built beforehand, e.g.
+//
+//   bazel build -c opt //presence/implementation:presence_benchmark
+//   benchmark_tool run --id=before
+//   ... change the code and rebuild ...
+//   benchmark_tool run --id=after
+//   benchmark_tool compare --baseline=before --candidate=after
+//
+// "compare" exits with 1 if any benchmark regressed, so it can gate scripts.
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>  // NOLINT(build/c++17)
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "absl/flags/usage.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_format.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "internal/perf/benchmark_comparator.h"
+#include "internal/perf/benchmark_results.h"
+#include "internal/perf/benchmark_runner.h"
+
+ABSL_FLAG(std::string, store, "benchmark_results.json",
+          "File holding the recorded benchmark runs.");
+ABSL_FLAG(std::string, bin_dir, "bazel-bin",
+          "Directory containing the built benchmark binaries.");
+ABSL_FLAG(std::vector<std::string>, benchmarks, {},
+          "Registered benchmark binaries to run. Empty runs all of them.");
+ABSL_FLAG(std::string, filter, "", "Regular expression of benchmarks to run.");
+ABSL_FLAG(int, repetitions, 10, "Number of repetitions of each benchmark.");
+ABSL_FLAG(std::string, id, "",
+          "Id of the recorded run. Defaults to the current time.");
+ABSL_FLAG(std::string, revision, "",
+          "Source revision of the run. Defaults to the git HEAD.");
+ABSL_FLAG(std::string, baseline, "",
+          "Run to compare against. Defaults to the second latest run.");
+ABSL_FLAG(std::string, candidate, "",
+          "Run to compare. Defaults to the latest run.");
+ABSL_FLAG(std::string, metric, "real_time", "real_time or cpu_time.");
+ABSL_FLAG(double, threshold, 0.05,
+          "Relative slowdown above which a benchmark regressed.");
+ABSL_FLAG(std::vector<std::string>, thresholds, {},
+          "Per benchmark thresholds as <binary/benchmark prefix>=<threshold>.");
+ABSL_FLAG(int, min_repetitions, 3,
+          "Benchmarks with fewer repetitions are not judged.");
+
+namespace nearby::perf {
+namespace {
+
+absl::Status Run(const std::vector<std::string>& paths) {
+  std::filesystem::path store_path = absl::GetFlag(FLAGS_store);
+  absl::StatusOr<BenchmarkResultStore> store =
+      BenchmarkResultStore::Load(store_path);
+  if (!store.ok()) {
+    return store.status();
+  }
+
+  // Binaries given on the command line take precedence over the registered
+  // ones.
+  std::vector<std::pair<std::string, std::filesystem::path>> binaries;
+  for (const std::string& path : paths) {
+    binaries.emplace_back(std::filesystem::path(path).filename().string(),
+                          path);
+  }
+  if (binaries.empty()) {
+    std::vector<std::string> selected = absl::GetFlag(FLAGS_benchmarks);
+    std::filesystem::path bin_dir = absl::GetFlag(FLAGS_bin_dir);
+    for (const RegisteredBenchmark& benchmark : GetRegisteredBenchmarks()) {
+      if (!selected.empty() &&
+          std::find(selected.begin(), selected.end(), benchmark.name) ==
+              selected.end()) {
+        continue;
+      }
+      std::filesystem::path path = bin_dir / std::string(benchmark.path);
+      binaries.emplace_back(path.filename().string(), path);
+    }
+  }
+  if (binaries.empty()) {
+    return absl::InvalidArgumentError("No benchmark binaries selected");
+  }
+
+  BenchmarkRun run;
+  run.id = absl::GetFlag(FLAGS_id);
+  if (run.id.empty()) {
+    run.id = absl::FormatTime("%Y%m%d-%H%M%S", absl::Now(),
+                              absl::LocalTimeZone());
+  }
+  run.metadata.revision = absl::GetFlag(FLAGS_revision);
+
+  BenchmarkRunOptions options;
+  options.repetitions = absl::GetFlag(FLAGS_repetitions);
+  options.filter = absl::GetFlag(FLAGS_filter);
+  for (const auto& [name, path] : binaries) {
+    absl::PrintF("Running %s\n", path.string());
+    absl::StatusOr<std::string> output = RunBenchmarkBinary(path, options);
+    if (!output.ok()) {
+      return output.status();
+    }
+    absl::Status status = AppendGoogleBenchmarkJson(name, *output, run);
+    if (!status.ok()) {
+      return status;
+    }
+  }
+  AddHostMetadata(run.metadata);
+
+  std::string id = run.id;
+  absl::Status status = store->AddRun(std::move(run));
+  if (!status.ok()) {
+    return status;
+  }
+  status = store->Save(store_path);
+  if (status.ok()) {
+    absl::PrintF("Recorded run %s in %s\n", id, store_path.string());
+  }
+  return status;
+}
+
+absl::Status List() {
+  absl::StatusOr<BenchmarkResultStore> store =
+      BenchmarkResultStore::Load(absl::GetFlag(FLAGS_store));
+  if (!store.ok()) {
+    return store.status();
+  }
+  for (const BenchmarkRun& run : store->runs()) {
+    absl::PrintF("%-24s %-26s %-12.12s %s %s, %d results\n", run.id,
+                 run.metadata.timestamp, run.metadata.revision,
+                 run.metadata.host_name, run.metadata.build_type,
+                 run.results.size());
+  }
+  return absl::OkStatus();
+}
+
+absl::StatusOr<ComparisonOptions> GetComparisonOptions() {
+  ComparisonOptions options;
+  std::string metric = absl::GetFlag(FLAGS_metric);
+  if (metric == "real_time") {
+    options.metric = BenchmarkMetric::kRealTime;
+  } else if (metric == "cpu_time") {
+    options.metric = BenchmarkMetric::kCpuTime;
+  } else {
+    return absl::InvalidArgumentError(absl::StrCat("Unknown metric ", metric));
+  }
+  options.threshold = absl::GetFlag(FLAGS_threshold);
+  options.min_repetitions = absl::GetFlag(FLAGS_min_repetitions);
+  for (const std::string& entry : absl::GetFlag(FLAGS_thresholds)) {
+    std::pair<std::string, std::string> parts =
+        absl::StrSplit(entry, absl::MaxSplits('=', 1));
+    double threshold;
+    if (!absl::SimpleAtod(parts.second, &threshold)) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("Invalid threshold ", entry));
+    }
+    options.threshold_overrides.emplace_back(parts.first, threshold);
+  }
+  return options;
+}
+
+// Returns the run with |id|, or the run |offset| positions before the latest
+// one if |id| is empty.
+absl::StatusOr<const BenchmarkRun*> SelectRun(
+    const BenchmarkResultStore& store, absl::string_view id, int offset) {
+  if (!id.empty()) {
+    const BenchmarkRun* run = store.FindRun(id);
+    if (run == nullptr) {
+      return absl::NotFoundError(absl::StrCat("No run with id ", id));
+    }
+    return run;
+  }
+  if (store.runs().size() <= static_cast<size_t>(offset)) {
+    return absl::FailedPreconditionError("Not enough recorded runs");
+  }
+  return &store.runs()[store.runs().size() - 1 - offset];
+}
+
+absl::StatusOr<bool> Compare() {
+  absl::StatusOr<BenchmarkResultStore> store =
+      BenchmarkResultStore::Load(absl::GetFlag(FLAGS_store));
+  if (!store.ok()) {
+    return store.status();
+  }
+  absl::StatusOr<const BenchmarkRun*> candidate =
+      SelectRun(*store, absl::GetFlag(FLAGS_candidate), /*offset=*/0);
+  if (!candidate.ok()) {
+    return candidate.status();
+  }
+  absl::StatusOr<const BenchmarkRun*> baseline =
+      SelectRun(*store, absl::GetFlag(FLAGS_baseline), /*offset=*/1);
+  if (!baseline.ok()) {
+    return baseline.status();
+  }
+  absl::StatusOr<ComparisonOptions> options = GetComparisonOptions();
+  if (!options.ok()) {
+    return options.status();
+  }
+
+  const BenchmarkMetadata& a = (*baseline)->metadata;
+  const BenchmarkMetadata& b = (*candidate)->metadata;
+  absl::PrintF("Baseline:  %s (%s)\nCandidate: %s (%s)\n", (*baseline)->id,
+               a.revision, (*candidate)->id, b.revision);
+  if (a.host_name != b.host_name || a.build_type != b.build_type ||
+      a.num_cpus != b.num_cpus) {
+    absl::PrintF(
+        "WARNING: runs were taken on different machines or build types; "
+        "differences may not be caused by the code.\n");
+  }
+  if (a.cpu_scaling_enabled || b.cpu_scaling_enabled) {
+    absl::PrintF("WARNING: CPU frequency scaling was enabled; results are "
+                 "noisier.\n");
+  }
+
+  bool regressed = false;
+  absl::PrintF("%-60s %12s %12s %8s %19s  %s\n", "Benchmark", "Base (ns)",
+               "New (ns)", "Change", "95% CI", "Verdict");
+  for (const BenchmarkComparison& comparison :
+       CompareBenchmarkRuns(**baseline, **candidate, *options)) {
+    absl::PrintF("%-60s %12.1f %12.1f %+7.1f%% [%+7.1f%%,%+7.1f%%]  %s\n",
+                 absl::StrCat(comparison.binary, "/", comparison.name),
+                 comparison.baseline.mean, comparison.candidate.mean,
+                 comparison.change * 100, comparison.change_ci_low * 100,
+                 comparison.change_ci_high * 100,
+                 ComparisonVerdictToString(comparison.verdict));
+    regressed |= comparison.verdict == ComparisonVerdict::kRegressed;
+  }
+  return regressed;
+}
+
+}  // namespace
+}  // namespace nearby::perf
+
+int main(int argc, char** argv) {
+  absl::SetProgramUsageMessage(
+      "Usage: benchmark_tool run [binary...] | list | compare");
+  std::vector<char*> args = absl::ParseCommandLine(argc, argv);
+  if (args.size() < 2) {
+    absl::FPrintF(stderr, "%s\n", absl::ProgramUsageMessage());
+    return EXIT_FAILURE;
+  }
+  absl::string_view command = args[1];
+  absl::Status status;
+  bool regressed = false;
+  if (command == "run") {
+    status = nearby::perf::Run(
+        std::vector<std::string>(args.begin() + 2, args.end()));
+  } else if (command == "list") {
+    status = nearby::perf::List();
+  } else if (command == "compare") {
+    absl::StatusOr<bool> result = nearby::perf::Compare();
+    status = result.status();
+    regressed = result.value_or(false);
+  } else {
+    absl::FPrintF(stderr, "%s\n", absl::ProgramUsageMessage());
+    return EXIT_FAILURE;
+  }
+  if (!status.ok()) {
+    absl::FPrintF(stderr, "%s\n", status.ToString());
+    return EXIT_FAILURE;
+  }
+  return regressed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,77 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef PLATFORM_BASE_BYTE_SPAN_READER_H_
+#define PLATFORM_BASE_BYTE_SPAN_READER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "absl/strings/string_view.h"
+
+namespace nearby {
+
+// Reads big-endian fields from a borrowed buffer without copying.
+//
+// Every read either consumes exactly the requested bytes or fails without
+// moving the read position. Returned views point into the original buffer,
+// which must outlive them.
+class ByteSpanReader {
+ public:
+  explicit ByteSpanReader(absl::string_view buffer) : buffer_(buffer) {}
+
+  size_t remaining() const { return buffer_.size() - position_; }
+  bool IsAvailable(size_t size) const { return remaining() >= size; }
+
+  std::optional<std::uint8_t> ReadUint8() {
+    if (!IsAvailable(1)) return std::nullopt;
+    return static_cast<std::uint8_t>(buffer_[position_++]);
+  }
+
+  std::optional<std::uint16_t> ReadUint16() {
+    if (!IsAvailable(2)) return std::nullopt;
+    std::uint16_t value = static_cast<std::uint8_t>(buffer_[position_]) << 8 |
+                          static_cast<std::uint8_t>(buffer_[position_ + 1]);
+    position_ += 2;
+    return value;
+  }
+
+  std::optional<absl::string_view> ReadBytes(size_t size) {
+    if (!IsAvailable(size)) return std::nullopt;
+    absl::string_view bytes = buffer_.substr(position_, size);
+    position_ += size;
+    return bytes;
+  }
+
+  absl::string_view ReadRemaining() {
+    absl::string_view bytes = buffer_.substr(position_);
+    position_ = buffer_.size();
+    return bytes;
+  }
+
+  bool Skip(size_t size) {
+    if (!IsAvailable(size)) return false;
+    position_ += size;
+    return true;
+  }
+
+ private:
+  absl::string_view buffer_;
+  size_t position_ = 0;
+};
+
+}  // namespace nearby
+
+#endif  // PLATFORM_BASE_BYTE_SPAN_READER_H_
@@ -0,0 +1,60 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "internal/platform/byte_span_reader.h"
+
+#include <cstdint>
+#include <optional>
+
+#include "gtest/gtest.h"
+#include "absl/strings/string_view.h"
+
+namespace nearby {
+namespace {
+
+constexpr absl::string_view kBytes{"\x01\x02\x03rest", 7};
+
+TEST(ByteSpanReaderTest, ReadsBigEndianFields) {
+  ByteSpanReader reader{kBytes};
+
+  EXPECT_EQ(reader.ReadUint8(), 0x01);
+  EXPECT_EQ(reader.ReadUint16(), 0x0203);
+  EXPECT_EQ(reader.ReadBytes(2), "re");
+  EXPECT_EQ(reader.remaining(), 2);
+  EXPECT_EQ(reader.ReadRemaining(), "st");
+  EXPECT_EQ(reader.remaining(), 0);
+}
+
+TEST(ByteSpanReaderTest, ReadBytesPointsIntoBuffer) {
+  ByteSpanReader reader{kBytes};
+
+  ASSERT_TRUE(reader.Skip(3));
+  std::optional<absl::string_view> bytes = reader.ReadBytes(4);
+
+  ASSERT_TRUE(bytes.has_value());
+  EXPECT_EQ(bytes->data(), kBytes.data() + 3);
+}
+
+TEST(ByteSpanReaderTest, FailedReadDoesNotConsume) {
+  ByteSpanReader reader{absl::string_view("\x01", 1)};
+
+  EXPECT_FALSE(reader.ReadUint16().has_value());
+  EXPECT_FALSE(reader.ReadBytes(2).has_value());
+  EXPECT_FALSE(reader.Skip(2));
+  EXPECT_EQ(reader.ReadUint8(), 0x01);
+  EXPECT_FALSE(reader.ReadUint8().has_value());
+}
+
+}  // namespace
+}  // namespace nearby
@@ -0,0 +1,81 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef PLATFORM_BASE_BYTE_SPAN_WRITER_H_
+#define PLATFORM_BASE_BYTE_SPAN_WRITER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+
+namespace nearby {
+
+// Writes big-endian fields into a caller-provided buffer.
+//
+// Serializers size the output once up front and write every field in place,
+// instead of concatenating per-field temporaries. A write that doesn't fit
+// marks the writer as overflowed and leaves the buffer untouched from that
+// point on.
+class ByteSpanWriter {
+ public:
+  explicit ByteSpanWriter(absl::Span<char> buffer) : buffer_(buffer) {}
+
+  size_t size() const { return position_; }
+  bool overflowed() const { return overflowed_; }
+
+  void WriteUint8(std::uint8_t value) {
+    if (!Reserve(1)) return;
+    buffer_[position_++] = static_cast<char>(value);
+  }
+
+  void WriteUint16(std::uint16_t value) {
+    if (!Reserve(2)) return;
+    buffer_[position_++] = static_cast<char>(value >> 8);
+    buffer_[position_++] = static_cast<char>(value & 0xFF);
+  }
+
+  void WriteBytes(absl::string_view bytes) {
+    if (!Reserve(bytes.size())) return;
+    if (!bytes.empty()) {
+      std::memcpy(buffer_.data() + position_, bytes.data(), bytes.size());
+    }
+    position_ += bytes.size();
+  }
+
+  void WriteZeros(size_t size) {
+    if (!Reserve(size)) return;
+    std::memset(buffer_.data() + position_, 0, size);
+    position_ += size;
+  }
+
+ private:
+  bool Reserve(size_t size) {
+    if (overflowed_ || buffer_.size() - position_ < size) {
+      overflowed_ = true;
+      return false;
+    }
+    return true;
+  }
+
+  absl::Span<char> buffer_;
+  size_t position_ = 0;
+  bool overflowed_ = false;
+};
+
+}  // namespace nearby
+
+#endif  // PLATFORM_BASE_BYTE_SPAN_WRITER_H_
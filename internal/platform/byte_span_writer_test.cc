@@ -0,0 +1,56 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "internal/platform/byte_span_writer.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+
+namespace nearby {
+namespace {
+
+TEST(ByteSpanWriterTest, WritesBigEndianFields) {
+  std::string out(8, 'x');
+  ByteSpanWriter writer{absl::MakeSpan(out)};
+
+  writer.WriteUint8(0x01);
+  writer.WriteUint16(0x0203);
+  writer.WriteBytes("ab");
+  writer.WriteZeros(3);
+
+  EXPECT_FALSE(writer.overflowed());
+  EXPECT_EQ(writer.size(), out.size());
+  EXPECT_EQ(out, absl::string_view("\x01\x02\x03"
+                                   "ab\x00\x00\x00",
+                                   8));
+}
+
+TEST(ByteSpanWriterTest, OverflowStopsWriting) {
+  std::string out(2, 'x');
+  ByteSpanWriter writer{absl::MakeSpan(out)};
+
+  writer.WriteUint8(0x01);
+  writer.WriteUint16(0x0203);
+  writer.WriteUint8(0x04);
+
+  EXPECT_TRUE(writer.overflowed());
+  EXPECT_EQ(writer.size(), 1);
+  EXPECT_EQ(out, "\x01x");
+}
+
+}  // namespace
+}  // namespace nearby
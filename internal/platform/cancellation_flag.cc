@@ -14,6 +14,10 @@
 
 #include "internal/platform/cancellation_flag.h"
 
+#include <atomic>
+#include <memory>
+#include <utility>
+
 #include "internal/platform/feature_flags.h"
 
 namespace nearby {
@@ -27,6 +31,22 @@ CancellationFlag::CancellationFlag(bool cancelled) {
   cancelled_ = cancelled;
 }
 
+CancellationFlag::CancellationFlag(CancellationFlag &&other)
+    : mutex_(std::make_unique<absl::Mutex>()) {
+  *this = std::move(other);
+}
+
+CancellationFlag &CancellationFlag::operator=(CancellationFlag &&other) {
+  if (this == &other) return *this;
+  absl::MutexLock lock(mutex_.get());
+  absl::MutexLock other_lock(other.mutex_.get());
+  cancelled_.store(other.cancelled_.load(std::memory_order_acquire),
+                   std::memory_order_release);
+  listeners_ = std::move(other.listeners_);
+  other.listeners_.clear();
+  return *this;
+}
+
 CancellationFlag::~CancellationFlag() {
   absl::MutexLock lock(mutex_.get());
   listeners_.clear();
@@ -41,11 +61,11 @@ void CancellationFlag::Cancel() {
   absl::flat_hash_set<CancelListener *> listeners;
   {
     absl::MutexLock lock(mutex_.get());
-    if (cancelled_) {
+    if (cancelled_.load(std::memory_order_relaxed)) {
       // Someone already cancelled. Return immediately.
       return;
     }
-    cancelled_ = true;
+    cancelled_.store(true, std::memory_order_release);
 
     listeners = listeners_;
   }
@@ -63,20 +83,20 @@ void CancellationFlag::Uncancel() {
 
   {
     absl::MutexLock lock(mutex_.get());
-    assert(cancelled_);
-    cancelled_ = false;
+    assert(cancelled_.load(std::memory_order_relaxed));
+    cancelled_.store(false, std::memory_order_release);
   }
 }
 
 bool CancellationFlag::Cancelled() const {
-  absl::MutexLock lock(mutex_.get());
-
-  // Return false as no-op if feature flag is not enabled.
-  if (!FeatureFlags::GetInstance().GetFlags().enable_cancellation_flag) {
+  // Fast path: an uncancelled flag is the common case on hot loops, and needs
+  // neither the mutex nor the feature flags.
+  if (!cancelled_.load(std::memory_order_acquire)) {
     return false;
   }
 
-  return cancelled_;
+  // Return false as no-op if feature flag is not enabled.
+  return FeatureFlags::GetInstance().GetFlags().enable_cancellation_flag;
 }
 
 void CancellationFlag::RegisterOnCancelListener(CancelListener *listener) {
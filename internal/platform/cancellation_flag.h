@@ -15,6 +15,7 @@
 #ifndef PLATFORM_BASE_CANCELLATION_FLAG_H_
 #define PLATFORM_BASE_CANCELLATION_FLAG_H_
 
+#include <atomic>
 #include <memory>
 
 #include "absl/container/flat_hash_set.h"
@@ -34,8 +35,8 @@ class CancellationFlag {
   explicit CancellationFlag(bool cancelled);
   CancellationFlag(const CancellationFlag &) = delete;
   CancellationFlag &operator=(const CancellationFlag &) = delete;
-  CancellationFlag(CancellationFlag &&) = default;
-  CancellationFlag &operator=(CancellationFlag &&) = default;
+  CancellationFlag(CancellationFlag &&other);
+  CancellationFlag &operator=(CancellationFlag &&other);
   virtual ~CancellationFlag();
 
   // Set the flag as cancelled.
@@ -51,7 +52,10 @@ class CancellationFlag {
   void Uncancel() ABSL_LOCKS_EXCLUDED(mutex_);
 
   // Returns true if the flag has been set to cancelled.
-  bool Cancelled() const ABSL_LOCKS_EXCLUDED(mutex_);
+  //
+  // Takes no lock while the flag is not cancelled, so it is cheap enough to
+  // poll on every iteration of a send or connect loop.
+  bool Cancelled() const;
 
  private:
   friend class CancellationFlagListener;
@@ -79,7 +83,8 @@ class CancellationFlag {
   }
 
   std::unique_ptr<absl::Mutex> mutex_;
-  bool cancelled_ ABSL_GUARDED_BY(mutex_) = false;
+  // Only written under `mutex_`, so that listeners are called exactly once.
+  std::atomic<bool> cancelled_ = false;
   absl::flat_hash_set<CancelListener *> ABSL_GUARDED_BY(mutex_) listeners_;
 };
 
@@ -14,7 +14,9 @@
 
 #include "internal/platform/cancellation_flag.h"
 
+#include <atomic>
 #include <memory>
+#include <thread>  // NOLINT
 #include <utility>
 
 #include "gmock/gmock.h"
@@ -148,6 +150,43 @@ TEST_P(CancellationFlagTest, CannotCancelAfterUnregister) {
   flag.Cancel();
 }
 
+TEST_P(CancellationFlagTest, CanUncancel) {
+  CancellationFlag flag;
+  flag.Cancel();
+  flag.Uncancel();
+
+  EXPECT_FALSE(flag.Cancelled());
+}
+
+TEST_P(CancellationFlagTest, MoveKeepsCancelledState) {
+  CancellationFlag flag;
+  flag.Cancel();
+
+  CancellationFlag moved_flag{std::move(flag)};
+
+  EXPECT_EQ(moved_flag.Cancelled(), feature_flags_.enable_cancellation_flag);
+}
+
+TEST_P(CancellationFlagTest, PollingThreadSeesCancel) {
+  if (!feature_flags_.enable_cancellation_flag) {
+    GTEST_SKIP();
+  }
+  CancellationFlag flag;
+  std::atomic<bool> polling = false;
+  std::thread poller([&flag, &polling]() {
+    polling = true;
+    while (!flag.Cancelled()) {
+    }
+  });
+  while (!polling) {
+  }
+
+  flag.Cancel();
+
+  poller.join();
+  EXPECT_TRUE(flag.Cancelled());
+}
+
 INSTANTIATE_TEST_SUITE_P(ParametrisedCancellationFlagTest, CancellationFlagTest,
                          ::testing::ValuesIn(kTestCases));
 
@@ -18,6 +18,7 @@
 #include "internal/platform/implementation/condition_variable.h"
 #include "internal/platform/implementation/platform.h"
 #include "internal/platform/exception.h"
+#include "internal/platform/lock_profiler.h"
 #include "internal/platform/mutex.h"
 
 namespace nearby {
@@ -30,16 +31,40 @@ class ConditionVariable final {
  public:
   using Platform = api::ImplementationPlatform;
   explicit ConditionVariable(Mutex* mutex)
-      : impl_(Platform::CreateConditionVariable(mutex->impl_.get())) {}
+      : impl_(Platform::CreateConditionVariable(mutex->impl_.get())) {
+#if defined(NEARBY_LOCK_PROFILING)
+    mutex_ = mutex;
+#endif
+  }
   ConditionVariable(ConditionVariable&&) = default;
   ConditionVariable& operator=(ConditionVariable&&) = default;
 
   void Notify() { impl_->Notify(); }
+#if defined(NEARBY_LOCK_PROFILING)
+  // The time spent waiting is recorded for the site of the Wait() call, and
+  // not counted as hold time of the mutex.
+  Exception Wait(NEARBY_LOCK_SITE_PARAMS) {
+    MutexProfile::ConditionWait wait = mutex_->profile_.BeginConditionWait();
+    Exception result = impl_->Wait();
+    mutex_->profile_.EndConditionWait(wait, {lock_file, lock_line});
+    return result;
+  }
+  Exception Wait(absl::Duration timeout, NEARBY_LOCK_SITE_PARAMS) {
+    MutexProfile::ConditionWait wait = mutex_->profile_.BeginConditionWait();
+    Exception result = impl_->Wait(timeout);
+    mutex_->profile_.EndConditionWait(wait, {lock_file, lock_line});
+    return result;
+  }
+#else
   Exception Wait() { return impl_->Wait(); }
   Exception Wait(absl::Duration timeout) { return impl_->Wait(timeout); }
+#endif
 
  private:
   std::unique_ptr<api::ConditionVariable> impl_;
+#if defined(NEARBY_LOCK_PROFILING)
+  Mutex* mutex_;
+#endif
 };
 
 }  // namespace nearby
@@ -48,6 +48,17 @@ class FeatureFlags {
     // necessary to properly support multiple BWU mediums, multiple service, and
     // multiple endpoints.
     bool support_multiple_bwu_mediums = true;
+    // Offer several upgrade mediums in one bandwidth upgrade negotiation and
+    // let the responder attempt them concurrently, instead of trying them one
+    // negotiation at a time. Requires support_multiple_bwu_mediums.
+    bool enable_bwu_medium_racing = false;
+    // Derive the keys of a connection from the session of an earlier
+    // connection to the same remote device, e.g. one for another service,
+    // instead of running a UKEY2 handshake for every connection.
+    bool enable_shared_key_hub = false;
+    // Send the full payload header only with the first DATA frame of a
+    // payload, to remote devices that support it.
+    bool enable_payload_header_elision = false;
     // Allows the code to change the bluetooth radio state
     bool enable_set_radio_state = false;
     // If the feature is enabled, medium connection will timeout when cannot
@@ -109,6 +120,10 @@ class FeatureFlags {
     // The timeout for waiting on connection request response.
     absl::Duration multiplex_socket_connection_response_timeout_millis =
         absl::Milliseconds(3000);
+    // If true, EstablishVirtualSocket returns the virtual socket right after
+    // sending the connection request instead of waiting for the response. The
+    // remote buffers the early data frames until it accepts the request.
+    bool enable_multiplex_optimistic_virtual_socket = false;
     // The capacity of the middle priority queue inner MultiplexOutputStream.
     // The new outgoing frame with the middle priority will wait for space to
     // become available if the queue is full.'
@@ -25,6 +25,7 @@
 #include "absl/strings/string_view.h"
 #include "absl/synchronization/mutex.h"
 #include "internal/platform/cancellation_flag.h"
+#include "internal/platform/cancellation_flag_listener.h"
 #include "internal/platform/exception.h"
 #include "internal/platform/implementation/wifi_direct.h"
 #include "internal/platform/logging.h"
@@ -226,10 +227,21 @@ std::unique_ptr<api::WifiDirectSocket> WifiDirectMedium::ConnectToService(
     return nullptr;
   }
 
+  CancellationFlagListener listener(cancellation_flag, [&server_socket]() {
+    NEARBY_LOGS(INFO) << "G3 WifiDirect Cancel Connect.";
+    if (server_socket != nullptr) {
+      server_socket->Close();
+    }
+  });
+
   auto socket = std::make_unique<WifiDirectSocket>();
   // Finally, Request to connect to this socket.
-
-  server_socket->Connect(*socket);
+  if (!server_socket->Connect(*socket)) {
+    NEARBY_LOGS(ERROR) << "G3 WifiDirect Failed to connect to existing "
+                          "WifiDirect Server socket: name="
+                       << socket_name;
+    return nullptr;
+  }
   NEARBY_LOGS(INFO) << "G3 WifiDirect GC ConnectToService: connected: socket="
                     << socket.get();
   return socket;
@@ -0,0 +1,315 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "internal/platform/lock_profiler.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_format.h"
+#include "absl/time/time.h"
+
+#if defined(NEARBY_LOCK_PROFILING)
+#include <atomic>
+#include <thread>  // NOLINT
+#include <utility>
+
+#include "absl/base/no_destructor.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
+#endif
+
+namespace nearby {
+
+#if defined(NEARBY_LOCK_PROFILING)
+namespace {
+
+using SiteKey = std::pair<const char*, int>;
+
+struct Counters {
+  std::int64_t acquisitions = 0;
+  std::int64_t contentions = 0;
+  std::int64_t wait_nanos = 0;
+  std::int64_t max_wait_nanos = 0;
+  std::int64_t hold_nanos = 0;
+  std::int64_t max_hold_nanos = 0;
+  std::int64_t condition_waits = 0;
+  std::int64_t condition_wait_nanos = 0;
+
+  void Merge(const Counters& other) {
+    acquisitions += other.acquisitions;
+    contentions += other.contentions;
+    wait_nanos += other.wait_nanos;
+    max_wait_nanos = std::max(max_wait_nanos, other.max_wait_nanos);
+    hold_nanos += other.hold_nanos;
+    max_hold_nanos = std::max(max_hold_nanos, other.max_hold_nanos);
+    condition_waits += other.condition_waits;
+    condition_wait_nanos += other.condition_wait_nanos;
+  }
+};
+
+using CountersMap = absl::flat_hash_map<SiteKey, Counters>;
+
+class ThreadBuffer;
+
+// Set once the thread's buffer is destroyed, while other thread-local objects
+// of the exiting thread may still lock mutexes.
+thread_local bool thread_buffer_destroyed = false;
+
+// Buffers of the live threads, and what the exited threads recorded. The
+// profiler uses absl::Mutex, since nearby::Mutex is what it instruments.
+struct Registry {
+  absl::Mutex mutex;
+  absl::flat_hash_set<ThreadBuffer*> buffers ABSL_GUARDED_BY(mutex);
+  CountersMap exited ABSL_GUARDED_BY(mutex);
+};
+
+Registry& GetRegistry() {
+  static absl::NoDestructor<Registry> registry;
+  return *registry;
+}
+
+// Samples recorded by one thread. Its mutex is only contended while a report
+// is being made.
+class ThreadBuffer {
+ public:
+  ThreadBuffer() {
+    Registry& registry = GetRegistry();
+    absl::MutexLock lock(&registry.mutex);
+    registry.buffers.insert(this);
+  }
+  ~ThreadBuffer() {
+    thread_buffer_destroyed = true;
+    Registry& registry = GetRegistry();
+    absl::MutexLock lock(&registry.mutex);
+    registry.buffers.erase(this);
+    absl::MutexLock buffer_lock(&mutex_);
+    for (const auto& [key, counters] : counters_) {
+      registry.exited[key].Merge(counters);
+    }
+  }
+
+  template <typename F>
+  void Update(LockProfiler::Site site, F update) {
+    absl::MutexLock lock(&mutex_);
+    update(counters_[SiteKey(site.file, site.line)]);
+  }
+
+  void MergeInto(CountersMap& counters) {
+    absl::MutexLock lock(&mutex_);
+    for (const auto& [key, buffer_counters] : counters_) {
+      counters[key].Merge(buffer_counters);
+    }
+  }
+
+  void Clear() {
+    absl::MutexLock lock(&mutex_);
+    counters_.clear();
+  }
+
+ private:
+  absl::Mutex mutex_;
+  CountersMap counters_ ABSL_GUARDED_BY(mutex_);
+};
+
+template <typename F>
+void UpdateThreadBuffer(LockProfiler::Site site, F update) {
+  if (thread_buffer_destroyed) return;
+  thread_local ThreadBuffer buffer;
+  buffer.Update(site, std::move(update));
+}
+
+std::int64_t NowNanos() { return absl::GetCurrentTimeNanos(); }
+
+}  // namespace
+
+void LockProfiler::RecordLock(Site site, bool contended,
+                              std::int64_t begin_nanos,
+                              std::int64_t end_nanos) {
+  std::int64_t wait_nanos = end_nanos - begin_nanos;
+  UpdateThreadBuffer(site, [contended, wait_nanos](Counters& counters) {
+    ++counters.acquisitions;
+    if (!contended) return;
+    ++counters.contentions;
+    counters.wait_nanos += wait_nanos;
+    counters.max_wait_nanos = std::max(counters.max_wait_nanos, wait_nanos);
+  });
+}
+
+void LockProfiler::RecordHold(Site site, std::int64_t begin_nanos,
+                              std::int64_t end_nanos) {
+  std::int64_t hold_nanos = end_nanos - begin_nanos;
+  UpdateThreadBuffer(site, [hold_nanos](Counters& counters) {
+    counters.hold_nanos += hold_nanos;
+    counters.max_hold_nanos = std::max(counters.max_hold_nanos, hold_nanos);
+  });
+}
+
+void LockProfiler::RecordConditionWait(Site site, std::int64_t begin_nanos,
+                                       std::int64_t end_nanos) {
+  std::int64_t wait_nanos = end_nanos - begin_nanos;
+  UpdateThreadBuffer(site, [wait_nanos](Counters& counters) {
+    ++counters.condition_waits;
+    counters.condition_wait_nanos += wait_nanos;
+  });
+}
+
+std::vector<LockProfiler::SiteStats> LockProfiler::GetReport() {
+  CountersMap counters;
+  {
+    Registry& registry = GetRegistry();
+    absl::MutexLock lock(&registry.mutex);
+    for (const auto& [key, exited_counters] : registry.exited) {
+      counters[key].Merge(exited_counters);
+    }
+    for (ThreadBuffer* buffer : registry.buffers) {
+      buffer->MergeInto(counters);
+    }
+  }
+
+  // The same file may be named by several pointers, one per translation unit.
+  absl::flat_hash_map<std::string, Counters> sites;
+  for (const auto& [key, site_counters] : counters) {
+    sites[absl::StrCat(key.first, ":", key.second)].Merge(site_counters);
+  }
+  std::vector<SiteStats> report;
+  report.reserve(sites.size());
+  for (const auto& [site, site_counters] : sites) {
+    report.push_back({
+        .site = site,
+        .acquisitions = site_counters.acquisitions,
+        .contentions = site_counters.contentions,
+        .wait_time = absl::Nanoseconds(site_counters.wait_nanos),
+        .max_wait_time = absl::Nanoseconds(site_counters.max_wait_nanos),
+        .hold_time = absl::Nanoseconds(site_counters.hold_nanos),
+        .max_hold_time = absl::Nanoseconds(site_counters.max_hold_nanos),
+        .condition_waits = site_counters.condition_waits,
+        .condition_wait_time =
+            absl::Nanoseconds(site_counters.condition_wait_nanos),
+    });
+  }
+  std::sort(report.begin(), report.end(),
+            [](const SiteStats& a, const SiteStats& b) {
+              if (a.wait_time != b.wait_time) return a.wait_time > b.wait_time;
+              if (a.contentions != b.contentions) {
+                return a.contentions > b.contentions;
+              }
+              return a.site < b.site;
+            });
+  return report;
+}
+
+void LockProfiler::Reset() {
+  Registry& registry = GetRegistry();
+  absl::MutexLock lock(&registry.mutex);
+  registry.exited.clear();
+  for (ThreadBuffer* buffer : registry.buffers) {
+    buffer->Clear();
+  }
+}
+
+MutexProfile::LockAttempt MutexProfile::BeginLock() {
+  if (recursive_ &&
+      owner_.load(std::memory_order_relaxed) == std::this_thread::get_id()) {
+    ++depth_;
+    return {.nested = true};
+  }
+  bool contended = lockers_.fetch_add(1, std::memory_order_relaxed) > 0;
+  return {.contended = contended, .begin_nanos = NowNanos()};
+}
+
+void MutexProfile::EndLock(const LockAttempt& attempt,
+                           LockProfiler::Site site) {
+  if (attempt.nested) return;
+  std::int64_t now = NowNanos();
+  if (recursive_) {
+    owner_.store(std::this_thread::get_id(), std::memory_order_relaxed);
+    depth_ = 1;
+  }
+  site_ = site;
+  hold_begin_nanos_ = now;
+  LockProfiler::RecordLock(site, attempt.contended, attempt.begin_nanos, now);
+}
+
+void MutexProfile::Unlock() {
+  if (recursive_) {
+    if (--depth_ > 0) return;
+    owner_.store(std::thread::id(), std::memory_order_relaxed);
+  }
+  LockProfiler::RecordHold(site_, hold_begin_nanos_, NowNanos());
+  lockers_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+MutexProfile::ConditionWait MutexProfile::BeginConditionWait() {
+  std::int64_t now = NowNanos();
+  LockProfiler::RecordHold(site_, hold_begin_nanos_, now);
+  ConditionWait wait = {.held_site = site_, .begin_nanos = now};
+  lockers_.fetch_sub(1, std::memory_order_relaxed);
+  return wait;
+}
+
+void MutexProfile::EndConditionWait(const ConditionWait& wait,
+                                    LockProfiler::Site site) {
+  lockers_.fetch_add(1, std::memory_order_relaxed);
+  std::int64_t now = NowNanos();
+  LockProfiler::RecordConditionWait(site, wait.begin_nanos, now);
+  site_ = wait.held_site;
+  hold_begin_nanos_ = now;
+}
+
+#else
+
+std::vector<LockProfiler::SiteStats> LockProfiler::GetReport() { return {}; }
+
+void LockProfiler::Reset() {}
+
+#endif  // defined(NEARBY_LOCK_PROFILING)
+
+std::string LockProfiler::FormatReport(std::size_t max_sites) {
+  if (!IsEnabled()) {
+    return "Lock profiling is disabled; build with "
+           "-DNEARBY_LOCK_PROFILING to enable it.\n";
+  }
+  std::vector<SiteStats> report = GetReport();
+  std::string result = absl::StrFormat(
+      "%-60s %10s %10s %10s %10s %10s %10s %8s %10s\n", "site", "locks",
+      "contended", "wait_ms", "max_wait", "hold_ms", "max_hold", "cv_waits",
+      "cv_wait_ms");
+  for (std::size_t i = 0; i < report.size() && i < max_sites; ++i) {
+    const SiteStats& stats = report[i];
+    absl::StrAppendFormat(
+        &result, "%-60s %10d %10d %10.3f %10.3f %10.3f %10.3f %8d %10.3f\n",
+        stats.site, stats.acquisitions, stats.contentions,
+        absl::ToDoubleMilliseconds(stats.wait_time),
+        absl::ToDoubleMilliseconds(stats.max_wait_time),
+        absl::ToDoubleMilliseconds(stats.hold_time),
+        absl::ToDoubleMilliseconds(stats.max_hold_time),
+        stats.condition_waits,
+        absl::ToDoubleMilliseconds(stats.condition_wait_time));
+  }
+  if (report.size() > max_sites) {
+    absl::StrAppend(&result, "... and ", report.size() - max_sites,
+                    " more lock sites\n");
+  }
+  return result;
+}
+
+}  // namespace nearby
@@ -0,0 +1,152 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef PLATFORM_PUBLIC_LOCK_PROFILER_H_
+#define PLATFORM_PUBLIC_LOCK_PROFILER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "absl/time/time.h"
+
+#if defined(NEARBY_LOCK_PROFILING)
+#include <atomic>
+#include <thread>  // NOLINT
+#endif
+
+namespace nearby {
+
+// Lock contention profiler for Mutex, RecursiveMutex and ConditionVariable.
+//
+// Profiling is compiled in only when NEARBY_LOCK_PROFILING is defined, e.g.
+// with `bazel test --config=lock_profiling`. Otherwise the mutex wrappers are
+// not instrumented at all, and the report is always empty.
+//
+// Each lock site, i.e. the source line that locks a mutex or waits on a
+// condition variable, accumulates how often it locked, how often it had to
+// wait for another thread, how long it waited and how long it held the lock.
+// Samples go to a buffer owned by the recording thread, and are only merged
+// when a report is asked for.
+class LockProfiler {
+ public:
+  struct SiteStats {
+    // "file:line" of the lock site.
+    std::string site;
+    std::int64_t acquisitions = 0;
+    // Acquisitions that found the lock held, or other threads waiting for it.
+    std::int64_t contentions = 0;
+    absl::Duration wait_time;
+    absl::Duration max_wait_time;
+    absl::Duration hold_time;
+    absl::Duration max_hold_time;
+    // Waits on a condition variable at this site, and the time spent in them.
+    // That time is not counted as hold time.
+    std::int64_t condition_waits = 0;
+    absl::Duration condition_wait_time;
+  };
+
+  static constexpr bool IsEnabled() {
+#if defined(NEARBY_LOCK_PROFILING)
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  // Returns the stats of every lock site seen since the last Reset(), hottest
+  // first: by wait time, then by contentions.
+  static std::vector<SiteStats> GetReport();
+
+  // Returns a table of the |max_sites| hottest lock sites.
+  static std::string FormatReport(std::size_t max_sites = 20);
+
+  // Forgets the stats recorded so far.
+  static void Reset();
+
+#if defined(NEARBY_LOCK_PROFILING)
+  // Where a lock is taken.
+  struct Site {
+    const char* file;
+    int line;
+  };
+
+  // Records a lock acquisition, which waited from |begin_nanos| until
+  // |end_nanos|.
+  static void RecordLock(Site site, bool contended, std::int64_t begin_nanos,
+                         std::int64_t end_nanos);
+  // Records a lock held from |begin_nanos| until |end_nanos|.
+  static void RecordHold(Site site, std::int64_t begin_nanos,
+                         std::int64_t end_nanos);
+  // Records a condition variable wait from |begin_nanos| until |end_nanos|.
+  static void RecordConditionWait(Site site, std::int64_t begin_nanos,
+                                  std::int64_t end_nanos);
+#endif
+};
+
+#if defined(NEARBY_LOCK_PROFILING)
+// Profiling state of a single mutex, updated around the platform lock calls.
+class MutexProfile final {
+ public:
+  struct LockAttempt {
+    // A nested lock of a recursive mutex, which is not profiled.
+    bool nested = false;
+    bool contended = false;
+    std::int64_t begin_nanos = 0;
+  };
+  struct ConditionWait {
+    LockProfiler::Site held_site;
+    std::int64_t begin_nanos = 0;
+  };
+
+  explicit MutexProfile(bool recursive = false) : recursive_(recursive) {}
+  // The state belongs to a locked mutex, so it is not moved; a moved mutex
+  // starts afresh.
+  MutexProfile(MutexProfile&& other) noexcept : recursive_(other.recursive_) {}
+  MutexProfile& operator=(MutexProfile&& other) noexcept {
+    recursive_ = other.recursive_;
+    return *this;
+  }
+
+  // Called before blocking on the platform mutex, and once it is locked.
+  LockAttempt BeginLock();
+  void EndLock(const LockAttempt& attempt, LockProfiler::Site site);
+  // Called before unlocking the platform mutex.
+  void Unlock();
+
+  // Called around a condition variable wait, which releases the mutex.
+  ConditionWait BeginConditionWait();
+  void EndConditionWait(const ConditionWait& wait, LockProfiler::Site site);
+
+ private:
+  bool recursive_;
+  // Threads that hold the mutex or are waiting for it.
+  std::atomic<int> lockers_ = 0;
+  // Owner of a recursive mutex.
+  std::atomic<std::thread::id> owner_;
+  // The rest is only used by the thread holding the mutex.
+  int depth_ = 0;
+  LockProfiler::Site site_ = {nullptr, 0};
+  std::int64_t hold_begin_nanos_ = 0;
+};
+
+// Default arguments that capture the lock site at the caller.
+#define NEARBY_LOCK_SITE_PARAMS \
+  const char *lock_file = __builtin_FILE(), int lock_line = __builtin_LINE()
+#endif
+
+}  // namespace nearby
+
+#endif  // PLATFORM_PUBLIC_LOCK_PROFILER_H_
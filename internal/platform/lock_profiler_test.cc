@@ -0,0 +1,178 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "internal/platform/lock_profiler.h"
+
+#include <string>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
+#include "absl/synchronization/notification.h"
+#include "absl/time/time.h"
+#include "internal/platform/condition_variable.h"
+#include "internal/platform/mutex.h"
+#include "internal/platform/mutex_lock.h"
+#include "internal/platform/single_thread_executor.h"
+#include "internal/platform/system_clock.h"
+
+namespace nearby {
+namespace {
+
+using ::testing::HasSubstr;
+
+constexpr absl::Duration kHoldTime = absl::Milliseconds(50);
+
+// Returns the stats of the lock site at |line| of this file.
+LockProfiler::SiteStats GetSiteStats(int line) {
+  std::string site = absl::StrCat("lock_profiler_test.cc:", line);
+  for (const LockProfiler::SiteStats& stats : LockProfiler::GetReport()) {
+    if (absl::EndsWith(stats.site, site)) return stats;
+  }
+  return {};
+}
+
+class LockProfilerTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    if (!LockProfiler::IsEnabled()) {
+      GTEST_SKIP() << "Needs a build with NEARBY_LOCK_PROFILING.";
+    }
+    LockProfiler::Reset();
+  }
+};
+
+TEST(LockProfilerDisabledTest, ReportIsEmpty) {
+  if (LockProfiler::IsEnabled()) GTEST_SKIP();
+  Mutex mutex;
+  { MutexLock lock(&mutex); }
+
+  EXPECT_TRUE(LockProfiler::GetReport().empty());
+  EXPECT_THAT(LockProfiler::FormatReport(), HasSubstr("disabled"));
+}
+
+TEST_F(LockProfilerTest, RecordsUncontendedLock) {
+  Mutex mutex;
+  const int lock_line = __LINE__ + 1;
+  { MutexLock lock(&mutex); }
+
+  LockProfiler::SiteStats stats = GetSiteStats(lock_line);
+  EXPECT_EQ(stats.acquisitions, 1);
+  EXPECT_EQ(stats.contentions, 0);
+  EXPECT_EQ(stats.wait_time, absl::ZeroDuration());
+}
+
+TEST_F(LockProfilerTest, RecordsContention) {
+  Mutex mutex;
+  absl::Notification locked;
+  const int hold_line = __LINE__ + 4;
+  {
+    SingleThreadExecutor executor;
+    executor.Execute([&mutex, &locked]() {
+      MutexLock lock(&mutex);
+      locked.Notify();
+      SystemClock::Sleep(kHoldTime);
+    });
+    locked.WaitForNotification();
+    const int wait_line = __LINE__ + 1;
+    { MutexLock lock(&mutex); }
+
+    LockProfiler::SiteStats stats = GetSiteStats(wait_line);
+    EXPECT_EQ(stats.acquisitions, 1);
+    EXPECT_EQ(stats.contentions, 1);
+    EXPECT_GT(stats.wait_time, absl::ZeroDuration());
+    EXPECT_EQ(stats.max_wait_time, stats.wait_time);
+  }
+
+  LockProfiler::SiteStats stats = GetSiteStats(hold_line);
+  EXPECT_EQ(stats.acquisitions, 1);
+  EXPECT_EQ(stats.contentions, 0);
+  EXPECT_GE(stats.hold_time, kHoldTime);
+}
+
+TEST_F(LockProfilerTest, RecordsExplicitLockAndUnlock) {
+  Mutex mutex;
+  const int lock_line = __LINE__ + 1;
+  mutex.Lock();
+  SystemClock::Sleep(kHoldTime);
+  mutex.Unlock();
+
+  LockProfiler::SiteStats stats = GetSiteStats(lock_line);
+  EXPECT_EQ(stats.acquisitions, 1);
+  EXPECT_GE(stats.hold_time, kHoldTime);
+}
+
+TEST_F(LockProfilerTest, ConditionWaitIsNotHoldTime) {
+  Mutex mutex;
+  ConditionVariable cond(&mutex);
+  const int lock_line = __LINE__ + 3;
+  const int wait_line = __LINE__ + 3;
+  {
+    MutexLock lock(&mutex);
+    cond.Wait(kHoldTime);
+  }
+
+  LockProfiler::SiteStats lock_stats = GetSiteStats(lock_line);
+  EXPECT_EQ(lock_stats.acquisitions, 1);
+  EXPECT_LT(lock_stats.hold_time, kHoldTime);
+  LockProfiler::SiteStats wait_stats = GetSiteStats(wait_line);
+  EXPECT_EQ(wait_stats.condition_waits, 1);
+  EXPECT_GE(wait_stats.condition_wait_time, kHoldTime);
+}
+
+TEST_F(LockProfilerTest, NestedRecursiveLockIsNotCounted) {
+  RecursiveMutex mutex;
+  const int outer_line = __LINE__ + 3;
+  const int inner_line = __LINE__ + 3;
+  {
+    MutexLock outer(&mutex);
+    MutexLock inner(&mutex);
+  }
+
+  EXPECT_EQ(GetSiteStats(outer_line).acquisitions, 1);
+  EXPECT_EQ(GetSiteStats(inner_line).acquisitions, 0);
+}
+
+TEST_F(LockProfilerTest, ReportsHottestSitesFirst) {
+  Mutex mutex;
+  absl::Notification locked;
+  {
+    SingleThreadExecutor executor;
+    executor.Execute([&mutex, &locked]() {
+      MutexLock lock(&mutex);
+      locked.Notify();
+      SystemClock::Sleep(kHoldTime);
+    });
+    locked.WaitForNotification();
+    { MutexLock lock(&mutex); }
+  }
+
+  std::string report = LockProfiler::FormatReport(/*max_sites=*/1);
+  EXPECT_THAT(report, HasSubstr("lock_profiler_test.cc"));
+  EXPECT_THAT(report, HasSubstr("more lock sites"));
+}
+
+TEST_F(LockProfilerTest, ResetForgetsStats) {
+  Mutex mutex;
+  const int lock_line = __LINE__ + 1;
+  { MutexLock lock(&mutex); }
+
+  LockProfiler::Reset();
+
+  EXPECT_EQ(GetSiteStats(lock_line).acquisitions, 0);
+}
+
+}  // namespace
+}  // namespace nearby
@@ -20,6 +20,7 @@
 #include "absl/base/thread_annotations.h"
 #include "internal/platform/implementation/mutex.h"
 #include "internal/platform/implementation/platform.h"
+#include "internal/platform/lock_profiler.h"
 
 namespace nearby {
 
@@ -39,13 +40,28 @@ class ABSL_LOCKABLE Mutex final {
   Mutex& operator=(Mutex&&) = default;
   ~Mutex() = default;
 
+#if defined(NEARBY_LOCK_PROFILING)
+  void Lock(NEARBY_LOCK_SITE_PARAMS) ABSL_EXCLUSIVE_LOCK_FUNCTION() {
+    MutexProfile::LockAttempt attempt = profile_.BeginLock();
+    impl_->Lock();
+    profile_.EndLock(attempt, {lock_file, lock_line});
+  }
+  void Unlock() ABSL_UNLOCK_FUNCTION() {
+    profile_.Unlock();
+    impl_->Unlock();
+  }
+#else
   void Lock() ABSL_EXCLUSIVE_LOCK_FUNCTION() { impl_->Lock(); }
   void Unlock() ABSL_UNLOCK_FUNCTION() { impl_->Unlock(); }
+#endif
 
  private:
   friend class ConditionVariable;
   friend class MutexLock;
   std::unique_ptr<api::Mutex> impl_;
+#if defined(NEARBY_LOCK_PROFILING)
+  MutexProfile profile_;
+#endif
 };
 
 // This mutex is compatible with Java definition:
@@ -63,12 +79,27 @@ class ABSL_LOCKABLE RecursiveMutex final {
   RecursiveMutex& operator=(RecursiveMutex&&) = default;
   ~RecursiveMutex() = default;
 
+#if defined(NEARBY_LOCK_PROFILING)
+  void Lock(NEARBY_LOCK_SITE_PARAMS) ABSL_EXCLUSIVE_LOCK_FUNCTION() {
+    MutexProfile::LockAttempt attempt = profile_.BeginLock();
+    impl_->Lock();
+    profile_.EndLock(attempt, {lock_file, lock_line});
+  }
+  void Unlock() ABSL_UNLOCK_FUNCTION() {
+    profile_.Unlock();
+    impl_->Unlock();
+  }
+#else
   void Lock() ABSL_EXCLUSIVE_LOCK_FUNCTION() { impl_->Lock(); }
   void Unlock() ABSL_UNLOCK_FUNCTION() { impl_->Unlock(); }
+#endif
 
  private:
   friend class MutexLock;
   std::unique_ptr<api::Mutex> impl_;
+#if defined(NEARBY_LOCK_PROFILING)
+  MutexProfile profile_{/*recursive=*/true};
+#endif
 };
 
 #pragma pop_macro("CreateMutex")
@@ -17,6 +17,7 @@
 
 #include "absl/base/thread_annotations.h"
 #include "internal/platform/implementation/mutex.h"
+#include "internal/platform/lock_profiler.h"
 #include "internal/platform/mutex.h"
 
 namespace nearby {
@@ -24,6 +25,31 @@ namespace nearby {
 // An RAII mechanism to acquire a Lock over a block of code.
 class ABSL_SCOPED_LOCKABLE MutexLock final {
  public:
+#if defined(NEARBY_LOCK_PROFILING)
+  // Profiled locks are taken through the mutex, which records the site of the
+  // MutexLock.
+  explicit MutexLock(Mutex* mutex, NEARBY_LOCK_SITE_PARAMS)
+      ABSL_EXCLUSIVE_LOCK_FUNCTION(mutex)
+      : mutex_(mutex) {
+    mutex->Lock(lock_file, lock_line);
+  }
+  explicit MutexLock(RecursiveMutex* mutex, NEARBY_LOCK_SITE_PARAMS)
+      ABSL_EXCLUSIVE_LOCK_FUNCTION(mutex)
+      : recursive_mutex_(mutex) {
+    mutex->Lock(lock_file, lock_line);
+  }
+  ~MutexLock() ABSL_UNLOCK_FUNCTION() {
+    if (mutex_ != nullptr) {
+      mutex_->Unlock();
+    } else {
+      recursive_mutex_->Unlock();
+    }
+  }
+
+ private:
+  Mutex* mutex_ = nullptr;
+  RecursiveMutex* recursive_mutex_ = nullptr;
+#else
   explicit MutexLock(Mutex* mutex) ABSL_EXCLUSIVE_LOCK_FUNCTION(mutex)
       : mutex_(mutex->impl_.get()) {
     mutex_->Lock();
@@ -36,6 +62,7 @@ class ABSL_SCOPED_LOCKABLE MutexLock final {
 
  private:
   api::Mutex* mutex_;
+#endif
 };
 
 }  // namespace nearby
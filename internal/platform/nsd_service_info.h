@@ -37,7 +37,7 @@ class NsdServiceInfo {
   ~NsdServiceInfo() = default;
 
   // Gets the service name.
-  std::string GetServiceName() const { return service_name_; }
+  const std::string& GetServiceName() const { return service_name_; }
 
   // Sets the service name.
   void SetServiceName(std::string service_name) {
@@ -59,7 +59,7 @@ class NsdServiceInfo {
   }
 
   // Gets all TXTRecord.
-  absl::flat_hash_map<std::string, std::string> GetTxtRecords() const {
+  const absl::flat_hash_map<std::string, std::string>& GetTxtRecords() const {
     return txt_records_;
   }
 
@@ -70,7 +70,7 @@ class NsdServiceInfo {
   }
 
   // Gets IP Address, which is in byte sequence, in network order.
-  std::string GetIPAddress() const { return ip_address_; }
+  const std::string& GetIPAddress() const { return ip_address_; }
 
   // Sets IP Address.
   void SetIPAddress(const std::string& ip_address) { ip_address_ = ip_address; }
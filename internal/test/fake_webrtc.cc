@@ -15,9 +15,54 @@
 #include "internal/test/fake_webrtc.h"
 
 #include <memory>
+#include <string>
+#include <utility>
+
+#include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "internal/platform/byte_array.h"
+#include "proto/mediums/web_rtc_signaling_frames.pb.h"
 
 namespace nearby {
 
+FakeWebRtcSignalingMessenger::FakeWebRtcSignalingMessenger(
+    std::unique_ptr<WebRtcSignalingMessenger> messenger,
+    absl::Duration latency, std::shared_ptr<Stats> stats)
+    : WebRtcSignalingMessenger(nullptr),
+      messenger_(std::move(messenger)),
+      latency_(latency),
+      stats_(std::move(stats)) {}
+
+bool FakeWebRtcSignalingMessenger::SendMessage(absl::string_view peer_id,
+                                               const ByteArray& message) {
+  absl::SleepFor(latency_);
+  stats_->sent_messages++;
+  location::nearby::mediums::WebRtcSignalingFrame frame;
+  if (frame.ParseFromString(std::string(message)) &&
+      frame.has_ice_candidates()) {
+    stats_->sent_ice_candidates_messages++;
+    stats_->sent_ice_candidates +=
+        frame.ice_candidates().ice_candidates_size();
+  }
+  return messenger_->SendMessage(peer_id, message);
+}
+
+bool FakeWebRtcSignalingMessenger::StartReceivingMessages(
+    OnSignalingMessageCallback on_message_callback,
+    OnSignalingCompleteCallback on_complete_callback) {
+  return messenger_->StartReceivingMessages(std::move(on_message_callback),
+                                            std::move(on_complete_callback));
+}
+
+void FakeWebRtcSignalingMessenger::StopReceivingMessages() {
+  messenger_->StopReceivingMessages();
+}
+
+bool FakeWebRtcSignalingMessenger::IsValid() const {
+  return messenger_->IsValid();
+}
+
 FakeWebRtcMedium::FakeWebRtcMedium(CancellationFlag* flag)
     : WebRtcMedium(), flag_(flag) {}
 
@@ -31,7 +76,9 @@ FakeWebRtcMedium::GetSignalingMessenger(
     flag_->Cancel();
   }
 
-  return WebRtcMedium::GetSignalingMessenger(self_id, location_hint);
+  return std::make_unique<FakeWebRtcSignalingMessenger>(
+      WebRtcMedium::GetSignalingMessenger(self_id, location_hint),
+      signaling_latency_, signaling_stats_);
 }
 
 }  // namespace nearby
@@ -15,12 +15,45 @@
 #ifndef THIRD_PARTY_NEARBY_INTERNAL_TEST_FAKE_WEBRTC_H_
 #define THIRD_PARTY_NEARBY_INTERNAL_TEST_FAKE_WEBRTC_H_
 
+#include <atomic>
 #include <memory>
 
+#include "absl/strings/string_view.h"
+#include "absl/time/time.h"
+#include "internal/platform/byte_array.h"
 #include "internal/platform/webrtc.h"
 
 namespace nearby {
 
+// Wraps a signaling messenger, delaying every sent message by a fixed latency
+// to simulate the round trip to the signaling server.
+class FakeWebRtcSignalingMessenger : public WebRtcSignalingMessenger {
+ public:
+  struct Stats {
+    std::atomic<int> sent_messages = 0;
+    std::atomic<int> sent_ice_candidates_messages = 0;
+    std::atomic<int> sent_ice_candidates = 0;
+  };
+
+  FakeWebRtcSignalingMessenger(
+      std::unique_ptr<WebRtcSignalingMessenger> messenger,
+      absl::Duration latency, std::shared_ptr<Stats> stats);
+
+  // WebRtcSignalingMessenger:
+  bool SendMessage(absl::string_view peer_id,
+                   const ByteArray& message) override;
+  bool StartReceivingMessages(
+      OnSignalingMessageCallback on_message_callback,
+      OnSignalingCompleteCallback on_complete_callback) override;
+  void StopReceivingMessages() override;
+  bool IsValid() const override;
+
+ private:
+  std::unique_ptr<WebRtcSignalingMessenger> messenger_;
+  absl::Duration latency_;
+  std::shared_ptr<Stats> stats_;
+};
+
 class FakeWebRtcMedium : public WebRtcMedium {
  public:
   explicit FakeWebRtcMedium(CancellationFlag* flag);
@@ -42,8 +75,22 @@ class FakeWebRtcMedium : public WebRtcMedium {
 
   void SetIsValid(bool is_valid) { is_valid_ = is_valid; }
 
+  // Delays every message sent by the signaling messengers created after this
+  // call by |latency|.
+  void SetSignalingLatency(absl::Duration latency) {
+    signaling_latency_ = latency;
+  }
+
+  // Returns what the signaling messengers of this medium have sent so far.
+  const FakeWebRtcSignalingMessenger::Stats& GetSignalingStats() const {
+    return *signaling_stats_;
+  }
+
  private:
   CancellationFlag* flag_ = nullptr;
+  absl::Duration signaling_latency_ = absl::ZeroDuration();
+  std::shared_ptr<FakeWebRtcSignalingMessenger::Stats> signaling_stats_ =
+      std::make_shared<FakeWebRtcSignalingMessenger::Stats>();
   bool is_valid_ = true;
   bool cancel_during_get_signaling_messenger_ = false;
 };
@@ -22,14 +22,17 @@
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_set.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/string_view.h"
+#include "absl/time/time.h"
 #include "absl/types/optional.h"
 #include "internal/platform/implementation/ble_v2.h"
 #include "internal/platform/implementation/credential_callbacks.h"
 #include "internal/platform/implementation/crypto.h"
 #include "internal/platform/logging.h"
+#include "internal/platform/timer_impl.h"
 #include "presence/broadcast_request.h"
 #include "presence/data_types.h"
 #include "presence/implementation/advertisement_factory.h"
@@ -80,8 +83,58 @@ std::string SelectSalt(LocalCredential& credential,
   return SaltFromInt(s);
 }
 
+bool IsValidAt(const LocalCredential& credential, absl::Time time) {
+  int64_t millis = absl::ToUnixMillis(time);
+  return credential.start_time_millis() <= millis &&
+         millis < credential.end_time_millis();
+}
+
+// Returns the index of the credential valid at `time`. Falls back to the
+// credential that starts first. Returns -1 if there are no credentials.
+int SelectCredential(const std::vector<LocalCredential>& credentials,
+                     absl::Time time) {
+  if (credentials.empty()) {
+    return -1;
+  }
+  auto credential = std::find_if(
+      credentials.begin(), credentials.end(),
+      [time](const LocalCredential& c) { return IsValidAt(c, time); });
+  if (credential == credentials.end()) {
+    NEARBY_LOGS(WARNING) << "No active credentials";
+    credential = std::min_element(
+        credentials.begin(), credentials.end(),
+        [](const LocalCredential& a, const LocalCredential& b) {
+          return a.start_time_millis() < b.start_time_millis();
+        });
+  }
+  return credential - credentials.begin();
+}
+
 }  // namespace
 
+BroadcastManager::BroadcastManager(Mediums& mediums,
+                                   CredentialManager& credential_manager,
+                                   SingleThreadExecutor& executor)
+    : BroadcastManager(mediums, credential_manager, executor,
+                       RotationOptions()) {}
+
+BroadcastManager::BroadcastManager(Mediums& mediums,
+                                   CredentialManager& credential_manager,
+                                   SingleThreadExecutor& executor,
+                                   RotationOptions rotation_options)
+    : mediums_(&mediums),
+      credential_manager_(&credential_manager),
+      executor_(&executor),
+      rotation_options_(std::move(rotation_options)),
+      clock_(rotation_options_.clock != nullptr ? rotation_options_.clock
+                                                : &system_clock_) {
+  if (!rotation_options_.timer_factory) {
+    rotation_options_.timer_factory = []() -> std::unique_ptr<Timer> {
+      return std::make_unique<TimerImpl>();
+    };
+  }
+}
+
 absl::StatusOr<BroadcastSessionId> BroadcastManager::StartBroadcast(
     BroadcastRequest broadcast_request, BroadcastCallback callback) {
   absl::StatusOr<BaseBroadcastRequest> request =
@@ -111,7 +164,8 @@ void BroadcastManager::FetchCredentials(
       AdvertisementFactory::GetCredentialSelector(broadcast_request);
   if (!credential_selector.ok()) {
     // Public advertisement, we don't need credential to advertise.
-    Advertise(id, broadcast_request, /*credentials=*/{});
+    Advertise(id, broadcast_request, /*selector=*/absl::nullopt,
+              /*credentials=*/{});
     return;
   }
   credential_manager_->GetLocalCredentials(
@@ -136,79 +190,288 @@ void BroadcastManager::FetchCredentials(
                      credentials = std::move(*credentials),
                      selector = std::move(selector)]()
                         ABSL_EXCLUSIVE_LOCKS_REQUIRED(executor_) mutable {
-                          absl::optional<LocalCredential> credential =
-                              Advertise(id, broadcast_request, credentials);
-                          if (credential) {
-                            credential_manager_->UpdateLocalCredential(
-                                selector, std::move(*credential),
-                                {[](absl::Status status) {
-                                  if (!status.ok()) {
-                                    NEARBY_LOGS(WARNING)
-                                        << "Failed to update private "
-                                           "credential, status: "
-                                        << status;
-                                  }
-                                }});
-                          }
+                          Advertise(id, std::move(broadcast_request),
+                                    std::move(selector),
+                                    std::move(credentials));
                         });
               }});
 }
 
-absl::optional<LocalCredential> BroadcastManager::SelectCredential(  // NOLINT
-    BaseBroadcastRequest& broadcast_request,
-    std::vector<LocalCredential> credentials) {
-  if (credentials.empty()) {
-    return absl::optional<LocalCredential>();  // NOLINT
-  }
-  auto credential =
-      std::min_element(credentials.begin(), credentials.end(),
-                       [](const LocalCredential& a, const LocalCredential& b) {
-                         return a.start_time_millis() < b.start_time_millis();
-                       });
-  if (credential == credentials.end()) {
-    NEARBY_LOGS(WARNING) << "No active credentials";
-    return absl::optional<LocalCredential>();  // NOLINT
+absl::StatusOr<BroadcastManager::PrecomputedAdvertisement>
+BroadcastManager::BuildAdvertisement(BaseBroadcastRequest broadcast_request,
+                                     std::vector<LocalCredential>& credentials,
+                                     absl::Time start_time,
+                                     absl::Duration rotation_interval) {
+  PrecomputedAdvertisement result{.end_time = start_time + rotation_interval};
+  absl::optional<LocalCredential> credential;  // NOLINT
+  int index = SelectCredential(credentials, start_time);
+  if (index >= 0) {
+    LocalCredential& selected = credentials[index];
+    std::string salt = SelectSalt(selected, broadcast_request.salt);
+    if (salt != broadcast_request.salt) {
+      NEARBY_VLOG(1) << "Changed salt";
+      broadcast_request.salt = salt;
+    }
+    if (IsValidAt(selected, start_time)) {
+      // Rotate when the credential expires, at the latest.
+      result.end_time =
+          std::min(result.end_time,
+                   absl::FromUnixMillis(selected.end_time_millis()));
+    }
+    result.credential_index = index;
+    credential = selected;
   }
-  std::string salt = SelectSalt(*credential, broadcast_request.salt);
-  if (salt != broadcast_request.salt) {
-    NEARBY_VLOG(1) << "Changed salt";
-    broadcast_request.salt = salt;
+  absl::StatusOr<AdvertisementData> advertisement =
+      AdvertisementFactory().CreateAdvertisement(broadcast_request, credential);
+  if (!advertisement.ok()) {
+    return advertisement.status();
   }
-  return *credential;
+  result.advertisement = *std::move(advertisement);
+  return result;
 }
 
-absl::optional<LocalCredential> BroadcastManager::Advertise(  // NOLINT
+void BroadcastManager::Advertise(
     BroadcastSessionId id, BaseBroadcastRequest broadcast_request,
+    absl::optional<CredentialSelector> selector,  // NOLINT
     std::vector<LocalCredential> credentials) {
   auto it = sessions_.find(id);
   if (it == sessions_.end()) {
     NEARBY_LOGS(INFO) << "Broadcast session terminated, id: " << id;
-    return absl::optional<LocalCredential>();  // NOLINT
+    return;
   }
-  absl::optional<LocalCredential> credential =  // NOLINT
-      SelectCredential(broadcast_request, std::move(credentials));
-  absl::StatusOr<AdvertisementData> advertisement =
-      AdvertisementFactory().CreateAdvertisement(broadcast_request, credential);
+  absl::StatusOr<PrecomputedAdvertisement> advertisement =
+      BuildAdvertisement(broadcast_request, credentials, clock_->Now(),
+                         rotation_options_.rotation_interval);
   if (!advertisement.ok()) {
     NEARBY_LOGS(WARNING) << "Can't create advertisement, reason: "
                          << advertisement.status();
     NotifyStartCallbackStatus(id, advertisement.status());
-    return absl::optional<LocalCredential>();  // NOLINT
+    return;
+  }
+  if (!StartAdvertising(id, it->second, advertisement->advertisement,
+                        /*is_rotation=*/false)) {
+    return;
+  }
+  if (!selector) {
+    // Public advertisements are not rotated.
+    return;
   }
-  std::unique_ptr<AdvertisingSession> session =
+  if (advertisement->credential_index >= 0) {
+    SaveCredential(*selector, credentials[advertisement->credential_index]);
+  }
+  if (!rotation_options_.enabled) {
+    return;
+  }
+  it->second.SetRotationState(
+      RotationState{.broadcast_request = std::move(broadcast_request),
+                    .selector = *std::move(selector),
+                    .credentials = std::move(credentials),
+                    .current_end_time = advertisement->end_time,
+                    .timer = rotation_options_.timer_factory()});
+  ScheduleRotation(id, *it->second.GetRotationState());
+  PrecomputeAdvertisements(id);
+}
+
+bool BroadcastManager::StartAdvertising(
+    BroadcastSessionId id, BroadcastSessionState& session,
+    const AdvertisementData& advertisement, bool is_rotation) {
+  std::unique_ptr<AdvertisingSession> advertising_session =
       mediums_->GetBle().StartAdvertising(
-          *advertisement, it->second.GetPowerMode(),
+          advertisement, session.GetPowerMode(),
           AdvertisingCallback{
-              .start_advertising_result = [this, id](absl::Status status) {
-                NotifyStartCallbackStatus(id, status);
-              }});
-  if (!session) {
-    NotifyStartCallbackStatus(id,
-                              absl::InternalError("Can't start advertising"));
-    return absl::optional<LocalCredential>();  // NOLINT
+              .start_advertising_result =
+                  [this, id, is_rotation](absl::Status status) {
+                    if (!is_rotation) {
+                      NotifyStartCallbackStatus(id, status);
+                      return;
+                    }
+                    if (status.ok()) return;
+                    RunOnServiceControllerThread(
+                        "retry-rotation",
+                        [this, id, status]()
+                            ABSL_EXCLUSIVE_LOCKS_REQUIRED(*executor_) {
+                              RetryRotation(id, status);
+                            });
+                  }});
+  if (!advertising_session) {
+    absl::Status status = absl::InternalError("Can't start advertising");
+    if (is_rotation) {
+      RetryRotation(id, status);
+    } else {
+      NotifyStartCallbackStatus(id, status);
+    }
+    return false;
   }
-  it->second.SetAdvertisingSession(std::move(session));
-  return credential;
+  session.SetAdvertisingSession(std::move(advertising_session));
+  return true;
+}
+
+void BroadcastManager::ScheduleRotation(BroadcastSessionId id,
+                                        RotationState& rotation_state) {
+  absl::Duration delay = std::max(
+      rotation_state.current_end_time - clock_->Now(), absl::ZeroDuration());
+  rotation_state.timer->Stop();
+  rotation_state.timer->Start(
+      static_cast<int>(absl::ToInt64Milliseconds(delay)), /*period=*/0,
+      [this, id]() {
+        RunOnServiceControllerThread(
+            "rotate-advertisement",
+            [this, id]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(*executor_) {
+              RotateAdvertisement(id);
+            });
+      });
+}
+
+void BroadcastManager::RotateAdvertisement(BroadcastSessionId id) {
+  auto it = sessions_.find(id);
+  if (it == sessions_.end() || it->second.GetRotationState() == nullptr) {
+    return;
+  }
+  RotationState& rotation_state = *it->second.GetRotationState();
+  absl::Time now = clock_->Now();
+  std::deque<PrecomputedAdvertisement>& advertisements =
+      rotation_state.advertisements;
+  while (!advertisements.empty() && advertisements.front().end_time <= now) {
+    advertisements.pop_front();
+  }
+  PrecomputedAdvertisement next;
+  if (!advertisements.empty()) {
+    next = std::move(advertisements.front());
+    advertisements.pop_front();
+  } else if (rotation_state.is_precomputing) {
+    // Rotate as soon as the next advertisement is built.
+    rotation_state.is_rotation_pending = true;
+    return;
+  } else {
+    absl::StatusOr<PrecomputedAdvertisement> advertisement =
+        BuildAdvertisement(rotation_state.broadcast_request,
+                           rotation_state.credentials, now,
+                           rotation_options_.rotation_interval);
+    if (!advertisement.ok()) {
+      RetryRotation(id, advertisement.status());
+      return;
+    }
+    if (advertisement->credential_index >= 0) {
+      SaveCredential(
+          rotation_state.selector,
+          rotation_state.credentials[advertisement->credential_index]);
+    }
+    next = *std::move(advertisement);
+  }
+  rotation_state.is_rotation_pending = false;
+  rotation_state.current_end_time = next.end_time;
+  it->second.StopAdvertising();
+  if (!StartAdvertising(id, it->second, next.advertisement,
+                        /*is_rotation=*/true)) {
+    // The retry broadcasts it, unless it has expired by then.
+    advertisements.push_front(std::move(next));
+    return;
+  }
+  ScheduleRotation(id, rotation_state);
+  PrecomputeAdvertisements(id);
+}
+
+void BroadcastManager::RetryRotation(BroadcastSessionId id,
+                                     absl::Status status) {
+  auto it = sessions_.find(id);
+  if (it == sessions_.end() || it->second.GetRotationState() == nullptr) {
+    return;
+  }
+  NEARBY_LOGS(WARNING) << "Can't rotate advertisement, retrying in "
+                       << rotation_options_.retry_interval
+                       << ", reason: " << status;
+  RotationState& rotation_state = *it->second.GetRotationState();
+  rotation_state.current_end_time =
+      clock_->Now() + rotation_options_.retry_interval;
+  ScheduleRotation(id, rotation_state);
+}
+
+void BroadcastManager::PrecomputeAdvertisements(BroadcastSessionId id) {
+  auto it = sessions_.find(id);
+  if (it == sessions_.end() || it->second.GetRotationState() == nullptr) {
+    return;
+  }
+  RotationState& rotation_state = *it->second.GetRotationState();
+  int missing = rotation_options_.precomputed_advertisements -
+                static_cast<int>(rotation_state.advertisements.size());
+  if (rotation_state.is_precomputing || missing <= 0) {
+    return;
+  }
+  rotation_state.is_precomputing = true;
+  absl::Time start_time = rotation_state.advertisements.empty()
+                              ? rotation_state.current_end_time
+                              : rotation_state.advertisements.back().end_time;
+  // The service controller thread doesn't touch the credentials until the
+  // copies, with the salts consumed here, come back.
+  precompute_executor_.Execute(
+      "precompute-advertisements",
+      [this, id, missing, start_time,
+       rotation_interval = rotation_options_.rotation_interval,
+       broadcast_request = rotation_state.broadcast_request,
+       credentials = rotation_state.credentials]() mutable {
+        std::vector<PrecomputedAdvertisement> advertisements;
+        for (int i = 0; i < missing; ++i) {
+          absl::StatusOr<PrecomputedAdvertisement> advertisement =
+              BuildAdvertisement(broadcast_request, credentials, start_time,
+                                 rotation_interval);
+          if (!advertisement.ok()) {
+            NEARBY_LOGS(WARNING) << "Can't precompute advertisement, reason: "
+                                 << advertisement.status();
+            break;
+          }
+          start_time = advertisement->end_time;
+          advertisements.push_back(*std::move(advertisement));
+        }
+        RunOnServiceControllerThread(
+            "precomputed-advertisements",
+            [this, id, advertisements = std::move(advertisements),
+             credentials = std::move(credentials)]()
+                ABSL_EXCLUSIVE_LOCKS_REQUIRED(*executor_) mutable {
+                  OnAdvertisementsPrecomputed(id, std::move(advertisements),
+                                              std::move(credentials));
+                });
+      });
+}
+
+void BroadcastManager::OnAdvertisementsPrecomputed(
+    BroadcastSessionId id,
+    std::vector<PrecomputedAdvertisement> advertisements,
+    std::vector<LocalCredential> credentials) {
+  auto it = sessions_.find(id);
+  if (it == sessions_.end() || it->second.GetRotationState() == nullptr) {
+    return;
+  }
+  RotationState& rotation_state = *it->second.GetRotationState();
+  rotation_state.is_precomputing = false;
+  rotation_state.credentials = std::move(credentials);
+  absl::flat_hash_set<int> used_credentials;
+  for (PrecomputedAdvertisement& advertisement : advertisements) {
+    if (advertisement.credential_index >= 0) {
+      used_credentials.insert(advertisement.credential_index);
+    }
+    rotation_state.advertisements.push_back(std::move(advertisement));
+  }
+  // Save the consumed salts before they are broadcast.
+  for (int index : used_credentials) {
+    SaveCredential(rotation_state.selector, rotation_state.credentials[index]);
+  }
+  if (rotation_state.is_rotation_pending) {
+    RotateAdvertisement(id);
+  } else if (!advertisements.empty()) {
+    // Top up what was used while these were being built.
+    PrecomputeAdvertisements(id);
+  }
+}
+
+void BroadcastManager::SaveCredential(const CredentialSelector& selector,
+                                      LocalCredential credential) {
+  credential_manager_->UpdateLocalCredential(
+      selector, std::move(credential), {[](absl::Status status) {
+        if (!status.ok()) {
+          NEARBY_LOGS(WARNING)
+              << "Failed to update private credential, status: " << status;
+        }
+      }});
 }
 
 void BroadcastManager::NotifyStartCallbackStatus(BroadcastSessionId id,
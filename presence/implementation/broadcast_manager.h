@@ -15,6 +15,7 @@
 #ifndef THIRD_PARTY_NEARBY_PRESENCE_IMPLEMENTATION_BROADCAST_MANAGER_H_
 #define THIRD_PARTY_NEARBY_PRESENCE_IMPLEMENTATION_BROADCAST_MANAGER_H_
 
+#include <deque>
 #include <memory>
 #include <string>
 #include <utility>
@@ -22,17 +23,24 @@
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_map.h"
+#include "absl/functional/any_invocable.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
+#include "absl/time/time.h"
 #include "absl/types/optional.h"
+#include "internal/platform/clock.h"
+#include "internal/platform/clock_impl.h"
 #include "internal/platform/implementation/ble_v2.h"
+#include "internal/platform/implementation/credential_callbacks.h"
 #include "internal/platform/runnable.h"
 #include "internal/platform/single_thread_executor.h"
+#include "internal/platform/timer.h"
 #include "presence/broadcast_request.h"
 #include "presence/data_types.h"
 #include "presence/implementation/base_broadcast_request.h"
 #include "presence/implementation/credential_manager.h"
+#include "presence/implementation/mediums/advertisement_data.h"
 #include "presence/implementation/mediums/mediums.h"
 #include "presence/power_mode.h"
 
@@ -49,20 +57,68 @@ class BroadcastManager {
       ::nearby::api::ble_v2::BleMedium::AdvertisingSession;
   using Runnable = ::nearby::Runnable;
   using LocalCredential = internal::LocalCredential;
+
+  // How the advertisements of non-public broadcasts are rotated.
+  struct RotationOptions {
+    // Whether advertisements are rotated at all. If not, the first
+    // advertisement is broadcast until the broadcast is stopped.
+    bool enabled = false;
+    // How long an advertisement is broadcast before it is replaced by one with
+    // a new salt. It is replaced earlier if its credential expires.
+    absl::Duration rotation_interval = absl::Minutes(15);
+    // How long to wait before retrying a rotation that failed.
+    absl::Duration retry_interval = absl::Minutes(1);
+    // How many upcoming advertisements of each broadcast are built ahead of
+    // time, off the service controller thread. With none, an advertisement
+    // is built on the service controller thread when it is needed.
+    int precomputed_advertisements = 3;
+    // Schedules the rotations. Defaults to the system clock and platform
+    // timers.
+    Clock* clock = nullptr;
+    absl::AnyInvocable<std::unique_ptr<Timer>()> timer_factory;
+  };
+
   BroadcastManager(Mediums& mediums, CredentialManager& credential_manager,
-                   SingleThreadExecutor& executor) {
-    mediums_ = &mediums, credential_manager_ = &credential_manager,
-    executor_ = &executor;
-  }
-  ~BroadcastManager() = default;
+                   SingleThreadExecutor& executor);
+  BroadcastManager(Mediums& mediums, CredentialManager& credential_manager,
+                   SingleThreadExecutor& executor,
+                   RotationOptions rotation_options);
+  ~BroadcastManager() { precompute_executor_.Shutdown(); }
   absl::StatusOr<BroadcastSessionId> StartBroadcast(
       BroadcastRequest broadcast_request, BroadcastCallback callback);
   void StopBroadcast(BroadcastSessionId);
 
  private:
+  // An advertisement to broadcast until `end_time`.
+  struct PrecomputedAdvertisement {
+    absl::Time end_time;
+    AdvertisementData advertisement;
+    // Index of the credential it was built with, or -1.
+    int credential_index = -1;
+  };
+  // What a non-public broadcast needs to build its next advertisements.
+  struct RotationState {
+    BaseBroadcastRequest broadcast_request;
+    CredentialSelector selector;
+    // Local copies, which keep track of the salts consumed so far.
+    std::vector<LocalCredential> credentials;
+    absl::Time current_end_time;
+    std::deque<PrecomputedAdvertisement> advertisements;
+    bool is_precomputing = false;
+    // The current advertisement expired while the next ones were being
+    // built.
+    bool is_rotation_pending = false;
+    std::unique_ptr<Timer> timer;
+  };
+
   Mediums* mediums_;
   CredentialManager* credential_manager_;
   SingleThreadExecutor* executor_;
+  RotationOptions rotation_options_;
+  ClockImpl system_clock_;
+  Clock* clock_;
+  // Builds advertisements ahead of time.
+  SingleThreadExecutor precompute_executor_;
   class BroadcastSessionState {
    public:
     explicit BroadcastSessionState(BroadcastCallback broadcast_callback,
@@ -76,10 +132,19 @@ class BroadcastManager {
 
     PowerMode GetPowerMode() { return power_mode_; }
 
+    void SetRotationState(RotationState rotation_state) {
+      rotation_state_ = std::move(rotation_state);
+    }
+    // Returns nullptr if the advertisement is not rotated.
+    RotationState* GetRotationState() {
+      return rotation_state_ ? &*rotation_state_ : nullptr;
+    }
+
    private:
     BroadcastCallback broadcast_callback_;
     PowerMode power_mode_;
     std::unique_ptr<AdvertisingSession> advertising_session_;
+    absl::optional<RotationState> rotation_state_;
   };
   BroadcastSessionId GenerateBroadcastSessionId();
   void NotifyStartCallbackStatus(BroadcastSessionId id, absl::Status status);
@@ -89,17 +154,54 @@ class BroadcastManager {
   void FetchCredentials(BroadcastSessionId id,
                         BaseBroadcastRequest broadcast_request)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(*executor_);
-  absl::optional<LocalCredential> SelectCredential( //NOLINT
-      BaseBroadcastRequest& broadcast_request,
-      std::vector<LocalCredential> credentials);
-
-  // Returns the private credential, if any, selected to generate the
-  // advertisement. A salt used in the advertisement is added to the returned
-  // private credential. The caller must save it in the storage.
-  absl::optional<LocalCredential> Advertise( //NOLINT
-      BroadcastSessionId id, BaseBroadcastRequest broadcast_request,
+
+  // Builds the advertisement to broadcast from `start_time`, with the
+  // credential valid at that time, if any. The salt it uses is marked as
+  // consumed in `credentials`.
+  static absl::StatusOr<PrecomputedAdvertisement> BuildAdvertisement(
+      BaseBroadcastRequest broadcast_request,
+      std::vector<LocalCredential>& credentials, absl::Time start_time,
+      absl::Duration rotation_interval);
+
+  // Starts broadcasting a public advertisement, or the first advertisement of
+  // a non-public broadcast, which is then rotated.
+  void Advertise(BroadcastSessionId id, BaseBroadcastRequest broadcast_request,
+                 absl::optional<CredentialSelector> selector,  // NOLINT
+                 std::vector<LocalCredential> credentials)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(*executor_);
+  // Replaces the advertising session of `session` with one broadcasting
+  // `advertisement`. Returns false on failure. A failure to start the
+  // broadcast is reported to the client, which ends the session. A failure
+  // to rotate is retried instead.
+  bool StartAdvertising(BroadcastSessionId id, BroadcastSessionState& session,
+                        const AdvertisementData& advertisement,
+                        bool is_rotation)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(*executor_);
+
+  // Arms the timer that rotates the advertisement when the current one ends.
+  void ScheduleRotation(BroadcastSessionId id, RotationState& rotation_state)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(*executor_);
+  // Swaps the next advertisement into the medium. It is built here only if
+  // none was built ahead of time.
+  void RotateAdvertisement(BroadcastSessionId id)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(*executor_);
+  // Schedules another rotation attempt after a failed one. The session is
+  // kept.
+  void RetryRotation(BroadcastSessionId id, absl::Status status)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(*executor_);
+  // Tops up the advertisements built ahead of time, on the precompute
+  // executor.
+  void PrecomputeAdvertisements(BroadcastSessionId id)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(*executor_);
+  void OnAdvertisementsPrecomputed(
+      BroadcastSessionId id,
+      std::vector<PrecomputedAdvertisement> advertisements,
       std::vector<LocalCredential> credentials)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(*executor_);
+  // Saves a credential with the salts it consumed.
+  void SaveCredential(const CredentialSelector& selector,
+                      LocalCredential credential);
+
   absl::flat_hash_map<BroadcastSessionId, BroadcastSessionState> sessions_
       ABSL_GUARDED_BY(*executor_);
 };
@@ -16,17 +16,28 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "gmock/gmock.h"
 #include "protobuf-matchers/protocol-buffer-matchers.h"
 #include "gtest/gtest.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/time.h"
+#include "internal/platform/bluetooth_adapter.h"
 #include "internal/platform/count_down_latch.h"
 #include "internal/platform/feature_flags.h"
 #include "internal/platform/future.h"
+#include "internal/platform/implementation/credential_callbacks.h"
 #include "internal/platform/medium_environment.h"
+#include "internal/platform/timer.h"
 #include "internal/proto/credential.pb.h"
+#include "internal/test/fake_clock.h"
+#include "internal/test/fake_timer.h"
 #include "presence/implementation/credential_manager_impl.h"
+#include "presence/implementation/mediums/ble.h"
 #include "presence/implementation/mediums/mediums.h"
+#include "presence/implementation/mock_credential_manager.h"
 
 namespace nearby {
 namespace presence {
@@ -36,7 +47,10 @@ using FeatureFlags = ::nearby::FeatureFlags::Flags;
 using internal::IdentityType;
 using ::nearby::CountDownLatch;
 using ::nearby::MediumEnvironment;
+using ::nearby::internal::LocalCredential;
 using ::testing::status::StatusIs;
+using BleAdvertisementData = ::nearby::api::ble_v2::BleAdvertisementData;
+using BlePeripheral = ::nearby::api::ble_v2::BlePeripheral;
 
 constexpr FeatureFlags kTestCases[] = {
     FeatureFlags{},
@@ -44,6 +58,8 @@ constexpr FeatureFlags kTestCases[] = {
 
 constexpr absl::string_view kAccountName = "Test account";
 constexpr int8_t kTxPower = 30;
+constexpr absl::Duration kRotationInterval = absl::Minutes(15);
+constexpr absl::Duration kWaitTimeout = absl::Seconds(1);
 
 BroadcastRequest CreateBroadcastRequest(IdentityType identity) {
   PresenceBroadcast::BroadcastSection section = {
@@ -57,6 +73,17 @@ BroadcastRequest CreateBroadcastRequest(IdentityType identity) {
   return request;
 }
 
+LocalCredential CreateLocalCredential(char key_seed, absl::Time start_time,
+                                      absl::Time end_time) {
+  LocalCredential credential;
+  credential.set_identity_type(internal::IDENTITY_TYPE_PRIVATE_GROUP);
+  credential.set_key_seed(std::string(32, key_seed));
+  credential.set_metadata_encryption_key_v0(std::string(14, 'm'));
+  credential.set_start_time_millis(absl::ToUnixMillis(start_time));
+  credential.set_end_time_millis(absl::ToUnixMillis(end_time));
+  return credential;
+}
+
 class MediumEnvironmentStarter {
  public:
   MediumEnvironmentStarter() { MediumEnvironment::Instance().Start(); }
@@ -172,6 +199,206 @@ TEST_P(BroadcastManagerTest, StartBroadcastPrivateIdentityFails) {
   EXPECT_FALSE(IsAdvertising());
 }
 
+class BroadcastManagerRotationTest : public BroadcastManagerTest {
+ protected:
+  void SetUp() override {
+    ON_CALL(mock_credential_manager_, GetLocalCredentials)
+        .WillByDefault([this](const CredentialSelector&,
+                              GetLocalCredentialsResultCallback callback) {
+          callback.credentials_fetched_cb(credentials_);
+        });
+    ON_CALL(mock_credential_manager_, UpdateLocalCredential)
+        .WillByDefault([this](const CredentialSelector&,
+                              LocalCredential credential,
+                              SaveCredentialsResultCallback callback) {
+          {
+            absl::MutexLock lock(&mutex_);
+            saved_credentials_.push_back(std::move(credential));
+          }
+          callback.credentials_saved_cb(absl::OkStatus());
+        });
+    scanning_session_ = scanner_.StartScanning(
+        ScanRequest{.power_mode = PowerMode::kBalanced},
+        Ble::ScanningCallback{
+            .advertisement_found_cb =
+                [this](BlePeripheral&, BleAdvertisementData data) {
+                  auto it = data.service_data.find(kPresenceServiceUuid);
+                  if (it == data.service_data.end()) return;
+                  absl::MutexLock lock(&mutex_);
+                  advertisements_.push_back(
+                      std::string(it->second.AsStringView()));
+                }});
+  }
+  void TearDown() override {
+    EXPECT_OK(scanning_session_->stop_scanning());
+    BroadcastManagerTest::TearDown();
+  }
+
+  std::unique_ptr<BroadcastManager> CreateBroadcastManager(
+      int precomputed_advertisements, bool enabled = true) {
+    return std::make_unique<BroadcastManager>(
+        mediums_, mock_credential_manager_, executor_,
+        BroadcastManager::RotationOptions{
+            .enabled = enabled,
+            .rotation_interval = kRotationInterval,
+            .precomputed_advertisements = precomputed_advertisements,
+            .clock = &clock_,
+            .timer_factory = [this]() -> std::unique_ptr<Timer> {
+              return std::make_unique<FakeTimer>(&clock_);
+            }});
+  }
+
+  // Waits until the scanner has seen `count` advertisements and returns them.
+  std::vector<std::string> WaitForAdvertisements(size_t count) {
+    absl::MutexLock lock(&mutex_);
+    auto seen = [this, count]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
+      return advertisements_.size() >= count;
+    };
+    mutex_.AwaitWithTimeout(absl::Condition(&seen), kWaitTimeout);
+    return advertisements_;
+  }
+
+  // Waits until `count` credentials were saved and returns them.
+  std::vector<LocalCredential> WaitForSavedCredentials(size_t count) {
+    absl::MutexLock lock(&mutex_);
+    auto saved = [this, count]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
+      return saved_credentials_.size() >= count;
+    };
+    mutex_.AwaitWithTimeout(absl::Condition(&saved), kWaitTimeout);
+    return saved_credentials_;
+  }
+
+  FakeClock clock_;
+  std::vector<LocalCredential> credentials_ = {
+      CreateLocalCredential('a', clock_.Now() - absl::Hours(1),
+                            clock_.Now() + absl::Hours(24))};
+  testing::NiceMock<MockCredentialManager> mock_credential_manager_;
+  BluetoothAdapter scanner_adapter_;
+  Ble scanner_{scanner_adapter_};
+  std::unique_ptr<Ble::ScanningSession> scanning_session_;
+  absl::Mutex mutex_;
+  std::vector<std::string> advertisements_ ABSL_GUARDED_BY(mutex_);
+  std::vector<LocalCredential> saved_credentials_ ABSL_GUARDED_BY(mutex_);
+};
+
+INSTANTIATE_TEST_SUITE_P(ParametrisedBroadcastManagerRotationTest,
+                         BroadcastManagerRotationTest,
+                         testing::ValuesIn(kTestCases));
+
+TEST_P(BroadcastManagerRotationTest, RotatesPrecomputedAdvertisements) {
+  std::unique_ptr<BroadcastManager> broadcast_manager =
+      CreateBroadcastManager(/*precomputed_advertisements=*/2);
+  ASSERT_OK(broadcast_manager->StartBroadcast(
+      CreateBroadcastRequest(internal::IDENTITY_TYPE_PRIVATE_GROUP),
+      CreateBroadcastCallback()));
+  ASSERT_EQ(WaitForAdvertisements(1).size(), 1);
+  // The initial advertisement and the two precomputed ones consumed a salt
+  // each before the first rotation.
+  std::vector<LocalCredential> saved = WaitForSavedCredentials(2);
+  ASSERT_EQ(saved.size(), 2);
+  EXPECT_EQ(saved.back().consumed_salts_size(), 3);
+
+  clock_.FastForward(kRotationInterval);
+  WaitForServiceControllerTasks();
+  std::vector<std::string> advertisements = WaitForAdvertisements(2);
+
+  ASSERT_EQ(advertisements.size(), 2);
+  EXPECT_NE(advertisements[0], advertisements[1]);
+  EXPECT_TRUE(IsAdvertising());
+}
+
+TEST_P(BroadcastManagerRotationTest, RotatesWhenCredentialExpires) {
+  absl::Time now = clock_.Now();
+  credentials_ = {
+      CreateLocalCredential('a', now - absl::Hours(1), now + absl::Minutes(5)),
+      CreateLocalCredential('b', now + absl::Minutes(5), now + absl::Hours(1))};
+  std::unique_ptr<BroadcastManager> broadcast_manager =
+      CreateBroadcastManager(/*precomputed_advertisements=*/2);
+  ASSERT_OK(broadcast_manager->StartBroadcast(
+      CreateBroadcastRequest(internal::IDENTITY_TYPE_PRIVATE_GROUP),
+      CreateBroadcastCallback()));
+  ASSERT_EQ(WaitForAdvertisements(1).size(), 1);
+  std::vector<LocalCredential> saved = WaitForSavedCredentials(2);
+  ASSERT_EQ(saved.size(), 2);
+  // The first advertisement uses 'a', which is valid now.
+  EXPECT_EQ(saved.front().key_seed(), std::string(32, 'a'));
+  EXPECT_EQ(saved.front().consumed_salts_size(), 1);
+
+  clock_.FastForward(absl::Minutes(5));
+  WaitForServiceControllerTasks();
+
+  std::vector<std::string> advertisements = WaitForAdvertisements(2);
+  ASSERT_EQ(advertisements.size(), 2);
+  EXPECT_NE(advertisements[0], advertisements[1]);
+  // From the expiry of 'a' on, the advertisements use 'b'.
+  saved = WaitForSavedCredentials(2);
+  EXPECT_EQ(saved.back().key_seed(), std::string(32, 'b'));
+  EXPECT_GE(saved.back().consumed_salts_size(), 1);
+}
+
+TEST_P(BroadcastManagerRotationTest, RotatesWithoutPrecomputation) {
+  std::unique_ptr<BroadcastManager> broadcast_manager =
+      CreateBroadcastManager(/*precomputed_advertisements=*/0);
+  ASSERT_OK(broadcast_manager->StartBroadcast(
+      CreateBroadcastRequest(internal::IDENTITY_TYPE_PRIVATE_GROUP),
+      CreateBroadcastCallback()));
+  ASSERT_EQ(WaitForAdvertisements(1).size(), 1);
+  // The rotation is scheduled.
+  WaitForServiceControllerTasks();
+
+  clock_.FastForward(kRotationInterval);
+  WaitForServiceControllerTasks();
+
+  // The advertisement was built when it was needed.
+  std::vector<LocalCredential> saved = WaitForSavedCredentials(2);
+  ASSERT_EQ(saved.size(), 2);
+  EXPECT_EQ(saved.back().consumed_salts_size(), 2);
+  std::vector<std::string> advertisements = WaitForAdvertisements(2);
+  ASSERT_EQ(advertisements.size(), 2);
+  EXPECT_NE(advertisements[0], advertisements[1]);
+}
+
+TEST_P(BroadcastManagerRotationTest, DoesNotRotateUnlessEnabled) {
+  std::unique_ptr<BroadcastManager> broadcast_manager =
+      CreateBroadcastManager(/*precomputed_advertisements=*/2,
+                             /*enabled=*/false);
+  ASSERT_OK(broadcast_manager->StartBroadcast(
+      CreateBroadcastRequest(internal::IDENTITY_TYPE_PRIVATE_GROUP),
+      CreateBroadcastCallback()));
+  ASSERT_EQ(WaitForAdvertisements(1).size(), 1);
+  WaitForServiceControllerTasks();
+
+  clock_.FastForward(kRotationInterval);
+  WaitForServiceControllerTasks();
+
+  EXPECT_TRUE(IsAdvertising());
+  absl::MutexLock lock(&mutex_);
+  EXPECT_EQ(advertisements_.size(), 1);
+  // Only the salt of the first advertisement was consumed.
+  ASSERT_EQ(saved_credentials_.size(), 1);
+  EXPECT_EQ(saved_credentials_.back().consumed_salts_size(), 1);
+}
+
+TEST_P(BroadcastManagerRotationTest, StopBroadcastStopsRotation) {
+  std::unique_ptr<BroadcastManager> broadcast_manager =
+      CreateBroadcastManager(/*precomputed_advertisements=*/2);
+  absl::StatusOr<BroadcastSessionId> session =
+      broadcast_manager->StartBroadcast(
+          CreateBroadcastRequest(internal::IDENTITY_TYPE_PRIVATE_GROUP),
+          CreateBroadcastCallback());
+  ASSERT_OK(session);
+  ASSERT_EQ(WaitForAdvertisements(1).size(), 1);
+
+  broadcast_manager->StopBroadcast(*session);
+  WaitForServiceControllerTasks();
+  clock_.FastForward(kRotationInterval);
+  WaitForServiceControllerTasks();
+
+  EXPECT_FALSE(IsAdvertising());
+  absl::MutexLock lock(&mutex_);
+  EXPECT_EQ(advertisements_.size(), 1);
+}
+
 }  // namespace
 }  // namespace presence
 }  // namespace nearby
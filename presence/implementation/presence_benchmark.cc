@@ -0,0 +1,475 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Cost of the Presence advertisement and credential hot paths: building,
+// rotating and decoding advertisements, scan filter matching, connection
+// authentication and credential generation. Decoding is measured against a
+// growing number of credentials with the matching one last, which is the
+// worst case for trial decryption.
+//
+// Run with --benchmark_format=json to get machine-readable results.
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/escaping.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "internal/crypto/ed25519.h"
+#include "internal/platform/count_down_latch.h"
+#include "internal/platform/implementation/credential_callbacks.h"
+#include "internal/platform/medium_environment.h"
+#include "internal/platform/single_thread_executor.h"
+#include "internal/platform/timer.h"
+#include "internal/proto/credential.pb.h"
+#include "internal/proto/local_credential.pb.h"
+#include "internal/test/fake_clock.h"
+#include "internal/test/fake_timer.h"
+#include "presence/broadcast_request.h"
+#include "presence/data_element.h"
+#include "presence/implementation/action_factory.h"
+#include "presence/implementation/advertisement_decoder.h"
+#include "presence/implementation/advertisement_decoder_impl.h"
+#include "presence/implementation/advertisement_factory.h"
+#include "presence/implementation/advertisement_filter.h"
+#include "presence/implementation/base_broadcast_request.h"
+#include "presence/implementation/broadcast_manager.h"
+#include "presence/implementation/connection_authenticator.h"
+#include "presence/implementation/connection_authenticator_impl.h"
+#include "presence/implementation/credential_manager_impl.h"
+#include "presence/implementation/mediums/advertisement_data.h"
+#include "presence/implementation/mediums/mediums.h"
+#include "presence/scan_request.h"
+#include "presence/scan_request_builder.h"
+
+namespace nearby {
+namespace presence {
+namespace {
+
+using ::nearby::internal::DeviceIdentityMetaData;
+using ::nearby::internal::IdentityType;
+using ::nearby::internal::LocalCredential;
+using ::nearby::internal::SharedCredential;
+
+// Values copied from the LDT tests, shared with the factory and decoder tests.
+constexpr absl::string_view kKeySeedHex =
+    "ccdb2489e9fcac42b39348b8941ed19a1d360e75e098c8c15e6b1cc2b620cd39";
+constexpr absl::string_view kKnownMacHex =
+    "b4c59fa599241b81758d976b5a621c05232fe1bf89ae5987ca254c3554dce50e";
+constexpr absl::string_view kMetadataKeyHex = "cd683fe1a1d1f846543d0a13d4ae";
+constexpr absl::string_view kSalt = "AB";
+constexpr absl::string_view kAccountName = "Test account";
+constexpr absl::string_view kManagerAppId = "TEST_MANAGER_APP";
+constexpr absl::string_view kUkey2Secret = "\x34\x56\x78\x90";
+constexpr IdentityType kIdentity = IdentityType::IDENTITY_TYPE_PRIVATE_GROUP;
+constexpr absl::Duration kRotationInterval = absl::Minutes(15);
+
+// Returns a key seed that differs from the fixture seed for every `index`
+// greater than zero.
+std::string KeySeed(int index) {
+  std::string seed = absl::HexStringToBytes(kKeySeedHex);
+  seed[0] ^= static_cast<char>(index & 0xFF);
+  seed[1] ^= static_cast<char>((index >> 8) & 0xFF);
+  return seed;
+}
+
+LocalCredential CreateLocalCredential() {
+  LocalCredential local_credential;
+  local_credential.set_identity_type(kIdentity);
+  local_credential.set_key_seed(KeySeed(0));
+  local_credential.set_metadata_encryption_key_v0(
+      absl::HexStringToBytes(kMetadataKeyHex));
+  return local_credential;
+}
+
+// Returns `count` shared credentials where only the last one decrypts
+// advertisements built from `CreateLocalCredential()`.
+std::vector<SharedCredential> CreateSharedCredentials(int count) {
+  std::vector<SharedCredential> credentials;
+  credentials.reserve(count);
+  for (int i = count - 1; i >= 0; --i) {
+    SharedCredential shared_credential;
+    shared_credential.set_identity_type(kIdentity);
+    shared_credential.set_key_seed(KeySeed(i));
+    shared_credential.set_metadata_encryption_key_tag_v0(
+        absl::HexStringToBytes(kKnownMacHex));
+    credentials.push_back(std::move(shared_credential));
+  }
+  return credentials;
+}
+
+// Returns a broadcast request carrying `action_count` action bits, which
+// decode into as many data elements.
+BaseBroadcastRequest CreateBroadcastRequest(int action_count) {
+  std::vector<DataElement> data_elements;
+  for (ActionBit action : kAllActionBits) {
+    if (data_elements.size() == static_cast<size_t>(action_count)) {
+      break;
+    }
+    data_elements.emplace_back(action);
+  }
+  return BaseBroadcastRequest(
+      BasePresenceRequestBuilder(kIdentity)
+          .SetAccountName(kAccountName)
+          .SetSalt(kSalt)
+          .SetTxPower(5)
+          .SetAction(ActionFactory::CreateAction(data_elements)));
+}
+
+std::string CreateAdvertisement(int action_count) {
+  absl::StatusOr<AdvertisementData> advertisement =
+      AdvertisementFactory().CreateAdvertisement(
+          CreateBroadcastRequest(action_count), CreateLocalCredential());
+  return advertisement.ok() ? advertisement->content : std::string();
+}
+
+// Hands out day-long credentials from `start_time` on, and counts the
+// credentials saved by the broadcast manager: one for every advertisement it
+// builds.
+class BroadcastCredentialManager : public CredentialManagerImpl {
+ public:
+  BroadcastCredentialManager(SingleThreadExecutor* executor,
+                             absl::Time start_time)
+      : CredentialManagerImpl(executor), start_time_(start_time) {}
+
+  void GetLocalCredentials(
+      const CredentialSelector& credential_selector,
+      GetLocalCredentialsResultCallback callback) override {
+    std::vector<LocalCredential> credentials;
+    for (int day = 0; day < 3; ++day) {
+      LocalCredential credential = presence::CreateLocalCredential();
+      credential.set_key_seed(KeySeed(day));
+      credential.set_start_time_millis(
+          absl::ToUnixMillis(start_time_ + day * absl::Hours(24)));
+      credential.set_end_time_millis(
+          absl::ToUnixMillis(start_time_ + (day + 1) * absl::Hours(24)));
+      credentials.push_back(std::move(credential));
+    }
+    callback.credentials_fetched_cb(std::move(credentials));
+  }
+
+  void UpdateLocalCredential(const CredentialSelector& credential_selector,
+                             LocalCredential credential,
+                             SaveCredentialsResultCallback callback) override {
+    {
+      absl::MutexLock lock(&mutex_);
+      ++saved_credentials_;
+    }
+    callback.credentials_saved_cb(absl::OkStatus());
+  }
+
+  // Waits until `count` credentials were saved, and returns how many were.
+  int WaitForSavedCredentials(int count) {
+    absl::MutexLock lock(&mutex_);
+    auto saved = [this, count]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_) {
+      return saved_credentials_ >= count;
+    };
+    mutex_.Await(absl::Condition(&saved));
+    return saved_credentials_;
+  }
+
+ private:
+  absl::Time start_time_;
+  absl::Mutex mutex_;
+  int saved_credentials_ ABSL_GUARDED_BY(mutex_) = 0;
+};
+
+BroadcastRequest CreatePresenceBroadcastRequest() {
+  PresenceBroadcast::BroadcastSection section = {
+      .identity = kIdentity,
+      .extended_properties = {DataElement(ActionBit::kActiveUnlockAction)},
+      .account_name = std::string(kAccountName),
+      .manager_app_id = std::string(kManagerAppId)};
+  return BroadcastRequest{.tx_power = 5,
+                          .power_mode = PowerMode::kBalanced,
+                          .variant = PresenceBroadcast{.sections = {section}}};
+}
+
+DeviceIdentityMetaData CreateDeviceIdentityMetaData() {
+  DeviceIdentityMetaData device_identity_metadata;
+  device_identity_metadata.set_device_type(
+      internal::DeviceType::DEVICE_TYPE_PHONE);
+  device_identity_metadata.set_device_name("NP test device");
+  device_identity_metadata.set_bluetooth_mac_address("FF:FF:FF:FF:FF:FF");
+  device_identity_metadata.set_device_id("\x12\xab\xcd");
+  return device_identity_metadata;
+}
+
+// Arguments: action count.
+void BM_CreateAdvertisement(benchmark::State& state) {
+  BaseBroadcastRequest request = CreateBroadcastRequest(state.range(0));
+  LocalCredential credential = CreateLocalCredential();
+  AdvertisementFactory factory;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(factory.CreateAdvertisement(request, credential));
+  }
+}
+BENCHMARK(BM_CreateAdvertisement)->ArgName("actions")->DenseRange(1, 9, 4);
+
+// Arguments: precomputed advertisement count. Every iteration rotates the
+// advertisement of a private broadcast twice, driven by a fake clock. The
+// first rotation is timed from the clock reaching the end of the current
+// advertisement until the service controller thread is done with it. The
+// second one is queued behind a blocked task, so that "service_thread_us"
+// only counts the time the rotation itself keeps that thread busy. The next
+// advertisements are built before the following rotation is due, as they
+// would be 15 minutes apart.
+void BM_RotateAdvertisement(benchmark::State& state) {
+  MediumEnvironment::Instance().Start();
+  {
+    FakeClock clock;
+    SingleThreadExecutor executor;
+    BroadcastCredentialManager credential_manager(&executor, clock.Now());
+    Mediums mediums;
+    BroadcastManager broadcast_manager(
+        mediums, credential_manager, executor,
+        BroadcastManager::RotationOptions{
+            .enabled = true,
+            .rotation_interval = kRotationInterval,
+            .precomputed_advertisements = static_cast<int>(state.range(0)),
+            .clock = &clock,
+            .timer_factory = [&clock]() -> std::unique_ptr<Timer> {
+              return std::make_unique<FakeTimer>(&clock);
+            }});
+    if (!broadcast_manager
+             .StartBroadcast(CreatePresenceBroadcastRequest(),
+                             BroadcastCallback{})
+             .ok()) {
+      state.SkipWithError("Broadcast does not start");
+      executor.Shutdown();
+      MediumEnvironment::Instance().Stop();
+      return;
+    }
+    // The first advertisement, and the precomputed ones if any.
+    int saved_credentials = credential_manager.WaitForSavedCredentials(
+        state.range(0) > 0 ? 2 : 1);
+    absl::Duration service_thread_time;
+    for (auto _ : state) {
+      absl::Time start_time = absl::Now();
+      clock.FastForward(kRotationInterval);
+      CountDownLatch rotated(1);
+      executor.Execute([&rotated]() { rotated.CountDown(); });
+      rotated.Await();
+      state.SetIterationTime(absl::ToDoubleSeconds(absl::Now() - start_time));
+      saved_credentials =
+          credential_manager.WaitForSavedCredentials(saved_credentials + 1);
+
+      CountDownLatch release(1);
+      executor.Execute([&release]() { release.Await(); });
+      clock.FastForward(kRotationInterval);
+      CountDownLatch done(1);
+      absl::Time done_time;
+      executor.Execute([&done, &done_time]() {
+        done_time = absl::Now();
+        done.CountDown();
+      });
+      absl::Time release_time = absl::Now();
+      release.CountDown();
+      done.Await();
+      service_thread_time += done_time - release_time;
+      saved_credentials =
+          credential_manager.WaitForSavedCredentials(saved_credentials + 1);
+    }
+    state.counters["service_thread_us"] = benchmark::Counter(
+        absl::ToDoubleMicroseconds(service_thread_time),
+        benchmark::Counter::kAvgIterations);
+    executor.Shutdown();
+  }
+  MediumEnvironment::Instance().Stop();
+}
+// A day of rotations, which stays within the credentials.
+BENCHMARK(BM_RotateAdvertisement)
+    ->ArgName("precomputed")
+    ->Arg(0)
+    ->Arg(3)
+    ->Iterations(48)
+    ->UseManualTime();
+
+// Arguments: credential count, action count.
+void BM_DecodeAdvertisement(benchmark::State& state) {
+  std::string advertisement = CreateAdvertisement(state.range(1));
+  absl::flat_hash_map<IdentityType, std::vector<SharedCredential>> credentials;
+  credentials[kIdentity] = CreateSharedCredentials(state.range(0));
+  AdvertisementDecoderImpl decoder(&credentials);
+  if (!decoder.DecodeAdvertisement(advertisement).ok()) {
+    state.SkipWithError("Advertisement does not decode");
+    return;
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(decoder.DecodeAdvertisement(advertisement));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DecodeAdvertisement)
+    ->ArgNames({"credentials", "actions"})
+    ->ArgsProduct({benchmark::CreateRange(1, 256, 4), {1, 9}});
+
+// Arguments: filter count, action count. Only the last filter matches.
+void BM_MatchesScanFilter(benchmark::State& state) {
+  absl::flat_hash_map<IdentityType, std::vector<SharedCredential>> credentials;
+  credentials[kIdentity] = CreateSharedCredentials(1);
+  absl::StatusOr<Advertisement> advertisement =
+      AdvertisementDecoderImpl(&credentials)
+          .DecodeAdvertisement(CreateAdvertisement(state.range(1)));
+  if (!advertisement.ok()) {
+    state.SkipWithError("Advertisement does not decode");
+    return;
+  }
+  ScanRequestBuilder builder;
+  builder.AddIdentityType(kIdentity);
+  for (int i = 1; i < state.range(0); ++i) {
+    builder.AddScanFilter(PresenceScanFilter{
+        .extended_properties = {DataElement(DataElement::kModelIdFieldType,
+                                            absl::StrCat("model ", i))}});
+  }
+  builder.AddScanFilter(
+      PresenceScanFilter{.extended_properties = advertisement->data_elements});
+  AdvertisementFilter filter(builder.Build());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(filter.MatchesScanFilter(*advertisement));
+  }
+}
+BENCHMARK(BM_MatchesScanFilter)
+    ->ArgNames({"filters", "actions"})
+    ->ArgsProduct({benchmark::CreateRange(1, 64, 4), {1, 9}});
+
+// Arguments: credential count on each side. Only the last credentials match.
+void BM_VerifyMessageAsResponder(benchmark::State& state) {
+  std::vector<LocalCredential> local_credentials;
+  std::vector<SharedCredential> shared_credentials;
+  LocalCredential initiator_credential;
+  SharedCredential responder_shared_credential;
+  for (int i = state.range(0) - 1; i >= 0; --i) {
+    absl::StatusOr<crypto::Ed25519KeyPair> responder_keys =
+        crypto::Ed25519Signer::CreateNewKeyPair();
+    absl::StatusOr<crypto::Ed25519KeyPair> initiator_keys =
+        crypto::Ed25519Signer::CreateNewKeyPair();
+    if (!responder_keys.ok() || !initiator_keys.ok()) {
+      state.SkipWithError("Key pair generation failed");
+      return;
+    }
+    LocalCredential local_credential;
+    local_credential.mutable_connection_signing_key()->set_key(
+        absl::StrCat(responder_keys->private_key, responder_keys->public_key));
+    local_credential.set_key_seed(KeySeed(2 * i + 1));
+    SharedCredential shared_credential;
+    shared_credential.set_connection_signature_verification_key(
+        initiator_keys->public_key);
+    shared_credential.set_key_seed(KeySeed(2 * i + 2));
+    if (i == 0) {
+      initiator_credential.mutable_connection_signing_key()->set_key(
+          absl::StrCat(initiator_keys->private_key,
+                       initiator_keys->public_key));
+      initiator_credential.set_key_seed(shared_credential.key_seed());
+      responder_shared_credential.set_key_seed(local_credential.key_seed());
+    }
+    local_credentials.push_back(std::move(local_credential));
+    shared_credentials.push_back(std::move(shared_credential));
+  }
+  ConnectionAuthenticatorImpl authenticator;
+  absl::StatusOr<ConnectionAuthenticator::InitiatorData> initiator_data =
+      authenticator.BuildSignedMessageAsInitiator(
+          kUkey2Secret, initiator_credential, responder_shared_credential);
+  if (!initiator_data.ok()) {
+    state.SkipWithError("Signing failed");
+    return;
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(authenticator.VerifyMessageAsResponder(
+        kUkey2Secret, *initiator_data, local_credentials,
+        shared_credentials));
+  }
+}
+BENCHMARK(BM_VerifyMessageAsResponder)
+    ->ArgName("credentials")
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
+
+void BM_BuildSignedMessageAsInitiator(benchmark::State& state) {
+  absl::StatusOr<crypto::Ed25519KeyPair> keys =
+      crypto::Ed25519Signer::CreateNewKeyPair();
+  if (!keys.ok()) {
+    state.SkipWithError("Key pair generation failed");
+    return;
+  }
+  LocalCredential local_credential;
+  local_credential.mutable_connection_signing_key()->set_key(
+      absl::StrCat(keys->private_key, keys->public_key));
+  SharedCredential shared_credential;
+  shared_credential.set_key_seed(KeySeed(1));
+  ConnectionAuthenticatorImpl authenticator;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(authenticator.BuildSignedMessageAsInitiator(
+        kUkey2Secret, local_credential, shared_credential));
+  }
+}
+BENCHMARK(BM_BuildSignedMessageAsInitiator);
+
+void BM_CreateLocalCredential(benchmark::State& state) {
+  SingleThreadExecutor executor;
+  CredentialManagerImpl credential_manager(&executor);
+  DeviceIdentityMetaData device_identity_metadata =
+      CreateDeviceIdentityMetaData();
+  absl::Time start_time = absl::FromUnixSeconds(100000);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(credential_manager.CreateLocalCredential(
+        device_identity_metadata, kIdentity, start_time,
+        start_time + absl::Hours(24)));
+  }
+  executor.Shutdown();
+}
+BENCHMARK(BM_CreateLocalCredential);
+
+// Arguments: credential count. Includes saving the credentials to storage.
+void BM_GenerateCredentials(benchmark::State& state) {
+  SingleThreadExecutor executor;
+  CredentialManagerImpl credential_manager(&executor);
+  DeviceIdentityMetaData device_identity_metadata =
+      CreateDeviceIdentityMetaData();
+  for (auto _ : state) {
+    CountDownLatch latch(1);
+    credential_manager.GenerateCredentials(
+        device_identity_metadata, kManagerAppId, {kIdentity},
+        /*credential_life_cycle_days=*/5,
+        /*contiguous_copy_of_credentials=*/state.range(0),
+        {.credentials_generated_cb =
+             [&latch](absl::StatusOr<std::vector<SharedCredential>>) {
+               latch.CountDown();
+             }});
+    latch.Await();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  executor.Shutdown();
+}
+BENCHMARK(BM_GenerateCredentials)
+    ->ArgName("credentials")
+    ->RangeMultiplier(4)
+    ->Range(1, 64)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace presence
+}  // namespace nearby
@@ -140,29 +140,26 @@ std::optional<EncryptedMetadata> BuildMetadata(
   return metadata;
 }
 
-void TryDecryptPublicCertificates(
+std::optional<NearbyShareDecryptedPublicCertificate>
+TryDecryptPublicCertificates(
     const NearbyShareEncryptedMetadataKey& encrypted_metadata_key,
-    NearbyShareCertificateManager::CertDecryptedCallback callback, bool success,
-    std::unique_ptr<std::vector<PublicCertificate>> public_certificates) {
+    NearbySharePublicCertificateDecryptor& decryptor, bool success,
+    const std::vector<PublicCertificate>* public_certificates) {
   if (!success || !public_certificates) {
     LOG(ERROR) << "Failed to read public certificates from storage.";
-    std::move(callback)(std::nullopt);
-    return;
+    return std::nullopt;
   }
 
-  for (const auto& cert : *public_certificates) {
-    std::optional<NearbyShareDecryptedPublicCertificate> decrypted =
-        NearbyShareDecryptedPublicCertificate::DecryptPublicCertificate(
-            cert, encrypted_metadata_key);
-    if (decrypted) {
-      VLOG(1) << "Successfully decrypted public certificate with ID "
-              << nearby::utils::HexEncode(decrypted->id());
-      std::move(callback)(std::move(decrypted));
-      return;
-    }
+  decryptor.SetPublicCertificates(*public_certificates);
+  std::optional<NearbyShareDecryptedPublicCertificate> decrypted =
+      decryptor.Decrypt(encrypted_metadata_key);
+  if (decrypted) {
+    VLOG(1) << "Successfully decrypted public certificate with ID "
+            << nearby::utils::HexEncode(decrypted->id());
+    return decrypted;
   }
   VLOG(1) << "Metadata key could not decrypt any public certificates.";
-  std::move(callback)(std::nullopt);
+  return std::nullopt;
 }
 
 void DumpCertificateId(std::stringstream& sstream, absl::string_view cert_id,
@@ -530,13 +527,19 @@ void NearbyShareCertificateManagerImpl::GetDecryptedPublicCertificate(
     NearbyShareEncryptedMetadataKey encrypted_metadata_key,
     CertDecryptedCallback callback) {
   certificate_storage_->GetPublicCertificates(
-      [encrypted_metadata_key = std::move(encrypted_metadata_key),
+      [this, encrypted_metadata_key = std::move(encrypted_metadata_key),
        callback = std::move(callback)](
           bool success,
           std::unique_ptr<std::vector<PublicCertificate>> result) {
-        TryDecryptPublicCertificates(encrypted_metadata_key,
-                                     std::move(callback), success,
-                                     std::move(result));
+        std::optional<NearbyShareDecryptedPublicCertificate> decrypted;
+        {
+          absl::MutexLock lock(&public_certificate_decryptor_mutex_);
+          decrypted = TryDecryptPublicCertificates(
+              encrypted_metadata_key, public_certificate_decryptor_, success,
+              result.get());
+        }
+        // The callback may re-enter the manager, so it runs unlocked.
+        std::move(callback)(std::move(decrypted));
       });
 }
 
@@ -24,8 +24,10 @@
 #include <utility>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/functional/any_invocable.h"
 #include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
 #include "absl/time/time.h"
 #include "internal/platform/implementation/account_manager.h"
 #include "internal/platform/task_runner.h"
@@ -33,6 +35,7 @@
 #include "sharing/certificates/nearby_share_certificate_storage.h"
 #include "sharing/certificates/nearby_share_encrypted_metadata_key.h"
 #include "sharing/certificates/nearby_share_private_certificate.h"
+#include "sharing/certificates/nearby_share_public_certificate_decryptor.h"
 #include "sharing/contacts/nearby_share_contact_manager.h"
 #include "sharing/internal/api/preference_manager.h"
 #include "sharing/internal/api/public_certificate_database.h"
@@ -223,6 +226,12 @@ class NearbyShareCertificateManagerImpl
   std::unique_ptr<NearbyShareScheduler> download_public_certificates_scheduler_;
 
   std::unique_ptr<TaskRunner> executor_;
+  // Public certificates are reloaded from storage for every advertisement. The
+  // decryptor keeps the derived keys of the certificates that are still stored
+  // so that they are not derived again for every lookup.
+  absl::Mutex public_certificate_decryptor_mutex_;
+  NearbySharePublicCertificateDecryptor public_certificate_decryptor_
+      ABSL_GUARDED_BY(public_certificate_decryptor_mutex_);
   // Whether we need to regenerate the certificates and make another
   // PublishDevice call. At every PublishDevice call, we check
   // PublishDeviceResponse to see if contacts are removed. In which case, we
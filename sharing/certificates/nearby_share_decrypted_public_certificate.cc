@@ -41,19 +41,6 @@ namespace nearby {
 namespace sharing {
 namespace {
 
-bool IsDataValid(absl::Time not_before, absl::Time not_after,
-                 absl::Span<const uint8_t> public_key,
-                 crypto::SymmetricKey* secret_key, absl::Span<const uint8_t> id,
-                 absl::Span<const uint8_t> encrypted_metadata,
-                 absl::Span<const uint8_t> metadata_encryption_key_tag) {
-  return not_before < not_after && !public_key.empty() && secret_key &&
-         secret_key->key().size() == kNearbyShareNumBytesSecretKey &&
-         id.size() == kNearbyShareNumBytesCertificateId &&
-         !encrypted_metadata.empty() &&
-         metadata_encryption_key_tag.size() ==
-             kNearbyShareNumBytesMetadataEncryptionKeyTag;
-}
-
 // Attempts to decrypt |encrypted_metadata_key| using the |secret_key|.
 // Return std::nullopt if the decryption was unsuccessful.
 std::optional<std::vector<uint8_t>> DecryptMetadataKey(
@@ -78,12 +65,12 @@ std::optional<std::vector<uint8_t>> DecryptMetadataKey(
 }
 
 // Attempts to decrypt |encrypted_metadata| with |metadata_encryption_key|,
-// using |authentication_key| as the IV. Returns std::nullopt if the decryption
-// was unsuccessful.
+// using |nonce| as the IV. Returns std::nullopt if the decryption was
+// unsuccessful.
 std::optional<std::vector<uint8_t>> DecryptMetadataPayload(
     absl::Span<const uint8_t> encrypted_metadata,
     absl::Span<const uint8_t> metadata_encryption_key,
-    const crypto::SymmetricKey* secret_key) {
+    absl::Span<const uint8_t> nonce) {
   // Init() keeps a reference to the input key, so that reference must outlive
   // the lifetime of |aead|.
   std::vector<uint8_t> derived_key = DeriveNearbyShareKey(
@@ -92,12 +79,8 @@ std::optional<std::vector<uint8_t>> DecryptMetadataPayload(
   crypto::Aead aead(crypto::Aead::AeadAlgorithm::AES_256_GCM);
   aead.Init(derived_key);
 
-  auto result = aead.Open(
-      encrypted_metadata,
-      /*nonce=*/
-      DeriveNearbyShareKey(as_bytes(absl::MakeSpan(secret_key->key())),
-                           kNearbyShareNumBytesAesGcmIv),
-      /*additional_data=*/absl::Span<const uint8_t>());
+  auto result = aead.Open(encrypted_metadata, nonce,
+                          /*additional_data=*/absl::Span<const uint8_t>());
   if (result) {
     return result.value();
   }
@@ -129,26 +112,13 @@ NearbyShareDecryptedPublicCertificate::DecryptPublicCertificate(
   // Note: The PublicCertificate.metadata_encryption_key and
   // PublicCertificate.for_selected_contacts are not returned from the server
   // for remote devices.
-  absl::Time not_before =
-      FromJavaTime(public_certificate.start_time().seconds() * 1000);
-  absl::Time not_after =
-      FromJavaTime(public_certificate.end_time().seconds() * 1000);
-  std::vector<uint8_t> public_key(public_certificate.public_key().begin(),
-                                  public_certificate.public_key().end());
+  if (!IsPublicCertificateValid(public_certificate)) {
+    return std::nullopt;
+  }
   std::unique_ptr<crypto::SymmetricKey> secret_key =
       crypto::SymmetricKey::Import(crypto::SymmetricKey::Algorithm::AES,
                                    public_certificate.secret_key());
-  std::vector<uint8_t> id(public_certificate.secret_id().begin(),
-                          public_certificate.secret_id().end());
-  std::vector<uint8_t> encrypted_metadata(
-      public_certificate.encrypted_metadata_bytes().begin(),
-      public_certificate.encrypted_metadata_bytes().end());
-  std::vector<uint8_t> metadata_encryption_key_tag(
-      public_certificate.metadata_encryption_key_tag().begin(),
-      public_certificate.metadata_encryption_key_tag().end());
-
-  if (!IsDataValid(not_before, not_after, public_key, secret_key.get(), id,
-                   encrypted_metadata, metadata_encryption_key_tag)) {
+  if (!secret_key) {
     return std::nullopt;
   }
 
@@ -162,15 +132,47 @@ NearbyShareDecryptedPublicCertificate::DecryptPublicCertificate(
   auto decrypted_metadata_key =
       DecryptMetadataKey(encrypted_metadata_key, secret_key.get());
   if (!decrypted_metadata_key ||
-      !VerifyMetadataEncryptionKeyTag(*decrypted_metadata_key,
-                                      metadata_encryption_key_tag)) {
+      !VerifyMetadataEncryptionKeyTag(
+          *decrypted_metadata_key,
+          as_bytes(absl::MakeSpan(
+              public_certificate.metadata_encryption_key_tag())))) {
     return std::nullopt;
   }
 
+  return DecryptMetadata(
+      public_certificate, *decrypted_metadata_key,
+      DeriveNearbyShareKey(as_bytes(absl::MakeSpan(secret_key->key())),
+                           kNearbyShareNumBytesAesGcmIv));
+}
+
+// static
+bool NearbyShareDecryptedPublicCertificate::IsPublicCertificateValid(
+    const nearby::sharing::proto::PublicCertificate& public_certificate) {
+  absl::Time not_before =
+      FromJavaTime(public_certificate.start_time().seconds() * 1000);
+  absl::Time not_after =
+      FromJavaTime(public_certificate.end_time().seconds() * 1000);
+  return not_before < not_after && !public_certificate.public_key().empty() &&
+         public_certificate.secret_key().size() ==
+             kNearbyShareNumBytesSecretKey &&
+         public_certificate.secret_id().size() ==
+             kNearbyShareNumBytesCertificateId &&
+         !public_certificate.encrypted_metadata_bytes().empty() &&
+         public_certificate.metadata_encryption_key_tag().size() ==
+             kNearbyShareNumBytesMetadataEncryptionKeyTag;
+}
+
+// static
+std::optional<NearbyShareDecryptedPublicCertificate>
+NearbyShareDecryptedPublicCertificate::DecryptMetadata(
+    const nearby::sharing::proto::PublicCertificate& public_certificate,
+    absl::Span<const uint8_t> decrypted_metadata_key,
+    absl::Span<const uint8_t> metadata_nonce) {
   // If the key was able to be decrypted, we expect the metadata to be able to
   // be decrypted.
   auto decrypted_metadata_bytes = DecryptMetadataPayload(
-      encrypted_metadata, *decrypted_metadata_key, secret_key.get());
+      as_bytes(absl::MakeSpan(public_certificate.encrypted_metadata_bytes())),
+      decrypted_metadata_key, metadata_nonce);
   if (!decrypted_metadata_bytes) {
     NL_LOG(ERROR) << "Metadata decryption failed: Failed to decrypt metadata"
                   << "payload.";
@@ -186,9 +188,15 @@ NearbyShareDecryptedPublicCertificate::DecryptPublicCertificate(
   }
 
   return NearbyShareDecryptedPublicCertificate(
-      not_before, not_after, std::move(secret_key), std::move(public_key),
-      std::move(id), std::move(unencrypted_metadata),
-      public_certificate.for_self_share());
+      FromJavaTime(public_certificate.start_time().seconds() * 1000),
+      FromJavaTime(public_certificate.end_time().seconds() * 1000),
+      crypto::SymmetricKey::Import(crypto::SymmetricKey::Algorithm::AES,
+                                   public_certificate.secret_key()),
+      std::vector<uint8_t>(public_certificate.public_key().begin(),
+                           public_certificate.public_key().end()),
+      std::vector<uint8_t>(public_certificate.secret_id().begin(),
+                           public_certificate.secret_id().end()),
+      std::move(unencrypted_metadata), public_certificate.for_self_share());
 }
 
 NearbyShareDecryptedPublicCertificate::NearbyShareDecryptedPublicCertificate(
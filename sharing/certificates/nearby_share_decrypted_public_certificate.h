@@ -80,6 +80,22 @@ class NearbyShareDecryptedPublicCertificate {
       absl::Span<const uint8_t> authentication_token) const;
 
  private:
+  friend class NearbySharePublicCertificateDecryptor;
+
+  // Returns true if |public_certificate| holds all the data needed to decrypt
+  // its metadata.
+  static bool IsPublicCertificateValid(
+      const nearby::sharing::proto::PublicCertificate& public_certificate);
+
+  // Decrypts the metadata of |public_certificate| with
+  // |decrypted_metadata_key|, which must already be verified against the
+  // metadata encryption key tag of the certificate. |metadata_nonce| is the
+  // AES-GCM nonce derived from the secret key of the certificate.
+  static std::optional<NearbyShareDecryptedPublicCertificate> DecryptMetadata(
+      const nearby::sharing::proto::PublicCertificate& public_certificate,
+      absl::Span<const uint8_t> decrypted_metadata_key,
+      absl::Span<const uint8_t> metadata_nonce);
+
   NearbyShareDecryptedPublicCertificate(
       absl::Time not_before, absl::Time not_after,
       std::unique_ptr<crypto::SymmetricKey> secret_key,
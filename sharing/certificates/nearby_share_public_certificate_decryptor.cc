@@ -0,0 +1,277 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sharing/certificates/nearby_share_public_certificate_decryptor.h"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/types/span.h"
+#include "internal/crypto_cros/encryptor.h"
+#include "internal/crypto_cros/symmetric_key.h"
+#include "sharing/certificates/common.h"
+#include "sharing/certificates/constants.h"
+#include "sharing/certificates/nearby_share_decrypted_public_certificate.h"
+#include "sharing/certificates/nearby_share_encrypted_metadata_key.h"
+#include "sharing/internal/public/logging.h"
+#include "sharing/proto/rpc_resources.pb.h"
+#include "sharing/proto/timestamp.pb.h"
+
+namespace nearby {
+namespace sharing {
+
+// The key material of one public certificate, derived once.
+struct NearbySharePublicCertificateDecryptor::PreparedCertificate {
+  nearby::sharing::proto::PublicCertificate certificate;
+  std::unique_ptr<crypto::SymmetricKey> secret_key;
+  // CTR mode encryptor holding the AES key schedule of |secret_key|. It keeps a
+  // pointer to |secret_key|, so this struct must not move.
+  crypto::Encryptor metadata_key_encryptor;
+  // AES-GCM nonce for the metadata, derived from |secret_key|.
+  std::vector<uint8_t> metadata_nonce;
+};
+
+namespace {
+
+// Returns true if the prepared key material of |prepared| can be reused for
+// |certificate|.
+bool IsSameKeyMaterial(
+    const nearby::sharing::proto::PublicCertificate& prepared,
+    const nearby::sharing::proto::PublicCertificate& certificate) {
+  return prepared.secret_key() == certificate.secret_key() &&
+         prepared.metadata_encryption_key_tag() ==
+             certificate.metadata_encryption_key_tag() &&
+         prepared.encrypted_metadata_bytes() ==
+             certificate.encrypted_metadata_bytes();
+}
+
+bool IsSameTimestamp(const nearby::sharing::proto::Timestamp& a,
+                     const nearby::sharing::proto::Timestamp& b) {
+  return a.seconds() == b.seconds() && a.nanos() == b.nanos();
+}
+
+// Returns true if |prepared| holds every field of |certificate|, so that
+// nothing needs to be copied.
+bool IsSameCertificate(
+    const nearby::sharing::proto::PublicCertificate& prepared,
+    const nearby::sharing::proto::PublicCertificate& certificate) {
+  return prepared.secret_id() == certificate.secret_id() &&
+         IsSameKeyMaterial(prepared, certificate) &&
+         prepared.public_key() == certificate.public_key() &&
+         IsSameTimestamp(prepared.start_time(), certificate.start_time()) &&
+         IsSameTimestamp(prepared.end_time(), certificate.end_time()) &&
+         prepared.for_selected_contacts() ==
+             certificate.for_selected_contacts() &&
+         prepared.metadata_encryption_key() ==
+             certificate.metadata_encryption_key() &&
+         prepared.for_self_share() == certificate.for_self_share();
+}
+
+}  // namespace
+
+NearbySharePublicCertificateDecryptor::NearbySharePublicCertificateDecryptor()
+    : tag_hmac_(crypto::HMAC::HashAlgorithm::SHA256) {
+  // This array of 0x00 is used to conform with the GmsCore implementation.
+  std::array<uint8_t, kNearbyShareNumBytesMetadataEncryptionKeyTag> key = {};
+  if (!tag_hmac_.Init(key)) {
+    NL_LOG(ERROR) << "Metadata encryption key tag HMAC could not be "
+                  << "initialized.";
+  }
+}
+
+NearbySharePublicCertificateDecryptor::
+    ~NearbySharePublicCertificateDecryptor() = default;
+
+void NearbySharePublicCertificateDecryptor::SetPublicCertificates(
+    absl::Span<const nearby::sharing::proto::PublicCertificate>
+        public_certificates) {
+  if (IsUnchanged(public_certificates)) {
+    return;
+  }
+
+  absl::flat_hash_map<std::string, std::unique_ptr<PreparedCertificate>>
+      previous;
+  for (std::unique_ptr<PreparedCertificate>& prepared : certificates_) {
+    std::string id = prepared->certificate.secret_id();
+    previous.emplace(std::move(id), std::move(prepared));
+  }
+  certificates_.clear();
+  certificates_.reserve(public_certificates.size());
+
+  for (const auto& certificate : public_certificates) {
+    auto it = previous.find(certificate.secret_id());
+    if (it != previous.end() && it->second != nullptr &&
+        IsSameKeyMaterial(it->second->certificate, certificate)) {
+      // Metadata such as the validity period may have been refreshed.
+      it->second->certificate = certificate;
+      certificates_.push_back(std::move(it->second));
+      continue;
+    }
+    if (!NearbyShareDecryptedPublicCertificate::IsPublicCertificateValid(
+            certificate)) {
+      continue;
+    }
+
+    auto prepared = std::make_unique<PreparedCertificate>();
+    prepared->certificate = certificate;
+    prepared->secret_key =
+        crypto::SymmetricKey::Import(crypto::SymmetricKey::Algorithm::AES,
+                                     certificate.secret_key());
+    if (!prepared->secret_key ||
+        !prepared->metadata_key_encryptor.Init(
+            prepared->secret_key.get(), crypto::Encryptor::Mode::CTR,
+            /*iv=*/absl::Span<const uint8_t>())) {
+      continue;
+    }
+    prepared->metadata_nonce = DeriveNearbyShareKey(
+        as_bytes(absl::MakeSpan(prepared->secret_key->key())),
+        kNearbyShareNumBytesAesGcmIv);
+    certificates_.push_back(std::move(prepared));
+  }
+}
+
+bool NearbySharePublicCertificateDecryptor::IsUnchanged(
+    absl::Span<const nearby::sharing::proto::PublicCertificate>
+        public_certificates) const {
+  size_t next = 0;
+  for (const auto& certificate : public_certificates) {
+    if (next < certificates_.size() &&
+        IsSameCertificate(certificates_[next]->certificate, certificate)) {
+      ++next;
+      continue;
+    }
+    // Invalid certificates were skipped by the last rebuild as well.
+    if (NearbyShareDecryptedPublicCertificate::IsPublicCertificateValid(
+            certificate)) {
+      return false;
+    }
+  }
+  return next == certificates_.size();
+}
+
+bool NearbySharePublicCertificateDecryptor::Matches(
+    const PreparedCertificate& certificate,
+    const NearbyShareEncryptedMetadataKey& encrypted_metadata_key,
+    absl::Span<const uint8_t> counter,
+    absl::Span<uint8_t> decrypted_metadata_key) const {
+  if (!certificate.metadata_key_encryptor.CryptWithCounter(
+          counter, encrypted_metadata_key.encrypted_key(),
+          decrypted_metadata_key)) {
+    return false;
+  }
+  return tag_hmac_.Verify(decrypted_metadata_key,
+                          as_bytes(absl::MakeSpan(
+                              certificate.certificate
+                                  .metadata_encryption_key_tag())));
+}
+
+const nearby::sharing::proto::PublicCertificate*
+NearbySharePublicCertificateDecryptor::FindCertificate(
+    const NearbyShareEncryptedMetadataKey& encrypted_metadata_key,
+    absl::Span<uint8_t> decrypted_metadata_key) const {
+  if (encrypted_metadata_key.salt().size() !=
+          kNearbyShareNumBytesMetadataEncryptionKeySalt ||
+      encrypted_metadata_key.encrypted_key().size() !=
+          kNearbyShareNumBytesMetadataEncryptionKey ||
+      decrypted_metadata_key.size() <
+          kNearbyShareNumBytesMetadataEncryptionKey) {
+    return nullptr;
+  }
+  decrypted_metadata_key =
+      decrypted_metadata_key.first(kNearbyShareNumBytesMetadataEncryptionKey);
+
+  // The counter depends only on the advertisement, so it is shared by all
+  // candidates.
+  std::vector<uint8_t> counter = DeriveNearbyShareKey(
+      encrypted_metadata_key.salt(), kNearbyShareNumBytesAesCtrIv);
+  for (const std::unique_ptr<PreparedCertificate>& certificate :
+       certificates_) {
+    if (Matches(*certificate, encrypted_metadata_key, counter,
+                decrypted_metadata_key)) {
+      return &certificate->certificate;
+    }
+  }
+  return nullptr;
+}
+
+std::optional<NearbyShareDecryptedPublicCertificate>
+NearbySharePublicCertificateDecryptor::Decrypt(
+    const NearbyShareEncryptedMetadataKey& encrypted_metadata_key) const {
+  std::optional<NearbyShareDecryptedPublicCertificate> result;
+  DecryptBatch(absl::MakeConstSpan(&encrypted_metadata_key, 1),
+               absl::MakeSpan(&result, 1));
+  return result;
+}
+
+void NearbySharePublicCertificateDecryptor::DecryptBatch(
+    absl::Span<const NearbyShareEncryptedMetadataKey> encrypted_metadata_keys,
+    absl::Span<std::optional<NearbyShareDecryptedPublicCertificate>> results)
+    const {
+  NL_DCHECK_GE(results.size(), encrypted_metadata_keys.size());
+  size_t count = std::min(results.size(), encrypted_metadata_keys.size());
+
+  // Keys that cannot belong to any certificate are resolved up front. The
+  // others get their counter derived once for the whole batch.
+  std::vector<std::vector<uint8_t>> counters(count);
+  size_t pending = 0;
+  for (size_t i = 0; i < count; ++i) {
+    results[i].reset();
+    const NearbyShareEncryptedMetadataKey& key = encrypted_metadata_keys[i];
+    if (key.salt().size() != kNearbyShareNumBytesMetadataEncryptionKeySalt ||
+        key.encrypted_key().size() !=
+            kNearbyShareNumBytesMetadataEncryptionKey) {
+      continue;
+    }
+    counters[i] =
+        DeriveNearbyShareKey(key.salt(), kNearbyShareNumBytesAesCtrIv);
+    ++pending;
+  }
+
+  std::array<uint8_t, kNearbyShareNumBytesMetadataEncryptionKey>
+      decrypted_metadata_key;
+  for (const std::unique_ptr<PreparedCertificate>& certificate :
+       certificates_) {
+    if (pending == 0) {
+      break;
+    }
+    for (size_t i = 0; i < count; ++i) {
+      if (counters[i].empty() ||
+          !Matches(*certificate, encrypted_metadata_keys[i], counters[i],
+                   absl::MakeSpan(decrypted_metadata_key))) {
+        continue;
+      }
+      // The first certificate whose metadata decrypts decides, as in a
+      // sequential search. A tag match alone may be a collision.
+      results[i] = NearbyShareDecryptedPublicCertificate::DecryptMetadata(
+          certificate->certificate, decrypted_metadata_key,
+          certificate->metadata_nonce);
+      if (!results[i].has_value()) {
+        continue;
+      }
+      counters[i].clear();
+      --pending;
+    }
+  }
+}
+
+}  // namespace sharing
+}  // namespace nearby
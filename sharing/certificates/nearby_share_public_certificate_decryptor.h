@@ -0,0 +1,112 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef THIRD_PARTY_NEARBY_SHARING_CERTIFICATES_NEARBY_SHARE_PUBLIC_CERTIFICATE_DECRYPTOR_H_
+#define THIRD_PARTY_NEARBY_SHARING_CERTIFICATES_NEARBY_SHARE_PUBLIC_CERTIFICATE_DECRYPTOR_H_
+
+#include <stdint.h>
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "absl/types/span.h"
+#include "internal/crypto_cros/hmac.h"
+#include "sharing/certificates/nearby_share_decrypted_public_certificate.h"
+#include "sharing/certificates/nearby_share_encrypted_metadata_key.h"
+#include "sharing/proto/rpc_resources.pb.h"
+
+namespace nearby {
+namespace sharing {
+
+// Finds the public certificate that an advertised encrypted metadata key
+// belongs to. This gives the same results as calling
+// NearbyShareDecryptedPublicCertificate::DecryptPublicCertificate() on each
+// certificate in turn, but the key material of every certificate (the
+// imported secret key, its AES key schedule and the AES-GCM nonce) is derived
+// only once and kept for as long as the certificate remains in the set. Each
+// candidate then costs one AES block and one HMAC per advertisement, with no
+// heap allocation.
+// This class is thread-compatible.
+class NearbySharePublicCertificateDecryptor {
+ public:
+  NearbySharePublicCertificateDecryptor();
+  NearbySharePublicCertificateDecryptor(
+      const NearbySharePublicCertificateDecryptor&) = delete;
+  NearbySharePublicCertificateDecryptor& operator=(
+      const NearbySharePublicCertificateDecryptor&) = delete;
+  ~NearbySharePublicCertificateDecryptor();
+
+  // Replaces the candidate certificates, tried in the given order. Nothing is
+  // copied if the set is unchanged. Otherwise the derived keys of certificates
+  // that were already present are reused; certificates that are no longer
+  // present are forgotten. Invalid certificates are skipped.
+  void SetPublicCertificates(
+      absl::Span<const nearby::sharing::proto::PublicCertificate>
+          public_certificates);
+
+  // Returns the number of usable certificates.
+  size_t size() const { return certificates_.size(); }
+
+  // Returns the first certificate whose metadata encryption key tag matches
+  // |encrypted_metadata_key|, and writes the decrypted metadata key into
+  // |decrypted_metadata_key|, which must hold at least
+  // kNearbyShareNumBytesMetadataEncryptionKey bytes. Returns nullptr if no
+  // certificate matches.
+  const nearby::sharing::proto::PublicCertificate* FindCertificate(
+      const NearbyShareEncryptedMetadataKey& encrypted_metadata_key,
+      absl::Span<uint8_t> decrypted_metadata_key) const;
+
+  // Decrypts the first certificate that matches |encrypted_metadata_key| and
+  // whose metadata can be decrypted. Returns std::nullopt if there is none.
+  std::optional<NearbyShareDecryptedPublicCertificate> Decrypt(
+      const NearbyShareEncryptedMetadataKey& encrypted_metadata_key) const;
+
+  // Decrypts the certificate matching each of |encrypted_metadata_keys| into
+  // the element of |results| at the same index. |results| must be at least as
+  // long as |encrypted_metadata_keys|. The certificates are walked once for
+  // the whole batch, so each key schedule is loaded once per batch instead of
+  // once per advertisement.
+  void DecryptBatch(
+      absl::Span<const NearbyShareEncryptedMetadataKey> encrypted_metadata_keys,
+      absl::Span<std::optional<NearbyShareDecryptedPublicCertificate>> results)
+      const;
+
+ private:
+  struct PreparedCertificate;
+
+  // Returns true if a rebuild from |public_certificates| would leave
+  // |certificates_| as it is.
+  bool IsUnchanged(absl::Span<const nearby::sharing::proto::PublicCertificate>
+                       public_certificates) const;
+
+  // Returns true if |certificate| matches the metadata key encrypted with the
+  // AES-CTR |counter|, and writes the decrypted key into
+  // |decrypted_metadata_key|.
+  bool Matches(const PreparedCertificate& certificate,
+               const NearbyShareEncryptedMetadataKey& encrypted_metadata_key,
+               absl::Span<const uint8_t> counter,
+               absl::Span<uint8_t> decrypted_metadata_key) const;
+
+  // Verifies metadata encryption key tags. The key is fixed by the protocol,
+  // so one instance serves all certificates.
+  crypto::HMAC tag_hmac_;
+  // Candidate certificates in the order given to SetPublicCertificates().
+  std::vector<std::unique_ptr<PreparedCertificate>> certificates_;
+};
+
+}  // namespace sharing
+}  // namespace nearby
+
+#endif  // THIRD_PARTY_NEARBY_SHARING_CERTIFICATES_NEARBY_SHARE_PUBLIC_CERTIFICATE_DECRYPTOR_H_
@@ -0,0 +1,213 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sharing/certificates/nearby_share_public_certificate_decryptor.h"
+
+#include <stdint.h>
+
+#include <array>
+#include <optional>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "absl/types/span.h"
+#include "sharing/certificates/constants.h"
+#include "sharing/certificates/nearby_share_decrypted_public_certificate.h"
+#include "sharing/certificates/nearby_share_encrypted_metadata_key.h"
+#include "sharing/certificates/nearby_share_private_certificate.h"
+#include "sharing/certificates/test_util.h"
+#include "sharing/proto/enums.pb.h"
+#include "sharing/proto/rpc_resources.pb.h"
+
+namespace nearby {
+namespace sharing {
+namespace {
+
+using ::nearby::sharing::proto::DeviceVisibility;
+using ::nearby::sharing::proto::PublicCertificate;
+
+constexpr DeviceVisibility kVisibility =
+    DeviceVisibility::DEVICE_VISIBILITY_ALL_CONTACTS;
+
+// Returns |count| private certificates with random keys.
+std::vector<NearbySharePrivateCertificate> CreatePrivateCertificates(
+    int count) {
+  std::vector<NearbySharePrivateCertificate> certificates;
+  for (int i = 0; i < count; ++i) {
+    certificates.emplace_back(kVisibility, GetNearbyShareTestNotBefore(),
+                              GetNearbyShareTestMetadata());
+  }
+  return certificates;
+}
+
+std::vector<PublicCertificate> ToPublicCertificates(
+    const std::vector<NearbySharePrivateCertificate>& private_certificates) {
+  std::vector<PublicCertificate> public_certificates;
+  for (const auto& private_certificate : private_certificates) {
+    public_certificates.push_back(*private_certificate.ToPublicCertificate());
+  }
+  return public_certificates;
+}
+
+TEST(NearbySharePublicCertificateDecryptorTest, Decrypt) {
+  std::vector<PublicCertificate> public_certificates =
+      ToPublicCertificates(CreatePrivateCertificates(5));
+  public_certificates.push_back(
+      GetNearbyShareTestPublicCertificate(kVisibility));
+  NearbySharePublicCertificateDecryptor decryptor;
+  decryptor.SetPublicCertificates(public_certificates);
+
+  std::optional<NearbyShareDecryptedPublicCertificate> cert =
+      decryptor.Decrypt(GetNearbyShareTestEncryptedMetadataKey());
+
+  ASSERT_TRUE(cert.has_value());
+  std::optional<NearbyShareDecryptedPublicCertificate> expected =
+      NearbyShareDecryptedPublicCertificate::DecryptPublicCertificate(
+          public_certificates.back(), GetNearbyShareTestEncryptedMetadataKey());
+  ASSERT_TRUE(expected.has_value());
+  EXPECT_EQ(cert->id(), expected->id());
+  EXPECT_EQ(cert->not_before(), expected->not_before());
+  EXPECT_EQ(cert->not_after(), expected->not_after());
+  EXPECT_EQ(cert->unencrypted_metadata().SerializeAsString(),
+            expected->unencrypted_metadata().SerializeAsString());
+  EXPECT_EQ(cert->HashAuthenticationToken(GetNearbyShareTestPayloadToSign()),
+            GetNearbyShareTestPayloadHashUsingSecretKey());
+}
+
+TEST(NearbySharePublicCertificateDecryptorTest, FindCertificate) {
+  NearbySharePublicCertificateDecryptor decryptor;
+  decryptor.SetPublicCertificates(
+      {GetNearbyShareTestPublicCertificate(kVisibility)});
+  std::array<uint8_t, kNearbyShareNumBytesMetadataEncryptionKey> metadata_key;
+
+  const PublicCertificate* cert = decryptor.FindCertificate(
+      GetNearbyShareTestEncryptedMetadataKey(), absl::MakeSpan(metadata_key));
+
+  ASSERT_NE(cert, nullptr);
+  EXPECT_EQ(std::vector<uint8_t>(metadata_key.begin(), metadata_key.end()),
+            GetNearbyShareTestMetadataEncryptionKey());
+}
+
+TEST(NearbySharePublicCertificateDecryptorTest, DecryptIncorrectKeyFails) {
+  NearbySharePublicCertificateDecryptor decryptor;
+  decryptor.SetPublicCertificates(
+      {GetNearbyShareTestPublicCertificate(kVisibility)});
+
+  EXPECT_FALSE(decryptor.Decrypt(NearbyShareEncryptedMetadataKey(
+      std::vector<uint8_t>(kNearbyShareNumBytesMetadataEncryptionKeySalt, 0x00),
+      std::vector<uint8_t>(kNearbyShareNumBytesMetadataEncryptionKey, 0x00))));
+}
+
+TEST(NearbySharePublicCertificateDecryptorTest, DecryptBatch) {
+  std::vector<NearbySharePrivateCertificate> private_certificates =
+      CreatePrivateCertificates(4);
+  NearbySharePublicCertificateDecryptor decryptor;
+  decryptor.SetPublicCertificates(ToPublicCertificates(private_certificates));
+  std::vector<NearbyShareEncryptedMetadataKey> keys;
+  // Advertisements in the reverse order of the certificates, with an unknown
+  // one in the middle.
+  keys.push_back(*private_certificates[3].EncryptMetadataKey());
+  keys.push_back(*private_certificates[1].EncryptMetadataKey());
+  keys.push_back(GetNearbyShareTestEncryptedMetadataKey());
+  keys.push_back(*private_certificates[0].EncryptMetadataKey());
+  std::vector<std::optional<NearbyShareDecryptedPublicCertificate>> results(
+      keys.size());
+
+  decryptor.DecryptBatch(keys, absl::MakeSpan(results));
+
+  ASSERT_TRUE(results[0].has_value());
+  EXPECT_EQ(results[0]->id(), private_certificates[3].id());
+  ASSERT_TRUE(results[1].has_value());
+  EXPECT_EQ(results[1]->id(), private_certificates[1].id());
+  EXPECT_FALSE(results[2].has_value());
+  ASSERT_TRUE(results[3].has_value());
+  EXPECT_EQ(results[3]->id(), private_certificates[0].id());
+}
+
+TEST(NearbySharePublicCertificateDecryptorTest,
+     DecryptSkipsCertificateWithUndecryptableMetadata) {
+  PublicCertificate certificate =
+      GetNearbyShareTestPublicCertificate(kVisibility);
+  // Same key and tag, so the tag matches, but the metadata does not decrypt.
+  PublicCertificate collision = certificate;
+  collision.set_secret_id("collision");
+  collision.set_encrypted_metadata_bytes("corrupt");
+  NearbySharePublicCertificateDecryptor decryptor;
+  decryptor.SetPublicCertificates({collision, certificate});
+  std::vector<NearbyShareEncryptedMetadataKey> keys = {
+      GetNearbyShareTestEncryptedMetadataKey()};
+  std::vector<std::optional<NearbyShareDecryptedPublicCertificate>> results(
+      keys.size());
+
+  std::optional<NearbyShareDecryptedPublicCertificate> cert =
+      decryptor.Decrypt(GetNearbyShareTestEncryptedMetadataKey());
+  decryptor.DecryptBatch(keys, absl::MakeSpan(results));
+
+  ASSERT_TRUE(cert.has_value());
+  EXPECT_EQ(cert->id(), GetNearbyShareTestCertificateId());
+  ASSERT_TRUE(results[0].has_value());
+  EXPECT_EQ(results[0]->id(), GetNearbyShareTestCertificateId());
+}
+
+TEST(NearbySharePublicCertificateDecryptorTest,
+     SetPublicCertificatesRefreshesChangedFields) {
+  PublicCertificate certificate =
+      GetNearbyShareTestPublicCertificate(kVisibility);
+  NearbySharePublicCertificateDecryptor decryptor;
+  decryptor.SetPublicCertificates({certificate});
+  decryptor.SetPublicCertificates({certificate});
+  std::array<uint8_t, kNearbyShareNumBytesMetadataEncryptionKey> metadata_key;
+  ASSERT_EQ(decryptor.size(), 1);
+
+  certificate.mutable_end_time()->set_seconds(
+      certificate.end_time().seconds() + 1);
+  decryptor.SetPublicCertificates({certificate});
+
+  const PublicCertificate* cert = decryptor.FindCertificate(
+      GetNearbyShareTestEncryptedMetadataKey(), absl::MakeSpan(metadata_key));
+  ASSERT_NE(cert, nullptr);
+  EXPECT_EQ(cert->end_time().seconds(), certificate.end_time().seconds());
+}
+
+TEST(NearbySharePublicCertificateDecryptorTest, SetPublicCertificatesReplaces) {
+  std::vector<PublicCertificate> public_certificates =
+      ToPublicCertificates(CreatePrivateCertificates(2));
+  public_certificates.push_back(
+      GetNearbyShareTestPublicCertificate(kVisibility));
+  NearbySharePublicCertificateDecryptor decryptor;
+  decryptor.SetPublicCertificates(public_certificates);
+  ASSERT_EQ(decryptor.size(), 3);
+  ASSERT_TRUE(decryptor.Decrypt(GetNearbyShareTestEncryptedMetadataKey()));
+
+  public_certificates.pop_back();
+  decryptor.SetPublicCertificates(public_certificates);
+
+  EXPECT_EQ(decryptor.size(), 2);
+  EXPECT_FALSE(decryptor.Decrypt(GetNearbyShareTestEncryptedMetadataKey()));
+}
+
+TEST(NearbySharePublicCertificateDecryptorTest, SkipsInvalidCertificates) {
+  PublicCertificate invalid = GetNearbyShareTestPublicCertificate(kVisibility);
+  invalid.mutable_end_time()->set_seconds(invalid.start_time().seconds() - 1);
+  NearbySharePublicCertificateDecryptor decryptor;
+
+  decryptor.SetPublicCertificates({invalid});
+
+  EXPECT_EQ(decryptor.size(), 0);
+  EXPECT_FALSE(decryptor.Decrypt(GetNearbyShareTestEncryptedMetadataKey()));
+}
+
+}  // namespace
+}  // namespace sharing
+}  // namespace nearby
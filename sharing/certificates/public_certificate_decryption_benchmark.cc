@@ -0,0 +1,159 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Cost of resolving advertised encrypted metadata keys against thousands of
+// stored public certificates, as done for every discovered Nearby Share
+// advertisement. The matching certificate is last, which is the worst case
+// for the trial decryption. Compares the per-certificate
+// NearbyShareDecryptedPublicCertificate::DecryptPublicCertificate() loop with
+// NearbySharePublicCertificateDecryptor, for single advertisements and for a
+// batch of advertisements.
+//
+// Run with --benchmark_format=json to get machine-readable results.
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "absl/types/span.h"
+#include "sharing/certificates/nearby_share_decrypted_public_certificate.h"
+#include "sharing/certificates/nearby_share_encrypted_metadata_key.h"
+#include "sharing/certificates/nearby_share_private_certificate.h"
+#include "sharing/certificates/nearby_share_public_certificate_decryptor.h"
+#include "sharing/certificates/test_util.h"
+#include "sharing/proto/enums.pb.h"
+#include "sharing/proto/rpc_resources.pb.h"
+
+namespace nearby {
+namespace sharing {
+namespace {
+
+using ::nearby::sharing::proto::DeviceVisibility;
+using ::nearby::sharing::proto::PublicCertificate;
+
+constexpr DeviceVisibility kVisibility =
+    DeviceVisibility::DEVICE_VISIBILITY_ALL_CONTACTS;
+constexpr int kBatchSize = 8;
+
+// Returns `count` public certificates where only the last one matches
+// GetNearbyShareTestEncryptedMetadataKey(). Generating certificates is slow,
+// so the random ones are shared by all benchmarks.
+std::vector<PublicCertificate> GetPublicCertificates(int count) {
+  static auto* random_certificates = new std::vector<PublicCertificate>();
+  while (random_certificates->size() < static_cast<size_t>(count - 1)) {
+    NearbySharePrivateCertificate private_certificate(
+        kVisibility, GetNearbyShareTestNotBefore(),
+        GetNearbyShareTestMetadata());
+    random_certificates->push_back(*private_certificate.ToPublicCertificate());
+  }
+  std::vector<PublicCertificate> certificates(
+      random_certificates->begin(), random_certificates->begin() + count - 1);
+  certificates.push_back(GetNearbyShareTestPublicCertificate(kVisibility));
+  return certificates;
+}
+
+// Arguments: certificate count.
+void BM_DecryptPublicCertificate(benchmark::State& state) {
+  std::vector<PublicCertificate> certificates =
+      GetPublicCertificates(state.range(0));
+  NearbyShareEncryptedMetadataKey key =
+      GetNearbyShareTestEncryptedMetadataKey();
+  for (auto _ : state) {
+    std::optional<NearbyShareDecryptedPublicCertificate> decrypted;
+    for (const PublicCertificate& certificate : certificates) {
+      decrypted =
+          NearbyShareDecryptedPublicCertificate::DecryptPublicCertificate(
+              certificate, key);
+      if (decrypted) {
+        break;
+      }
+    }
+    if (!decrypted) {
+      state.SkipWithError("No certificate matches");
+      return;
+    }
+    benchmark::DoNotOptimize(decrypted);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DecryptPublicCertificate)
+    ->ArgName("certificates")
+    ->Arg(1000)
+    ->Arg(5000);
+
+// Arguments: certificate count.
+void BM_DecryptorDecrypt(benchmark::State& state) {
+  NearbySharePublicCertificateDecryptor decryptor;
+  decryptor.SetPublicCertificates(GetPublicCertificates(state.range(0)));
+  NearbyShareEncryptedMetadataKey key =
+      GetNearbyShareTestEncryptedMetadataKey();
+  for (auto _ : state) {
+    std::optional<NearbyShareDecryptedPublicCertificate> decrypted =
+        decryptor.Decrypt(key);
+    if (!decrypted) {
+      state.SkipWithError("No certificate matches");
+      return;
+    }
+    benchmark::DoNotOptimize(decrypted);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DecryptorDecrypt)->ArgName("certificates")->Arg(1000)->Arg(5000);
+
+// Arguments: certificate count. Each iteration resolves kBatchSize
+// advertisements.
+void BM_DecryptorDecryptBatch(benchmark::State& state) {
+  NearbySharePublicCertificateDecryptor decryptor;
+  decryptor.SetPublicCertificates(GetPublicCertificates(state.range(0)));
+  std::vector<NearbyShareEncryptedMetadataKey> keys(
+      kBatchSize, GetNearbyShareTestEncryptedMetadataKey());
+  std::vector<std::optional<NearbyShareDecryptedPublicCertificate>> results(
+      keys.size());
+  for (auto _ : state) {
+    decryptor.DecryptBatch(keys, absl::MakeSpan(results));
+    if (!results.back()) {
+      state.SkipWithError("No certificate matches");
+      return;
+    }
+    benchmark::DoNotOptimize(results);
+  }
+  state.SetItemsProcessed(state.iterations() * kBatchSize);
+}
+BENCHMARK(BM_DecryptorDecryptBatch)
+    ->ArgName("certificates")
+    ->Arg(1000)
+    ->Arg(5000);
+
+// Arguments: certificate count. Measures reloading the certificates from
+// storage when all of them are already known, as done for every lookup.
+void BM_DecryptorSetPublicCertificates(benchmark::State& state) {
+  std::vector<PublicCertificate> certificates =
+      GetPublicCertificates(state.range(0));
+  NearbySharePublicCertificateDecryptor decryptor;
+  decryptor.SetPublicCertificates(certificates);
+  for (auto _ : state) {
+    decryptor.SetPublicCertificates(certificates);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DecryptorSetPublicCertificates)
+    ->ArgName("certificates")
+    ->Arg(1000)
+    ->Arg(5000);
+
+}  // namespace
+}  // namespace sharing
+}  // namespace nearby
@@ -54,6 +54,24 @@ constexpr absl::Duration kInvalidateDelay = absl::Milliseconds(500);
 // value is 1MB to match the default setting on Android.
 constexpr int64_t kAttachmentsSizeThresholdOverHighQualityMedium = 1000000;
 
+// Largest share that is received speculatively, before the user accepts it.
+// Bigger shares wait for the user so a rejected share does not waste the
+// bandwidth and disk space.
+constexpr int64_t kSpeculativeReceiveMaxTotalSize = 50 * 1000 * 1000;
+
+// Directory inside the save path that holds files received speculatively.
+// They are moved into the save path once the user accepts the share.
+constexpr char kSpeculativeReceiveQuarantineDirName[] = ".nearby_speculative";
+
+// Time a speculative outgoing connection is kept open without the user
+// selecting its share target. It must be shorter than kReadFramesTimeout, the
+// time the receiver waits for the introduction frame.
+constexpr absl::Duration kSpeculativeConnectionIdleTimeout = absl::Seconds(10);
+
+// Maximum number of speculative outgoing connections started in one scanning
+// session. At most one of them is open at any time.
+constexpr int kMaxSpeculativeConnectionAttempts = 2;
+
 // If true, the user will be able to accept incoming Wi-Fi Credential
 // attachments and join the network when the attachment is opened.
 constexpr bool kSupportReceivingWifiCredentials = true;
@@ -112,6 +112,7 @@ void FakeNearbyConnectionsManager::Connect(
     DataUsage data_usage, TransportType transport_type,
     NearbyConnectionCallback callback) {
   DCHECK(!is_shutdown());
+  ++connect_count_;
   connected_data_usage_ = data_usage;
   transport_type_ = transport_type;
   {
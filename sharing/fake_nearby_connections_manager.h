@@ -109,6 +109,8 @@ class FakeNearbyConnectionsManager : public NearbyConnectionsManager {
     return connected_data_usage_;
   }
   TransportType transport_type() const { return transport_type_; }
+  int connect_count() const { return connect_count_; }
+  const std::string& custom_save_path() const { return custom_save_path_; }
   void set_send_payload_callback(
       std::function<void(std::unique_ptr<Payload>,
                          std::weak_ptr<PayloadStatusListener>)>
@@ -160,6 +162,7 @@ class FakeNearbyConnectionsManager : public NearbyConnectionsManager {
   NearbyConnection* connection_ = nullptr;
   proto::DataUsage connected_data_usage_ = proto::DataUsage::UNKNOWN_DATA_USAGE;
   TransportType transport_type_ = TransportType::kAny;
+  int connect_count_ = 0;
   std::function<void(std::unique_ptr<Payload>,
                      std::weak_ptr<PayloadStatusListener>)>
       send_payload_callback_;
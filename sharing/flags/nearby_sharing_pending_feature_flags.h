@@ -0,0 +1,50 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef THIRD_PARTY_NEARBY_SHARING_FLAGS_NEARBY_SHARING_PENDING_FEATURE_FLAGS_H_
+#define THIRD_PARTY_NEARBY_SHARING_FLAGS_NEARBY_SHARING_PENDING_FEATURE_FLAGS_H_
+
+#include "internal/flags/flag.h"
+#include "sharing/flags/generated/nearby_sharing_feature_flags.h"
+
+// Nearby Share flags that are not in the flag source yet. The flags in
+// generated/nearby_sharing_feature_flags.h are generated from the flag source
+// and must not be edited by hand (see generated/README.md). Once a flag below
+// is added there, it moves to the generated file with its assigned ID and is
+// removed from here; its name in the nearby_sharing_feature namespace does not
+// change, so callers are unaffected.
+//
+// Until then a flag only takes its default value or a value set with
+// NearbyFlags::OverrideBoolFlagValue().
+
+namespace nearby {
+namespace sharing {
+namespace config_package_nearby {
+namespace nearby_sharing_feature {
+
+// When true, the receiver lets the sender start streaming payloads while the
+// user is still deciding whether to accept the share.
+constexpr auto kEnableSpeculativeReceive = flags::Flag<bool>(
+    kConfigPackage, "nearby_sharing_enable_speculative_receive", false);
+// When true, the sender connects to the most likely share target while the
+// send surface is in the foreground, before the user selects it.
+constexpr auto kEnableSpeculativeConnection = flags::Flag<bool>(
+    kConfigPackage, "nearby_sharing_enable_speculative_connection", false);
+
+}  // namespace nearby_sharing_feature
+}  // namespace config_package_nearby
+}  // namespace sharing
+}  // namespace nearby
+
+#endif  // THIRD_PARTY_NEARBY_SHARING_FLAGS_NEARBY_SHARING_PENDING_FEATURE_FLAGS_H_
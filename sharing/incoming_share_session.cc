@@ -22,6 +22,7 @@
 #include <optional>
 #include <queue>
 #include <string>
+#include <system_error>  // NOLINT(build/c++11)
 #include <utility>
 #include <vector>
 
@@ -59,6 +60,23 @@ using ::nearby::sharing::service::proto::IntroductionFrame;
 using ::nearby::sharing::service::proto::V1Frame;
 using ::nearby::sharing::service::proto::WifiCredentials;
 
+// Returns |path|, or "name (n).ext" next to it if |path| is already taken.
+std::filesystem::path GetAvailablePath(const std::filesystem::path& path) {
+  std::error_code error;
+  if (!std::filesystem::exists(path, error)) {
+    return path;
+  }
+  for (int i = 1;; ++i) {
+    std::filesystem::path candidate = path;
+    candidate.replace_filename(path.stem());
+    candidate += " (" + std::to_string(i) + ")";
+    candidate += path.extension();
+    if (!std::filesystem::exists(candidate, error)) {
+      return candidate;
+    }
+  }
+}
+
 }  // namespace
 
 IncomingShareSession::IncomingShareSession(
@@ -78,6 +96,9 @@ IncomingShareSession::~IncomingShareSession() = default;
 
 void IncomingShareSession::InvokeTransferUpdateCallback(
     const TransferMetadata& metadata) {
+  if (metadata.is_final_status()) {
+    EndQuarantine();
+  }
   transfer_update_callback_(*this, metadata);
 }
 
@@ -145,6 +166,8 @@ IncomingShareSession::ProcessIntroduction(
                     "be result of unrecognizable attachment type";
     return TransferMetadata::Status::kUnsupportedAttachmentType;
   }
+  sender_supports_provisional_accept_ =
+      introduction_frame.supports_provisional_accept();
   return std::nullopt;
 }
 
@@ -206,6 +229,29 @@ bool IncomingShareSession::AcceptTransfer(
     return false;
   }
   ready_for_accept_ = false;
+  if (speculative_transfer_) {
+    // Payloads are already flowing, only the user decision was missing.
+    speculative_transfer_ = false;
+    // Files that have not started yet go straight to the save path.
+    EndQuarantine();
+    WriteResponseFrame(ConnectionResponseFrame::ACCEPT);
+    analytics_recorder().NewRespondToIntroduction(
+        ResponseToIntroduction::ACCEPT_INTRODUCTION, session_id());
+    UpdateTransferMetadata(
+        TransferMetadataBuilder()
+            .set_status(TransferMetadata::Status::kAwaitingRemoteAcceptance)
+            .set_token(token())
+            .build());
+    analytics_recorder().NewReceiveAttachmentsStart(session_id(),
+                                                    attachment_container());
+    if (speculative_metadata_.has_value()) {
+      // Report the progress withheld so far. The sender is already sending,
+      // so the mutual acceptance timeout no longer applies.
+      mutual_acceptance_timeout_ = nullptr;
+      service_thread().PostTask(std::move(payload_transfer_updates_callback));
+    }
+    return true;
+  }
   InitializePayloadTracker(std::move(payload_transfer_updates_callback));
   const absl::flat_hash_map<int64_t, int64_t>& payload_map =
       attachment_payload_map();
@@ -245,6 +291,143 @@ bool IncomingShareSession::AcceptTransfer(
   return true;
 }
 
+bool IncomingShareSession::BeginSpeculativeTransfer(
+    int64_t max_total_size, std::string save_path,
+    std::filesystem::path quarantine_dir,
+    absl::AnyInvocable<void()> payload_transfer_updates_callback) {
+  if (!ready_for_accept_ || speculative_transfer_ || !IsConnected()) {
+    LOG(WARNING) << "BeginSpeculativeTransfer call not expected";
+    return false;
+  }
+  // kUnable leaves the token for the user to compare, only a successful paired
+  // key verification clears it.
+  if (!token().empty()) {
+    VLOG(1) << __func__ << ": Sender is not verified";
+    return false;
+  }
+  if (!sender_supports_provisional_accept_) {
+    VLOG(1) << __func__ << ": Sender does not support provisional acceptance";
+    return false;
+  }
+  if (attachment_container().GetTotalAttachmentsSize() > max_total_size) {
+    VLOG(1) << __func__ << ": Attachments too large to receive speculatively";
+    return false;
+  }
+  std::error_code error;
+  std::filesystem::create_directories(quarantine_dir, error);
+  if (error) {
+    LOG(WARNING) << __func__ << ": Failed to create quarantine directory: "
+                 << error.message();
+    return false;
+  }
+  speculative_transfer_ = true;
+  speculative_max_total_size_ = max_total_size;
+  received_bytes_.clear();
+  save_path_ = std::move(save_path);
+  quarantine_dir_ = std::move(quarantine_dir);
+  quarantine_active_ = true;
+  connections_manager().SetCustomSavePath(
+      GetCompatibleU8String(quarantine_dir_.u8string()));
+  InitializePayloadTracker(std::move(payload_transfer_updates_callback));
+  for (const auto& [attachment_id, payload_id] : attachment_payload_map()) {
+    connections_manager().RegisterPayloadStatusListener(payload_id,
+                                                        payload_tracker());
+  }
+  // The sender starts sending payloads, but keeps waiting for the ACCEPT sent
+  // once the user accepts.
+  WriteResponseFrame(ConnectionResponseFrame::PROVISIONAL_ACCEPT);
+  LOG(INFO) << __func__ << ": Receiving payloads before local acceptance";
+  TryUpgradeBandwidth();
+  return true;
+}
+
+void IncomingShareSession::CancelSpeculativeTransfer() {
+  if (!speculative_transfer_) {
+    return;
+  }
+  LOG(INFO) << __func__ << ": Cancelling speculatively received payloads";
+  speculative_transfer_ = false;
+  speculative_metadata_.reset();
+  EndQuarantine();
+  // Record the payload paths first so that the partial files can be deleted.
+  UpdateFilePayloadPaths();
+  CancelPayloads();
+  WriteCancelFrame();
+}
+
+void IncomingShareSession::EndQuarantine() {
+  if (!quarantine_active_) {
+    return;
+  }
+  quarantine_active_ = false;
+  connections_manager().SetCustomSavePath(save_path_);
+}
+
+bool IncomingShareSession::PromoteQuarantinedFiles() {
+  if (quarantine_dir_.empty()) {
+    return true;
+  }
+  std::filesystem::path save_dir = quarantine_dir_.parent_path();
+  AttachmentContainer& container = mutable_attachment_container();
+  bool result = true;
+  for (int i = 0; i < container.GetFileAttachments().size(); ++i) {
+    FileAttachment& file = container.GetMutableFileAttachment(i);
+    if (!file.file_path().has_value()) {
+      continue;
+    }
+    std::filesystem::path relative_path =
+        file.file_path()->lexically_relative(quarantine_dir_);
+    if (relative_path.empty() || *relative_path.begin() == "..") {
+      // Started after the user accepted, already in the save path.
+      continue;
+    }
+    std::filesystem::path file_path =
+        GetAvailablePath(save_dir / relative_path);
+    std::error_code error;
+    std::filesystem::create_directories(file_path.parent_path(), error);
+    std::filesystem::rename(*file.file_path(), file_path, error);
+    if (error) {
+      LOG(WARNING) << __func__ << ": Failed to move file attachment "
+                   << file.id() << ": " << error.message();
+      result = false;
+      continue;
+    }
+    VLOG(1) << __func__ << ": Moved file_path="
+            << GetCompatibleU8String(file_path.u8string());
+    file.set_file_path(file_path);
+  }
+  RemoveQuarantineDir(quarantine_dir_);
+  return result;
+}
+
+void IncomingShareSession::RemoveQuarantineDir(
+    const std::filesystem::path& quarantine_dir) {
+  std::error_code error;
+  std::vector<std::filesystem::path> sub_dirs;
+  for (const auto& entry :
+       std::filesystem::directory_iterator(quarantine_dir, error)) {
+    if (entry.is_directory(error)) {
+      sub_dirs.push_back(entry.path());
+    }
+  }
+  for (const auto& sub_dir : sub_dirs) {
+    RemoveQuarantineDir(sub_dir);
+  }
+  // Folders still holding files are left in place.
+  if (std::filesystem::remove(quarantine_dir, error)) {
+    VLOG(1) << __func__ << ": Removed quarantine_dir="
+            << GetCompatibleU8String(quarantine_dir.u8string());
+  }
+}
+
+int64_t IncomingShareSession::GetReceivedBytes() const {
+  int64_t received_bytes = 0;
+  for (const auto& [payload_id, bytes] : received_bytes_) {
+    received_bytes += bytes;
+  }
+  return received_bytes;
+}
+
 bool IncomingShareSession::UpdateFilePayloadPaths() {
   AttachmentContainer& container = mutable_attachment_container();
   bool result = true;
@@ -412,7 +595,12 @@ void IncomingShareSession::SendFailureResponse(
       break;
   }
 
-  WriteResponseFrame(response_status);
+  if (speculative_transfer_) {
+    // The sender was already told to send, so a response frame is too late.
+    CancelSpeculativeTransfer();
+  } else {
+    WriteResponseFrame(response_status);
+  }
   DCHECK(TransferMetadata::IsFinalStatus(status))
       << "SendFailureResponse should only be called with a final status";
   UpdateTransferMetadata(TransferMetadataBuilder().set_status(status).build());
@@ -425,15 +613,33 @@ IncomingShareSession::ProcessPayloadTransferUpdates(
       payload_updates_queue()->ReadAll();
   VLOG(1) << "Processing " << updates.size() << " PayloadTransferUpdates";
   if (updates.empty()) {
+    if (!speculative_transfer_ && speculative_metadata_.has_value()) {
+      return TakeSpeculativeMetadata();
+    }
     return std::nullopt;
   }
   // Cancel acceptance timer when payload transfer update is received.
-  // This mean sender has begun sending payload.
-  mutual_acceptance_timeout_ = nullptr;
+  // This mean sender has begun sending payload. A speculative transfer is
+  // still waiting for the user, so the timer keeps running.
+  if (!speculative_transfer_) {
+    mutual_acceptance_timeout_ = nullptr;
+  }
   std::optional<TransferMetadata> metadata;
   // If there is a batch of updates in the queue, only return the latest
   // TransferMetadata.
   for (; !updates.empty(); updates.pop()) {
+    received_bytes_[updates.front()->payload_id] =
+        updates.front()->bytes_transferred;
+    if (speculative_transfer_ &&
+        GetReceivedBytes() > speculative_max_total_size_) {
+      // The sender declared a smaller share than it is sending.
+      LOG(WARNING) << __func__
+                   << ": Received more bytes than allowed before acceptance";
+      CancelSpeculativeTransfer();
+      return TransferMetadataBuilder()
+          .set_status(TransferMetadata::Status::kFailed)
+          .build();
+    }
     metadata =
         get_payload_tracker()->ProcessPayloadUpdate(std::move(updates.front()));
     if (!metadata.has_value()) {
@@ -446,6 +652,17 @@ IncomingShareSession::ProcessPayloadTransferUpdates(
             .set_status(TransferMetadata::Status::kIncompletePayloads)
             .build();
       }
+      if (speculative_transfer_) {
+        // Hold the completion until the user accepts.
+        speculative_metadata_ = std::move(metadata);
+        return std::nullopt;
+      }
+      speculative_metadata_.reset();
+      if (!PromoteQuarantinedFiles()) {
+        return TransferMetadataBuilder()
+            .set_status(TransferMetadata::Status::kIncompletePayloads)
+            .build();
+      }
       return metadata;
     }
 
@@ -461,6 +678,32 @@ IncomingShareSession::ProcessPayloadTransferUpdates(
       }
     }
   }
+  if (speculative_transfer_) {
+    // Failures end the session right away, progress waits for the user.
+    if (metadata.has_value() && !metadata->is_final_status()) {
+      speculative_metadata_ = std::move(metadata);
+      return std::nullopt;
+    }
+    return metadata;
+  }
+  if (!metadata.has_value()) {
+    return TakeSpeculativeMetadata();
+  }
+  speculative_metadata_.reset();
+  return metadata;
+}
+
+std::optional<TransferMetadata>
+IncomingShareSession::TakeSpeculativeMetadata() {
+  std::optional<TransferMetadata> metadata = std::move(speculative_metadata_);
+  speculative_metadata_.reset();
+  if (metadata.has_value() &&
+      metadata->status() == TransferMetadata::Status::kComplete &&
+      !PromoteQuarantinedFiles()) {
+    return TransferMetadataBuilder()
+        .set_status(TransferMetadata::Status::kIncompletePayloads)
+        .build();
+  }
   return metadata;
 }
 
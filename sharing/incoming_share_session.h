@@ -15,6 +15,7 @@
 #ifndef THIRD_PARTY_NEARBY_SHARING_INCOMING_SHARE_SESSION_H_
 #define THIRD_PARTY_NEARBY_SHARING_INCOMING_SHARE_SESSION_H_
 
+#include <cstdint>
 #include <filesystem>  // NOLINT
 #include <functional>
 #include <memory>
@@ -22,6 +23,7 @@
 #include <string>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/functional/any_invocable.h"
 #include "internal/platform/clock.h"
 #include "internal/platform/task_runner.h"
@@ -86,9 +88,42 @@ class IncomingShareSession : public ShareSession {
   bool AcceptTransfer(
       absl::AnyInvocable<void()> payload_transfer_updates_callback);
 
+  // Lets the sender start streaming payloads while the user has not accepted
+  // the transfer yet. The sender is sent a PROVISIONAL_ACCEPT, so it keeps
+  // waiting for the user. Files are written to |quarantine_dir| and moved
+  // into its parent directory once the user accepts; |save_path| is the save
+  // path to restore afterwards. Payload progress is withheld until
+  // AcceptTransfer is called. The transfer is cancelled if more than
+  // |max_total_size| bytes are received before that.
+  // Returns false if session is not waiting for the user to accept, the
+  // paired key verification did not succeed, the sender cannot handle a
+  // provisional acceptance or the attachments are larger than
+  // |max_total_size|.
+  bool BeginSpeculativeTransfer(
+      int64_t max_total_size, std::string save_path,
+      std::filesystem::path quarantine_dir,
+      absl::AnyInvocable<void()> payload_transfer_updates_callback);
+
+  // Returns true if payloads are being received before the user accepted.
+  bool IsSpeculativeTransfer() const { return speculative_transfer_; }
+
+  // Stops a speculative transfer: cancels the payloads and tells the sender to
+  // stop sending. Does nothing if the transfer is not speculative.
+  void CancelSpeculativeTransfer();
+
   // Returns the file paths of all file payloads.
   std::vector<std::filesystem::path> GetPayloadFilePaths() const;
 
+  // Returns the folder files were written to before the user accepted. Empty
+  // if the transfer was never speculative.
+  const std::filesystem::path& quarantine_dir() const {
+    return quarantine_dir_;
+  }
+
+  // Deletes |quarantine_dir| and the folders below it, except the ones still
+  // holding files, e.g. of another speculative transfer.
+  static void RemoveQuarantineDir(const std::filesystem::path& quarantine_dir);
+
   // Upgrade bandwidth if it is needed.
   // Returns true if bandwidth upgrade was requested.
   bool TryUpgradeBandwidth();
@@ -129,11 +164,38 @@ class IncomingShareSession : public ShareSession {
   // Returns true if all payloads were successfully finalized.
   bool FinalizePayloads();
 
+  // Returns the metadata held back during a speculative transfer, if any.
+  std::optional<TransferMetadata> TakeSpeculativeMetadata();
+
+  // Moves the files received into the quarantine directory next to it, then
+  // deletes the quarantine directory.
+  // Returns false if a file could not be moved.
+  bool PromoteQuarantinedFiles();
+
+  // Points the connections layer back at the regular save path.
+  void EndQuarantine();
+
+  // Returns the bytes received for all payloads so far.
+  int64_t GetReceivedBytes() const;
+
   std::function<void(const IncomingShareSession&, const TransferMetadata&)>
       transfer_update_callback_;
 
   bool bandwidth_upgrade_requested_ = false;
   bool ready_for_accept_ = false;
+  bool speculative_transfer_ = false;
+  // The latest metadata produced while the transfer was speculative. It is
+  // reported once the user accepts the transfer.
+  std::optional<TransferMetadata> speculative_metadata_;
+  // Whether the sender handles a PROVISIONAL_ACCEPT response.
+  bool sender_supports_provisional_accept_ = false;
+  int64_t speculative_max_total_size_ = 0;
+  // Bytes received so far, keyed by payload id.
+  absl::flat_hash_map<int64_t, uint64_t> received_bytes_;
+  // Set while new incoming files are written to |quarantine_dir_|.
+  bool quarantine_active_ = false;
+  std::string save_path_;
+  std::filesystem::path quarantine_dir_;
   // This alarm is used to disconnect the sharing connection if both sides do
   // not press accept within the timeout.
   std::unique_ptr<ThreadTimer> mutual_acceptance_timeout_;
@@ -16,11 +16,13 @@
 
 #include <cstdint>
 #include <filesystem>  // NOLINT
+#include <fstream>
 #include <limits>
 #include <memory>
 #include <optional>
 #include <queue>
 #include <string>
+#include <system_error>  // NOLINT(build/c++11)
 #include <utility>
 #include <vector>
 
@@ -37,6 +39,8 @@
 #include "proto/sharing_enums.pb.h"
 #include "sharing/analytics/analytics_recorder.h"
 #include "sharing/attachment_compare.h"  // IWYU pragma: keep
+#include "sharing/common/compatible_u8_string.h"
+#include "sharing/constants.h"
 #include "sharing/fake_nearby_connections_manager.h"
 #include "sharing/file_attachment.h"
 #include "sharing/internal/public/logging.h"
@@ -75,6 +79,7 @@ using ::nearby::sharing::service::proto::WifiCredentials;
 using ::nearby::sharing::service::proto::WifiCredentialsMetadata;
 using ::testing::_;
 using ::testing::AllOf;
+using ::testing::AnyNumber;
 using ::testing::Eq;
 using ::testing::IsEmpty;
 using ::testing::IsFalse;
@@ -166,6 +171,7 @@ class IncomingShareSessionTest : public ::testing::Test {
                                                 security_type: WEP
                                                 payload_id: 9871
                                               }
+                                              supports_provisional_accept: true
                                             )pb",
                                             &introduction_frame_));
     payload_id1_ = introduction_frame_.file_metadata(0).payload_id();
@@ -182,6 +188,13 @@ class IncomingShareSessionTest : public ::testing::Test {
   void TearDown() override {
     // Make sure PayloadUpdateQueue callbacks are finished.
     task_runner_.SyncWithTimeout(Seconds(1));
+    std::error_code error;
+    std::filesystem::remove_all(save_dir_, error);
+  }
+
+  bool BeginSpeculativeTransfer(int64_t max_total_size) {
+    return session_.BeginSpeculativeTransfer(
+        max_total_size, "save_path", quarantine_dir_, []() {});
   }
 
   FakeClock clock_;
@@ -203,6 +216,10 @@ class IncomingShareSessionTest : public ::testing::Test {
   int64_t text_payload_id2_;
   int64_t wifi_payload_id1_;
   int64_t wifi_payload_id2_;
+  std::filesystem::path save_dir_ =
+      std::filesystem::temp_directory_path() / "incoming_share_session_test";
+  std::filesystem::path quarantine_dir_ =
+      save_dir_ / kSpeculativeReceiveQuarantineDirName;
 };
 
 TEST_F(IncomingShareSessionTest, ProcessIntroductionNoSupportedPayload) {
@@ -1168,6 +1185,317 @@ TEST_F(IncomingShareSessionTest, AcceptTransferSuccess) {
             ConnectionResponseFrame::ACCEPT);
 }
 
+TEST_F(IncomingShareSessionTest, BeginSpeculativeTransferNotReady) {
+  session_.OnConnected(&connection_);
+  EXPECT_THAT(session_.ProcessIntroduction(introduction_frame_),
+              Eq(std::nullopt));
+
+  EXPECT_THAT(BeginSpeculativeTransfer(std::numeric_limits<int64_t>::max()),
+              IsFalse());
+  EXPECT_THAT(session_.IsSpeculativeTransfer(), IsFalse());
+}
+
+TEST_F(IncomingShareSessionTest, BeginSpeculativeTransferTooLarge) {
+  connections_manager_.AcceptConnection(
+      /*endpoint_info=*/{}, kEndpointId, &connection_);
+  session_.OnConnected(&connection_);
+  EXPECT_THAT(session_.ProcessIntroduction(introduction_frame_),
+              Eq(std::nullopt));
+  session_.ReadyForTransfer([]() {}, [](std::optional<V1Frame> frame) {});
+
+  EXPECT_THAT(BeginSpeculativeTransfer(
+                  session_.attachment_container().GetTotalAttachmentsSize() -
+                  1),
+              IsFalse());
+  EXPECT_THAT(session_.IsSpeculativeTransfer(), IsFalse());
+}
+
+TEST_F(IncomingShareSessionTest, SpeculativeTransferReportedAfterAccept) {
+  connections_manager_.AcceptConnection(
+      /*endpoint_info=*/{}, kEndpointId, &connection_);
+  session_.OnConnected(&connection_);
+  EXPECT_THAT(session_.ProcessIntroduction(introduction_frame_),
+              Eq(std::nullopt));
+  std::filesystem::path file1_path = "/usr/tmp/file1";
+  connections_manager_.SetIncomingPayload(
+      payload_id1_, CreateFilePayload(payload_id1_, file1_path));
+  std::queue<std::vector<uint8_t>> frames_data;
+  connections_manager_.set_send_payload_callback(
+      [&](std::unique_ptr<Payload> payload,
+          std::weak_ptr<NearbyConnectionsManager::PayloadStatusListener>
+              listener) {
+        frames_data.push(std::move(payload->content.bytes_payload.bytes));
+      });
+  bool accept_timeout_called = false;
+  EXPECT_THAT(session_.ReadyForTransfer(
+                  [&accept_timeout_called]() { accept_timeout_called = true; },
+                  [](std::optional<V1Frame> frame) {}),
+              IsFalse());
+
+  EXPECT_THAT(BeginSpeculativeTransfer(std::numeric_limits<int64_t>::max()),
+              IsTrue());
+
+  EXPECT_THAT(session_.IsSpeculativeTransfer(), IsTrue());
+  for (auto it : session_.attachment_payload_map()) {
+    EXPECT_THAT(
+        connections_manager_.GetRegisteredPayloadStatusListener(it.second)
+            .lock(),
+        Eq(session_.payload_tracker().lock()));
+  }
+  std::vector<uint8_t> frame_data = frames_data.front();
+  Frame frame;
+  ASSERT_TRUE(frame.ParseFromArray(frame_data.data(), frame_data.size()));
+  ASSERT_EQ(frame.v1().type(), V1Frame::RESPONSE);
+  EXPECT_EQ(frame.v1().connection_response().status(),
+            ConnectionResponseFrame::PROVISIONAL_ACCEPT);
+  EXPECT_THAT(std::filesystem::is_directory(quarantine_dir_), IsTrue());
+  EXPECT_THAT(connections_manager_.custom_save_path(),
+              Eq(GetCompatibleU8String(quarantine_dir_.u8string())));
+
+  // Progress is withheld while the user has not accepted.
+  session_.PushPayloadTransferUpdateForTest(
+      std::make_unique<PayloadTransferUpdate>(
+          payload_id1_, PayloadStatus::kInProgress, 10, 100));
+  EXPECT_THAT(session_.ProcessPayloadTransferUpdates(false), Eq(std::nullopt));
+
+  EXPECT_CALL(
+      transfer_metadata_callback_,
+      Call(_, HasStatus(TransferMetadata::Status::kAwaitingRemoteAcceptance)));
+  EXPECT_CALL(
+      mock_event_logger_,
+      Log(Matcher<const SharingLog&>(AllOf(
+          (HasCategory(EventCategory::RECEIVING_EVENT),
+           HasEventType(EventType::RESPOND_TO_INTRODUCTION),
+           Property(&SharingLog::respond_introduction,
+                    HasAction(ResponseToIntroduction::ACCEPT_INTRODUCTION)),
+           Property(&SharingLog::respond_introduction, HasSessionId(1234)))))));
+  EXPECT_CALL(mock_event_logger_,
+              Log(Matcher<const SharingLog&>(
+                  AllOf((HasCategory(EventCategory::RECEIVING_EVENT),
+                         HasEventType(EventType::RECEIVE_ATTACHMENTS_START),
+                         Property(&SharingLog::receive_attachments_start,
+                                  HasSessionId(1234)))))));
+  bool updates_callback_called = false;
+  EXPECT_THAT(session_.AcceptTransfer([&updates_callback_called]() {
+    updates_callback_called = true;
+  }),
+              IsTrue());
+  task_runner_.SyncWithTimeout(absl::Milliseconds(100));
+
+  EXPECT_THAT(session_.IsSpeculativeTransfer(), IsFalse());
+  EXPECT_THAT(updates_callback_called, IsTrue());
+  std::optional<TransferMetadata> metadata =
+      session_.ProcessPayloadTransferUpdates(false);
+  EXPECT_THAT(metadata.has_value(), IsTrue());
+  EXPECT_THAT(*metadata, HasStatus(TransferMetadata::Status::kInProgress));
+  EXPECT_THAT(connections_manager_.custom_save_path(), Eq("save_path"));
+  // The sender learns about the acceptance only now.
+  ASSERT_THAT(frames_data.size(), Eq(2));
+  frame_data = frames_data.back();
+  ASSERT_TRUE(frame.ParseFromArray(frame_data.data(), frame_data.size()));
+  ASSERT_EQ(frame.v1().type(), V1Frame::RESPONSE);
+  EXPECT_EQ(frame.v1().connection_response().status(),
+            ConnectionResponseFrame::ACCEPT);
+  clock_.FastForward(absl::Seconds(60));
+  task_runner_.SyncWithTimeout(absl::Milliseconds(100));
+  EXPECT_THAT(accept_timeout_called, IsFalse());
+}
+
+TEST_F(IncomingShareSessionTest, SpeculativeTransferFailureCancelsPayloads) {
+  connections_manager_.AcceptConnection(
+      /*endpoint_info=*/{}, kEndpointId, &connection_);
+  session_.OnConnected(&connection_);
+  EXPECT_THAT(session_.ProcessIntroduction(introduction_frame_),
+              Eq(std::nullopt));
+  std::filesystem::path file1_path = "/usr/tmp/file1";
+  connections_manager_.SetIncomingPayload(
+      payload_id1_, CreateFilePayload(payload_id1_, file1_path));
+  session_.ReadyForTransfer([]() {}, [](std::optional<V1Frame> frame) {});
+  EXPECT_THAT(BeginSpeculativeTransfer(std::numeric_limits<int64_t>::max()),
+              IsTrue());
+  std::queue<std::vector<uint8_t>> frames_data;
+  connections_manager_.set_send_payload_callback(
+      [&](std::unique_ptr<Payload> payload,
+          std::weak_ptr<NearbyConnectionsManager::PayloadStatusListener>
+              listener) {
+        frames_data.push(std::move(payload->content.bytes_payload.bytes));
+      });
+  EXPECT_CALL(transfer_metadata_callback_,
+              Call(_, HasStatus(TransferMetadata::Status::kTimedOut)));
+
+  session_.SendFailureResponse(TransferMetadata::Status::kTimedOut);
+
+  EXPECT_THAT(session_.IsSpeculativeTransfer(), IsFalse());
+  EXPECT_THAT(connections_manager_.WasPayloadCanceled(payload_id1_), IsTrue());
+  EXPECT_THAT(session_.GetPayloadFilePaths(),
+              UnorderedElementsAre(file1_path));
+  ASSERT_THAT(frames_data.size(), Eq(1));
+  std::vector<uint8_t> frame_data = frames_data.front();
+  Frame frame;
+  ASSERT_TRUE(frame.ParseFromArray(frame_data.data(), frame_data.size()));
+  EXPECT_EQ(frame.v1().type(), V1Frame::CANCEL);
+}
+
+TEST_F(IncomingShareSessionTest, BeginSpeculativeTransferUnverified) {
+  connections_manager_.AcceptConnection(
+      /*endpoint_info=*/{}, kEndpointId, &connection_);
+  session_.OnConnected(&connection_);
+  session_.SetTokenForTests("1234");
+  std::optional<IntroductionFrame> introduction;
+  EXPECT_THAT(
+      session_.ProcessKeyVerificationResult(
+          PairedKeyVerificationRunner::PairedKeyVerificationResult::kUnable,
+          OSType::WINDOWS,
+          [&introduction](std::optional<IntroductionFrame> frame) {
+            introduction = std::move(frame);
+          }),
+      IsTrue());
+  Frame frame;
+  frame.set_version(Frame::V1);
+  frame.mutable_v1()->set_type(V1Frame::INTRODUCTION);
+  *frame.mutable_v1()->mutable_introduction() = introduction_frame_;
+  std::vector<uint8_t> data(frame.ByteSizeLong());
+  ASSERT_TRUE(frame.SerializeToArray(data.data(), data.size()));
+  connection_.WriteMessage(std::move(data));
+  ASSERT_THAT(introduction.has_value(), IsTrue());
+  EXPECT_THAT(session_.ProcessIntroduction(*introduction), Eq(std::nullopt));
+  EXPECT_THAT(
+      session_.ReadyForTransfer([]() {}, [](std::optional<V1Frame> frame) {}),
+      IsFalse());
+  int frames_sent = 0;
+  connections_manager_.set_send_payload_callback(
+      [&](std::unique_ptr<Payload> payload,
+          std::weak_ptr<NearbyConnectionsManager::PayloadStatusListener>
+              listener) { ++frames_sent; });
+
+  // The user still has to compare the token, nothing is received before.
+  EXPECT_THAT(BeginSpeculativeTransfer(std::numeric_limits<int64_t>::max()),
+              IsFalse());
+
+  EXPECT_THAT(session_.IsSpeculativeTransfer(), IsFalse());
+  EXPECT_THAT(frames_sent, Eq(0));
+  EXPECT_THAT(connections_manager_.custom_save_path(), IsEmpty());
+}
+
+TEST_F(IncomingShareSessionTest, BeginSpeculativeTransferSenderUnsupported) {
+  connections_manager_.AcceptConnection(
+      /*endpoint_info=*/{}, kEndpointId, &connection_);
+  session_.OnConnected(&connection_);
+  introduction_frame_.clear_supports_provisional_accept();
+  EXPECT_THAT(session_.ProcessIntroduction(introduction_frame_),
+              Eq(std::nullopt));
+  session_.ReadyForTransfer([]() {}, [](std::optional<V1Frame> frame) {});
+
+  EXPECT_THAT(BeginSpeculativeTransfer(std::numeric_limits<int64_t>::max()),
+              IsFalse());
+  EXPECT_THAT(session_.IsSpeculativeTransfer(), IsFalse());
+}
+
+TEST_F(IncomingShareSessionTest, SpeculativeTransferCancelledOverLimit) {
+  connections_manager_.AcceptConnection(
+      /*endpoint_info=*/{}, kEndpointId, &connection_);
+  session_.OnConnected(&connection_);
+  EXPECT_THAT(session_.ProcessIntroduction(introduction_frame_),
+              Eq(std::nullopt));
+  connections_manager_.SetIncomingPayload(
+      payload_id1_,
+      CreateFilePayload(payload_id1_, quarantine_dir_ / "file_name1"));
+  session_.ReadyForTransfer([]() {}, [](std::optional<V1Frame> frame) {});
+  int64_t max_total_size =
+      session_.attachment_container().GetTotalAttachmentsSize();
+  EXPECT_THAT(BeginSpeculativeTransfer(max_total_size), IsTrue());
+  std::queue<std::vector<uint8_t>> frames_data;
+  connections_manager_.set_send_payload_callback(
+      [&](std::unique_ptr<Payload> payload,
+          std::weak_ptr<NearbyConnectionsManager::PayloadStatusListener>
+              listener) {
+        frames_data.push(std::move(payload->content.bytes_payload.bytes));
+      });
+  session_.PushPayloadTransferUpdateForTest(
+      std::make_unique<PayloadTransferUpdate>(
+          payload_id1_, PayloadStatus::kInProgress, max_total_size,
+          max_total_size));
+  EXPECT_THAT(session_.ProcessPayloadTransferUpdates(false), Eq(std::nullopt));
+
+  // The sender declared fewer bytes than it sends.
+  session_.PushPayloadTransferUpdateForTest(
+      std::make_unique<PayloadTransferUpdate>(
+          payload_id2_, PayloadStatus::kInProgress, 200, 1));
+  std::optional<TransferMetadata> metadata =
+      session_.ProcessPayloadTransferUpdates(false);
+
+  ASSERT_THAT(metadata.has_value(), IsTrue());
+  EXPECT_THAT(*metadata, HasStatus(TransferMetadata::Status::kFailed));
+  EXPECT_THAT(session_.IsSpeculativeTransfer(), IsFalse());
+  EXPECT_THAT(connections_manager_.WasPayloadCanceled(payload_id1_), IsTrue());
+  EXPECT_THAT(connections_manager_.custom_save_path(), Eq("save_path"));
+  ASSERT_THAT(frames_data.size(), Eq(1));
+  Frame frame;
+  ASSERT_TRUE(frame.ParseFromArray(frames_data.front().data(),
+                                   frames_data.front().size()));
+  EXPECT_EQ(frame.v1().type(), V1Frame::CANCEL);
+}
+
+TEST_F(IncomingShareSessionTest, SpeculativeTransferMovesFilesOnAccept) {
+  connections_manager_.AcceptConnection(
+      /*endpoint_info=*/{}, kEndpointId, &connection_);
+  session_.OnConnected(&connection_);
+  introduction_frame_.clear_text_metadata();
+  introduction_frame_.clear_wifi_credentials_metadata();
+  introduction_frame_.mutable_file_metadata()->RemoveLast();
+  EXPECT_THAT(session_.ProcessIntroduction(introduction_frame_),
+              Eq(std::nullopt));
+  session_.ReadyForTransfer([]() {}, [](std::optional<V1Frame> frame) {});
+  EXPECT_THAT(BeginSpeculativeTransfer(std::numeric_limits<int64_t>::max()),
+              IsTrue());
+  std::filesystem::path quarantined_path =
+      quarantine_dir_ / "parent_folder1" / "file_name1";
+  std::filesystem::create_directories(quarantined_path.parent_path());
+  { std::ofstream(quarantined_path) << "content"; }
+  connections_manager_.SetIncomingPayload(
+      payload_id1_, CreateFilePayload(payload_id1_, quarantined_path));
+  session_.PushPayloadTransferUpdateForTest(
+      std::make_unique<PayloadTransferUpdate>(
+          payload_id1_, PayloadStatus::kSuccess, 100, 100));
+  // Completion waits for the user, the file stays in quarantine.
+  EXPECT_THAT(session_.ProcessPayloadTransferUpdates(false), Eq(std::nullopt));
+  EXPECT_THAT(std::filesystem::exists(quarantined_path), IsTrue());
+
+  EXPECT_CALL(transfer_metadata_callback_, Call(_, _)).Times(AnyNumber());
+  EXPECT_CALL(mock_event_logger_, Log(Matcher<const SharingLog&>(_)))
+      .Times(AnyNumber());
+  EXPECT_THAT(session_.AcceptTransfer([]() {}), IsTrue());
+  std::optional<TransferMetadata> metadata =
+      session_.ProcessPayloadTransferUpdates(false);
+
+  ASSERT_THAT(metadata.has_value(), IsTrue());
+  EXPECT_THAT(*metadata, HasStatus(TransferMetadata::Status::kComplete));
+  std::filesystem::path saved_path = save_dir_ / "parent_folder1" /
+                                     "file_name1";
+  EXPECT_THAT(std::filesystem::exists(quarantined_path), IsFalse());
+  EXPECT_THAT(std::filesystem::exists(quarantine_dir_), IsFalse());
+  EXPECT_THAT(std::filesystem::exists(saved_path), IsTrue());
+  EXPECT_THAT(session_.GetPayloadFilePaths(), UnorderedElementsAre(saved_path));
+}
+
+TEST_F(IncomingShareSessionTest, RemoveQuarantineDirKeepsFoldersWithFiles) {
+  std::filesystem::path empty_dir = quarantine_dir_ / "empty_folder";
+  std::filesystem::path file_path = quarantine_dir_ / "folder" / "file_name";
+  std::filesystem::create_directories(empty_dir);
+  std::filesystem::create_directories(file_path.parent_path());
+  { std::ofstream(file_path) << "content"; }
+
+  IncomingShareSession::RemoveQuarantineDir(quarantine_dir_);
+
+  EXPECT_THAT(std::filesystem::exists(empty_dir), IsFalse());
+  EXPECT_THAT(std::filesystem::exists(file_path), IsTrue());
+
+  std::filesystem::remove(file_path);
+  IncomingShareSession::RemoveQuarantineDir(quarantine_dir_);
+
+  EXPECT_THAT(std::filesystem::exists(quarantine_dir_), IsFalse());
+}
+
 TEST_F(IncomingShareSessionTest, ProcessKeyVerificationResultSuccess) {
   session_.OnConnected(&connection_);
   session_.SetTokenForTests("1234");
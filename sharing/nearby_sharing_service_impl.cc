@@ -71,6 +71,7 @@
 #include "sharing/fast_initiation/nearby_fast_initiation_impl.h"
 #include "sharing/file_attachment.h"
 #include "sharing/flags/generated/nearby_sharing_feature_flags.h"
+#include "sharing/flags/nearby_sharing_pending_feature_flags.h"
 #include "sharing/incoming_frames_reader.h"
 #include "sharing/incoming_share_session.h"
 #include "sharing/internal/api/bluetooth_adapter.h"
@@ -357,6 +358,8 @@ void NearbySharingServiceImpl::Cleanup() {
 
   certificate_download_during_discovery_timer_.reset();
   rotate_background_advertisement_timer_.reset();
+  speculative_connection_.reset();
+  speculative_connection_idle_timer_.reset();
 }
 
 void NearbySharingServiceImpl::SendInitialAdapterState(
@@ -775,6 +778,16 @@ void NearbySharingServiceImpl::SendAttachments(
           return;
         }
 
+        if (speculative_connection_.has_value()) {
+          if (speculative_connection_->share_target_id == share_target_id) {
+            speculative_connection_->selected = true;
+            speculative_connection_idle_timer_.reset();
+          } else {
+            // Free the radios for the share target the user picked.
+            TeardownSpeculativeConnection();
+          }
+        }
+
         session->InitiateSendAttachments(std::move(attachment_container));
 
         app_info_->SetActiveFlag();
@@ -874,9 +887,18 @@ void NearbySharingServiceImpl::Reject(
         // kRejected status already sent below, no need to send on disconnect.
         session->set_disconnect_status(TransferMetadata::Status::kUnknown);
 
-        session->WriteResponseFrame(ConnectionResponseFrame::REJECT);
-        VLOG(1) << __func__
-                << ": Successfully wrote a rejection response frame";
+        IncomingShareSession* incoming_session =
+            GetIncomingShareSession(share_target_id);
+        if (incoming_session != nullptr &&
+            incoming_session->IsSpeculativeTransfer()) {
+          // The sender is already sending, cancel instead. The received
+          // files are deleted once the kRejected status is reported.
+          incoming_session->CancelSpeculativeTransfer();
+        } else {
+          session->WriteResponseFrame(ConnectionResponseFrame::REJECT);
+          VLOG(1) << __func__
+                  << ": Successfully wrote a rejection response frame";
+        }
 
         session->UpdateTransferMetadata(
             TransferMetadataBuilder()
@@ -1793,6 +1815,7 @@ void NearbySharingServiceImpl::OnOutgoingDecryptedCertificate(
   outgoing_share_target_map_.insert_or_assign(endpoint_id, *share_target);
   CreateOutgoingShareSession(*share_target, endpoint_id,
                              std::move(certificate));
+  share_target_ranker_.OnShareTargetDiscovered(*share_target);
 
   // Update the endpoint id for the share target.
   LOG(INFO) << __func__ << ": An endpoint: " << endpoint_id
@@ -1829,6 +1852,7 @@ void NearbySharingServiceImpl::OnOutgoingDecryptedCertificate(
           << share_target->ToString() << " endpoint_id=" << endpoint_id
           << " to all send surfaces.";
 
+  MaybeStartSpeculativeConnection();
   FinishEndpointDiscoveryEvent();
 }
 
@@ -2158,6 +2182,8 @@ void NearbySharingServiceImpl::StartScanning() {
   InvalidateReceiveSurfaceState();
 
   DisableAllOutgoingShareTargets();
+  share_target_ranker_.ClearShareTargets();
+  speculative_connection_attempts_ = 0;
   discovered_advertisements_to_retry_map_.clear();
   discovered_advertisements_retried_set_.clear();
 
@@ -2195,6 +2221,12 @@ NearbySharingService::StatusCodes NearbySharingServiceImpl::StopScanning() {
 
   nearby_connections_manager_->StopDiscovery();
   is_scanning_ = false;
+  // Scanning also stops when the user selects a share target; keep the
+  // speculative connection in that case.
+  if (!speculative_connection_.has_value() ||
+      !speculative_connection_->selected) {
+    TeardownSpeculativeConnection();
+  }
 
   certificate_download_during_discovery_timer_.reset();
   discovered_advertisements_to_retry_map_.clear();
@@ -2473,6 +2505,11 @@ void NearbySharingServiceImpl::OnCreatePayloads(
     LOG(WARNING) << __func__
                  << ": Failed to send file to remote ShareTarget. Failed to "
                     "create payloads.";
+    if (speculative_connection_.has_value() &&
+        speculative_connection_->share_target_id ==
+            session.share_target().id) {
+      TeardownSpeculativeConnection();
+    }
     session.UpdateTransferMetadata(
         TransferMetadataBuilder()
             .set_status(TransferMetadata::Status::kMediaUnavailable)
@@ -2490,6 +2527,9 @@ void NearbySharingServiceImpl::OnCreatePayloads(
 
   int64_t share_target_id = session.share_target().id;
 
+  if (ClaimSpeculativeConnection(session)) {
+    return;
+  }
   session.Connect(
       std::move(endpoint_info), std::move(bluetooth_mac_address),
       settings_->GetDataUsage(), GetDisableWifiHotspotState(),
@@ -2615,6 +2655,9 @@ void NearbySharingServiceImpl::OnOutgoingTransferUpdate(
   }
 
   if (metadata.is_final_status()) {
+    if (metadata.status() == TransferMetadata::Status::kComplete) {
+      share_target_ranker_.OnTransferCompleted(session.share_target());
+    }
     session.SendAttachmentsCompleted(metadata);
     is_connecting_ = false;
     OnTransferComplete();
@@ -2868,6 +2911,22 @@ void NearbySharingServiceImpl::OnStorageCheckCompleted(
           },
           absl::bind_front(&NearbySharingServiceImpl::OnFrameRead, this,
                            session.share_target().id))) {
+    // Start receiving small shares while the user decides, so that accepting
+    // only has to wait for the remaining bytes.
+    if (NearbyFlags::GetInstance().GetBoolFlag(
+            config_package_nearby::nearby_sharing_feature::
+                kEnableSpeculativeReceive)) {
+      std::string save_path = settings_->GetCustomSavePath();
+      std::filesystem::path save_dir =
+          save_path.empty() ? device_info_.GetDownloadPath()
+                            : std::filesystem::u8path(save_path);
+      session.BeginSpeculativeTransfer(
+          kSpeculativeReceiveMaxTotalSize, std::move(save_path),
+          save_dir / kSpeculativeReceiveQuarantineDirName,
+          absl::bind_front(
+              &NearbySharingServiceImpl::OnIncomingPayloadTransferUpdates,
+              this, session.share_target().id));
+    }
     return;
   }
   // Don't need to wait for user to accept for Self share.
@@ -2899,6 +2958,29 @@ void NearbySharingServiceImpl::OnFrameRead(
       });
       break;
 
+    case nearby::sharing::service::proto::V1Frame::RESPONSE:
+      // The receiver accepted after a PROVISIONAL_ACCEPT.
+      RunOnNearbySharingServiceThread(
+          "remote_accept",
+          [this, share_target_id,
+           response = frame->connection_response()]() {
+            OutgoingShareSession* session =
+                GetOutgoingShareSession(share_target_id);
+            if (session == nullptr || !session->IsProvisionallyAccepted()) {
+              LOG(WARNING) << __func__ << ": Unexpected response frame";
+              return;
+            }
+            std::optional<TransferMetadata::Status> status =
+                session->HandleConnectionResponse(response);
+            if (status.has_value()) {
+              session->Abort(*status);
+              return;
+            }
+            // Report the progress withheld so far.
+            OnOutgoingPayloadTransferUpdates(share_target_id);
+          });
+      break;
+
     case nearby::sharing::service::proto::V1Frame::CERTIFICATE_INFO:
       // No-op, no longer used.
       break;
@@ -2939,6 +3021,208 @@ void NearbySharingServiceImpl::OnConnectionDisconnected(
   UnregisterShareTarget(share_target_id);
 }
 
+void NearbySharingServiceImpl::MaybeStartSpeculativeConnection() {
+  if (!NearbyFlags::GetInstance().GetBoolFlag(
+          config_package_nearby::nearby_sharing_feature::
+              kEnableSpeculativeConnection)) {
+    return;
+  }
+  if (speculative_connection_.has_value() || !is_scanning_ ||
+      is_transferring_ || is_connecting_ ||
+      foreground_send_surface_map_.empty() ||
+      speculative_connection_attempts_ >= kMaxSpeculativeConnectionAttempts) {
+    return;
+  }
+  std::optional<int64_t> share_target_id =
+      share_target_ranker_.GetTopShareTarget();
+  if (!share_target_id.has_value()) {
+    return;
+  }
+  OutgoingShareSession* session = GetOutgoingShareSession(*share_target_id);
+  if (session == nullptr || session->IsConnected()) {
+    return;
+  }
+  std::optional<std::vector<uint8_t>> endpoint_info =
+      CreateEndpointInfo(DeviceVisibility::DEVICE_VISIBILITY_ALL_CONTACTS,
+                         local_device_data_manager_->GetDeviceName());
+  if (!endpoint_info) {
+    return;
+  }
+
+  LOG(INFO) << __func__ << ": Speculatively connecting to share target "
+            << *share_target_id;
+  ++speculative_connection_attempts_;
+  speculative_connection_ = SpeculativeConnection{*share_target_id};
+  speculative_connection_idle_timer_ = std::make_unique<ThreadTimer>(
+      *service_thread_, "speculative_connection_idle",
+      kSpeculativeConnectionIdleTimeout,
+      [this]() { TeardownSpeculativeConnection(); });
+  session->Connect(
+      std::move(*endpoint_info), GetBluetoothMacAddressForShareTarget(*session),
+      settings_->GetDataUsage(), GetDisableWifiHotspotState(),
+      absl::bind_front(&NearbySharingServiceImpl::OnSpeculativeConnection,
+                       this, *share_target_id));
+}
+
+void NearbySharingServiceImpl::OnSpeculativeConnection(
+    int64_t share_target_id, absl::string_view endpoint_id,
+    NearbyConnection* connection, Status status) {
+  if (!speculative_connection_.has_value() ||
+      speculative_connection_->share_target_id != share_target_id) {
+    // Torn down while connecting.
+    if (connection != nullptr) {
+      nearby_connections_manager_->Disconnect(endpoint_id);
+    }
+    return;
+  }
+  if (speculative_connection_->claimed) {
+    // The payloads are ready, carry on as a regular outgoing connection.
+    speculative_connection_.reset();
+    OnOutgoingConnection(share_target_id, endpoint_id, connection, status);
+    return;
+  }
+  OutgoingShareSession* session = GetOutgoingShareSession(share_target_id);
+  if (connection == nullptr || session == nullptr) {
+    LOG(INFO) << __func__ << ": Speculative connection to share target "
+              << share_target_id << " failed.";
+    if (connection != nullptr) {
+      nearby_connections_manager_->Disconnect(endpoint_id);
+    }
+    speculative_connection_.reset();
+    speculative_connection_idle_timer_.reset();
+    return;
+  }
+  connection->SetDisconnectionListener([this, share_target_id]() {
+    OnSpeculativeConnectionDisconnected(share_target_id);
+  });
+  session->OnConnectResult(connection, status);
+  // Nothing is reported to the send surfaces until the user selects the
+  // share target.
+  session->set_disconnect_status(TransferMetadata::Status::kUnknown);
+  session->RunPairedKeyVerification(
+      ToProtoOsType(device_info_.GetOsType()),
+      {
+          .visibility = settings_->GetVisibility(),
+          .last_visibility = settings_->GetLastVisibility(),
+          .last_visibility_time = settings_->GetLastVisibilityTimestamp(),
+      },
+      GetCertificateManager(),
+      absl::bind_front(
+          &NearbySharingServiceImpl::OnSpeculativeConnectionKeyVerificationDone,
+          this, share_target_id));
+}
+
+void NearbySharingServiceImpl::OnSpeculativeConnectionKeyVerificationDone(
+    int64_t share_target_id,
+    PairedKeyVerificationRunner::PairedKeyVerificationResult result,
+    OSType share_target_os_type) {
+  if (!speculative_connection_.has_value() ||
+      speculative_connection_->share_target_id != share_target_id) {
+    return;
+  }
+  OutgoingShareSession* session = GetOutgoingShareSession(share_target_id);
+  if (session == nullptr || !session->IsConnected()) {
+    speculative_connection_.reset();
+    speculative_connection_idle_timer_.reset();
+    return;
+  }
+  if (speculative_connection_->claimed) {
+    speculative_connection_.reset();
+    HandOffSpeculativeConnection(*session);
+    OnOutgoingConnectionKeyVerificationDone(share_target_id, result,
+                                            share_target_os_type);
+    return;
+  }
+  if (result == PairedKeyVerificationRunner::PairedKeyVerificationResult::
+                    kFail) {
+    TeardownSpeculativeConnection();
+    return;
+  }
+  VLOG(1) << __func__ << ": Speculative connection to share target "
+          << share_target_id << " is ready.";
+  speculative_connection_->verification =
+      std::make_pair(result, share_target_os_type);
+}
+
+void NearbySharingServiceImpl::OnSpeculativeConnectionDisconnected(
+    int64_t share_target_id) {
+  if (IsShuttingDown()) {
+    return;
+  }
+  bool claimed = false;
+  if (speculative_connection_.has_value() &&
+      speculative_connection_->share_target_id == share_target_id) {
+    claimed = speculative_connection_->claimed;
+    speculative_connection_.reset();
+    speculative_connection_idle_timer_.reset();
+  }
+  OutgoingShareSession* session = GetOutgoingShareSession(share_target_id);
+  if (claimed) {
+    // The user is waiting for this transfer, report the failure.
+    if (session != nullptr) {
+      session->set_disconnect_status(TransferMetadata::Status::kFailed);
+    }
+    OnConnectionDisconnected(share_target_id);
+    return;
+  }
+  if (session != nullptr) {
+    session->OnDisconnect();
+  }
+}
+
+bool NearbySharingServiceImpl::ClaimSpeculativeConnection(
+    OutgoingShareSession& session) {
+  int64_t share_target_id = session.share_target().id;
+  if (!speculative_connection_.has_value() ||
+      speculative_connection_->share_target_id != share_target_id) {
+    return false;
+  }
+  speculative_connection_idle_timer_.reset();
+  if (!speculative_connection_->verification.has_value()) {
+    // Still connecting or verifying, the transfer continues from there.
+    LOG(INFO) << __func__ << ": Waiting for speculative connection to "
+              << share_target_id;
+    speculative_connection_->claimed = true;
+    return true;
+  }
+  LOG(INFO) << __func__ << ": Using speculative connection to "
+            << share_target_id;
+  auto [result, share_target_os_type] = *speculative_connection_->verification;
+  speculative_connection_.reset();
+  HandOffSpeculativeConnection(session);
+  OnOutgoingConnectionKeyVerificationDone(share_target_id, result,
+                                          share_target_os_type);
+  return true;
+}
+
+void NearbySharingServiceImpl::HandOffSpeculativeConnection(
+    OutgoingShareSession& session) {
+  int64_t share_target_id = session.share_target().id;
+  session.connection()->SetDisconnectionListener([this, share_target_id]() {
+    OnConnectionDisconnected(share_target_id);
+  });
+  session.set_disconnect_status(TransferMetadata::Status::kFailed);
+}
+
+void NearbySharingServiceImpl::TeardownSpeculativeConnection() {
+  speculative_connection_idle_timer_.reset();
+  if (!speculative_connection_.has_value()) {
+    return;
+  }
+  SpeculativeConnection speculative_connection = *speculative_connection_;
+  speculative_connection_.reset();
+  if (speculative_connection.claimed) {
+    return;
+  }
+  OutgoingShareSession* session =
+      GetOutgoingShareSession(speculative_connection.share_target_id);
+  if (session != nullptr && session->IsConnected()) {
+    LOG(INFO) << __func__ << ": Closing speculative connection to "
+              << speculative_connection.share_target_id;
+    session->Disconnect();
+  }
+}
+
 std::optional<ShareTarget> NearbySharingServiceImpl::CreateShareTarget(
     absl::string_view endpoint_id, const Advertisement& advertisement,
     const std::optional<NearbyShareDecryptedPublicCertificate>& certificate,
@@ -3142,7 +3426,15 @@ void NearbySharingServiceImpl::RemoveIncomingPayloads(
       session.GetPayloadFilePaths();
   files_for_deletion.insert(files_for_deletion.end(), payload_file_path.begin(),
                             payload_file_path.end());
-  file_handler_.DeleteFilesFromDisk(std::move(files_for_deletion), []() {});
+  // The quarantine folder of a speculative transfer can only go once the
+  // partial files in it are deleted.
+  file_handler_.DeleteFilesFromDisk(
+      std::move(files_for_deletion),
+      [quarantine_dir = session.quarantine_dir()]() {
+        if (!quarantine_dir.empty()) {
+          IncomingShareSession::RemoveQuarantineDir(quarantine_dir);
+        }
+      });
 }
 
 IncomingShareSession& NearbySharingServiceImpl::CreateIncomingShareSession(
@@ -3186,6 +3478,7 @@ void NearbySharingServiceImpl::DeduplicateInOutgoingShareTarget(
   }
   session_it->second.UpdateSessionForDedup(share_target, std::move(certificate),
                                            endpoint_id);
+  share_target_ranker_.OnShareTargetDiscovered(share_target);
 
   for (auto& entry : foreground_send_surface_map_) {
     entry.second.OnShareTargetUpdated(share_target);
@@ -3204,6 +3497,7 @@ void NearbySharingServiceImpl::DeDuplicateInDiscoveryCache(
     const ShareTarget& share_target, absl::string_view endpoint_id,
     std::optional<NearbyShareDecryptedPublicCertificate> certificate) {
   CreateOutgoingShareSession(share_target, endpoint_id, std::move(certificate));
+  share_target_ranker_.OnShareTargetDiscovered(share_target);
   for (auto& entry : foreground_send_surface_map_) {
     entry.second.OnShareTargetUpdated(share_target);
   }
@@ -3215,6 +3509,8 @@ void NearbySharingServiceImpl::DeDuplicateInDiscoveryCache(
             << ": [Dedupped] Reported OnShareTargetUpdated to all surfaces "
                "for share_target: "
             << share_target.ToString();
+
+  MaybeStartSpeculativeConnection();
 }
 
 bool NearbySharingServiceImpl::FindDuplicateInDiscoveryCache(
@@ -3305,6 +3601,11 @@ NearbySharingServiceImpl::RemoveOutgoingShareTargetWithEndpointId(
   VLOG(1) << __func__ << ": Removing (endpoint_id=" << endpoint_id
           << ", share_target.id=" << target_node.mapped().id
           << ") from outgoing share target map";
+  share_target_ranker_.OnShareTargetLost(share_target.id);
+  if (speculative_connection_.has_value() &&
+      speculative_connection_->share_target_id == share_target.id) {
+    TeardownSpeculativeConnection();
+  }
 
   // Do not destroy the session until it has been removed from the map.
   // Session destruction can trigger callbacks that traverses the map and it
@@ -25,6 +25,7 @@
 #include <queue>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "absl/base/attributes.h"
@@ -73,6 +74,7 @@
 #include "sharing/share_session.h"
 #include "sharing/share_target.h"
 #include "sharing/share_target_discovered_callback.h"
+#include "sharing/share_target_ranker.h"
 #include "sharing/thread_timer.h"
 #include "sharing/transfer_metadata.h"
 #include "sharing/transfer_update_callback.h"
@@ -354,6 +356,25 @@ class NearbySharingServiceImpl
 
   void OnConnectionDisconnected(int64_t share_target_id);
 
+  // Connects to and verifies the most likely share target while the send
+  // surface is in the foreground, before the user selects it.
+  void MaybeStartSpeculativeConnection();
+  void OnSpeculativeConnection(int64_t share_target_id,
+                               absl::string_view endpoint_id,
+                               NearbyConnection* connection, Status status);
+  void OnSpeculativeConnectionKeyVerificationDone(
+      int64_t share_target_id,
+      PairedKeyVerificationRunner::PairedKeyVerificationResult result,
+      ::location::nearby::proto::sharing::OSType share_target_os_type);
+  void OnSpeculativeConnectionDisconnected(int64_t share_target_id);
+  // Continues the transfer of |session| over the speculative connection to
+  // its share target. Returns false if there is no such connection.
+  bool ClaimSpeculativeConnection(OutgoingShareSession& session);
+  // Turns the speculative connection of |session| into a regular one.
+  void HandOffSpeculativeConnection(OutgoingShareSession& session);
+  // Closes the speculative connection unless a transfer already claimed it.
+  void TeardownSpeculativeConnection();
+
   void Cleanup();
 
   std::optional<ShareTarget> CreateShareTarget(
@@ -598,6 +619,29 @@ class NearbySharingServiceImpl
 
   // Used to track the time when share sheet activity starts
   absl::Time share_foreground_send_surface_start_timestamp_;
+
+  // A connection opened to a share target before the user selected it.
+  struct SpeculativeConnection {
+    int64_t share_target_id;
+    // True once SendAttachments() was called for the share target.
+    bool selected = false;
+    // True once the payloads are ready. The transfer continues as soon as the
+    // connection is verified.
+    bool claimed = false;
+    // The paired key verification result, once available.
+    std::optional<
+        std::pair<PairedKeyVerificationRunner::PairedKeyVerificationResult,
+                  ::location::nearby::proto::sharing::OSType>>
+        verification;
+  };
+  // Ranks discovered share targets for speculative connections.
+  ShareTargetRanker share_target_ranker_{context_->GetClock()};
+  // At most one speculative connection is open at any time.
+  std::optional<SpeculativeConnection> speculative_connection_;
+  // Closes the speculative connection if its share target is not selected.
+  std::unique_ptr<ThreadTimer> speculative_connection_idle_timer_;
+  // Speculative connections started in the current scanning session.
+  int speculative_connection_attempts_ = 0;
   std::unique_ptr<nearby::api::AppInfo> app_info_;
 };
 
@@ -68,6 +68,7 @@
 #include "sharing/fast_initiation/nearby_fast_initiation_impl.h"
 #include "sharing/file_attachment.h"
 #include "sharing/flags/generated/nearby_sharing_feature_flags.h"
+#include "sharing/flags/nearby_sharing_pending_feature_flags.h"
 #include "sharing/incoming_share_session.h"
 #include "sharing/internal/api/mock_app_info.h"
 #include "sharing/internal/api/mock_sharing_platform.h"
@@ -1042,6 +1043,57 @@ class NearbySharingServiceImplTest : public testing::Test {
     }
   }
 
+  // Returns the simulated time from SendAttachments() until the introduction
+  // frame, the first frame that describes the transfer, is written. The remote
+  // device answers the paired key handshake |handshake_latency| after it is
+  // connected.
+  absl::Duration MeasureTimeToIntroductionFrame(
+      MockTransferUpdateCallback& transfer_callback,
+      MockShareTargetDiscoveredCallback& discovery_callback,
+      absl::Duration handshake_latency) {
+    SetVisibility(DeviceVisibility::DEVICE_VISIBILITY_ALL_CONTACTS);
+    local_device_data_manager()->SetDeviceName(kDeviceName);
+    fake_nearby_connections_manager_->SetRawAuthenticationToken(kEndpointId,
+                                                                GetToken());
+    fake_nearby_connections_manager_->set_nearby_connection(connection_.get());
+    int64_t share_target_id =
+        DiscoverShareTarget(transfer_callback, discovery_callback);
+    bool connected_before_selection =
+        fake_nearby_connections_manager_->connection_endpoint_info(kEndpointId)
+            .has_value();
+    if (connected_before_selection) {
+      // The handshake completes while the user picks the share target.
+      FastForward(handshake_latency);
+      SetUpKeyVerification(/*is_incoming=*/false,
+                           PairedKeyResultFrame::SUCCESS);
+    }
+
+    absl::Notification introduction_notification;
+    ExpectTransferUpdates(transfer_callback, share_target_id,
+                          {TransferMetadata::Status::kConnecting,
+                           TransferMetadata::Status::kAwaitingRemoteAcceptance},
+                          [&]() { introduction_notification.Notify(); });
+    EXPECT_CALL(*mock_app_info_, SetActiveFlag());
+    absl::Time start_time = fake_context_.fake_clock()->Now();
+    EXPECT_EQ(SendAttachments(share_target_id,
+                              CreateTextAttachments({kTextPayload})),
+              NearbySharingServiceImpl::StatusCodes::kOk);
+    if (!connected_before_selection) {
+      FastForward(handshake_latency);
+      SetUpKeyVerification(/*is_incoming=*/false,
+                           PairedKeyResultFrame::SUCCESS);
+    }
+    EXPECT_TRUE(introduction_notification.WaitForNotificationWithTimeout(
+        kWaitTimeout));
+    absl::Duration time_to_introduction =
+        fake_context_.fake_clock()->Now() - start_time;
+
+    EXPECT_TRUE(ExpectPairedKeyEncryptionFrame());
+    EXPECT_TRUE(ExpectPairedKeyResultFrame());
+    EXPECT_TRUE(ExpectIntroductionFrame().has_value());
+    return time_to_introduction;
+  }
+
   PayloadInfo AcceptAndSendPayload(
       MockTransferUpdateCallback& transfer_callback, int64_t share_target_id) {
     // We're now waiting for the remote device to respond with the accept
@@ -3615,6 +3667,116 @@ TEST_F(NearbySharingServiceImplTest, SendTextSuccessClosedConnection) {
   FastForward(kOutgoingDisconnectionDelay);
 }
 
+TEST_F(NearbySharingServiceImplTest,
+       SendTextUsesSpeculativeConnectionToTopShareTarget) {
+  NearbyFlags::GetInstance().OverrideBoolFlagValue(
+      config_package_nearby::nearby_sharing_feature::
+          kEnableSpeculativeConnection,
+      true);
+  MockTransferUpdateCallback transfer_callback;
+  MockShareTargetDiscoveredCallback discovery_callback;
+  int64_t target_id =
+      SetUpOutgoingShareTarget(transfer_callback, discovery_callback);
+  ScopedSendSurface s(service_.get(), &transfer_callback);
+
+  // The known contact is connected before the user selects it.
+  EXPECT_EQ(fake_nearby_connections_manager_->connect_count(), 1);
+  EXPECT_TRUE(
+      fake_nearby_connections_manager_->connection_endpoint_info(kEndpointId)
+          .has_value());
+
+  // SendAttachments() claims the speculative connection instead of opening a
+  // second one.
+  SetUpOutgoingConnectionUntilAccept(transfer_callback, target_id);
+  EXPECT_EQ(fake_nearby_connections_manager_->connect_count(), 1);
+  PayloadInfo info = AcceptAndSendPayload(transfer_callback, target_id);
+  FinishOutgoingTransfer(transfer_callback, target_id, /*complete=*/true, info);
+  EXPECT_EQ(fake_nearby_connections_manager_->connect_count(), 1);
+}
+
+TEST_F(NearbySharingServiceImplTest, SpeculativeConnectionClosesWhenIdle) {
+  NearbyFlags::GetInstance().OverrideBoolFlagValue(
+      config_package_nearby::nearby_sharing_feature::
+          kEnableSpeculativeConnection,
+      true);
+  MockTransferUpdateCallback transfer_callback;
+  MockShareTargetDiscoveredCallback discovery_callback;
+  SetUpOutgoingShareTarget(transfer_callback, discovery_callback);
+  ScopedSendSurface s(service_.get(), &transfer_callback);
+  EXPECT_TRUE(
+      fake_nearby_connections_manager_->connection_endpoint_info(kEndpointId)
+          .has_value());
+
+  FastForward(kSpeculativeConnectionIdleTimeout - absl::Seconds(1));
+  EXPECT_TRUE(
+      fake_nearby_connections_manager_->connection_endpoint_info(kEndpointId)
+          .has_value());
+
+  // The share target was never selected, release the radios.
+  FastForward(absl::Seconds(1));
+  EXPECT_FALSE(
+      fake_nearby_connections_manager_->connection_endpoint_info(kEndpointId)
+          .has_value());
+  EXPECT_EQ(fake_nearby_connections_manager_->connect_count(), 1);
+}
+
+TEST_F(NearbySharingServiceImplTest, SpeculativeConnectionAttemptsAreCapped) {
+  NearbyFlags::GetInstance().OverrideBoolFlagValue(
+      config_package_nearby::nearby_sharing_feature::
+          kEnableSpeculativeConnection,
+      true);
+  SetVisibility(DeviceVisibility::DEVICE_VISIBILITY_ALL_CONTACTS);
+  local_device_data_manager()->SetDeviceName(kDeviceName);
+  MockTransferUpdateCallback transfer_callback;
+  MockShareTargetDiscoveredCallback discovery_callback;
+  EXPECT_EQ(RegisterSendSurface(&transfer_callback, &discovery_callback,
+                                SendSurfaceState::kForeground),
+            NearbySharingService::StatusCodes::kOk);
+  ScopedSendSurface s(service_.get(), &transfer_callback);
+
+  // No connection is set up, so every speculative connection fails and each
+  // newly discovered share target would start another one.
+  EXPECT_CALL(discovery_callback, OnShareTargetDiscovered)
+      .Times(kMaxSpeculativeConnectionAttempts + 1);
+  for (int i = 0; i <= kMaxSpeculativeConnectionAttempts; ++i) {
+    FindEndpoint(/*endpoint_id=*/absl::StrCat(i));
+    ProcessLatestPublicCertificateDecryption(/*expected_num_calls=*/i + 1,
+                                             /*success=*/true);
+  }
+  EXPECT_EQ(fake_nearby_connections_manager_->connect_count(),
+            kMaxSpeculativeConnectionAttempts);
+}
+
+TEST_F(NearbySharingServiceImplTest,
+       TimeToIntroductionFrameWithoutSpeculativeConnection) {
+  constexpr absl::Duration kHandshakeLatency = absl::Seconds(2);
+  MockTransferUpdateCallback transfer_callback;
+  MockShareTargetDiscoveredCallback discovery_callback;
+  ScopedSendSurface s(service_.get(), &transfer_callback);
+  // The user waits for the whole handshake.
+  EXPECT_EQ(MeasureTimeToIntroductionFrame(transfer_callback,
+                                           discovery_callback,
+                                           kHandshakeLatency),
+            kHandshakeLatency);
+}
+
+TEST_F(NearbySharingServiceImplTest,
+       TimeToIntroductionFrameWithSpeculativeConnection) {
+  NearbyFlags::GetInstance().OverrideBoolFlagValue(
+      config_package_nearby::nearby_sharing_feature::
+          kEnableSpeculativeConnection,
+      true);
+  constexpr absl::Duration kHandshakeLatency = absl::Seconds(2);
+  MockTransferUpdateCallback transfer_callback;
+  MockShareTargetDiscoveredCallback discovery_callback;
+  ScopedSendSurface s(service_.get(), &transfer_callback);
+  // The handshake is already done when the user selects the share target.
+  EXPECT_EQ(MeasureTimeToIntroductionFrame(transfer_callback,
+                                           discovery_callback,
+                                           kHandshakeLatency),
+            absl::ZeroDuration());
+}
+
 TEST_F(NearbySharingServiceImplTest, SendFilesSuccess) {
   MockTransferUpdateCallback transfer_callback;
   MockShareTargetDiscoveredCallback discovery_callback;
@@ -0,0 +1,647 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// End-to-end transfer cost between two NearbySharingService instances that
+// live in the same process and talk over the simulated mediums.
+//
+// Every iteration sends one share from the sender to the receiver, accepts it
+// and waits for both sides to report completion. Besides wall time and
+// throughput, each benchmark reports these counters:
+//   ttfb_ms        Time from SendAttachments() to the first payload bytes
+//                  reported by the receiver.
+//   accept_to_complete_ms
+//                  Time from Accept() on the receiver to both sides reporting
+//                  completion, i.e. how long the user waits after accepting.
+//   cpu_ms_per_mb  Process CPU time spent per MiB transferred.
+//   peak_rss_kb    Peak resident set size of the process.
+//
+// Run with --benchmark_format=json to get machine-readable results.
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>  // NOLINT(build/c++17)
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "base/casts.h"
+#include "gmock/gmock.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/strings/str_cat.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/synchronization/notification.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "internal/flags/nearby_flags.h"
+#include "internal/platform/medium_environment.h"
+#include "internal/test/fake_account_manager.h"
+#include "internal/test/fake_device_info.h"
+#include "internal/test/fake_task_runner.h"
+#include "sharing/advertisement.h"
+#include "sharing/analytics/analytics_recorder.h"
+#include "sharing/attachment_container.h"
+#include "sharing/certificates/fake_nearby_share_certificate_manager.h"
+#include "sharing/certificates/nearby_share_certificate_manager_impl.h"
+#include "sharing/common/nearby_share_enums.h"
+#include "sharing/common/nearby_share_prefs.h"
+#include "sharing/contacts/fake_nearby_share_contact_manager.h"
+#include "sharing/contacts/nearby_share_contact_manager_impl.h"
+#include "sharing/fast_initiation/fake_nearby_fast_initiation.h"
+#include "sharing/fast_initiation/nearby_fast_initiation_impl.h"
+#include "sharing/file_attachment.h"
+#include "sharing/flags/generated/nearby_sharing_feature_flags.h"
+#include "sharing/flags/nearby_sharing_pending_feature_flags.h"
+#include "sharing/internal/api/mock_app_info.h"
+#include "sharing/internal/api/mock_sharing_platform.h"
+#include "sharing/internal/test/fake_context.h"
+#include "sharing/internal/test/fake_preference_manager.h"
+#include "sharing/local_device_data/fake_nearby_share_local_device_data_manager.h"
+#include "sharing/local_device_data/nearby_share_local_device_data_manager_impl.h"
+#include "sharing/nearby_connections_manager_impl.h"
+#include "sharing/nearby_connections_service_impl.h"
+#include "sharing/nearby_sharing_service.h"
+#include "sharing/nearby_sharing_service_impl.h"
+#include "sharing/nearby_sharing_settings.h"
+#include "sharing/proto/enums.pb.h"
+#include "sharing/proto/wire_format.pb.h"
+#include "sharing/share_target.h"
+#include "sharing/share_target_discovered_callback.h"
+#include "sharing/text_attachment.h"
+#include "sharing/transfer_metadata.h"
+#include "sharing/transfer_update_callback.h"
+
+namespace nearby::sharing {
+namespace {
+
+using ConnectionType = ::nearby::ConnectivityManager::ConnectionType;
+using ::nearby::sharing::api::MockAppInfo;
+using ::nearby::sharing::api::MockSharingPlatform;
+using ::nearby::sharing::proto::DeviceVisibility;
+using ::nearby::sharing::service::proto::TextMetadata;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::ReturnRef;
+
+constexpr absl::Duration kDiscoveryTimeout = absl::Seconds(30);
+constexpr absl::Duration kTransferTimeout = absl::Minutes(5);
+constexpr absl::Duration kPumpInterval = absl::Milliseconds(10);
+constexpr double kBytesPerMb = 1024.0 * 1024.0;
+
+// Timings of a single completed transfer.
+struct TransferTimes {
+  absl::Duration ttfb;
+  absl::Duration accept_to_complete;
+};
+
+double CpuTimeMs() {
+  struct rusage usage = {};
+  getrusage(RUSAGE_SELF, &usage);
+  return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1e3 +
+         (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e3;
+}
+
+int64_t PeakRssKb() {
+  struct rusage usage = {};
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss;
+}
+
+// Tracks transfer and discovery updates delivered to one service.
+class TransferObserver : public TransferUpdateCallback,
+                         public ShareTargetDiscoveredCallback {
+ public:
+  // TransferUpdateCallback:
+  void OnTransferUpdate(const ShareTarget& share_target,
+                        const AttachmentContainer& attachment_container,
+                        const TransferMetadata& transfer_metadata) override {
+    absl::MutexLock lock(&mutex_);
+    TransferMetadata::Status status = transfer_metadata.status();
+    if (status == TransferMetadata::Status::kAwaitingLocalConfirmation) {
+      pending_share_target_id_ = share_target.id;
+    }
+    if (!first_byte_time_.has_value() &&
+        status == TransferMetadata::Status::kInProgress &&
+        transfer_metadata.transferred_bytes() > 0) {
+      first_byte_time_ = absl::Now();
+    }
+    if (transfer_metadata.is_final_status()) {
+      final_status_ = status;
+    }
+  }
+
+  // ShareTargetDiscoveredCallback:
+  void OnShareTargetDiscovered(const ShareTarget& share_target) override {
+    absl::MutexLock lock(&mutex_);
+    discovered_share_target_id_ = share_target.id;
+  }
+  void OnShareTargetLost(const ShareTarget& share_target) override {
+    absl::MutexLock lock(&mutex_);
+    if (discovered_share_target_id_ == share_target.id) {
+      discovered_share_target_id_.reset();
+    }
+  }
+  void OnShareTargetUpdated(const ShareTarget& share_target) override {}
+
+  // Clears per-transfer state before the next iteration.
+  void Reset() {
+    absl::MutexLock lock(&mutex_);
+    pending_share_target_id_.reset();
+    first_byte_time_.reset();
+    final_status_.reset();
+  }
+
+  std::optional<int64_t> discovered_share_target_id() {
+    absl::MutexLock lock(&mutex_);
+    return discovered_share_target_id_;
+  }
+
+  // Returns and clears the share target waiting for local confirmation.
+  std::optional<int64_t> TakePendingShareTargetId() {
+    absl::MutexLock lock(&mutex_);
+    return std::exchange(pending_share_target_id_, std::nullopt);
+  }
+
+  std::optional<absl::Time> first_byte_time() {
+    absl::MutexLock lock(&mutex_);
+    return first_byte_time_;
+  }
+
+  std::optional<TransferMetadata::Status> final_status() {
+    absl::MutexLock lock(&mutex_);
+    return final_status_;
+  }
+
+ private:
+  absl::Mutex mutex_;
+  std::optional<int64_t> discovered_share_target_id_ ABSL_GUARDED_BY(mutex_);
+  std::optional<int64_t> pending_share_target_id_ ABSL_GUARDED_BY(mutex_);
+  std::optional<absl::Time> first_byte_time_ ABSL_GUARDED_BY(mutex_);
+  std::optional<TransferMetadata::Status> final_status_
+      ABSL_GUARDED_BY(mutex_);
+};
+
+// One simulated device running a full NearbySharingServiceImpl on top of the
+// real Nearby Connections stack.
+class SharingDevice {
+ public:
+  explicit SharingDevice(const std::filesystem::path& download_path) {
+    fake_device_info_.SetDownloadPath(download_path);
+    ON_CALL(mock_sharing_platform_, GetDeviceInfo)
+        .WillByDefault(ReturnRef(fake_device_info_));
+    ON_CALL(mock_sharing_platform_, GetPreferenceManager)
+        .WillByDefault(ReturnRef(preference_manager_));
+    ON_CALL(mock_sharing_platform_, GetAccountManager)
+        .WillByDefault(ReturnRef(fake_account_manager_));
+    ON_CALL(mock_sharing_platform_, UpdateFileOriginMetadata)
+        .WillByDefault(Return(true));
+    ON_CALL(mock_sharing_platform_, CreateAppInfo)
+        .WillByDefault(
+            []() { return std::make_unique<NiceMock<MockAppInfo>>(); });
+    prefs::RegisterNearbySharingPrefs(preference_manager_);
+
+    fake_context_.fake_bluetooth_adapter()->ReceivedAdapterPresentChangedFromOs(
+        true);
+    fake_context_.fake_bluetooth_adapter()->ReceivedAdapterPoweredChangedFromOs(
+        true);
+    fake_context_.fake_connectivity_manager()->SetConnectionType(
+        ConnectionType::kWifi);
+
+    auto service_task_runner =
+        std::make_unique<FakeTaskRunner>(fake_context_.fake_clock(), 1);
+    service_task_runner_ = service_task_runner.get();
+    analytics_recorder_ = std::make_unique<analytics::AnalyticsRecorder>(
+        /*vendor_id=*/0, /*event_logger=*/nullptr);
+    service_ = std::make_unique<NearbySharingServiceImpl>(
+        std::move(service_task_runner), &fake_context_, mock_sharing_platform_,
+        std::make_unique<NearbyConnectionsManagerImpl>(
+            fake_context_.fake_task_runner(), &fake_context_,
+            *fake_context_.GetConnectivityManager(), fake_device_info_,
+            std::make_unique<NearbyConnectionsServiceImpl>(
+                /*event_logger=*/nullptr)),
+        analytics_recorder_.get());
+  }
+
+  ~SharingDevice() {
+    absl::Notification shutdown;
+    service_->Shutdown([&shutdown](NearbySharingService::StatusCodes) {
+      shutdown.Notify();
+    });
+    shutdown.WaitForNotificationWithTimeout(kDiscoveryTimeout);
+    service_.reset();
+  }
+
+  NearbySharingServiceImpl& service() { return *service_; }
+
+  // Answers pending public certificate lookups with no certificate, so share
+  // targets are created from the device name in the advertisement.
+  void PumpCertificateLookups() {
+    auto* certificate_manager = down_cast<FakeNearbyShareCertificateManager*>(
+        service_->GetCertificateManager());
+    service_task_runner_->PostTask([certificate_manager]() {
+      std::vector<FakeNearbyShareCertificateManager::
+                      GetDecryptedPublicCertificateCall>
+          calls;
+      calls.swap(certificate_manager->get_decrypted_public_certificate_calls());
+      for (auto& call : calls) {
+        call.callback(std::nullopt);
+      }
+    });
+  }
+
+ private:
+  FakeContext fake_context_;
+  FakeDeviceInfo fake_device_info_;
+  FakePreferenceManager preference_manager_;
+  FakeAccountManager fake_account_manager_;
+  NiceMock<MockSharingPlatform> mock_sharing_platform_;
+  std::unique_ptr<analytics::AnalyticsRecorder> analytics_recorder_;
+  FakeTaskRunner* service_task_runner_ = nullptr;
+  std::unique_ptr<NearbySharingServiceImpl> service_;
+};
+
+// Builds one share from the benchmark arguments.
+class ShareContent {
+ public:
+  virtual ~ShareContent() = default;
+  virtual std::unique_ptr<AttachmentContainer> CreateContainer() const = 0;
+  virtual int64_t total_bytes() const = 0;
+};
+
+class FileShareContent : public ShareContent {
+ public:
+  FileShareContent(const std::filesystem::path& directory, int file_count,
+                   int64_t file_size) {
+    std::string block(64 * 1024, 'f');
+    for (int i = 0; i < file_count; ++i) {
+      std::filesystem::path path =
+          directory / absl::StrCat("payload_", i, ".bin");
+      std::ofstream file(path, std::ios::binary);
+      for (int64_t written = 0; written < file_size;) {
+        int64_t chunk = std::min<int64_t>(block.size(), file_size - written);
+        file.write(block.data(), chunk);
+        written += chunk;
+      }
+      paths_.push_back(path);
+    }
+    total_bytes_ = file_count * file_size;
+  }
+
+  std::unique_ptr<AttachmentContainer> CreateContainer() const override {
+    auto container = std::make_unique<AttachmentContainer>();
+    for (const auto& path : paths_) {
+      container->AddFileAttachment(FileAttachment(path));
+    }
+    return container;
+  }
+
+  int64_t total_bytes() const override { return total_bytes_; }
+
+ private:
+  std::vector<std::filesystem::path> paths_;
+  int64_t total_bytes_ = 0;
+};
+
+class TextShareContent : public ShareContent {
+ public:
+  TextShareContent(int text_count, int64_t text_size)
+      : text_count_(text_count), text_(text_size, 't') {}
+
+  std::unique_ptr<AttachmentContainer> CreateContainer() const override {
+    auto container = std::make_unique<AttachmentContainer>();
+    for (int i = 0; i < text_count_; ++i) {
+      container->AddTextAttachment(TextAttachment(
+          TextMetadata::TEXT, text_, /*text_title=*/std::nullopt,
+          /*mime_type=*/std::nullopt));
+    }
+    return container;
+  }
+
+  int64_t total_bytes() const override {
+    return text_count_ * static_cast<int64_t>(text_.size());
+  }
+
+ private:
+  int text_count_;
+  std::string text_;
+};
+
+// Owns the process-wide fakes and the two devices for one benchmark run.
+class TransferFixture {
+ public:
+  TransferFixture()
+      : root_(std::filesystem::temp_directory_path() /
+              absl::StrCat("nearby_share_bench_", getpid())),
+        outgoing_path_(root_ / "outgoing"),
+        incoming_path_(root_ / "incoming") {
+    std::filesystem::create_directories(outgoing_path_);
+    std::filesystem::create_directories(incoming_path_);
+    MediumEnvironment::Instance().Start();
+    NearbyShareLocalDeviceDataManagerImpl::Factory::SetFactoryForTesting(
+        &local_device_data_manager_factory_);
+    NearbyShareContactManagerImpl::Factory::SetFactoryForTesting(
+        &contact_manager_factory_);
+    NearbyShareCertificateManagerImpl::Factory::SetFactoryForTesting(
+        &certificate_manager_factory_);
+    NearbyFastInitiationImpl::Factory::SetFactoryForTesting(
+        &fast_initiation_factory_);
+    NearbyFlags::GetInstance().OverrideBoolFlagValue(
+        config_package_nearby::nearby_sharing_feature::kEnableMediumWifiLan,
+        true);
+    sender_ = std::make_unique<SharingDevice>(outgoing_path_);
+    receiver_ = std::make_unique<SharingDevice>(incoming_path_);
+  }
+
+  ~TransferFixture() {
+    sender_.reset();
+    receiver_.reset();
+    NearbyShareLocalDeviceDataManagerImpl::Factory::SetFactoryForTesting(
+        nullptr);
+    NearbyShareContactManagerImpl::Factory::SetFactoryForTesting(nullptr);
+    NearbyShareCertificateManagerImpl::Factory::SetFactoryForTesting(nullptr);
+    NearbyFastInitiationImpl::Factory::SetFactoryForTesting(nullptr);
+    NearbyFlags::GetInstance().ResetOverridedValues();
+    MediumEnvironment::Instance().Stop();
+    std::filesystem::remove_all(root_);
+  }
+
+  const std::filesystem::path& outgoing_path() const {
+    return outgoing_path_;
+  }
+
+  // Makes the receiver visible and lets the sender discover it. Returns the
+  // share target id of the receiver, or std::nullopt on timeout.
+  std::optional<int64_t> Connect() {
+    receiver_->service().GetSettings()->SetVisibility(
+        DeviceVisibility::DEVICE_VISIBILITY_EVERYONE);
+    receiver_->service().RegisterReceiveSurface(
+        &receiver_observer_,
+        NearbySharingService::ReceiveSurfaceState::kForeground,
+        Advertisement::BlockedVendorId::kNone,
+        [](NearbySharingService::StatusCodes) {});
+    sender_->service().RegisterSendSurface(
+        &sender_observer_, &sender_observer_,
+        NearbySharingService::SendSurfaceState::kForeground,
+        Advertisement::BlockedVendorId::kNone,
+        /*disable_wifi_hotspot=*/true,
+        [](NearbySharingService::StatusCodes) {});
+    return WaitForShareTarget();
+  }
+
+  // Waits until the sender discovers the receiver. A share target is lost and
+  // rediscovered with a new id after every transfer. Returns the current share
+  // target id of the receiver, or std::nullopt on timeout.
+  std::optional<int64_t> WaitForShareTarget() {
+    absl::Time deadline = absl::Now() + kDiscoveryTimeout;
+    while (absl::Now() < deadline) {
+      sender_->PumpCertificateLookups();
+      if (auto id = sender_observer_.discovered_share_target_id()) {
+        return id;
+      }
+      absl::SleepFor(kPumpInterval);
+    }
+    return std::nullopt;
+  }
+
+  // Keeps answering certificate lookups on both sides for |duration|.
+  void Idle(absl::Duration duration) {
+    absl::Time deadline = absl::Now() + duration;
+    while (absl::Now() < deadline) {
+      sender_->PumpCertificateLookups();
+      receiver_->PumpCertificateLookups();
+      absl::SleepFor(kPumpInterval);
+    }
+  }
+
+  // Sends one share and waits for both sides to finish. The receiver accepts
+  // |user_delay| after it is asked to, simulating the user reading the
+  // prompt. Returns std::nullopt if the transfer did not complete.
+  std::optional<TransferTimes> Transfer(int64_t share_target_id,
+                                        const ShareContent& content,
+                                        absl::Duration user_delay) {
+    sender_observer_.Reset();
+    receiver_observer_.Reset();
+    absl::Time start = absl::Now();
+    sender_->service().SendAttachments(
+        share_target_id, content.CreateContainer(),
+        [](NearbySharingService::StatusCodes) {});
+    absl::Time deadline = start + kTransferTimeout;
+    std::optional<int64_t> pending_id;
+    absl::Time accept_time = absl::InfiniteFuture();
+    while (absl::Now() < deadline) {
+      receiver_->PumpCertificateLookups();
+      if (auto id = receiver_observer_.TakePendingShareTargetId()) {
+        pending_id = id;
+        accept_time = absl::Now() + user_delay;
+      }
+      if (pending_id.has_value() && absl::Now() >= accept_time) {
+        accept_time = absl::Now();
+        receiver_->service().Accept(*pending_id,
+                                    [](NearbySharingService::StatusCodes) {});
+        pending_id.reset();
+      }
+      std::optional<TransferMetadata::Status> sent =
+          sender_observer_.final_status();
+      std::optional<TransferMetadata::Status> received =
+          receiver_observer_.final_status();
+      if (sent.has_value() && received.has_value()) {
+        std::optional<absl::Time> first_byte =
+            receiver_observer_.first_byte_time();
+        if (*sent != TransferMetadata::Status::kComplete ||
+            *received != TransferMetadata::Status::kComplete ||
+            !first_byte.has_value()) {
+          return std::nullopt;
+        }
+        return TransferTimes{*first_byte - start, absl::Now() - accept_time};
+      }
+      absl::SleepFor(absl::Milliseconds(1));
+    }
+    return std::nullopt;
+  }
+
+  // Removes received files so every iteration writes to an empty directory.
+  void ClearIncoming() {
+    for (const auto& entry :
+         std::filesystem::directory_iterator(incoming_path_)) {
+      std::filesystem::remove_all(entry.path());
+    }
+  }
+
+ private:
+  std::filesystem::path root_;
+  std::filesystem::path outgoing_path_;
+  std::filesystem::path incoming_path_;
+  FakeNearbyShareLocalDeviceDataManager::Factory
+      local_device_data_manager_factory_;
+  FakeNearbyShareContactManager::Factory contact_manager_factory_;
+  FakeNearbyShareCertificateManager::Factory certificate_manager_factory_;
+  FakeNearbyFastInitiation::Factory fast_initiation_factory_;
+  TransferObserver sender_observer_;
+  TransferObserver receiver_observer_;
+  std::unique_ptr<SharingDevice> sender_;
+  std::unique_ptr<SharingDevice> receiver_;
+};
+
+void RunTransferBenchmark(benchmark::State& state, TransferFixture& fixture,
+                          const ShareContent& content,
+                          absl::Duration user_delay = absl::ZeroDuration()) {
+  if (!fixture.Connect().has_value()) {
+    state.SkipWithError("Receiver was not discovered");
+    return;
+  }
+
+  absl::Duration total_ttfb;
+  absl::Duration total_accept_to_complete;
+  double cpu_start_ms = CpuTimeMs();
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::optional<int64_t> share_target_id = fixture.WaitForShareTarget();
+    state.ResumeTiming();
+    if (!share_target_id.has_value()) {
+      state.SkipWithError("Receiver was not rediscovered");
+      return;
+    }
+    std::optional<TransferTimes> times =
+        fixture.Transfer(*share_target_id, content, user_delay);
+    if (!times.has_value()) {
+      state.SkipWithError("Transfer did not complete");
+      return;
+    }
+    total_ttfb += times->ttfb;
+    total_accept_to_complete += times->accept_to_complete;
+    state.PauseTiming();
+    fixture.ClearIncoming();
+    state.ResumeTiming();
+  }
+  double cpu_ms = CpuTimeMs() - cpu_start_ms;
+
+  int64_t total_bytes = state.iterations() * content.total_bytes();
+  state.SetBytesProcessed(total_bytes);
+  state.counters["ttfb_ms"] =
+      benchmark::Counter(absl::ToDoubleMilliseconds(total_ttfb),
+                         benchmark::Counter::kAvgIterations);
+  state.counters["accept_to_complete_ms"] = benchmark::Counter(
+      absl::ToDoubleMilliseconds(total_accept_to_complete),
+      benchmark::Counter::kAvgIterations);
+  state.counters["cpu_ms_per_mb"] =
+      total_bytes > 0 ? cpu_ms / (total_bytes / kBytesPerMb) : 0;
+  state.counters["peak_rss_kb"] = PeakRssKb();
+}
+
+// Arguments: file count, bytes per file.
+void BM_TransferFiles(benchmark::State& state) {
+  TransferFixture fixture;
+  FileShareContent content(fixture.outgoing_path(), state.range(0),
+                           state.range(1));
+  RunTransferBenchmark(state, fixture, content);
+}
+BENCHMARK(BM_TransferFiles)
+    ->ArgNames({"files", "bytes"})
+    ->Args({100, 4 * 1024})
+    ->Args({2, 64 * 1024 * 1024})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Arguments: text count, bytes per text.
+void BM_TransferText(benchmark::State& state) {
+  TransferFixture fixture;
+  TextShareContent content(state.range(0), state.range(1));
+  RunTransferBenchmark(state, fixture, content);
+}
+BENCHMARK(BM_TransferText)
+    ->ArgNames({"texts", "bytes"})
+    ->Args({1, 256})
+    ->Args({10, 16 * 1024})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Time to first byte when the user selects the receiver a while after it was
+// discovered. A first, untimed transfer makes the receiver a recent share
+// target, so that it ranks high enough to be connected to speculatively.
+// Arguments: speculative connection enabled, selection delay in milliseconds.
+void BM_TransferAfterSelection(benchmark::State& state) {
+  TransferFixture fixture;
+  NearbyFlags::GetInstance().OverrideBoolFlagValue(
+      config_package_nearby::nearby_sharing_feature::
+          kEnableSpeculativeConnection,
+      state.range(0) != 0);
+  TextShareContent content(/*text_count=*/1, /*text_size=*/256);
+  std::optional<int64_t> share_target_id = fixture.Connect();
+  if (!share_target_id.has_value() ||
+      !fixture.Transfer(*share_target_id, content, absl::ZeroDuration())
+           .has_value()) {
+    state.SkipWithError("Warm-up transfer did not complete");
+    return;
+  }
+
+  absl::Duration total_ttfb;
+  for (auto _ : state) {
+    state.PauseTiming();
+    share_target_id = fixture.WaitForShareTarget();
+    if (!share_target_id.has_value()) {
+      state.SkipWithError("Receiver was not rediscovered");
+      return;
+    }
+    // The user looks at the share sheet before picking the receiver.
+    fixture.Idle(absl::Milliseconds(state.range(1)));
+    state.ResumeTiming();
+    std::optional<TransferTimes> times =
+        fixture.Transfer(*share_target_id, content, absl::ZeroDuration());
+    if (!times.has_value()) {
+      state.SkipWithError("Transfer did not complete");
+      return;
+    }
+    total_ttfb += times->ttfb;
+  }
+  state.counters["ttfb_ms"] =
+      benchmark::Counter(absl::ToDoubleMilliseconds(total_ttfb),
+                         benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_TransferAfterSelection)
+    ->ArgNames({"speculative", "delay_ms"})
+    ->Args({0, 2000})
+    ->Args({1, 2000})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Perceived completion time when the user takes a while to accept.
+// Arguments: speculative receive enabled, user delay in milliseconds,
+// bytes of the single shared file.
+void BM_TransferWithUserDelay(benchmark::State& state) {
+  TransferFixture fixture;
+  NearbyFlags::GetInstance().OverrideBoolFlagValue(
+      config_package_nearby::nearby_sharing_feature::kEnableSpeculativeReceive,
+      state.range(0) != 0);
+  FileShareContent content(fixture.outgoing_path(), /*file_count=*/1,
+                           state.range(2));
+  RunTransferBenchmark(state, fixture, content,
+                       absl::Milliseconds(state.range(1)));
+}
+BENCHMARK(BM_TransferWithUserDelay)
+    ->ArgNames({"speculative", "delay_ms", "bytes"})
+    ->Args({0, 1000, 16 * 1024 * 1024})
+    ->Args({1, 1000, 16 * 1024 * 1024})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace nearby::sharing
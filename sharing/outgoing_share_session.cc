@@ -382,6 +382,7 @@ bool OutgoingShareSession::SendIntroduction(
   v1_frame->set_type(V1Frame::INTRODUCTION);
   IntroductionFrame* introduction_frame = v1_frame->mutable_introduction();
   introduction_frame->set_start_transfer(true);
+  introduction_frame->set_supports_provisional_accept(true);
   if (!FillIntroductionFrame(introduction_frame)) {
     return false;
   }
@@ -414,7 +415,15 @@ OutgoingShareSession::HandleConnectionResponse(
   VLOG(1) << "Successfully read the connection response frame.";
 
   switch (response->status()) {
+    case ConnectionResponseFrame::PROVISIONAL_ACCEPT:
+      if (provisionally_accepted_) {
+        break;
+      }
+      VLOG(1) << "The receiver stores the payloads until its user accepts.";
+      provisionally_accepted_ = true;
+      return std::nullopt;
     case ConnectionResponseFrame::ACCEPT: {
+      provisionally_accepted_ = false;
       UpdateTransferMetadata(
           TransferMetadataBuilder()
               .set_status(TransferMetadata::Status::kInProgress)
@@ -576,7 +585,12 @@ OutgoingShareSession::ProcessPayloadTransferUpdates() {
       payload_updates_queue()->ReadAll();
   VLOG(1) << "Received " << updates.size() << " PayloadTransferUpdates.";
   if (updates.empty()) {
-    return std::nullopt;
+    if (provisionally_accepted_) {
+      return std::nullopt;
+    }
+    std::optional<TransferMetadata> metadata = std::move(provisional_metadata_);
+    provisional_metadata_.reset();
+    return metadata;
   }
 
   std::optional<TransferMetadata> metadata;
@@ -584,6 +598,17 @@ OutgoingShareSession::ProcessPayloadTransferUpdates() {
     metadata =
         get_payload_tracker()->ProcessPayloadUpdate(std::move(updates.front()));
   }
+  if (provisionally_accepted_ && metadata.has_value() &&
+      (!metadata->is_final_status() ||
+       metadata->status() == TransferMetadata::Status::kComplete)) {
+    // Failures end the session right away, progress waits for the receiver.
+    provisional_metadata_ = std::move(metadata);
+    return std::nullopt;
+  }
+  if (!metadata.has_value()) {
+    metadata = std::move(provisional_metadata_);
+  }
+  provisional_metadata_.reset();
   return metadata;
 }
 
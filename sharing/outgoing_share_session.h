@@ -110,10 +110,16 @@ class OutgoingShareSession : public ShareSession {
   // Process the ConnectionResponseFrame.
   // On success, returns std::nullopt.
   // On failure, returns the status if the connection should be aborted.
+  // A PROVISIONAL_ACCEPT lets payloads be sent while the transfer keeps
+  // waiting for the ACCEPT that follows it.
   std::optional<TransferMetadata::Status> HandleConnectionResponse(
       std::optional<nearby::sharing::service::proto::ConnectionResponseFrame>
           response);
 
+  // Returns true if payloads are sent while the receiver's user has not
+  // accepted the transfer yet.
+  bool IsProvisionallyAccepted() const { return provisionally_accepted_; }
+
   // Begin sending payloads.
   // Listen to the payload status change and send the status to
   // `payload_transder_update_callback`.
@@ -182,6 +188,10 @@ class OutgoingShareSession : public ShareSession {
   // not press accept within the timeout.
   std::unique_ptr<ThreadTimer> mutual_acceptance_timeout_;
   std::optional<TransferMetadata> pending_complete_metadata_;
+  bool provisionally_accepted_ = false;
+  // The latest metadata produced while provisionally accepted. It is reported
+  // once the receiver accepts the transfer.
+  std::optional<TransferMetadata> provisional_metadata_;
   absl::Time connection_start_time_;
 };
 
@@ -77,6 +77,7 @@ using ::testing::IsEmpty;
 using ::testing::IsFalse;
 using ::testing::IsTrue;
 using ::testing::Matcher;
+using ::testing::Mock;
 using ::testing::MockFunction;
 using ::testing::Property;
 using ::testing::SizeIs;
@@ -448,6 +449,7 @@ TEST_F(OutgoingShareSessionTest, SendIntroductionSuccess) {
   ASSERT_THAT(frame.v1().type(), Eq(V1Frame::INTRODUCTION));
   const IntroductionFrame& intro_frame = frame.v1().introduction();
   EXPECT_THAT(intro_frame.start_transfer(), IsTrue());
+  EXPECT_THAT(intro_frame.supports_provisional_accept(), IsTrue());
   const std::vector<Payload>& text_payloads = session_.text_payloads();
   ASSERT_THAT(intro_frame.text_metadata_size(), Eq(2));
   EXPECT_THAT(intro_frame.text_metadata(0).id(), Eq(text1_.id()));
@@ -676,6 +678,33 @@ TEST_F(OutgoingShareSessionTest, HandleConnectionResponseAcceptResponse) {
   ASSERT_THAT(status.has_value(), IsFalse());
 }
 
+TEST_F(OutgoingShareSessionTest,
+       HandleConnectionResponseProvisionalAcceptResponse) {
+  ConnectionResponseFrame response;
+  response.set_status(ConnectionResponseFrame::PROVISIONAL_ACCEPT);
+  NearbyConnectionImpl connection(device_info_);
+  session_.set_session_id(1234);
+  ConnectionSuccess(&connection);
+  // The transfer is not reported as accepted yet.
+  EXPECT_CALL(transfer_metadata_callback_, Call(_, _)).Times(0);
+
+  std::optional<TransferMetadata::Status> status =
+      session_.HandleConnectionResponse(response);
+
+  ASSERT_THAT(status.has_value(), IsFalse());
+  EXPECT_THAT(session_.IsProvisionallyAccepted(), IsTrue());
+  Mock::VerifyAndClearExpectations(&transfer_metadata_callback_);
+
+  EXPECT_CALL(transfer_metadata_callback_,
+              Call(_, HasStatus(TransferMetadata::Status::kInProgress)));
+  response.set_status(ConnectionResponseFrame::ACCEPT);
+
+  status = session_.HandleConnectionResponse(response);
+
+  ASSERT_THAT(status.has_value(), IsFalse());
+  EXPECT_THAT(session_.IsProvisionallyAccepted(), IsFalse());
+}
+
 TEST_F(OutgoingShareSessionTest, SendPayloads) {
   InitSendAttachments(CreateDefaultAttachmentContainer());
   session_.set_session_id(1234);
@@ -0,0 +1,105 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sharing/share_target_ranker.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "absl/time/time.h"
+#include "internal/platform/clock.h"
+#include "sharing/share_target.h"
+
+namespace nearby::sharing {
+namespace {
+
+// Transfers older than this no longer make a device more likely.
+constexpr absl::Duration kRecentTransferWindow = absl::Hours(24 * 7);
+
+constexpr int kRecentTransferScore = 4;
+constexpr int kSelfShareScore = 2;
+constexpr int kKnownContactScore = 1;
+
+}  // namespace
+
+ShareTargetRanker::ShareTargetRanker(Clock* clock) : clock_(clock) {}
+
+void ShareTargetRanker::OnShareTargetDiscovered(
+    const ShareTarget& share_target) {
+  auto it = candidates_.find(share_target.id);
+  if (it != candidates_.end()) {
+    it->second.share_target = share_target;
+    return;
+  }
+  candidates_.emplace(share_target.id,
+                      Candidate{share_target, clock_->Now()});
+}
+
+void ShareTargetRanker::OnShareTargetLost(int64_t share_target_id) {
+  candidates_.erase(share_target_id);
+}
+
+void ShareTargetRanker::OnTransferCompleted(const ShareTarget& share_target) {
+  if (!share_target.device_id.has_value()) {
+    return;
+  }
+  last_transfer_times_[*share_target.device_id] = clock_->Now();
+}
+
+void ShareTargetRanker::ClearShareTargets() { candidates_.clear(); }
+
+std::optional<int64_t> ShareTargetRanker::GetTopShareTarget() const {
+  const Candidate* top = nullptr;
+  int top_score = 0;
+  for (const auto& [id, candidate] : candidates_) {
+    if (candidate.share_target.receive_disabled) {
+      continue;
+    }
+    int score = Score(candidate.share_target);
+    if (score == 0) {
+      continue;
+    }
+    if (top == nullptr || score > top_score ||
+        (score == top_score &&
+         candidate.discovered_time < top->discovered_time)) {
+      top = &candidate;
+      top_score = score;
+    }
+  }
+  if (top == nullptr) {
+    return std::nullopt;
+  }
+  return top->share_target.id;
+}
+
+int ShareTargetRanker::Score(const ShareTarget& share_target) const {
+  int score = 0;
+  if (share_target.device_id.has_value()) {
+    auto it = last_transfer_times_.find(*share_target.device_id);
+    if (it != last_transfer_times_.end() &&
+        clock_->Now() - it->second < kRecentTransferWindow) {
+      score += kRecentTransferScore;
+    }
+  }
+  if (share_target.for_self_share) {
+    score += kSelfShareScore;
+  }
+  if (share_target.is_known) {
+    score += kKnownContactScore;
+  }
+  return score;
+}
+
+}  // namespace nearby::sharing
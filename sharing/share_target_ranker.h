@@ -0,0 +1,79 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef THIRD_PARTY_NEARBY_SHARING_SHARE_TARGET_RANKER_H_
+#define THIRD_PARTY_NEARBY_SHARING_SHARE_TARGET_RANKER_H_
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/time/time.h"
+#include "internal/platform/clock.h"
+#include "sharing/share_target.h"
+
+namespace nearby::sharing {
+
+// Ranks the discovered outgoing share targets by how likely the user is to
+// pick them, so that the service can connect to the most likely one before it
+// is selected.
+//
+// A share target scores for a recent successful transfer to the same device,
+// for being one of the user's own devices and for being a known contact. The
+// sharing layer does not see the signal strength, so ties are broken by the
+// discovery time: the target that was discovered first is usually the closest
+// one.
+//
+// This class is thread-compatible.
+class ShareTargetRanker {
+ public:
+  explicit ShareTargetRanker(Clock* clock);
+
+  // Adds or updates a discovered share target.
+  void OnShareTargetDiscovered(const ShareTarget& share_target);
+
+  // Removes a share target that is no longer discovered.
+  void OnShareTargetLost(int64_t share_target_id);
+
+  // Records a successful transfer to the device behind |share_target|. The
+  // device is identified by the device ID derived from its certificate or
+  // endpoint, never by its name, which any device can claim. Share targets
+  // without a device ID have no transfer history.
+  void OnTransferCompleted(const ShareTarget& share_target);
+
+  // Removes all discovered share targets. Transfer history is kept.
+  void ClearShareTargets();
+
+  // Returns the id of the most likely share target, or std::nullopt if no
+  // discovered share target is likely enough to be worth connecting to.
+  std::optional<int64_t> GetTopShareTarget() const;
+
+ private:
+  struct Candidate {
+    ShareTarget share_target;
+    absl::Time discovered_time;
+  };
+
+  int Score(const ShareTarget& share_target) const;
+
+  Clock* const clock_;
+  absl::flat_hash_map<int64_t, Candidate> candidates_;
+  // Time of the last successful transfer, keyed by ShareTarget::device_id.
+  absl::flat_hash_map<std::string, absl::Time> last_transfer_times_;
+};
+
+}  // namespace nearby::sharing
+
+#endif  // THIRD_PARTY_NEARBY_SHARING_SHARE_TARGET_RANKER_H_
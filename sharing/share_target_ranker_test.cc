@@ -0,0 +1,155 @@
+// Copyright 2024 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sharing/share_target_ranker.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "absl/time/time.h"
+#include "internal/test/fake_clock.h"
+#include "sharing/share_target.h"
+
+namespace nearby::sharing {
+namespace {
+
+ShareTarget CreateShareTarget(int64_t id, std::string device_id,
+                              bool is_known = false,
+                              bool for_self_share = false) {
+  ShareTarget share_target;
+  share_target.id = id;
+  share_target.device_name = "device";
+  share_target.device_id = std::move(device_id);
+  share_target.is_known = is_known;
+  share_target.for_self_share = for_self_share;
+  return share_target;
+}
+
+class ShareTargetRankerTest : public ::testing::Test {
+ protected:
+  FakeClock fake_clock_;
+  ShareTargetRanker ranker_{&fake_clock_};
+};
+
+TEST_F(ShareTargetRankerTest, NoShareTargets) {
+  EXPECT_EQ(ranker_.GetTopShareTarget(), std::nullopt);
+}
+
+TEST_F(ShareTargetRankerTest, UnknownShareTargetIsNotRanked) {
+  ranker_.OnShareTargetDiscovered(CreateShareTarget(1, "a"));
+
+  EXPECT_EQ(ranker_.GetTopShareTarget(), std::nullopt);
+}
+
+TEST_F(ShareTargetRankerTest, SelfShareBeforeKnownContact) {
+  ranker_.OnShareTargetDiscovered(
+      CreateShareTarget(1, "a", /*is_known=*/true));
+  ranker_.OnShareTargetDiscovered(
+      CreateShareTarget(2, "b", /*is_known=*/true, /*for_self_share=*/true));
+
+  EXPECT_EQ(ranker_.GetTopShareTarget(), 2);
+}
+
+TEST_F(ShareTargetRankerTest, RecentTransferBeforeSelfShare) {
+  ShareTarget recent = CreateShareTarget(1, "a", /*is_known=*/true);
+  ranker_.OnTransferCompleted(recent);
+  ranker_.OnShareTargetDiscovered(recent);
+  ranker_.OnShareTargetDiscovered(
+      CreateShareTarget(2, "b", /*is_known=*/true, /*for_self_share=*/true));
+
+  EXPECT_EQ(ranker_.GetTopShareTarget(), 1);
+}
+
+TEST_F(ShareTargetRankerTest, TransferHistoryIsNotKeyedByDeviceName) {
+  ShareTarget recent = CreateShareTarget(1, "a", /*is_known=*/true);
+  ranker_.OnTransferCompleted(recent);
+  // Same device name as |recent|, but another device.
+  ShareTarget impostor = CreateShareTarget(2, "b", /*is_known=*/true);
+  ranker_.OnShareTargetDiscovered(impostor);
+  ShareTarget self_share =
+      CreateShareTarget(3, "c", /*is_known=*/true, /*for_self_share=*/true);
+  ranker_.OnShareTargetDiscovered(self_share);
+
+  EXPECT_EQ(recent.device_name, impostor.device_name);
+  EXPECT_EQ(ranker_.GetTopShareTarget(), 3);
+}
+
+TEST_F(ShareTargetRankerTest, NoTransferHistoryWithoutDeviceId) {
+  ShareTarget anonymous = CreateShareTarget(1, "a", /*is_known=*/true);
+  anonymous.device_id.reset();
+  ranker_.OnTransferCompleted(anonymous);
+  ranker_.OnShareTargetDiscovered(anonymous);
+  ranker_.OnShareTargetDiscovered(
+      CreateShareTarget(2, "b", /*is_known=*/true, /*for_self_share=*/true));
+
+  EXPECT_EQ(ranker_.GetTopShareTarget(), 2);
+}
+
+TEST_F(ShareTargetRankerTest, OldTransferIsIgnored) {
+  ShareTarget old = CreateShareTarget(1, "a", /*is_known=*/true);
+  ranker_.OnTransferCompleted(old);
+  fake_clock_.FastForward(absl::Hours(24 * 8));
+  ranker_.OnShareTargetDiscovered(old);
+  ranker_.OnShareTargetDiscovered(
+      CreateShareTarget(2, "b", /*is_known=*/true, /*for_self_share=*/true));
+
+  EXPECT_EQ(ranker_.GetTopShareTarget(), 2);
+}
+
+TEST_F(ShareTargetRankerTest, TieBrokenByDiscoveryTime) {
+  ranker_.OnShareTargetDiscovered(
+      CreateShareTarget(1, "a", /*is_known=*/true));
+  fake_clock_.FastForward(absl::Seconds(1));
+  ranker_.OnShareTargetDiscovered(
+      CreateShareTarget(2, "b", /*is_known=*/true));
+  // Rediscovery does not move the target to the back.
+  fake_clock_.FastForward(absl::Seconds(1));
+  ranker_.OnShareTargetDiscovered(
+      CreateShareTarget(1, "a", /*is_known=*/true));
+
+  EXPECT_EQ(ranker_.GetTopShareTarget(), 1);
+}
+
+TEST_F(ShareTargetRankerTest, ReceiveDisabledIsSkipped) {
+  ShareTarget disabled = CreateShareTarget(1, "a", /*is_known=*/true);
+  disabled.receive_disabled = true;
+  ranker_.OnShareTargetDiscovered(disabled);
+
+  EXPECT_EQ(ranker_.GetTopShareTarget(), std::nullopt);
+}
+
+TEST_F(ShareTargetRankerTest, LostAndClearedTargetsAreRemoved) {
+  ShareTarget target = CreateShareTarget(1, "a", /*is_known=*/true);
+  ranker_.OnShareTargetDiscovered(target);
+  ranker_.OnShareTargetDiscovered(
+      CreateShareTarget(2, "b", /*is_known=*/true));
+
+  ranker_.OnShareTargetLost(1);
+  EXPECT_EQ(ranker_.GetTopShareTarget(), 2);
+
+  ranker_.OnTransferCompleted(target);
+  ranker_.ClearShareTargets();
+  EXPECT_EQ(ranker_.GetTopShareTarget(), std::nullopt);
+
+  // Transfer history survives ClearShareTargets().
+  ranker_.OnShareTargetDiscovered(
+      CreateShareTarget(2, "b", /*is_known=*/true, /*for_self_share=*/true));
+  ranker_.OnShareTargetDiscovered(target);
+  EXPECT_EQ(ranker_.GetTopShareTarget(), 1);
+}
+
+}  // namespace
+}  // namespace nearby::sharing